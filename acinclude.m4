@@ -39,6 +39,13 @@ AC_DEFUN([AX_LIBSMDEV_CHECK_LOCAL],
     [AC_CHECK_HEADERS([cygwin/fs.h linux/fs.h sys/disk.h sys/disklabel.h])
   ])
 
+  dnl Headers and functions included in libsmdev/libsmdev_device_list.c, libsmdev/libsmdev_probe_cache.c and libsmdev/libsmdev_sysfs.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_HEADERS([dirent.h limits.h])
+    AC_CHECK_FUNCS([fdopen getpid mkstemp readlink realpath])
+  ])
+
   dnl Headers included in libsmdev/libsmdev_ata.c
   AS_IF(
     [test "x$ac_cv_enable_winapi" = xno],
@@ -63,6 +70,42 @@ AC_DEFUN([AX_LIBSMDEV_CHECK_LOCAL],
     [AC_CHECK_HEADERS([linux/usbdevice_fs.h linux/usb/ch9.h sys/ioctl.h])
   ])
 
+  dnl Functions used in libsmdev/libsmdev_copy.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([copy_file_range pipe splice])
+  ])
+
+  dnl Functions used in libsmdev/libsmdev_handle.c, libsmdev/libsmdev_io_control.c and libsmdev/libsmdev_simulated_device.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([nanosleep])
+  ])
+
+  dnl Functions used in libsmdev/libsmdev_io_backend.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([pread])
+  ])
+
+  dnl Functions used in libsmdev/libsmdev_io_control.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([getenv])
+  ])
+
+  dnl Functions used in libsmdev/libsmdev_read_ahead.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([posix_fadvise])
+  ])
+
+  dnl Functions used in libsmdev/libsmdev_handle.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_FUNCS([fdatasync fsync])
+  ])
+
   dnl File input/output functions used in libbfio/libbfio_file.h
   AC_CHECK_FUNCS([close fstat ftruncate lseek open read stat write])
 
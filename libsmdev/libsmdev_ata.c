@@ -32,6 +32,7 @@
 #endif
 
 #include "libsmdev_ata.h"
+#include "libsmdev_io_control.h"
 #include "libsmdev_libcerror.h"
 #include "libsmdev_libcfile.h"
 #include "libsmdev_libcnotify.h"
@@ -71,11 +72,23 @@ int libsmdev_ata_get_device_configuration(
 
 		return( -1 );
 	}
-	read_count = libcfile_file_io_control_read(
+	if( memory_set(
+	     device_configuration,
+	     0,
+	     sizeof( struct hd_driveid ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear device configuration.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libsmdev_io_control_read(
 	              device_file,
 	              HDIO_GET_IDENTITY,
-	              NULL,
-	              0,
 	              (uint8_t *) device_configuration,
 	              sizeof( struct hd_driveid ),
 	              error );
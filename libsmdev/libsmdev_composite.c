@@ -0,0 +1,1877 @@
+/*
+ * Composite device functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <winioctl.h>
+
+#elif defined( HAVE_CYGWIN_FS_H )
+#include <cygwin/fs.h>
+
+#elif defined( HAVE_LINUX_FS_H )
+/* Required for Linux platforms that use a sizeof( u64 )
+ * in linux/fs.h but have no typedef of it
+ */
+#if !defined( HAVE_U64 )
+typedef size_t u64;
+#endif
+
+#include <linux/fs.h>
+
+#else
+
+#if defined( HAVE_SYS_DISK_H )
+#include <sys/disk.h>
+#endif
+
+#if defined( HAVE_SYS_DISKLABEL_H )
+#include <sys/disklabel.h>
+#endif
+
+#endif /* defined( WINAPI ) */
+
+#include "libsmdev_composite.h"
+#include "libsmdev_definitions.h"
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcnotify.h"
+#include "libsmdev_libcthreads.h"
+
+/* Creates a composite member
+ * Make sure the value member is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_composite_member_initialize(
+     libsmdev_composite_member_t **member,
+     libsmdev_composite_t *composite,
+     int member_index,
+     libsmdev_io_backend_t *io_backend,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_composite_member_initialize";
+
+	if( member == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member.",
+		 function );
+
+		return( -1 );
+	}
+	if( *member != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid member value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid composite.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	*member = memory_allocate_structure(
+	           libsmdev_composite_member_t );
+
+	if( *member == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create member.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *member,
+	     0,
+	     sizeof( libsmdev_composite_member_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear member.",
+		 function );
+
+		goto on_error;
+	}
+	( *member )->composite    = composite;
+	( *member )->member_index = member_index;
+	( *member )->io_backend   = io_backend;
+	( *member )->size         = size;
+
+	return( 1 );
+
+on_error:
+	if( *member != NULL )
+	{
+		memory_free(
+		 *member );
+
+		*member = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a composite member
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_composite_member_free(
+     libsmdev_composite_member_t **member,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_composite_member_free";
+
+	if( member == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member.",
+		 function );
+
+		return( -1 );
+	}
+	if( *member != NULL )
+	{
+		/* The IO backend is not managed by the member
+		 */
+		if( ( *member )->stripes_buffer != NULL )
+		{
+			memory_free(
+			 ( *member )->stripes_buffer );
+		}
+		memory_free(
+		 *member );
+
+		*member = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the current read request of a composite member
+ * A read that fails is not considered an error, the number of bytes read
+ * before the failure and the error code are stored in the member instead
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_composite_member_read(
+     libsmdev_composite_member_t *member,
+     libcerror_error_t **error )
+{
+	static char *function  = "libsmdev_composite_member_read";
+	off64_t current_offset = 0;
+	ssize_t read_count     = 0;
+	uint32_t error_code    = 0;
+
+	if( member == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member.",
+		 function );
+
+		return( -1 );
+	}
+	if( member->read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid member - missing read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	member->read_count = 0;
+	member->error_code = 0;
+
+	/* Keep the offset of the IO backend of the member in sync for the reads of its own handle
+	 */
+	current_offset = libsmdev_io_backend_seek_offset(
+	                  member->io_backend,
+	                  0,
+	                  SEEK_CUR,
+	                  error );
+
+	if( current_offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek current offset of member: %d.",
+		 function,
+		 member->member_index );
+
+		return( -1 );
+	}
+	while( member->read_count < member->read_size )
+	{
+		read_count = libsmdev_io_backend_read_buffer_at_offset(
+		              member->io_backend,
+		              &( member->read_buffer[ member->read_count ] ),
+		              member->read_size - member->read_count,
+		              member->read_offset + (off64_t) member->read_count,
+		              &error_code,
+		              error );
+
+		if( read_count == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read member: %d at offset: %" PRIi64 " (0x%08" PRIx64 ") with error code: %" PRIu32 ".\n",
+				 function,
+				 member->member_index,
+				 member->read_offset + (off64_t) member->read_count,
+				 member->read_offset + (off64_t) member->read_count,
+				 error_code );
+
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			member->error_code = error_code;
+
+			break;
+		}
+		if( read_count == 0 )
+		{
+			break;
+		}
+		member->read_count += (size_t) read_count;
+	}
+	if( libsmdev_io_backend_seek_offset(
+	     member->io_backend,
+	     current_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") of member: %d.",
+		 function,
+		 current_offset,
+		 current_offset,
+		 member->member_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The member reader thread callback
+ * Reads the requests of a member until a request without a read size is received
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_composite_member_reader_callback(
+     libsmdev_composite_member_t *member )
+{
+	libcerror_error_t *error             = NULL;
+	libsmdev_composite_member_t *request = NULL;
+	static char *function                = "libsmdev_composite_member_reader_callback";
+	size_t read_size                     = 0;
+
+	if( member == NULL )
+	{
+		return( -1 );
+	}
+	do
+	{
+		request = NULL;
+
+		if( libcthreads_queue_pop(
+		     member->requests_queue,
+		     (intptr_t **) &request,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop request from requests queue.",
+			 function );
+
+			goto on_error;
+		}
+		read_size = member->read_size;
+
+		if( read_size > 0 )
+		{
+			if( libsmdev_composite_member_read(
+			     member,
+			     &error ) != 1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_print_error_backtrace(
+					 error );
+				}
+#endif
+				libcerror_error_free(
+				 &error );
+
+				member->read_count = 0;
+			}
+			if( libcthreads_queue_push(
+			     member->composite->completed_queue,
+			     (intptr_t *) member,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push member: %d onto completed queue.",
+				 function,
+				 member->member_index );
+
+				goto on_error;
+			}
+		}
+	}
+	while( read_size > 0 );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Creates a composite
+ * Make sure the value composite is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_composite_initialize(
+     libsmdev_composite_t **composite,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_composite_initialize";
+
+	if( composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid composite.",
+		 function );
+
+		return( -1 );
+	}
+	if( *composite != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid composite value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*composite = memory_allocate_structure(
+	              libsmdev_composite_t );
+
+	if( *composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create composite.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *composite,
+	     0,
+	     sizeof( libsmdev_composite_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear composite.",
+		 function );
+
+		goto on_error;
+	}
+	( *composite )->bytes_per_sector = 512;
+
+	return( 1 );
+
+on_error:
+	if( *composite != NULL )
+	{
+		memory_free(
+		 *composite );
+
+		*composite = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a composite
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_composite_free(
+     libsmdev_composite_t **composite,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_composite_free";
+	int result            = 1;
+
+	if( composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid composite.",
+		 function );
+
+		return( -1 );
+	}
+	if( *composite != NULL )
+	{
+		/* Closing stops the reader threads and frees the members
+		 */
+		if( libsmdev_composite_close(
+		     *composite,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close composite.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *composite );
+
+		*composite = NULL;
+	}
+	return( result );
+}
+
+/* Appends a member to the composite
+ * The IO backend must be open and is not managed by the composite
+ * The members are laid out in the order in which they are appended
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_composite_append_member(
+     libsmdev_composite_t *composite,
+     libsmdev_io_backend_t *io_backend,
+     size64_t size,
+     uint32_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	libsmdev_composite_member_t *member = NULL;
+	static char *function               = "libsmdev_composite_append_member";
+
+	if( composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid composite.",
+		 function );
+
+		return( -1 );
+	}
+	if( composite->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid composite - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( composite->number_of_members >= LIBSMDEV_COMPOSITE_MAXIMUM_NUMBER_OF_MEMBERS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid composite - number of members value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_composite_member_initialize(
+	     &member,
+	     composite,
+	     composite->number_of_members,
+	     io_backend,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create member: %d.",
+		 function,
+		 composite->number_of_members );
+
+		return( -1 );
+	}
+	composite->members[ composite->number_of_members ] = member;
+
+	composite->number_of_members += 1;
+
+	/* The composite uses the largest number of bytes per sector of its members
+	 * so that a sector aligned read is sector aligned for every member
+	 */
+	if( bytes_per_sector > composite->bytes_per_sector )
+	{
+		composite->bytes_per_sector = bytes_per_sector;
+	}
+	return( 1 );
+}
+
+/* Opens a composite
+ * The stripe size is only used by the striped layout and must be a multiple of the bytes per sector
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_composite_open(
+     libsmdev_composite_t *composite,
+     int layout,
+     size_t stripe_size,
+     libcerror_error_t **error )
+{
+	libsmdev_composite_member_t *member = NULL;
+	static char *function               = "libsmdev_composite_open";
+	size64_t composite_size             = 0;
+	size64_t member_size                = 0;
+	int member_index                    = 0;
+
+	if( composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid composite.",
+		 function );
+
+		return( -1 );
+	}
+	if( composite->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid composite - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( composite->number_of_members == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid composite - missing members.",
+		 function );
+
+		return( -1 );
+	}
+	if( layout == LIBSMDEV_COMPOSITE_LAYOUT_CONCATENATED )
+	{
+		for( member_index = 0;
+		     member_index < composite->number_of_members;
+		     member_index++ )
+		{
+			member = composite->members[ member_index ];
+
+			if( member->size > ( (size64_t) INT64_MAX - composite_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid member: %d - size value exceeds maximum.",
+				 function,
+				 member_index );
+
+				return( -1 );
+			}
+			member->logical_offset = (off64_t) composite_size;
+
+			composite_size += member->size;
+		}
+	}
+	else if( layout == LIBSMDEV_COMPOSITE_LAYOUT_STRIPED )
+	{
+		if( ( stripe_size == 0 )
+		 || ( stripe_size > (size_t) SSIZE_MAX )
+		 || ( ( stripe_size % composite->bytes_per_sector ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported stripe size: %" PRIzd ", value must be a multiple of bytes per sector: %" PRIu32 ".",
+			 function,
+			 stripe_size,
+			 composite->bytes_per_sector );
+
+			return( -1 );
+		}
+		/* Every member contributes the same number of whole stripes
+		 * the data beyond the last whole stripe of the smallest member is not used
+		 */
+		member_size = composite->members[ 0 ]->size;
+
+		for( member_index = 1;
+		     member_index < composite->number_of_members;
+		     member_index++ )
+		{
+			if( composite->members[ member_index ]->size < member_size )
+			{
+				member_size = composite->members[ member_index ]->size;
+			}
+		}
+		member_size = ( member_size / stripe_size ) * stripe_size;
+
+		if( member_size == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid stripe size: %" PRIzd " value exceeds size of smallest member.",
+			 function,
+			 stripe_size );
+
+			return( -1 );
+		}
+		composite_size = member_size * (size64_t) composite->number_of_members;
+
+		composite->stripe_size = stripe_size;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported layout: %d.",
+		 function,
+		 layout );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The members are read concurrently by a reader thread per member
+	 */
+	if( composite->number_of_members > 1 )
+	{
+		if( libcthreads_queue_initialize(
+		     &( composite->completed_queue ),
+		     composite->number_of_members,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create completed queue.",
+			 function );
+
+			goto on_error;
+		}
+		for( member_index = 0;
+		     member_index < composite->number_of_members;
+		     member_index++ )
+		{
+			member = composite->members[ member_index ];
+
+			if( libcthreads_queue_initialize(
+			     &( member->requests_queue ),
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create requests queue of member: %d.",
+				 function,
+				 member_index );
+
+				goto on_error;
+			}
+			if( libcthreads_thread_create(
+			     &( member->reader_thread ),
+			     NULL,
+			     (int (*)(void *)) &libsmdev_composite_member_reader_callback,
+			     (void *) member,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create reader thread of member: %d.",
+				 function,
+				 member_index );
+
+				goto on_error;
+			}
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	composite->layout         = layout;
+	composite->size           = composite_size;
+	composite->current_offset = 0;
+	composite->is_open        = 1;
+
+	return( 1 );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+on_error:
+	libsmdev_composite_close(
+	 composite,
+	 NULL );
+
+	return( -1 );
+#endif
+}
+
+/* Closes a composite
+ * The members are removed from the composite, their IO backends are not closed
+ * Returns 0 if successful or -1 on error
+ */
+int libsmdev_composite_close(
+     libsmdev_composite_t *composite,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_composite_close";
+	int member_index      = 0;
+	int result            = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libsmdev_composite_member_t *member = NULL;
+#endif
+
+	if( composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid composite.",
+		 function );
+
+		return( -1 );
+	}
+	for( member_index = 0;
+	     member_index < composite->number_of_members;
+	     member_index++ )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		member = composite->members[ member_index ];
+
+		if( member->reader_thread != NULL )
+		{
+			/* Signal the reader thread to stop by a request without a read size
+			 */
+			member->read_size = 0;
+
+			if( libcthreads_queue_push(
+			     member->requests_queue,
+			     (intptr_t *) member,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push request onto requests queue of member: %d.",
+				 function,
+				 member_index );
+
+				result = -1;
+			}
+			else if( libcthreads_thread_join(
+			          &( member->reader_thread ),
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join reader thread of member: %d.",
+				 function,
+				 member_index );
+
+				result = -1;
+			}
+		}
+		if( member->requests_queue != NULL )
+		{
+			if( libcthreads_queue_free(
+			     &( member->requests_queue ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free requests queue of member: %d.",
+				 function,
+				 member_index );
+
+				result = -1;
+			}
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		if( libsmdev_composite_member_free(
+		     &( composite->members[ member_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free member: %d.",
+			 function,
+			 member_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( composite->completed_queue != NULL )
+	{
+		if( libcthreads_queue_free(
+		     &( composite->completed_queue ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completed queue.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	composite->number_of_members = 0;
+	composite->bytes_per_sector  = 512;
+	composite->layout            = 0;
+	composite->stripe_size       = 0;
+	composite->size              = 0;
+	composite->current_offset    = 0;
+	composite->is_open           = 0;
+
+	return( result );
+}
+
+/* Retrieves the member and the offset within the member of a logical offset
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_composite_get_member_offset(
+     libsmdev_composite_t *composite,
+     off64_t offset,
+     int *member_index,
+     off64_t *member_offset,
+     libcerror_error_t **error )
+{
+	libsmdev_composite_member_t *member = NULL;
+	static char *function               = "libsmdev_composite_get_member_offset";
+	uint64_t stripe_index               = 0;
+	int index                           = 0;
+
+	if( composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid composite.",
+		 function );
+
+		return( -1 );
+	}
+	if( composite->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid composite - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= composite->size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member index.",
+		 function );
+
+		return( -1 );
+	}
+	if( member_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid member offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( composite->layout == LIBSMDEV_COMPOSITE_LAYOUT_STRIPED )
+	{
+		stripe_index = (uint64_t) offset / composite->stripe_size;
+
+		*member_index  = (int) ( stripe_index % (uint64_t) composite->number_of_members );
+		*member_offset = (off64_t) ( ( stripe_index / (uint64_t) composite->number_of_members ) * composite->stripe_size )
+		               + (off64_t) ( (uint64_t) offset % composite->stripe_size );
+
+		return( 1 );
+	}
+	for( index = 0;
+	     index < composite->number_of_members;
+	     index++ )
+	{
+		member = composite->members[ index ];
+
+		if( ( offset >= member->logical_offset )
+		 && ( (size64_t) ( offset - member->logical_offset ) < member->size ) )
+		{
+			*member_index  = index;
+			*member_offset = offset - member->logical_offset;
+
+			return( 1 );
+		}
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+	 "%s: missing member for offset: %" PRIi64 ".",
+	 function,
+	 offset );
+
+	return( -1 );
+}
+
+/* Retrieves the logical offset of an offset within a member
+ * Returns the logical offset
+ */
+off64_t libsmdev_composite_get_logical_offset(
+         libsmdev_composite_t *composite,
+         int member_index,
+         off64_t member_offset )
+{
+	uint64_t stripe_index = 0;
+
+	if( composite->layout == LIBSMDEV_COMPOSITE_LAYOUT_STRIPED )
+	{
+		stripe_index = ( ( (uint64_t) member_offset / composite->stripe_size ) * (uint64_t) composite->number_of_members )
+		             + (uint64_t) member_index;
+
+		return( (off64_t) ( ( stripe_index * composite->stripe_size ) + ( (uint64_t) member_offset % composite->stripe_size ) ) );
+	}
+	return( composite->members[ member_index ]->logical_offset + member_offset );
+}
+
+/* Reads a buffer at a specific offset from the composite
+ * The read requests of the members are issued concurrently if multi-threading is supported
+ * If a member cannot be read the data up to the logical offset of the first failure is returned
+ * The error code is set to the error code of the member that could not be read
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_composite_read_buffer_at_offset(
+         libsmdev_composite_t *composite,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	size_t buffer_offsets[ LIBSMDEV_COMPOSITE_MAXIMUM_NUMBER_OF_MEMBERS ];
+	int number_of_stripes[ LIBSMDEV_COMPOSITE_MAXIMUM_NUMBER_OF_MEMBERS ];
+
+	libsmdev_composite_member_t *member = NULL;
+	uint8_t *reallocation               = NULL;
+	static char *function               = "libsmdev_composite_read_buffer_at_offset";
+	off64_t failed_offset               = 0;
+	off64_t member_offset               = 0;
+	size_t copy_size                    = 0;
+	size_t read_size                    = 0;
+	size_t segment_end                  = 0;
+	size_t segment_start                = 0;
+	size_t valid_size                   = 0;
+	uint64_t first_stripe_index         = 0;
+	uint64_t last_stripe_index          = 0;
+	uint64_t stripe_index               = 0;
+	int failed_member_index             = -1;
+	int member_index                    = 0;
+	int number_of_requests              = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libsmdev_composite_member_t *request = NULL;
+	int number_of_pending_requests       = 0;
+	int result                           = 1;
+#endif
+
+	if( composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid composite.",
+		 function );
+
+		return( -1 );
+	}
+	if( composite->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid composite - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	*error_code = 0;
+
+	if( (size64_t) offset >= composite->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( composite->size - (size64_t) offset ) )
+	{
+		size = (size_t) ( composite->size - (size64_t) offset );
+	}
+	if( size == 0 )
+	{
+		return( 0 );
+	}
+	for( member_index = 0;
+	     member_index < composite->number_of_members;
+	     member_index++ )
+	{
+		member = composite->members[ member_index ];
+
+		member->read_buffer = NULL;
+		member->read_size   = 0;
+		member->read_count  = 0;
+		member->error_code  = 0;
+
+		number_of_stripes[ member_index ] = 0;
+	}
+	/* Determine the range of every member that is covered by the read
+	 * the stripes of a member within a read are adjacent in the member
+	 */
+	if( composite->layout == LIBSMDEV_COMPOSITE_LAYOUT_STRIPED )
+	{
+		first_stripe_index = (uint64_t) offset / composite->stripe_size;
+		last_stripe_index  = ( (uint64_t) offset + size - 1 ) / composite->stripe_size;
+
+		for( stripe_index = first_stripe_index;
+		     stripe_index <= last_stripe_index;
+		     stripe_index++ )
+		{
+			member_index  = (int) ( stripe_index % (uint64_t) composite->number_of_members );
+			member        = composite->members[ member_index ];
+			segment_start = 0;
+			segment_end   = composite->stripe_size;
+
+			if( stripe_index == first_stripe_index )
+			{
+				segment_start = (size_t) ( (uint64_t) offset % composite->stripe_size );
+			}
+			if( stripe_index == last_stripe_index )
+			{
+				segment_end = (size_t) ( ( (uint64_t) offset + size - 1 ) % composite->stripe_size ) + 1;
+			}
+			member_offset = (off64_t) ( ( stripe_index / (uint64_t) composite->number_of_members ) * composite->stripe_size )
+			              + (off64_t) segment_start;
+
+			if( number_of_stripes[ member_index ] == 0 )
+			{
+				member->read_offset = member_offset;
+
+				buffer_offsets[ member_index ] = (size_t) ( ( stripe_index * composite->stripe_size ) + segment_start - (uint64_t) offset );
+
+				number_of_requests++;
+			}
+			member->read_size = (size_t) ( member_offset - member->read_offset ) + segment_end - segment_start;
+
+			number_of_stripes[ member_index ] += 1;
+		}
+	}
+	else
+	{
+		for( member_index = 0;
+		     member_index < composite->number_of_members;
+		     member_index++ )
+		{
+			member = composite->members[ member_index ];
+
+			if( ( offset + (off64_t) size ) <= member->logical_offset )
+			{
+				break;
+			}
+			if( offset >= ( member->logical_offset + (off64_t) member->size ) )
+			{
+				continue;
+			}
+			member_offset = 0;
+
+			if( offset > member->logical_offset )
+			{
+				member_offset = offset - member->logical_offset;
+			}
+			read_size = size - (size_t) ( member->logical_offset + member_offset - offset );
+
+			if( (size64_t) read_size > ( member->size - (size64_t) member_offset ) )
+			{
+				read_size = (size_t) ( member->size - (size64_t) member_offset );
+			}
+			member->read_offset = member_offset;
+			member->read_size   = read_size;
+
+			buffer_offsets[ member_index ] = (size_t) ( member->logical_offset + member_offset - offset );
+
+			number_of_stripes[ member_index ] = 1;
+
+			number_of_requests++;
+		}
+	}
+	/* A member that covers a single stripe is read directly into the buffer
+	 * otherwise its stripes are gathered in the stripes buffer of the member
+	 */
+	for( member_index = 0;
+	     member_index < composite->number_of_members;
+	     member_index++ )
+	{
+		member = composite->members[ member_index ];
+
+		if( number_of_stripes[ member_index ] == 0 )
+		{
+			continue;
+		}
+		if( number_of_stripes[ member_index ] == 1 )
+		{
+			member->read_buffer = &( buffer[ buffer_offsets[ member_index ] ] );
+
+			continue;
+		}
+		if( member->read_size > member->stripes_buffer_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            member->stripes_buffer,
+			                            sizeof( uint8_t ) * member->read_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize stripes buffer of member: %d.",
+				 function,
+				 member_index );
+
+				return( -1 );
+			}
+			member->stripes_buffer      = reallocation;
+			member->stripes_buffer_size = member->read_size;
+		}
+		member->read_buffer = member->stripes_buffer;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( composite->completed_queue != NULL )
+	 && ( number_of_requests > 1 ) )
+	{
+		for( member_index = 0;
+		     member_index < composite->number_of_members;
+		     member_index++ )
+		{
+			member = composite->members[ member_index ];
+
+			if( number_of_stripes[ member_index ] == 0 )
+			{
+				continue;
+			}
+			if( libcthreads_queue_push(
+			     member->requests_queue,
+			     (intptr_t *) member,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push request onto requests queue of member: %d.",
+				 function,
+				 member_index );
+
+				result = -1;
+
+				break;
+			}
+			number_of_pending_requests++;
+		}
+		/* Wait for the requests that were issued, also when issuing a request failed
+		 */
+		while( number_of_pending_requests > 0 )
+		{
+			if( libcthreads_queue_pop(
+			     composite->completed_queue,
+			     (intptr_t **) &request,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to pop request from completed queue.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_pending_requests--;
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( member_index = 0;
+		     member_index < composite->number_of_members;
+		     member_index++ )
+		{
+			if( number_of_stripes[ member_index ] == 0 )
+			{
+				continue;
+			}
+			if( libsmdev_composite_member_read(
+			     composite->members[ member_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read member: %d.",
+				 function,
+				 member_index );
+
+				return( -1 );
+			}
+		}
+	}
+	/* The data is valid up to the logical offset of the first failure of any member
+	 */
+	valid_size = size;
+
+	for( member_index = 0;
+	     member_index < composite->number_of_members;
+	     member_index++ )
+	{
+		member = composite->members[ member_index ];
+
+		if( ( number_of_stripes[ member_index ] == 0 )
+		 || ( member->read_count >= member->read_size ) )
+		{
+			continue;
+		}
+		failed_offset = libsmdev_composite_get_logical_offset(
+		                 composite,
+		                 member_index,
+		                 member->read_offset + (off64_t) member->read_count );
+
+		if( (size_t) ( failed_offset - offset ) < valid_size )
+		{
+			valid_size          = (size_t) ( failed_offset - offset );
+			failed_member_index = member_index;
+		}
+	}
+	if( composite->layout == LIBSMDEV_COMPOSITE_LAYOUT_STRIPED )
+	{
+		for( stripe_index = first_stripe_index;
+		     stripe_index <= last_stripe_index;
+		     stripe_index++ )
+		{
+			member_index = (int) ( stripe_index % (uint64_t) composite->number_of_members );
+
+			if( number_of_stripes[ member_index ] <= 1 )
+			{
+				continue;
+			}
+			member        = composite->members[ member_index ];
+			segment_start = 0;
+			segment_end   = composite->stripe_size;
+
+			if( stripe_index == first_stripe_index )
+			{
+				segment_start = (size_t) ( (uint64_t) offset % composite->stripe_size );
+			}
+			if( stripe_index == last_stripe_index )
+			{
+				segment_end = (size_t) ( ( (uint64_t) offset + size - 1 ) % composite->stripe_size ) + 1;
+			}
+			member_offset = (off64_t) ( ( stripe_index / (uint64_t) composite->number_of_members ) * composite->stripe_size )
+			              + (off64_t) segment_start;
+
+			/* Only the data that was read is copied
+			 */
+			if( (size_t) ( member_offset - member->read_offset ) >= member->read_count )
+			{
+				continue;
+			}
+			copy_size = segment_end - segment_start;
+
+			if( copy_size > ( member->read_count - (size_t) ( member_offset - member->read_offset ) ) )
+			{
+				copy_size = member->read_count - (size_t) ( member_offset - member->read_offset );
+			}
+			if( memory_copy(
+			     &( buffer[ ( stripe_index * composite->stripe_size ) + segment_start - (uint64_t) offset ] ),
+			     &( member->stripes_buffer[ member_offset - member->read_offset ] ),
+			     copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy stripe: %" PRIu64 " data.",
+				 function,
+				 stripe_index );
+
+				return( -1 );
+			}
+		}
+	}
+	if( valid_size == 0 )
+	{
+		member = composite->members[ failed_member_index ];
+
+		*error_code = member->error_code;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read member: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 failed_member_index,
+		 member->read_offset + (off64_t) member->read_count,
+		 member->read_offset + (off64_t) member->read_count );
+
+		return( -1 );
+	}
+	return( (ssize_t) valid_size );
+}
+
+/* Reads a buffer from the composite at the current offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_composite_read_buffer(
+         libsmdev_composite_t *composite,
+         uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_composite_read_buffer";
+	ssize_t read_count    = 0;
+
+	if( composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid composite.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libsmdev_composite_read_buffer_at_offset(
+	              composite,
+	              buffer,
+	              size,
+	              composite->current_offset,
+	              error_code,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 composite->current_offset,
+		 composite->current_offset );
+
+		return( -1 );
+	}
+	composite->current_offset += (off64_t) read_count;
+
+	return( read_count );
+}
+
+/* Seeks a certain offset in the composite
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libsmdev_composite_seek_offset(
+         libsmdev_composite_t *composite,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_composite_seek_offset";
+
+	if( composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid composite.",
+		 function );
+
+		return( -1 );
+	}
+	if( composite->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid composite - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += composite->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) composite->size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	composite->current_offset = offset;
+
+	return( offset );
+}
+
+/* Reads IO control data from the composite
+ * Only the bytes per sector requests are supported
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_composite_io_control_read(
+         libsmdev_composite_t *composite,
+         uint32_t request,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_composite_io_control_read";
+
+	if( composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid composite.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	switch( request )
+	{
+#if defined( BLKSSZGET )
+		case (uint32_t) BLKSSZGET:
+#endif
+#if defined( DIOCGSECTORSIZE )
+		case (uint32_t) DIOCGSECTORSIZE:
+#endif
+#if defined( DKIOCGETBLOCKSIZE )
+		case (uint32_t) DKIOCGETBLOCKSIZE:
+#endif
+#if defined( BLKSSZGET ) || defined( DIOCGSECTORSIZE ) || defined( DKIOCGETBLOCKSIZE )
+			if( data_size < sizeof( uint32_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     data,
+			     &( composite->bytes_per_sector ),
+			     sizeof( uint32_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy bytes per sector.",
+				 function );
+
+				return( -1 );
+			}
+			return( (ssize_t) sizeof( uint32_t ) );
+#endif
+		default:
+			break;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+	 "%s: unsupported IO control request: 0x%08" PRIx32 ".",
+	 function,
+	 request );
+
+	return( -1 );
+}
+
+/* Retrieves the size of the composite
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_composite_get_size(
+     libsmdev_composite_t *composite,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_composite_get_size";
+
+	if( composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid composite.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = composite->size;
+
+	return( 1 );
+}
+
+/* Creates a composite IO backend
+ * The composite is not opened by a filename, its members are appended
+ * and it is opened using libsmdev_composite_open
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_composite_initialize_io_backend(
+     libsmdev_io_backend_t **io_backend,
+     libsmdev_composite_t **composite,
+     libcerror_error_t **error )
+{
+	libsmdev_composite_t *safe_composite = NULL;
+	static char *function                = "libsmdev_composite_initialize_io_backend";
+
+	if( composite == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid composite.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_io_backend_initialize(
+	     io_backend,
+	     LIBSMDEV_IO_BACKEND_TYPE_COMPOSITE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO backend.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_composite_initialize(
+	     &safe_composite,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create composite.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_backend )->io_handle       = (intptr_t *) safe_composite;
+	( *io_backend )->free_io_handle  = (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_composite_free;
+	( *io_backend )->close           = (int (*)(intptr_t *, libcerror_error_t **)) &libsmdev_composite_close;
+	( *io_backend )->read            = (ssize_t (*)(intptr_t *, uint8_t *, size_t, uint32_t *, libcerror_error_t **)) &libsmdev_composite_read_buffer;
+	( *io_backend )->read_at_offset  = (ssize_t (*)(intptr_t *, uint8_t *, size_t, off64_t, uint32_t *, libcerror_error_t **)) &libsmdev_composite_read_buffer_at_offset;
+	( *io_backend )->seek_offset     = (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) &libsmdev_composite_seek_offset;
+	( *io_backend )->io_control_read = (ssize_t (*)(intptr_t *, uint32_t, uint8_t *, size_t, libcerror_error_t **)) &libsmdev_composite_io_control_read;
+	( *io_backend )->get_size        = (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) &libsmdev_composite_get_size;
+
+	*composite = safe_composite;
+
+	return( 1 );
+
+on_error:
+	if( *io_backend != NULL )
+	{
+		libsmdev_io_backend_free(
+		 io_backend,
+		 NULL );
+	}
+	return( -1 );
+}
+
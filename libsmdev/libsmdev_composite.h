@@ -0,0 +1,253 @@
+/*
+ * Composite device functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_COMPOSITE_H )
+#define _LIBSMDEV_COMPOSITE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of members
+ */
+#define LIBSMDEV_COMPOSITE_MAXIMUM_NUMBER_OF_MEMBERS		64
+
+typedef struct libsmdev_composite libsmdev_composite_t;
+
+typedef struct libsmdev_composite_member libsmdev_composite_member_t;
+
+struct libsmdev_composite_member
+{
+	/* The composite
+	 */
+	libsmdev_composite_t *composite;
+
+	/* The member index
+	 */
+	int member_index;
+
+	/* The IO backend
+	 * The IO backend is not managed by the member
+	 */
+	libsmdev_io_backend_t *io_backend;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The logical offset of the first byte of the member
+	 * Only used by the concatenated layout
+	 */
+	off64_t logical_offset;
+
+	/* The buffer used to gather the data of multiple stripes
+	 */
+	uint8_t *stripes_buffer;
+
+	/* The allocated size of the stripes buffer
+	 */
+	size_t stripes_buffer_size;
+
+	/* The member offset of the current read request
+	 */
+	off64_t read_offset;
+
+	/* The buffer of the current read request
+	 */
+	uint8_t *read_buffer;
+
+	/* The size of the current read request
+	 * A read size of 0 signals the reader thread that no more requests follow
+	 */
+	size_t read_size;
+
+	/* The number of bytes read by the current read request
+	 */
+	size_t read_count;
+
+	/* The error code of the read that failed
+	 */
+	uint32_t error_code;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The reader thread
+	 */
+	libcthreads_thread_t *reader_thread;
+
+	/* The queue of read requests
+	 */
+	libcthreads_queue_t *requests_queue;
+#endif
+};
+
+struct libsmdev_composite
+{
+	/* The layout
+	 */
+	int layout;
+
+	/* The stripe size
+	 * Only used by the striped layout
+	 */
+	size_t stripe_size;
+
+	/* The number of members
+	 */
+	int number_of_members;
+
+	/* The members
+	 */
+	libsmdev_composite_member_t *members[ LIBSMDEV_COMPOSITE_MAXIMUM_NUMBER_OF_MEMBERS ];
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The number of bytes per sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate the composite is open
+	 */
+	uint8_t is_open;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The queue of completed read requests
+	 */
+	libcthreads_queue_t *completed_queue;
+#endif
+};
+
+int libsmdev_composite_member_initialize(
+     libsmdev_composite_member_t **member,
+     libsmdev_composite_t *composite,
+     int member_index,
+     libsmdev_io_backend_t *io_backend,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libsmdev_composite_member_free(
+     libsmdev_composite_member_t **member,
+     libcerror_error_t **error );
+
+int libsmdev_composite_member_read(
+     libsmdev_composite_member_t *member,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsmdev_composite_member_reader_callback(
+     libsmdev_composite_member_t *member );
+
+#endif
+
+int libsmdev_composite_initialize(
+     libsmdev_composite_t **composite,
+     libcerror_error_t **error );
+
+int libsmdev_composite_free(
+     libsmdev_composite_t **composite,
+     libcerror_error_t **error );
+
+int libsmdev_composite_append_member(
+     libsmdev_composite_t *composite,
+     libsmdev_io_backend_t *io_backend,
+     size64_t size,
+     uint32_t bytes_per_sector,
+     libcerror_error_t **error );
+
+int libsmdev_composite_open(
+     libsmdev_composite_t *composite,
+     int layout,
+     size_t stripe_size,
+     libcerror_error_t **error );
+
+int libsmdev_composite_close(
+     libsmdev_composite_t *composite,
+     libcerror_error_t **error );
+
+int libsmdev_composite_get_member_offset(
+     libsmdev_composite_t *composite,
+     off64_t offset,
+     int *member_index,
+     off64_t *member_offset,
+     libcerror_error_t **error );
+
+off64_t libsmdev_composite_get_logical_offset(
+         libsmdev_composite_t *composite,
+         int member_index,
+         off64_t member_offset );
+
+ssize_t libsmdev_composite_read_buffer_at_offset(
+         libsmdev_composite_t *composite,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+ssize_t libsmdev_composite_read_buffer(
+         libsmdev_composite_t *composite,
+         uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+off64_t libsmdev_composite_seek_offset(
+         libsmdev_composite_t *composite,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+ssize_t libsmdev_composite_io_control_read(
+         libsmdev_composite_t *composite,
+         uint32_t request,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+int libsmdev_composite_get_size(
+     libsmdev_composite_t *composite,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libsmdev_composite_initialize_io_backend(
+     libsmdev_io_backend_t **io_backend,
+     libsmdev_composite_t **composite,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_COMPOSITE_H ) */
+
@@ -0,0 +1,1623 @@
+/*
+ * Copy functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* Required for splice and copy_file_range
+ */
+#if !defined( _WIN32 ) && !defined( _GNU_SOURCE )
+#define _GNU_SOURCE 1
+#endif
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libsmdev_copy.h"
+#include "libsmdev_definitions.h"
+#include "libsmdev_handle.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcnotify.h"
+#include "libsmdev_libcthreads.h"
+
+/* Creates a copy buffer
+ * Make sure the value copy_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_copy_buffer_initialize(
+     libsmdev_copy_buffer_t **copy_buffer,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_copy_buffer_initialize";
+
+	if( copy_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *copy_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid copy buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*copy_buffer = memory_allocate_structure(
+	                libsmdev_copy_buffer_t );
+
+	if( *copy_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create copy buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *copy_buffer )->data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * data_size );
+
+	if( ( *copy_buffer )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *copy_buffer )->data_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( *copy_buffer != NULL )
+	{
+		memory_free(
+		 *copy_buffer );
+
+		*copy_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a copy buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_copy_buffer_free(
+     libsmdev_copy_buffer_t **copy_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_copy_buffer_free";
+
+	if( copy_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *copy_buffer != NULL )
+	{
+		memory_free(
+		 ( *copy_buffer )->data );
+
+		memory_free(
+		 *copy_buffer );
+
+		*copy_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Writes a buffer to a file descriptor
+ * Writes that are interrupted or only partially complete are continued
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libsmdev_copy_write_buffer(
+         int file_descriptor,
+         const uint8_t *buffer,
+         size_t size,
+         int *error_code,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_copy_write_buffer";
+	size_t buffer_offset  = 0;
+	ssize_t write_count   = 0;
+
+	if( file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+		write_count = _write(
+		               file_descriptor,
+		               &( buffer[ buffer_offset ] ),
+		               (unsigned int) ( size - buffer_offset ) );
+#else
+		write_count = write(
+		               file_descriptor,
+		               &( buffer[ buffer_offset ] ),
+		               size - buffer_offset );
+#endif
+		if( write_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			*error_code = errno;
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 *error_code,
+			 "%s: unable to write to file descriptor.",
+			 function );
+
+			return( -1 );
+		}
+		else if( write_count == 0 )
+		{
+			*error_code = 0;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to file descriptor - no data written.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset += (size_t) write_count;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Copies a range of the storage media to a file descriptor
+ * The data is read by the handle, hence read errors are handled as by libsmdev_handle_read_buffer
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libsmdev_copy_range_buffered(
+     libsmdev_internal_handle_t *internal_handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libsmdev_copy_buffer_t *copy_buffer = NULL;
+	static char *function               = "libsmdev_copy_range_buffered";
+	size_t read_size                    = 0;
+	ssize_t read_count                  = 0;
+	int error_code                      = 0;
+	int result                          = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_copy_buffer_initialize(
+	     &copy_buffer,
+	     LIBSMDEV_COPY_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create copy buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_handle_seek_offset(
+	     (libsmdev_handle_t *) internal_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		goto on_error;
+	}
+	while( size > 0 )
+	{
+		if( internal_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		read_size = LIBSMDEV_COPY_BUFFER_SIZE;
+
+		if( (size64_t) read_size > size )
+		{
+			read_size = (size_t) size;
+		}
+		read_count = libsmdev_handle_read_buffer(
+		              (libsmdev_handle_t *) internal_handle,
+		              copy_buffer->data,
+		              read_size,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+		if( read_count == 0 )
+		{
+			if( internal_handle->abort != 0 )
+			{
+				result = 0;
+
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+		if( libsmdev_copy_write_buffer(
+		     file_descriptor,
+		     copy_buffer->data,
+		     (size_t) read_count,
+		     &error_code,
+		     error ) != read_count )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+		offset += (off64_t) read_count;
+		size   -= (size64_t) read_count;
+	}
+	if( libsmdev_copy_buffer_free(
+	     &copy_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free copy buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( copy_buffer != NULL )
+	{
+		libsmdev_copy_buffer_free(
+		 &copy_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Retrieves a buffer that can be filled by the reader
+ * Waits until the writer hands back a buffer
+ * Returns 1 if successful, 0 if the writer stopped or writing failed or -1 on error
+ */
+int libsmdev_copy_writer_get_empty_buffer(
+     libsmdev_copy_writer_t *copy_writer,
+     libsmdev_copy_buffer_t **copy_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_copy_writer_get_empty_buffer";
+	int result            = 1;
+
+	if( copy_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copy writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( copy_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     copy_writer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( copy_writer->number_of_empty_buffers == 0 )
+	    && ( copy_writer->writer_stopped == 0 )
+	    && ( copy_writer->write_failed == 0 ) )
+	{
+		if( libcthreads_condition_wait(
+		     copy_writer->condition,
+		     copy_writer->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Once the writer stopped or writing failed no more data is read
+	 */
+	if( ( copy_writer->writer_stopped != 0 )
+	 || ( copy_writer->write_failed != 0 ) )
+	{
+		result = 0;
+	}
+	else
+	{
+		copy_writer->number_of_empty_buffers -= 1;
+
+		*copy_buffer = copy_writer->empty_buffers[ copy_writer->number_of_empty_buffers ];
+	}
+	if( libcthreads_mutex_release(
+	     copy_writer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	libcthreads_mutex_release(
+	 copy_writer->mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Hands a buffer filled by the reader to the writer
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_copy_writer_push_full_buffer(
+     libsmdev_copy_writer_t *copy_writer,
+     libsmdev_copy_buffer_t *copy_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_copy_writer_push_full_buffer";
+	int buffer_index      = 0;
+
+	if( copy_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copy writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( copy_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copy buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     copy_writer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* Since there are only LIBSMDEV_COPY_NUMBER_OF_BUFFERS buffers the ring cannot overflow
+	 */
+	if( copy_writer->number_of_full_buffers >= LIBSMDEV_COPY_NUMBER_OF_BUFFERS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid copy writer - number of full buffers value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	buffer_index = ( copy_writer->first_full_buffer_index + copy_writer->number_of_full_buffers )
+	             % LIBSMDEV_COPY_NUMBER_OF_BUFFERS;
+
+	copy_writer->full_buffers[ buffer_index ] = copy_buffer;
+
+	copy_writer->number_of_full_buffers += 1;
+
+	if( libcthreads_condition_broadcast(
+	     copy_writer->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_release(
+	     copy_writer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	libcthreads_mutex_release(
+	 copy_writer->mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Signals the writer that no more data follows
+ * The writer stops after it has written the remaining full buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_copy_writer_signal_end_of_data(
+     libsmdev_copy_writer_t *copy_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_copy_writer_signal_end_of_data";
+
+	if( copy_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copy writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     copy_writer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	copy_writer->end_of_data = 1;
+
+	if( libcthreads_condition_broadcast(
+	     copy_writer->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		libcthreads_mutex_release(
+		 copy_writer->mutex,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_release(
+	     copy_writer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* The writer thread callback
+ * Writes the buffers filled by the reader until the reader signals the end of data
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_copy_writer_callback(
+     libsmdev_copy_writer_t *copy_writer )
+{
+	libcerror_error_t *error            = NULL;
+	libsmdev_copy_buffer_t *copy_buffer = NULL;
+	static char *function               = "libsmdev_copy_writer_callback";
+	uint8_t mutex_grabbed               = 0;
+	uint8_t write_failed                = 0;
+	int write_error_code                = 0;
+
+	if( copy_writer == NULL )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     copy_writer->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	mutex_grabbed = 1;
+
+	while( ( copy_writer->number_of_full_buffers > 0 )
+	    || ( copy_writer->end_of_data == 0 ) )
+	{
+		if( copy_writer->number_of_full_buffers == 0 )
+		{
+			if( libcthreads_condition_wait(
+			     copy_writer->condition,
+			     copy_writer->mutex,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		copy_buffer = copy_writer->full_buffers[ copy_writer->first_full_buffer_index ];
+
+		copy_writer->first_full_buffer_index = ( copy_writer->first_full_buffer_index + 1 )
+		                                     % LIBSMDEV_COPY_NUMBER_OF_BUFFERS;
+
+		copy_writer->number_of_full_buffers -= 1;
+
+		write_failed = copy_writer->write_failed;
+
+		if( libcthreads_mutex_release(
+		     copy_writer->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_grabbed = 0;
+
+		/* Once writing failed the remaining buffers are only handed back to the reader
+		 */
+		if( write_failed == 0 )
+		{
+			if( libsmdev_copy_write_buffer(
+			     copy_writer->file_descriptor,
+			     copy_buffer->data,
+			     copy_buffer->data_size,
+			     &write_error_code,
+			     &error ) != (ssize_t) copy_buffer->data_size )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_print_error_backtrace(
+					 error );
+				}
+#endif
+				libcerror_error_free(
+				 &error );
+
+				write_failed = 1;
+			}
+		}
+		if( libcthreads_mutex_grab(
+		     copy_writer->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		mutex_grabbed = 1;
+
+		if( ( write_failed != 0 )
+		 && ( copy_writer->write_failed == 0 ) )
+		{
+			copy_writer->write_failed     = 1;
+			copy_writer->write_error_code = write_error_code;
+		}
+		copy_writer->empty_buffers[ copy_writer->number_of_empty_buffers ] = copy_buffer;
+
+		copy_writer->number_of_empty_buffers += 1;
+
+		if( libcthreads_condition_broadcast(
+		     copy_writer->condition,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	copy_writer->writer_stopped = 1;
+
+	if( libcthreads_condition_broadcast(
+	     copy_writer->condition,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_release(
+	     copy_writer->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	mutex_grabbed = 0;
+
+	return( 1 );
+
+on_error:
+	/* Wake the reader so that it does not wait for buffers that are no longer handed back
+	 */
+	if( mutex_grabbed == 0 )
+	{
+		if( libcthreads_mutex_grab(
+		     copy_writer->mutex,
+		     NULL ) == 1 )
+		{
+			mutex_grabbed = 1;
+		}
+	}
+	if( mutex_grabbed != 0 )
+	{
+		copy_writer->write_failed   = 1;
+		copy_writer->writer_stopped = 1;
+
+		libcthreads_condition_broadcast(
+		 copy_writer->condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 copy_writer->mutex,
+		 NULL );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Copies a range of the storage media to a file descriptor
+ * The calling thread reads the data into a ring of buffers while a writer thread
+ * writes them, so that reading and writing overlap
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libsmdev_copy_range_pipelined(
+     libsmdev_internal_handle_t *internal_handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libsmdev_copy_writer_t copy_writer;
+
+	libcthreads_thread_t *writer_thread = NULL;
+	libsmdev_copy_buffer_t *copy_buffer = NULL;
+	static char *function               = "libsmdev_copy_range_pipelined";
+	size_t read_size                    = 0;
+	ssize_t read_count                  = 0;
+	int buffer_index                    = 0;
+	int result                          = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &copy_writer,
+	     0,
+	     sizeof( libsmdev_copy_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear copy writer.",
+		 function );
+
+		return( -1 );
+	}
+	copy_writer.file_descriptor = file_descriptor;
+
+	if( libcthreads_mutex_initialize(
+	     &( copy_writer.mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( copy_writer.condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	for( buffer_index = 0;
+	     buffer_index < LIBSMDEV_COPY_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( libsmdev_copy_buffer_initialize(
+		     &( copy_writer.buffers[ buffer_index ] ),
+		     LIBSMDEV_COPY_BUFFER_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create copy buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		copy_writer.empty_buffers[ buffer_index ] = copy_writer.buffers[ buffer_index ];
+	}
+	copy_writer.number_of_empty_buffers = LIBSMDEV_COPY_NUMBER_OF_BUFFERS;
+
+	if( libsmdev_handle_seek_offset(
+	     (libsmdev_handle_t *) internal_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_create(
+	     &writer_thread,
+	     NULL,
+	     (int (*)(void *)) &libsmdev_copy_writer_callback,
+	     (void *) &copy_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create writer thread.",
+		 function );
+
+		goto on_error;
+	}
+	while( size > 0 )
+	{
+		if( internal_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		/* Returns 0 once the writer stopped or writing failed
+		 */
+		result = libsmdev_copy_writer_get_empty_buffer(
+		          &copy_writer,
+		          &copy_buffer,
+		          error );
+
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve empty buffer.",
+				 function );
+			}
+			else
+			{
+				result = 1;
+			}
+			break;
+		}
+		read_size = LIBSMDEV_COPY_BUFFER_SIZE;
+
+		if( (size64_t) read_size > size )
+		{
+			read_size = (size_t) size;
+		}
+		read_count = libsmdev_handle_read_buffer(
+		              (libsmdev_handle_t *) internal_handle,
+		              copy_buffer->data,
+		              read_size,
+		              error );
+
+		if( read_count <= 0 )
+		{
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset,
+				 offset );
+
+				result = -1;
+			}
+			else if( internal_handle->abort != 0 )
+			{
+				result = 0;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unexpected end of data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset,
+				 offset );
+
+				result = -1;
+			}
+			break;
+		}
+		copy_buffer->data_size = (size_t) read_count;
+
+		if( libsmdev_copy_writer_push_full_buffer(
+		     &copy_writer,
+		     copy_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push full buffer.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		offset += (off64_t) read_count;
+		size   -= (size64_t) read_count;
+	}
+	/* Signal the writer that no more data follows and wait for it to finish
+	 */
+	if( libsmdev_copy_writer_signal_end_of_data(
+	     &copy_writer,
+	     ( result == -1 ) ? NULL : error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to signal end of data to writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_join(
+	     &writer_thread,
+	     ( result == -1 ) ? NULL : error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join writer thread.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( copy_writer.write_failed != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 copy_writer.write_error_code,
+		 "%s: unable to write to file descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	for( buffer_index = 0;
+	     buffer_index < LIBSMDEV_COPY_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( libsmdev_copy_buffer_free(
+		     &( copy_writer.buffers[ buffer_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free copy buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_condition_free(
+	     &( copy_writer.condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_free(
+	     &( copy_writer.mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mutex.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	/* The writer is always signalled before it is joined, since otherwise
+	 * it could wait for buffers that are never handed to it
+	 */
+	if( writer_thread != NULL )
+	{
+		libsmdev_copy_writer_signal_end_of_data(
+		 &copy_writer,
+		 NULL );
+
+		libcthreads_thread_join(
+		 &writer_thread,
+		 NULL );
+	}
+	for( buffer_index = 0;
+	     buffer_index < LIBSMDEV_COPY_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( copy_writer.buffers[ buffer_index ] != NULL )
+		{
+			libsmdev_copy_buffer_free(
+			 &( copy_writer.buffers[ buffer_index ] ),
+			 NULL );
+		}
+	}
+	if( copy_writer.condition != NULL )
+	{
+		libcthreads_condition_free(
+		 &( copy_writer.condition ),
+		 NULL );
+	}
+	if( copy_writer.mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( copy_writer.mutex ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( LIBSMDEV_HAVE_COPY_IN_KERNEL )
+
+/* Copies a range of the storage media to a file descriptor without passing the data through user space
+ * copy_file_range is tried first and splice through a pipe second. A part of the range
+ * that cannot be read is copied by the handle instead, which applies the read error semantics
+ * Returns 1 if successful, 0 if the range could not be fully copied in kernel or -1 on error
+ * The size of the data that was copied is returned in copied_size
+ */
+int libsmdev_copy_range_in_kernel(
+     libsmdev_internal_handle_t *internal_handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     size64_t *copied_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libsmdev_copy_range_in_kernel";
+	size64_t remaining_size   = 0;
+	size_t chunk_size         = 0;
+	size_t transferred_size   = 0;
+	ssize_t transfer_count    = 0;
+	off64_t chunk_offset      = 0;
+	off64_t input_offset      = 0;
+	int device_descriptor     = -1;
+	int read_error            = 0;
+	int result                = 1;
+
+#if defined( HAVE_SPLICE ) && defined( HAVE_PIPE )
+	int pipe_descriptors[ 2 ] = { -1, -1 };
+	ssize_t write_count       = 0;
+	size_t pipe_size          = 0;
+#endif
+#if defined( HAVE_COPY_FILE_RANGE )
+	uint8_t use_copy_file_range = 1;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( copied_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid copied size.",
+		 function );
+
+		return( -1 );
+	}
+	*copied_size = 0;
+
+	/* The device is opened separately since the device file of the handle does not expose its descriptor
+	 */
+	device_descriptor = open(
+	                     internal_handle->filename,
+	                     O_RDONLY );
+
+	if( device_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	input_offset   = offset;
+	remaining_size = size;
+
+	while( remaining_size > 0 )
+	{
+		if( internal_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		chunk_offset     = input_offset;
+		chunk_size       = LIBSMDEV_COPY_BUFFER_SIZE;
+		transferred_size = 0;
+		read_error       = 0;
+
+		if( (size64_t) chunk_size > remaining_size )
+		{
+			chunk_size = (size_t) remaining_size;
+		}
+		while( transferred_size < chunk_size )
+		{
+#if defined( HAVE_COPY_FILE_RANGE )
+			if( use_copy_file_range != 0 )
+			{
+				transfer_count = copy_file_range(
+				                  device_descriptor,
+				                  (loff_t *) &input_offset,
+				                  file_descriptor,
+				                  NULL,
+				                  chunk_size - transferred_size,
+				                  0 );
+
+				if( transfer_count == -1 )
+				{
+					if( errno == EINTR )
+					{
+						continue;
+					}
+					/* copy_file_range is typically not supported for block devices
+					 */
+					if( ( errno == EXDEV )
+					 || ( errno == EINVAL )
+					 || ( errno == ENOSYS )
+					 || ( errno == EOPNOTSUPP )
+					 || ( errno == EBADF ) )
+					{
+						use_copy_file_range = 0;
+
+						continue;
+					}
+					read_error = 1;
+
+					break;
+				}
+			}
+			else
+#endif /* defined( HAVE_COPY_FILE_RANGE ) */
+			{
+#if defined( HAVE_SPLICE ) && defined( HAVE_PIPE )
+				if( pipe_descriptors[ 0 ] == -1 )
+				{
+					if( pipe(
+					     pipe_descriptors ) != 0 )
+					{
+						result = 0;
+
+						break;
+					}
+#if defined( F_SETPIPE_SZ )
+					/* Enlarge the pipe to reduce the number of system calls, this is not required to succeed
+					 */
+					fcntl(
+					 pipe_descriptors[ 1 ],
+					 F_SETPIPE_SZ,
+					 LIBSMDEV_COPY_BUFFER_SIZE );
+#endif
+				}
+				transfer_count = splice(
+				                  device_descriptor,
+				                  (loff_t *) &input_offset,
+				                  pipe_descriptors[ 1 ],
+				                  NULL,
+				                  chunk_size - transferred_size,
+				                  SPLICE_F_MOVE | SPLICE_F_MORE );
+
+				if( transfer_count == -1 )
+				{
+					if( errno == EINTR )
+					{
+						continue;
+					}
+					if( errno == EINVAL )
+					{
+						result = 0;
+
+						break;
+					}
+					read_error = 1;
+
+					break;
+				}
+				pipe_size = (size_t) transfer_count;
+
+				while( pipe_size > 0 )
+				{
+					write_count = splice(
+					               pipe_descriptors[ 0 ],
+					               NULL,
+					               file_descriptor,
+					               NULL,
+					               pipe_size,
+					               SPLICE_F_MOVE | SPLICE_F_MORE );
+
+					if( write_count == -1 )
+					{
+						if( errno == EINTR )
+						{
+							continue;
+						}
+						libcerror_system_set_error(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 errno,
+						 "%s: unable to splice data to file descriptor.",
+						 function );
+
+						goto on_error;
+					}
+					else if( write_count == 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to splice data to file descriptor - no data written.",
+						 function );
+
+						goto on_error;
+					}
+					pipe_size -= (size_t) write_count;
+				}
+#else
+				result = 0;
+
+				break;
+#endif /* defined( HAVE_SPLICE ) && defined( HAVE_PIPE ) */
+			}
+			if( transfer_count == 0 )
+			{
+				read_error = 1;
+
+				break;
+			}
+			transferred_size += (size_t) transfer_count;
+		}
+		if( result == 0 )
+		{
+			input_offset = chunk_offset + (off64_t) transferred_size;
+
+			break;
+		}
+		if( read_error != 0 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to transfer data at offset: %" PRIi64 " (0x%08" PRIx64 ") in kernel, copying chunk by handle.\n",
+				 function,
+				 chunk_offset + (off64_t) transferred_size,
+				 chunk_offset + (off64_t) transferred_size );
+			}
+#endif
+			/* Copy the entire chunk by the handle so that the error granularity is applied
+			 * as for a read of the chunk, if the output cannot be rewound only the remainder is copied
+			 */
+			if( transferred_size > 0 )
+			{
+				if( lseek(
+				     file_descriptor,
+				     -( (off_t) transferred_size ),
+				     SEEK_CUR ) != -1 )
+				{
+					transferred_size = 0;
+				}
+			}
+			result = libsmdev_copy_range_buffered(
+			          internal_handle,
+			          file_descriptor,
+			          chunk_offset + (off64_t) transferred_size,
+			          (size64_t) ( chunk_size - transferred_size ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to copy chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 chunk_offset,
+				 chunk_offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				input_offset = chunk_offset;
+
+				break;
+			}
+		}
+		input_offset    = chunk_offset + (off64_t) chunk_size;
+		remaining_size -= (size64_t) chunk_size;
+	}
+	*copied_size = (size64_t) ( input_offset - offset );
+
+#if defined( HAVE_SPLICE ) && defined( HAVE_PIPE )
+	if( pipe_descriptors[ 0 ] != -1 )
+	{
+		close(
+		 pipe_descriptors[ 0 ] );
+		close(
+		 pipe_descriptors[ 1 ] );
+	}
+#endif
+	close(
+	 device_descriptor );
+
+	return( result );
+
+on_error:
+#if defined( HAVE_SPLICE ) && defined( HAVE_PIPE )
+	if( pipe_descriptors[ 0 ] != -1 )
+	{
+		close(
+		 pipe_descriptors[ 0 ] );
+		close(
+		 pipe_descriptors[ 1 ] );
+	}
+#endif
+	close(
+	 device_descriptor );
+
+	return( -1 );
+}
+
+#endif /* defined( LIBSMDEV_HAVE_COPY_IN_KERNEL ) */
+
@@ -0,0 +1,192 @@
+/*
+ * Copy functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_COPY_H )
+#define _LIBSMDEV_COPY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_handle.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a copy buffer
+ */
+#define LIBSMDEV_COPY_BUFFER_SIZE		1048576
+
+/* The number of copy buffers in the ring between the reader and the writer
+ */
+#define LIBSMDEV_COPY_NUMBER_OF_BUFFERS		4
+
+/* Data is only transferred in kernel space if the device can be opened by a narrow filename
+ */
+#if !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && ( defined( HAVE_SPLICE ) || defined( HAVE_COPY_FILE_RANGE ) )
+#define LIBSMDEV_HAVE_COPY_IN_KERNEL
+#endif
+
+typedef struct libsmdev_copy_buffer libsmdev_copy_buffer_t;
+
+struct libsmdev_copy_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libsmdev_copy_writer libsmdev_copy_writer_t;
+
+struct libsmdev_copy_writer
+{
+	/* The output file descriptor
+	 */
+	int file_descriptor;
+
+	/* The buffers
+	 */
+	libsmdev_copy_buffer_t *buffers[ LIBSMDEV_COPY_NUMBER_OF_BUFFERS ];
+
+	/* The buffers that can be filled by the reader
+	 */
+	libsmdev_copy_buffer_t *empty_buffers[ LIBSMDEV_COPY_NUMBER_OF_BUFFERS ];
+
+	/* The number of empty buffers
+	 */
+	int number_of_empty_buffers;
+
+	/* The ring of buffers that are to be written by the writer, in order
+	 */
+	libsmdev_copy_buffer_t *full_buffers[ LIBSMDEV_COPY_NUMBER_OF_BUFFERS ];
+
+	/* The index of the first full buffer
+	 */
+	int first_full_buffer_index;
+
+	/* The number of full buffers
+	 */
+	int number_of_full_buffers;
+
+	/* Value to indicate the reader signalled that no more data follows
+	 */
+	uint8_t end_of_data;
+
+	/* Value to indicate the writer stopped
+	 */
+	uint8_t writer_stopped;
+
+	/* Value to indicate writing failed
+	 */
+	uint8_t write_failed;
+
+	/* The error code of the write that failed
+	 */
+	int write_error_code;
+
+	/* The mutex that guards the values above
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is broadcast when a buffer is handed over or the state changes
+	 */
+	libcthreads_condition_t *condition;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int libsmdev_copy_buffer_initialize(
+     libsmdev_copy_buffer_t **copy_buffer,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libsmdev_copy_buffer_free(
+     libsmdev_copy_buffer_t **copy_buffer,
+     libcerror_error_t **error );
+
+ssize_t libsmdev_copy_write_buffer(
+         int file_descriptor,
+         const uint8_t *buffer,
+         size_t size,
+         int *error_code,
+         libcerror_error_t **error );
+
+int libsmdev_copy_range_buffered(
+     libsmdev_internal_handle_t *internal_handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsmdev_copy_writer_get_empty_buffer(
+     libsmdev_copy_writer_t *copy_writer,
+     libsmdev_copy_buffer_t **copy_buffer,
+     libcerror_error_t **error );
+
+int libsmdev_copy_writer_push_full_buffer(
+     libsmdev_copy_writer_t *copy_writer,
+     libsmdev_copy_buffer_t *copy_buffer,
+     libcerror_error_t **error );
+
+int libsmdev_copy_writer_signal_end_of_data(
+     libsmdev_copy_writer_t *copy_writer,
+     libcerror_error_t **error );
+
+int libsmdev_copy_writer_callback(
+     libsmdev_copy_writer_t *copy_writer );
+
+int libsmdev_copy_range_pipelined(
+     libsmdev_internal_handle_t *internal_handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( LIBSMDEV_HAVE_COPY_IN_KERNEL )
+
+int libsmdev_copy_range_in_kernel(
+     libsmdev_internal_handle_t *internal_handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     size64_t *copied_size,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBSMDEV_HAVE_COPY_IN_KERNEL ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_COPY_H ) */
+
@@ -0,0 +1,1189 @@
+/*
+ * Device information functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_device_information.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_string.h"
+#include "libsmdev_sysfs.h"
+
+/* Creates device information
+ * Make sure the value device_information is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_information_initialize(
+     libsmdev_device_information_t **device_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_device_information_initialize";
+
+	if( device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *device_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid device information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*device_information = memory_allocate_structure(
+	                       libsmdev_device_information_t );
+
+	if( *device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create device information.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *device_information,
+	     0,
+	     sizeof( libsmdev_device_information_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear device information.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *device_information != NULL )
+	{
+		memory_free(
+		 *device_information );
+
+		*device_information = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees device information
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_information_free(
+     libsmdev_device_information_t **device_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_device_information_free";
+
+	if( device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *device_information != NULL )
+	{
+		memory_free(
+		 *device_information );
+
+		*device_information = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two device information by their sysfs block device name
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libsmdev_device_information_compare_by_name(
+     libsmdev_device_information_t *first_device_information,
+     libsmdev_device_information_t *second_device_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_device_information_compare_by_name";
+	int result            = 0;
+
+	if( first_device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first device information.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second device information.",
+		 function );
+
+		return( -1 );
+	}
+	/* Both names are terminated by an end of string character
+	 */
+	result = narrow_string_compare(
+	          first_device_information->name,
+	          second_device_information->name,
+	          64 );
+
+	if( result < 0 )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( result > 0 )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Sets the sysfs block device name
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_information_set_name(
+     libsmdev_device_information_t *device_information,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_device_information_set_name";
+
+	if( device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device information.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length >= 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     device_information->name,
+	     name,
+	     name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	device_information->name[ name_length ] = 0;
+	device_information->name_length         = name_length;
+	device_information->probe_flags         = 0;
+
+	return( 1 );
+}
+
+/* Probes the device information values that have not been read yet
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_information_probe(
+     libsmdev_device_information_t *device_information,
+     uint8_t probe_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_device_information_probe";
+
+	if( device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device information.",
+		 function );
+
+		return( -1 );
+	}
+	probe_flags &= ~( device_information->probe_flags );
+
+	if( ( probe_flags & LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_GEOMETRY ) != 0 )
+	{
+		if( libsmdev_device_information_probe_geometry(
+		     device_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to probe geometry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( probe_flags & LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_PROPERTIES ) != 0 )
+	{
+		if( libsmdev_device_information_probe_properties(
+		     device_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to probe properties.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( probe_flags & LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_IDENTITY ) != 0 )
+	{
+		if( libsmdev_device_information_probe_identity(
+		     device_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to probe identity.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( probe_flags & LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_TRANSPORT ) != 0 )
+	{
+		if( libsmdev_device_information_probe_transport(
+		     device_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to probe transport.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Probes the media size and sector sizes
+ * The sysfs size attribute is always in units of 512 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_information_probe_geometry(
+     libsmdev_device_information_t *device_information,
+     libcerror_error_t **error )
+{
+	char path[ LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE ];
+
+	static char *function = "libsmdev_device_information_probe_geometry";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device information.",
+		 function );
+
+		return( -1 );
+	}
+	device_information->media_size                = 0;
+	device_information->bytes_per_sector          = 0;
+	device_information->physical_bytes_per_sector = 0;
+
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "%s/%s/size",
+	 LIBSMDEV_SYSFS_BLOCK_PATH,
+	 device_information->name );
+
+	result = libsmdev_sysfs_read_integer(
+	          path,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( value_64bit > ( (uint64_t) UINT64_MAX / 512 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		device_information->media_size = (size64_t) value_64bit * 512;
+	}
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "%s/%s/queue/logical_block_size",
+	 LIBSMDEV_SYSFS_BLOCK_PATH,
+	 device_information->name );
+
+	result = libsmdev_sysfs_read_integer(
+	          path,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read logical block size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( value_64bit <= (uint64_t) UINT32_MAX ) )
+	{
+		device_information->bytes_per_sector = (uint32_t) value_64bit;
+	}
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "%s/%s/queue/physical_block_size",
+	 LIBSMDEV_SYSFS_BLOCK_PATH,
+	 device_information->name );
+
+	result = libsmdev_sysfs_read_integer(
+	          path,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read physical block size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( value_64bit <= (uint64_t) UINT32_MAX ) )
+	{
+		device_information->physical_bytes_per_sector = (uint32_t) value_64bit;
+	}
+	device_information->probe_flags |= LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_GEOMETRY;
+
+	return( 1 );
+}
+
+/* Probes the removable, rotational and device type properties
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_information_probe_properties(
+     libsmdev_device_information_t *device_information,
+     libcerror_error_t **error )
+{
+	char path[ LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE ];
+
+	static char *function = "libsmdev_device_information_probe_properties";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device information.",
+		 function );
+
+		return( -1 );
+	}
+	device_information->removable   = 0;
+	device_information->rotational  = 0;
+	device_information->device_type = 0;
+
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "%s/%s/removable",
+	 LIBSMDEV_SYSFS_BLOCK_PATH,
+	 device_information->name );
+
+	result = libsmdev_sysfs_read_integer(
+	          path,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read removable.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( value_64bit != 0 ) )
+	{
+		device_information->removable = 1;
+	}
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "%s/%s/queue/rotational",
+	 LIBSMDEV_SYSFS_BLOCK_PATH,
+	 device_information->name );
+
+	result = libsmdev_sysfs_read_integer(
+	          path,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read rotational.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( value_64bit != 0 ) )
+	{
+		device_information->rotational = 1;
+	}
+	/* The SCSI peripheral device type, e.g. 0x05 for an optical disc drive
+	 */
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "%s/%s/device/type",
+	 LIBSMDEV_SYSFS_BLOCK_PATH,
+	 device_information->name );
+
+	result = libsmdev_sysfs_read_integer(
+	          path,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		/* Not all transports provide a numeric device type
+		 */
+		libcerror_error_free(
+		 error );
+	}
+	else if( ( result != 0 )
+	      && ( value_64bit <= 0x1f ) )
+	{
+		device_information->device_type = (uint8_t) value_64bit;
+	}
+	device_information->probe_flags |= LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_PROPERTIES;
+
+	return( 1 );
+}
+
+/* Probes the vendor, model, serial number and world wide identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_information_probe_identity(
+     libsmdev_device_information_t *device_information,
+     libcerror_error_t **error )
+{
+	uint8_t vpd_data[ 256 ];
+	char path[ LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE ];
+
+	const char *serial_number_attributes[ 2 ] = {
+		"device/serial",
+		"serial" };
+
+	const char *world_wide_identifier_attributes[ 2 ] = {
+		"device/wwid",
+		"wwid" };
+
+	static char *function                     = "libsmdev_device_information_probe_identity";
+	size_t read_count                         = 0;
+	size_t vpd_data_size                      = 0;
+	int attribute_index                       = 0;
+	int result                                = 0;
+
+	if( device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device information.",
+		 function );
+
+		return( -1 );
+	}
+	device_information->vendor[ 0 ]                = 0;
+	device_information->model[ 0 ]                 = 0;
+	device_information->serial_number[ 0 ]         = 0;
+	device_information->world_wide_identifier[ 0 ] = 0;
+
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "%s/%s/device/vendor",
+	 LIBSMDEV_SYSFS_BLOCK_PATH,
+	 device_information->name );
+
+	if( libsmdev_sysfs_read_string(
+	     path,
+	     device_information->vendor,
+	     64,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read vendor.",
+		 function );
+
+		return( -1 );
+	}
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "%s/%s/device/model",
+	 LIBSMDEV_SYSFS_BLOCK_PATH,
+	 device_information->name );
+
+	if( libsmdev_sysfs_read_string(
+	     path,
+	     device_information->model,
+	     64,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read model.",
+		 function );
+
+		return( -1 );
+	}
+	for( attribute_index = 0;
+	     attribute_index < 2;
+	     attribute_index++ )
+	{
+		narrow_string_snprintf(
+		 path,
+		 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+		 "%s/%s/%s",
+		 LIBSMDEV_SYSFS_BLOCK_PATH,
+		 device_information->name,
+		 serial_number_attributes[ attribute_index ] );
+
+		result = libsmdev_sysfs_read_string(
+		          path,
+		          device_information->serial_number,
+		          64,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read serial number.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
+	}
+	if( device_information->serial_number[ 0 ] == 0 )
+	{
+		/* SCSI devices provide the unit serial number VPD page as cached by the kernel
+		 */
+		narrow_string_snprintf(
+		 path,
+		 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+		 "%s/%s/device/vpd_pg80",
+		 LIBSMDEV_SYSFS_BLOCK_PATH,
+		 device_information->name );
+
+		result = libsmdev_sysfs_read_data(
+		          path,
+		          vpd_data,
+		          256,
+		          &read_count,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unit serial number VPD page.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( read_count > 4 )
+		      && ( vpd_data[ 1 ] == 0x80 ) )
+		{
+			vpd_data_size = (size_t) vpd_data[ 3 ];
+
+			if( vpd_data_size > ( read_count - 4 ) )
+			{
+				vpd_data_size = read_count - 4;
+			}
+			if( vpd_data_size > 63 )
+			{
+				vpd_data_size = 63;
+			}
+			if( libsmdev_string_trim_copy_from_byte_stream(
+			     device_information->serial_number,
+			     64,
+			     &( vpd_data[ 4 ] ),
+			     vpd_data_size,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set serial number.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	for( attribute_index = 0;
+	     attribute_index < 2;
+	     attribute_index++ )
+	{
+		narrow_string_snprintf(
+		 path,
+		 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+		 "%s/%s/%s",
+		 LIBSMDEV_SYSFS_BLOCK_PATH,
+		 device_information->name,
+		 world_wide_identifier_attributes[ attribute_index ] );
+
+		result = libsmdev_sysfs_read_string(
+		          path,
+		          device_information->world_wide_identifier,
+		          64,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read world wide identifier.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
+	}
+	device_information->probe_flags |= LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_IDENTITY;
+
+	return( 1 );
+}
+
+/* Probes the transport (bus type) from the sysfs device path
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_information_probe_transport(
+     libsmdev_device_information_t *device_information,
+     libcerror_error_t **error )
+{
+	char path[ LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE ];
+	char target[ LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE ];
+
+	static char *function = "libsmdev_device_information_probe_transport";
+	int result            = 0;
+
+	if( device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device information.",
+		 function );
+
+		return( -1 );
+	}
+	device_information->bus_type = LIBSMDEV_BUS_TYPE_UNKNOWN;
+
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "%s/%s",
+	 LIBSMDEV_SYSFS_BLOCK_PATH,
+	 device_information->name );
+
+	result = libsmdev_sysfs_read_link(
+	          path,
+	          target,
+	          LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read device link.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libsmdev_device_information_get_bus_type_from_path(
+		     target,
+		     narrow_string_length(
+		      target ),
+		     &( device_information->bus_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine bus type.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	device_information->probe_flags |= LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_TRANSPORT;
+
+	return( 1 );
+}
+
+/* Determines the bus type from a sysfs device path
+ * E.g. ../devices/pci0000:00/0000:00:14.0/usb2/2-1/2-1:1.0/host6/target6:0:0/6:0:0:0/block/sdb
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_information_get_bus_type_from_path(
+     const char *path,
+     size_t path_length,
+     uint8_t *bus_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_device_information_get_bus_type_from_path";
+	size_t path_index     = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( bus_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bus type.",
+		 function );
+
+		return( -1 );
+	}
+	*bus_type = LIBSMDEV_BUS_TYPE_UNKNOWN;
+
+	/* The USB and FireWire components precede the SCSI host component
+	 * so they are checked first
+	 */
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		if( path[ path_index ] != '/' )
+		{
+			continue;
+		}
+		if( ( ( path_length - path_index ) > 4 )
+		 && ( narrow_string_compare(
+		       &( path[ path_index ] ),
+		       "/usb",
+		       4 ) == 0 ) )
+		{
+			*bus_type = LIBSMDEV_BUS_TYPE_USB;
+
+			break;
+		}
+		if( ( ( path_length - path_index ) > 3 )
+		 && ( narrow_string_compare(
+		       &( path[ path_index ] ),
+		       "/fw",
+		       3 ) == 0 ) )
+		{
+			*bus_type = LIBSMDEV_BUS_TYPE_FIREWIRE;
+
+			break;
+		}
+		if( *bus_type != LIBSMDEV_BUS_TYPE_UNKNOWN )
+		{
+			continue;
+		}
+		if( ( ( path_length - path_index ) > 4 )
+		 && ( narrow_string_compare(
+		       &( path[ path_index ] ),
+		       "/ata",
+		       4 ) == 0 ) )
+		{
+			*bus_type = LIBSMDEV_BUS_TYPE_ATA;
+		}
+		else if( ( ( path_length - path_index ) > 5 )
+		      && ( narrow_string_compare(
+		            &( path[ path_index ] ),
+		            "/host",
+		            5 ) == 0 ) )
+		{
+			*bus_type = LIBSMDEV_BUS_TYPE_SCSI;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded device path
+ * E.g. the sysfs block device name cciss!c0d0 corresponds to /dev/cciss/c0d0
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_information_get_utf8_device_path(
+     libsmdev_device_information_t *device_information,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_device_information_get_utf8_device_path";
+	size_t name_index     = 0;
+
+	if( device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device information.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size < ( device_information->name_length + 6 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string[ 0 ] = (uint8_t) '/';
+	utf8_string[ 1 ] = (uint8_t) 'd';
+	utf8_string[ 2 ] = (uint8_t) 'e';
+	utf8_string[ 3 ] = (uint8_t) 'v';
+	utf8_string[ 4 ] = (uint8_t) '/';
+
+	for( name_index = 0;
+	     name_index < device_information->name_length;
+	     name_index++ )
+	{
+		if( device_information->name[ name_index ] == '!' )
+		{
+			utf8_string[ 5 + name_index ] = (uint8_t) '/';
+		}
+		else
+		{
+			utf8_string[ 5 + name_index ] = (uint8_t) device_information->name[ name_index ];
+		}
+	}
+	utf8_string[ 5 + name_index ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves an UTF-8 encoded information value for the specific identifier
+ * The value size should include the end of string character
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libsmdev_device_information_get_utf8_information_value(
+     libsmdev_device_information_t *device_information,
+     const uint8_t *identifier,
+     size_t identifier_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *information_value    = NULL;
+	static char *function         = "libsmdev_device_information_get_utf8_information_value";
+	size_t information_value_size = 0;
+	size_t string_index           = 0;
+
+	if( device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device information.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_device_information_probe(
+	     device_information,
+	     LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_IDENTITY,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to probe identity.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier_length == 5 )
+	{
+		if( narrow_string_compare(
+		     "model",
+		     (char *) identifier,
+		     identifier_length ) == 0 )
+		{
+			information_value = device_information->model;
+		}
+	}
+	else if( identifier_length == 6 )
+	{
+		if( narrow_string_compare(
+		     "vendor",
+		     (char *) identifier,
+		     identifier_length ) == 0 )
+		{
+			information_value = device_information->vendor;
+		}
+	}
+	else if( identifier_length == 13 )
+	{
+		if( narrow_string_compare(
+		     "serial_number",
+		     (char *) identifier,
+		     identifier_length ) == 0 )
+		{
+			information_value = device_information->serial_number;
+		}
+	}
+	else if( identifier_length == 21 )
+	{
+		if( narrow_string_compare(
+		     "world_wide_identifier",
+		     (char *) identifier,
+		     identifier_length ) == 0 )
+		{
+			information_value = device_information->world_wide_identifier;
+		}
+	}
+	if( information_value == NULL )
+	{
+		return( 0 );
+	}
+	if( information_value[ 0 ] == 0 )
+	{
+		return( 0 );
+	}
+	information_value_size = 1 + narrow_string_length(
+	                              (char *) information_value );
+
+	if( utf8_string_size < information_value_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < information_value_size - 1;
+	     string_index++ )
+	{
+		utf8_string[ string_index ] = information_value[ string_index ];
+	}
+	utf8_string[ information_value_size - 1 ] = 0;
+
+	return( 1 );
+}
+
@@ -0,0 +1,168 @@
+/*
+ * Device information functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_DEVICE_INFORMATION_H )
+#define _LIBSMDEV_DEVICE_INFORMATION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAGS
+{
+	LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_GEOMETRY		= 0x01,
+	LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_PROPERTIES	= 0x02,
+	LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_IDENTITY		= 0x04,
+	LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_TRANSPORT	= 0x08
+};
+
+typedef struct libsmdev_device_information libsmdev_device_information_t;
+
+struct libsmdev_device_information
+{
+	/* The sysfs block device name
+	 */
+	char name[ 64 ];
+
+	/* The sysfs block device name length
+	 */
+	size_t name_length;
+
+	/* The probe flags, which indicate which values were read
+	 */
+	uint8_t probe_flags;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of bytes per (logical) sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The number of bytes per physical sector
+	 */
+	uint32_t physical_bytes_per_sector;
+
+	/* The (SCSI) device type
+	 */
+	uint8_t device_type;
+
+	/* Value to indicate if the device is removable
+	 */
+	uint8_t removable;
+
+	/* Value to indicate if the device is rotational
+	 */
+	uint8_t rotational;
+
+	/* The bus type
+	 */
+	uint8_t bus_type;
+
+	/* The vendor string
+	 */
+	uint8_t vendor[ 64 ];
+
+	/* The model string
+	 */
+	uint8_t model[ 64 ];
+
+	/* The serial number string
+	 */
+	uint8_t serial_number[ 64 ];
+
+	/* The world wide identifier string
+	 */
+	uint8_t world_wide_identifier[ 64 ];
+};
+
+int libsmdev_device_information_initialize(
+     libsmdev_device_information_t **device_information,
+     libcerror_error_t **error );
+
+int libsmdev_device_information_free(
+     libsmdev_device_information_t **device_information,
+     libcerror_error_t **error );
+
+int libsmdev_device_information_compare_by_name(
+     libsmdev_device_information_t *first_device_information,
+     libsmdev_device_information_t *second_device_information,
+     libcerror_error_t **error );
+
+int libsmdev_device_information_set_name(
+     libsmdev_device_information_t *device_information,
+     const char *name,
+     size_t name_length,
+     libcerror_error_t **error );
+
+int libsmdev_device_information_probe(
+     libsmdev_device_information_t *device_information,
+     uint8_t probe_flags,
+     libcerror_error_t **error );
+
+int libsmdev_device_information_probe_geometry(
+     libsmdev_device_information_t *device_information,
+     libcerror_error_t **error );
+
+int libsmdev_device_information_probe_properties(
+     libsmdev_device_information_t *device_information,
+     libcerror_error_t **error );
+
+int libsmdev_device_information_probe_identity(
+     libsmdev_device_information_t *device_information,
+     libcerror_error_t **error );
+
+int libsmdev_device_information_probe_transport(
+     libsmdev_device_information_t *device_information,
+     libcerror_error_t **error );
+
+int libsmdev_device_information_get_bus_type_from_path(
+     const char *path,
+     size_t path_length,
+     uint8_t *bus_type,
+     libcerror_error_t **error );
+
+int libsmdev_device_information_get_utf8_device_path(
+     libsmdev_device_information_t *device_information,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libsmdev_device_information_get_utf8_information_value(
+     libsmdev_device_information_t *device_information,
+     const uint8_t *identifier,
+     size_t identifier_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_DEVICE_INFORMATION_H ) */
+
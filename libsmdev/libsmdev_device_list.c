@@ -0,0 +1,855 @@
+/*
+ * Device list functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_device_information.h"
+#include "libsmdev_device_list.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_sysfs.h"
+
+/* Creates a device list
+ * Make sure the value device_list is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_list_initialize(
+     libsmdev_device_list_t **device_list,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_device_list_t *internal_device_list = NULL;
+	static char *function                                 = "libsmdev_device_list_initialize";
+
+	if( device_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *device_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid device list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_device_list = memory_allocate_structure(
+	                        libsmdev_internal_device_list_t );
+
+	if( internal_device_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create device list.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_device_list,
+	     0,
+	     sizeof( libsmdev_internal_device_list_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear device list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_device_list->devices_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create devices array.",
+		 function );
+
+		goto on_error;
+	}
+	*device_list = (libsmdev_device_list_t *) internal_device_list;
+
+	return( 1 );
+
+on_error:
+	if( internal_device_list != NULL )
+	{
+		memory_free(
+		 internal_device_list );
+	}
+	return( -1 );
+}
+
+/* Frees a device list
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_list_free(
+     libsmdev_device_list_t **device_list,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_device_list_t *internal_device_list = NULL;
+	static char *function                                 = "libsmdev_device_list_free";
+	int result                                            = 1;
+
+	if( device_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *device_list != NULL )
+	{
+		internal_device_list = (libsmdev_internal_device_list_t *) *device_list;
+		*device_list         = NULL;
+
+		if( libcdata_array_free(
+		     &( internal_device_list->devices_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_device_information_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free devices array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_device_list );
+	}
+	return( result );
+}
+
+/* Scans the system for block devices
+ * Only the names of the devices are determined, the other values are read
+ * from sysfs when first requested. The devices are not opened
+ * Returns 1 if successful, 0 if not supported on this platform or -1 on error
+ */
+int libsmdev_device_list_scan(
+     libsmdev_device_list_t *device_list,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_device_list_t *internal_device_list = NULL;
+	static char *function                                 = "libsmdev_device_list_scan";
+
+#if defined( HAVE_DIRENT_H ) && defined( HAVE_LINUX_FS_H )
+	libsmdev_device_information_t *device_information     = NULL;
+	struct dirent *directory_entry                        = NULL;
+	DIR *directory                                        = NULL;
+	size_t name_length                                    = 0;
+	int entry_index                                       = 0;
+	int result                                            = 0;
+#endif
+
+	if( device_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_device_list = (libsmdev_internal_device_list_t *) device_list;
+
+	if( libcdata_array_empty(
+	     internal_device_list->devices_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_device_information_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty devices array.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DIRENT_H ) && defined( HAVE_LINUX_FS_H )
+	directory = opendir(
+	             LIBSMDEV_SYSFS_BLOCK_PATH );
+
+	if( directory == NULL )
+	{
+		return( 0 );
+	}
+	while( ( directory_entry = readdir( directory ) ) != NULL )
+	{
+		if( directory_entry->d_name[ 0 ] == '.' )
+		{
+			continue;
+		}
+		name_length = narrow_string_length(
+		               directory_entry->d_name );
+
+		if( ( name_length == 0 )
+		 || ( name_length >= 64 ) )
+		{
+			continue;
+		}
+		if( libsmdev_device_information_initialize(
+		     &device_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create device information.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsmdev_device_information_set_name(
+		     device_information,
+		     directory_entry->d_name,
+		     name_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set device information name.",
+			 function );
+
+			goto on_error;
+		}
+		/* The devices are sorted by name so that the device indexes are stable
+		 */
+		result = libcdata_array_insert_entry(
+		          internal_device_list->devices_array,
+		          &entry_index,
+		          (intptr_t *) device_information,
+		          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libsmdev_device_information_compare_by_name,
+		          LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert device information in array.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libsmdev_device_information_free(
+			     &device_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free device information.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		device_information = NULL;
+	}
+	if( closedir(
+	     directory ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		directory = NULL;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( device_information != NULL )
+	{
+		libsmdev_device_information_free(
+		 &device_information,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		closedir(
+		 directory );
+	}
+	libcdata_array_empty(
+	 internal_device_list->devices_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_device_information_free,
+	 NULL );
+
+	return( -1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Retrieves the number of devices
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_list_get_number_of_devices(
+     libsmdev_device_list_t *device_list,
+     int *number_of_devices,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_device_list_t *internal_device_list = NULL;
+	static char *function                                 = "libsmdev_device_list_get_number_of_devices";
+
+	if( device_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_device_list = (libsmdev_internal_device_list_t *) device_list;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_device_list->devices_array,
+	     number_of_devices,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of devices.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves specific device information and probes the requested values
+ * The values are read from sysfs only once, successive calls use the cached values
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_internal_device_list_get_device_information(
+     libsmdev_internal_device_list_t *internal_device_list,
+     int device_index,
+     uint8_t probe_flags,
+     libsmdev_device_information_t **device_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_internal_device_list_get_device_information";
+
+	if( internal_device_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device list.",
+		 function );
+
+		return( -1 );
+	}
+	if( device_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device information.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_device_list->devices_array,
+	     device_index,
+	     (intptr_t **) device_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device information: %d.",
+		 function,
+		 device_index );
+
+		return( -1 );
+	}
+	if( probe_flags != 0 )
+	{
+		if( libsmdev_device_information_probe(
+		     *device_information,
+		     probe_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to probe device information: %d.",
+			 function,
+			 device_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded device path, e.g. /dev/sda
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_list_get_utf8_device_path(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libsmdev_device_information_t *device_information = NULL;
+	static char *function                             = "libsmdev_device_list_get_utf8_device_path";
+
+	if( libsmdev_internal_device_list_get_device_information(
+	     (libsmdev_internal_device_list_t *) device_list,
+	     device_index,
+	     0,
+	     &device_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device information: %d.",
+		 function,
+		 device_index );
+
+		return( -1 );
+	}
+	if( libsmdev_device_information_get_utf8_device_path(
+	     device_information,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 device path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the media size
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_list_get_media_size(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     size64_t *media_size,
+     libcerror_error_t **error )
+{
+	libsmdev_device_information_t *device_information = NULL;
+	static char *function                             = "libsmdev_device_list_get_media_size";
+
+	if( media_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_device_list_get_device_information(
+	     (libsmdev_internal_device_list_t *) device_list,
+	     device_index,
+	     LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_GEOMETRY,
+	     &device_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device information: %d.",
+		 function,
+		 device_index );
+
+		return( -1 );
+	}
+	*media_size = device_information->media_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of bytes per (logical) sector
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libsmdev_device_list_get_bytes_per_sector(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error )
+{
+	libsmdev_device_information_t *device_information = NULL;
+	static char *function                             = "libsmdev_device_list_get_bytes_per_sector";
+
+	if( bytes_per_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_device_list_get_device_information(
+	     (libsmdev_internal_device_list_t *) device_list,
+	     device_index,
+	     LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_GEOMETRY,
+	     &device_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device information: %d.",
+		 function,
+		 device_index );
+
+		return( -1 );
+	}
+	if( device_information->bytes_per_sector == 0 )
+	{
+		return( 0 );
+	}
+	*bytes_per_sector = device_information->bytes_per_sector;
+
+	return( 1 );
+}
+
+/* Retrieves the number of bytes per physical sector
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libsmdev_device_list_get_physical_bytes_per_sector(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error )
+{
+	libsmdev_device_information_t *device_information = NULL;
+	static char *function                             = "libsmdev_device_list_get_physical_bytes_per_sector";
+
+	if( bytes_per_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_device_list_get_device_information(
+	     (libsmdev_internal_device_list_t *) device_list,
+	     device_index,
+	     LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_GEOMETRY,
+	     &device_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device information: %d.",
+		 function,
+		 device_index );
+
+		return( -1 );
+	}
+	if( device_information->physical_bytes_per_sector == 0 )
+	{
+		return( 0 );
+	}
+	*bytes_per_sector = device_information->physical_bytes_per_sector;
+
+	return( 1 );
+}
+
+/* Retrieves the media type
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_list_get_media_type(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     uint8_t *media_type,
+     libcerror_error_t **error )
+{
+	libsmdev_device_information_t *device_information = NULL;
+	static char *function                             = "libsmdev_device_list_get_media_type";
+
+	if( media_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_device_list_get_device_information(
+	     (libsmdev_internal_device_list_t *) device_list,
+	     device_index,
+	     LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_PROPERTIES,
+	     &device_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device information: %d.",
+		 function,
+		 device_index );
+
+		return( -1 );
+	}
+	if( device_information->device_type == 0x05 )
+	{
+		*media_type = LIBSMDEV_MEDIA_TYPE_OPTICAL;
+	}
+	else if( device_information->removable != 0 )
+	{
+		*media_type = LIBSMDEV_MEDIA_TYPE_REMOVABLE;
+	}
+	else
+	{
+		*media_type = LIBSMDEV_MEDIA_TYPE_FIXED;
+	}
+	return( 1 );
+}
+
+/* Retrieves the value to indicate if the device is rotational
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_list_get_rotational(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     uint8_t *rotational,
+     libcerror_error_t **error )
+{
+	libsmdev_device_information_t *device_information = NULL;
+	static char *function                             = "libsmdev_device_list_get_rotational";
+
+	if( rotational == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rotational.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_device_list_get_device_information(
+	     (libsmdev_internal_device_list_t *) device_list,
+	     device_index,
+	     LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_PROPERTIES,
+	     &device_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device information: %d.",
+		 function,
+		 device_index );
+
+		return( -1 );
+	}
+	*rotational = device_information->rotational;
+
+	return( 1 );
+}
+
+/* Retrieves the bus type
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_device_list_get_bus_type(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     uint8_t *bus_type,
+     libcerror_error_t **error )
+{
+	libsmdev_device_information_t *device_information = NULL;
+	static char *function                             = "libsmdev_device_list_get_bus_type";
+
+	if( bus_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bus type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_device_list_get_device_information(
+	     (libsmdev_internal_device_list_t *) device_list,
+	     device_index,
+	     LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_TRANSPORT,
+	     &device_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device information: %d.",
+		 function,
+		 device_index );
+
+		return( -1 );
+	}
+	*bus_type = device_information->bus_type;
+
+	return( 1 );
+}
+
+/* Retrieves an UTF-8 encoded information value for the specific identifier
+ * The identifiers are: vendor, model, serial_number and world_wide_identifier
+ * The value size should include the end of string character
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libsmdev_device_list_get_utf8_information_value(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     const uint8_t *identifier,
+     size_t identifier_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libsmdev_device_information_t *device_information = NULL;
+	static char *function                             = "libsmdev_device_list_get_utf8_information_value";
+	int result                                        = 0;
+
+	if( libsmdev_internal_device_list_get_device_information(
+	     (libsmdev_internal_device_list_t *) device_list,
+	     device_index,
+	     0,
+	     &device_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve device information: %d.",
+		 function,
+		 device_index );
+
+		return( -1 );
+	}
+	result = libsmdev_device_information_get_utf8_information_value(
+	          device_information,
+	          identifier,
+	          identifier_length,
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 information value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
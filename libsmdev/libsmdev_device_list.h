@@ -0,0 +1,140 @@
+/*
+ * Device list functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_INTERNAL_DEVICE_LIST_H )
+#define _LIBSMDEV_INTERNAL_DEVICE_LIST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_device_information.h"
+#include "libsmdev_extern.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsmdev_internal_device_list libsmdev_internal_device_list_t;
+
+struct libsmdev_internal_device_list
+{
+	/* The device information array
+	 */
+	libcdata_array_t *devices_array;
+};
+
+LIBSMDEV_EXTERN \
+int libsmdev_device_list_initialize(
+     libsmdev_device_list_t **device_list,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_device_list_free(
+     libsmdev_device_list_t **device_list,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_device_list_scan(
+     libsmdev_device_list_t *device_list,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_device_list_get_number_of_devices(
+     libsmdev_device_list_t *device_list,
+     int *number_of_devices,
+     libcerror_error_t **error );
+
+int libsmdev_internal_device_list_get_device_information(
+     libsmdev_internal_device_list_t *internal_device_list,
+     int device_index,
+     uint8_t probe_flags,
+     libsmdev_device_information_t **device_information,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_device_list_get_utf8_device_path(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_device_list_get_media_size(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     size64_t *media_size,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_device_list_get_bytes_per_sector(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_device_list_get_physical_bytes_per_sector(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_device_list_get_media_type(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     uint8_t *media_type,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_device_list_get_rotational(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     uint8_t *rotational,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_device_list_get_bus_type(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     uint8_t *bus_type,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_device_list_get_utf8_information_value(
+     libsmdev_device_list_t *device_list,
+     int device_index,
+     const uint8_t *identifier,
+     size_t identifier_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_INTERNAL_DEVICE_LIST_H ) */
+
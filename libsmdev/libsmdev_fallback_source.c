@@ -0,0 +1,343 @@
+/*
+ * Fallback source functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_fallback_source.h"
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+
+/* Creates a fallback source
+ * Make sure the value fallback_source is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_fallback_source_initialize(
+     libsmdev_fallback_source_t **fallback_source,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_fallback_source_initialize";
+
+	if( fallback_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fallback source.",
+		 function );
+
+		return( -1 );
+	}
+	if( *fallback_source != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid fallback source value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*fallback_source = memory_allocate_structure(
+	                    libsmdev_fallback_source_t );
+
+	if( *fallback_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create fallback source.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *fallback_source,
+	     0,
+	     sizeof( libsmdev_fallback_source_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear fallback source.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_initialize(
+	     &( ( *fallback_source )->supplied_range_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create supplied range list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *fallback_source != NULL )
+	{
+		memory_free(
+		 *fallback_source );
+
+		*fallback_source = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a fallback source
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_fallback_source_free(
+     libsmdev_fallback_source_t **fallback_source,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_fallback_source_free";
+	int result            = 1;
+
+	if( fallback_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fallback source.",
+		 function );
+
+		return( -1 );
+	}
+	if( *fallback_source != NULL )
+	{
+		/* The handle is referenced and freed elsewhere
+		 */
+		if( ( *fallback_source )->io_backend != NULL )
+		{
+			if( libsmdev_io_backend_close(
+			     ( *fallback_source )->io_backend,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close IO backend.",
+				 function );
+
+				result = -1;
+			}
+			if( libsmdev_io_backend_free(
+			     &( ( *fallback_source )->io_backend ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free IO backend.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcdata_range_list_free(
+		     &( ( *fallback_source )->supplied_range_list ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free supplied range list.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *fallback_source );
+
+		*fallback_source = NULL;
+	}
+	return( result );
+}
+
+/* Opens a file as the fallback source
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_fallback_source_open(
+     libsmdev_fallback_source_t *fallback_source,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_fallback_source_open";
+
+	if( fallback_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fallback source.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( fallback_source->handle != NULL )
+	 || ( fallback_source->io_backend != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid fallback source - source value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_io_backend_initialize_file(
+	     &( fallback_source->io_backend ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO backend.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_io_backend_open(
+	     fallback_source->io_backend,
+	     filename,
+	     LIBSMDEV_ACCESS_FLAG_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( fallback_source->io_backend != NULL )
+	{
+		libsmdev_io_backend_free(
+		 &( fallback_source->io_backend ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a file as the fallback source
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_fallback_source_open_wide(
+     libsmdev_fallback_source_t *fallback_source,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_fallback_source_open_wide";
+
+	if( fallback_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fallback source.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( fallback_source->handle != NULL )
+	 || ( fallback_source->io_backend != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid fallback source - source value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_io_backend_initialize_file(
+	     &( fallback_source->io_backend ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO backend.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_io_backend_open_wide(
+	     fallback_source->io_backend,
+	     filename,
+	     LIBSMDEV_ACCESS_FLAG_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( fallback_source->io_backend != NULL )
+	{
+		libsmdev_io_backend_free(
+		 &( fallback_source->io_backend ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
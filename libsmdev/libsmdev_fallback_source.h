@@ -0,0 +1,85 @@
+/*
+ * Fallback source functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_FALLBACK_SOURCE_H )
+#define _LIBSMDEV_FALLBACK_SOURCE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsmdev_fallback_source libsmdev_fallback_source_t;
+
+struct libsmdev_fallback_source
+{
+	/* The handle
+	 * Contains NULL if the source is a file
+	 * The handle is not managed by the fallback source
+	 */
+	libsmdev_handle_t *handle;
+
+	/* The IO backend of the file
+	 * Contains NULL if the source is a handle
+	 */
+	libsmdev_io_backend_t *io_backend;
+
+	/* The supplied range list
+	 * Contains the ranges of which the data was read from the source
+	 */
+	libcdata_range_list_t *supplied_range_list;
+};
+
+int libsmdev_fallback_source_initialize(
+     libsmdev_fallback_source_t **fallback_source,
+     libcerror_error_t **error );
+
+int libsmdev_fallback_source_free(
+     libsmdev_fallback_source_t **fallback_source,
+     libcerror_error_t **error );
+
+int libsmdev_fallback_source_open(
+     libsmdev_fallback_source_t *fallback_source,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libsmdev_fallback_source_open_wide(
+     libsmdev_fallback_source_t *fallback_source,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_FALLBACK_SOURCE_H ) */
+
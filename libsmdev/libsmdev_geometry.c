@@ -0,0 +1,585 @@
+/*
+ * Geometry functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmdev_geometry.h"
+#include "libsmdev_libcerror.h"
+
+/* Creates a geometry
+ * Make sure the value geometry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_geometry_initialize(
+     libsmdev_geometry_t **geometry,
+     uint32_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_geometry_initialize";
+
+	if( geometry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid geometry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *geometry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid geometry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid bytes per sector value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*geometry = memory_allocate_structure(
+	             libsmdev_geometry_t );
+
+	if( *geometry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create geometry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *geometry,
+	     0,
+	     sizeof( libsmdev_geometry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear geometry.",
+		 function );
+
+		goto on_error;
+	}
+	( *geometry )->bytes_per_sector = bytes_per_sector;
+
+	return( 1 );
+
+on_error:
+	if( *geometry != NULL )
+	{
+		memory_free(
+		 *geometry );
+
+		*geometry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a geometry
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_geometry_free(
+     libsmdev_geometry_t **geometry,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_geometry_free";
+
+	if( geometry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid geometry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *geometry != NULL )
+	{
+		memory_free(
+		 *geometry );
+
+		*geometry = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the geometry from SCSI READ CAPACITY (16) parameter data
+ * Returns 1 if successful, 0 if the data does not contain a valid capacity or -1 on error
+ */
+int libsmdev_geometry_read_capacity_16_data(
+     libsmdev_geometry_t *geometry,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libsmdev_geometry_read_capacity_16_data";
+	uint64_t last_sector            = 0;
+	uint32_t block_length           = 0;
+	uint8_t logical_blocks_exponent = 0;
+
+	if( geometry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid geometry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < 16 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_big_endian(
+	 &( data[ 0 ] ),
+	 last_sector );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 8 ] ),
+	 block_length );
+
+	/* The number of logical blocks per physical block is stored as a power of 2
+	 */
+	logical_blocks_exponent = data[ 13 ] & 0x0f;
+
+	if( ( block_length == 0 )
+	 || ( last_sector == (uint64_t) UINT64_MAX ) )
+	{
+		return( 0 );
+	}
+	if( block_length > ( (uint32_t) UINT32_MAX >> logical_blocks_exponent ) )
+	{
+		return( 0 );
+	}
+	geometry->bytes_per_sector          = block_length;
+	geometry->number_of_sectors         = last_sector + 1;
+	geometry->physical_bytes_per_sector = block_length << logical_blocks_exponent;
+	geometry->lowest_aligned_sector     = ( (uint16_t) ( data[ 14 ] & 0x3f ) << 8 ) | data[ 15 ];
+
+	return( 1 );
+}
+
+/* Reads the geometry from SCSI block limits vital product data (VPD) page 0xb0
+ * Returns 1 if successful, 0 if the data does not contain a block limits page or -1 on error
+ */
+int libsmdev_geometry_read_block_limits_data(
+     libsmdev_geometry_t *geometry,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_geometry_read_block_limits_data";
+	uint16_t page_size    = 0;
+
+	if( geometry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid geometry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 16 )
+	 || ( data[ 1 ] != 0xb0 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_big_endian(
+	 &( data[ 2 ] ),
+	 page_size );
+
+	/* Older devices return a shorter page that does not contain the transfer lengths
+	 */
+	if( page_size < 12 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_big_endian(
+	 &( data[ 6 ] ),
+	 geometry->optimal_transfer_length_granularity );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 8 ] ),
+	 geometry->maximum_transfer_length );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( data[ 12 ] ),
+	 geometry->optimal_transfer_length );
+
+	return( 1 );
+}
+
+/* Reads the geometry from SCSI block device characteristics vital product data (VPD) page 0xb1
+ * Returns 1 if successful, 0 if the data does not contain a block device characteristics page or -1 on error
+ */
+int libsmdev_geometry_read_block_device_characteristics_data(
+     libsmdev_geometry_t *geometry,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_geometry_read_block_device_characteristics_data";
+
+	if( geometry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid geometry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 6 )
+	 || ( data[ 1 ] != 0xb1 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_big_endian(
+	 &( data[ 4 ] ),
+	 geometry->rotation_rate );
+
+	return( 1 );
+}
+
+/* Sets the alignment offset
+ * The alignment offset is the offset in bytes of the first physical sector boundary,
+ * as reported by the operating system
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_geometry_set_alignment_offset(
+     libsmdev_geometry_t *geometry,
+     uint64_t alignment_offset,
+     libcerror_error_t **error )
+{
+	static char *function          = "libsmdev_geometry_set_alignment_offset";
+	uint64_t lowest_aligned_sector = 0;
+
+	if( geometry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid geometry.",
+		 function );
+
+		return( -1 );
+	}
+	if( geometry->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid geometry - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( alignment_offset % geometry->bytes_per_sector ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported alignment offset value not a multiple of bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	lowest_aligned_sector = alignment_offset / geometry->bytes_per_sector;
+
+	if( lowest_aligned_sector > 0x3fff )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid alignment offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	geometry->lowest_aligned_sector = (uint16_t) lowest_aligned_sector;
+
+	return( 1 );
+}
+
+/* Retrieves the alignment offset
+ * The alignment offset is the offset in bytes of the first physical sector boundary
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_geometry_get_alignment_offset(
+     libsmdev_geometry_t *geometry,
+     uint64_t *alignment_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_geometry_get_alignment_offset";
+	uint64_t safe_offset  = 0;
+
+	if( geometry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid geometry.",
+		 function );
+
+		return( -1 );
+	}
+	if( alignment_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid alignment offset.",
+		 function );
+
+		return( -1 );
+	}
+	safe_offset = (uint64_t) geometry->lowest_aligned_sector * geometry->bytes_per_sector;
+
+	if( geometry->physical_bytes_per_sector > 0 )
+	{
+		safe_offset %= geometry->physical_bytes_per_sector;
+	}
+	*alignment_offset = safe_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the request size that fits the geometry
+ * The request size is limited to the maximum and optimal transfer length, so that
+ * the target does not split the request, and is a multiple of the physical sector size
+ * and optimal transfer length granularity, so that the target does not need to read
+ * a physical sector more than once
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_geometry_get_request_size(
+     libsmdev_geometry_t *geometry,
+     size_t request_size,
+     size_t *aligned_request_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libsmdev_geometry_get_request_size";
+	uint64_t alignment_size   = 0;
+	uint64_t granularity_size = 0;
+	uint64_t maximum_size     = 0;
+	uint64_t optimal_size     = 0;
+	uint64_t safe_size        = 0;
+
+	if( geometry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid geometry.",
+		 function );
+
+		return( -1 );
+	}
+	if( geometry->bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid geometry - missing bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( request_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid request size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( aligned_request_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid aligned request size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_size      = (uint64_t) request_size;
+	alignment_size = geometry->bytes_per_sector;
+
+	if( geometry->physical_bytes_per_sector > geometry->bytes_per_sector )
+	{
+		alignment_size = geometry->physical_bytes_per_sector;
+	}
+	granularity_size = (uint64_t) geometry->optimal_transfer_length_granularity * geometry->bytes_per_sector;
+
+	if( ( granularity_size > alignment_size )
+	 && ( ( granularity_size % alignment_size ) == 0 ) )
+	{
+		alignment_size = granularity_size;
+	}
+	/* The product of the 32-bit values fits in a 64-bit value
+	 */
+	maximum_size = (uint64_t) geometry->maximum_transfer_length * geometry->bytes_per_sector;
+	optimal_size = (uint64_t) geometry->optimal_transfer_length * geometry->bytes_per_sector;
+
+	if( ( optimal_size > 0 )
+	 && ( safe_size > optimal_size ) )
+	{
+		safe_size = optimal_size;
+	}
+	if( ( maximum_size > 0 )
+	 && ( safe_size > maximum_size ) )
+	{
+		safe_size = maximum_size;
+	}
+	if( safe_size >= alignment_size )
+	{
+		safe_size -= safe_size % alignment_size;
+	}
+	else if( ( maximum_size == 0 )
+	      || ( alignment_size <= maximum_size ) )
+	{
+		safe_size = alignment_size;
+	}
+	else if( safe_size >= geometry->bytes_per_sector )
+	{
+		safe_size -= safe_size % geometry->bytes_per_sector;
+	}
+	else
+	{
+		safe_size = geometry->bytes_per_sector;
+	}
+	if( safe_size > (uint64_t) SSIZE_MAX )
+	{
+		safe_size = (uint64_t) SSIZE_MAX - ( (uint64_t) SSIZE_MAX % alignment_size );
+	}
+	*aligned_request_size = (size_t) safe_size;
+
+	return( 1 );
+}
+
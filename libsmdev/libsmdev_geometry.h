@@ -0,0 +1,130 @@
+/*
+ * Geometry functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_GEOMETRY_H )
+#define _LIBSMDEV_GEOMETRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The medium rotation rate that indicates a non-rotating medium, such as a solid state drive
+ */
+#define LIBSMDEV_GEOMETRY_ROTATION_RATE_NON_ROTATING	1
+
+typedef struct libsmdev_geometry libsmdev_geometry_t;
+
+struct libsmdev_geometry
+{
+	/* The number of bytes per (logical) sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The number of (logical) sectors
+	 * Contains 0 if not reported
+	 */
+	uint64_t number_of_sectors;
+
+	/* The number of bytes per physical sector
+	 * Contains 0 if not reported
+	 */
+	uint32_t physical_bytes_per_sector;
+
+	/* The lowest aligned (logical) sector, which is the first sector
+	 * that starts at the start of a physical sector
+	 */
+	uint16_t lowest_aligned_sector;
+
+	/* The maximum transfer length in (logical) sectors
+	 * Contains 0 if not reported
+	 */
+	uint32_t maximum_transfer_length;
+
+	/* The optimal transfer length in (logical) sectors
+	 * Contains 0 if not reported
+	 */
+	uint32_t optimal_transfer_length;
+
+	/* The optimal transfer length granularity in (logical) sectors
+	 * Contains 0 if not reported
+	 */
+	uint16_t optimal_transfer_length_granularity;
+
+	/* The medium rotation rate in revolutions per minute (RPM)
+	 * Contains 0 if not reported or 1 if the medium is non-rotating
+	 */
+	uint16_t rotation_rate;
+};
+
+int libsmdev_geometry_initialize(
+     libsmdev_geometry_t **geometry,
+     uint32_t bytes_per_sector,
+     libcerror_error_t **error );
+
+int libsmdev_geometry_free(
+     libsmdev_geometry_t **geometry,
+     libcerror_error_t **error );
+
+int libsmdev_geometry_read_capacity_16_data(
+     libsmdev_geometry_t *geometry,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libsmdev_geometry_read_block_limits_data(
+     libsmdev_geometry_t *geometry,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libsmdev_geometry_read_block_device_characteristics_data(
+     libsmdev_geometry_t *geometry,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libsmdev_geometry_set_alignment_offset(
+     libsmdev_geometry_t *geometry,
+     uint64_t alignment_offset,
+     libcerror_error_t **error );
+
+int libsmdev_geometry_get_alignment_offset(
+     libsmdev_geometry_t *geometry,
+     uint64_t *alignment_offset,
+     libcerror_error_t **error );
+
+int libsmdev_geometry_get_request_size(
+     libsmdev_geometry_t *geometry,
+     size_t request_size,
+     size_t *aligned_request_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_GEOMETRY_H ) */
+
@@ -34,10 +34,18 @@
 #include <errno.h>
 #endif
 
+#if defined( HAVE_FCNTL_H ) && !defined( WINAPI )
+#include <fcntl.h>
+#endif
+
 #if defined( HAVE_UNISTD_H )
 #include <unistd.h>
 #endif
 
+#if defined( HAVE_NANOSLEEP )
+#include <time.h>
+#endif
+
 #if defined( WINAPI )
 #include <winioctl.h>
 
@@ -67,8 +75,13 @@ typedef size_t u64;
 #endif /* defined( WINAPI ) */
 
 #include "libsmdev_ata.h"
+#include "libsmdev_composite.h"
+#include "libsmdev_copy.h"
 #include "libsmdev_definitions.h"
+#include "libsmdev_fallback_source.h"
 #include "libsmdev_handle.h"
+#include "libsmdev_io_backend.h"
+#include "libsmdev_io_control.h"
 #include "libsmdev_libcdata.h"
 #include "libsmdev_libcerror.h"
 #include "libsmdev_libcfile.h"
@@ -76,11 +89,27 @@ typedef size_t u64;
 #include "libsmdev_libcnotify.h"
 #include "libsmdev_libuna.h"
 #include "libsmdev_optical_disc.h"
+#include "libsmdev_optical_read.h"
+#include "libsmdev_parallel_reader.h"
+#include "libsmdev_partition_table.h"
+#include "libsmdev_probe_cache.h"
+#include "libsmdev_read_ahead.h"
+#include "libsmdev_read_speed.h"
+#include "libsmdev_read_request.h"
+#include "libsmdev_read_scheduler.h"
+#include "libsmdev_sample_region.h"
+#include "libsmdev_sampler.h"
+#include "libsmdev_sanitizer.h"
 #include "libsmdev_scsi.h"
 #include "libsmdev_sector_range.h"
 #include "libsmdev_string.h"
+#include "libsmdev_sysfs.h"
 #include "libsmdev_track_value.h"
+#include "libsmdev_transport_profile.h"
 #include "libsmdev_types.h"
+#include "libsmdev_usb.h"
+#include "libsmdev_verify.h"
+#include "libsmdev_write_engine.h"
 
 #if defined( WINAPI )
 
@@ -265,8 +294,74 @@ int libsmdev_handle_initialize(
 
 		return( -1 );
 	}
+	if( libsmdev_table_of_contents_initialize(
+	     &( internal_handle->table_of_contents ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table of contents.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_initialize(
+	     &( internal_handle->errors_range_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create errors range list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_handle->fallback_sources_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create fallback sources array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_initialize(
+	     &( internal_handle->mismatches_range_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mismatches range list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_initialize(
+	     &( internal_handle->suspect_sectors_range_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create suspect sectors range list.",
+		 function );
+
+		goto on_error;
+	}
 	if( libcdata_array_initialize(
-	     &( internal_handle->tracks_array ),
+	     &( internal_handle->read_requests_array ),
 	     0,
 	     error ) != 1 )
 	{
@@ -274,13 +369,13 @@ int libsmdev_handle_initialize(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create tracks array.",
+		 "%s: unable to create read requests array.",
 		 function );
 
 		goto on_error;
 	}
 	if( libcdata_array_initialize(
-	     &( internal_handle->sessions_array ),
+	     &( internal_handle->sample_regions_array ),
 	     0,
 	     error ) != 1 )
 	{
@@ -288,13 +383,13 @@ int libsmdev_handle_initialize(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sessions array.",
+		 "%s: unable to create sample regions array.",
 		 function );
 
 		goto on_error;
 	}
 	if( libcdata_array_initialize(
-	     &( internal_handle->lead_outs_array ),
+	     &( internal_handle->transport_profiles_array ),
 	     0,
 	     error ) != 1 )
 	{
@@ -302,25 +397,56 @@ int libsmdev_handle_initialize(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create lead-outs array.",
+		 "%s: unable to create transport profiles array.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_range_list_initialize(
-	     &( internal_handle->errors_range_list ),
+	if( libsmdev_partition_table_initialize(
+	     &( internal_handle->partition_table ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create errors range list.",
+		 "%s: unable to create partition table.",
 		 function );
 
 		goto on_error;
 	}
+	if( libsmdev_read_ahead_initialize(
+	     &( internal_handle->read_ahead ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_read_speed_initialize(
+	     &( internal_handle->read_speed ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read speed.",
+		 function );
+
+		goto on_error;
+	}
+	internal_handle->io_backend_type         = LIBSMDEV_IO_BACKEND_TYPE_FILE;
 	internal_handle->number_of_error_retries = 2;
+	internal_handle->number_of_read_threads  = 1;
+	internal_handle->read_stripe_size        = LIBSMDEV_PARALLEL_READER_DEFAULT_STRIPE_SIZE;
+	internal_handle->maximum_read_gap_size   = LIBSMDEV_READ_SCHEDULER_DEFAULT_MAXIMUM_GAP_SIZE;
+	internal_handle->streaming_timeout       = LIBSMDEV_OPTICAL_READ_DEFAULT_STREAMING_TIMEOUT;
 
 	*handle = (libsmdev_handle_t *) internal_handle;
 
@@ -329,27 +455,73 @@ int libsmdev_handle_initialize(
 on_error:
 	if( internal_handle != NULL )
 	{
-		if( internal_handle->lead_outs_array != NULL )
+		if( internal_handle->read_ahead != NULL )
+		{
+			libsmdev_read_ahead_free(
+			 &( internal_handle->read_ahead ),
+			 NULL );
+		}
+		if( internal_handle->partition_table != NULL )
+		{
+			libsmdev_partition_table_free(
+			 &( internal_handle->partition_table ),
+			 NULL );
+		}
+		if( internal_handle->transport_profiles_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_handle->transport_profiles_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_handle->sample_regions_array != NULL )
 		{
 			libcdata_array_free(
-			 &( internal_handle->lead_outs_array ),
+			 &( internal_handle->sample_regions_array ),
 			 NULL,
 			 NULL );
 		}
-		if( internal_handle->sessions_array != NULL )
+		if( internal_handle->read_requests_array != NULL )
 		{
 			libcdata_array_free(
-			 &( internal_handle->sessions_array ),
+			 &( internal_handle->read_requests_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_handle->suspect_sectors_range_list != NULL )
+		{
+			libcdata_range_list_free(
+			 &( internal_handle->suspect_sectors_range_list ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_handle->mismatches_range_list != NULL )
+		{
+			libcdata_range_list_free(
+			 &( internal_handle->mismatches_range_list ),
 			 NULL,
 			 NULL );
 		}
-		if( internal_handle->tracks_array != NULL )
+		if( internal_handle->fallback_sources_array != NULL )
 		{
 			libcdata_array_free(
-			 &( internal_handle->tracks_array ),
+			 &( internal_handle->fallback_sources_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_handle->errors_range_list != NULL )
+		{
+			libcdata_range_list_free(
+			 &( internal_handle->errors_range_list ),
 			 NULL,
 			 NULL );
 		}
+		if( internal_handle->table_of_contents != NULL )
+		{
+			libsmdev_table_of_contents_free(
+			 &( internal_handle->table_of_contents ),
+			 NULL );
+		}
 		memory_free(
 		 internal_handle );
 	}
@@ -382,7 +554,7 @@ int libsmdev_handle_free(
 	{
 		internal_handle = (libsmdev_internal_handle_t *) *handle;
 
-		if( internal_handle->device_file != NULL )
+		if( internal_handle->io_backend != NULL )
 		{
 			if( libsmdev_handle_close(
 			     *handle,
@@ -400,50 +572,62 @@ int libsmdev_handle_free(
 		}
 		*handle = NULL;
 
-		if( libcdata_array_free(
-		     &( internal_handle->tracks_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_track_value_free,
+		if( libsmdev_table_of_contents_free(
+		     &( internal_handle->table_of_contents ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free tracks array.",
+			 "%s: unable to free table of contents.",
 			 function );
 
 			result = -1;
 		}
-		if( libcdata_array_free(
-		     &( internal_handle->sessions_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
+		if( libsmdev_geometry_free(
+		     &( internal_handle->geometry ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sessions array.",
+			 "%s: unable to free geometry.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_range_list_free(
+		     &( internal_handle->errors_range_list ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free errors range list.",
 			 function );
 
 			result = -1;
 		}
 		if( libcdata_array_free(
-		     &( internal_handle->lead_outs_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
+		     &( internal_handle->fallback_sources_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_fallback_source_free,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free lead-outs array.",
+			 "%s: unable to free fallback sources array.",
 			 function );
 
 			result = -1;
 		}
 		if( libcdata_range_list_free(
-		     &( internal_handle->errors_range_list ),
+		     &( internal_handle->mismatches_range_list ),
 		     NULL,
 		     error ) != 1 )
 		{
@@ -451,11 +635,111 @@ int libsmdev_handle_free(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free errors range list.",
+			 "%s: unable to free mismatches range list.",
 			 function );
 
 			result = -1;
 		}
+		if( libcdata_range_list_free(
+		     &( internal_handle->suspect_sectors_range_list ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free suspect sectors range list.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_handle->read_requests_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_read_request_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read requests array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_handle->sample_regions_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sample_region_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sample regions array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_handle->transport_profiles_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_transport_profile_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free transport profiles array.",
+			 function );
+
+			result = -1;
+		}
+		if( libsmdev_partition_table_free(
+		     &( internal_handle->partition_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free partition table.",
+			 function );
+
+			result = -1;
+		}
+		if( libsmdev_read_ahead_free(
+		     &( internal_handle->read_ahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead.",
+			 function );
+
+			result = -1;
+		}
+		if( libsmdev_read_speed_free(
+		     &( internal_handle->read_speed ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read speed.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_handle->probe_cache_directory != NULL )
+		{
+			memory_free(
+			 internal_handle->probe_cache_directory );
+		}
 		memory_free(
 		 internal_handle );
 	}
@@ -469,7 +753,8 @@ int libsmdev_handle_signal_abort(
      libsmdev_handle_t *handle,
      libcerror_error_t **error )
 {
-	static char *function = "libsmdev_handle_signal_abort";
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_signal_abort";
 
 	if( handle == NULL )
 	{
@@ -482,28 +767,76 @@ int libsmdev_handle_signal_abort(
 
 		return( -1 );
 	}
-	( (libsmdev_internal_handle_t *) handle )->abort = 1;
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	internal_handle->abort = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( internal_handle->parallel_reader != NULL )
+	{
+		if( libsmdev_parallel_reader_signal_abort(
+		     internal_handle->parallel_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal parallel reader to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( internal_handle->sanitizer != NULL )
+	{
+		if( libsmdev_sanitizer_signal_abort(
+		     internal_handle->sanitizer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal sanitizer to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_handle->sampler != NULL )
+	{
+		if( libsmdev_sampler_signal_abort(
+		     internal_handle->sampler,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal sampler to abort.",
+			 function );
 
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
-/* Opens a storage media device
+/* Probes the storage media device
+ * Determines the media size and bytes per sector and applies the transport profile
  * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_open(
-     libsmdev_handle_t *handle,
-     const char *filename,
-     int access_flags,
+int libsmdev_internal_handle_probe_device(
+     libsmdev_internal_handle_t *internal_handle,
      libcerror_error_t **error )
 {
-	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_open";
-	size64_t media_size                         = 0;
-	size_t filename_length                      = 0;
-	uint32_t bytes_per_sector                   = 0;
-	int result                                  = 0;
+	static char *function     = "libsmdev_internal_handle_probe_device";
+	size64_t media_size       = 0;
+	uint32_t bytes_per_sector = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -514,68 +847,123 @@ int libsmdev_handle_open(
 
 		return( -1 );
 	}
-	internal_handle = (libsmdev_internal_handle_t *) handle;
+	if( internal_handle->device_probed != 0 )
+	{
+		return( 1 );
+	}
+	/* The device is marked as probed before probing
+	 * so that reads made while probing do not probe again
+	 */
+	internal_handle->device_probed = 1;
 
-	if( internal_handle->device_file != NULL )
+	if( libsmdev_handle_get_media_size(
+	     (libsmdev_handle_t *) internal_handle,
+	     &media_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - device file value already set.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( filename == NULL )
+	/* Retrieving the bytes per sector also sets the block size
+	 * of the device file
+	 */
+	if( libsmdev_handle_get_bytes_per_sector(
+	     (libsmdev_handle_t *) internal_handle,
+	     &bytes_per_sector,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes per sector.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libcdata_array_empty(
-	     internal_handle->tracks_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_track_value_free,
+	if( libsmdev_internal_handle_apply_transport_profile(
+	     internal_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty tracks array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to apply transport profile.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcdata_array_empty(
-	     internal_handle->sessions_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
-	     error ) != 1 )
+	return( 1 );
+
+on_error:
+	internal_handle->device_probed = 0;
+
+	return( -1 );
+}
+
+/* Opens a storage media device using an IO backend that has already been opened
+ * The handle takes over management of the IO backend if successful
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_internal_handle_open_io_backend(
+     libsmdev_internal_handle_t *internal_handle,
+     libsmdev_io_backend_t *io_backend,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *device_file = NULL;
+	static char *function        = "libsmdev_internal_handle_open_io_backend";
+	int result                   = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->io_backend != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty sessions array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - IO backend value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_array_empty(
-	     internal_handle->lead_outs_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_table_of_contents_empty(
+	     internal_handle->table_of_contents,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty lead-outs array.",
+		 "%s: unable to empty table of contents.",
 		 function );
 
 		goto on_error;
@@ -594,160 +982,184 @@ int libsmdev_handle_open(
 
 		goto on_error;
 	}
-	filename_length = narrow_string_length(
-	                   filename );
-
-	if( libsmdev_handle_set_filename(
-	     handle,
-	     filename,
-	     filename_length + 1,
+	if( libsmdev_internal_handle_empty_supplied_ranges(
+	     internal_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set filename in handle.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty supplied ranges of fallback sources.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcfile_file_initialize(
-	     &( internal_handle->device_file ),
+	if( libcdata_range_list_empty(
+	     internal_handle->mismatches_range_list,
+	     NULL,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create device file.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty mismatches range list.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcfile_file_open(
-	     internal_handle->device_file,
-	     filename,
-	     access_flags,
+	if( libcdata_range_list_empty(
+	     internal_handle->suspect_sectors_range_list,
+	     NULL,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open device file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty suspect sectors range list.",
 		 function );
 
 		goto on_error;
 	}
-	if( libsmdev_handle_get_media_size(
-	     handle,
-	     &media_size,
-	     error ) != 1 )
+	/* The device specific functions require a device file
+	 * which is only available for the file IO backend
+	 */
+	result = libsmdev_io_backend_get_device_file(
+	          io_backend,
+	          &device_file,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve media size.",
+		 "%s: unable to retrieve device file from IO backend.",
 		 function );
 
 		goto on_error;
 	}
-	/* /dev/rdisk# on Mac OS X and some Windows devices require
-	 * sector aligned read and seek operations
-	 */
-	result = libsmdev_handle_get_bytes_per_sector(
-	          handle,
-	          &bytes_per_sector,
+	internal_handle->io_backend   = io_backend;
+	internal_handle->device_file  = device_file;
+	internal_handle->access_flags = access_flags;
+
+	result = libsmdev_io_control_record_open_from_environment(
 	          error );
 
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve bytes per sector.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open IO control record fixture.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+	internal_handle->io_control_recording = (uint8_t) result;
+
+	/* If probing is deferred the device is probed on first use
+	 */
+	if( ( access_flags & LIBSMDEV_ACCESS_FLAG_DEFER_PROBING ) == 0 )
 	{
-		if( libcfile_file_set_block_size(
-		     internal_handle->device_file,
-		     (size_t) bytes_per_sector,
+		if( libsmdev_internal_handle_probe_device(
+		     internal_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to set block size in device file.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to probe device.",
 			 function );
 
 			goto on_error;
 		}
 	}
-#if !defined( __CYGWIN__ )
-
-	/* Use this function to double the read-ahead system buffer on POSIX system
-	 * This provides for some additional performance
+	/* The read-ahead of the device is tuned when the access pattern is known
+	 * The read-ahead control is only supported by the file IO backend
 	 */
-	if( libcfile_file_set_access_behavior(
-	     internal_handle->device_file,
-	     LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL,
-	     error ) != 1 )
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( ( internal_handle->io_backend_type == LIBSMDEV_IO_BACKEND_TYPE_FILE )
+	 && ( internal_handle->filename != NULL ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set access behavior.",
-		 function );
+		if( libsmdev_read_ahead_open(
+		     internal_handle->read_ahead,
+		     internal_handle->filename,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open read-ahead.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-#endif /* !defined( __CYGWIN__ ) */
+#endif
+	if( internal_handle->read_ahead->configured_access_pattern != LIBSMDEV_ACCESS_PATTERN_AUTOMATIC )
+	{
+		internal_handle->read_ahead->access_pattern = internal_handle->read_ahead->configured_access_pattern;
+
+		if( libsmdev_internal_handle_apply_access_pattern(
+		     internal_handle,
+		     internal_handle->read_ahead->configured_access_pattern,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to apply access pattern.",
+			 function );
 
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
-	if( internal_handle->device_file != NULL )
+	libsmdev_read_ahead_close(
+	 internal_handle->read_ahead,
+	 NULL );
+
+	if( internal_handle->io_control_recording != 0 )
 	{
-		libcfile_file_free(
-		 &( internal_handle->device_file ),
+		libsmdev_io_control_close(
 		 NULL );
-	}
-	if( internal_handle->filename != NULL )
-	{
-		memory_free(
-		 internal_handle->filename );
 
-		internal_handle->filename      = NULL;
-		internal_handle->filename_size = 0;
+		internal_handle->io_control_recording = 0;
 	}
+	internal_handle->io_backend    = NULL;
+	internal_handle->device_file   = NULL;
+	internal_handle->access_flags  = 0;
+	internal_handle->device_probed = 0;
+
 	return( -1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
 /* Opens a storage media device
+ * The device is accessed using the IO backend type set in the handle
+ * If LIBSMDEV_ACCESS_FLAG_DEFER_PROBING is set the device is not probed on open
+ * but on the first read or seek, or when values like the media size are first requested
  * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_open_wide(
+int libsmdev_handle_open(
      libsmdev_handle_t *handle,
-     const wchar_t *filename,
+     const char *filename,
      int access_flags,
      libcerror_error_t **error )
 {
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_open_wide";
-	size64_t media_size                         = 0;
+	libsmdev_io_backend_t *io_backend           = NULL;
+	static char *function                       = "libsmdev_handle_open";
 	size_t filename_length                      = 0;
-	uint32_t bytes_per_sector                   = 0;
-	int result                                  = 0;
 
 	if( handle == NULL )
 	{
@@ -762,13 +1174,13 @@ int libsmdev_handle_open_wide(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( internal_handle->device_file != NULL )
+	if( internal_handle->io_backend != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - device file value already set.",
+		 "%s: invalid handle - IO backend value already set.",
 		 function );
 
 		return( -1 );
@@ -784,66 +1196,10 @@ int libsmdev_handle_open_wide(
 
 		return( -1 );
 	}
-	if( libcdata_array_empty(
-	     internal_handle->tracks_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_track_value_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty tracks array.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdata_array_empty(
-	     internal_handle->sessions_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty sessions array.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdata_array_empty(
-	     internal_handle->lead_outs_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty lead-outs array.",
-		 function );
-
-		goto on_error;
-	}
-	if( libcdata_range_list_empty(
-	     internal_handle->errors_range_list,
-	     NULL,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty errors range list.",
-		 function );
-
-		goto on_error;
-	}
-	filename_length = wide_string_length(
+	filename_length = narrow_string_length(
 	                   filename );
 
-	if( libsmdev_handle_set_filename_wide(
+	if( libsmdev_handle_set_filename(
 	     handle,
 	     filename,
 	     filename_length + 1,
@@ -858,23 +1214,24 @@ int libsmdev_handle_open_wide(
 
 		goto on_error;
 	}
-	if( libcfile_file_initialize(
-	     &( internal_handle->device_file ),
+	if( libsmdev_io_backend_initialize_by_type(
+	     &io_backend,
+	     internal_handle->io_backend_type,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create device file.",
+		 "%s: unable to create IO backend.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcfile_file_open_wide(
-	     internal_handle->device_file,
+	if( libsmdev_io_backend_open(
+	     io_backend,
 	     filename,
-	     access_flags,
+	     access_flags & ~( LIBSMDEV_ACCESS_FLAG_DEFER_PROBING | LIBSMDEV_ACCESS_FLAG_CONCURRENT_TRANSFERS ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -886,84 +1243,28 @@ int libsmdev_handle_open_wide(
 
 		goto on_error;
 	}
-	if( libsmdev_handle_get_media_size(
-	     handle,
-	     &media_size,
+	if( libsmdev_internal_handle_open_io_backend(
+	     internal_handle,
+	     io_backend,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve media size.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle using IO backend.",
 		 function );
 
 		goto on_error;
 	}
-	/* /dev/rdisk# on Mac OS X and some Windows devices require
-	 * sector aligned read and seek operations
-	 */
-	result = libsmdev_handle_get_bytes_per_sector(
-	          handle,
-	          &bytes_per_sector,
-	          error );
+	return( 1 );
 
-	if( result == -1 )
+on_error:
+	if( io_backend != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve bytes per sector.",
-		 function );
-
-		goto on_error;
-	}
-	else if( result != 0 )
-	{
-		if( libcfile_file_set_block_size(
-		     internal_handle->device_file,
-		     (size_t) bytes_per_sector,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to set block size in device file.",
-			 function );
-
-			goto on_error;
-		}
-	}
-#if !defined( __CYGWIN__ )
-
-	/* Use this function to double the read-ahead system buffer on POSIX system
-	 * This provides for some additional performance
-	 */
-	if( libcfile_file_set_access_behavior(
-	     internal_handle->device_file,
-	     LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set access behavior.",
-		 function );
-
-		goto on_error;
-	}
-#endif /* !defined( __CYGWIN__ ) */
-
-	return( 1 );
-
-on_error:
-	if( internal_handle->device_file != NULL )
-	{
-		libcfile_file_free(
-		 &( internal_handle->device_file ),
+		libsmdev_io_backend_free(
+		 &io_backend,
 		 NULL );
 	}
 	if( internal_handle->filename != NULL )
@@ -977,18 +1278,24 @@ on_error:
 	return( -1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
 
-/* Closes a device handle
- * Returns the 0 if succesful or -1 on error
+/* Opens a storage media device
+ * The device is accessed using the IO backend type set in the handle
+ * If LIBSMDEV_ACCESS_FLAG_DEFER_PROBING is set the device is not probed on open
+ * but on the first read or seek, or when values like the media size are first requested
+ * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_close(
+int libsmdev_handle_open_wide(
      libsmdev_handle_t *handle,
+     const wchar_t *filename,
+     int access_flags,
      libcerror_error_t **error )
 {
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_close";
-	int result                                  = 0;
+	libsmdev_io_backend_t *io_backend           = NULL;
+	static char *function                       = "libsmdev_handle_open_wide";
+	size_t filename_length                      = 0;
 
 	if( handle == NULL )
 	{
@@ -1003,176 +1310,140 @@ int libsmdev_handle_close(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( internal_handle->device_file != NULL )
-	{
-		if( libcfile_file_close(
-		     internal_handle->device_file,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close device file.",
-			 function );
-
-			result = -1;
-		}
-		if( libcfile_file_free(
-		     &( internal_handle->device_file ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free device file.",
-			 function );
-
-			result = -1;
-		}
-	}
-	internal_handle->offset                = 0;
-	internal_handle->bytes_per_sector      = 0;
-	internal_handle->bytes_per_sector_set  = 0;
-	internal_handle->media_size            = 0;
-	internal_handle->media_size_set        = 0;
-	internal_handle->bus_type              = 0;
-	internal_handle->device_type           = 0;
-	internal_handle->removable             = 0;
-	internal_handle->media_information_set = 0;
-
-	if( memory_set(
-	     internal_handle->vendor,
-	     0,
-	     64 ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear vendor string.",
-		 function );
-
-		result = -1;
-	}
-	if( memory_set(
-	     internal_handle->model,
-	     0,
-	     64 ) == NULL )
+	if( internal_handle->io_backend != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear model string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - IO backend value already set.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( memory_set(
-	     internal_handle->serial_number,
-	     0,
-	     64 ) == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear serial number string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( internal_handle->filename != NULL )
-	{
-		memory_free(
-		 internal_handle->filename );
+	filename_length = wide_string_length(
+	                   filename );
 
-		internal_handle->filename = NULL;
-	}
-	if( libcdata_array_empty(
-	     internal_handle->tracks_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_track_value_free,
+	if( libsmdev_handle_set_filename_wide(
+	     handle,
+	     filename,
+	     filename_length + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty tracks array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libcdata_array_empty(
-	     internal_handle->sessions_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
+	if( libsmdev_io_backend_initialize_by_type(
+	     &io_backend,
+	     internal_handle->io_backend_type,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty sessions array.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO backend.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libcdata_array_empty(
-	     internal_handle->lead_outs_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
+	if( libsmdev_io_backend_open_wide(
+	     io_backend,
+	     filename,
+	     access_flags & ~( LIBSMDEV_ACCESS_FLAG_DEFER_PROBING | LIBSMDEV_ACCESS_FLAG_CONCURRENT_TRANSFERS ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty lead-outs array.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open device file.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libcdata_range_list_empty(
-	     internal_handle->errors_range_list,
-	     NULL,
+	if( libsmdev_internal_handle_open_io_backend(
+	     internal_handle,
+	     io_backend,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty errors range list.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle using IO backend.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	return( result );
+	return( 1 );
+
+on_error:
+	if( io_backend != NULL )
+	{
+		libsmdev_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	if( internal_handle->filename != NULL )
+	{
+		memory_free(
+		 internal_handle->filename );
+
+		internal_handle->filename      = NULL;
+		internal_handle->filename_size = 0;
+	}
+	return( -1 );
 }
 
-/* Reads a buffer
- * Returns the number of bytes read or -1 on error
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a composite of storage media devices
+ * The member handles must be open and remain open while the handle is open
+ * The IO backends of the member handles are read directly, the member handles
+ * should not be read themselves while the handle is open
+ * The striped layout distributes the stripes over the member handles in the order of the array,
+ * the stripe size must be a multiple of the largest bytes per sector of the member handles
+ * The concatenated layout appends the member handles in the order of the array and ignores the stripe size
+ * Only read access is supported
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libsmdev_handle_read_buffer(
-         libsmdev_handle_t *handle,
-         uint8_t *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libsmdev_handle_open_composite(
+     libsmdev_handle_t *handle,
+     libsmdev_handle_t **member_handles,
+     int number_of_member_handles,
+     int layout,
+     size_t stripe_size,
+     int access_flags,
+     libcerror_error_t **error )
 {
-	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_read_buffer";
-	size_t buffer_offset                        = 0;
-	size_t error_granularity_buffer_offset      = 0;
-	size_t error_granularity_size               = 0;
-	size_t error_granularity_skip_size          = 0;
-	size_t read_error_size                      = 0;
-	size_t read_size                            = 0;
-	ssize_t read_count                          = 0;
-	off64_t calculated_current_offset           = 0;
-	off64_t current_offset                      = 0;
-	uint32_t error_code                         = 0;
-	int16_t number_of_read_errors               = 0;
-	int result                                  = 0;
+	libsmdev_composite_t *composite                    = NULL;
+	libsmdev_internal_handle_t *internal_handle        = NULL;
+	libsmdev_internal_handle_t *internal_member_handle = NULL;
+	libsmdev_io_backend_t *io_backend                  = NULL;
+	static char *function                              = "libsmdev_handle_open_composite";
+	size64_t media_size                                = 0;
+	uint32_t bytes_per_sector                          = 0;
+	int member_handle_index                            = 0;
+	int result                                         = 0;
 
 	if( handle == NULL )
 	{
@@ -1187,472 +1458,8326 @@ ssize_t libsmdev_handle_read_buffer(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( internal_handle->device_file == NULL )
+	if( internal_handle->io_backend != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing device file.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - IO backend value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer == NULL )
+	if( member_handles == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid buffer.",
+		 "%s: invalid member handles.",
 		 function );
 
 		return( -1 );
 	}
-	if( buffer_size > (size_t) SSIZE_MAX )
+	if( ( number_of_member_handles <= 0 )
+	 || ( number_of_member_handles > LIBSMDEV_COMPOSITE_MAXIMUM_NUMBER_OF_MEMBERS ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid buffer size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of member handles value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	read_size = buffer_size;
+	if( ( ( access_flags & LIBSMDEV_ACCESS_FLAG_READ ) == 0 )
+	 || ( ( access_flags & LIBSMDEV_ACCESS_FLAG_WRITE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags: 0x%02x, only read access is supported.",
+		 function,
+		 access_flags );
 
-	if( internal_handle->media_size != 0 )
+		return( -1 );
+	}
+	if( libsmdev_composite_initialize_io_backend(
+	     &io_backend,
+	     &composite,
+	     error ) != 1 )
 	{
-		if( internal_handle->offset >= (off64_t) internal_handle->media_size )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create composite IO backend.",
+		 function );
+
+		goto on_error;
+	}
+	for( member_handle_index = 0;
+	     member_handle_index < number_of_member_handles;
+	     member_handle_index++ )
+	{
+		internal_member_handle = (libsmdev_internal_handle_t *) member_handles[ member_handle_index ];
+
+		if( internal_member_handle == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: offset exceeds media size.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid member handle: %d.",
+			 function,
+			 member_handle_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( ( internal_handle->offset + (off64_t) read_size ) > (off64_t) internal_handle->media_size )
+		if( internal_member_handle == internal_handle )
 		{
-			read_size = (size_t) ( internal_handle->media_size - internal_handle->offset );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid member handle: %d - cannot be the handle itself.",
+			 function,
+			 member_handle_index );
+
+			goto on_error;
 		}
-	}
-	while( number_of_read_errors <= (int16_t) internal_handle->number_of_error_retries )
-	{
-		if( internal_handle->abort != 0 )
+		if( internal_member_handle->io_backend == NULL )
 		{
-			break;
-		}
-		if( read_size == 0 )
-		{
-			break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid member handle: %d - not open.",
+			 function,
+			 member_handle_index );
+
+			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libsmdev_handle_get_media_size(
+		     member_handles[ member_handle_index ],
+		     &media_size,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "%s: reading buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd ".\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve media size of member handle: %d.",
 			 function,
-			 internal_handle->offset + (off64_t) buffer_offset,
-			 internal_handle->offset + (off64_t) buffer_offset,
-			 read_size );
+			 member_handle_index );
+
+			goto on_error;
 		}
-#endif
-		read_count = libcfile_file_read_buffer_with_error_code(
-			      internal_handle->device_file,
-			      &( buffer[ buffer_offset ] ),
-			      read_size,
-			      &error_code,
-		              error );
+		result = libsmdev_handle_get_bytes_per_sector(
+		          member_handles[ member_handle_index ],
+		          &bytes_per_sector,
+		          error );
 
-		if( read_count == -1 )
+		if( result == -1 )
 		{
-#if !defined( WINAPI )
-			if( error_code == EIO )
-			{
-				/* Determine if the device file is still valid, in case removable media is removed
-				 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libcfile_file_exists_wide(
-				          internal_handle->filename,
-				          NULL );
-#else
-				result = libcfile_file_exists(
-				          internal_handle->filename,
-				          NULL );
-#endif
-				if( result != 1 )
-				{
-					error_code = ENODEV;
-				}
-			}
-#endif /* !defined( WINAPI ) */
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bytes per sector of member handle: %d.",
+			 function,
+			 member_handle_index );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") with error code: %" PRIu32 ".\n",
-				 function,
-				 internal_handle->offset + (off64_t) buffer_offset,
-				 internal_handle->offset + (off64_t) buffer_offset,
-				 error_code );
-			}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			bytes_per_sector = 0;
+		}
+		if( libsmdev_composite_append_member(
+		     composite,
+		     internal_member_handle->io_backend,
+		     media_size,
+		     bytes_per_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append member handle: %d to composite.",
+			 function,
+			 member_handle_index );
 
-			switch( error_code )
-			{
-#if defined( WINAPI )
-				default:
-#else
-				/* Reading should not be retried for some POSIX error conditions
-				 */
-				case ESPIPE:
-				case EPERM:
-				case ENXIO:
-				case ENODEV:
-#endif
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_OPEN_FAILED,
-					 "%s: unable to read from device file.",
-					 function );
+			goto on_error;
+		}
+	}
+	if( libsmdev_composite_open(
+	     composite,
+	     layout,
+	     stripe_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open composite.",
+		 function );
 
-					return( -1 );
+		goto on_error;
+	}
+	if( libsmdev_internal_handle_open_io_backend(
+	     internal_handle,
+	     io_backend,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open handle using IO backend.",
+		 function );
 
-#if defined( WINAPI )
-				/* A WINAPI read error generates the error code ERROR_UNRECOGNIZED_MEDIA
-				 */
-				case ERROR_UNRECOGNIZED_MEDIA:
-#else
-				default:
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: error reading from device file.\n",
-						 function );
+		goto on_error;
+	}
+	return( 1 );
 
-						if( ( error != NULL )
-						 && ( *error != NULL ) )
-						{
-					                libcnotify_print_error_backtrace(
-					                 *error );
-						}
-					}
-#endif
-                			libcerror_error_free(
-		        	         error );
+on_error:
+	if( io_backend != NULL )
+	{
+		libsmdev_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	return( -1 );
+}
 
-					current_offset = libcfile_file_seek_offset(
-							  internal_handle->device_file,
-							  0,
-							  SEEK_CUR,
-							  error );
+/* Retrieves the member handle and the offset within the member handle of an offset in a composite
+ * The member handle is identified by its index in the array the composite was opened with
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_composite_member_offset(
+     libsmdev_handle_t *handle,
+     off64_t offset,
+     int *member_handle_index,
+     off64_t *member_offset,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_composite_member_offset";
 
-					if( current_offset == -1 )
-					{
-						libcerror_system_set_error(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_IO,
-						 LIBCERROR_IO_ERROR_SEEK_FAILED,
-						 errno,
-						 "%s: unable to seek current offset.",
-						 function );
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-						return( -1 );
-					}
-					calculated_current_offset = internal_handle->offset + (off64_t) buffer_offset;
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-					/* On MacOS-X the read count can be -1 on error and the file offset is set to the position of the error
-					 */
-					if( current_offset != calculated_current_offset )
-					{
-#if defined( HAVE_VERBOSE_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: correcting offset drift (actual: %" PRIi64 ", calculated: %" PRIi64 ").\n",
-							 function,
-							 current_offset,
-							 calculated_current_offset );
-						}
-#endif
-						if( current_offset < calculated_current_offset )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: unable to to correct negative offset drift.",
-							 function );
+	if( ( internal_handle->io_backend == NULL )
+	 || ( internal_handle->io_backend->type != LIBSMDEV_IO_BACKEND_TYPE_COMPOSITE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid handle - not opened as composite.",
+		 function );
 
-							return( -1 );
-						}
-						read_count = (ssize_t) ( current_offset - calculated_current_offset );
-					}
-					break;
+		return( -1 );
+	}
+	if( libsmdev_composite_get_member_offset(
+	     (libsmdev_composite_t *) internal_handle->io_backend->io_handle,
+	     offset,
+	     member_handle_index,
+	     member_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve member offset of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes a device handle
+ * Returns the 0 if succesful or -1 on error
+ */
+int libsmdev_handle_close(
+     libsmdev_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_close";
+	int result                                  = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( internal_handle->parallel_reader != NULL )
+	{
+		if( libsmdev_parallel_reader_free(
+		     &( internal_handle->parallel_reader ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free parallel reader.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	if( internal_handle->write_engine != NULL )
+	{
+		if( internal_handle->write_flush_policy != LIBSMDEV_WRITE_FLUSH_POLICY_NONE )
+		{
+			if( libsmdev_write_engine_flush(
+			     internal_handle->write_engine,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush write engine.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else
+		{
+			if( libsmdev_write_engine_drain(
+			     internal_handle->write_engine,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to drain write engine.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libsmdev_write_engine_free(
+		     &( internal_handle->write_engine ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free write engine.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* Restores the original read-ahead window of the device
+	 */
+	if( libsmdev_read_ahead_close(
+	     internal_handle->read_ahead,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close read-ahead.",
+		 function );
+
+		result = -1;
+	}
+	/* Restores the default speed of an optical drive
+	 */
+	if( libsmdev_optical_read_restore_speed(
+	     internal_handle,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to restore read speed.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_handle->io_backend != NULL )
+	{
+		if( libsmdev_io_backend_close(
+		     internal_handle->io_backend,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close IO backend.",
+			 function );
+
+			result = -1;
+		}
+		if( libsmdev_io_backend_free(
+		     &( internal_handle->io_backend ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO backend.",
+			 function );
+
+			result = -1;
+		}
+		internal_handle->device_file = NULL;
+	}
+	if( internal_handle->io_control_recording != 0 )
+	{
+		if( libsmdev_io_control_close(
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close IO control record fixture.",
+			 function );
+
+			result = -1;
+		}
+		internal_handle->io_control_recording = 0;
+	}
+	if( libsmdev_geometry_free(
+	     &( internal_handle->geometry ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free geometry.",
+		 function );
+
+		result = -1;
+	}
+	internal_handle->offset                    = 0;
+	internal_handle->bytes_per_sector          = 0;
+	internal_handle->bytes_per_sector_set      = 0;
+	internal_handle->media_size                = 0;
+	internal_handle->media_size_set            = 0;
+	internal_handle->bus_type                  = 0;
+	internal_handle->device_type               = 0;
+	internal_handle->removable                 = 0;
+	internal_handle->media_information_set     = 0;
+	internal_handle->table_of_contents_set     = 0;
+	internal_handle->usb_link_speed            = 0;
+	internal_handle->usb_protocol              = 0;
+	internal_handle->usb_maximum_transfer_size = 0;
+	internal_handle->usb_attached              = 0;
+	internal_handle->usb_information_set       = 0;
+	internal_handle->maximum_transfer_size     = 0;
+	internal_handle->write_zeroes_method       = LIBSMDEV_WRITE_ZEROES_METHOD_UNKNOWN;
+	internal_handle->access_flags              = 0;
+	internal_handle->device_probed             = 0;
+
+	if( memory_set(
+	     internal_handle->vendor,
+	     0,
+	     64 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear vendor string.",
+		 function );
+
+		result = -1;
+	}
+	if( memory_set(
+	     internal_handle->model,
+	     0,
+	     64 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear model string.",
+		 function );
+
+		result = -1;
+	}
+	if( memory_set(
+	     internal_handle->serial_number,
+	     0,
+	     64 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear serial number string.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_handle->filename != NULL )
+	{
+		memory_free(
+		 internal_handle->filename );
+
+		internal_handle->filename = NULL;
+	}
+	if( libsmdev_table_of_contents_empty(
+	     internal_handle->table_of_contents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty table of contents.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_range_list_empty(
+	     internal_handle->errors_range_list,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty errors range list.",
+		 function );
+
+		result = -1;
+	}
+	if( libsmdev_internal_handle_empty_supplied_ranges(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty supplied ranges of fallback sources.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Reads a buffer using the parallel reader
+ * The parallel reader is created on first use
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_internal_handle_read_buffer_parallel(
+         libsmdev_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function     = "libsmdev_internal_handle_read_buffer_parallel";
+	uint64_t alignment_offset = 0;
+	ssize_t read_count        = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->device_probed == 0 )
+	{
+		if( libsmdev_internal_handle_probe_device(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to probe device.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_handle->offset >= (off64_t) internal_handle->media_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: offset exceeds media size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	if( internal_handle->parallel_reader == NULL )
+	{
+		if( libsmdev_parallel_reader_initialize(
+		     &( internal_handle->parallel_reader ),
+		     internal_handle->number_of_read_threads,
+		     internal_handle->read_stripe_size,
+		     internal_handle->media_size,
+		     internal_handle->number_of_error_retries,
+		     internal_handle->error_granularity,
+		     internal_handle->error_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create parallel reader.",
+			 function );
+
+			goto on_error;
+		}
+		/* The stripes are aligned with the physical sectors if the geometry was determined
+		 */
+		if( ( internal_handle->geometry != NULL )
+		 && ( internal_handle->geometry->physical_bytes_per_sector > 0 ) )
+		{
+			if( libsmdev_geometry_get_alignment_offset(
+			     internal_handle->geometry,
+			     &alignment_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve alignment offset.",
+				 function );
+
+				goto on_error;
+			}
+			if( libsmdev_parallel_reader_set_alignment_offset(
+			     internal_handle->parallel_reader,
+			     (off64_t) alignment_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set alignment offset of parallel reader.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libsmdev_parallel_reader_open(
+		     internal_handle->parallel_reader,
+		     internal_handle->io_backend_type,
+		     internal_handle->filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open parallel reader.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	read_count = libsmdev_parallel_reader_read_buffer(
+	              internal_handle->parallel_reader,
+	              internal_handle->offset,
+	              buffer,
+	              buffer_size,
+	              internal_handle->errors_range_list,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data of the ranges that could not be read is read from the fallback sources
+	 */
+	if( libsmdev_internal_handle_read_errors_from_fallback_sources(
+	     internal_handle,
+	     buffer,
+	     (size_t) read_count,
+	     internal_handle->offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read errors from fallback sources.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->offset += (off64_t) read_count;
+
+	/* Keep the offset of the IO backend in sync for subsequent writes
+	 */
+	if( libsmdev_io_backend_seek_offset(
+	     internal_handle->io_backend,
+	     internal_handle->offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 internal_handle->offset,
+		 internal_handle->offset );
+
+		return( -1 );
+	}
+	return( read_count );
+
+on_error:
+	if( internal_handle->parallel_reader != NULL )
+	{
+		libsmdev_parallel_reader_free(
+		 &( internal_handle->parallel_reader ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Applies an access pattern to the device
+ * Sequential access uses a large read-ahead window, random access disables read-ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_internal_handle_apply_access_pattern(
+     libsmdev_internal_handle_t *internal_handle,
+     int access_pattern,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_internal_handle_apply_access_pattern";
+
+#if !defined( __CYGWIN__ )
+	int access_behavior   = 0;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( __CYGWIN__ )
+	/* Access behavior is only supported by the file IO backend
+	 */
+	if( internal_handle->device_file != NULL )
+	{
+		if( access_pattern == LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL )
+		{
+			access_behavior = LIBCFILE_ACCESS_BEHAVIOR_SEQUENTIAL;
+		}
+		else if( access_pattern == LIBSMDEV_ACCESS_PATTERN_RANDOM )
+		{
+			access_behavior = LIBCFILE_ACCESS_BEHAVIOR_RANDOM;
+		}
+		else
+		{
+			access_behavior = LIBCFILE_ACCESS_BEHAVIOR_NORMAL;
+		}
+		if( libcfile_file_set_access_behavior(
+		     internal_handle->device_file,
+		     access_behavior,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set access behavior.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* !defined( __CYGWIN__ ) */
+
+	/* The read-ahead window of the device is only changed if permitted
+	 */
+	if( libsmdev_read_ahead_set_window(
+	     internal_handle->read_ahead,
+	     access_pattern,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read-ahead window.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: access pattern: %s.\n",
+		 function,
+		 ( access_pattern == LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL ) ? "sequential" : ( ( access_pattern == LIBSMDEV_ACCESS_PATTERN_RANDOM ) ? "random" : "automatic" ) );
+	}
+#endif
+	return( 1 );
+}
+
+/* Updates the access pattern with a read of a specific size at a specific offset
+ * The access pattern is applied to the device when it changes and data consumed
+ * by sequential reads is dropped from the page cache
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_internal_handle_update_access_pattern(
+     libsmdev_internal_handle_t *internal_handle,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_internal_handle_update_access_pattern";
+	int result            = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsmdev_read_ahead_update(
+	          internal_handle->read_ahead,
+	          offset,
+	          size );
+
+	if( result != 0 )
+	{
+		if( libsmdev_internal_handle_apply_access_pattern(
+		     internal_handle,
+		     internal_handle->read_ahead->access_pattern,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to apply access pattern.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libsmdev_read_ahead_drop_behind(
+	     internal_handle->read_ahead,
+	     offset,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to drop consumed data from page cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_handle_read_buffer(
+         libsmdev_handle_t *handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_read_buffer";
+	size_t buffer_offset                        = 0;
+	size_t error_granularity_buffer_offset      = 0;
+	size_t error_granularity_size               = 0;
+	size_t error_granularity_skip_size          = 0;
+	size_t read_error_size                      = 0;
+	size_t read_size                            = 0;
+	ssize_t read_count                          = 0;
+	off64_t calculated_current_offset           = 0;
+	off64_t current_offset                      = 0;
+	uint32_t error_code                         = 0;
+	int16_t number_of_read_errors               = 0;
+	int result                                  = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->device_probed == 0 )
+	{
+		if( libsmdev_internal_handle_probe_device(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to probe device.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_handle_drain_write_engine(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to drain write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_handle_update_access_pattern(
+	     internal_handle,
+	     internal_handle->offset,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update access pattern.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Additional read threads require their own IO backend on the storage media device
+	 * a composite IO backend reads its members concurrently instead
+	 */
+	if( ( internal_handle->number_of_read_threads > 1 )
+	 && ( internal_handle->media_size != 0 )
+	 && ( internal_handle->filename != NULL ) )
+	{
+		read_count = libsmdev_internal_handle_read_buffer_parallel(
+		              internal_handle,
+		              buffer,
+		              buffer_size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer using parallel reader.",
+			 function );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+#endif
+	read_size = buffer_size;
+
+	if( internal_handle->media_size != 0 )
+	{
+		if( internal_handle->offset >= (off64_t) internal_handle->media_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: offset exceeds media size.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( internal_handle->offset + (off64_t) read_size ) > (off64_t) internal_handle->media_size )
+		{
+			read_size = (size_t) ( internal_handle->media_size - internal_handle->offset );
+		}
+	}
+	while( number_of_read_errors <= (int16_t) internal_handle->number_of_error_retries )
+	{
+		if( internal_handle->abort != 0 )
+		{
+			break;
+		}
+		if( read_size == 0 )
+		{
+			break;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd ".\n",
+			 function,
+			 internal_handle->offset + (off64_t) buffer_offset,
+			 internal_handle->offset + (off64_t) buffer_offset,
+			 read_size );
+		}
+#endif
+		read_count = libsmdev_io_backend_read_buffer(
+			      internal_handle->io_backend,
+			      &( buffer[ buffer_offset ] ),
+			      read_size,
+			      &error_code,
+		              error );
+
+		if( read_count == -1 )
+		{
+#if !defined( WINAPI )
+			if( ( error_code == EIO )
+			 && ( internal_handle->device_file != NULL ) )
+			{
+				/* Determine if the device file is still valid, in case removable media is removed
+				 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				result = libcfile_file_exists_wide(
+				          internal_handle->filename,
+				          NULL );
+#else
+				result = libcfile_file_exists(
+				          internal_handle->filename,
+				          NULL );
+#endif
+				if( result != 1 )
+				{
+					error_code = ENODEV;
+				}
+			}
+#endif /* !defined( WINAPI ) */
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") with error code: %" PRIu32 ".\n",
+				 function,
+				 internal_handle->offset + (off64_t) buffer_offset,
+				 internal_handle->offset + (off64_t) buffer_offset,
+				 error_code );
+			}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+			switch( error_code )
+			{
+#if defined( WINAPI )
+				default:
+#else
+				/* Reading should not be retried for some POSIX error conditions
+				 */
+				case ESPIPE:
+				case EPERM:
+				case ENXIO:
+				case ENODEV:
+#endif
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_OPEN_FAILED,
+					 "%s: unable to read from device file.",
+					 function );
+
+					return( -1 );
+
+#if defined( WINAPI )
+				/* A WINAPI read error generates the error code ERROR_UNRECOGNIZED_MEDIA
+				 */
+				case ERROR_UNRECOGNIZED_MEDIA:
+#else
+				default:
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: error reading from device file.\n",
+						 function );
+
+						if( ( error != NULL )
+						 && ( *error != NULL ) )
+						{
+					                libcnotify_print_error_backtrace(
+					                 *error );
+						}
+					}
+#endif
+                			libcerror_error_free(
+		        	         error );
+
+					current_offset = libsmdev_io_backend_seek_offset(
+							  internal_handle->io_backend,
+							  0,
+							  SEEK_CUR,
+							  error );
+
+					if( current_offset == -1 )
+					{
+						libcerror_system_set_error(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_SEEK_FAILED,
+						 errno,
+						 "%s: unable to seek current offset.",
+						 function );
+
+						return( -1 );
+					}
+					calculated_current_offset = internal_handle->offset + (off64_t) buffer_offset;
+
+					/* On MacOS-X the read count can be -1 on error and the file offset is set to the position of the error
+					 */
+					if( current_offset != calculated_current_offset )
+					{
+#if defined( HAVE_VERBOSE_OUTPUT )
+						if( libcnotify_verbose != 0 )
+						{
+							libcnotify_printf(
+							 "%s: correcting offset drift (actual: %" PRIi64 ", calculated: %" PRIi64 ").\n",
+							 function,
+							 current_offset,
+							 calculated_current_offset );
+						}
+#endif
+						if( current_offset < calculated_current_offset )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: unable to to correct negative offset drift.",
+							 function );
+
+							return( -1 );
+						}
+						read_count = (ssize_t) ( current_offset - calculated_current_offset );
+					}
+					break;
+
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		else if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd ".\n",
+			 function,
+			 internal_handle->offset + (off64_t) buffer_offset,
+			 internal_handle->offset + (off64_t) buffer_offset,
+			 read_count );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		if( read_count > (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid read count value exceeds read size.",
+			 function );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			return( 0 );
+		}
+		else if( read_count > 0 )
+		{
+			buffer_offset += read_count;
+			read_size     -= read_count;
+
+			if( read_size == 0 )
+			{
+				break;
+			}
+			/* A short read stops at the offset of the data that could not be read
+			 */
+			current_offset = internal_handle->offset + (off64_t) buffer_offset;
+		}
+		/* Not all requested data was read or there was an error
+		 */
+		number_of_read_errors++;
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: read error: %" PRIi16 " at offset %" PRIi64 ".\n",
+			 function,
+			 number_of_read_errors,
+			 internal_handle->offset + buffer_offset );
+		}
+#endif
+		if( number_of_read_errors > (int16_t) internal_handle->number_of_error_retries )
+		{
+			if( internal_handle->error_granularity > 0 )
+			{
+				error_granularity_size = internal_handle->error_granularity;
+			}
+			else
+			{
+				error_granularity_size = buffer_size;
+			}
+			error_granularity_buffer_offset = ( buffer_offset / error_granularity_size ) * error_granularity_size;
+			error_granularity_skip_size     = ( error_granularity_buffer_offset + error_granularity_size ) - buffer_offset;
+
+			/* Check if error granularity skip is still within range of the buffer
+			 */
+			if( error_granularity_skip_size > read_size )
+			{
+				error_granularity_skip_size = read_size;
+			}
+			/* The data that could not be read is read from the fallback sources before it is zero-ed
+			 */
+			result = libsmdev_internal_handle_read_from_fallback_sources(
+			          internal_handle,
+			          &( buffer[ buffer_offset ] ),
+			          error_granularity_skip_size,
+			          internal_handle->offset + (off64_t) buffer_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer from fallback sources.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				read_error_size = error_granularity_skip_size;
+			}
+			else if( ( internal_handle->error_flags & LIBSMDEV_ERROR_FLAG_ZERO_ON_ERROR ) != 0 )
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: zero-ing buffer of size: %" PRIzd " bytes at offset %" PRIzd ".\n",
+					 function,
+					 error_granularity_size,
+					 error_granularity_buffer_offset );
+				}
+#endif
+				if( memory_set(
+				     &( buffer[ error_granularity_buffer_offset ] ),
+				     0,
+				     error_granularity_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to zero buffer on error.",
+					 function );
+
+					return( -1 );
+				}
+				read_error_size = error_granularity_size;
+			}
+			else
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: zero-ing remainder of buffer of size: %" PRIzd " bytes at offset %" PRIzd ".\n",
+					 function,
+					 error_granularity_skip_size,
+					 buffer_offset );
+				}
+#endif
+				if( memory_set(
+				     &( buffer[ buffer_offset ] ),
+				     0,
+				     error_granularity_skip_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to zero remainder of buffer on error.",
+					 function );
+
+					return( -1 );
+				}
+				read_error_size = error_granularity_skip_size;
+			}
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: adding read error at offset: %" PRIi64 " (0x%08" PRIx64 "), number of bytes: %" PRIzd ".\n",
+				 function,
+				 current_offset,
+				 current_offset,
+				 read_error_size );
+			}
+#endif
+			result = libcdata_range_list_insert_range(
+			          internal_handle->errors_range_list,
+			          (uint64_t) current_offset,
+			          (uint64_t) read_error_size,
+			          NULL,
+			          NULL,
+			          NULL,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert read error to range list.",
+				 function );
+
+				return( -1 );
+			}
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: skipping %" PRIu32 " bytes.\n",
+				 function,
+				 error_granularity_skip_size );
+			}
+#endif
+			if( libsmdev_io_backend_seek_offset(
+			     internal_handle->io_backend,
+			     error_granularity_skip_size,
+			     SEEK_CUR,
+			     error ) == -1 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 errno,
+				 "%s: unable to skip %" PRIu32 " bytes after read error.",
+				 function,
+				 error_granularity_skip_size );
+
+				return( -1 );
+			}
+			read_size            -= error_granularity_skip_size;
+			buffer_offset        += error_granularity_skip_size;
+			number_of_read_errors = 0;
+		}
+	}
+	internal_handle->offset += buffer_offset;
+
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads a buffer at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_handle_read_buffer_at_offset(
+         libsmdev_handle_t *handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_handle_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( libsmdev_handle_seek_offset(
+	     handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libsmdev_handle_read_buffer(
+	              handle,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Copies a range of the (media) data to a file descriptor
+ * The data is written at the current offset of the file descriptor
+ * Read errors are handled as by libsmdev_handle_read_buffer
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libsmdev_handle_copy_to_file_descriptor(
+     libsmdev_handle_t *handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_copy_to_file_descriptor";
+	size64_t copied_size                        = 0;
+	int result                                  = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->media_size != 0 )
+	 && ( ( (size64_t) offset > internal_handle->media_size )
+	  ||  ( size > ( internal_handle->media_size - (size64_t) offset ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	if( libsmdev_internal_handle_drain_write_engine(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to drain write engine.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBSMDEV_HAVE_COPY_IN_KERNEL )
+	/* The parallel reader is preferred over an in kernel copy when configured
+	 */
+	if( ( internal_handle->io_backend_type == LIBSMDEV_IO_BACKEND_TYPE_FILE )
+	 && ( internal_handle->number_of_read_threads <= 1 ) )
+	{
+		result = libsmdev_copy_range_in_kernel(
+		          internal_handle,
+		          file_descriptor,
+		          offset,
+		          size,
+		          &copied_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to copy range in kernel.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_handle->abort != 0 )
+		{
+			return( 0 );
+		}
+		offset += (off64_t) copied_size;
+		size   -= copied_size;
+
+		if( size == 0 )
+		{
+			if( libsmdev_handle_seek_offset(
+			     handle,
+			     offset,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek offset.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+#endif /* defined( LIBSMDEV_HAVE_COPY_IN_KERNEL ) */
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	result = libsmdev_copy_range_pipelined(
+	          internal_handle,
+	          file_descriptor,
+	          offset,
+	          size,
+	          error );
+#else
+	result = libsmdev_copy_range_buffered(
+	          internal_handle,
+	          file_descriptor,
+	          offset,
+	          size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to copy range.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Verifies a range of the (media) data against reference data read from a file descriptor
+ * The reference data is read from the current offset of the file descriptor
+ * Sectors that differ are stored as mismatches, except for the parts that overlap
+ * with read/write errors, since these are expected to differ
+ * Read errors are handled as by libsmdev_handle_read_buffer
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libsmdev_handle_verify_with_file_descriptor(
+     libsmdev_handle_t *handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_verify_with_file_descriptor";
+	int result                                  = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->media_size != 0 )
+	 && ( ( (size64_t) offset > internal_handle->media_size )
+	  ||  ( size > ( internal_handle->media_size - (size64_t) offset ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_handle_drain_write_engine(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to drain write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_empty(
+	     internal_handle->mismatches_range_list,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty mismatches range list.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	result = libsmdev_verify_range_pipelined(
+	          internal_handle,
+	          file_descriptor,
+	          offset,
+	          size,
+	          error );
+#else
+	result = libsmdev_verify_range_buffered(
+	          internal_handle,
+	          file_descriptor,
+	          offset,
+	          size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to verify range.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Appends a read request
+ * The read requests are read by libsmdev_handle_read_requests
+ * A higher priority value indicates the request is read earlier
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_append_read_request(
+     libsmdev_handle_t *handle,
+     off64_t offset,
+     size64_t size,
+     int priority,
+     int *request_index,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	libsmdev_read_request_t *read_request       = NULL;
+	static char *function                       = "libsmdev_handle_append_read_request";
+	int entry_index                             = 0;
+	int number_of_read_requests                 = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size64_t) ( INT64_MAX - offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( request_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->read_requests_array,
+	     &number_of_read_requests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of read requests.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_read_request_initialize(
+	     &read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read request.",
+		 function );
+
+		goto on_error;
+	}
+	read_request->offset        = offset;
+	read_request->size          = size;
+	read_request->priority      = priority;
+	read_request->request_index = number_of_read_requests;
+
+	if( libcdata_array_append_entry(
+	     internal_handle->read_requests_array,
+	     &entry_index,
+	     (intptr_t *) read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append read request to array.",
+		 function );
+
+		goto on_error;
+	}
+	*request_index = number_of_read_requests;
+
+	return( 1 );
+
+on_error:
+	if( read_request != NULL )
+	{
+		libsmdev_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of read requests
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_number_of_read_requests(
+     libsmdev_handle_t *handle,
+     int *number_of_read_requests,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_number_of_read_requests";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->read_requests_array,
+	     number_of_read_requests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of read requests.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes all read requests
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_empty_read_requests(
+     libsmdev_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_empty_read_requests";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( libcdata_array_empty(
+	     internal_handle->read_requests_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_read_request_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty read requests array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the read requests
+ * The read requests are read by descending priority and then by offset, where requests
+ * of the same priority that are close together are read as a single sequential extent
+ * The data of each request is passed to the read callback, which is called once per request
+ * or multiple times with consecutive parts of requests larger than the maximum extent size
+ * Reading is aborted if the read callback does not return 1
+ * Read errors are handled as by libsmdev_handle_read_buffer
+ * The read requests are retained and the current offset is undefined afterwards
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libsmdev_handle_read_requests(
+     libsmdev_handle_t *handle,
+     int (*read_callback)(
+            void *callback_data,
+            int request_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_read_requests";
+	int result                                  = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read callback.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsmdev_read_scheduler_read_requests(
+	          internal_handle,
+	          internal_handle->read_requests_array,
+	          internal_handle->maximum_read_gap_size,
+	          read_callback,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read requests.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Drains the write engine
+ * The IO backend offset is restored to the current offset afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_internal_handle_drain_write_engine(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_internal_handle_drain_write_engine";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->write_engine == NULL )
+	{
+		return( 1 );
+	}
+	if( libsmdev_write_engine_drain(
+	     internal_handle->write_engine,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to drain write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_io_backend_seek_offset(
+	     internal_handle->io_backend,
+	     internal_handle->offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 internal_handle->offset,
+		 internal_handle->offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Flushes the device cache
+ * The device is opened separately since the device file of the handle does not expose its descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_internal_handle_flush_device(
+     intptr_t *internal_handle,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *safe_internal_handle = NULL;
+	static char *function                            = "libsmdev_internal_handle_flush_device";
+
+#if !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && ( defined( HAVE_FDATASYNC ) || defined( HAVE_FSYNC ) )
+	int device_descriptor                            = -1;
+	int result                                       = 0;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	safe_internal_handle = (libsmdev_internal_handle_t *) internal_handle;
+
+	if( ( safe_internal_handle->io_backend_type != LIBSMDEV_IO_BACKEND_TYPE_FILE )
+	 || ( safe_internal_handle->filename == NULL ) )
+	{
+		return( 1 );
+	}
+#if !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && ( defined( HAVE_FDATASYNC ) || defined( HAVE_FSYNC ) )
+	device_descriptor = open(
+	                     safe_internal_handle->filename,
+	                     O_RDONLY );
+
+	if( device_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open device file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_FDATASYNC )
+	result = fdatasync(
+	          device_descriptor );
+#else
+	result = fsync(
+	          device_descriptor );
+#endif
+	if( result != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 errno,
+		 "%s: unable to flush device file.",
+		 function );
+
+		close(
+		 device_descriptor );
+
+		return( -1 );
+	}
+	if( close(
+	     device_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close device file.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && ( defined( HAVE_FDATASYNC ) || defined( HAVE_FSYNC ) ) */
+
+	return( 1 );
+}
+
+/* Determines if the device can write zeroes without transferring the data
+ * Returns 1 if supported, 0 if not or -1 on error
+ */
+int libsmdev_internal_handle_supports_zero_out(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+#if defined( BLKZEROOUT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	char name[ 64 ];
+	char path[ LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE ];
+
+	uint64_t write_zeroes_maximum_size = 0;
+	int result                         = 0;
+#endif
+
+	static char *function              = "libsmdev_internal_handle_supports_zero_out";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->io_backend_type != LIBSMDEV_IO_BACKEND_TYPE_FILE )
+	 || ( internal_handle->filename == NULL ) )
+	{
+		return( 0 );
+	}
+#if defined( BLKZEROOUT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libsmdev_sysfs_get_block_device_name(
+	          internal_handle->filename,
+	          name,
+	          64,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block device name.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "%s/%s/queue/write_zeroes_max_bytes",
+	 LIBSMDEV_SYSFS_BLOCK_PATH,
+	 name );
+
+	result = libsmdev_sysfs_read_integer(
+	          path,
+	          &write_zeroes_maximum_size,
+	          error );
+
+	/* The queue attributes of a partition are those of its parent device
+	 */
+	if( result == 0 )
+	{
+		narrow_string_snprintf(
+		 path,
+		 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+		 "/sys/class/block/%s/../queue/write_zeroes_max_bytes",
+		 name );
+
+		result = libsmdev_sysfs_read_integer(
+		          path,
+		          &write_zeroes_maximum_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read write zeroes maximum size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( write_zeroes_maximum_size != 0 ) )
+	{
+		return( 1 );
+	}
+#endif /* defined( BLKZEROOUT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 0 );
+}
+
+/* Determines the method used to write runs of zero blocks
+ * Discarding is only used if the device reports that discarded blocks read back as zero bytes,
+ * which only kernels before 4.12 report, zeroing out only if the device can write zeroes
+ * without transferring the data
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_internal_handle_determine_write_zeroes_method(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+#if defined( BLKZEROOUT ) && defined( BLKDISCARD ) && defined( BLKDISCARDZEROES )
+	unsigned int discard_zeroes_data = 0;
+	ssize_t read_count               = 0;
+#endif
+
+	static char *function            = "libsmdev_internal_handle_determine_write_zeroes_method";
+	int result                       = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->write_zeroes_method = LIBSMDEV_WRITE_ZEROES_METHOD_NONE;
+
+	if( ( internal_handle->io_backend_type != LIBSMDEV_IO_BACKEND_TYPE_FILE )
+	 || ( internal_handle->filename == NULL ) )
+	{
+		return( 1 );
+	}
+#if defined( BLKZEROOUT ) && defined( BLKDISCARD ) && defined( BLKDISCARDZEROES )
+	/* Since Linux 4.12 BLKDISCARDZEROES always reports 0, since discarded blocks
+	 * are no longer guaranteed to read back as zero bytes, hence discarding is
+	 * only used on older kernels
+	 */
+	read_count = libsmdev_io_backend_io_control_read(
+	              internal_handle->io_backend,
+	              BLKDISCARDZEROES,
+	              (uint8_t *) &discard_zeroes_data,
+	              sizeof( unsigned int ),
+	              error );
+
+	if( read_count == -1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	else if( discard_zeroes_data != 0 )
+	{
+		internal_handle->write_zeroes_method = LIBSMDEV_WRITE_ZEROES_METHOD_DISCARD;
+
+		return( 1 );
+	}
+#endif /* defined( BLKZEROOUT ) && defined( BLKDISCARD ) && defined( BLKDISCARDZEROES ) */
+
+	result = libsmdev_internal_handle_supports_zero_out(
+	          internal_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if device supports zeroing out.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		internal_handle->write_zeroes_method = LIBSMDEV_WRITE_ZEROES_METHOD_ZERO_OUT;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: write zeroes method\t\t: %" PRIu8 "\n",
+		 function,
+		 internal_handle->write_zeroes_method );
+	}
+#endif
+	return( 1 );
+}
+
+/* Writes zeroes to a sector aligned range of the device without transferring the data
+ * If the device rejects the request zero blocks are written as data from then on
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libsmdev_internal_handle_write_zeroes(
+     intptr_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *safe_internal_handle = NULL;
+	static char *function                            = "libsmdev_internal_handle_write_zeroes";
+
+#if defined( BLKZEROOUT )
+	uint64_t range[ 2 ];
+
+	ssize_t read_count                               = 0;
+	int request                                      = 0;
+	int result                                       = 0;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	safe_internal_handle = (libsmdev_internal_handle_t *) internal_handle;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_internal_handle->write_zeroes_method == LIBSMDEV_WRITE_ZEROES_METHOD_UNKNOWN )
+	{
+		if( libsmdev_internal_handle_determine_write_zeroes_method(
+		     safe_internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine write zeroes method.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( safe_internal_handle->write_zeroes_method == LIBSMDEV_WRITE_ZEROES_METHOD_NONE )
+	{
+		return( 0 );
+	}
+#if defined( BLKZEROOUT )
+	/* The range ioctls require 512 byte aligned ranges
+	 */
+	if( ( ( offset % 512 ) != 0 )
+	 || ( ( size % 512 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	range[ 0 ] = (uint64_t) offset;
+	range[ 1 ] = (uint64_t) size;
+
+#if defined( BLKDISCARD )
+	if( safe_internal_handle->write_zeroes_method == LIBSMDEV_WRITE_ZEROES_METHOD_DISCARD )
+	{
+		request = BLKDISCARD;
+	}
+	else
+#endif
+	{
+		request = BLKZEROOUT;
+	}
+	read_count = libsmdev_io_backend_io_control_read(
+	              safe_internal_handle->io_backend,
+	              request,
+	              (uint8_t *) range,
+	              sizeof( uint64_t ) * 2,
+	              error );
+
+	if( read_count == -1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		/* Fall back to zeroing out if discarding fails and the device supports it
+		 * and to writing the zero blocks as data otherwise
+		 */
+		if( safe_internal_handle->write_zeroes_method == LIBSMDEV_WRITE_ZEROES_METHOD_DISCARD )
+		{
+			result = libsmdev_internal_handle_supports_zero_out(
+			          safe_internal_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if device supports zeroing out.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				safe_internal_handle->write_zeroes_method = LIBSMDEV_WRITE_ZEROES_METHOD_ZERO_OUT;
+
+				return( libsmdev_internal_handle_write_zeroes(
+				         internal_handle,
+				         offset,
+				         size,
+				         error ) );
+			}
+		}
+		safe_internal_handle->write_zeroes_method = LIBSMDEV_WRITE_ZEROES_METHOD_NONE;
+
+		return( 0 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif /* defined( BLKZEROOUT ) */
+}
+
+/* Writes a buffer
+ * If write buffers are configured the data is written by the write engine,
+ * write errors are then reported by libsmdev_handle_flush, libsmdev_handle_close
+ * or the next write
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libsmdev_handle_write_buffer(
+         libsmdev_handle_t *handle,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_write_buffer";
+	size64_t media_size                         = 0;
+	ssize_t write_count                         = 0;
+	uint32_t bytes_per_sector                   = 0;
+	uint32_t error_code                         = 0;
+	int number_of_write_buffers                 = 0;
+	int result                                  = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The stripes read ahead by the parallel reader can become stale
+	 */
+	if( internal_handle->parallel_reader != NULL )
+	{
+		if( libsmdev_parallel_reader_free(
+		     &( internal_handle->parallel_reader ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free parallel reader.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	/* Zero runs are detected by the write engine hence it is also used without write buffers
+	 */
+	if( ( ( internal_handle->number_of_write_buffers > 0 )
+	  ||  ( ( internal_handle->write_flags & LIBSMDEV_WRITE_FLAG_DETECT_ZERO_RUNS ) != 0 ) )
+	 && ( internal_handle->write_engine == NULL ) )
+	{
+		number_of_write_buffers = internal_handle->number_of_write_buffers;
+
+		if( number_of_write_buffers == 0 )
+		{
+			number_of_write_buffers = 1;
+		}
+		result = libsmdev_handle_get_bytes_per_sector(
+		          handle,
+		          &bytes_per_sector,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bytes per sector.",
+			 function );
+
+			return( -1 );
+		}
+		/* Fall back to the most common sector size if the device does not provide one
+		 */
+		if( ( result == 0 )
+		 || ( bytes_per_sector == 0 )
+		 || ( bytes_per_sector > LIBSMDEV_WRITE_ENGINE_MAXIMUM_SECTOR_SIZE ) )
+		{
+			bytes_per_sector = 512;
+		}
+		if( libsmdev_handle_get_media_size(
+		     handle,
+		     &media_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve media size.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsmdev_write_engine_initialize(
+		     &( internal_handle->write_engine ),
+		     internal_handle->io_backend,
+		     (size_t) bytes_per_sector,
+		     media_size,
+		     number_of_write_buffers,
+		     internal_handle->number_of_error_retries,
+		     internal_handle->error_granularity,
+		     internal_handle->errors_range_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create write engine.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsmdev_write_engine_set_flush_policy(
+		     internal_handle->write_engine,
+		     internal_handle->write_flush_policy,
+		     internal_handle->write_flush_interval,
+		     &libsmdev_internal_handle_flush_device,
+		     (intptr_t *) internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set write engine flush policy.",
+			 function );
+
+			libsmdev_write_engine_free(
+			 &( internal_handle->write_engine ),
+			 NULL );
+
+			return( -1 );
+		}
+		if( ( internal_handle->write_flags & LIBSMDEV_WRITE_FLAG_DETECT_ZERO_RUNS ) != 0 )
+		{
+			if( libsmdev_write_engine_set_write_zeroes(
+			     internal_handle->write_engine,
+			     &libsmdev_internal_handle_write_zeroes,
+			     (intptr_t *) internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set write engine write zeroes function.",
+				 function );
+
+				libsmdev_write_engine_free(
+				 &( internal_handle->write_engine ),
+				 NULL );
+
+				return( -1 );
+			}
+		}
+	}
+	if( internal_handle->write_engine != NULL )
+	{
+		write_count = libsmdev_write_engine_write_buffer(
+		               internal_handle->write_engine,
+		               buffer,
+		               buffer_size,
+		               internal_handle->offset,
+		               error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer using write engine.",
+			 function );
+
+			return( -1 );
+		}
+		internal_handle->offset += write_count;
+
+		return( write_count );
+	}
+	write_count = libsmdev_io_backend_write_buffer(
+	               internal_handle->io_backend,
+	               buffer,
+	               buffer_size,
+	               &error_code,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 error_code,
+		 "%s: unable to write to device file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->offset += write_count;
+
+	return( write_count );
+}
+
+/* Writes a buffer at a specific offset
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libsmdev_handle_write_buffer_at_offset(
+         libsmdev_handle_t *handle,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_handle_write_buffer_at_offset";
+	ssize_t write_count   = 0;
+
+	if( libsmdev_handle_seek_offset(
+	     handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libsmdev_handle_write_buffer(
+	               handle,
+	               buffer,
+	               buffer_size,
+	               error );
+
+	if( write_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( write_count );
+}
+
+/* Flushes the buffered data and the device cache
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_flush(
+     libsmdev_handle_t *handle,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_flush";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->write_engine != NULL )
+	{
+		if( libsmdev_write_engine_flush(
+		     internal_handle->write_engine,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush write engine.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libsmdev_internal_handle_flush_device(
+		     (intptr_t *) internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush device.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sanitizes the storage media using the block erase of the device
+ * ATA devices are sanitized using the ATA SANITIZE DEVICE command passed through SCSI,
+ * other devices using the SCSI SANITIZE command
+ * The device is polled every second until the operation has completed
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libsmdev_internal_handle_sanitize_device(
+     libsmdev_internal_handle_t *internal_handle,
+     int (*progress_callback)(
+            void *callback_data,
+            int stage,
+            size64_t processed_size,
+            size64_t total_size ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_SCSI_SG_H ) && defined( HAVE_NANOSLEEP )
+	struct timespec poll_interval;
+
+	uint64_t result_lba   = 0;
+	uint16_t progress     = 0;
+	uint16_t result_count = 0;
+	uint8_t ata_status    = 0;
+	uint8_t bus_type      = 0;
+	int in_progress       = 0;
+#endif
+
+	static char *function = "libsmdev_internal_handle_sanitize_device";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_SCSI_SG_H ) && defined( HAVE_NANOSLEEP )
+	if( internal_handle->device_file == NULL )
+	{
+		return( 0 );
+	}
+	if( libsmdev_handle_get_bus_type(
+	     (libsmdev_handle_t *) internal_handle,
+	     &bus_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bus type.",
+		 function );
+
+		return( -1 );
+	}
+	if( bus_type == LIBSMDEV_BUS_TYPE_ATA )
+	{
+		if( libsmdev_scsi_ata_pass_through_non_data(
+		     internal_handle->device_file,
+		     LIBSMDEV_SCSI_ATA_COMMAND_SANITIZE_DEVICE,
+		     LIBSMDEV_SCSI_ATA_SANITIZE_FEATURE_BLOCK_ERASE_EXT,
+		     0,
+		     LIBSMDEV_SCSI_ATA_SANITIZE_BLOCK_ERASE_SIGNATURE,
+		     &ata_status,
+		     &result_count,
+		     &result_lba,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to start ATA sanitize block erase.",
+			 function );
+
+			return( -1 );
+		}
+		/* The device rejects the command if sanitize is not supported
+		 */
+		if( ( ata_status & 0x01 ) != 0 )
+		{
+			return( 0 );
+		}
+	}
+	else
+	{
+		if( libsmdev_scsi_sanitize(
+		     internal_handle->device_file,
+		     LIBSMDEV_SCSI_SANITIZE_SERVICE_ACTION_BLOCK_ERASE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to start SCSI sanitize block erase.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	do
+	{
+		poll_interval.tv_sec  = 1;
+		poll_interval.tv_nsec = 0;
+
+		while( nanosleep(
+		        &poll_interval,
+		        &poll_interval ) != 0 )
+		{
+			if( errno != EINTR )
+			{
+				break;
+			}
+		}
+		if( bus_type == LIBSMDEV_BUS_TYPE_ATA )
+		{
+			if( libsmdev_scsi_ata_pass_through_non_data(
+			     internal_handle->device_file,
+			     LIBSMDEV_SCSI_ATA_COMMAND_SANITIZE_DEVICE,
+			     LIBSMDEV_SCSI_ATA_SANITIZE_FEATURE_STATUS_EXT,
+			     0,
+			     0,
+			     &ata_status,
+			     &result_count,
+			     &result_lba,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+				 "%s: unable to retrieve ATA sanitize status.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( ata_status & 0x01 ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: ATA sanitize operation failed.",
+				 function );
+
+				return( -1 );
+			}
+			/* Bit 14 of the count indicates the sanitize operation is in progress
+			 * and the lower 16 bits of the LBA contain the progress indication
+			 */
+			in_progress = (int) ( ( result_count >> 14 ) & 0x01 );
+			progress    = (uint16_t) ( result_lba & 0xffff );
+		}
+		else
+		{
+			in_progress = libsmdev_scsi_get_sanitize_progress(
+			               internal_handle->device_file,
+			               &progress,
+			               error );
+
+			if( in_progress == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+				 "%s: unable to retrieve SCSI sanitize progress.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( ( in_progress != 0 )
+		 && ( progress_callback != NULL ) )
+		{
+			/* The device cannot be stopped, aborting only stops waiting for it
+			 */
+			if( progress_callback(
+			     callback_data,
+			     LIBSMDEV_SANITIZE_STAGE_ERASE,
+			     ( internal_handle->media_size / LIBSMDEV_SCSI_SANITIZE_PROGRESS_MAXIMUM ) * progress,
+			     internal_handle->media_size ) != 1 )
+			{
+				internal_handle->abort = 1;
+			}
+		}
+	}
+	while( ( in_progress != 0 )
+	    && ( internal_handle->abort == 0 ) );
+
+	return( 1 );
+#else
+	return( 0 );
+#endif /* defined( HAVE_SCSI_SG_H ) && defined( HAVE_NANOSLEEP ) */
+}
+
+/* Sanitizes the storage media
+ * LIBSMDEV_SANITIZE_METHOD_AUTOMATIC selects the fastest method that leaves zero bytes,
+ * discarding if discarded blocks read back as zero bytes or zeroing out otherwise
+ * If the device rejects a discard or zero out request the media is overwritten with zero bytes instead
+ * The block erase of the device is only used if requested explicitly
+ * The erase and verification are divided over the number of read threads
+ * Sectors that could not be erased or verified are available as errors, see libsmdev_handle_get_error
+ * The handle must be opened with write access
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libsmdev_handle_sanitize(
+     libsmdev_handle_t *handle,
+     int sanitize_method,
+     int verification_method,
+     int (*progress_callback)(
+            void *callback_data,
+            int stage,
+            size64_t processed_size,
+            size64_t total_size ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	libsmdev_io_backend_t **io_backends         = NULL;
+	libsmdev_sanitizer_t *sanitizer             = NULL;
+	static char *function                       = "libsmdev_handle_sanitize";
+	size64_t media_size                         = 0;
+	uint32_t bytes_per_sector                   = 0;
+	int erase_method                            = 0;
+	int number_of_workers                       = 1;
+	int result                                  = 0;
+	int worker_index                            = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->access_flags & LIBSMDEV_ACCESS_FLAG_WRITE ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid handle - not opened with write access.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sanitize_method != LIBSMDEV_SANITIZE_METHOD_AUTOMATIC )
+	 && ( sanitize_method != LIBSMDEV_SANITIZE_METHOD_DISCARD )
+	 && ( sanitize_method != LIBSMDEV_SANITIZE_METHOD_ZERO_OUT )
+	 && ( sanitize_method != LIBSMDEV_SANITIZE_METHOD_OVERWRITE )
+	 && ( sanitize_method != LIBSMDEV_SANITIZE_METHOD_BLOCK_ERASE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sanitize method.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( verification_method != LIBSMDEV_SANITIZE_VERIFICATION_METHOD_NONE )
+	 && ( verification_method != LIBSMDEV_SANITIZE_VERIFICATION_METHOD_SAMPLED )
+	 && ( verification_method != LIBSMDEV_SANITIZE_VERIFICATION_METHOD_FULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported verification method.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_handle_drain_write_engine(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to drain write engine.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The stripes read ahead by the parallel reader become stale
+	 */
+	if( internal_handle->parallel_reader != NULL )
+	{
+		if( libsmdev_parallel_reader_free(
+		     &( internal_handle->parallel_reader ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free parallel reader.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( libsmdev_handle_get_media_size(
+	     handle,
+	     &media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsmdev_handle_get_bytes_per_sector(
+	          handle,
+	          &bytes_per_sector,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		bytes_per_sector = 512;
+	}
+	if( libcdata_range_list_empty(
+	     internal_handle->errors_range_list,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty errors range list.",
+		 function );
+
+		return( -1 );
+	}
+	erase_method = sanitize_method;
+
+	if( erase_method == LIBSMDEV_SANITIZE_METHOD_AUTOMATIC )
+	{
+		if( internal_handle->write_zeroes_method == LIBSMDEV_WRITE_ZEROES_METHOD_UNKNOWN )
+		{
+			if( libsmdev_internal_handle_determine_write_zeroes_method(
+			     internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine write zeroes method.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		/* The kernel zeroes out a range without transferring the data
+		 * even if the device has no native support for it
+		 */
+		if( internal_handle->write_zeroes_method == LIBSMDEV_WRITE_ZEROES_METHOD_DISCARD )
+		{
+			erase_method = LIBSMDEV_SANITIZE_METHOD_DISCARD;
+		}
+		else
+		{
+			erase_method = LIBSMDEV_SANITIZE_METHOD_ZERO_OUT;
+		}
+	}
+	else if( erase_method == LIBSMDEV_SANITIZE_METHOD_BLOCK_ERASE )
+	{
+		result = libsmdev_internal_handle_sanitize_device(
+		          internal_handle,
+		          progress_callback,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to sanitize device.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: block erase not supported by device.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_handle->abort != 0 )
+		{
+			return( 0 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Additional workers require their own IO backend on the storage media device
+	 */
+	if( internal_handle->filename != NULL )
+	{
+		number_of_workers = internal_handle->number_of_read_threads;
+
+		if( number_of_workers > LIBSMDEV_SANITIZER_MAXIMUM_NUMBER_OF_WORKERS )
+		{
+			number_of_workers = LIBSMDEV_SANITIZER_MAXIMUM_NUMBER_OF_WORKERS;
+		}
+		else if( number_of_workers <= 0 )
+		{
+			number_of_workers = 1;
+		}
+	}
+#endif
+	io_backends = (libsmdev_io_backend_t **) memory_allocate(
+	                                          sizeof( libsmdev_io_backend_t * ) * number_of_workers );
+
+	if( io_backends == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO backends.",
+		 function );
+
+		goto on_error;
+	}
+	io_backends[ 0 ] = internal_handle->io_backend;
+
+	for( worker_index = 1;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		io_backends[ worker_index ] = NULL;
+	}
+	for( worker_index = 1;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libsmdev_io_backend_initialize_by_type(
+		     &( io_backends[ worker_index ] ),
+		     internal_handle->io_backend_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create IO backend of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libsmdev_io_backend_open_wide(
+		          io_backends[ worker_index ],
+		          internal_handle->filename,
+		          LIBSMDEV_OPEN_READ_WRITE,
+		          error );
+#else
+		result = libsmdev_io_backend_open(
+		          io_backends[ worker_index ],
+		          internal_handle->filename,
+		          LIBSMDEV_OPEN_READ_WRITE,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open IO backend of worker: %d.",
+			 function,
+			 worker_index );
+
+			libsmdev_io_backend_free(
+			 &( io_backends[ worker_index ] ),
+			 NULL );
+
+			goto on_error;
+		}
+	}
+	if( libsmdev_sanitizer_initialize(
+	     &sanitizer,
+	     erase_method,
+	     media_size,
+	     (size_t) bytes_per_sector,
+	     io_backends,
+	     number_of_workers,
+	     internal_handle->errors_range_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sanitizer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_sanitizer_set_progress_callback(
+	     sanitizer,
+	     progress_callback,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set progress callback.",
+		 function );
+
+		goto on_error;
+	}
+	internal_handle->sanitizer = sanitizer;
+
+	result = 1;
+
+	if( internal_handle->abort != 0 )
+	{
+		result = 0;
+	}
+	else if( erase_method != LIBSMDEV_SANITIZE_METHOD_BLOCK_ERASE )
+	{
+		result = libsmdev_sanitizer_run(
+		          sanitizer,
+		          LIBSMDEV_SANITIZE_STAGE_ERASE,
+		          verification_method,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to erase media.",
+			 function );
+
+			goto on_error;
+		}
+		/* Make sure the verification reads back the media and not only the cache
+		 */
+		else if( result != 0 )
+		{
+			if( libsmdev_internal_handle_flush_device(
+			     (intptr_t *) internal_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush device.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( result != 0 )
+	{
+		result = libsmdev_sanitizer_run(
+		          sanitizer,
+		          LIBSMDEV_SANITIZE_STAGE_VERIFY,
+		          verification_method,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to verify media.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_handle->sanitizer = NULL;
+
+	if( libsmdev_sanitizer_free(
+	     &sanitizer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sanitizer.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 1;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libsmdev_io_backend_close(
+		     io_backends[ worker_index ],
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close IO backend of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( libsmdev_io_backend_free(
+		     &( io_backends[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO backend of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 io_backends );
+
+	io_backends = NULL;
+
+	if( libsmdev_io_backend_seek_offset(
+	     internal_handle->io_backend,
+	     internal_handle->offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 internal_handle->offset,
+		 internal_handle->offset );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	internal_handle->sanitizer = NULL;
+
+	if( sanitizer != NULL )
+	{
+		libsmdev_sanitizer_free(
+		 &sanitizer,
+		 NULL );
+	}
+	if( io_backends != NULL )
+	{
+		for( worker_index = 1;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( io_backends[ worker_index ] != NULL )
+			{
+				libsmdev_io_backend_close(
+				 io_backends[ worker_index ],
+				 NULL );
+				libsmdev_io_backend_free(
+				 &( io_backends[ worker_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 io_backends );
+	}
+	return( -1 );
+}
+
+/* Seeks a certain offset
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libsmdev_handle_seek_offset(
+         libsmdev_handle_t *handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_seek_offset";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->device_probed == 0 )
+	{
+		if( libsmdev_internal_handle_probe_device(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to probe device.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The write engine writes at explicit offsets, hence buffered data
+	 * does not need to be written before the offset is changed
+	 */
+	if( internal_handle->write_engine != NULL )
+	{
+		if( whence == SEEK_CUR )
+		{
+			offset += internal_handle->offset;
+		}
+		else if( whence == SEEK_END )
+		{
+			offset += (off64_t) internal_handle->media_size;
+		}
+		else if( whence != SEEK_SET )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported whence.",
+			 function );
+
+			return( -1 );
+		}
+		if( offset < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		internal_handle->offset = offset;
+
+		return( offset );
+	}
+	offset = libsmdev_io_backend_seek_offset(
+	          internal_handle->io_backend,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to seek offset in device file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->offset = offset;
+
+	return( offset );
+}
+
+/* Retrieves the current offset of the (media) data
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_offset(
+     libsmdev_handle_t *handle,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_offset";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_handle->offset;
+
+	return( 1 );
+}
+
+/* Retrieves the filename size of the file handle
+ * The filename size includes the end of string character
+ * Returns 1 if succesful or -1 on error
+ */
+int libsmdev_handle_get_filename_size(
+     libsmdev_handle_t *handle,
+     size_t *filename_size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_filename_size";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result                                  = 0;
+#endif
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          libclocale_codepage,
+		          filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          libclocale_codepage,
+		          filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine filename size.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	*filename_size = internal_handle->filename_size;
+#endif
+	return( 1 );
+}
+
+/* Retrieves the filename of the file handle
+ * The filename size should include the end of string character
+ * Returns 1 if succesful or -1 on error
+ */
+int libsmdev_handle_get_filename(
+     libsmdev_handle_t *handle,
+     char *filename,
+     size_t filename_size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_filename";
+	size_t narrow_filename_size                 = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result                                  = 0;
+#endif
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          &narrow_filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          &narrow_filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          libclocale_codepage,
+		          &narrow_filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          libclocale_codepage,
+		          &narrow_filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine filename size.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	narrow_filename_size = internal_handle->filename_size;
+#endif
+	if( filename_size < narrow_filename_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: filename too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_copy_from_utf32(
+		          (libuna_utf8_character_t *) filename,
+		          filename_size,
+		          (libuna_utf32_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_copy_from_utf16(
+		          (libuna_utf8_character_t *) filename,
+		          filename_size,
+		          (libuna_utf16_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_copy_from_utf32(
+		          (uint8_t *) filename,
+		          filename_size,
+		          libclocale_codepage,
+		          (libuna_utf32_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_copy_from_utf16(
+		          (uint8_t *) filename,
+		          filename_size,
+		          libclocale_codepage,
+		          (libuna_utf16_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set filename.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( system_string_copy(
+	     filename,
+	     internal_handle->filename,
+	     internal_handle->filename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename[ internal_handle->filename_size - 1 ] = 0;
+#endif
+	return( 1 );
+}
+
+/* Sets the filename for the file handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libsmdev_handle_set_filename(
+     libsmdev_handle_t *handle,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_filename";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result                                  = 0;
+#endif
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - IO backend value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid filename length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length >= (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->filename != NULL )
+	{
+		memory_free(
+		 internal_handle->filename );
+
+		internal_handle->filename      = NULL;
+		internal_handle->filename_size = 0;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_utf8(
+		          (libuna_utf8_character_t *) filename,
+		          filename_length,
+		          &( internal_handle->filename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_utf8(
+		          (libuna_utf8_character_t *) filename,
+		          filename_length,
+		          &( internal_handle->filename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_byte_stream(
+		          (uint8_t *) filename,
+		          filename_length,
+		          libclocale_codepage,
+		          &( internal_handle->filename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_byte_stream(
+		          (uint8_t *) filename,
+		          filename_length,
+		          libclocale_codepage,
+		          &( internal_handle->filename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine filename size.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	internal_handle->filename_size = filename_length + 1;
+#endif
+	internal_handle->filename = system_string_allocate(
+	                             internal_handle->filename_size );
+
+	if( internal_handle->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_utf8(
+		          (libuna_utf32_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          (libuna_utf8_character_t *) filename,
+		          filename_length,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_utf8(
+		          (libuna_utf16_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          (libuna_utf8_character_t *) filename,
+		          filename_length,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_byte_stream(
+		          (libuna_utf32_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          (uint8_t *) filename,
+		          filename_length,
+		          libclocale_codepage,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_byte_stream(
+		          (libuna_utf16_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          (uint8_t *) filename,
+		          filename_length,
+		          libclocale_codepage,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set filename.",
+		 function );
+
+		memory_free(
+		 internal_handle->filename );
+
+		internal_handle->filename      = NULL;
+		internal_handle->filename_size = 0;
+
+		return( -1 );
+	}
+#else
+	if( system_string_copy(
+	     internal_handle->filename,
+	     filename,
+	     filename_length + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set filename.",
+		 function );
+
+		memory_free(
+		 internal_handle->filename );
+
+		internal_handle->filename      = NULL;
+		internal_handle->filename_size = 0;
+
+		return( -1 );
+	}
+	internal_handle->filename[ filename_length ] = 0;
+#endif
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Retrieves the filename size of the file handle
+ * The filename size includes the end of string character
+ * Returns 1 if succesful or -1 on error
+ */
+int libsmdev_handle_get_filename_size_wide(
+     libsmdev_handle_t *handle,
+     size_t *filename_size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_filename_size_wide";
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result                                  = 0;
+#endif
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	*filename_size = internal_handle->filename_size;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_byte_stream(
+		          (uint8_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          libclocale_codepage,
+		          filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_byte_stream(
+		          (uint8_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          libclocale_codepage,
+		          filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine filename size.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the filename of the file handle
+ * The filename size should include the end of string character
+ * Returns 1 if succesful or -1 on error
+ */
+int libsmdev_handle_get_filename_wide(
+     libsmdev_handle_t *handle,
+     wchar_t *filename,
+     size_t filename_size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_filename_wide";
+	size_t wide_filename_size                   = 0;
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result                                  = 0;
+#endif
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	wide_filename_size = internal_handle->filename_size;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          &wide_filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_utf8(
+		          (libuna_utf8_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          &wide_filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_size_from_byte_stream(
+		          (uint8_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          libclocale_codepage,
+		          &wide_filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_size_from_byte_stream(
+		          (uint8_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          libclocale_codepage,
+		          &wide_filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine filename size.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( filename_size < wide_filename_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: filename too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( system_string_copy(
+	     filename,
+	     internal_handle->filename,
+	     internal_handle->filename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename[ internal_handle->filename_size - 1 ] = 0;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_utf8(
+		          (libuna_utf32_character_t *) filename,
+		          filename_size,
+		          (libuna_utf8_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_utf8(
+		          (libuna_utf16_character_t *) filename,
+		          filename_size,
+		          (libuna_utf8_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf32_string_copy_from_byte_stream(
+		          (libuna_utf32_character_t *) filename,
+		          filename_size,
+		          (uint8_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          libclocale_codepage,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf16_string_copy_from_byte_stream(
+		          (libuna_utf16_character_t *) filename,
+		          filename_size,
+		          (uint8_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          libclocale_codepage,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set filename.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the filename for the file handle
+ * Returns 1 if succesful or -1 on error
+ */
+int libsmdev_handle_set_filename_wide(
+     libsmdev_handle_t *handle,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_filename_wide";
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int result                                  = 0;
+#endif
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - IO backend value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid filename length is zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length >= (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->filename != NULL )
+	{
+		memory_free(
+		 internal_handle->filename );
+
+		 internal_handle->filename      = NULL;
+		 internal_handle->filename_size = 0;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	internal_handle->filename_size = filename_length + 1;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_size_from_utf32(
+		          (libuna_utf32_character_t *) filename,
+		          filename_length,
+		          &( internal_handle->filename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_size_from_utf16(
+		          (libuna_utf16_character_t *) filename,
+		          filename_length,
+		          &( internal_handle->filename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) filename,
+		          filename_length,
+		          libclocale_codepage,
+		          &( internal_handle->filename_size ),
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) filename,
+		          filename_length,
+		          libclocale_codepage,
+		          &( internal_handle->filename_size ),
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine filename size.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	internal_handle->filename = system_string_allocate(
+	                             internal_handle->filename_size );
+
+	if( internal_handle->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( system_string_copy(
+	     internal_handle->filename,
+	     filename,
+	     filename_length + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to set filename.",
+		 function );
+
+		memory_free(
+		 internal_handle->filename );
+
+		internal_handle->filename      = NULL;
+		internal_handle->filename_size = 0;
+
+		return( -1 );
+	}
+	internal_handle->filename[ filename_length ] = 0;
+#else
+	if( libclocale_codepage == 0 )
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_utf8_string_copy_from_utf32(
+		          (libuna_utf8_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          (libuna_utf32_character_t *) filename,
+		          filename_length,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_utf8_string_copy_from_utf16(
+		          (libuna_utf8_character_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          (libuna_utf16_character_t *) filename,
+		          filename_length,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_copy_from_utf32(
+		          (uint8_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          libclocale_codepage,
+		          (libuna_utf32_character_t *) filename,
+		          filename_length,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_copy_from_utf16(
+		          (uint8_t *) internal_handle->filename,
+		          internal_handle->filename_size,
+		          libclocale_codepage,
+		          (libuna_utf16_character_t *) filename,
+		          filename_length,
+		          error );
+#else
+#error Unsupported size of wchar_t
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set filename.",
+		 function );
+
+		memory_free(
+		 internal_handle->filename );
+
+		internal_handle->filename      = NULL;
+		internal_handle->filename_size = 0;
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Determines the media information
+ * This determines the device identity, such as the bus and device type,
+ * vendor, model and serial number, but not the table of contents
+ * Returns 1 if successful, 0 if no media information available or -1 on error
+ */
+int libsmdev_internal_handle_determine_media_information(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	STORAGE_PROPERTY_QUERY query;
+#elif defined( HDIO_GET_IDENTITY )
+	struct hd_driveid device_configuration;
+#endif
+	uint8_t *response      = NULL;
+	static char *function  = "libsmdev_internal_handle_determine_media_information";
+
+#if defined( WINAPI )
+	size_t response_size   = 1024;
+	size_t string_length   = 0;
+	ssize_t read_count     = 0;
+
+#else
+	size_t response_size   = 255;
+
+#if defined( HAVE_SCSI_SG_H )
+	ssize_t response_count = 0;
+#endif
+#endif
+#if defined( HAVE_SCSI_SG_H ) || defined( HDIO_GET_IDENTITY ) || defined( WINAPI )
+	ssize_t result         = 0;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_information_set != 0 )
+	{
+		return( 1 );
+	}
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid device handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	/* A probe cache entry that cannot be read is not considered an error
+	 * since the values can still be probed from the device
+	 */
+	if( internal_handle->probe_cache_directory != NULL )
+	{
+		if( libsmdev_probe_cache_read(
+		     internal_handle,
+		     error ) == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		if( internal_handle->media_information_set != 0 )
+		{
+			return( 1 );
+		}
+	}
+	/* The device specific values can only be probed using the device file
+	 * of the file IO backend
+	 */
+	if( internal_handle->device_file == NULL )
+	{
+		internal_handle->media_information_set = 1;
+
+		return( 1 );
+	}
+	response = (uint8_t *) memory_allocate(
+	                        sizeof( uint8_t ) * response_size );
+
+	if( response == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to response.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     response,
+	     0,
+	     sizeof( uint8_t ) * response_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear response.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI )
+	if( memset(
+	     &query,
+	     0,
+	     sizeof( STORAGE_PROPERTY_QUERY ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear storage property query.",
+		 function );
+
+		goto on_error;
+	}
+	query.PropertyId = StorageDeviceProperty;
+	query.QueryType  = PropertyStandardQuery;
+
+	read_count = libcfile_file_io_control_read(
+	              internal_handle->device_file,
+	              IOCTL_STORAGE_QUERY_PROPERTY,
+	              (uint8_t *) &query,
+	              sizeof( STORAGE_PROPERTY_QUERY ),
+	              response,
+	              response_size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 "%s: unable to query device for: IOCTL_STORAGE_QUERY_PROPERTY.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		return( 0 );
+	}
+	if( (size_t) ( (STORAGE_DESCRIPTOR_HEADER *) response )->Size > response_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: response buffer too small.\n",
+		 function );
+
+		goto on_error;
+	}
+	if( (size_t) ( (STORAGE_DESCRIPTOR_HEADER *) response )->Size > sizeof( STORAGE_DEVICE_DESCRIPTOR ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_data(
+			 response,
+			 (size_t) ( (STORAGE_DESCRIPTOR_HEADER *) response )->Size,
+			 0 );
+		}
+#endif
+		if( ( (STORAGE_DEVICE_DESCRIPTOR *) response )->VendorIdOffset > 0 )
+		{
+			string_length = narrow_string_length(
+					 (char *) &( response[ ( (STORAGE_DEVICE_DESCRIPTOR *) response )->VendorIdOffset ] ) );
+
+			result = libsmdev_string_trim_copy_from_byte_stream(
+				  internal_handle->vendor,
+				  64,
+				  &( response[ ( (STORAGE_DEVICE_DESCRIPTOR *) response )->VendorIdOffset ] ),
+				  string_length,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set vendor.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( (STORAGE_DEVICE_DESCRIPTOR *) response )->ProductIdOffset > 0 )
+		{
+			string_length = narrow_string_length(
+					 (char *) &( response[ ( (STORAGE_DEVICE_DESCRIPTOR *) response )->ProductIdOffset ] ) );
+
+			result = libsmdev_string_trim_copy_from_byte_stream(
+				  internal_handle->model,
+				  64,
+				  &( response[ ( (STORAGE_DEVICE_DESCRIPTOR *) response )->ProductIdOffset ] ),
+				  string_length,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set model.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( (STORAGE_DEVICE_DESCRIPTOR *) response )->SerialNumberOffset > 0 )
+		{
+			string_length = narrow_string_length(
+					 (char *) &( response[ ( (STORAGE_DEVICE_DESCRIPTOR *) response )->SerialNumberOffset ] ) );
+
+			result = libsmdev_string_trim_copy_from_byte_stream(
+				  internal_handle->serial_number,
+				  64,
+				  &( response[ ( (STORAGE_DEVICE_DESCRIPTOR *) response )->SerialNumberOffset ] ),
+				  string_length,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set serial number.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		internal_handle->removable = ( (STORAGE_DEVICE_DESCRIPTOR *) response )->RemovableMedia;
+
+		switch( ( ( STORAGE_DEVICE_DESCRIPTOR *) response )->BusType )
+		{
+			case BusTypeScsi:
+				internal_handle->bus_type = LIBSMDEV_BUS_TYPE_SCSI;
+				break;
+
+			case BusTypeAtapi:
+			case BusTypeAta:
+				internal_handle->bus_type = LIBSMDEV_BUS_TYPE_ATA;
+				break;
+
+			case BusType1394:
+				internal_handle->bus_type = LIBSMDEV_BUS_TYPE_FIREWIRE;
+				break;
+
+			case BusTypeUsb:
+				internal_handle->bus_type = LIBSMDEV_BUS_TYPE_USB;
+				break;
+
+			default:
+				break;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Bus type:\t\t" );
+
+			switch( ( ( STORAGE_DEVICE_DESCRIPTOR *) response )->BusType )
+			{
+				case BusTypeScsi:
+					libcnotify_printf(
+					 "SCSI" );
+					break;
+
+				case BusTypeAtapi:
+					libcnotify_printf(
+					 "ATAPI" );
+					break;
+
+				case BusTypeAta:
+					libcnotify_printf(
+					 "ATA" );
+					break;
+
+				case BusType1394:
+					libcnotify_printf(
+					 "FireWire (IEEE1394)" );
+					break;
+
+				case BusTypeSsa:
+					libcnotify_printf(
+					 "Serial Storage Architecture (SSA)" );
+					break;
+
+				case BusTypeFibre:
+					libcnotify_printf(
+					 "Fibre Channel" );
+					break;
+
+				case BusTypeUsb:
+					libcnotify_printf(
+					 "USB" );
+					break;
+
+				case BusTypeRAID:
+					libcnotify_printf(
+					 "RAID" );
+					break;
+
+				case BusTypeiScsi:
+					libcnotify_printf(
+					 "iSCSI" );
+					break;
+
+				case BusTypeSas:
+					libcnotify_printf(
+					 "SAS" );
+					break;
+
+				case BusTypeSata:
+					libcnotify_printf(
+					 "SATA" );
+					break;
+
+				case BusTypeSd:
+					libcnotify_printf(
+					 "Secure Digital (SD)" );
+					break;
+
+				case BusTypeMmc:
+					libcnotify_printf(
+					 "Multi Media Card (MMC)" );
+					break;
+
+				default:
+					libcnotify_printf(
+					 "Unknown: %d",
+					 ( ( STORAGE_DEVICE_DESCRIPTOR *) response )->BusType );
+					break;
+			}
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+	}
+#else
+#if defined( HAVE_SCSI_SG_H )
+	/* Use the Linux sg (generic SCSI) driver to determine device information
+	 */
+	result = libsmdev_scsi_get_bus_type(
+	          internal_handle->device_file,
+	          &( internal_handle->bus_type ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine bus type.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		response_count = libsmdev_scsi_inquiry(
+				  internal_handle->device_file,
+				  0x00,
+				  0x00,
+				  response,
+				  response_size,
+				  error );
+
+		if( response_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: SCSI Inquiry.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+/* TODO handle garbarge return ? */
+		if( response_count >= 5 )
+		{
+			internal_handle->removable   = ( response[ 1 ] & 0x80 ) >> 7;
+			internal_handle->device_type = ( response[ 0 ] & 0x1f );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: removable\t\t: %" PRIu8 "\n",
+				 function,
+				 internal_handle->removable );
+
+				libcnotify_printf(
+				 "%s: device type\t: 0x%" PRIx8 "\n",
+				 function,
+				 internal_handle->device_type );
+
+				libcnotify_printf(
+				 "\n" );
+			}
+#endif
+		}
+		if( response_count >= 16 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_data(
+				 response,
+				 response_count,
+				 0 );
+			}
+#endif
+			result = libsmdev_string_trim_copy_from_byte_stream(
+				  internal_handle->vendor,
+				  64,
+				  &( response[ 8 ] ),
+				  15 - 8,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set vendor.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( response_count >= 32 )
+		{
+			result = libsmdev_string_trim_copy_from_byte_stream(
+				  internal_handle->model,
+				  64,
+				  &( response[ 16 ] ),
+				  31 - 16,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set model.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		response_count = libsmdev_scsi_inquiry(
+				  internal_handle->device_file,
+				  0x01,
+				  LIBSMDEV_SCSI_VPD_PAGE_CODE_UNIT_SERIAL_NUMBER,
+				  response,
+				  response_size,
+				  error );
+
+		if( response_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: SCSI Inquiry.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		if( response_count > 4 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_data(
+				 response,
+				 response_count,
+				 0 );
+			}
+#endif
+			result = libsmdev_string_trim_copy_from_byte_stream(
+				  internal_handle->serial_number,
+				  64,
+				  &( response[ 4 ] ),
+				  response_count - 4,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set serial number.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#endif
+#if defined( HDIO_GET_IDENTITY )
+	if( internal_handle->bus_type == LIBSMDEV_BUS_TYPE_ATA )
+	{
+		result = libsmdev_ata_get_device_configuration(
+		          internal_handle->device_file,
+		          &device_configuration,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve ATA device configuration.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			result = libsmdev_string_trim_copy_from_byte_stream(
+				  internal_handle->serial_number,
+				  64,
+				  device_configuration.serial_no,
+				  20,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set serial number.",
+				 function );
+
+				goto on_error;
+			}
+			result = libsmdev_string_trim_copy_from_byte_stream(
+				  internal_handle->model,
+				  64,
+				  device_configuration.model,
+				  40,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set model.",
+				 function );
+
+				goto on_error;
+			}
+			internal_handle->removable   = ( device_configuration.config & 0x0080 ) >> 7;
+			internal_handle->device_type = ( device_configuration.config & 0x1f00 ) >> 8;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: removable\t\t: %" PRIu8 "\n",
+				 function,
+				 internal_handle->removable );
+
+				libcnotify_printf(
+				 "%s: device type\t: 0x%" PRIx8 "\n",
+				 function,
+				 internal_handle->device_type );
+
+				libcnotify_printf(
+				 "\n" );
+			}
+#endif
+		}
+	}
+#endif
+/* Disabled for now
+	if( libsmdev_scsi_get_identifier(
+	     internal_handle->device_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine SCSI identifier.",
+		 function );
+
+		goto on_error;
+	}
+	uint8_t pci_bus_address[ 64 ];
+	size_t pci_bus_address_size = 64;
+
+	result = libsmdev_scsi_get_pci_bus_address(
+	          internal_handle->device_file,
+	          pci_bus_address,
+	          pci_bus_address_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine PCI bus address.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LINUX_USB_CH9_H )
+	if( internal_handle->bus_type == LIBSMDEV_BUS_TYPE_USB )
+	{
+		if( io_usb_test(
+		     internal_handle->device_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to test USB.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+*/
+#endif
+	internal_handle->media_information_set = 1;
+
+	if( internal_handle->probe_cache_directory != NULL )
+	{
+		if( libsmdev_probe_cache_write(
+		     internal_handle,
+		     error ) == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	memory_free(
+	 response );
+
+	response = NULL;
+
+	return( 1 );
+
+on_error:
+	if( response != NULL )
+	{
+		memory_free(
+		 response );
+	}
+	return( -1 );
+}
+
+/* Determines the table of contents
+ * The table of contents is only available for optical disc devices
+ * Returns 1 if successful, 0 if no table of contents available or -1 on error
+ */
+int libsmdev_internal_handle_determine_table_of_contents(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_internal_handle_determine_table_of_contents";
+	int result            = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->table_of_contents_set != 0 )
+	{
+		return( 1 );
+	}
+	/* The device type is needed to determine if the device is an optical disc
+	 */
+	if( internal_handle->media_information_set == 0 )
+	{
+		result = libsmdev_internal_handle_determine_media_information(
+		          internal_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine media information.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		/* The table of contents can be restored from the probe cache
+		 */
+		if( internal_handle->table_of_contents_set != 0 )
+		{
+			return( 1 );
+		}
+	}
+#if defined( HAVE_LINUX_CDROM_H )
+	if( internal_handle->device_type == 0x05 )
+	{
+		result = libsmdev_optical_disc_get_table_of_contents(
+		          internal_handle->device_file,
+		          internal_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve optical disc table of contents.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	internal_handle->table_of_contents_set = 1;
+
+	if( internal_handle->probe_cache_directory != NULL )
+	{
+		if( libsmdev_probe_cache_write(
+		     internal_handle,
+		     error ) == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a session
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_append_session(
+     libsmdev_internal_handle_t *internal_handle,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_handle_append_session";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_table_of_contents_append_session(
+	     internal_handle->table_of_contents,
+	     start_sector,
+	     number_of_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append session to table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a lead-out
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_append_lead_out(
+     libsmdev_internal_handle_t *internal_handle,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_handle_append_lead_out";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_table_of_contents_append_lead_out(
+	     internal_handle->table_of_contents,
+	     start_sector,
+	     number_of_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append lead-out to table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a track
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_append_track(
+     libsmdev_internal_handle_t *internal_handle,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     uint8_t type,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_handle_append_track";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_table_of_contents_append_track(
+	     internal_handle->table_of_contents,
+	     start_sector,
+	     number_of_sectors,
+	     type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append track to table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the media size
+ * Returns the 1 if succesful or -1 on error
+ */
+int libsmdev_handle_get_media_size(
+     libsmdev_handle_t *handle,
+     size64_t *media_size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_media_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_size_set == 0 )
+	{
+		if( libsmdev_io_backend_get_size(
+		     internal_handle->io_backend,
+		     &( internal_handle->media_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine device file size.",
+			 function );
+
+			return( -1 );
+		}
+		internal_handle->media_size_set = 1;
+	}
+	*media_size = internal_handle->media_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of bytes per sector
+ * Returns the 1 if succesful, 0 if not or -1 on error
+ */
+int libsmdev_handle_get_bytes_per_sector(
+     libsmdev_handle_t *handle,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	DISK_GEOMETRY disk_geometry;
+	DISK_GEOMETRY_EX disk_geometry_extended;
+#endif
+
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_bytes_per_sector";
+	ssize_t read_count                          = 0;
+
+#if defined( WINAPI )
+	uint32_t error_code                         = 0;
+
+#elif !defined( BLKSSZGET ) && defined( DIOCGSECTORSIZE )
+	u_int safe_bytes_per_sector                 = 0;
+#endif
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid device handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->bytes_per_sector_set == 0 )
+	{
+#if defined( WINAPI )
+		read_count = libcfile_file_io_control_read_with_error_code(
+		              internal_handle->device_file,
+		              IOCTL_DISK_GET_DRIVE_GEOMETRY_EX,
+		              NULL,
+		              0,
+		              (uint8_t *) &disk_geometry_extended,
+		              sizeof( DISK_GEOMETRY_EX ),
+		              &error_code,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: IOCTL_DISK_GET_DRIVE_GEOMETRY_EX.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			if( error_code == ERROR_NOT_SUPPORTED )
+			{
+				/* A floppy device does not support IOCTL_DISK_GET_DRIVE_GEOMETRY_EX
+				 */
+				read_count = libcfile_file_io_control_read(
+				              internal_handle->device_file,
+				              IOCTL_DISK_GET_DRIVE_GEOMETRY,
+				              NULL,
+				              0,
+				              (uint8_t *) &disk_geometry,
+				              sizeof( DISK_GEOMETRY ),
+				              error );
+
+				if( read_count == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+					 "%s: unable to query device for: IOCTL_DISK_GET_DRIVE_GEOMETRY.",
+					 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						if( ( error != NULL )
+						 && ( *error != NULL ) )
+						{
+							libcnotify_print_error_backtrace(
+							 *error );
+						}
+					}
+#endif
+					libcerror_error_free(
+					 error );
+				}
+				else
+				{
+					internal_handle->bytes_per_sector     = (uint32_t) disk_geometry.BytesPerSector;
+					internal_handle->bytes_per_sector_set = 1;
+				}
+			}
+		}
+		else
+		{
+			internal_handle->bytes_per_sector     = (uint32_t) disk_geometry_extended.Geometry.BytesPerSector;
+			internal_handle->bytes_per_sector_set = 1;
+		}
+#elif defined( BLKSSZGET )
+		read_count = libsmdev_io_backend_io_control_read(
+		              internal_handle->io_backend,
+		              BLKSSZGET,
+		              (uint8_t *) &( internal_handle->bytes_per_sector ),
+		              4,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: BLKSSZGET.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else
+		{
+			internal_handle->bytes_per_sector_set = 1;
+		}
+#elif defined( DIOCGSECTORSIZE )
+		read_count = libsmdev_io_backend_io_control_read(
+		              internal_handle->io_backend,
+		              DIOCGSECTORSIZE,
+		              (uint8_t *) &safe_bytes_per_sector,
+		              sizeof( u_int ),
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: DIOCGSECTORSIZE.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else if( safe_bytes_per_sector > (u_int) UINT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid bytes per sector value out of bounds.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+		}
+		else
+		{
+			internal_handle->bytes_per_sector     = (uint32_t) safe_bytes_per_sector;
+			internal_handle->bytes_per_sector_set = 1;
+		}
+#elif defined( DKIOCGETBLOCKSIZE )
+		read_count = libsmdev_io_backend_io_control_read(
+		              internal_handle->io_backend,
+		              DKIOCGETBLOCKSIZE,
+		              (uint8_t *) &( internal_handle->bytes_per_sector ),
+		              4,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: DKIOCGETBLOCKSIZE.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else
+		{
+			internal_handle->bytes_per_sector_set = 1;
+		}
+#endif
+		/* /dev/rdisk# on Mac OS X and some Windows devices require
+		 * sector aligned read and seek operations
+		 */
+		if( internal_handle->bytes_per_sector_set != 0 )
+		{
+			if( libsmdev_io_backend_set_block_size(
+			     internal_handle->io_backend,
+			     (size_t) internal_handle->bytes_per_sector,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 "%s: unable to set block size in device file.",
+				 function );
+
+				internal_handle->bytes_per_sector_set = 0;
+
+				return( -1 );
+			}
+		}
+	}
+	if( internal_handle->bytes_per_sector_set == 0 )
+	{
+#if defined( BLKSSZGET ) || defined( DKIOCGETBLOCKSIZE ) || defined( DIOCGSECTORSIZE ) || defined( WINAPI )
+		return( 0 );
+#else
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported platform.",
+		 function );
+
+		return( -1 );
+#endif
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: bytes per sector: %" PRIu32 "\n",
+		 function,
+		 internal_handle->bytes_per_sector );
+	}
+#endif
+	*bytes_per_sector = internal_handle->bytes_per_sector;
+
+	return( 1 );
+}
+
+/* Retrieves the media type
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_media_type(
+     libsmdev_handle_t *handle,
+     uint8_t *media_type,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_media_type";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid device handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( media_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid media type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_information_set == 0 )
+	{
+		if( libsmdev_internal_handle_determine_media_information(
+		     internal_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine media information.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_handle->device_type == 0x05 )
+	{
+		*media_type = LIBSMDEV_MEDIA_TYPE_OPTICAL;
+	}
+	else if( internal_handle->removable != 0 )
+	{
+		*media_type = LIBSMDEV_MEDIA_TYPE_REMOVABLE;
+	}
+	else
+	{
+		*media_type = LIBSMDEV_MEDIA_TYPE_FIXED;
+	}
+	return( 1 );
+}
+
+/* Retrieves the bus type
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_bus_type(
+     libsmdev_handle_t *handle,
+     uint8_t *bus_type,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_bus_type";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid device handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( bus_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bus type.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_information_set == 0 )
+	{
+		if( libsmdev_internal_handle_determine_media_information(
+		     internal_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine media information.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*bus_type = internal_handle->bus_type;
+
+	return( 1 );
+}
+
+/* Retrieves an UTF-8 encoded information value for the specific identifier
+ * The value size should include the end of string character
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libsmdev_handle_get_utf8_information_value(
+     libsmdev_handle_t *handle,
+     const uint8_t *identifier,
+     size_t identifier_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	uint8_t *information_value                  = NULL;
+	static char *function                       = "libsmdev_handle_get_utf8_information_value";
+	size_t information_value_size               = 0;
+	size_t string_index                         = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_information_set == 0 )
+	{
+		if( libsmdev_internal_handle_determine_media_information(
+		     internal_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine media information.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( identifier_length == 5 )
+	{
+		if( narrow_string_compare(
+		     "model",
+		     (char *) identifier,
+		     identifier_length ) == 0 )
+		{
+			information_value = (uint8_t *) internal_handle->model;
+		}
+	}
+	else if( identifier_length == 6 )
+	{
+		if( narrow_string_compare(
+		     "vendor",
+		     (char *) identifier,
+		     identifier_length ) == 0 )
+		{
+			information_value = (uint8_t *) internal_handle->vendor;
+		}
+	}
+	else if( identifier_length == 13 )
+	{
+		if( narrow_string_compare(
+		     "serial_number",
+		     (char *) identifier,
+		     identifier_length ) == 0 )
+		{
+			information_value = (uint8_t *) internal_handle->serial_number;
+		}
+	}
+	if( information_value == NULL )
+	{
+		return( 0 );
+	}
+	if( information_value[ 0 ] == 0 )
+	{
+		return( 0 );
+	}
+	/* Determine the header value size
+	 */
+	information_value_size = 1 + narrow_string_length(
+	                              (char *) information_value );
+
+	if( utf8_string_size < information_value_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < information_value_size - 1;
+	     string_index++ )
+	{
+		utf8_string[ string_index ] = (uint8_t) information_value[ string_index ];
+	}
+	utf8_string[ information_value_size - 1 ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves an UTF-16 encoded information value for the specific identifier
+ * The value size should include the end of string character
+ * Returns 1 if successful, 0 if value not present or -1 on error
+ */
+int libsmdev_handle_get_utf16_information_value(
+     libsmdev_handle_t *handle,
+     const uint8_t *identifier,
+     size_t identifier_length,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	uint8_t *information_value                  = NULL;
+	static char *function                       = "libsmdev_handle_get_utf16_information_value";
+	size_t information_value_size               = 0;
+	size_t string_index                         = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_information_set == 0 )
+	{
+		if( libsmdev_internal_handle_determine_media_information(
+		     internal_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine media information.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( identifier_length == 5 )
+	{
+		if( narrow_string_compare(
+		     "model",
+		     (char *) identifier,
+		     identifier_length ) == 0 )
+		{
+			information_value = (uint8_t *) internal_handle->model;
+		}
+	}
+	else if( identifier_length == 6 )
+	{
+		if( narrow_string_compare(
+		     "vendor",
+		     (char *) identifier,
+		     identifier_length ) == 0 )
+		{
+			information_value = (uint8_t *) internal_handle->vendor;
+		}
+	}
+	else if( identifier_length == 13 )
+	{
+		if( narrow_string_compare(
+		     "serial_number",
+		     (char *) identifier,
+		     identifier_length ) == 0 )
+		{
+			information_value = (uint8_t *) internal_handle->serial_number;
+		}
+	}
+	if( information_value == NULL )
+	{
+		return( 0 );
+	}
+	if( information_value[ 0 ] == 0 )
+	{
+		return( 0 );
+	}
+	/* Determine the header value size
+	 */
+	information_value_size = 1 + narrow_string_length(
+	                              (char *) information_value );
+
+	if( utf16_string_size < information_value_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-16 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < information_value_size - 1;
+	     string_index++ )
+	{
+		utf16_string[ string_index ] = (uint16_t) information_value[ string_index ];
+	}
+	utf16_string[ information_value_size - 1 ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of sessions
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_number_of_sessions(
+     libsmdev_handle_t *handle,
+     int *number_of_sessions,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_number_of_sessions";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( ( internal_handle->io_backend != NULL )
+	 && ( internal_handle->table_of_contents_set == 0 ) )
+	{
+		if( libsmdev_internal_handle_determine_table_of_contents(
+		     internal_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine table of contents.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libsmdev_table_of_contents_get_number_of_sessions(
+	     internal_handle->table_of_contents,
+	     number_of_sessions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sessions from table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a session
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_session(
+     libsmdev_handle_t *handle,
+     int index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	libsmdev_sector_range_t *sector_range       = NULL;
+	static char *function                       = "libsmdev_handle_get_session";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( ( internal_handle->io_backend != NULL )
+	 && ( internal_handle->table_of_contents_set == 0 ) )
+	{
+		if( libsmdev_internal_handle_determine_table_of_contents(
+		     internal_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine table of contents.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libsmdev_table_of_contents_get_session_by_index(
+	     internal_handle->table_of_contents,
+	     index,
+	     &sector_range,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve session sector range: %d from table of contents.",
+		 function,
+		 index );
+
+		return( -1 );
+	}
+	if( libsmdev_sector_range_get(
+	     sector_range,
+	     start_sector,
+	     number_of_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sector range.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of tracks
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_number_of_tracks(
+     libsmdev_handle_t *handle,
+     int *number_of_tracks,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_number_of_tracks";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( ( internal_handle->io_backend != NULL )
+	 && ( internal_handle->table_of_contents_set == 0 ) )
+	{
+		if( libsmdev_internal_handle_determine_table_of_contents(
+		     internal_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine table of contents.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libsmdev_table_of_contents_get_number_of_tracks(
+	     internal_handle->table_of_contents,
+	     number_of_tracks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tracks from table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a track
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_track(
+     libsmdev_handle_t *handle,
+     int index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     uint8_t *type,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	libsmdev_track_value_t *track_value         = NULL;
+	static char *function                       = "libsmdev_handle_get_track";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( ( internal_handle->io_backend != NULL )
+	 && ( internal_handle->table_of_contents_set == 0 ) )
+	{
+		if( libsmdev_internal_handle_determine_table_of_contents(
+		     internal_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine table of contents.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libsmdev_table_of_contents_get_track_by_index(
+	     internal_handle->table_of_contents,
+	     index,
+	     &track_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track value: %d from table of contents.",
+		 function,
+		 index );
+
+		return( -1 );
+	}
+	if( libsmdev_track_value_get(
+	     track_value,
+	     start_sector,
+	     number_of_sectors,
+	     type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads raw sectors from an optical disc
+ * Every sector is read as a 2352-byte frame, followed by 96 bytes of raw P-W sub-channel data
+ * if LIBSMDEV_OPTICAL_READ_FLAG_SUB_CHANNEL is set
+ * The buffer must be large enough to contain all the frames
+ *
+ * LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS selects a fast first pass over damaged media,
+ * damaged sectors are not retried but recorded as suspect sectors and errors instead.
+ * A read without the flag re-reads sectors with the full error recovery of the drive and
+ * removes the sectors it read from the suspect sectors and errors
+ *
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_handle_read_optical_sectors(
+         libsmdev_handle_t *handle,
+         uint64_t start_sector,
+         uint32_t number_of_sectors,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint8_t read_flags,
+         libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_read_optical_sectors";
+	ssize_t read_count                          = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->abort = 0;
+
+	read_count = libsmdev_optical_read_sectors(
+	              internal_handle,
+	              start_sector,
+	              number_of_sectors,
+	              LIBSMDEV_TRACK_TYPE_UNKNOWN,
+	              buffer,
+	              buffer_size,
+	              read_flags,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read optical sectors.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads raw sectors of a track from an optical disc
+ * The sector index is relative to the start of the track
+ * Every sector is read as a 2352-byte frame, followed by 96 bytes of raw P-W sub-channel data
+ * if LIBSMDEV_OPTICAL_READ_FLAG_SUB_CHANNEL is set
+ * The buffer must be large enough to contain all the frames
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_handle_read_track_sectors(
+         libsmdev_handle_t *handle,
+         int track_index,
+         uint64_t sector_index,
+         uint32_t number_of_sectors,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint8_t read_flags,
+         libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_read_track_sectors";
+	ssize_t read_count                          = 0;
+	uint64_t track_number_of_sectors            = 0;
+	uint64_t track_start_sector                 = 0;
+	uint8_t track_type                          = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_handle_get_track(
+	     handle,
+	     track_index,
+	     &track_start_sector,
+	     &track_number_of_sectors,
+	     &track_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve track: %d.",
+		 function,
+		 track_index );
+
+		return( -1 );
+	}
+	if( ( sector_index > track_number_of_sectors )
+	 || ( (uint64_t) number_of_sectors > ( track_number_of_sectors - sector_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->abort = 0;
+
+	read_count = libsmdev_optical_read_sectors(
+	              internal_handle,
+	              track_start_sector + sector_index,
+	              number_of_sectors,
+	              track_type,
+	              buffer,
+	              buffer_size,
+	              read_flags,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sectors of track: %d.",
+		 function,
+		 track_index );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Retrieves the number of suspect sector ranges
+ * Suspect sectors are detected by optical reads with LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_number_of_suspect_ranges(
+     libsmdev_handle_t *handle,
+     int *number_of_ranges,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_number_of_suspect_ranges";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( libcdata_range_list_get_number_of_elements(
+	     internal_handle->suspect_sectors_range_list,
+	     number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements in suspect sectors range list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a suspect sector range
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_suspect_range(
+     libsmdev_handle_t *handle,
+     int index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_suspect_range";
+	intptr_t *value                             = NULL;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( libcdata_range_list_get_range_by_index(
+	     internal_handle->suspect_sectors_range_list,
+	     index,
+	     start_sector,
+	     number_of_sectors,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve suspect range: %d from suspect sectors range list.",
+		 function,
+		 index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the current optical drive read speed
+ * The read speed is a multiple of the 1x speed, where 0 represents the maximum speed of the drive
+ * With the adaptive read speed policy the current read speed can be lower than the configured read speed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_read_speed(
+     libsmdev_handle_t *handle,
+     uint16_t *read_speed,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_read_speed";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( read_speed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read speed.",
+		 function );
+
+		return( -1 );
+	}
+	*read_speed = internal_handle->read_speed->speed;
+
+	return( 1 );
+}
+
+/* Sets the optical drive read speed
+ * The read speed is a multiple of the 1x speed, where 0 represents the maximum speed of the drive
+ * With the adaptive read speed policy this is the speed the drive returns to on clean areas of the disc
+ * The read speed is applied to the drive on the next optical read and the default speed of the drive
+ * is restored when the handle is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_set_read_speed(
+     libsmdev_handle_t *handle,
+     uint16_t read_speed,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_read_speed";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( libsmdev_read_speed_set_maximum_speed(
+	     internal_handle->read_speed,
+	     read_speed,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum read speed.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the optical drive read speed policy
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_read_speed_policy(
+     libsmdev_handle_t *handle,
+     int *read_speed_policy,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_read_speed_policy";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( read_speed_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read speed policy.",
+		 function );
+
+		return( -1 );
+	}
+	*read_speed_policy = internal_handle->read_speed->policy;
+
+	return( 1 );
+}
+
+/* Sets the optical drive read speed policy
+ * By default the read speed policy is LIBSMDEV_READ_SPEED_POLICY_FIXED, which reads at the configured read speed.
+ * LIBSMDEV_READ_SPEED_POLICY_ADAPTIVE reads at the configured read speed on clean areas of the disc and
+ * lowers the read speed when the rate of sectors that cannot be read or are read slowly rises
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_set_read_speed_policy(
+     libsmdev_handle_t *handle,
+     int read_speed_policy,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_read_speed_policy";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( ( read_speed_policy != LIBSMDEV_READ_SPEED_POLICY_FIXED )
+	 && ( read_speed_policy != LIBSMDEV_READ_SPEED_POLICY_ADAPTIVE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported read speed policy.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->read_speed->policy = read_speed_policy;
+
+	/* Return to the configured read speed
+	 */
+	if( libsmdev_read_speed_set_maximum_speed(
+	     internal_handle->read_speed,
+	     internal_handle->read_speed->maximum_speed,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum read speed.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads sectors from a DVD or BD data disc with streaming reads
+ * The streaming reads favor a sustained transfer rate over the full error recovery of the drive
+ * The buffer must be large enough to contain all the sectors
+ *
+ * Sectors that cannot be read by the streaming reads, including reads that exceed the streaming timeout,
+ * are filled with 0-byte values and recorded as suspect sectors and errors. These sectors can be
+ * re-read later with libsmdev_handle_read_optical_sectors
+ *
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_handle_read_streaming_sectors(
+         libsmdev_handle_t *handle,
+         uint64_t start_sector,
+         uint32_t number_of_sectors,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_read_streaming_sectors";
+	ssize_t read_count                          = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->abort = 0;
+
+	read_count = libsmdev_optical_read_streaming_sectors(
+	              internal_handle,
+	              start_sector,
+	              number_of_sectors,
+	              buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read streaming sectors.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Retrieves the streaming transfer size
+ * A value of 0 represents the maximum transfer size of the device
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_streaming_transfer_size(
+     libsmdev_handle_t *handle,
+     size_t *streaming_transfer_size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_streaming_transfer_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( streaming_transfer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid streaming transfer size.",
+		 function );
+
+		return( -1 );
+	}
+	*streaming_transfer_size = internal_handle->streaming_transfer_size;
+
+	return( 1 );
+}
+
+/* Sets the streaming transfer size
+ * The streaming transfer size is the number of bytes transferred by a single streaming read command,
+ * it is rounded down to a multiple of the sector size. Larger transfers improve the throughput on
+ * undamaged media while smaller transfers limit the number of sectors marked as suspect per failure
+ * A value of 0 represents the maximum transfer size of the device
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_set_streaming_transfer_size(
+     libsmdev_handle_t *handle,
+     size_t streaming_transfer_size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_streaming_transfer_size";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( streaming_transfer_size > (size_t) LIBSMDEV_OPTICAL_READ_MAXIMUM_STREAMING_TRANSFER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid streaming transfer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->streaming_transfer_size = streaming_transfer_size;
+
+	return( 1 );
+}
+
+/* Retrieves the streaming timeout
+ * The streaming timeout is the maximum duration of a single streaming read command in milli seconds
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_streaming_timeout(
+     libsmdev_handle_t *handle,
+     uint32_t *streaming_timeout,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_streaming_timeout";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( streaming_timeout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid streaming timeout.",
+		 function );
+
+		return( -1 );
+	}
+	*streaming_timeout = internal_handle->streaming_timeout;
+
+	return( 1 );
+}
+
+/* Sets the streaming timeout
+ * The streaming timeout is the maximum duration of a single streaming read command in milli seconds
+ * A short timeout prevents the drive from stalling on damaged areas of the disc
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_set_streaming_timeout(
+     libsmdev_handle_t *handle,
+     uint32_t streaming_timeout,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_streaming_timeout";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( streaming_timeout == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid streaming timeout value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->streaming_timeout  = streaming_timeout;
+	internal_handle->configured_values |= LIBSMDEV_TRANSPORT_PROFILE_VALUE_DEADLINE;
+
+	return( 1 );
+}
+
+/* Retrieves the number of read/write error retries
+ * Returns the 1 if succesful or -1 on error
+ */
+int libsmdev_handle_get_number_of_error_retries(
+     libsmdev_handle_t *handle,
+     uint8_t *number_of_error_retries,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_number_of_error_retries";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( number_of_error_retries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of error retries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_error_retries = internal_handle->number_of_error_retries;
+
+	return( 1 );
+}
+
+/* Sets the number of read/write error retries
+ * Returns the 1 if succesful or -1 on error
+ */
+int libsmdev_handle_set_number_of_error_retries(
+     libsmdev_handle_t *handle,
+     uint8_t number_of_error_retries,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_number_of_error_retries";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	internal_handle->number_of_error_retries = number_of_error_retries;
+	internal_handle->configured_values      |= LIBSMDEV_TRANSPORT_PROFILE_VALUE_ERROR_RETRIES;
+
+	return( 1 );
+}
+
+/* Retrieves the read/write error granularity
+ * A value of 0 represents an error granularity of the entire buffer being read/written
+ * Returns the 1 if succesful or -1 on error
+ */
+int libsmdev_handle_get_error_granularity(
+     libsmdev_handle_t *handle,
+     size_t *error_granularity,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_error_granularity";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( error_granularity == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read granularity.",
+		 function );
+
+		return( -1 );
+	}
+	*error_granularity = internal_handle->error_granularity;
+
+	return( 1 );
+}
+
+/* Sets the read/write error granularity
+ * A value of 0 represents an error granularity of the entire buffer being read/written
+ * Returns the 1 if succesful or -1 on error
+ */
+int libsmdev_handle_set_error_granularity(
+     libsmdev_handle_t *handle,
+     size_t error_granularity,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_error_granularity";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( error_granularity > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid error granularity value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->error_granularity  = error_granularity;
+	internal_handle->configured_values |= LIBSMDEV_TRANSPORT_PROFILE_VALUE_ERROR_GRANULARITY;
+
+	return( 1 );
+}
+
+/* Retrieves the read/write error flags
+ * Returns the 1 if succesful or -1 on error
+ */
+int libsmdev_handle_get_error_flags(
+     libsmdev_handle_t *handle,
+     uint8_t *error_flags,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_error_flags";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( error_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error flags.",
+		 function );
+
+		return( -1 );
+	}
+	*error_flags = internal_handle->error_flags;
+
+	return( 1 );
+}
+
+/* Sets the the read/write error flags
+ * Returns the 1 if succesful or -1 on error
+ */
+int libsmdev_handle_set_error_flags(
+     libsmdev_handle_t *handle,
+     uint8_t error_flags,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_error_flags";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( ( error_flags & ~( LIBSMDEV_ERROR_FLAG_ZERO_ON_ERROR ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported error flags.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->error_flags = error_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the number of read/write errors
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_number_of_errors(
+     libsmdev_handle_t *handle,
+     int *number_of_errors,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_number_of_errors";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( libsmdev_internal_handle_drain_write_engine(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to drain write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_get_number_of_elements(
+	     internal_handle->errors_range_list,
+	     number_of_errors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements in errors range list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a read/write error
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_error(
+     libsmdev_handle_t *handle,
+     int index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_error";
+	intptr_t *value                             = NULL;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( libsmdev_internal_handle_drain_write_engine(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to drain write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_get_range_by_index(
+	     internal_handle->errors_range_list,
+	     index,
+	     (uint64_t *) offset,
+	     (uint64_t *) size,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve error: %d from errors range list.",
+		 function,
+		 index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of mismatches of the last verify
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_number_of_mismatches(
+     libsmdev_handle_t *handle,
+     int *number_of_mismatches,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_number_of_mismatches";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( libcdata_range_list_get_number_of_elements(
+	     internal_handle->mismatches_range_list,
+	     number_of_mismatches,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements in mismatches range list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a mismatch of the last verify
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_mismatch(
+     libsmdev_handle_t *handle,
+     int index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_mismatch";
+	intptr_t *value                             = NULL;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( libcdata_range_list_get_range_by_index(
+	     internal_handle->mismatches_range_list,
+	     index,
+	     (uint64_t *) offset,
+	     (uint64_t *) size,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve mismatch: %d from mismatches range list.",
+		 function,
+		 index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the partition table from the start of the storage media
+ * A GUID partition table (GPT) takes precedence over the protective master boot record (MBR)
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_internal_handle_read_partition_table(
+     libsmdev_internal_handle_t *internal_handle,
+     size64_t media_size,
+     size_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	uint8_t *data              = NULL;
+	uint8_t *entries_data      = NULL;
+	static char *function      = "libsmdev_internal_handle_read_partition_table";
+	size_t entries_data_size   = 0;
+	ssize_t read_count         = 0;
+	off64_t entries_offset     = 0;
+	uint32_t entry_size        = 0;
+	uint32_t error_code        = 0;
+	uint32_t number_of_entries = 0;
+	int result                 = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bytes_per_sector == 0 )
+	 || ( bytes_per_sector > (size_t) LIBSMDEV_SAMPLER_MAXIMUM_SAMPLE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle->partition_table->type                 = LIBSMDEV_PARTITION_TABLE_TYPE_NONE;
+	internal_handle->partition_table->number_of_partitions = 0;
+
+	if( media_size < (size64_t) ( 2 * bytes_per_sector ) )
+	{
+		return( 1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * 2 * bytes_per_sector );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
 
-			}
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		else if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd ".\n",
-			 function,
-			 internal_handle->offset + (off64_t) buffer_offset,
-			 internal_handle->offset + (off64_t) buffer_offset,
-			 read_count );
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		goto on_error;
+	}
+	read_count = libsmdev_io_backend_read_buffer_at_offset(
+	              internal_handle->io_backend,
+	              data,
+	              2 * bytes_per_sector,
+	              0,
+	              &error_code,
+	              error );
 
-		if( read_count > (ssize_t) read_size )
+	if( read_count != (ssize_t) ( 2 * bytes_per_sector ) )
+	{
+		if( ( read_count != -1 )
+		 || ( libsmdev_write_engine_error_code_is_recoverable(
+		       error_code ) == 0 ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid read count value exceeds read size.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read partition table data.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		else if( read_count == 0 )
+		/* Media of which the first sectors cannot be read has no known partition table
+		 */
+		libcerror_error_free(
+		 error );
+
+		memory_free(
+		 data );
+
+		return( 1 );
+	}
+	result = libsmdev_partition_table_read_gpt_header(
+	          internal_handle->partition_table,
+	          &( data[ bytes_per_sector ] ),
+	          bytes_per_sector,
+	          bytes_per_sector,
+	          &entries_offset,
+	          &number_of_entries,
+	          &entry_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read GPT header.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		entries_data_size = (size_t) number_of_entries * entry_size;
+
+		if( ( entries_data_size == 0 )
+		 || ( (size64_t) entries_offset >= media_size )
+		 || ( (size64_t) entries_data_size > ( media_size - (size64_t) entries_offset ) ) )
 		{
-			return( 0 );
+			result = 0;
 		}
-		else if( read_count > 0 )
+	}
+	if( result != 0 )
+	{
+		entries_data = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * entries_data_size );
+
+		if( entries_data == NULL )
 		{
-			buffer_offset += read_count;
-			read_size     -= read_count;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries data.",
+			 function );
 
-			if( read_size == 0 )
-			{
-				break;
-			}
+			goto on_error;
 		}
-		/* Not all requested data was read or there was an error
-		 */
-		number_of_read_errors++;
+		read_count = libsmdev_io_backend_read_buffer_at_offset(
+		              internal_handle->io_backend,
+		              entries_data,
+		              entries_data_size,
+		              entries_offset,
+		              &error_code,
+		              error );
 
-#if defined( HAVE_VERBOSE_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( read_count != (ssize_t) entries_data_size )
 		{
-			libcnotify_printf(
-			 "%s: read error: %" PRIi16 " at offset %" PRIi64 ".\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read GPT entries at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 			 function,
-			 number_of_read_errors,
-			 internal_handle->offset + buffer_offset );
+			 entries_offset,
+			 entries_offset );
+
+			goto on_error;
 		}
-#endif
-		if( number_of_read_errors > (int16_t) internal_handle->number_of_error_retries )
+		if( libsmdev_partition_table_read_gpt_entries(
+		     internal_handle->partition_table,
+		     entries_data,
+		     entries_data_size,
+		     number_of_entries,
+		     entry_size,
+		     bytes_per_sector,
+		     error ) != 1 )
 		{
-			if( internal_handle->error_granularity > 0 )
-			{
-				error_granularity_size = internal_handle->error_granularity;
-			}
-			else
-			{
-				error_granularity_size = buffer_size;
-			}
-			error_granularity_buffer_offset = ( buffer_offset / error_granularity_size ) * error_granularity_size;
-			error_granularity_skip_size     = ( error_granularity_buffer_offset + error_granularity_size ) - buffer_offset;
-
-			/* Check if error granularity skip is still within range of the buffer
-			 */
-			if( error_granularity_skip_size > read_size )
-			{
-				error_granularity_skip_size = read_size;
-			}
-			if( ( internal_handle->error_flags & LIBSMDEV_ERROR_FLAG_ZERO_ON_ERROR ) != 0 )
-			{
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: zero-ing buffer of size: %" PRIzd " bytes at offset %" PRIzd ".\n",
-					 function,
-					 error_granularity_size,
-					 error_granularity_buffer_offset );
-				}
-#endif
-				if( memory_set(
-				     &( buffer[ error_granularity_buffer_offset ] ),
-				     0,
-				     error_granularity_size ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to zero buffer on error.",
-					 function );
-
-					return( -1 );
-				}
-				read_error_size = error_granularity_size;
-			}
-			else
-			{
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: zero-ing remainder of buffer of size: %" PRIzd " bytes at offset %" PRIzd ".\n",
-					 function,
-					 error_granularity_skip_size,
-					 buffer_offset );
-				}
-#endif
-				if( memory_set(
-				     &( buffer[ buffer_offset ] ),
-				     0,
-				     error_granularity_skip_size ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-					 "%s: unable to zero remainder of buffer on error.",
-					 function );
-
-					return( -1 );
-				}
-				read_error_size = error_granularity_skip_size;
-			}
-#if defined( HAVE_VERBOSE_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: adding read error at offset: %" PRIi64 " (0x%08" PRIx64 "), number of bytes: %" PRIzd ".\n",
-				 function,
-				 current_offset,
-				 current_offset,
-				 read_error_size );
-			}
-#endif
-			result = libcdata_range_list_insert_range(
-			          internal_handle->errors_range_list,
-			          (uint64_t) current_offset,
-			          (uint64_t) read_error_size,
-			          NULL,
-			          NULL,
-			          NULL,
-			          error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to insert read error to range list.",
-				 function );
-
-				return( -1 );
-			}
-#if defined( HAVE_VERBOSE_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: skipping %" PRIu32 " bytes.\n",
-				 function,
-				 error_granularity_skip_size );
-			}
-#endif
-			if( libcfile_file_seek_offset(
-			     internal_handle->device_file,
-			     error_granularity_skip_size,
-			     SEEK_CUR,
-			     error ) == -1 )
-			{
-				libcerror_system_set_error(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_SEEK_FAILED,
-				 errno,
-				 "%s: unable to skip %" PRIu32 " bytes after read error.",
-				 function,
-				 error_granularity_skip_size );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read GPT entries.",
+			 function );
 
-				return( -1 );
-			}
-			read_size            -= error_granularity_skip_size;
-			buffer_offset        += error_granularity_skip_size;
-			number_of_read_errors = 0;
+			goto on_error;
 		}
-	}
-	internal_handle->offset += buffer_offset;
-
-	return( (ssize_t) buffer_offset );
-}
-
-/* Reads a buffer at a specific offset
- * Returns the number of bytes read or -1 on error
- */
-ssize_t libsmdev_handle_read_buffer_at_offset(
-         libsmdev_handle_t *handle,
-         uint8_t *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
-{
-	static char *function = "libsmdev_handle_read_buffer_at_offset";
-	ssize_t read_count    = 0;
+		memory_free(
+		 entries_data );
 
-	if( libsmdev_handle_seek_offset(
-	     handle,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+		entries_data = NULL;
+	}
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
-		 function );
+		result = libsmdev_partition_table_read_mbr(
+		          internal_handle->partition_table,
+		          data,
+		          bytes_per_sector,
+		          bytes_per_sector,
+		          error );
 
-		return( -1 );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read MBR.",
+			 function );
+
+			goto on_error;
+		}
 	}
-	read_count = libsmdev_handle_read_buffer(
-	              handle,
-	              buffer,
-	              buffer_size,
-	              error );
+	memory_free(
+	 data );
 
-	if( read_count < 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer.",
-		 function );
+	return( 1 );
 
-		return( -1 );
+on_error:
+	if( entries_data != NULL )
+	{
+		memory_free(
+		 entries_data );
 	}
-	return( read_count );
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
 }
 
-/* Writes a buffer
- * Returns the number of bytes written or -1 on error
+/* Samples the storage media for a quick profile of its contents
+ * Reads a number of sector aligned samples, chosen at random or stratified over the media,
+ * and determines per region the fraction of zero sectors, the fraction of high entropy samples
+ * and the entropy of the sampled bytes, see libsmdev_handle_get_sample_region_statistics
+ * The samples are divided over the number of read threads
+ * The partition table at the start of the media is read as well
+ * Returns 1 if successful, 0 if aborted or -1 on error
  */
-ssize_t libsmdev_handle_write_buffer(
-         libsmdev_handle_t *handle,
-         const uint8_t *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libsmdev_handle_sample(
+     libsmdev_handle_t *handle,
+     int sampling_method,
+     int number_of_samples,
+     size_t sample_size,
+     int number_of_regions,
+     libcerror_error_t **error )
 {
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_write_buffer";
-	ssize_t write_count                         = 0;
+	libsmdev_io_backend_t **io_backends         = NULL;
+	libsmdev_sampler_t *sampler                 = NULL;
+	static char *function                       = "libsmdev_handle_sample";
+	size64_t media_size                         = 0;
+	uint32_t bytes_per_sector                   = 0;
+	int number_of_workers                       = 1;
+	int result                                  = 0;
+	int worker_index                            = 0;
 
 	if( handle == NULL )
 	{
@@ -1667,202 +9792,373 @@ ssize_t libsmdev_handle_write_buffer(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( internal_handle->device_file == NULL )
+	if( internal_handle->io_backend == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing device file.",
+		 "%s: invalid handle - missing IO backend.",
 		 function );
 
 		return( -1 );
 	}
-	write_count = libcfile_file_write_buffer(
-	               internal_handle->device_file,
-	               buffer,
-	               buffer_size,
-	               error );
+	if( ( sampling_method != LIBSMDEV_SAMPLING_METHOD_RANDOM )
+	 && ( sampling_method != LIBSMDEV_SAMPLING_METHOD_STRATIFIED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sampling method.",
+		 function );
 
-	if( write_count < 0 )
+		return( -1 );
+	}
+	/* Data that is still queued by the write engine is not seen by the IO backends of the workers
+	 */
+	if( libsmdev_internal_handle_drain_write_engine(
+	     internal_handle,
+	     error ) != 1 )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 errno,
-		 "%s: unable to write to device file.",
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to drain write engine.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle->offset += write_count;
-
-	return( write_count );
-}
-
-/* Writes a buffer at a specific offset
- * Returns the number of bytes written or -1 on error
- */
-ssize_t libsmdev_handle_write_buffer_at_offset(
-         libsmdev_handle_t *handle,
-         const uint8_t *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
-{
-	static char *function = "libsmdev_handle_write_buffer_at_offset";
-	ssize_t write_count   = 0;
-
-	if( libsmdev_handle_seek_offset(
+	if( libsmdev_handle_get_media_size(
 	     handle,
-	     offset,
-	     SEEK_SET,
-	     error ) == -1 )
+	     &media_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
 		 function );
 
 		return( -1 );
 	}
-	write_count = libsmdev_handle_write_buffer(
-	               handle,
-	               buffer,
-	               buffer_size,
-	               error );
+	result = libsmdev_handle_get_bytes_per_sector(
+	          handle,
+	          &bytes_per_sector,
+	          error );
 
-	if( write_count < 0 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_WRITE_FAILED,
-		 "%s: unable to write buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes per sector.",
 		 function );
 
 		return( -1 );
 	}
-	return( write_count );
-}
-
-/* Seeks a certain offset
- * Returns the offset if seek is successful or -1 on error
- */
-off64_t libsmdev_handle_seek_offset(
-         libsmdev_handle_t *handle,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
-{
-	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_seek_offset";
+	else if( result == 0 )
+	{
+		bytes_per_sector = 512;
+	}
+	if( libcdata_array_empty(
+	     internal_handle->sample_regions_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sample_region_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty sample regions array.",
+		 function );
 
-	if( handle == NULL )
+		return( -1 );
+	}
+	if( libsmdev_internal_handle_read_partition_table(
+	     internal_handle,
+	     media_size,
+	     (size_t) bytes_per_sector,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read partition table.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libsmdev_internal_handle_t *) handle;
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Additional workers require their own IO backend on the storage media device
+	 */
+	if( internal_handle->filename != NULL )
+	{
+		number_of_workers = internal_handle->number_of_read_threads;
 
-	if( internal_handle->device_file == NULL )
+		if( number_of_workers > LIBSMDEV_SAMPLER_MAXIMUM_NUMBER_OF_WORKERS )
+		{
+			number_of_workers = LIBSMDEV_SAMPLER_MAXIMUM_NUMBER_OF_WORKERS;
+		}
+		else if( number_of_workers <= 0 )
+		{
+			number_of_workers = 1;
+		}
+	}
+#endif
+	io_backends = (libsmdev_io_backend_t **) memory_allocate(
+	                                          sizeof( libsmdev_io_backend_t * ) * number_of_workers );
+
+	if( io_backends == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing device file.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO backends.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	offset = libcfile_file_seek_offset(
-	          internal_handle->device_file,
-	          offset,
-	          whence,
-	          error );
+	io_backends[ 0 ] = internal_handle->io_backend;
 
-	if( offset == -1 )
+	for( worker_index = 1;
+	     worker_index < number_of_workers;
+	     worker_index++ )
 	{
-		libcerror_system_set_error(
+		io_backends[ worker_index ] = NULL;
+	}
+	for( worker_index = 1;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libsmdev_io_backend_initialize_by_type(
+		     &( io_backends[ worker_index ] ),
+		     internal_handle->io_backend_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create IO backend of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libsmdev_io_backend_open_wide(
+		          io_backends[ worker_index ],
+		          internal_handle->filename,
+		          LIBSMDEV_OPEN_READ,
+		          error );
+#else
+		result = libsmdev_io_backend_open(
+		          io_backends[ worker_index ],
+		          internal_handle->filename,
+		          LIBSMDEV_OPEN_READ,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open IO backend of worker: %d.",
+			 function,
+			 worker_index );
+
+			libsmdev_io_backend_free(
+			 &( io_backends[ worker_index ] ),
+			 NULL );
+
+			goto on_error;
+		}
+	}
+	if( libsmdev_sampler_initialize(
+	     &sampler,
+	     sampling_method,
+	     media_size,
+	     (size_t) bytes_per_sector,
+	     sample_size,
+	     number_of_samples,
+	     number_of_regions,
+	     io_backends,
+	     number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 errno,
-		 "%s: unable to seek offset in device file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sampler.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_handle->offset = offset;
+	internal_handle->sampler = sampler;
 
-	return( offset );
-}
+	result = 0;
 
-/* Retrieves the current offset of the (media) data
- * Returns 1 if successful or -1 on error
- */
-int libsmdev_handle_get_offset(
-     libsmdev_handle_t *handle,
-     off64_t *offset,
-     libcerror_error_t **error )
-{
-	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_offset";
+	if( internal_handle->abort == 0 )
+	{
+		result = libsmdev_sampler_run(
+		          sampler,
+		          error );
 
-	if( handle == NULL )
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to sample media.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		if( libsmdev_sampler_get_regions(
+		     sampler,
+		     internal_handle->sample_regions_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sample regions.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_handle->sampler = NULL;
+
+	if( libsmdev_sampler_free(
+	     &sampler,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sampler.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_handle = (libsmdev_internal_handle_t *) handle;
+	for( worker_index = 1;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libsmdev_io_backend_close(
+		     io_backends[ worker_index ],
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close IO backend of worker: %d.",
+			 function,
+			 worker_index );
 
-	if( offset == NULL )
+			goto on_error;
+		}
+		if( libsmdev_io_backend_free(
+		     &( io_backends[ worker_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO backend of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 io_backends );
+
+	io_backends = NULL;
+
+	if( libsmdev_io_backend_seek_offset(
+	     internal_handle->io_backend,
+	     internal_handle->offset,
+	     SEEK_SET,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 internal_handle->offset,
+		 internal_handle->offset );
 
 		return( -1 );
 	}
-	*offset = internal_handle->offset;
+	return( result );
 
-	return( 1 );
+on_error:
+	internal_handle->sampler = NULL;
+
+	if( sampler != NULL )
+	{
+		libsmdev_sampler_free(
+		 &sampler,
+		 NULL );
+	}
+	if( io_backends != NULL )
+	{
+		for( worker_index = 1;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			if( io_backends[ worker_index ] != NULL )
+			{
+				libsmdev_io_backend_close(
+				 io_backends[ worker_index ],
+				 NULL );
+				libsmdev_io_backend_free(
+				 &( io_backends[ worker_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 io_backends );
+	}
+	libcdata_array_empty(
+	 internal_handle->sample_regions_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sample_region_free,
+	 NULL );
+
+	return( -1 );
 }
 
-/* Retrieves the filename size of the file handle
- * The filename size includes the end of string character
- * Returns 1 if succesful or -1 on error
+/* Retrieves the number of regions of the last sampling
+ * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_get_filename_size(
+int libsmdev_handle_get_number_of_sample_regions(
      libsmdev_handle_t *handle,
-     size_t *filename_size,
+     int *number_of_regions,
      libcerror_error_t **error )
 {
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_filename_size";
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result                                  = 0;
-#endif
+	static char *function                       = "libsmdev_handle_get_number_of_sample_regions";
 
 	if( handle == NULL )
 	{
@@ -1877,101 +10173,39 @@ int libsmdev_handle_get_filename_size(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( internal_handle->filename == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->sample_regions_array,
+	     number_of_regions,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing filename.",
-		 function );
-
-		return( -1 );
-	}
-	if( filename_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename size.",
-		 function );
-
-		return( -1 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          filename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          filename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          libclocale_codepage,
-		          filename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          libclocale_codepage,
-		          filename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine filename size.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries in sample regions array.",
 		 function );
 
 		return( -1 );
 	}
-#else
-	*filename_size = internal_handle->filename_size;
-#endif
 	return( 1 );
 }
 
-/* Retrieves the filename of the file handle
- * The filename size should include the end of string character
- * Returns 1 if succesful or -1 on error
+/* Retrieves a region of the last sampling
+ * The number of samples contains the samples that were read and whose statistics are part of the region
+ * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_get_filename(
+int libsmdev_handle_get_sample_region(
      libsmdev_handle_t *handle,
-     char *filename,
-     size_t filename_size,
+     int region_index,
+     off64_t *offset,
+     size64_t *size,
+     uint64_t *number_of_samples,
+     uint64_t *number_of_unreadable_samples,
      libcerror_error_t **error )
 {
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_filename";
-	size_t narrow_filename_size                 = 0;
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result                                  = 0;
-#endif
+	libsmdev_sample_region_t *sample_region     = NULL;
+	static char *function                       = "libsmdev_handle_get_sample_region";
 
 	if( handle == NULL )
 	{
@@ -1986,181 +10220,103 @@ int libsmdev_handle_get_filename(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( internal_handle->filename == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing filename.",
-		 function );
-
-		return( -1 );
-	}
-	if( filename == NULL )
+	if( offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
-		 function );
-
-		return( -1 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          &narrow_filename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          &narrow_filename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_size_from_utf32(
-		          (libuna_utf32_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          libclocale_codepage,
-		          &narrow_filename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_size_from_utf16(
-		          (libuna_utf16_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          libclocale_codepage,
-		          &narrow_filename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine filename size.",
-		 function );
-
-		return( -1 );
-	}
-#else
-	narrow_filename_size = internal_handle->filename_size;
-#endif
-	if( filename_size < narrow_filename_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: filename too small.",
+		 "%s: invalid offset.",
 		 function );
 
-		return( -1 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_copy_from_utf32(
-		          (libuna_utf8_character_t *) filename,
-		          filename_size,
-		          (libuna_utf32_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_copy_from_utf16(
-		          (libuna_utf8_character_t *) filename,
-		          filename_size,
-		          (libuna_utf16_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		return( -1 );
 	}
-	else
+	if( size == NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_copy_from_utf32(
-		          (uint8_t *) filename,
-		          filename_size,
-		          libclocale_codepage,
-		          (libuna_utf32_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_copy_from_utf16(
-		          (uint8_t *) filename,
-		          filename_size,
-		          libclocale_codepage,
-		          (libuna_utf16_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	if( number_of_samples == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set filename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of samples.",
 		 function );
 
 		return( -1 );
 	}
-#else
-	if( system_string_copy(
-	     filename,
-	     internal_handle->filename,
-	     internal_handle->filename_size ) == NULL )
+	if( number_of_unreadable_samples == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set filename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of unreadable samples.",
 		 function );
 
 		return( -1 );
 	}
-	filename[ internal_handle->filename_size - 1 ] = 0;
-#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_handle->sample_regions_array,
+	     region_index,
+	     (intptr_t **) &sample_region,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sample region: %d from array.",
+		 function,
+		 region_index );
+
+		return( -1 );
+	}
+	if( sample_region == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing sample region: %d.",
+		 function,
+		 region_index );
+
+		return( -1 );
+	}
+	*offset                       = sample_region->offset;
+	*size                         = sample_region->size;
+	*number_of_samples            = sample_region->number_of_samples;
+	*number_of_unreadable_samples = sample_region->number_of_unreadable_samples;
+
 	return( 1 );
 }
 
-/* Sets the filename for the file handle
- * Returns 1 if succesful or -1 on error
+/* Retrieves the statistics of a region of the last sampling
+ * The zero fraction is the fraction of the sampled sectors that only contain zero bytes,
+ * the high entropy fraction is the fraction of the samples that are likely encrypted or compressed
+ * and the entropy, in bits per byte, is calculated over all the sampled bytes of the region
+ * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_set_filename(
+int libsmdev_handle_get_sample_region_statistics(
      libsmdev_handle_t *handle,
-     const char *filename,
-     size_t filename_length,
+     int region_index,
+     double *zero_fraction,
+     double *high_entropy_fraction,
+     double *entropy,
      libcerror_error_t **error )
 {
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_set_filename";
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result                                  = 0;
-#endif
+	libsmdev_sample_region_t *sample_region     = NULL;
+	static char *function                       = "libsmdev_handle_get_sample_region_statistics";
 
 	if( handle == NULL )
 	{
@@ -2175,228 +10331,271 @@ int libsmdev_handle_set_filename(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( internal_handle->device_file != NULL )
+	if( libcdata_array_get_entry_by_index(
+	     internal_handle->sample_regions_array,
+	     region_index,
+	     (intptr_t **) &sample_region,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - device file value already set.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sample region: %d from array.",
+		 function,
+		 region_index );
 
 		return( -1 );
 	}
-	if( filename == NULL )
+	if( libsmdev_sample_region_get_statistics(
+	     sample_region,
+	     zero_fraction,
+	     high_entropy_fraction,
+	     entropy,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics of sample region: %d.",
+		 function,
+		 region_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the partition table type found by the last sampling
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_partition_table_type(
+     libsmdev_handle_t *handle,
+     uint8_t *partition_table_type,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_partition_table_type";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( filename_length == 0 )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( partition_table_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid filename length is zero.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition table type.",
 		 function );
 
 		return( -1 );
 	}
-	if( filename_length >= (size_t) SSIZE_MAX )
+	*partition_table_type = internal_handle->partition_table->type;
+
+	return( 1 );
+}
+
+/* Retrieves the number of partitions found by the last sampling
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_number_of_partitions(
+     libsmdev_handle_t *handle,
+     int *number_of_partitions,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_number_of_partitions";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid filename length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->filename != NULL )
-	{
-		memory_free(
-		 internal_handle->filename );
+	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-		internal_handle->filename      = NULL;
-		internal_handle->filename_size = 0;
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) filename,
-		          filename_length,
-		          &( internal_handle->filename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) filename,
-		          filename_length,
-		          &( internal_handle->filename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) filename,
-		          filename_length,
-		          libclocale_codepage,
-		          &( internal_handle->filename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) filename,
-		          filename_length,
-		          libclocale_codepage,
-		          &( internal_handle->filename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
+	if( number_of_partitions == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine filename size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of partitions.",
 		 function );
 
 		return( -1 );
 	}
-#else
-	internal_handle->filename_size = filename_length + 1;
-#endif
-	internal_handle->filename = system_string_allocate(
-	                             internal_handle->filename_size );
+	*number_of_partitions = internal_handle->partition_table->number_of_partitions;
 
-	if( internal_handle->filename == NULL )
+	return( 1 );
+}
+
+/* Retrieves a partition found by the last sampling
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_partition(
+     libsmdev_handle_t *handle,
+     int partition_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_partition";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create filename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_utf8(
-		          (libuna_utf32_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          (libuna_utf8_character_t *) filename,
-		          filename_length,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_utf8(
-		          (libuna_utf16_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          (libuna_utf8_character_t *) filename,
-		          filename_length,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( libsmdev_partition_table_get_partition(
+	     internal_handle->partition_table,
+	     partition_index,
+	     offset,
+	     size,
+	     error ) != 1 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_byte_stream(
-		          (libuna_utf32_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          (uint8_t *) filename,
-		          filename_length,
-		          libclocale_codepage,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_byte_stream(
-		          (libuna_utf16_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          (uint8_t *) filename,
-		          filename_length,
-		          libclocale_codepage,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition: %d.",
+		 function,
+		 partition_index );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	return( 1 );
+}
+
+
+/* Sets the probe cache directory
+ * The probe cache stores the media information and table of contents of a device,
+ * keyed by the device identity, so that these do not need to be probed on every open
+ * Set directory to NULL to disable the probe cache
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_set_probe_cache_directory(
+     libsmdev_handle_t *handle,
+     const char *directory,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_probe_cache_directory";
+	size_t directory_length                     = 0;
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set filename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->probe_cache_directory != NULL )
+	{
 		memory_free(
-		 internal_handle->filename );
+		 internal_handle->probe_cache_directory );
 
-		internal_handle->filename      = NULL;
-		internal_handle->filename_size = 0;
+		internal_handle->probe_cache_directory = NULL;
+	}
+	if( directory == NULL )
+	{
+		return( 1 );
+	}
+	directory_length = narrow_string_length(
+	                    directory );
+
+	if( ( directory_length == 0 )
+	 || ( directory_length >= (size_t) LIBSMDEV_PROBE_CACHE_MAXIMUM_PATH_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory length value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
-#else
-	if( system_string_copy(
-	     internal_handle->filename,
-	     filename,
-	     filename_length + 1 ) == NULL )
+	internal_handle->probe_cache_directory = narrow_string_allocate(
+	                                          directory_length + 1 );
+
+	if( internal_handle->probe_cache_directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set filename.",
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create probe cache directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_copy(
+	     internal_handle->probe_cache_directory,
+	     directory,
+	     directory_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy probe cache directory.",
 		 function );
 
 		memory_free(
-		 internal_handle->filename );
+		 internal_handle->probe_cache_directory );
 
-		internal_handle->filename      = NULL;
-		internal_handle->filename_size = 0;
+		internal_handle->probe_cache_directory = NULL;
 
 		return( -1 );
 	}
-	internal_handle->filename[ filename_length ] = 0;
-#endif
+	internal_handle->probe_cache_directory[ directory_length ] = 0;
+
 	return( 1 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Retrieves the filename size of the file handle
- * The filename size includes the end of string character
- * Returns 1 if succesful or -1 on error
+/* Invalidates the probe cache entry of the device
+ * Returns 1 if successful, 0 if no entry was found or -1 on error
  */
-int libsmdev_handle_get_filename_size_wide(
+int libsmdev_handle_invalidate_probe_cache(
      libsmdev_handle_t *handle,
-     size_t *filename_size,
      libcerror_error_t **error )
 {
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_filename_size_wide";
-
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	static char *function                       = "libsmdev_handle_invalidate_probe_cache";
 	int result                                  = 0;
-#endif
 
 	if( handle == NULL )
 	{
@@ -2411,101 +10610,86 @@ int libsmdev_handle_get_filename_size_wide(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( internal_handle->filename == NULL )
+	if( internal_handle->io_backend == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing filename.",
+		 "%s: invalid handle - missing IO backend.",
 		 function );
 
 		return( -1 );
 	}
-	if( filename_size == NULL )
+	result = libsmdev_probe_cache_remove(
+	          internal_handle,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename size.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+		 "%s: unable to remove probe cache entry.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	*filename_size = internal_handle->filename_size;
-#else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          filename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          filename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
+	return( result );
+}
+
+/* Retrieves the IO backend type
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_io_backend_type(
+     libsmdev_handle_t *handle,
+     int *io_backend_type,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_io_backend_type";
+
+	if( handle == NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          libclocale_codepage,
-		          filename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          libclocale_codepage,
-		          filename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( io_backend_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine filename size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend type.",
 		 function );
 
 		return( -1 );
 	}
-#endif
+	*io_backend_type = internal_handle->io_backend_type;
+
 	return( 1 );
 }
 
-/* Retrieves the filename of the file handle
- * The filename size should include the end of string character
- * Returns 1 if succesful or -1 on error
+/* Sets the IO backend type
+ * The IO backend type is used when the handle is opened, hence it cannot be changed while the handle is open
+ * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_get_filename_wide(
+int libsmdev_handle_set_io_backend_type(
      libsmdev_handle_t *handle,
-     wchar_t *filename,
-     size_t filename_size,
+     int io_backend_type,
      libcerror_error_t **error )
 {
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_filename_wide";
-	size_t wide_filename_size                   = 0;
-
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result                                  = 0;
-#endif
+	static char *function                       = "libsmdev_handle_set_io_backend_type";
 
 	if( handle == NULL )
 	{
@@ -2520,181 +10704,196 @@ int libsmdev_handle_get_filename_wide(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( internal_handle->filename == NULL )
+	if( internal_handle->io_backend != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing filename.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - IO backend value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( filename == NULL )
+	if( ( io_backend_type != LIBSMDEV_IO_BACKEND_TYPE_FILE )
+	 && ( io_backend_type != LIBSMDEV_IO_BACKEND_TYPE_SIMULATED ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
-		 function );
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported IO backend type: %d.",
+		 function,
+		 io_backend_type );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	wide_filename_size = internal_handle->filename_size;
-#else
-	if( libclocale_codepage == 0 )
+	internal_handle->io_backend_type = io_backend_type;
+
+	return( 1 );
+}
+
+/* Retrieves the number of read threads
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_number_of_read_threads(
+     libsmdev_handle_t *handle,
+     int *number_of_read_threads,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_number_of_read_threads";
+
+	if( handle == NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          &wide_filename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          &wide_filename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( number_of_read_threads == NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_byte_stream(
-		          (uint8_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          libclocale_codepage,
-		          &wide_filename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_byte_stream(
-		          (uint8_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          libclocale_codepage,
-		          &wide_filename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of read threads.",
+		 function );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	*number_of_read_threads = internal_handle->number_of_read_threads;
+
+	return( 1 );
+}
+
+/* Sets the number of read threads
+ * More than 1 read thread reads the media in stripes using a separate IO backend per thread,
+ * which requires multi-thread support. The value cannot be changed while the handle is open
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_set_number_of_read_threads(
+     libsmdev_handle_t *handle,
+     int number_of_read_threads,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_number_of_read_threads";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine filename size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( filename_size < wide_filename_size )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: filename too small.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - IO backend value already set.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( system_string_copy(
-	     filename,
-	     internal_handle->filename,
-	     internal_handle->filename_size ) == NULL )
+	if( ( number_of_read_threads <= 0 )
+	 || ( number_of_read_threads > LIBSMDEV_PARALLEL_READER_MAXIMUM_NUMBER_OF_WORKERS ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set filename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of read threads value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	filename[ internal_handle->filename_size - 1 ] = 0;
-#else
-	if( libclocale_codepage == 0 )
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_read_threads > 1 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_utf8(
-		          (libuna_utf32_character_t *) filename,
-		          filename_size,
-		          (libuna_utf8_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_utf8(
-		          (libuna_utf16_character_t *) filename,
-		          filename_size,
-		          (libuna_utf8_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of read threads: %d - multi-thread support not available.",
+		 function,
+		 number_of_read_threads );
+
+		return( -1 );
 	}
-	else
+#endif
+	internal_handle->number_of_read_threads = number_of_read_threads;
+	internal_handle->configured_values     |= LIBSMDEV_TRANSPORT_PROFILE_VALUE_QUEUE_DEPTH;
+
+	return( 1 );
+}
+
+/* Retrieves the read stripe size
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_read_stripe_size(
+     libsmdev_handle_t *handle,
+     size_t *read_stripe_size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_read_stripe_size";
+
+	if( handle == NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_byte_stream(
-		          (libuna_utf32_character_t *) filename,
-		          filename_size,
-		          (uint8_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          libclocale_codepage,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_byte_stream(
-		          (libuna_utf16_character_t *) filename,
-		          filename_size,
-		          (uint8_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          libclocale_codepage,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( read_stripe_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set filename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read stripe size.",
 		 function );
 
 		return( -1 );
 	}
-#endif
+	*read_stripe_size = internal_handle->read_stripe_size;
+
 	return( 1 );
 }
 
-/* Sets the filename for the file handle
- * Returns 1 if succesful or -1 on error
+/* Sets the read stripe size
+ * The read stripe size is the size of the blocks read by the read threads
+ * and cannot be changed while the handle is open
+ * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_set_filename_wide(
+int libsmdev_handle_set_read_stripe_size(
      libsmdev_handle_t *handle,
-     const wchar_t *filename,
-     size_t filename_length,
+     size_t read_stripe_size,
      libcerror_error_t **error )
 {
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_set_filename_wide";
-
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result                                  = 0;
-#endif
+	static char *function                       = "libsmdev_handle_set_read_stripe_size";
 
 	if( handle == NULL )
 	{
@@ -2709,981 +10908,1244 @@ int libsmdev_handle_set_filename_wide(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( internal_handle->device_file != NULL )
+	if( internal_handle->io_backend != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid handle - device file value already set.",
+		 "%s: invalid handle - IO backend value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( filename == NULL )
+	if( ( read_stripe_size == 0 )
+	 || ( read_stripe_size > (size_t) LIBSMDEV_PARALLEL_READER_MAXIMUM_STRIPE_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read stripe size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( filename_length == 0 )
+	internal_handle->read_stripe_size   = read_stripe_size;
+	internal_handle->configured_values |= LIBSMDEV_TRANSPORT_PROFILE_VALUE_REQUEST_SIZE;
+
+	return( 1 );
+}
+
+/* Retrieves the maximum read gap size
+ * Read requests that are no further apart than the maximum read gap size are read as a single extent
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_maximum_read_gap_size(
+     libsmdev_handle_t *handle,
+     size_t *maximum_read_gap_size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_maximum_read_gap_size";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid filename length is zero.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( filename_length >= (size_t) SSIZE_MAX )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( maximum_read_gap_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid filename length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum read gap size.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->filename != NULL )
+	*maximum_read_gap_size = internal_handle->maximum_read_gap_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum read gap size
+ * A value of 0 only coalesces read requests that are adjacent or overlap,
+ * which is preferable for media without a seek penalty
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_set_maximum_read_gap_size(
+     libsmdev_handle_t *handle,
+     size_t maximum_read_gap_size,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_maximum_read_gap_size";
+
+	if( handle == NULL )
 	{
-		memory_free(
-		 internal_handle->filename );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-		 internal_handle->filename      = NULL;
-		 internal_handle->filename_size = 0;
+		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	internal_handle->filename_size = filename_length + 1;
-#else
-	if( libclocale_codepage == 0 )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( maximum_read_gap_size > (size_t) LIBSMDEV_READ_SCHEDULER_MAXIMUM_EXTENT_SIZE )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) filename,
-		          filename_length,
-		          &( internal_handle->filename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) filename,
-		          filename_length,
-		          &( internal_handle->filename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum read gap size value out of bounds.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	internal_handle->maximum_read_gap_size = maximum_read_gap_size;
+
+	return( 1 );
+}
+
+/* Retrieves the access pattern
+ * This is the configured access pattern or the access pattern detected from the reads
+ * LIBSMDEV_ACCESS_PATTERN_AUTOMATIC is returned if no access pattern was detected yet
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_access_pattern(
+     libsmdev_handle_t *handle,
+     int *access_pattern,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_access_pattern";
+
+	if( handle == NULL )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_size_from_utf32(
-		          (libuna_utf32_character_t *) filename,
-		          filename_length,
-		          libclocale_codepage,
-		          &( internal_handle->filename_size ),
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_size_from_utf16(
-		          (libuna_utf16_character_t *) filename,
-		          filename_length,
-		          libclocale_codepage,
-		          &( internal_handle->filename_size ),
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( access_pattern == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine filename size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access pattern.",
 		 function );
 
 		return( -1 );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	*access_pattern = internal_handle->read_ahead->access_pattern;
 
-	internal_handle->filename = system_string_allocate(
-	                             internal_handle->filename_size );
+	return( 1 );
+}
 
-	if( internal_handle->filename == NULL )
+/* Sets the access pattern
+ * By default the access pattern is LIBSMDEV_ACCESS_PATTERN_AUTOMATIC, which detects
+ * sequential and random access from the reads and tunes the read-ahead of the device accordingly
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_set_access_pattern(
+     libsmdev_handle_t *handle,
+     int access_pattern,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_access_pattern";
+
+	if( handle == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create filename.",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( system_string_copy(
-	     internal_handle->filename,
-	     filename,
-	     filename_length + 1 ) == NULL )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( ( access_pattern != LIBSMDEV_ACCESS_PATTERN_AUTOMATIC )
+	 && ( access_pattern != LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL )
+	 && ( access_pattern != LIBSMDEV_ACCESS_PATTERN_RANDOM ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to set filename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access pattern.",
 		 function );
 
-		memory_free(
-		 internal_handle->filename );
-
-		internal_handle->filename      = NULL;
-		internal_handle->filename_size = 0;
-
 		return( -1 );
 	}
-	internal_handle->filename[ filename_length ] = 0;
-#else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_copy_from_utf32(
-		          (libuna_utf8_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          (libuna_utf32_character_t *) filename,
-		          filename_length,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_copy_from_utf16(
-		          (libuna_utf8_character_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          (libuna_utf16_character_t *) filename,
-		          filename_length,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
+	internal_handle->read_ahead->configured_access_pattern  = access_pattern;
+	internal_handle->read_ahead->number_of_sequential_reads = 0;
+	internal_handle->read_ahead->number_of_random_reads     = 0;
+
+	if( ( internal_handle->io_backend != NULL )
+	 && ( access_pattern != internal_handle->read_ahead->access_pattern ) )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_copy_from_utf32(
-		          (uint8_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          libclocale_codepage,
-		          (libuna_utf32_character_t *) filename,
-		          filename_length,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_copy_from_utf16(
-		          (uint8_t *) internal_handle->filename,
-		          internal_handle->filename_size,
-		          libclocale_codepage,
-		          (libuna_utf16_character_t *) filename,
-		          filename_length,
-		          error );
-#else
-#error Unsupported size of wchar_t
-#endif /* SIZEOF_WCHAR_T */
+		internal_handle->read_ahead->access_pattern     = access_pattern;
+		internal_handle->read_ahead->drop_behind_offset = internal_handle->offset;
+
+		if( libsmdev_internal_handle_apply_access_pattern(
+		     internal_handle,
+		     access_pattern,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to apply access pattern.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	if( result != 1 )
+	return( 1 );
+}
+
+/* Retrieves the number of write buffers
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_number_of_write_buffers(
+     libsmdev_handle_t *handle,
+     int *number_of_write_buffers,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_number_of_write_buffers";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set filename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
-		memory_free(
-		 internal_handle->filename );
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-		internal_handle->filename      = NULL;
-		internal_handle->filename_size = 0;
+	if( number_of_write_buffers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of write buffers.",
+		 function );
 
 		return( -1 );
 	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+	*number_of_write_buffers = internal_handle->number_of_write_buffers;
 
 	return( 1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Determines the media information
- * Returns 1 if successful, 0 if no media information available or -1 on error
+/* Sets the number of write buffers
+ * 0 writes the data directly, 1 coalesces writes into sector aligned buffers
+ * and more than 1 writes the buffers behind the caller using a writer thread
+ * The number of write buffers cannot be changed while the handle is open
+ * Returns 1 if successful or -1 on error
  */
-int libsmdev_internal_handle_determine_media_information(
-     libsmdev_internal_handle_t *internal_handle,
+int libsmdev_handle_set_number_of_write_buffers(
+     libsmdev_handle_t *handle,
+     int number_of_write_buffers,
      libcerror_error_t **error )
 {
-#if defined( WINAPI )
-	STORAGE_PROPERTY_QUERY query;
-#elif defined( HDIO_GET_IDENTITY )
-	struct hd_driveid device_configuration;
-#endif
-	uint8_t *response      = NULL;
-	static char *function  = "libsmdev_internal_handle_determine_media_information";
-
-#if defined( WINAPI )
-	size_t response_size   = 1024;
-	size_t string_length   = 0;
-	ssize_t read_count     = 0;
-
-#else
-	size_t response_size   = 255;
-
-#if defined( HAVE_SCSI_SG_H )
-	ssize_t response_count = 0;
-#endif
-#endif
-#if defined( HAVE_SCSI_SG_H ) || defined( HDIO_GET_IDENTITY ) || defined( HAVE_LINUX_CDROM_H ) || defined( WINAPI )
-	ssize_t result         = 0;
-#endif
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_number_of_write_buffers";
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid device handle.",
+		 "%s: invalid handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->media_information_set != 0 )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend != NULL )
 	{
-		return( 1 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - IO backend value already set.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_handle->device_file == NULL )
+	if( ( number_of_write_buffers < 0 )
+	 || ( number_of_write_buffers > LIBSMDEV_WRITE_ENGINE_MAXIMUM_NUMBER_OF_BUFFERS ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid device handle - missing device file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of write buffers value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	response = (uint8_t *) memory_allocate(
-	                        sizeof( uint8_t ) * response_size );
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_write_buffers > 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of write buffers: %d - multi-thread support not available.",
+		 function,
+		 number_of_write_buffers );
 
-	if( response == NULL )
+		return( -1 );
+	}
+#endif
+	internal_handle->number_of_write_buffers = number_of_write_buffers;
+	internal_handle->configured_values      |= LIBSMDEV_TRANSPORT_PROFILE_VALUE_CACHE_POLICY;
+
+	return( 1 );
+}
+
+/* Retrieves the write flush policy
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_write_flush_policy(
+     libsmdev_handle_t *handle,
+     int *write_flush_policy,
+     size64_t *write_flush_interval,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_write_flush_policy";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to response.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     response,
-	     0,
-	     sizeof( uint8_t ) * response_size ) == NULL )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( write_flush_policy == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear response.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write flush policy.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( WINAPI )
-	if( memset(
-	     &query,
-	     0,
-	     sizeof( STORAGE_PROPERTY_QUERY ) ) == NULL )
+	if( write_flush_interval == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear storage property query.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write flush interval.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	query.PropertyId = StorageDeviceProperty;
-	query.QueryType  = PropertyStandardQuery;
+	*write_flush_policy   = internal_handle->write_flush_policy;
+	*write_flush_interval = internal_handle->write_flush_interval;
 
-	read_count = libcfile_file_io_control_read(
-	              internal_handle->device_file,
-	              IOCTL_STORAGE_QUERY_PROPERTY,
-	              (uint8_t *) &query,
-	              sizeof( STORAGE_PROPERTY_QUERY ),
-	              response,
-	              response_size,
-	              error );
+	return( 1 );
+}
 
-	if( read_count == -1 )
+/* Sets the write flush policy
+ * The policy determines when the device cache is flushed by the write engine,
+ * the flush interval is the number of bytes written between flushes
+ * The write flush policy cannot be changed while the handle is open
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_set_write_flush_policy(
+     libsmdev_handle_t *handle,
+     int write_flush_policy,
+     size64_t write_flush_interval,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_write_flush_policy";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 "%s: unable to query device for: IOCTL_STORAGE_QUERY_PROPERTY.",
-			 function );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-		}
-#endif
-		libcerror_error_free(
-		 error );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-		return( 0 );
+		return( -1 );
 	}
-	if( (size_t) ( (STORAGE_DESCRIPTOR_HEADER *) response )->Size > response_size )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: response buffer too small.\n",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - IO backend value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( (size_t) ( (STORAGE_DESCRIPTOR_HEADER *) response )->Size > sizeof( STORAGE_DEVICE_DESCRIPTOR ) )
+	if( ( write_flush_policy != LIBSMDEV_WRITE_FLUSH_POLICY_NONE )
+	 && ( write_flush_policy != LIBSMDEV_WRITE_FLUSH_POLICY_INTERVAL )
+	 && ( write_flush_policy != LIBSMDEV_WRITE_FLUSH_POLICY_END ) )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_print_data(
-			 response,
-			 (size_t) ( (STORAGE_DESCRIPTOR_HEADER *) response )->Size,
-			 0 );
-		}
-#endif
-		if( ( (STORAGE_DEVICE_DESCRIPTOR *) response )->VendorIdOffset > 0 )
-		{
-			string_length = narrow_string_length(
-					 (char *) &( response[ ( (STORAGE_DEVICE_DESCRIPTOR *) response )->VendorIdOffset ] ) );
-
-			result = libsmdev_string_trim_copy_from_byte_stream(
-				  internal_handle->vendor,
-				  64,
-				  &( response[ ( (STORAGE_DEVICE_DESCRIPTOR *) response )->VendorIdOffset ] ),
-				  string_length,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set vendor.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		if( ( (STORAGE_DEVICE_DESCRIPTOR *) response )->ProductIdOffset > 0 )
-		{
-			string_length = narrow_string_length(
-					 (char *) &( response[ ( (STORAGE_DEVICE_DESCRIPTOR *) response )->ProductIdOffset ] ) );
-
-			result = libsmdev_string_trim_copy_from_byte_stream(
-				  internal_handle->model,
-				  64,
-				  &( response[ ( (STORAGE_DEVICE_DESCRIPTOR *) response )->ProductIdOffset ] ),
-				  string_length,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set model.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		if( ( (STORAGE_DEVICE_DESCRIPTOR *) response )->SerialNumberOffset > 0 )
-		{
-			string_length = narrow_string_length(
-					 (char *) &( response[ ( (STORAGE_DEVICE_DESCRIPTOR *) response )->SerialNumberOffset ] ) );
-
-			result = libsmdev_string_trim_copy_from_byte_stream(
-				  internal_handle->serial_number,
-				  64,
-				  &( response[ ( (STORAGE_DEVICE_DESCRIPTOR *) response )->SerialNumberOffset ] ),
-				  string_length,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set serial number.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		internal_handle->removable = ( (STORAGE_DEVICE_DESCRIPTOR *) response )->RemovableMedia;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported write flush policy: %d.",
+		 function,
+		 write_flush_policy );
 
-		switch( ( ( STORAGE_DEVICE_DESCRIPTOR *) response )->BusType )
-		{
-			case BusTypeScsi:
-				internal_handle->bus_type = LIBSMDEV_BUS_TYPE_SCSI;
-				break;
+		return( -1 );
+	}
+	if( ( write_flush_policy == LIBSMDEV_WRITE_FLUSH_POLICY_INTERVAL )
+	 && ( write_flush_interval == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid write flush interval value zero or less.",
+		 function );
 
-			case BusTypeAtapi:
-			case BusTypeAta:
-				internal_handle->bus_type = LIBSMDEV_BUS_TYPE_ATA;
-				break;
+		return( -1 );
+	}
+	internal_handle->write_flush_policy   = write_flush_policy;
+	internal_handle->write_flush_interval = write_flush_interval;
+	internal_handle->configured_values   |= LIBSMDEV_TRANSPORT_PROFILE_VALUE_CACHE_POLICY;
 
-			case BusType1394:
-				internal_handle->bus_type = LIBSMDEV_BUS_TYPE_FIREWIRE;
-				break;
+	return( 1 );
+}
 
-			case BusTypeUsb:
-				internal_handle->bus_type = LIBSMDEV_BUS_TYPE_USB;
-				break;
+/* Retrieves the write flags
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_write_flags(
+     libsmdev_handle_t *handle,
+     uint8_t *write_flags,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_write_flags";
 
-			default:
-				break;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Bus type:\t\t" );
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-			switch( ( ( STORAGE_DEVICE_DESCRIPTOR *) response )->BusType )
-			{
-				case BusTypeScsi:
-					libcnotify_printf(
-					 "SCSI" );
-					break;
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-				case BusTypeAtapi:
-					libcnotify_printf(
-					 "ATAPI" );
-					break;
+	if( write_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write flags.",
+		 function );
 
-				case BusTypeAta:
-					libcnotify_printf(
-					 "ATA" );
-					break;
+		return( -1 );
+	}
+	*write_flags = internal_handle->write_flags;
 
-				case BusType1394:
-					libcnotify_printf(
-					 "FireWire (IEEE1394)" );
-					break;
+	return( 1 );
+}
 
-				case BusTypeSsa:
-					libcnotify_printf(
-					 "Serial Storage Architecture (SSA)" );
-					break;
+/* Sets the write flags
+ * LIBSMDEV_WRITE_FLAG_DETECT_ZERO_RUNS writes runs of zero blocks using BLKDISCARD or BLKZEROOUT
+ * if supported by the device, this can only be set before the device is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_set_write_flags(
+     libsmdev_handle_t *handle,
+     uint8_t write_flags,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_set_write_flags";
 
-				case BusTypeFibre:
-					libcnotify_printf(
-					 "Fibre Channel" );
-					break;
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-				case BusTypeUsb:
-					libcnotify_printf(
-					 "USB" );
-					break;
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-				case BusTypeRAID:
-					libcnotify_printf(
-					 "RAID" );
-					break;
+	if( internal_handle->io_backend != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - IO backend value already set.",
+		 function );
 
-				case BusTypeiScsi:
-					libcnotify_printf(
-					 "iSCSI" );
-					break;
+		return( -1 );
+	}
+	if( ( write_flags & ~( LIBSMDEV_WRITE_FLAG_DETECT_ZERO_RUNS ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported write flags.",
+		 function );
 
-				case BusTypeSas:
-					libcnotify_printf(
-					 "SAS" );
-					break;
+		return( -1 );
+	}
+	internal_handle->write_flags = write_flags;
 
-				case BusTypeSata:
-					libcnotify_printf(
-					 "SATA" );
-					break;
+	return( 1 );
+}
 
-				case BusTypeSd:
-					libcnotify_printf(
-					 "Secure Digital (SD)" );
-					break;
+/* Retrieves the transport profile of a bus and media type
+ * A transport profile set by the caller takes precedence over the built-in one
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_internal_handle_get_transport_profile(
+     libsmdev_internal_handle_t *internal_handle,
+     uint8_t bus_type,
+     uint8_t media_type,
+     const libsmdev_transport_profile_t **transport_profile,
+     libcerror_error_t **error )
+{
+	libsmdev_transport_profile_t *array_transport_profile = NULL;
+	static char *function                                 = "libsmdev_internal_handle_get_transport_profile";
+	int entry_index                                       = 0;
+	int number_of_entries                                 = 0;
 
-				case BusTypeMmc:
-					libcnotify_printf(
-					 "Multi Media Card (MMC)" );
-					break;
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-				default:
-					libcnotify_printf(
-					 "Unknown: %d",
-					 ( ( STORAGE_DEVICE_DESCRIPTOR *) response )->BusType );
-					break;
-			}
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif
+		return( -1 );
 	}
-#else
-#if defined( HAVE_SCSI_SG_H )
-	/* Use the Linux sg (generic SCSI) driver to determine device information
-	 */
-	result = libsmdev_scsi_get_bus_type(
-	          internal_handle->device_file,
-	          &( internal_handle->bus_type ),
-	          error );
+	if( transport_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transport profile.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->transport_profiles_array,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine bus type.",
+		 "%s: unable to retrieve number of transport profiles.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
 	{
-		response_count = libsmdev_scsi_inquiry(
-				  internal_handle->device_file,
-				  0x00,
-				  0x00,
-				  response,
-				  response_size,
-				  error );
-
-		if( response_count == -1 )
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->transport_profiles_array,
+		     entry_index,
+		     (intptr_t **) &array_transport_profile,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: SCSI Inquiry.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve transport profile: %d.",
+			 function,
+			 entry_index );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
-#endif
-			libcerror_error_free(
-			 error );
+			return( -1 );
 		}
-/* TODO handle garbarge return ? */
-		if( response_count >= 5 )
+		if( array_transport_profile == NULL )
 		{
-			internal_handle->removable   = ( response[ 1 ] & 0x80 ) >> 7;
-			internal_handle->device_type = ( response[ 0 ] & 0x1f );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: removable\t\t: %" PRIu8 "\n",
-				 function,
-				 internal_handle->removable );
-
-				libcnotify_printf(
-				 "%s: device type\t: 0x%" PRIx8 "\n",
-				 function,
-				 internal_handle->device_type );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing transport profile: %d.",
+			 function,
+			 entry_index );
 
-				libcnotify_printf(
-				 "\n" );
-			}
-#endif
+			return( -1 );
 		}
-		if( response_count >= 16 )
+		if( ( array_transport_profile->bus_type == bus_type )
+		 && ( array_transport_profile->media_type == media_type ) )
 		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_print_data(
-				 response,
-				 response_count,
-				 0 );
-			}
-#endif
-			result = libsmdev_string_trim_copy_from_byte_stream(
-				  internal_handle->vendor,
-				  64,
-				  &( response[ 8 ] ),
-				  15 - 8,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set vendor.",
-				 function );
+			*transport_profile = array_transport_profile;
 
-				goto on_error;
-			}
+			return( 1 );
 		}
-		if( response_count >= 32 )
-		{
-			result = libsmdev_string_trim_copy_from_byte_stream(
-				  internal_handle->model,
-				  64,
-				  &( response[ 16 ] ),
-				  31 - 16,
-				  error );
+	}
+	if( libsmdev_transport_profile_get_built_in(
+	     bus_type,
+	     media_type,
+	     transport_profile,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve built-in transport profile.",
+		 function );
 
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set model.",
-				 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-				goto on_error;
-			}
-		}
-		response_count = libsmdev_scsi_inquiry(
-				  internal_handle->device_file,
-				  0x01,
-				  0x80,
-				  response,
-				  response_size,
-				  error );
+/* Applies the transport profile of the bus and media type of the device
+ * Only the values that were not set by the caller are changed
+ * The queue depth and cache policy are only applied if LIBSMDEV_ACCESS_FLAG_CONCURRENT_TRANSFERS is set
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_internal_handle_apply_transport_profile(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	const libsmdev_transport_profile_t *built_in_transport_profile = NULL;
+	const libsmdev_transport_profile_t *transport_profile          = NULL;
+	libsmdev_geometry_t *geometry                                  = NULL;
+	static char *function                                          = "libsmdev_internal_handle_apply_transport_profile";
+	size_t request_size                                            = 0;
+	uint8_t media_type                                             = 0;
+	int queue_depth                                                = 0;
 
-		if( response_count == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: SCSI Inquiry.",
-			 function );
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
-#endif
-			libcerror_error_free(
-			 error );
-		}
-		if( response_count > 4 )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_print_data(
-				 response,
-				 response_count,
-				 0 );
-			}
-#endif
-			result = libsmdev_string_trim_copy_from_byte_stream(
-				  internal_handle->serial_number,
-				  64,
-				  &( response[ 4 ] ),
-				  response_count - 4,
-				  error );
+		return( -1 );
+	}
+	/* Retrieving the media type also determines the bus type
+	 */
+	if( libsmdev_handle_get_media_type(
+	     (libsmdev_handle_t *) internal_handle,
+	     &media_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media type.",
+		 function );
 
-			if( result == -1 )
+		return( -1 );
+	}
+	if( libsmdev_internal_handle_get_transport_profile(
+	     internal_handle,
+	     internal_handle->bus_type,
+	     media_type,
+	     &transport_profile,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve transport profile.",
+		 function );
+
+		return( -1 );
+	}
+	request_size = transport_profile->request_size;
+	queue_depth  = transport_profile->queue_depth;
+
+	if( internal_handle->bus_type == LIBSMDEV_BUS_TYPE_USB )
+	{
+		if( internal_handle->usb_information_set == 0 )
+		{
+			if( libsmdev_internal_handle_determine_usb_information(
+			     internal_handle,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set serial number.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine USB information.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 		}
-	}
-#endif
-#if defined( HDIO_GET_IDENTITY )
-	if( internal_handle->bus_type == LIBSMDEV_BUS_TYPE_ATA )
-	{
-		result = libsmdev_ata_get_device_configuration(
-		          internal_handle->device_file,
-		          &device_configuration,
-		          error );
-
-		if( result == -1 )
+		if( libsmdev_transport_profile_get_built_in(
+		     internal_handle->bus_type,
+		     media_type,
+		     &built_in_transport_profile,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve ATA device configuration.",
+			 "%s: unable to retrieve built-in transport profile.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		else if( result != 0 )
+		/* The built-in profile is refined by the USB protocol, a profile set by the caller is used as-is
+		 */
+		if( transport_profile == built_in_transport_profile )
 		{
-			result = libsmdev_string_trim_copy_from_byte_stream(
-				  internal_handle->serial_number,
-				  64,
-				  device_configuration.serial_no,
-				  20,
-				  error );
-
-			if( result == -1 )
+			/* The Bulk-Only Transport handles a single command at a time
+			 */
+			if( internal_handle->usb_protocol == LIBSMDEV_USB_PROTOCOL_BULK_ONLY )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set serial number.",
-				 function );
-
-				goto on_error;
+				queue_depth = 1;
 			}
-			result = libsmdev_string_trim_copy_from_byte_stream(
-				  internal_handle->model,
-				  64,
-				  device_configuration.model,
-				  40,
-				  error );
-
-			if( result == -1 )
+			/* UAS queues commands and at SuperSpeed larger requests are needed to saturate the link
+			 */
+			else if( ( internal_handle->usb_protocol == LIBSMDEV_USB_PROTOCOL_UAS )
+			      && ( internal_handle->usb_link_speed >= LIBSMDEV_USB_LINK_SPEED_SUPER )
+			      && ( media_type == LIBSMDEV_MEDIA_TYPE_FIXED ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set model.",
-				 function );
-
-				goto on_error;
+				request_size = LIBSMDEV_USB_UAS_REQUEST_SIZE;
+				queue_depth  = LIBSMDEV_USB_UAS_QUEUE_DEPTH;
 			}
-			internal_handle->removable   = ( device_configuration.config & 0x0080 ) >> 7;
-			internal_handle->device_type = ( device_configuration.config & 0x1f00 ) >> 8;
+		}
+		/* Requests larger than the bridge accepts are split by the kernel
+		 */
+		if( ( internal_handle->usb_maximum_transfer_size > 0 )
+		 && ( request_size > internal_handle->usb_maximum_transfer_size ) )
+		{
+			request_size = internal_handle->usb_maximum_transfer_size;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( internal_handle->bytes_per_sector > 0 )
 			{
-				libcnotify_printf(
-				 "%s: removable\t\t: %" PRIu8 "\n",
-				 function,
-				 internal_handle->removable );
-
-				libcnotify_printf(
-				 "%s: device type\t: 0x%" PRIx8 "\n",
-				 function,
-				 internal_handle->device_type );
-
-				libcnotify_printf(
-				 "\n" );
+				request_size -= request_size % internal_handle->bytes_per_sector;
+			}
+			if( request_size == 0 )
+			{
+				request_size = internal_handle->usb_maximum_transfer_size;
 			}
-#endif
 		}
 	}
-#endif
-#if defined( HAVE_LINUX_CDROM_H )
-	if( internal_handle->device_type == 0x05 )
+	/* Requests that are a multiple of the physical sector size prevent devices that emulate
+	 * 512-byte sectors from reading a physical sector more than once, and requests within
+	 * the maximum transfer length are not split by the device
+	 */
+	if( media_type != LIBSMDEV_MEDIA_TYPE_OPTICAL )
 	{
-		result = libsmdev_optical_disc_get_table_of_contents(
-		          internal_handle->device_file,
-		          internal_handle,
-		          error );
+		if( libsmdev_internal_handle_get_geometry(
+		     internal_handle,
+		     &geometry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve geometry.",
+			 function );
 
-		if( result == -1 )
+			return( -1 );
+		}
+		if( libsmdev_geometry_get_request_size(
+		     geometry,
+		     request_size,
+		     &request_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve optical disc table of contents.",
+			 "%s: unable to retrieve request size.",
 			 function );
 
-			goto on_error;
-		}
+			return( -1 );
+		}
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Without multi-thread support only a single request can be issued at a time
+	 */
+	queue_depth = 1;
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: bus type\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 internal_handle->bus_type );
+
+		libcnotify_printf(
+		 "%s: media type\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 media_type );
+
+		libcnotify_printf(
+		 "%s: request size\t\t\t: %" PRIzd "\n",
+		 function,
+		 request_size );
+
+		libcnotify_printf(
+		 "%s: queue depth\t\t\t: %d\n",
+		 function,
+		 queue_depth );
+
+		libcnotify_printf(
+		 "%s: number of error retries\t: %" PRIu8 "\n",
+		 function,
+		 transport_profile->number_of_error_retries );
+
+		libcnotify_printf(
+		 "%s: error granularity\t\t: %" PRIzd "\n",
+		 function,
+		 transport_profile->error_granularity );
+
+		libcnotify_printf(
+		 "%s: deadline\t\t\t: %" PRIu32 " ms\n",
+		 function,
+		 transport_profile->deadline );
+
+		libcnotify_printf(
+		 "%s: cache policy\t\t\t: %d\n",
+		 function,
+		 transport_profile->cache_policy );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( ( internal_handle->configured_values & LIBSMDEV_TRANSPORT_PROFILE_VALUE_REQUEST_SIZE ) == 0 )
+	{
+		internal_handle->read_stripe_size = request_size;
+	}
+	if( ( internal_handle->configured_values & LIBSMDEV_TRANSPORT_PROFILE_VALUE_ERROR_RETRIES ) == 0 )
+	{
+		internal_handle->number_of_error_retries = transport_profile->number_of_error_retries;
+	}
+	if( ( internal_handle->configured_values & LIBSMDEV_TRANSPORT_PROFILE_VALUE_ERROR_GRANULARITY ) == 0 )
+	{
+		internal_handle->error_granularity = transport_profile->error_granularity;
+	}
+	if( ( internal_handle->configured_values & LIBSMDEV_TRANSPORT_PROFILE_VALUE_DEADLINE ) == 0 )
+	{
+		internal_handle->streaming_timeout = transport_profile->deadline;
+	}
+	/* The queue depth and cache policy enable parallel readers and write buffers
+	 * hence these are only applied when requested by the caller
+	 */
+	if( ( internal_handle->access_flags & LIBSMDEV_ACCESS_FLAG_CONCURRENT_TRANSFERS ) == 0 )
+	{
+		return( 1 );
+	}
+	if( ( internal_handle->configured_values & LIBSMDEV_TRANSPORT_PROFILE_VALUE_QUEUE_DEPTH ) == 0 )
+	{
+		internal_handle->number_of_read_threads = queue_depth;
+	}
+	if( ( internal_handle->configured_values & LIBSMDEV_TRANSPORT_PROFILE_VALUE_CACHE_POLICY ) == 0 )
+	{
+		switch( transport_profile->cache_policy )
+		{
+			/* Write-through coalesces the writes and regularly flushes the device cache
+			 * so that little data is lost when the device is detached unexpectedly
+			 */
+			case LIBSMDEV_CACHE_POLICY_WRITE_THROUGH:
+				internal_handle->number_of_write_buffers = 1;
+				internal_handle->write_flush_policy      = LIBSMDEV_WRITE_FLUSH_POLICY_INTERVAL;
+				internal_handle->write_flush_interval    = LIBSMDEV_TRANSPORT_PROFILE_FLUSH_INTERVAL;
+				break;
+
+			/* Write-back writes the buffers behind the caller and flushes the device cache
+			 * when the writes are done
+			 */
+			case LIBSMDEV_CACHE_POLICY_WRITE_BACK:
+				if( queue_depth > 1 )
+				{
+					internal_handle->number_of_write_buffers = queue_depth;
+				}
+				else
+				{
+					internal_handle->number_of_write_buffers = 1;
+				}
+				internal_handle->write_flush_policy   = LIBSMDEV_WRITE_FLUSH_POLICY_END;
+				internal_handle->write_flush_interval = 0;
+				break;
+
+			default:
+				internal_handle->number_of_write_buffers = 0;
+				internal_handle->write_flush_policy      = LIBSMDEV_WRITE_FLUSH_POLICY_NONE;
+				internal_handle->write_flush_interval    = 0;
+				break;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the transport profile of a bus and media type
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_get_transport_profile(
+     libsmdev_handle_t *handle,
+     uint8_t bus_type,
+     uint8_t media_type,
+     size_t *request_size,
+     int *queue_depth,
+     uint8_t *number_of_error_retries,
+     size_t *error_granularity,
+     uint32_t *deadline,
+     int *cache_policy,
+     libcerror_error_t **error )
+{
+	const libsmdev_transport_profile_t *transport_profile = NULL;
+	libsmdev_internal_handle_t *internal_handle           = NULL;
+	static char *function                                 = "libsmdev_handle_get_transport_profile";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( request_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid request size.",
+		 function );
+
+		return( -1 );
+	}
+	if( queue_depth == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid queue depth.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_error_retries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of error retries.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_granularity == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error granularity.",
+		 function );
+
+		return( -1 );
+	}
+	if( deadline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid deadline.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_policy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache policy.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_handle_get_transport_profile(
+	     internal_handle,
+	     bus_type,
+	     media_type,
+	     &transport_profile,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve transport profile.",
+		 function );
+
+		return( -1 );
+	}
+	*request_size            = transport_profile->request_size;
+	*queue_depth             = transport_profile->queue_depth;
+	*number_of_error_retries = transport_profile->number_of_error_retries;
+	*error_granularity       = transport_profile->error_granularity;
+	*deadline                = transport_profile->deadline;
+	*cache_policy            = transport_profile->cache_policy;
+
+	return( 1 );
+}
+
+/* Sets the transport profile of a bus and media type
+ * The transport profile overrides the built-in transport profile and cannot be changed while the handle is open
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_set_transport_profile(
+     libsmdev_handle_t *handle,
+     uint8_t bus_type,
+     uint8_t media_type,
+     size_t request_size,
+     int queue_depth,
+     uint8_t number_of_error_retries,
+     size_t error_granularity,
+     uint32_t deadline,
+     int cache_policy,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle     = NULL;
+	libsmdev_transport_profile_t *transport_profile = NULL;
+	static char *function                           = "libsmdev_handle_set_transport_profile";
+	int entry_index                                 = 0;
+	int number_of_entries                           = 0;
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-/* Disabled for now
-	if( libsmdev_scsi_get_identifier(
-	     internal_handle->device_file,
-	     error ) != 1 )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine SCSI identifier.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle - IO backend value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	uint8_t pci_bus_address[ 64 ];
-	size_t pci_bus_address_size = 64;
-
-	result = libsmdev_scsi_get_pci_bus_address(
-	          internal_handle->device_file,
-	          pci_bus_address,
-	          pci_bus_address_size,
-	          error );
-
-	if( result == -1 )
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->transport_profiles_array,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine PCI bus address.",
+		 "%s: unable to retrieve number of transport profiles.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_LINUX_USB_CH9_H )
-	if( internal_handle->bus_type == LIBSMDEV_BUS_TYPE_USB )
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
 	{
-		if( io_usb_test(
-		     internal_handle->device_file,
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->transport_profiles_array,
+		     entry_index,
+		     (intptr_t **) &transport_profile,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to test USB.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve transport profile: %d.",
+			 function,
+			 entry_index );
 
-			goto on_error;
+			return( -1 );
 		}
-	}
-#endif
-*/
-#endif
-	internal_handle->media_information_set = 1;
-
-	memory_free(
-	 response );
-
-	response = NULL;
-
-	return( 1 );
+		if( transport_profile == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing transport profile: %d.",
+			 function,
+			 entry_index );
 
-on_error:
-	if( response != NULL )
-	{
-		memory_free(
-		 response );
+			return( -1 );
+		}
+		if( ( transport_profile->bus_type == bus_type )
+		 && ( transport_profile->media_type == media_type ) )
+		{
+			break;
+		}
 	}
-	return( -1 );
-}
-
-/* Appends a session
- * Returns 1 if successful or -1 on error
- */
-int libsmdev_handle_append_session(
-     libsmdev_internal_handle_t *internal_handle,
-     uint64_t start_sector,
-     uint64_t number_of_sectors,
-     libcerror_error_t **error )
-{
-	libsmdev_sector_range_t *sector_range = NULL;
-	static char *function                 = "libsmdev_handle_append_session";
-	int entry_index                       = 0;
-
-	if( internal_handle == NULL )
+	if( entry_index < number_of_entries )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
-		 function );
+		if( libsmdev_transport_profile_set_values(
+		     transport_profile,
+		     request_size,
+		     queue_depth,
+		     number_of_error_retries,
+		     error_granularity,
+		     deadline,
+		     cache_policy,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set transport profile values.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+		return( 1 );
 	}
-	if( libsmdev_sector_range_initialize(
-	     &sector_range,
+	transport_profile = NULL;
+
+	if( libsmdev_transport_profile_initialize(
+	     &transport_profile,
+	     bus_type,
+	     media_type,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sector range.",
+		 "%s: unable to create transport profile.",
 		 function );
 
 		goto on_error;
 	}
-	if( libsmdev_sector_range_set(
-	     sector_range,
-	     start_sector,
-	     number_of_sectors,
+	if( libsmdev_transport_profile_set_values(
+	     transport_profile,
+	     request_size,
+	     queue_depth,
+	     number_of_error_retries,
+	     error_granularity,
+	     deadline,
+	     cache_policy,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set sector range.",
+		 "%s: unable to set transport profile values.",
 		 function );
 
 		goto on_error;
 	}
 	if( libcdata_array_append_entry(
-	     internal_handle->sessions_array,
+	     internal_handle->transport_profiles_array,
 	     &entry_index,
-	     (intptr_t *) sector_range,
+	     (intptr_t *) transport_profile,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append session sector range to array.",
+		 "%s: unable to append transport profile to array.",
 		 function );
 
 		goto on_error;
@@ -3691,27 +12153,29 @@ int libsmdev_handle_append_session(
 	return( 1 );
 
 on_error:
-	if( sector_range != NULL )
+	if( transport_profile != NULL )
 	{
-		libsmdev_sector_range_free(
-		 &sector_range,
+		libsmdev_transport_profile_free(
+		 &transport_profile,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Appends a lead-out
+/* Determines the USB link information
  * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_append_lead_out(
+int libsmdev_internal_handle_determine_usb_information(
      libsmdev_internal_handle_t *internal_handle,
-     uint64_t start_sector,
-     uint64_t number_of_sectors,
      libcerror_error_t **error )
 {
-	libsmdev_sector_range_t *sector_range = NULL;
-	static char *function                 = "libsmdev_handle_append_lead_out";
-	int entry_index                       = 0;
+	static char *function = "libsmdev_internal_handle_determine_usb_information";
+
+#if defined( HAVE_LINUX_FS_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	char name[ 64 ];
+
+	int result            = 0;
+#endif
 
 	if( internal_handle == NULL )
 	{
@@ -3724,76 +12188,159 @@ int libsmdev_handle_append_lead_out(
 
 		return( -1 );
 	}
-	if( libsmdev_sector_range_initialize(
-	     &sector_range,
-	     error ) != 1 )
+	internal_handle->usb_link_speed            = LIBSMDEV_USB_LINK_SPEED_UNKNOWN;
+	internal_handle->usb_protocol              = LIBSMDEV_USB_PROTOCOL_UNKNOWN;
+	internal_handle->usb_maximum_transfer_size = 0;
+	internal_handle->usb_attached              = 0;
+
+#if defined( HAVE_LINUX_FS_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( internal_handle->filename != NULL )
+	{
+		result = libsmdev_sysfs_get_block_device_name(
+		          internal_handle->filename,
+		          name,
+		          64,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block device name.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			result = libsmdev_usb_get_link_information(
+			          name,
+			          &( internal_handle->usb_link_speed ),
+			          &( internal_handle->usb_protocol ),
+			          &( internal_handle->usb_maximum_transfer_size ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve USB link information.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				internal_handle->usb_attached = 1;
+			}
+		}
+	}
+#endif /* defined( HAVE_LINUX_FS_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( ( internal_handle->usb_link_speed >= LIBSMDEV_USB_LINK_SPEED_LOW )
+		 && ( internal_handle->usb_link_speed <= LIBSMDEV_USB_LINK_SPEED_HIGH ) )
+		{
+			libcnotify_printf(
+			 "%s: WARNING the device is attached at USB 2.0 speed or slower, reading will be limited by the link.\n",
+			 function );
+		}
+	}
+#endif
+	internal_handle->usb_information_set = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the USB link speed
+ * Returns 1 if successful, 0 if the device is not attached via USB or -1 on error
+ */
+int libsmdev_handle_get_usb_link_speed(
+     libsmdev_handle_t *handle,
+     uint8_t *link_speed,
+     libcerror_error_t **error )
+{
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_usb_link_speed";
+
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create sector range.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libsmdev_sector_range_set(
-	     sector_range,
-	     start_sector,
-	     number_of_sectors,
-	     error ) != 1 )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set sector range.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid device handle - missing IO backend.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_array_append_entry(
-	     internal_handle->lead_outs_array,
-	     &entry_index,
-	     (intptr_t *) sector_range,
-	     error ) != 1 )
+	if( link_speed == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append lead-out sector range to array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid link speed.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
+	if( internal_handle->usb_information_set == 0 )
+	{
+		if( libsmdev_internal_handle_determine_usb_information(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine USB information.",
+			 function );
 
-on_error:
-	if( sector_range != NULL )
+			return( -1 );
+		}
+	}
+	if( internal_handle->usb_attached == 0 )
 	{
-		libsmdev_sector_range_free(
-		 &sector_range,
-		 NULL );
+		return( 0 );
 	}
-	return( -1 );
+	*link_speed = internal_handle->usb_link_speed;
+
+	return( 1 );
 }
 
-/* Appends a track
- * Returns 1 if successful or -1 on error
+/* Retrieves the USB mass storage protocol
+ * Returns 1 if successful, 0 if the device is not attached via USB or -1 on error
  */
-int libsmdev_handle_append_track(
-     libsmdev_internal_handle_t *internal_handle,
-     uint64_t start_sector,
-     uint64_t number_of_sectors,
-     uint8_t type,
+int libsmdev_handle_get_usb_protocol(
+     libsmdev_handle_t *handle,
+     uint8_t *protocol,
      libcerror_error_t **error )
 {
-	libsmdev_track_value_t *track_value = NULL;
-	static char *function               = "libsmdev_handle_append_track";
-	int entry_index                     = 0;
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_usb_protocol";
 
-	if( internal_handle == NULL )
+	if( handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3804,72 +12351,65 @@ int libsmdev_handle_append_track(
 
 		return( -1 );
 	}
-	if( libsmdev_track_value_initialize(
-	     &track_value,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create track value.",
-		 function );
+	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-		goto on_error;
-	}
-	if( libsmdev_track_value_set(
-	     track_value,
-	     start_sector,
-	     number_of_sectors,
-	     type,
-	     error ) != 1 )
+	if( internal_handle->io_backend == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set track value.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid device handle - missing IO backend.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcdata_array_append_entry(
-	     internal_handle->tracks_array,
-	     &entry_index,
-	     (intptr_t *) track_value,
-	     error ) != 1 )
+	if( protocol == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append track to array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid protocol.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
+	if( internal_handle->usb_information_set == 0 )
+	{
+		if( libsmdev_internal_handle_determine_usb_information(
+		     internal_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine USB information.",
+			 function );
 
-on_error:
-	if( track_value != NULL )
+			return( -1 );
+		}
+	}
+	if( internal_handle->usb_attached == 0 )
 	{
-		libsmdev_track_value_free(
-		 &track_value,
-		 NULL );
+		return( 0 );
 	}
-	return( -1 );
+	*protocol = internal_handle->usb_protocol;
+
+	return( 1 );
 }
 
-/* Retrieves the media size
- * Returns the 1 if succesful or -1 on error
+/* Retrieves the maximum size of a single request accepted by the USB bridge
+ * Returns 1 if successful, 0 if the device is not attached via USB or the value is not available or -1 on error
  */
-int libsmdev_handle_get_media_size(
+int libsmdev_handle_get_usb_maximum_transfer_size(
      libsmdev_handle_t *handle,
-     size64_t *media_size,
+     size_t *maximum_transfer_size,
      libcerror_error_t **error )
 {
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_media_size";
+	static char *function                       = "libsmdev_handle_get_usb_maximum_transfer_size";
 
 	if( handle == NULL )
 	{
@@ -3884,76 +12424,88 @@ int libsmdev_handle_get_media_size(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( internal_handle->device_file == NULL )
+	if( internal_handle->io_backend == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid handle - missing device file.",
+		 "%s: invalid device handle - missing IO backend.",
 		 function );
 
 		return( -1 );
 	}
-	if( media_size == NULL )
+	if( maximum_transfer_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid media size.",
+		 "%s: invalid maximum transfer size.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->media_size_set == 0 )
+	if( internal_handle->usb_information_set == 0 )
 	{
-		if( libcfile_file_get_size(
-		     internal_handle->device_file,
-		     &( internal_handle->media_size ),
+		if( libsmdev_internal_handle_determine_usb_information(
+		     internal_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine device file size.",
+			 "%s: unable to determine USB information.",
 			 function );
 
 			return( -1 );
 		}
-		internal_handle->media_size_set = 1;
 	}
-	*media_size = internal_handle->media_size;
+	if( ( internal_handle->usb_attached == 0 )
+	 || ( internal_handle->usb_maximum_transfer_size == 0 ) )
+	{
+		return( 0 );
+	}
+	*maximum_transfer_size = internal_handle->usb_maximum_transfer_size;
 
 	return( 1 );
 }
 
-/* Retrieves the number of bytes per sector
- * Returns the 1 if succesful, 0 if not or -1 on error
+/* Determines the geometry
+ * The geometry is read from the device using READ CAPACITY (16) and the block limits
+ * and block device characteristics vital product data (VPD) pages, values the device
+ * does not report are retrieved from the operating system
+ * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_get_bytes_per_sector(
-     libsmdev_handle_t *handle,
-     uint32_t *bytes_per_sector,
+int libsmdev_internal_handle_determine_geometry(
+     libsmdev_internal_handle_t *internal_handle,
      libcerror_error_t **error )
 {
-#if defined( WINAPI )
-	DISK_GEOMETRY disk_geometry;
-	DISK_GEOMETRY_EX disk_geometry_extended;
-#endif
-
-	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_bytes_per_sector";
-	ssize_t read_count                          = 0;
+#if defined( HAVE_SCSI_SG_H )
+	uint8_t response[ LIBSMDEV_SCSI_RESPONSE_SIZE_INQUIRY ];
 
-#if defined( WINAPI )
-	uint32_t error_code                         = 0;
+	ssize_t response_count         = 0;
+#endif
+	libsmdev_geometry_t *geometry  = NULL;
+	static char *function          = "libsmdev_internal_handle_determine_geometry";
+	uint32_t bytes_per_sector      = 0;
 
-#elif !defined( BLKSSZGET ) && defined( DIOCGSECTORSIZE )
-	u_int safe_bytes_per_sector                 = 0;
+#if defined( BLKPBSZGET ) || defined( BLKALIGNOFF ) || defined( BLKIOOPT ) || defined( BLKSECTGET )
+	ssize_t read_count             = 0;
+#endif
+#if defined( BLKPBSZGET ) || defined( BLKIOOPT )
+	unsigned int value_uint        = 0;
+#endif
+#if defined( BLKALIGNOFF )
+	int alignment_offset           = 0;
+#endif
+#if defined( BLKSECTGET )
+	unsigned short maximum_sectors = 0;
+	uint64_t maximum_length        = 0;
 #endif
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3964,50 +12516,63 @@ int libsmdev_handle_get_bytes_per_sector(
 
 		return( -1 );
 	}
-	internal_handle = (libsmdev_internal_handle_t *) handle;
-
-	if( internal_handle->device_file == NULL )
+	if( internal_handle->io_backend == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid device handle - missing device file.",
+		 "%s: invalid device handle - missing IO backend.",
 		 function );
 
 		return( -1 );
 	}
-	if( bytes_per_sector == NULL )
+	if( libsmdev_handle_get_bytes_per_sector(
+	     (libsmdev_handle_t *) internal_handle,
+	     &bytes_per_sector,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bytes per sector.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes per sector.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_handle->bytes_per_sector_set == 0 )
+	if( libsmdev_geometry_initialize(
+	     &geometry,
+	     bytes_per_sector,
+	     error ) != 1 )
 	{
-#if defined( WINAPI )
-		read_count = libcfile_file_io_control_read_with_error_code(
-		              internal_handle->device_file,
-		              IOCTL_DISK_GET_DRIVE_GEOMETRY_EX,
-		              NULL,
-		              0,
-		              (uint8_t *) &disk_geometry_extended,
-		              sizeof( DISK_GEOMETRY_EX ),
-		              &error_code,
-		              error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create geometry.",
+		 function );
 
-		if( read_count == -1 )
+		goto on_error;
+	}
+#if defined( HAVE_SCSI_SG_H )
+	/* Devices that do not support the commands fail them, which is not considered an error
+	 */
+	if( internal_handle->device_file != NULL )
+	{
+		response_count = libsmdev_scsi_read_capacity_16(
+		                  internal_handle->device_file,
+		                  response,
+		                  LIBSMDEV_SCSI_RESPONSE_SIZE_INQUIRY,
+		                  error );
+
+		if( response_count == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: IOCTL_DISK_GET_DRIVE_GEOMETRY_EX.",
+			 "%s: unable to query device for: SCSI READ CAPACITY (16).",
 			 function );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -4023,63 +12588,125 @@ int libsmdev_handle_get_bytes_per_sector(
 #endif
 			libcerror_error_free(
 			 error );
+		}
+		else if( libsmdev_geometry_read_capacity_16_data(
+		          geometry,
+		          response,
+		          (size_t) response_count,
+		          error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read capacity data.",
+			 function );
 
-			if( error_code == ERROR_NOT_SUPPORTED )
-			{
-				/* A floppy device does not support IOCTL_DISK_GET_DRIVE_GEOMETRY_EX
-				 */
-				read_count = libcfile_file_io_control_read(
-				              internal_handle->device_file,
-				              IOCTL_DISK_GET_DRIVE_GEOMETRY,
-				              NULL,
-				              0,
-				              (uint8_t *) &disk_geometry,
-				              sizeof( DISK_GEOMETRY ),
-				              error );
+			goto on_error;
+		}
+		response_count = libsmdev_scsi_inquiry(
+		                  internal_handle->device_file,
+		                  0x01,
+		                  LIBSMDEV_SCSI_VPD_PAGE_CODE_BLOCK_LIMITS,
+		                  response,
+		                  LIBSMDEV_SCSI_RESPONSE_SIZE_INQUIRY,
+		                  error );
 
-				if( read_count == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-					 "%s: unable to query device for: IOCTL_DISK_GET_DRIVE_GEOMETRY.",
-					 function );
+		if( response_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: SCSI Inquiry block limits.",
+			 function );
 
 #if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						if( ( error != NULL )
-						 && ( *error != NULL ) )
-						{
-							libcnotify_print_error_backtrace(
-							 *error );
-						}
-					}
-#endif
-					libcerror_error_free(
-					 error );
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
 				}
-				else
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		else if( libsmdev_geometry_read_block_limits_data(
+		          geometry,
+		          response,
+		          (size_t) response_count,
+		          error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read block limits data.",
+			 function );
+
+			goto on_error;
+		}
+		response_count = libsmdev_scsi_inquiry(
+		                  internal_handle->device_file,
+		                  0x01,
+		                  LIBSMDEV_SCSI_VPD_PAGE_CODE_BLOCK_DEVICE_CHARACTERISTICS,
+		                  response,
+		                  LIBSMDEV_SCSI_RESPONSE_SIZE_INQUIRY,
+		                  error );
+
+		if( response_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: unable to query device for: SCSI Inquiry block device characteristics.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
 				{
-					internal_handle->bytes_per_sector     = (uint32_t) disk_geometry.BytesPerSector;
-					internal_handle->bytes_per_sector_set = 1;
+					libcnotify_print_error_backtrace(
+					 *error );
 				}
 			}
+#endif
+			libcerror_error_free(
+			 error );
 		}
-		else
+		else if( libsmdev_geometry_read_block_device_characteristics_data(
+		          geometry,
+		          response,
+		          (size_t) response_count,
+		          error ) == -1 )
 		{
-			internal_handle->bytes_per_sector     = (uint32_t) disk_geometry_extended.Geometry.BytesPerSector;
-			internal_handle->bytes_per_sector_set = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read block device characteristics data.",
+			 function );
+
+			goto on_error;
 		}
-#elif defined( BLKSSZGET )
-		read_count = libcfile_file_io_control_read(
-		              internal_handle->device_file,
-		              BLKSSZGET,
-		              NULL,
-		              0,
-		              (uint8_t *) &( internal_handle->bytes_per_sector ),
-		              4,
+	}
+#endif /* defined( HAVE_SCSI_SG_H ) */
+
+#if defined( BLKPBSZGET )
+	if( geometry->physical_bytes_per_sector == 0 )
+	{
+		read_count = libsmdev_io_backend_io_control_read(
+		              internal_handle->io_backend,
+		              BLKPBSZGET,
+		              (uint8_t *) &value_uint,
+		              sizeof( unsigned int ),
 		              error );
 
 		if( read_count == -1 )
@@ -4088,7 +12715,7 @@ int libsmdev_handle_get_bytes_per_sector(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: BLKSSZGET.",
+			 "%s: unable to query device for: BLKPBSZGET.",
 			 function );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -4105,18 +12732,88 @@ int libsmdev_handle_get_bytes_per_sector(
 			libcerror_error_free(
 			 error );
 		}
-		else
+		else if( ( value_uint >= geometry->bytes_per_sector )
+		      && ( ( value_uint % geometry->bytes_per_sector ) == 0 ) )
 		{
-			internal_handle->bytes_per_sector_set = 1;
+			geometry->physical_bytes_per_sector = (uint32_t) value_uint;
+
+#if defined( BLKALIGNOFF )
+			/* The alignment offset is -1 if the partition is misaligned with the device
+			 */
+			read_count = libsmdev_io_backend_io_control_read(
+			              internal_handle->io_backend,
+			              BLKALIGNOFF,
+			              (uint8_t *) &alignment_offset,
+			              sizeof( int ),
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+				 "%s: unable to query device for: BLKALIGNOFF.",
+				 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+			else if( alignment_offset > 0 )
+			{
+				if( libsmdev_geometry_set_alignment_offset(
+				     geometry,
+				     (uint64_t) alignment_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set alignment offset.",
+					 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						if( ( error != NULL )
+						 && ( *error != NULL ) )
+						{
+							libcnotify_print_error_backtrace(
+							 *error );
+						}
+					}
+#endif
+					libcerror_error_free(
+					 error );
+				}
+			}
+#endif /* defined( BLKALIGNOFF ) */
 		}
-#elif defined( DIOCGSECTORSIZE )
-		read_count = libcfile_file_io_control_read(
-		              internal_handle->device_file,
-		              DIOCGSECTORSIZE,
-		              NULL,
-		              0,
-		              (uint8_t *) &safe_bytes_per_sector,
-		              sizeof( u_int ),
+	}
+#endif /* defined( BLKPBSZGET ) */
+
+#if defined( BLKIOOPT )
+	if( geometry->optimal_transfer_length == 0 )
+	{
+		value_uint = 0;
+
+		read_count = libsmdev_io_backend_io_control_read(
+		              internal_handle->io_backend,
+		              BLKIOOPT,
+		              (uint8_t *) &value_uint,
+		              sizeof( unsigned int ),
 		              error );
 
 		if( read_count == -1 )
@@ -4125,7 +12822,7 @@ int libsmdev_handle_get_bytes_per_sector(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: DIOCGSECTORSIZE.",
+			 "%s: unable to query device for: BLKIOOPT.",
 			 function );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -4142,113 +12839,352 @@ int libsmdev_handle_get_bytes_per_sector(
 			libcerror_error_free(
 			 error );
 		}
-		else if( safe_bytes_per_sector > (u_int) UINT32_MAX )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid bytes per sector value out of bounds.",
-			 function );
+			geometry->optimal_transfer_length = (uint32_t) ( value_uint / geometry->bytes_per_sector );
+		}
+	}
+#endif /* defined( BLKIOOPT ) */
+
+#if defined( BLKSECTGET )
+	/* The operating system splits requests that are larger than its own limit,
+	 * which is the maximum number of 512-byte sectors of a single request
+	 */
+	read_count = libsmdev_io_backend_io_control_read(
+	              internal_handle->io_backend,
+	              BLKSECTGET,
+	              (uint8_t *) &maximum_sectors,
+	              sizeof( unsigned short ),
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 "%s: unable to query device for: BLKSECTGET.",
+		 function );
 
 #if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
 			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
+				libcnotify_print_error_backtrace(
+				 *error );
 			}
+		}
 #endif
-			libcerror_error_free(
-			 error );
+		libcerror_error_free(
+		 error );
+	}
+	else
+	{
+		maximum_length = ( (uint64_t) maximum_sectors * 512 ) / geometry->bytes_per_sector;
 
-		}
-		else
+		if( ( maximum_length > 0 )
+		 && ( ( geometry->maximum_transfer_length == 0 )
+		  || ( maximum_length < geometry->maximum_transfer_length ) ) )
 		{
-			internal_handle->bytes_per_sector     = (uint32_t) safe_bytes_per_sector;
-			internal_handle->bytes_per_sector_set = 1;
+			geometry->maximum_transfer_length = (uint32_t) maximum_length;
 		}
-#elif defined( DKIOCGETBLOCKSIZE )
-		read_count = libcfile_file_io_control_read(
-		              internal_handle->device_file,
-		              DKIOCGETBLOCKSIZE,
-		              NULL,
-		              0,
-		              (uint8_t *) &( internal_handle->bytes_per_sector ),
-		              4,
-		              error );
+	}
+#endif /* defined( BLKSECTGET ) */
 
-		if( read_count == -1 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: bytes per sector\t\t\t: %" PRIu32 "\n",
+		 function,
+		 geometry->bytes_per_sector );
+
+		libcnotify_printf(
+		 "%s: physical bytes per sector\t\t: %" PRIu32 "\n",
+		 function,
+		 geometry->physical_bytes_per_sector );
+
+		libcnotify_printf(
+		 "%s: lowest aligned sector\t\t: %" PRIu16 "\n",
+		 function,
+		 geometry->lowest_aligned_sector );
+
+		libcnotify_printf(
+		 "%s: maximum transfer length\t\t: %" PRIu32 "\n",
+		 function,
+		 geometry->maximum_transfer_length );
+
+		libcnotify_printf(
+		 "%s: optimal transfer length\t\t: %" PRIu32 "\n",
+		 function,
+		 geometry->optimal_transfer_length );
+
+		libcnotify_printf(
+		 "%s: optimal transfer length granularity\t: %" PRIu16 "\n",
+		 function,
+		 geometry->optimal_transfer_length_granularity );
+
+		libcnotify_printf(
+		 "%s: rotation rate\t\t\t: %" PRIu16 "\n",
+		 function,
+		 geometry->rotation_rate );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( internal_handle->geometry != NULL )
+	{
+		if( libsmdev_geometry_free(
+		     &( internal_handle->geometry ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-			 "%s: unable to query device for: DKIOCGETBLOCKSIZE.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free geometry.",
 			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
-#endif
-			libcerror_error_free(
-			 error );
+			goto on_error;
 		}
-		else
+	}
+	internal_handle->geometry = geometry;
+
+	return( 1 );
+
+on_error:
+	if( geometry != NULL )
+	{
+		libsmdev_geometry_free(
+		 &geometry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the geometry
+ * The geometry is determined the first time it is retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_internal_handle_get_geometry(
+     libsmdev_internal_handle_t *internal_handle,
+     libsmdev_geometry_t **geometry,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_internal_handle_get_geometry";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( geometry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid geometry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->geometry == NULL )
+	{
+		if( libsmdev_internal_handle_determine_geometry(
+		     internal_handle,
+		     error ) != 1 )
 		{
-			internal_handle->bytes_per_sector_set = 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine geometry.",
+			 function );
+
+			return( -1 );
 		}
-#endif
 	}
-	if( internal_handle->bytes_per_sector_set == 0 )
+	*geometry = internal_handle->geometry;
+
+	return( 1 );
+}
+
+/* Retrieves the number of bytes per physical sector
+ * Returns 1 if successful, 0 if the device does not report it or -1 on error
+ */
+int libsmdev_handle_get_physical_bytes_per_sector(
+     libsmdev_handle_t *handle,
+     uint32_t *physical_bytes_per_sector,
+     libcerror_error_t **error )
+{
+	libsmdev_geometry_t *geometry               = NULL;
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_physical_bytes_per_sector";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid device handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_bytes_per_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_handle_get_geometry(
+	     internal_handle,
+	     &geometry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve geometry.",
+		 function );
+
+		return( -1 );
+	}
+	if( geometry->physical_bytes_per_sector == 0 )
+	{
+		return( 0 );
+	}
+	*physical_bytes_per_sector = geometry->physical_bytes_per_sector;
+
+	return( 1 );
+}
+
+/* Retrieves the alignment offset
+ * The alignment offset is the offset in bytes of the first physical sector boundary
+ * Returns 1 if successful, 0 if the device does not report physical sectors or -1 on error
+ */
+int libsmdev_handle_get_alignment_offset(
+     libsmdev_handle_t *handle,
+     uint64_t *alignment_offset,
+     libcerror_error_t **error )
+{
+	libsmdev_geometry_t *geometry               = NULL;
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_alignment_offset";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid device handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( alignment_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid alignment offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_handle_get_geometry(
+	     internal_handle,
+	     &geometry,
+	     error ) != 1 )
 	{
-#if defined( BLKSSZGET ) || defined( DKIOCGETBLOCKSIZE ) || defined( DIOCGSECTORSIZE ) || defined( WINAPI )
-		return( 0 );
-#else
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported platform.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve geometry.",
 		 function );
 
 		return( -1 );
-#endif
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( geometry->physical_bytes_per_sector == 0 )
 	{
-		libcnotify_printf(
-		 "%s: bytes per sector: %" PRIu32 "\n",
-		 function,
-		 internal_handle->bytes_per_sector );
+		return( 0 );
+	}
+	if( libsmdev_geometry_get_alignment_offset(
+	     geometry,
+	     alignment_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve alignment offset.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	*bytes_per_sector = internal_handle->bytes_per_sector;
 
 	return( 1 );
 }
 
-/* Retrieves the media type
- * Returns 1 if successful or -1 on error
+/* Retrieves the maximum transfer length
+ * The maximum transfer length is the number of sectors of the largest request the device handles without splitting it
+ * Returns 1 if successful, 0 if the device does not report it or -1 on error
  */
-int libsmdev_handle_get_media_type(
+int libsmdev_handle_get_maximum_transfer_length(
      libsmdev_handle_t *handle,
-     uint8_t *media_type,
+     uint32_t *maximum_transfer_length,
      libcerror_error_t **error )
 {
+	libsmdev_geometry_t *geometry               = NULL;
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_media_type";
+	static char *function                       = "libsmdev_handle_get_maximum_transfer_length";
 
 	if( handle == NULL )
 	{
@@ -4263,69 +13199,134 @@ int libsmdev_handle_get_media_type(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( internal_handle->device_file == NULL )
+	if( internal_handle->io_backend == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid device handle - missing device file.",
+		 "%s: invalid device handle - missing IO backend.",
 		 function );
 
 		return( -1 );
 	}
-	if( media_type == NULL )
+	if( maximum_transfer_length == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid media type.",
+		 "%s: invalid maximum transfer length.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->media_information_set == 0 )
+	if( libsmdev_internal_handle_get_geometry(
+	     internal_handle,
+	     &geometry,
+	     error ) != 1 )
 	{
-		if( libsmdev_internal_handle_determine_media_information(
-		     internal_handle,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine media information.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve geometry.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( internal_handle->device_type == 0x05 )
+	if( geometry->maximum_transfer_length == 0 )
 	{
-		*media_type = LIBSMDEV_MEDIA_TYPE_OPTICAL;
+		return( 0 );
 	}
-	else if( internal_handle->removable != 0 )
+	*maximum_transfer_length = geometry->maximum_transfer_length;
+
+	return( 1 );
+}
+
+/* Retrieves the optimal transfer length
+ * The optimal transfer length is the number of sectors of a request above which the device performance degrades
+ * Returns 1 if successful, 0 if the device does not report it or -1 on error
+ */
+int libsmdev_handle_get_optimal_transfer_length(
+     libsmdev_handle_t *handle,
+     uint32_t *optimal_transfer_length,
+     libcerror_error_t **error )
+{
+	libsmdev_geometry_t *geometry               = NULL;
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_get_optimal_transfer_length";
+
+	if( handle == NULL )
 	{
-		*media_type = LIBSMDEV_MEDIA_TYPE_REMOVABLE;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( internal_handle->io_backend == NULL )
 	{
-		*media_type = LIBSMDEV_MEDIA_TYPE_FIXED;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid device handle - missing IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( optimal_transfer_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid optimal transfer length.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_handle_get_geometry(
+	     internal_handle,
+	     &geometry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve geometry.",
+		 function );
+
+		return( -1 );
+	}
+	if( geometry->optimal_transfer_length == 0 )
+	{
+		return( 0 );
 	}
+	*optimal_transfer_length = geometry->optimal_transfer_length;
+
 	return( 1 );
 }
 
-/* Retrieves the bus type
- * Returns 1 if successful or -1 on error
+/* Retrieves the medium rotation rate
+ * The rotation rate is in revolutions per minute (RPM) or 1 if the medium is non-rotating
+ * Returns 1 if successful, 0 if the device does not report it or -1 on error
  */
-int libsmdev_handle_get_bus_type(
+int libsmdev_handle_get_rotation_rate(
      libsmdev_handle_t *handle,
-     uint8_t *bus_type,
+     uint16_t *rotation_rate,
      libcerror_error_t **error )
 {
+	libsmdev_geometry_t *geometry               = NULL;
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_bus_type";
+	static char *function                       = "libsmdev_handle_get_rotation_rate";
 
 	if( handle == NULL )
 	{
@@ -4340,66 +13341,66 @@ int libsmdev_handle_get_bus_type(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( internal_handle->device_file == NULL )
+	if( internal_handle->io_backend == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid device handle - missing device file.",
+		 "%s: invalid device handle - missing IO backend.",
 		 function );
 
 		return( -1 );
 	}
-	if( bus_type == NULL )
+	if( rotation_rate == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid bus type.",
+		 "%s: invalid rotation rate.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->media_information_set == 0 )
+	if( libsmdev_internal_handle_get_geometry(
+	     internal_handle,
+	     &geometry,
+	     error ) != 1 )
 	{
-		if( libsmdev_internal_handle_determine_media_information(
-		     internal_handle,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine media information.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve geometry.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	*bus_type = internal_handle->bus_type;
+	if( geometry->rotation_rate == 0 )
+	{
+		return( 0 );
+	}
+	*rotation_rate = geometry->rotation_rate;
 
 	return( 1 );
 }
 
-/* Retrieves an UTF-8 encoded information value for the specific identifier
- * The value size should include the end of string character
- * Returns 1 if successful, 0 if value not present or -1 on error
+/* Appends a handle as a fallback source
+ * The data that cannot be read from the device is read from the fallback sources,
+ * in the order they were appended, before it is zero-ed
+ * The fallback handle is referenced and must remain valid while the handle is used
+ * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_get_utf8_information_value(
+int libsmdev_handle_append_fallback_handle(
      libsmdev_handle_t *handle,
-     const uint8_t *identifier,
-     size_t identifier_length,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     libsmdev_handle_t *fallback_handle,
+     int *source_index,
      libcerror_error_t **error )
 {
+	libsmdev_fallback_source_t *fallback_source = NULL;
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	uint8_t *information_value                  = NULL;
-	static char *function                       = "libsmdev_handle_get_utf8_information_value";
-	size_t information_value_size               = 0;
-	size_t string_index                         = 0;
+	static char *function                       = "libsmdev_handle_append_fallback_handle";
 
 	if( handle == NULL )
 	{
@@ -4414,115 +13415,202 @@ int libsmdev_handle_get_utf8_information_value(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( identifier == NULL )
+	if( fallback_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid identifier.",
+		 "%s: invalid fallback handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->media_information_set == 0 )
+	if( fallback_handle == handle )
 	{
-		if( libsmdev_internal_handle_determine_media_information(
-		     internal_handle,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine media information.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fallback handle value same as handle.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( identifier_length == 5 )
+	if( source_index == NULL )
 	{
-		if( narrow_string_compare(
-		     "model",
-		     (char *) identifier,
-		     identifier_length ) == 0 )
-		{
-			information_value = (uint8_t *) internal_handle->model;
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
 	}
-	else if( identifier_length == 6 )
+	if( libsmdev_fallback_source_initialize(
+	     &fallback_source,
+	     error ) != 1 )
 	{
-		if( narrow_string_compare(
-		     "vendor",
-		     (char *) identifier,
-		     identifier_length ) == 0 )
-		{
-			information_value = (uint8_t *) internal_handle->vendor;
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create fallback source.",
+		 function );
+
+		goto on_error;
 	}
-	else if( identifier_length == 13 )
+	fallback_source->handle = fallback_handle;
+
+	if( libcdata_array_append_entry(
+	     internal_handle->fallback_sources_array,
+	     source_index,
+	     (intptr_t *) fallback_source,
+	     error ) != 1 )
 	{
-		if( narrow_string_compare(
-		     "serial_number",
-		     (char *) identifier,
-		     identifier_length ) == 0 )
-		{
-			information_value = (uint8_t *) internal_handle->serial_number;
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append fallback source to array.",
+		 function );
+
+		goto on_error;
 	}
-	if( information_value == NULL )
+	return( 1 );
+
+on_error:
+	if( fallback_source != NULL )
+	{
+		libsmdev_fallback_source_free(
+		 &fallback_source,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a file as a fallback source
+ * The file, such as an earlier image of the device, is opened for reading
+ * and contains the data of the device from offset 0
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_handle_append_fallback_file(
+     libsmdev_handle_t *handle,
+     const char *filename,
+     int *source_index,
+     libcerror_error_t **error )
+{
+	libsmdev_fallback_source_t *fallback_source = NULL;
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	static char *function                       = "libsmdev_handle_append_fallback_file";
+
+	if( handle == NULL )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( information_value[ 0 ] == 0 )
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	if( filename == NULL )
 	{
-		return( 0 );
-	}
-	/* Determine the header value size
-	 */
-	information_value_size = 1 + narrow_string_length(
-	                              (char *) information_value );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
 
-	if( utf8_string_size < information_value_size )
+		return( -1 );
+	}
+	if( source_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-8 string too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
 		 function );
 
 		return( -1 );
 	}
-	for( string_index = 0;
-	     string_index < information_value_size - 1;
-	     string_index++ )
+	if( libsmdev_fallback_source_initialize(
+	     &fallback_source,
+	     error ) != 1 )
 	{
-		utf8_string[ string_index ] = (uint8_t) information_value[ string_index ];
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create fallback source.",
+		 function );
+
+		goto on_error;
 	}
-	utf8_string[ information_value_size - 1 ] = 0;
+	if( libsmdev_fallback_source_open(
+	     fallback_source,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open fallback source: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     internal_handle->fallback_sources_array,
+	     source_index,
+	     (intptr_t *) fallback_source,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append fallback source to array.",
+		 function );
 
+		goto on_error;
+	}
 	return( 1 );
+
+on_error:
+	if( fallback_source != NULL )
+	{
+		libsmdev_fallback_source_free(
+		 &fallback_source,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves an UTF-16 encoded information value for the specific identifier
- * The value size should include the end of string character
- * Returns 1 if successful, 0 if value not present or -1 on error
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Appends a file as a fallback source
+ * The file, such as an earlier image of the device, is opened for reading
+ * and contains the data of the device from offset 0
+ * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_get_utf16_information_value(
+int libsmdev_handle_append_fallback_file_wide(
      libsmdev_handle_t *handle,
-     const uint8_t *identifier,
-     size_t identifier_length,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     const wchar_t *filename,
+     int *source_index,
      libcerror_error_t **error )
 {
+	libsmdev_fallback_source_t *fallback_source = NULL;
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	uint8_t *information_value                  = NULL;
-	static char *function                       = "libsmdev_handle_get_utf16_information_value";
-	size_t information_value_size               = 0;
-	size_t string_index                         = 0;
+	static char *function                       = "libsmdev_handle_append_fallback_file_wide";
 
 	if( handle == NULL )
 	{
@@ -4537,108 +13625,95 @@ int libsmdev_handle_get_utf16_information_value(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( identifier == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid identifier.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_handle->media_information_set == 0 )
+	if( source_index == NULL )
 	{
-		if( libsmdev_internal_handle_determine_media_information(
-		     internal_handle,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine media information.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
 
-			return( -1 );
-		}
-	}
-	if( identifier_length == 5 )
-	{
-		if( narrow_string_compare(
-		     "model",
-		     (char *) identifier,
-		     identifier_length ) == 0 )
-		{
-			information_value = (uint8_t *) internal_handle->model;
-		}
-	}
-	else if( identifier_length == 6 )
-	{
-		if( narrow_string_compare(
-		     "vendor",
-		     (char *) identifier,
-		     identifier_length ) == 0 )
-		{
-			information_value = (uint8_t *) internal_handle->vendor;
-		}
-	}
-	else if( identifier_length == 13 )
-	{
-		if( narrow_string_compare(
-		     "serial_number",
-		     (char *) identifier,
-		     identifier_length ) == 0 )
-		{
-			information_value = (uint8_t *) internal_handle->serial_number;
-		}
+		return( -1 );
 	}
-	if( information_value == NULL )
+	if( libsmdev_fallback_source_initialize(
+	     &fallback_source,
+	     error ) != 1 )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create fallback source.",
+		 function );
+
+		goto on_error;
 	}
-	if( information_value[ 0 ] == 0 )
+	if( libsmdev_fallback_source_open_wide(
+	     fallback_source,
+	     filename,
+	     error ) != 1 )
 	{
-		return( 0 );
-	}
-	/* Determine the header value size
-	 */
-	information_value_size = 1 + narrow_string_length(
-	                              (char *) information_value );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open fallback source: %ls.",
+		 function,
+		 filename );
 
-	if( utf16_string_size < information_value_size )
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     internal_handle->fallback_sources_array,
+	     source_index,
+	     (intptr_t *) fallback_source,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-16 string too small.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append fallback source to array.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	for( string_index = 0;
-	     string_index < information_value_size - 1;
-	     string_index++ )
+	return( 1 );
+
+on_error:
+	if( fallback_source != NULL )
 	{
-		utf16_string[ string_index ] = (uint16_t) information_value[ string_index ];
+		libsmdev_fallback_source_free(
+		 &fallback_source,
+		 NULL );
 	}
-	utf16_string[ information_value_size - 1 ] = 0;
-
-	return( 1 );
+	return( -1 );
 }
 
-/* Retrieves the number of sessions
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Retrieves the number of fallback sources
  * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_get_number_of_sessions(
+int libsmdev_handle_get_number_of_fallback_sources(
      libsmdev_handle_t *handle,
-     int *number_of_sessions,
+     int *number_of_sources,
      libcerror_error_t **error )
 {
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_number_of_sessions";
+	static char *function                       = "libsmdev_handle_get_number_of_fallback_sources";
 
 	if( handle == NULL )
 	{
@@ -4654,15 +13729,15 @@ int libsmdev_handle_get_number_of_sessions(
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
 	if( libcdata_array_get_number_of_entries(
-	     internal_handle->sessions_array,
-	     number_of_sessions,
+	     internal_handle->fallback_sources_array,
+	     number_of_sources,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries in sessions array.",
+		 "%s: unable to retrieve number of entries in fallback sources array.",
 		 function );
 
 		return( -1 );
@@ -4670,19 +13745,18 @@ int libsmdev_handle_get_number_of_sessions(
 	return( 1 );
 }
 
-/* Retrieves a session
+/* Retrieves the number of ranges of which the data was read from a specific fallback source
  * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_get_session(
+int libsmdev_handle_get_number_of_supplied_ranges(
      libsmdev_handle_t *handle,
-     int index,
-     uint64_t *start_sector,
-     uint64_t *number_of_sectors,
+     int source_index,
+     int *number_of_ranges,
      libcerror_error_t **error )
 {
+	libsmdev_fallback_source_t *fallback_source = NULL;
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	libsmdev_sector_range_t *sector_range       = NULL;
-	static char *function                       = "libsmdev_handle_get_session";
+	static char *function                       = "libsmdev_handle_get_number_of_supplied_ranges";
 
 	if( handle == NULL )
 	{
@@ -4698,32 +13772,43 @@ int libsmdev_handle_get_session(
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
 	if( libcdata_array_get_entry_by_index(
-	     internal_handle->sessions_array,
-	     index,
-	     (intptr_t **) &sector_range,
+	     internal_handle->fallback_sources_array,
+	     source_index,
+	     (intptr_t **) &fallback_source,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve session sector range: %d from array.",
+		 "%s: unable to retrieve fallback source: %d.",
 		 function,
-		 index );
+		 source_index );
 
 		return( -1 );
 	}
-	if( libsmdev_sector_range_get(
-	     sector_range,
-	     start_sector,
-	     number_of_sectors,
+	if( fallback_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing fallback source: %d.",
+		 function,
+		 source_index );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_get_number_of_elements(
+	     fallback_source->supplied_range_list,
+	     number_of_ranges,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sector range.",
+		 "%s: unable to retrieve number of elements in supplied range list.",
 		 function );
 
 		return( -1 );
@@ -4731,16 +13816,21 @@ int libsmdev_handle_get_session(
 	return( 1 );
 }
 
-/* Retrieves the number of tracks
+/* Retrieves a range of which the data was read from a specific fallback source
  * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_get_number_of_tracks(
+int libsmdev_handle_get_supplied_range(
      libsmdev_handle_t *handle,
-     int *number_of_tracks,
+     int source_index,
+     int range_index,
+     off64_t *offset,
+     size64_t *size,
      libcerror_error_t **error )
 {
+	libsmdev_fallback_source_t *fallback_source = NULL;
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_number_of_tracks";
+	static char *function                       = "libsmdev_handle_get_supplied_range";
+	intptr_t *value                             = NULL;
 
 	if( handle == NULL )
 	{
@@ -4755,37 +13845,81 @@ int libsmdev_handle_get_number_of_tracks(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_handle->tracks_array,
-	     number_of_tracks,
+	if( libcdata_array_get_entry_by_index(
+	     internal_handle->fallback_sources_array,
+	     source_index,
+	     (intptr_t **) &fallback_source,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries in tracks array.",
-		 function );
+		 "%s: unable to retrieve fallback source: %d.",
+		 function,
+		 source_index );
+
+		return( -1 );
+	}
+	if( fallback_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing fallback source: %d.",
+		 function,
+		 source_index );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_get_range_by_index(
+	     fallback_source->supplied_range_list,
+	     range_index,
+	     (uint64_t *) offset,
+	     (uint64_t *) size,
+	     &value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve range: %d from supplied range list.",
+		 function,
+		 range_index );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves a track
- * Returns 1 if successful or -1 on error
+/* Retrieves the fallback source that supplied the data of a read error
+ * Returns 1 if successful, 0 if the data of the error was not (entirely) read from a fallback source or -1 on error
  */
-int libsmdev_handle_get_track(
+int libsmdev_handle_get_error_source(
      libsmdev_handle_t *handle,
-     int index,
-     uint64_t *start_sector,
-     uint64_t *number_of_sectors,
-     uint8_t *type,
+     int error_index,
+     int *source_index,
      libcerror_error_t **error )
 {
+	libsmdev_fallback_source_t *fallback_source = NULL;
 	libsmdev_internal_handle_t *internal_handle = NULL;
-	libsmdev_track_value_t *track_value         = NULL;
-	static char *function                       = "libsmdev_handle_get_track";
+	static char *function                       = "libsmdev_handle_get_error_source";
+	intptr_t *value                             = NULL;
+	uint64_t error_end_offset                   = 0;
+	uint64_t error_offset                       = 0;
+	uint64_t error_size                         = 0;
+	uint64_t overlap_end_offset                 = 0;
+	uint64_t overlap_start_offset               = 0;
+	uint64_t range_offset                       = 0;
+	uint64_t range_size                         = 0;
+	uint64_t supplied_size                      = 0;
+	int fallback_source_index                   = 0;
+	int first_source_index                      = -1;
+	int number_of_ranges                        = 0;
+	int number_of_sources                       = 0;
+	int range_index                             = 0;
 
 	if( handle == NULL )
 	{
@@ -4800,53 +13934,180 @@ int libsmdev_handle_get_track(
 	}
 	internal_handle = (libsmdev_internal_handle_t *) handle;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_handle->tracks_array,
-	     index,
-	     (intptr_t **) &track_value,
+	if( source_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_internal_handle_drain_write_engine(
+	     internal_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to drain write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_get_range_by_index(
+	     internal_handle->errors_range_list,
+	     error_index,
+	     &error_offset,
+	     &error_size,
+	     &value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve track value: %d from array.",
+		 "%s: unable to retrieve error: %d from errors range list.",
 		 function,
-		 index );
+		 error_index );
 
 		return( -1 );
 	}
-	if( libsmdev_track_value_get(
-	     track_value,
-	     start_sector,
-	     number_of_sectors,
-	     type,
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->fallback_sources_array,
+	     &number_of_sources,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve track value.",
+		 "%s: unable to retrieve number of entries in fallback sources array.",
 		 function );
 
 		return( -1 );
 	}
+	error_end_offset = error_offset + error_size;
+
+	/* A read error can be supplied by multiple fallback sources, the first one is returned
+	 */
+	for( fallback_source_index = 0;
+	     fallback_source_index < number_of_sources;
+	     fallback_source_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->fallback_sources_array,
+		     fallback_source_index,
+		     (intptr_t **) &fallback_source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve fallback source: %d.",
+			 function,
+			 fallback_source_index );
+
+			return( -1 );
+		}
+		if( fallback_source == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing fallback source: %d.",
+			 function,
+			 fallback_source_index );
+
+			return( -1 );
+		}
+		if( libcdata_range_list_get_number_of_elements(
+		     fallback_source->supplied_range_list,
+		     &number_of_ranges,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of elements in supplied range list.",
+			 function );
+
+			return( -1 );
+		}
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( libcdata_range_list_get_range_by_index(
+			     fallback_source->supplied_range_list,
+			     range_index,
+			     &range_offset,
+			     &range_size,
+			     &value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve range: %d from supplied range list.",
+				 function,
+				 range_index );
+
+				return( -1 );
+			}
+			overlap_start_offset = range_offset;
+			overlap_end_offset   = range_offset + range_size;
+
+			if( overlap_start_offset < error_offset )
+			{
+				overlap_start_offset = error_offset;
+			}
+			if( overlap_end_offset > error_end_offset )
+			{
+				overlap_end_offset = error_end_offset;
+			}
+			if( overlap_start_offset >= overlap_end_offset )
+			{
+				continue;
+			}
+			supplied_size += overlap_end_offset - overlap_start_offset;
+
+			if( first_source_index == -1 )
+			{
+				first_source_index = fallback_source_index;
+			}
+		}
+	}
+	if( ( first_source_index == -1 )
+	 || ( supplied_size < error_size ) )
+	{
+		return( 0 );
+	}
+	*source_index = first_source_index;
+
 	return( 1 );
 }
 
-/* Retrieves the number of read/write error retries
- * Returns the 1 if succesful or -1 on error
+/* Empties the supplied ranges of the fallback sources
+ * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_get_number_of_error_retries(
-     libsmdev_handle_t *handle,
-     uint8_t *number_of_error_retries,
+int libsmdev_internal_handle_empty_supplied_ranges(
+     libsmdev_internal_handle_t *internal_handle,
      libcerror_error_t **error )
 {
-	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_number_of_error_retries";
+	libsmdev_fallback_source_t *fallback_source = NULL;
+	static char *function                       = "libsmdev_internal_handle_empty_supplied_ranges";
+	int fallback_source_index                   = 0;
+	int number_of_sources                       = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4857,36 +14118,94 @@ int libsmdev_handle_get_number_of_error_retries(
 
 		return( -1 );
 	}
-	internal_handle = (libsmdev_internal_handle_t *) handle;
-
-	if( number_of_error_retries == NULL )
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->fallback_sources_array,
+	     &number_of_sources,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of error retries.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries in fallback sources array.",
 		 function );
 
 		return( -1 );
 	}
-	*number_of_error_retries = internal_handle->number_of_error_retries;
+	for( fallback_source_index = 0;
+	     fallback_source_index < number_of_sources;
+	     fallback_source_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->fallback_sources_array,
+		     fallback_source_index,
+		     (intptr_t **) &fallback_source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve fallback source: %d.",
+			 function,
+			 fallback_source_index );
+
+			return( -1 );
+		}
+		if( fallback_source == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing fallback source: %d.",
+			 function,
+			 fallback_source_index );
+
+			return( -1 );
+		}
+		if( libcdata_range_list_empty(
+		     fallback_source->supplied_range_list,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty supplied range list of fallback source: %d.",
+			 function,
+			 fallback_source_index );
 
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
-/* Sets the number of read/write error retries
- * Returns the 1 if succesful or -1 on error
+/* Reads a range that could not be read from the device from the fallback sources
+ * The fallback sources are tried in the order they were appended and the range is only
+ * supplied by a fallback source that can read it entirely
+ * The buffer contents are undefined if no fallback source could supply the range
+ * Returns 1 if the range was read from a fallback source, 0 if not or -1 on error
  */
-int libsmdev_handle_set_number_of_error_retries(
-     libsmdev_handle_t *handle,
-     uint8_t number_of_error_retries,
+int libsmdev_internal_handle_read_from_fallback_sources(
+     libsmdev_internal_handle_t *internal_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
      libcerror_error_t **error )
 {
-	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_set_number_of_error_retries";
+	libsmdev_fallback_source_t *fallback_source          = NULL;
+	libsmdev_internal_handle_t *internal_fallback_handle = NULL;
+	libsmdev_io_backend_t *io_backend                    = NULL;
+	static char *function                                = "libsmdev_internal_handle_read_from_fallback_sources";
+	ssize_t read_count                                   = 0;
+	uint32_t error_code                                  = 0;
+	int fallback_source_index                            = 0;
+	int number_of_sources                                = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4897,67 +14216,228 @@ int libsmdev_handle_set_number_of_error_retries(
 
 		return( -1 );
 	}
-	internal_handle = (libsmdev_internal_handle_t *) handle;
-
-	internal_handle->number_of_error_retries = number_of_error_retries;
-
-	return( 1 );
-}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
-/* Retrieves the read/write error granularity
- * A value of 0 represents an error granularity of the entire buffer being read/written
- * Returns the 1 if succesful or -1 on error
- */
-int libsmdev_handle_get_error_granularity(
-     libsmdev_handle_t *handle,
-     size_t *error_granularity,
-     libcerror_error_t **error )
-{
-	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_error_granularity";
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
 
-	if( handle == NULL )
+		return( -1 );
+	}
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libsmdev_internal_handle_t *) handle;
+	if( buffer_size == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->fallback_sources_array,
+	     &number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries in fallback sources array.",
+		 function );
+
+		return( -1 );
+	}
+	for( fallback_source_index = 0;
+	     fallback_source_index < number_of_sources;
+	     fallback_source_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_handle->fallback_sources_array,
+		     fallback_source_index,
+		     (intptr_t **) &fallback_source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve fallback source: %d.",
+			 function,
+			 fallback_source_index );
+
+			return( -1 );
+		}
+		if( fallback_source == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing fallback source: %d.",
+			 function,
+			 fallback_source_index );
+
+			return( -1 );
+		}
+		internal_fallback_handle = (libsmdev_internal_handle_t *) fallback_source->handle;
+
+		/* The IO backend of a fallback handle is used directly, since the retries
+		 * and the errors of the fallback handle do not apply to the handle
+		 */
+		if( internal_fallback_handle != NULL )
+		{
+			io_backend = internal_fallback_handle->io_backend;
+		}
+		else
+		{
+			io_backend = fallback_source->io_backend;
+		}
+		/* A fallback handle that is not open cannot supply data
+		 */
+		if( io_backend == NULL )
+		{
+			continue;
+		}
+		read_count = libsmdev_io_backend_read_buffer_at_offset(
+		              io_backend,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              &error_code,
+		              error );
+
+		if( read_count == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read fallback source: %d at offset: %" PRIi64 " (0x%08" PRIx64 ") with error code: %" PRIu32 ".\n",
+				 function,
+				 fallback_source_index,
+				 offset,
+				 offset,
+				 error_code );
 
-	if( error_granularity == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid read granularity.",
-		 function );
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		/* Keep the offset of the IO backend of the fallback handle in sync for its own reads
+		 */
+		if( internal_fallback_handle != NULL )
+		{
+			if( libsmdev_io_backend_seek_offset(
+			     io_backend,
+			     internal_fallback_handle->offset,
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ") of fallback source: %d.",
+				 function,
+				 internal_fallback_handle->offset,
+				 internal_fallback_handle->offset,
+				 fallback_source_index );
 
-		return( -1 );
-	}
-	*error_granularity = internal_handle->error_granularity;
+				return( -1 );
+			}
+		}
+		if( read_count != (ssize_t) buffer_size )
+		{
+			continue;
+		}
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: read error at offset: %" PRIi64 " (0x%08" PRIx64 "), number of bytes: %" PRIzd " supplied by fallback source: %d.\n",
+			 function,
+			 offset,
+			 offset,
+			 buffer_size,
+			 fallback_source_index );
+		}
+#endif
+		if( libcdata_range_list_insert_range(
+		     fallback_source->supplied_range_list,
+		     (uint64_t) offset,
+		     (uint64_t) buffer_size,
+		     NULL,
+		     NULL,
+		     NULL,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert supplied range to range list.",
+			 function );
 
-	return( 1 );
+			return( -1 );
+		}
+		return( 1 );
+	}
+	return( 0 );
 }
 
-/* Sets the read/write error granularity
- * A value of 0 represents an error granularity of the entire buffer being read/written
- * Returns the 1 if succesful or -1 on error
+/* Reads the read errors within a buffer that was read from the device from the fallback sources
+ * The errors are read per error granularity and the data that no fallback source could supply is zero-ed
+ * Returns 1 if successful or -1 on error
  */
-int libsmdev_handle_set_error_granularity(
-     libsmdev_handle_t *handle,
-     size_t error_granularity,
+int libsmdev_internal_handle_read_errors_from_fallback_sources(
+     libsmdev_internal_handle_t *internal_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
      libcerror_error_t **error )
 {
-	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_set_error_granularity";
+	static char *function       = "libsmdev_internal_handle_read_errors_from_fallback_sources";
+	intptr_t *value             = NULL;
+	uint64_t buffer_end_offset  = 0;
+	uint64_t chunk_end_offset   = 0;
+	uint64_t chunk_offset       = 0;
+	uint64_t error_end_offset   = 0;
+	uint64_t error_offset       = 0;
+	uint64_t error_size         = 0;
+	size_t chunk_size           = 0;
+	int error_index             = 0;
+	int number_of_errors        = 0;
+	int number_of_sources       = 0;
+	int result                  = 0;
 
-	if( handle == NULL )
+	if( internal_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4968,131 +14448,60 @@ int libsmdev_handle_set_error_granularity(
 
 		return( -1 );
 	}
-	internal_handle = (libsmdev_internal_handle_t *) handle;
-
-	if( error_granularity > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid error granularity value exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	internal_handle->error_granularity = error_granularity;
-
-	return( 1 );
-}
-
-/* Retrieves the read/write error flags
- * Returns the 1 if succesful or -1 on error
- */
-int libsmdev_handle_get_error_flags(
-     libsmdev_handle_t *handle,
-     uint8_t *error_flags,
-     libcerror_error_t **error )
-{
-	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_error_flags";
-
-	if( handle == NULL )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libsmdev_internal_handle_t *) handle;
-
-	if( error_flags == NULL )
+	if( buffer_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid error flags.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	*error_flags = internal_handle->error_flags;
-
-	return( 1 );
-}
-
-/* Sets the the read/write error flags
- * Returns the 1 if succesful or -1 on error
- */
-int libsmdev_handle_set_error_flags(
-     libsmdev_handle_t *handle,
-     uint8_t error_flags,
-     libcerror_error_t **error )
-{
-	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_set_error_flags";
-
-	if( handle == NULL )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle = (libsmdev_internal_handle_t *) handle;
-
-	if( ( error_flags & ~( LIBSMDEV_ERROR_FLAG_ZERO_ON_ERROR ) ) != 0 )
+	if( libcdata_array_get_number_of_entries(
+	     internal_handle->fallback_sources_array,
+	     &number_of_sources,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported error flags.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries in fallback sources array.",
 		 function );
 
 		return( -1 );
 	}
-	internal_handle->error_flags = error_flags;
-
-	return( 1 );
-}
-
-/* Retrieves the number of read/write errors
- * Returns 1 if successful or -1 on error
- */
-int libsmdev_handle_get_number_of_errors(
-     libsmdev_handle_t *handle,
-     int *number_of_errors,
-     libcerror_error_t **error )
-{
-	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_number_of_errors";
-
-	if( handle == NULL )
+	if( number_of_sources == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
-		 function );
-
-		return( -1 );
+		return( 1 );
 	}
-	internal_handle = (libsmdev_internal_handle_t *) handle;
-
 	if( libcdata_range_list_get_number_of_elements(
 	     internal_handle->errors_range_list,
-	     number_of_errors,
+	     &number_of_errors,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5104,55 +14513,100 @@ int libsmdev_handle_get_number_of_errors(
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a read/write error
- * Returns 1 if successful or -1 on error
- */
-int libsmdev_handle_get_error(
-     libsmdev_handle_t *handle,
-     int index,
-     off64_t *offset,
-     size64_t *size,
-     libcerror_error_t **error )
-{
-	libsmdev_internal_handle_t *internal_handle = NULL;
-	static char *function                       = "libsmdev_handle_get_error";
-	intptr_t *value                             = NULL;
+	buffer_end_offset = (uint64_t) offset + buffer_size;
 
-	if( handle == NULL )
+	for( error_index = 0;
+	     error_index < number_of_errors;
+	     error_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid handle.",
-		 function );
+		if( libcdata_range_list_get_range_by_index(
+		     internal_handle->errors_range_list,
+		     error_index,
+		     &error_offset,
+		     &error_size,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve error: %d from errors range list.",
+			 function,
+			 error_index );
 
-		return( -1 );
-	}
-	internal_handle = (libsmdev_internal_handle_t *) handle;
+			return( -1 );
+		}
+		error_end_offset = error_offset + error_size;
 
-	if( libcdata_range_list_get_range_by_index(
-	     internal_handle->errors_range_list,
-	     index,
-	     (uint64_t *) offset,
-	     (uint64_t *) size,
-	     &value,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve error: %d from errors range list.",
-		 function,
-		 index );
+		if( error_offset < (uint64_t) offset )
+		{
+			error_offset = (uint64_t) offset;
+		}
+		if( error_end_offset > buffer_end_offset )
+		{
+			error_end_offset = buffer_end_offset;
+		}
+		/* Adjacent errors are merged in the errors range list, the data is read
+		 * per error granularity so that a fallback source with errors of its own
+		 * can still supply the remainder
+		 */
+		for( chunk_offset = error_offset;
+		     chunk_offset < error_end_offset;
+		     chunk_offset = chunk_end_offset )
+		{
+			chunk_end_offset = error_end_offset;
 
-		return( -1 );
+			if( internal_handle->error_granularity > 0 )
+			{
+				chunk_end_offset = ( ( chunk_offset / internal_handle->error_granularity ) + 1 ) * internal_handle->error_granularity;
+
+				if( chunk_end_offset > error_end_offset )
+				{
+					chunk_end_offset = error_end_offset;
+				}
+			}
+			chunk_size = (size_t) ( chunk_end_offset - chunk_offset );
+
+			result = libsmdev_internal_handle_read_from_fallback_sources(
+			          internal_handle,
+			          &( buffer[ chunk_offset - (uint64_t) offset ] ),
+			          chunk_size,
+			          (off64_t) chunk_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read range at offset: %" PRIu64 " (0x%08" PRIx64 ") from fallback sources.",
+				 function,
+				 chunk_offset,
+				 chunk_offset );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				if( memory_set(
+				     &( buffer[ chunk_offset - (uint64_t) offset ] ),
+				     0,
+				     chunk_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to zero buffer on error.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
 	}
 	return( 1 );
 }
 
-
@@ -26,10 +26,22 @@
 #include <types.h>
 
 #include "libsmdev_extern.h"
+#include "libsmdev_fallback_source.h"
+#include "libsmdev_geometry.h"
+#include "libsmdev_io_backend.h"
 #include "libsmdev_libcdata.h"
 #include "libsmdev_libcerror.h"
 #include "libsmdev_libcfile.h"
+#include "libsmdev_parallel_reader.h"
+#include "libsmdev_partition_table.h"
+#include "libsmdev_read_ahead.h"
+#include "libsmdev_read_speed.h"
+#include "libsmdev_sampler.h"
+#include "libsmdev_sanitizer.h"
+#include "libsmdev_table_of_contents.h"
+#include "libsmdev_transport_profile.h"
 #include "libsmdev_types.h"
+#include "libsmdev_write_engine.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -47,7 +59,30 @@ struct libsmdev_internal_handle
 	 */
 	size_t filename_size;
 
+	/* The IO backend type
+	 */
+	int io_backend_type;
+
+	/* The IO backend
+	 */
+	libsmdev_io_backend_t *io_backend;
+
+	/* The access flags the IO backend was opened with
+	 */
+	int access_flags;
+
+	/* Value to indicate the device was probed
+	 * If probing is deferred the device is probed on first use
+	 */
+	uint8_t device_probed;
+
+	/* Value to indicate the IO control requests are recorded
+	 * because of the LIBSMDEV_IO_CONTROL_RECORD environment variable
+	 */
+	uint8_t io_control_recording;
+
 	/* The device file
+	 * Only set when the file IO backend is used
 	 */
 	libcfile_file_t *device_file;
 
@@ -95,21 +130,61 @@ struct libsmdev_internal_handle
 	 */
 	uint8_t serial_number[ 64 ];
 
-	/* The tracks array
+	/* The table of contents
 	 */
-	libcdata_array_t *tracks_array;
+	libsmdev_table_of_contents_t *table_of_contents;
 
-	/* The sessions array
+	/* Value to indicate the media information values were set
 	 */
-	libcdata_array_t *sessions_array;
+	uint8_t media_information_set;
 
-	/* The lead-outs array
+	/* Value to indicate the table of contents was set
 	 */
-	libcdata_array_t *lead_outs_array;
+	uint8_t table_of_contents_set;
 
-	/* Value to indicate the media information values were set
+	/* The USB link speed
 	 */
-	uint8_t media_information_set;
+	uint8_t usb_link_speed;
+
+	/* The USB mass storage protocol
+	 */
+	uint8_t usb_protocol;
+
+	/* The maximum size of a single request accepted by the USB bridge
+	 * Contains 0 if not known
+	 */
+	size_t usb_maximum_transfer_size;
+
+	/* Value to indicate the device is attached via USB
+	 */
+	uint8_t usb_attached;
+
+	/* Value to indicate the USB information values were set
+	 */
+	uint8_t usb_information_set;
+
+	/* The geometry
+	 * Contains NULL if not yet determined
+	 */
+	libsmdev_geometry_t *geometry;
+
+	/* The maximum size of the data transferred by a single device command
+	 * Contains 0 if not yet determined
+	 */
+	size_t maximum_transfer_size;
+
+	/* The size of the data transferred by a single streaming read command
+	 * Contains 0 to use the maximum transfer size of the device
+	 */
+	size_t streaming_transfer_size;
+
+	/* The timeout of a streaming read command in milli seconds
+	 */
+	uint32_t streaming_timeout;
+
+	/* The probe cache directory
+	 */
+	char *probe_cache_directory;
 
 	/* The number of read/write error retries
 	 */
@@ -127,6 +202,102 @@ struct libsmdev_internal_handle
 	 */
 	libcdata_range_list_t *errors_range_list;
 
+	/* The fallback sources array
+	 * Contains the sources from which the data that cannot be read from the device is read instead
+	 */
+	libcdata_array_t *fallback_sources_array;
+
+	/* The verify mismatches range list
+	 */
+	libcdata_range_list_t *mismatches_range_list;
+
+	/* The suspect optical sectors range list
+	 * Contains the sectors that C2 error pointers marked as damaged, or that a streaming read
+	 * could not read, and that still have to be re-read
+	 */
+	libcdata_range_list_t *suspect_sectors_range_list;
+
+	/* The number of read threads
+	 */
+	int number_of_read_threads;
+
+	/* The read stripe size
+	 */
+	size_t read_stripe_size;
+
+	/* The read requests array
+	 */
+	libcdata_array_t *read_requests_array;
+
+	/* The maximum size of a gap between read requests that is read instead of seeked over
+	 */
+	size_t maximum_read_gap_size;
+
+	/* The read-ahead
+	 */
+	libsmdev_read_ahead_t *read_ahead;
+
+	/* The optical drive read speed
+	 */
+	libsmdev_read_speed_t *read_speed;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The parallel reader
+	 */
+	libsmdev_parallel_reader_t *parallel_reader;
+#endif
+
+	/* The number of write buffers
+	 */
+	int number_of_write_buffers;
+
+	/* The write flush policy
+	 */
+	int write_flush_policy;
+
+	/* The write flush interval
+	 */
+	size64_t write_flush_interval;
+
+	/* The write flags
+	 */
+	uint8_t write_flags;
+
+	/* The method used to write runs of zero blocks
+	 */
+	uint8_t write_zeroes_method;
+
+	/* The write engine
+	 */
+	libsmdev_write_engine_t *write_engine;
+
+	/* The sanitizer
+	 * Only set while the storage media is sanitized
+	 */
+	libsmdev_sanitizer_t *sanitizer;
+
+	/* The sampler
+	 * Only set while the storage media is sampled
+	 */
+	libsmdev_sampler_t *sampler;
+
+	/* The sample regions array
+	 */
+	libcdata_array_t *sample_regions_array;
+
+	/* The partition table found by the last sampling
+	 */
+	libsmdev_partition_table_t *partition_table;
+
+	/* The transport profiles array
+	 * Contains the transport profiles set by the caller, which take precedence over the built-in ones
+	 */
+	libcdata_array_t *transport_profiles_array;
+
+	/* The values that were set by the caller and are not overridden by a transport profile
+	 */
+	uint8_t configured_values;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -147,6 +318,16 @@ int libsmdev_handle_signal_abort(
      libsmdev_handle_t *handle,
      libcerror_error_t **error );
 
+int libsmdev_internal_handle_probe_device(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_open_io_backend(
+     libsmdev_internal_handle_t *internal_handle,
+     libsmdev_io_backend_t *io_backend,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBSMDEV_EXTERN \
 int libsmdev_handle_open(
      libsmdev_handle_t *handle,
@@ -165,11 +346,48 @@ int libsmdev_handle_open_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+LIBSMDEV_EXTERN \
+int libsmdev_handle_open_composite(
+     libsmdev_handle_t *handle,
+     libsmdev_handle_t **member_handles,
+     int number_of_member_handles,
+     int layout,
+     size_t stripe_size,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_composite_member_offset(
+     libsmdev_handle_t *handle,
+     off64_t offset,
+     int *member_handle_index,
+     off64_t *member_offset,
+     libcerror_error_t **error );
+
 LIBSMDEV_EXTERN \
 int libsmdev_handle_close(
      libsmdev_handle_t *handle,
      libcerror_error_t **error );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+ssize_t libsmdev_internal_handle_read_buffer_parallel(
+         libsmdev_internal_handle_t *internal_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+#endif
+
+int libsmdev_internal_handle_apply_access_pattern(
+     libsmdev_internal_handle_t *internal_handle,
+     int access_pattern,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_update_access_pattern(
+     libsmdev_internal_handle_t *internal_handle,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
 LIBSMDEV_EXTERN \
 ssize_t libsmdev_handle_read_buffer(
          libsmdev_handle_t *handle,
@@ -185,6 +403,76 @@ ssize_t libsmdev_handle_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBSMDEV_EXTERN \
+int libsmdev_handle_copy_to_file_descriptor(
+     libsmdev_handle_t *handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_append_read_request(
+     libsmdev_handle_t *handle,
+     off64_t offset,
+     size64_t size,
+     int priority,
+     int *request_index,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_number_of_read_requests(
+     libsmdev_handle_t *handle,
+     int *number_of_read_requests,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_empty_read_requests(
+     libsmdev_handle_t *handle,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_read_requests(
+     libsmdev_handle_t *handle,
+     int (*read_callback)(
+            void *callback_data,
+            int request_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_verify_with_file_descriptor(
+     libsmdev_handle_t *handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_flush_device(
+     intptr_t *internal_handle,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_supports_zero_out(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_determine_write_zeroes_method(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_write_zeroes(
+     intptr_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_drain_write_engine(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
 LIBSMDEV_EXTERN \
 ssize_t libsmdev_handle_write_buffer(
          libsmdev_handle_t *handle,
@@ -200,6 +488,34 @@ ssize_t libsmdev_handle_write_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBSMDEV_EXTERN \
+int libsmdev_handle_flush(
+     libsmdev_handle_t *handle,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_sanitize_device(
+     libsmdev_internal_handle_t *internal_handle,
+     int (*progress_callback)(
+            void *callback_data,
+            int stage,
+            size64_t processed_size,
+            size64_t total_size ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_sanitize(
+     libsmdev_handle_t *handle,
+     int sanitize_method,
+     int verification_method,
+     int (*progress_callback)(
+            void *callback_data,
+            int stage,
+            size64_t processed_size,
+            size64_t total_size ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 LIBSMDEV_EXTERN \
 off64_t libsmdev_handle_seek_offset(
          libsmdev_handle_t *handle,
@@ -259,6 +575,21 @@ int libsmdev_internal_handle_determine_media_information(
      libsmdev_internal_handle_t *internal_handle,
      libcerror_error_t **error );
 
+int libsmdev_internal_handle_determine_table_of_contents(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_probe_cache_directory(
+     libsmdev_handle_t *handle,
+     const char *directory,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_invalidate_probe_cache(
+     libsmdev_handle_t *handle,
+     libcerror_error_t **error );
+
 int libsmdev_handle_append_session(
      libsmdev_internal_handle_t *internal_handle,
      uint64_t start_sector,
@@ -349,6 +680,98 @@ int libsmdev_handle_get_track(
      uint8_t *type,
      libcerror_error_t **error );
 
+LIBSMDEV_EXTERN \
+ssize_t libsmdev_handle_read_optical_sectors(
+         libsmdev_handle_t *handle,
+         uint64_t start_sector,
+         uint32_t number_of_sectors,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint8_t read_flags,
+         libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+ssize_t libsmdev_handle_read_track_sectors(
+         libsmdev_handle_t *handle,
+         int track_index,
+         uint64_t sector_index,
+         uint32_t number_of_sectors,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint8_t read_flags,
+         libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_number_of_suspect_ranges(
+     libsmdev_handle_t *handle,
+     int *number_of_ranges,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_suspect_range(
+     libsmdev_handle_t *handle,
+     int index,
+     uint64_t *start_sector,
+     uint64_t *number_of_sectors,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_read_speed(
+     libsmdev_handle_t *handle,
+     uint16_t *read_speed,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_read_speed(
+     libsmdev_handle_t *handle,
+     uint16_t read_speed,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_read_speed_policy(
+     libsmdev_handle_t *handle,
+     int *read_speed_policy,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_read_speed_policy(
+     libsmdev_handle_t *handle,
+     int read_speed_policy,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+ssize_t libsmdev_handle_read_streaming_sectors(
+         libsmdev_handle_t *handle,
+         uint64_t start_sector,
+         uint32_t number_of_sectors,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_streaming_transfer_size(
+     libsmdev_handle_t *handle,
+     size_t *streaming_transfer_size,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_streaming_transfer_size(
+     libsmdev_handle_t *handle,
+     size_t streaming_transfer_size,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_streaming_timeout(
+     libsmdev_handle_t *handle,
+     uint32_t *streaming_timeout,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_streaming_timeout(
+     libsmdev_handle_t *handle,
+     uint32_t streaming_timeout,
+     libcerror_error_t **error );
+
 LIBSMDEV_EXTERN \
 int libsmdev_handle_get_number_of_error_retries(
      libsmdev_handle_t *handle,
@@ -399,6 +822,348 @@ int libsmdev_handle_get_error(
      size64_t *size,
      libcerror_error_t **error );
 
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_number_of_mismatches(
+     libsmdev_handle_t *handle,
+     int *number_of_mismatches,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_mismatch(
+     libsmdev_handle_t *handle,
+     int index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_read_partition_table(
+     libsmdev_internal_handle_t *internal_handle,
+     size64_t media_size,
+     size_t bytes_per_sector,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_sample(
+     libsmdev_handle_t *handle,
+     int sampling_method,
+     int number_of_samples,
+     size_t sample_size,
+     int number_of_regions,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_number_of_sample_regions(
+     libsmdev_handle_t *handle,
+     int *number_of_regions,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_sample_region(
+     libsmdev_handle_t *handle,
+     int region_index,
+     off64_t *offset,
+     size64_t *size,
+     uint64_t *number_of_samples,
+     uint64_t *number_of_unreadable_samples,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_sample_region_statistics(
+     libsmdev_handle_t *handle,
+     int region_index,
+     double *zero_fraction,
+     double *high_entropy_fraction,
+     double *entropy,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_partition_table_type(
+     libsmdev_handle_t *handle,
+     uint8_t *partition_table_type,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_number_of_partitions(
+     libsmdev_handle_t *handle,
+     int *number_of_partitions,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_partition(
+     libsmdev_handle_t *handle,
+     int partition_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_io_backend_type(
+     libsmdev_handle_t *handle,
+     int *io_backend_type,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_io_backend_type(
+     libsmdev_handle_t *handle,
+     int io_backend_type,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_number_of_read_threads(
+     libsmdev_handle_t *handle,
+     int *number_of_read_threads,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_number_of_read_threads(
+     libsmdev_handle_t *handle,
+     int number_of_read_threads,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_read_stripe_size(
+     libsmdev_handle_t *handle,
+     size_t *read_stripe_size,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_read_stripe_size(
+     libsmdev_handle_t *handle,
+     size_t read_stripe_size,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_maximum_read_gap_size(
+     libsmdev_handle_t *handle,
+     size_t *maximum_read_gap_size,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_maximum_read_gap_size(
+     libsmdev_handle_t *handle,
+     size_t maximum_read_gap_size,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_access_pattern(
+     libsmdev_handle_t *handle,
+     int *access_pattern,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_access_pattern(
+     libsmdev_handle_t *handle,
+     int access_pattern,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_number_of_write_buffers(
+     libsmdev_handle_t *handle,
+     int *number_of_write_buffers,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_number_of_write_buffers(
+     libsmdev_handle_t *handle,
+     int number_of_write_buffers,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_write_flush_policy(
+     libsmdev_handle_t *handle,
+     int *write_flush_policy,
+     size64_t *write_flush_interval,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_write_flush_policy(
+     libsmdev_handle_t *handle,
+     int write_flush_policy,
+     size64_t write_flush_interval,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_write_flags(
+     libsmdev_handle_t *handle,
+     uint8_t *write_flags,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_write_flags(
+     libsmdev_handle_t *handle,
+     uint8_t write_flags,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_get_transport_profile(
+     libsmdev_internal_handle_t *internal_handle,
+     uint8_t bus_type,
+     uint8_t media_type,
+     const libsmdev_transport_profile_t **transport_profile,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_apply_transport_profile(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_transport_profile(
+     libsmdev_handle_t *handle,
+     uint8_t bus_type,
+     uint8_t media_type,
+     size_t *request_size,
+     int *queue_depth,
+     uint8_t *number_of_error_retries,
+     size_t *error_granularity,
+     uint32_t *deadline,
+     int *cache_policy,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_set_transport_profile(
+     libsmdev_handle_t *handle,
+     uint8_t bus_type,
+     uint8_t media_type,
+     size_t request_size,
+     int queue_depth,
+     uint8_t number_of_error_retries,
+     size_t error_granularity,
+     uint32_t deadline,
+     int cache_policy,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_determine_usb_information(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_usb_link_speed(
+     libsmdev_handle_t *handle,
+     uint8_t *link_speed,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_usb_protocol(
+     libsmdev_handle_t *handle,
+     uint8_t *protocol,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_usb_maximum_transfer_size(
+     libsmdev_handle_t *handle,
+     size_t *maximum_transfer_size,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_determine_geometry(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_get_geometry(
+     libsmdev_internal_handle_t *internal_handle,
+     libsmdev_geometry_t **geometry,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_physical_bytes_per_sector(
+     libsmdev_handle_t *handle,
+     uint32_t *physical_bytes_per_sector,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_alignment_offset(
+     libsmdev_handle_t *handle,
+     uint64_t *alignment_offset,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_maximum_transfer_length(
+     libsmdev_handle_t *handle,
+     uint32_t *maximum_transfer_length,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_optimal_transfer_length(
+     libsmdev_handle_t *handle,
+     uint32_t *optimal_transfer_length,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_rotation_rate(
+     libsmdev_handle_t *handle,
+     uint16_t *rotation_rate,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_append_fallback_handle(
+     libsmdev_handle_t *handle,
+     libsmdev_handle_t *fallback_handle,
+     int *source_index,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_append_fallback_file(
+     libsmdev_handle_t *handle,
+     const char *filename,
+     int *source_index,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_append_fallback_file_wide(
+     libsmdev_handle_t *handle,
+     const wchar_t *filename,
+     int *source_index,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_number_of_fallback_sources(
+     libsmdev_handle_t *handle,
+     int *number_of_sources,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_number_of_supplied_ranges(
+     libsmdev_handle_t *handle,
+     int source_index,
+     int *number_of_ranges,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_supplied_range(
+     libsmdev_handle_t *handle,
+     int source_index,
+     int range_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
+LIBSMDEV_EXTERN \
+int libsmdev_handle_get_error_source(
+     libsmdev_handle_t *handle,
+     int error_index,
+     int *source_index,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_empty_supplied_ranges(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_read_from_fallback_sources(
+     libsmdev_internal_handle_t *internal_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libsmdev_internal_handle_read_errors_from_fallback_sources(
+     libsmdev_internal_handle_t *internal_handle,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
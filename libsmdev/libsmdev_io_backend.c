@@ -0,0 +1,944 @@
+/*
+ * Input/Output (IO) backend functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H ) && !defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_io_backend.h"
+#include "libsmdev_io_control.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcfile.h"
+#include "libsmdev_libcnotify.h"
+#include "libsmdev_simulated_device.h"
+
+/* Creates an IO backend
+ * The function pointers are set by the caller
+ * Make sure the value io_backend is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_backend_initialize(
+     libsmdev_io_backend_t **io_backend,
+     int type,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_initialize";
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_backend != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO backend value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*io_backend = memory_allocate_structure(
+	               libsmdev_io_backend_t );
+
+	if( *io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create IO backend.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *io_backend,
+	     0,
+	     sizeof( libsmdev_io_backend_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO backend.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_backend )->type = type;
+
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+	( *io_backend )->file_descriptor = -1;
+#endif
+	return( 1 );
+
+on_error:
+	if( *io_backend != NULL )
+	{
+		memory_free(
+		 *io_backend );
+
+		*io_backend = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates a file IO backend
+ * The file IO backend uses libcfile to access the device
+ * Make sure the value io_backend is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_backend_initialize_file(
+     libsmdev_io_backend_t **io_backend,
+     libcerror_error_t **error )
+{
+	libcfile_file_t *device_file = NULL;
+	static char *function        = "libsmdev_io_backend_initialize_file";
+
+	if( libsmdev_io_backend_initialize(
+	     io_backend,
+	     LIBSMDEV_IO_BACKEND_TYPE_FILE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO backend.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcfile_file_initialize(
+	     &device_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create device file.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_backend )->io_handle       = (intptr_t *) device_file;
+	( *io_backend )->free_io_handle  = (int (*)(intptr_t **, libcerror_error_t **)) &libcfile_file_free;
+	( *io_backend )->open            = (int (*)(intptr_t *, const char *, int, libcerror_error_t **)) &libcfile_file_open;
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	( *io_backend )->open_wide       = (int (*)(intptr_t *, const wchar_t *, int, libcerror_error_t **)) &libcfile_file_open_wide;
+#endif
+	( *io_backend )->close           = (int (*)(intptr_t *, libcerror_error_t **)) &libcfile_file_close;
+	( *io_backend )->read            = (ssize_t (*)(intptr_t *, uint8_t *, size_t, uint32_t *, libcerror_error_t **)) &libcfile_file_read_buffer_with_error_code;
+	( *io_backend )->write           = (ssize_t (*)(intptr_t *, const uint8_t *, size_t, uint32_t *, libcerror_error_t **)) &libcfile_file_write_buffer_with_error_code;
+	( *io_backend )->seek_offset     = (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) &libcfile_file_seek_offset;
+	( *io_backend )->io_control_read = (ssize_t (*)(intptr_t *, uint32_t, uint8_t *, size_t, libcerror_error_t **)) &libsmdev_io_control_read;
+	( *io_backend )->get_size        = (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) &libcfile_file_get_size;
+	( *io_backend )->set_block_size  = (int (*)(intptr_t *, size_t, libcerror_error_t **)) &libcfile_file_set_block_size;
+
+	/* libcfile does not provide a positional read, hence read at offset
+	 * uses pread on a file descriptor that is opened alongside the device file
+	 * and is only emulated by a seek and read where pread is not available
+	 */
+	( *io_backend )->read_at_offset  = NULL;
+
+	return( 1 );
+
+on_error:
+	if( *io_backend != NULL )
+	{
+		libsmdev_io_backend_free(
+		 io_backend,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates an IO backend of a specific type
+ * Make sure the value io_backend is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_backend_initialize_by_type(
+     libsmdev_io_backend_t **io_backend,
+     int type,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_initialize_by_type";
+	int result            = 0;
+
+	switch( type )
+	{
+		case LIBSMDEV_IO_BACKEND_TYPE_FILE:
+			result = libsmdev_io_backend_initialize_file(
+			          io_backend,
+			          error );
+			break;
+
+		case LIBSMDEV_IO_BACKEND_TYPE_SIMULATED:
+			result = libsmdev_simulated_device_initialize_io_backend(
+			          io_backend,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported IO backend type: %d.",
+			 function,
+			 type );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees an IO backend
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_backend_free(
+     libsmdev_io_backend_t **io_backend,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_free";
+	int result            = 1;
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( *io_backend != NULL )
+	{
+		if( ( ( *io_backend )->io_handle != NULL )
+		 && ( ( *io_backend )->free_io_handle != NULL ) )
+		{
+			if( ( *io_backend )->free_io_handle(
+			     &( ( *io_backend )->io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+		if( ( *io_backend )->file_descriptor != -1 )
+		{
+			close(
+			 ( *io_backend )->file_descriptor );
+		}
+#endif
+		memory_free(
+		 *io_backend );
+
+		*io_backend = NULL;
+	}
+	return( result );
+}
+
+/* Opens the IO backend
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_backend_open(
+     libsmdev_io_backend_t *io_backend,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_open";
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->open == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO backend - missing open function.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->open(
+	     io_backend->io_handle,
+	     filename,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+	/* A failure to open the file descriptor is not fatal since read at offset
+	 * then falls back to a seek and read
+	 */
+	if( ( io_backend->type == LIBSMDEV_IO_BACKEND_TYPE_FILE )
+	 && ( ( access_flags & LIBSMDEV_ACCESS_FLAG_READ ) != 0 )
+	 && ( io_backend->file_descriptor == -1 ) )
+	{
+		io_backend->file_descriptor = open(
+		                               filename,
+		                               O_RDONLY );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( ( io_backend->file_descriptor == -1 )
+		 && ( libcnotify_verbose != 0 ) )
+		{
+			libcnotify_printf(
+			 "%s: unable to open device file for positional reads with error: %d.\n",
+			 function,
+			 errno );
+		}
+#endif
+	}
+#endif
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens the IO backend
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_backend_open_wide(
+     libsmdev_io_backend_t *io_backend,
+     const wchar_t *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_open_wide";
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->open_wide == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO backend - missing open wide function.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->open_wide(
+	     io_backend->io_handle,
+	     filename,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Closes the IO backend
+ * Returns 0 if successful or -1 on error
+ */
+int libsmdev_io_backend_close(
+     libsmdev_io_backend_t *io_backend,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_close";
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->close == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO backend - missing close function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+	if( io_backend->file_descriptor != -1 )
+	{
+		if( close(
+		     io_backend->file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close file descriptor.",
+			 function );
+
+			io_backend->file_descriptor = -1;
+
+			return( -1 );
+		}
+		io_backend->file_descriptor = -1;
+	}
+#endif
+	if( io_backend->close(
+	     io_backend->io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Reads a buffer from the IO backend
+ * The error code is set to the system specific error code on error
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_io_backend_read_buffer(
+         libsmdev_io_backend_t *io_backend,
+         uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_read_buffer";
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO backend - missing read function.",
+		 function );
+
+		return( -1 );
+	}
+	return( io_backend->read(
+	         io_backend->io_handle,
+	         buffer,
+	         size,
+	         error_code,
+	         error ) );
+}
+
+/* Reads a buffer at a specific offset from the IO backend
+ * If the IO backend has no read at offset function the read is emulated by a seek and read
+ * The error code is set to the system specific error code on error
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_io_backend_read_buffer_at_offset(
+         libsmdev_io_backend_t *io_backend,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->read_at_offset != NULL )
+	{
+		return( io_backend->read_at_offset(
+		         io_backend->io_handle,
+		         buffer,
+		         size,
+		         offset,
+		         error_code,
+		         error ) );
+	}
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+	if( io_backend->file_descriptor != -1 )
+	{
+		if( buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( size > (size_t) SSIZE_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( offset < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+			 "%s: invalid offset value less than zero.",
+			 function );
+
+			return( -1 );
+		}
+		if( error_code == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid error code.",
+			 function );
+
+			return( -1 );
+		}
+		do
+		{
+			read_count = pread(
+			              io_backend->file_descriptor,
+			              (void *) buffer,
+			              size,
+			              (off_t) offset );
+		}
+		while( ( read_count == -1 )
+		    && ( errno == EINTR ) );
+
+		if( read_count < 0 )
+		{
+			*error_code = (uint32_t) errno;
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 *error_code,
+			 "%s: unable to read from file descriptor at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+#endif
+	if( libsmdev_io_backend_seek_offset(
+	     io_backend,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	read_count = libsmdev_io_backend_read_buffer(
+	              io_backend,
+	              buffer,
+	              size,
+	              error_code,
+	              error );
+
+	return( read_count );
+}
+
+/* Writes a buffer to the IO backend
+ * The error code is set to the system specific error code on error
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libsmdev_io_backend_write_buffer(
+         libsmdev_io_backend_t *io_backend,
+         const uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_write_buffer";
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->write == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid IO backend - write not supported.",
+		 function );
+
+		return( -1 );
+	}
+	return( io_backend->write(
+	         io_backend->io_handle,
+	         buffer,
+	         size,
+	         error_code,
+	         error ) );
+}
+
+/* Seeks a certain offset in the IO backend
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libsmdev_io_backend_seek_offset(
+         libsmdev_io_backend_t *io_backend,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_seek_offset";
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->seek_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO backend - missing seek offset function.",
+		 function );
+
+		return( -1 );
+	}
+	return( io_backend->seek_offset(
+	         io_backend->io_handle,
+	         offset,
+	         whence,
+	         error ) );
+}
+
+/* Reads data from the IO backend using an IO control request
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_io_backend_io_control_read(
+         libsmdev_io_backend_t *io_backend,
+         uint32_t request,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_io_control_read";
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->io_control_read == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid IO backend - IO control not supported.",
+		 function );
+
+		return( -1 );
+	}
+	return( io_backend->io_control_read(
+	         io_backend->io_handle,
+	         request,
+	         data,
+	         data_size,
+	         error ) );
+}
+
+/* Retrieves the size of the IO backend
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_backend_get_size(
+     libsmdev_io_backend_t *io_backend,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_get_size";
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->get_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO backend - missing get size function.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->get_size(
+	     io_backend->io_handle,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the block size of the IO backend
+ * The block size is ignored if the IO backend has no set block size function
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_backend_set_block_size(
+     libsmdev_io_backend_t *io_backend,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_set_block_size";
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->set_block_size == NULL )
+	{
+		return( 1 );
+	}
+	if( io_backend->set_block_size(
+	     io_backend->io_handle,
+	     block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set block size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the device file of the IO backend
+ * Only the file IO backend has a device file, which is needed by the
+ * device specific (SCSI, ATA, optical disc) functions
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libsmdev_io_backend_get_device_file(
+     libsmdev_io_backend_t *io_backend,
+     libcfile_file_t **device_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_backend_get_device_file";
+
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( device_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device file.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend->type != LIBSMDEV_IO_BACKEND_TYPE_FILE )
+	{
+		return( 0 );
+	}
+	*device_file = (libcfile_file_t *) io_backend->io_handle;
+
+	return( 1 );
+}
+
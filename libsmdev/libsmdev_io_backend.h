@@ -0,0 +1,239 @@
+/*
+ * Input/Output (IO) backend functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_IO_BACKEND_H )
+#define _LIBSMDEV_IO_BACKEND_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcfile.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsmdev_io_backend libsmdev_io_backend_t;
+
+struct libsmdev_io_backend
+{
+	/* The IO backend type
+	 */
+	int type;
+
+	/* The IO handle
+	 */
+	intptr_t *io_handle;
+
+	/* The free IO handle function
+	 */
+	int (*free_io_handle)(
+	       intptr_t **io_handle,
+	       libcerror_error_t **error );
+
+	/* The open function
+	 */
+	int (*open)(
+	       intptr_t *io_handle,
+	       const char *filename,
+	       int access_flags,
+	       libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The open wide function
+	 */
+	int (*open_wide)(
+	       intptr_t *io_handle,
+	       const wchar_t *filename,
+	       int access_flags,
+	       libcerror_error_t **error );
+#endif
+
+	/* The close function
+	 */
+	int (*close)(
+	       intptr_t *io_handle,
+	       libcerror_error_t **error );
+
+	/* The read function
+	 */
+	ssize_t (*read)(
+	           intptr_t *io_handle,
+	           uint8_t *buffer,
+	           size_t size,
+	           uint32_t *error_code,
+	           libcerror_error_t **error );
+
+	/* The read at offset function
+	 * If not set the file IO backend reads using pread, where available,
+	 * otherwise the read is emulated by a seek and read
+	 */
+	ssize_t (*read_at_offset)(
+	           intptr_t *io_handle,
+	           uint8_t *buffer,
+	           size_t size,
+	           off64_t offset,
+	           uint32_t *error_code,
+	           libcerror_error_t **error );
+
+	/* The write function
+	 */
+	ssize_t (*write)(
+	           intptr_t *io_handle,
+	           const uint8_t *buffer,
+	           size_t size,
+	           uint32_t *error_code,
+	           libcerror_error_t **error );
+
+	/* The seek offset function
+	 */
+	off64_t (*seek_offset)(
+	           intptr_t *io_handle,
+	           off64_t offset,
+	           int whence,
+	           libcerror_error_t **error );
+
+	/* The IO control read function
+	 */
+	ssize_t (*io_control_read)(
+	           intptr_t *io_handle,
+	           uint32_t request,
+	           uint8_t *data,
+	           size_t data_size,
+	           libcerror_error_t **error );
+
+	/* The get size function
+	 */
+	int (*get_size)(
+	       intptr_t *io_handle,
+	       size64_t *size,
+	       libcerror_error_t **error );
+
+	/* The set block size function
+	 */
+	int (*set_block_size)(
+	       intptr_t *io_handle,
+	       size_t block_size,
+	       libcerror_error_t **error );
+
+#if defined( HAVE_PREAD ) && !defined( WINAPI )
+	/* The file descriptor used by the file IO backend for positional reads
+	 * Contains -1 if not open
+	 */
+	int file_descriptor;
+#endif
+};
+
+int libsmdev_io_backend_initialize(
+     libsmdev_io_backend_t **io_backend,
+     int type,
+     libcerror_error_t **error );
+
+int libsmdev_io_backend_initialize_file(
+     libsmdev_io_backend_t **io_backend,
+     libcerror_error_t **error );
+
+int libsmdev_io_backend_initialize_by_type(
+     libsmdev_io_backend_t **io_backend,
+     int type,
+     libcerror_error_t **error );
+
+int libsmdev_io_backend_free(
+     libsmdev_io_backend_t **io_backend,
+     libcerror_error_t **error );
+
+int libsmdev_io_backend_open(
+     libsmdev_io_backend_t *io_backend,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libsmdev_io_backend_open_wide(
+     libsmdev_io_backend_t *io_backend,
+     const wchar_t *filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int libsmdev_io_backend_close(
+     libsmdev_io_backend_t *io_backend,
+     libcerror_error_t **error );
+
+ssize_t libsmdev_io_backend_read_buffer(
+         libsmdev_io_backend_t *io_backend,
+         uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+ssize_t libsmdev_io_backend_read_buffer_at_offset(
+         libsmdev_io_backend_t *io_backend,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+ssize_t libsmdev_io_backend_write_buffer(
+         libsmdev_io_backend_t *io_backend,
+         const uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+off64_t libsmdev_io_backend_seek_offset(
+         libsmdev_io_backend_t *io_backend,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+ssize_t libsmdev_io_backend_io_control_read(
+         libsmdev_io_backend_t *io_backend,
+         uint32_t request,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+int libsmdev_io_backend_get_size(
+     libsmdev_io_backend_t *io_backend,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libsmdev_io_backend_set_block_size(
+     libsmdev_io_backend_t *io_backend,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libsmdev_io_backend_get_device_file(
+     libsmdev_io_backend_t *io_backend,
+     libcfile_file_t **device_file,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_IO_BACKEND_H ) */
+
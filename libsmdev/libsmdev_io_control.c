@@ -0,0 +1,2072 @@
+/*
+ * Input/Output (IO) control functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_NANOSLEEP )
+#include <time.h>
+#endif
+
+/* Needed for _IOW amd _IOWR */
+#if defined( HAVE_SYS_IOCTL_H )
+#include <sys/ioctl.h>
+#endif
+
+#if defined( HAVE_SCSI_SG_H )
+#include <scsi/sg.h>
+#endif
+
+#if defined( HAVE_LINUX_USBDEVICE_FS_H )
+#include <linux/usbdevice_fs.h>
+#endif
+
+#include "libsmdev_io_control.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcfile.h"
+#include "libsmdev_libcnotify.h"
+#include "libsmdev_libcthreads.h"
+
+/* The IO control fixture, if set IO control requests are recorded to or replayed from it
+ * The fixture is a test hook that is set and cleared by the record, replay and close functions
+ * which must not be called while IO control requests are being made
+ */
+static libsmdev_io_control_fixture_t *libsmdev_io_control_fixture = NULL;
+
+/* Creates an IO control entry
+ * Make sure the value entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_control_entry_initialize(
+     libsmdev_io_control_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_control_entry_initialize";
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = memory_allocate_structure(
+	          libsmdev_io_control_entry_t );
+
+	if( *entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *entry,
+	     0,
+	     sizeof( libsmdev_io_control_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *entry != NULL )
+	{
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an IO control entry
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_control_entry_free(
+     libsmdev_io_control_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_control_entry_free";
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		if( ( *entry )->data != NULL )
+		{
+			memory_free(
+			 ( *entry )->data );
+		}
+		if( ( *entry )->key != NULL )
+		{
+			memory_free(
+			 ( *entry )->key );
+		}
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates an IO control fixture
+ * Make sure the value fixture is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_control_fixture_initialize(
+     libsmdev_io_control_fixture_t **fixture,
+     int mode,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_control_fixture_initialize";
+
+	if( fixture == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fixture.",
+		 function );
+
+		return( -1 );
+	}
+	if( *fixture != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid fixture value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mode != LIBSMDEV_IO_CONTROL_FIXTURE_MODE_RECORD )
+	 && ( mode != LIBSMDEV_IO_CONTROL_FIXTURE_MODE_REPLAY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported mode.",
+		 function );
+
+		return( -1 );
+	}
+	*fixture = memory_allocate_structure(
+	            libsmdev_io_control_fixture_t );
+
+	if( *fixture == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create fixture.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *fixture,
+	     0,
+	     sizeof( libsmdev_io_control_fixture_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear fixture.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *fixture )->entries_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *fixture )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *fixture )->mode = mode;
+
+	return( 1 );
+
+on_error:
+	if( *fixture != NULL )
+	{
+		if( ( *fixture )->entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *fixture )->entries_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 *fixture );
+
+		*fixture = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an IO control fixture
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_control_fixture_free(
+     libsmdev_io_control_fixture_t **fixture,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_control_fixture_free";
+	int result            = 1;
+
+	if( fixture == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fixture.",
+		 function );
+
+		return( -1 );
+	}
+	if( *fixture != NULL )
+	{
+		if( ( *fixture )->file_stream != NULL )
+		{
+			if( file_stream_close(
+			     ( *fixture )->file_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcdata_array_free(
+		     &( ( *fixture )->entries_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_io_control_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entries array.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *fixture )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *fixture )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 *fixture );
+
+		*fixture = NULL;
+	}
+	return( result );
+}
+
+/* Reads the IO control fixture entries from a file stream
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_control_fixture_read_entries(
+     libsmdev_io_control_fixture_t *fixture,
+     FILE *file_stream,
+     libcerror_error_t **error )
+{
+	uint8_t entry_header[ LIBSMDEV_IO_CONTROL_FIXTURE_ENTRY_HEADER_SIZE ];
+	uint8_t signature[ 8 ];
+
+	libsmdev_io_control_entry_t *entry = NULL;
+	static char *function              = "libsmdev_io_control_fixture_read_entries";
+	size_t read_count                  = 0;
+	uint32_t value_32bit               = 0;
+	int entry_index                    = 0;
+
+	if( fixture == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fixture.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file stream.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = file_stream_read(
+	              file_stream,
+	              signature,
+	              8 );
+
+	if( ( read_count != 8 )
+	 || ( memory_compare(
+	       signature,
+	       LIBSMDEV_IO_CONTROL_FIXTURE_SIGNATURE,
+	       8 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_SIGNATURE_MISMATCH,
+		 "%s: unsupported fixture signature.",
+		 function );
+
+		return( -1 );
+	}
+	while( file_stream_at_end(
+	        file_stream ) == 0 )
+	{
+		read_count = file_stream_read(
+		              file_stream,
+		              entry_header,
+		              LIBSMDEV_IO_CONTROL_FIXTURE_ENTRY_HEADER_SIZE );
+
+		if( read_count == 0 )
+		{
+			break;
+		}
+		if( read_count != LIBSMDEV_IO_CONTROL_FIXTURE_ENTRY_HEADER_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entry header.",
+			 function );
+
+			goto on_error;
+		}
+		if( libsmdev_io_control_entry_initialize(
+		     &entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create entry.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_header[ 0 ] ),
+		 entry->request );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_header[ 4 ] ),
+		 value_32bit );
+
+		entry->result = (int32_t) value_32bit;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_header[ 8 ] ),
+		 entry->key_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_header[ 12 ] ),
+		 entry->data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: entry: %d request\t: 0x%08" PRIx32 "\n",
+			 function,
+			 entry_index,
+			 entry->request );
+
+			libcnotify_printf(
+			 "%s: entry: %d result\t\t: %" PRIi32 "\n",
+			 function,
+			 entry_index,
+			 entry->result );
+
+			libcnotify_printf(
+			 "%s: entry: %d key size\t: %" PRIzd "\n",
+			 function,
+			 entry_index,
+			 entry->key_size );
+
+			libcnotify_printf(
+			 "%s: entry: %d data size\t: %" PRIzd "\n",
+			 function,
+			 entry_index,
+			 entry->data_size );
+		}
+#endif
+		if( ( entry->key_size > (size_t) LIBSMDEV_IO_CONTROL_FIXTURE_MAXIMUM_DATA_SIZE )
+		 || ( entry->data_size > (size_t) LIBSMDEV_IO_CONTROL_FIXTURE_MAXIMUM_DATA_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %d key or data size value out of bounds.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( entry->key_size > 0 )
+		{
+			entry->key = (uint8_t *) memory_allocate(
+			                          sizeof( uint8_t ) * entry->key_size );
+
+			if( entry->key == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create entry: %d key.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			read_count = file_stream_read(
+			              file_stream,
+			              entry->key,
+			              entry->key_size );
+
+			if( read_count != entry->key_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read entry: %d key.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		if( entry->data_size > 0 )
+		{
+			entry->data = (uint8_t *) memory_allocate(
+			                           sizeof( uint8_t ) * entry->data_size );
+
+			if( entry->data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create entry: %d data.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			read_count = file_stream_read(
+			              file_stream,
+			              entry->data,
+			              entry->data_size );
+
+			if( read_count != entry->data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read entry: %d data.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		if( libcdata_array_append_entry(
+		     fixture->entries_array,
+		     &entry_index,
+		     (intptr_t *) entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry to array.",
+			 function );
+
+			goto on_error;
+		}
+		entry = NULL;
+
+		entry_index++;
+	}
+	return( 1 );
+
+on_error:
+	if( entry != NULL )
+	{
+		libsmdev_io_control_entry_free(
+		 &entry,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 fixture->entries_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_io_control_entry_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Writes an IO control fixture entry to the record file stream
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_control_fixture_write_entry(
+     libsmdev_io_control_fixture_t *fixture,
+     uint32_t request,
+     int32_t result,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t entry_header[ LIBSMDEV_IO_CONTROL_FIXTURE_ENTRY_HEADER_SIZE ];
+
+	static char *function = "libsmdev_io_control_fixture_write_entry";
+	size_t write_count    = 0;
+
+	if( fixture == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fixture.",
+		 function );
+
+		return( -1 );
+	}
+	if( fixture->file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid fixture - missing file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key == NULL )
+	 && ( key_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size > (size_t) LIBSMDEV_IO_CONTROL_FIXTURE_MAXIMUM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) LIBSMDEV_IO_CONTROL_FIXTURE_MAXIMUM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The entry is written while holding the mutex so that the entries
+	 * of concurrent threads are not interleaved
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     fixture->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_header[ 0 ] ),
+	 request );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_header[ 4 ] ),
+	 (uint32_t) result );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_header[ 8 ] ),
+	 (uint32_t) key_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_header[ 12 ] ),
+	 (uint32_t) data_size );
+
+	write_count = file_stream_write(
+	               fixture->file_stream,
+	               entry_header,
+	               LIBSMDEV_IO_CONTROL_FIXTURE_ENTRY_HEADER_SIZE );
+
+	if( write_count != LIBSMDEV_IO_CONTROL_FIXTURE_ENTRY_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write entry header.",
+		 function );
+
+		goto on_error;
+	}
+	if( key_size > 0 )
+	{
+		write_count = file_stream_write(
+		               fixture->file_stream,
+		               key,
+		               key_size );
+
+		if( write_count != key_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write entry key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( data_size > 0 )
+	{
+		write_count = file_stream_write(
+		               fixture->file_stream,
+		               data,
+		               data_size );
+
+		if( write_count != data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write entry data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     fixture->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 fixture->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the IO control fixture entry of a specific request and key
+ * The search starts after the previously retrieved entry so that repeated
+ * requests are replayed in the order they were recorded
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libsmdev_io_control_fixture_get_entry(
+     libsmdev_io_control_fixture_t *fixture,
+     uint32_t request,
+     const uint8_t *key,
+     size_t key_size,
+     libsmdev_io_control_entry_t **entry,
+     libcerror_error_t **error )
+{
+	libsmdev_io_control_entry_t *safe_entry = NULL;
+	static char *function                   = "libsmdev_io_control_fixture_get_entry";
+	int entry_index                         = 0;
+	int iterator                            = 0;
+	int number_of_entries                   = 0;
+
+	if( fixture == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fixture.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key == NULL )
+	 && ( key_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     fixture->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( iterator = 0;
+	     iterator < number_of_entries;
+	     iterator++ )
+	{
+		entry_index = ( fixture->next_entry_index + iterator ) % number_of_entries;
+
+		if( libcdata_array_get_entry_by_index(
+		     fixture->entries_array,
+		     entry_index,
+		     (intptr_t **) &safe_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( safe_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( safe_entry->request != request )
+		 || ( safe_entry->key_size != key_size ) )
+		{
+			continue;
+		}
+		if( ( key_size > 0 )
+		 && ( memory_compare(
+		       safe_entry->key,
+		       key,
+		       key_size ) != 0 ) )
+		{
+			continue;
+		}
+		fixture->next_entry_index = ( entry_index + 1 ) % number_of_entries;
+
+		*entry = safe_entry;
+
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Replays the IO control fixture entry of a specific request and key
+ * The replay latency is applied before the entry is returned
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libsmdev_io_control_fixture_replay_entry(
+     libsmdev_io_control_fixture_t *fixture,
+     uint32_t request,
+     const uint8_t *key,
+     size_t key_size,
+     libsmdev_io_control_entry_t **entry,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_NANOSLEEP )
+	struct timespec latency;
+#endif
+
+	static char *function = "libsmdev_io_control_fixture_replay_entry";
+	int result            = 0;
+
+	if( fixture == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fixture.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     fixture->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libsmdev_io_control_fixture_get_entry(
+	          fixture,
+	          request,
+	          key,
+	          key_size,
+	          entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     fixture->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( fixture->latency > 0 )
+	{
+#if defined( HAVE_NANOSLEEP )
+		latency.tv_sec  = (time_t) ( fixture->latency / 1000000 );
+		latency.tv_nsec = (long) ( fixture->latency % 1000000 ) * 1000;
+
+		while( nanosleep(
+		        &latency,
+		        &latency ) != 0 )
+		{
+			if( errno != EINTR )
+			{
+				break;
+			}
+		}
+#elif defined( WINAPI )
+		Sleep(
+		 (DWORD) ( fixture->latency / 1000 ) );
+#endif
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 fixture->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Reads IO control data where the request data does not contain pointers
+ * The request data before the request is used as the fixture entry key
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_io_control_read_buffer(
+         libsmdev_io_control_fixture_t *fixture,
+         libcfile_file_t *device_file,
+         uint32_t request,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	libsmdev_io_control_entry_t *entry = NULL;
+	uint8_t *key                       = NULL;
+	static char *function              = "libsmdev_io_control_read_buffer";
+	ssize_t read_count                 = 0;
+	int result                         = 0;
+
+	if( fixture == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fixture.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) LIBSMDEV_IO_CONTROL_FIXTURE_MAXIMUM_DATA_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( fixture->mode == LIBSMDEV_IO_CONTROL_FIXTURE_MODE_REPLAY )
+	{
+		result = libsmdev_io_control_fixture_replay_entry(
+		          fixture,
+		          request,
+		          data,
+		          data_size,
+		          &entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to replay entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: missing fixture entry for request: 0x%08" PRIx32 ".",
+			 function,
+			 request );
+
+			return( -1 );
+		}
+		if( entry->result < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: replayed failure of request: 0x%08" PRIx32 ".",
+			 function,
+			 request );
+
+			return( -1 );
+		}
+		if( entry->data_size != data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: mismatch in fixture entry data size.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     data,
+		     entry->data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy fixture entry data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) entry->result );
+	}
+	key = (uint8_t *) memory_allocate(
+	                   sizeof( uint8_t ) * data_size );
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     key,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libcfile_file_io_control_read(
+	              device_file,
+	              request,
+	              NULL,
+	              0,
+	              data,
+	              data_size,
+	              error );
+
+	/* A failed request is recorded so that it is also replayed as a failure
+	 */
+	if( read_count == -1 )
+	{
+		result = libsmdev_io_control_fixture_write_entry(
+		          fixture,
+		          request,
+		          -1,
+		          key,
+		          data_size,
+		          NULL,
+		          0,
+		          error );
+	}
+	else
+	{
+		result = libsmdev_io_control_fixture_write_entry(
+		          fixture,
+		          request,
+		          (int32_t) read_count,
+		          key,
+		          data_size,
+		          data,
+		          data_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to record entry.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 key );
+
+	return( read_count );
+
+on_error:
+	if( key != NULL )
+	{
+		memory_free(
+		 key );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_SCSI_SG_H )
+
+/* Reads IO control data of a SCSI generic (SG) IO request
+ * The SG IO header contains pointers to the command, response and sense data
+ * so the fixture entry key consists of the response size, data direction,
+ * sense size and command and the fixture entry data consists of the status,
+ * sense data and response data
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_io_control_read_sg_io(
+         libsmdev_io_control_fixture_t *fixture,
+         libcfile_file_t *device_file,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	uint8_t key[ 9 + 256 ];
+
+	libsmdev_io_control_entry_t *entry = NULL;
+	struct sg_io_hdr *sg_io_header     = NULL;
+	uint8_t *entry_data                = NULL;
+	static char *function              = "libsmdev_io_control_read_sg_io";
+	size_t entry_data_size             = 0;
+	size_t key_size                    = 0;
+	size_t response_size               = 0;
+	ssize_t read_count                 = 0;
+	uint32_t value_32bit               = 0;
+	uint16_t value_16bit               = 0;
+	int result                         = 0;
+
+	if( fixture == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid fixture.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != sizeof( struct sg_io_hdr ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sg_io_header = (struct sg_io_hdr *) data;
+
+	if( ( sg_io_header->cmdp == NULL )
+	 || ( ( sg_io_header->sbp == NULL )
+	  &&  ( sg_io_header->mx_sb_len != 0 ) )
+	 || ( ( sg_io_header->dxferp == NULL )
+	  &&  ( sg_io_header->dxfer_len != 0 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SG IO header.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only data read from the device is part of the response
+	 */
+	if( sg_io_header->dxfer_direction == SG_DXFER_FROM_DEV )
+	{
+		response_size = (size_t) sg_io_header->dxfer_len;
+	}
+	if( response_size > (size_t) LIBSMDEV_IO_CONTROL_FIXTURE_MAXIMUM_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid SG IO header - response size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( key[ 0 ] ),
+	 sg_io_header->dxfer_len );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( key[ 4 ] ),
+	 (uint32_t) sg_io_header->dxfer_direction );
+
+	key[ 8 ] = sg_io_header->mx_sb_len;
+
+	if( memory_copy(
+	     &( key[ 9 ] ),
+	     sg_io_header->cmdp,
+	     (size_t) sg_io_header->cmd_len ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy command to key.",
+		 function );
+
+		return( -1 );
+	}
+	key_size = 9 + (size_t) sg_io_header->cmd_len;
+
+	entry_data_size = LIBSMDEV_IO_CONTROL_SG_IO_STATUS_SIZE
+	                + (size_t) sg_io_header->mx_sb_len
+	                + response_size;
+
+	if( fixture->mode == LIBSMDEV_IO_CONTROL_FIXTURE_MODE_REPLAY )
+	{
+		result = libsmdev_io_control_fixture_replay_entry(
+		          fixture,
+		          SG_IO,
+		          key,
+		          key_size,
+		          &entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to replay entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: missing fixture entry for SCSI command: 0x%02" PRIx8 ".",
+			 function,
+			 sg_io_header->cmdp[ 0 ] );
+
+			return( -1 );
+		}
+		if( entry->result < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+			 "%s: replayed failure of SCSI command: 0x%02" PRIx8 ".",
+			 function,
+			 sg_io_header->cmdp[ 0 ] );
+
+			return( -1 );
+		}
+		if( entry->data_size != entry_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: mismatch in fixture entry data size.",
+			 function );
+
+			return( -1 );
+		}
+		entry_data = entry->data;
+
+		sg_io_header->status        = entry_data[ 0 ];
+		sg_io_header->masked_status = entry_data[ 1 ];
+		sg_io_header->msg_status    = entry_data[ 2 ];
+		sg_io_header->sb_len_wr     = entry_data[ 3 ];
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( entry_data[ 4 ] ),
+		 value_16bit );
+
+		sg_io_header->host_status = (unsigned short) value_16bit;
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( entry_data[ 6 ] ),
+		 value_16bit );
+
+		sg_io_header->driver_status = (unsigned short) value_16bit;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 8 ] ),
+		 value_32bit );
+
+		sg_io_header->resid = (int) value_32bit;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 12 ] ),
+		 value_32bit );
+
+		sg_io_header->duration = (unsigned int) value_32bit;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( entry_data[ 16 ] ),
+		 value_32bit );
+
+		sg_io_header->info = (unsigned int) value_32bit;
+
+		if( sg_io_header->mx_sb_len > 0 )
+		{
+			if( memory_copy(
+			     sg_io_header->sbp,
+			     &( entry_data[ LIBSMDEV_IO_CONTROL_SG_IO_STATUS_SIZE ] ),
+			     (size_t) sg_io_header->mx_sb_len ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy sense data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( response_size > 0 )
+		{
+			if( memory_copy(
+			     sg_io_header->dxferp,
+			     &( entry_data[ LIBSMDEV_IO_CONTROL_SG_IO_STATUS_SIZE + sg_io_header->mx_sb_len ] ),
+			     response_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy response data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		return( (ssize_t) entry->result );
+	}
+	read_count = libcfile_file_io_control_read(
+	              device_file,
+	              SG_IO,
+	              NULL,
+	              0,
+	              data,
+	              data_size,
+	              error );
+
+	/* A failed request is recorded so that it is also replayed as a failure
+	 */
+	if( read_count == -1 )
+	{
+		if( libsmdev_io_control_fixture_write_entry(
+		     fixture,
+		     SG_IO,
+		     -1,
+		     key,
+		     key_size,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to record entry.",
+			 function );
+		}
+		return( -1 );
+	}
+	entry_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * entry_data_size );
+
+	if( entry_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry data.",
+		 function );
+
+		goto on_error;
+	}
+	entry_data[ 0 ] = sg_io_header->status;
+	entry_data[ 1 ] = sg_io_header->masked_status;
+	entry_data[ 2 ] = sg_io_header->msg_status;
+	entry_data[ 3 ] = sg_io_header->sb_len_wr;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( entry_data[ 4 ] ),
+	 (uint16_t) sg_io_header->host_status );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( entry_data[ 6 ] ),
+	 (uint16_t) sg_io_header->driver_status );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 8 ] ),
+	 (uint32_t) sg_io_header->resid );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 12 ] ),
+	 (uint32_t) sg_io_header->duration );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( entry_data[ 16 ] ),
+	 (uint32_t) sg_io_header->info );
+
+	if( sg_io_header->mx_sb_len > 0 )
+	{
+		if( memory_copy(
+		     &( entry_data[ LIBSMDEV_IO_CONTROL_SG_IO_STATUS_SIZE ] ),
+		     sg_io_header->sbp,
+		     (size_t) sg_io_header->mx_sb_len ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sense data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( response_size > 0 )
+	{
+		if( memory_copy(
+		     &( entry_data[ LIBSMDEV_IO_CONTROL_SG_IO_STATUS_SIZE + sg_io_header->mx_sb_len ] ),
+		     sg_io_header->dxferp,
+		     response_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy response data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsmdev_io_control_fixture_write_entry(
+	     fixture,
+	     SG_IO,
+	     (int32_t) read_count,
+	     key,
+	     key_size,
+	     entry_data,
+	     entry_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to record entry.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 entry_data );
+
+	return( read_count );
+
+on_error:
+	if( entry_data != NULL )
+	{
+		memory_free(
+		 entry_data );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_SCSI_SG_H ) */
+
+/* Reads IO control data from the device file
+ * If an IO control fixture is set the request is recorded to or replayed from it
+ * In replay mode the device file is not used and can be a regular file
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_io_control_read(
+         libcfile_file_t *device_file,
+         uint32_t request,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_control_read";
+	ssize_t read_count    = 0;
+
+	if( libsmdev_io_control_fixture == NULL )
+	{
+		return( libcfile_file_io_control_read(
+		         device_file,
+		         request,
+		         NULL,
+		         0,
+		         data,
+		         data_size,
+		         error ) );
+	}
+#if defined( HAVE_SCSI_SG_H )
+	if( request == (uint32_t) SG_IO )
+	{
+		read_count = libsmdev_io_control_read_sg_io(
+		              libsmdev_io_control_fixture,
+		              device_file,
+		              data,
+		              data_size,
+		              error );
+	}
+	else
+#endif
+#if defined( HAVE_LINUX_USBDEVICE_FS_H ) && defined( USBDEVFS_IOCTL ) && defined( USBDEVFS_CONTROL )
+	/* The USB device file system requests contain pointers to data
+	 * that is not part of the fixture entry and are therefore not recorded
+	 */
+	if( ( request == (uint32_t) USBDEVFS_IOCTL )
+	 || ( request == (uint32_t) USBDEVFS_CONTROL ) )
+	{
+		if( libsmdev_io_control_fixture->mode == LIBSMDEV_IO_CONTROL_FIXTURE_MODE_REPLAY )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported request: 0x%08" PRIx32 " in replay mode.",
+			 function,
+			 request );
+
+			return( -1 );
+		}
+		read_count = libcfile_file_io_control_read(
+		              device_file,
+		              request,
+		              NULL,
+		              0,
+		              data,
+		              data_size,
+		              error );
+	}
+	else
+#endif
+	{
+		read_count = libsmdev_io_control_read_buffer(
+		              libsmdev_io_control_fixture,
+		              device_file,
+		              request,
+		              data,
+		              data_size,
+		              error );
+	}
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 "%s: unable to read IO control data of request: 0x%08" PRIx32 ".",
+		 function,
+		 request );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Opens an IO control fixture file to record IO control requests to
+ * The requests and their responses of all subsequent IO control requests are
+ * written to the file until libsmdev_io_control_close is called
+ * Only intended for tests
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_control_record_open(
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libsmdev_io_control_fixture_t *fixture = NULL;
+	static char *function                  = "libsmdev_io_control_record_open";
+	size_t write_count                     = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_io_control_fixture != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid fixture value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_io_control_fixture_initialize(
+	     &fixture,
+	     LIBSMDEV_IO_CONTROL_FIXTURE_MODE_RECORD,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create fixture.",
+		 function );
+
+		goto on_error;
+	}
+	fixture->file_stream = file_stream_open(
+	                        filename,
+	                        FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( fixture->file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	write_count = file_stream_write(
+	               fixture->file_stream,
+	               LIBSMDEV_IO_CONTROL_FIXTURE_SIGNATURE,
+	               8 );
+
+	if( write_count != 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write signature.",
+		 function );
+
+		goto on_error;
+	}
+	libsmdev_io_control_fixture = fixture;
+
+	return( 1 );
+
+on_error:
+	if( fixture != NULL )
+	{
+		libsmdev_io_control_fixture_free(
+		 &fixture,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens an IO control fixture file to record IO control requests to
+ * if the LIBSMDEV_IO_CONTROL_RECORD environment variable contains its filename
+ * This allows recording the IO control requests of a real device, for example
+ * when running smdevinfo, for replaying them in tests
+ * Returns 1 if successful, 0 if not requested or already recording or replaying or -1 on error
+ */
+int libsmdev_io_control_record_open_from_environment(
+     libcerror_error_t **error )
+{
+	const char *filename  = NULL;
+	static char *function = "libsmdev_io_control_record_open_from_environment";
+
+#if defined( HAVE_GETENV ) || defined( WINAPI )
+	filename = getenv(
+	            LIBSMDEV_IO_CONTROL_RECORD_ENVIRONMENT_VARIABLE );
+#endif
+	if( ( filename == NULL )
+	 || ( filename[ 0 ] == 0 ) )
+	{
+		return( 0 );
+	}
+	if( libsmdev_io_control_fixture != NULL )
+	{
+		return( 0 );
+	}
+	if( libsmdev_io_control_record_open(
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open record fixture.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens an IO control fixture file to replay IO control requests from
+ * All subsequent IO control requests are answered from the file, without
+ * accessing the device, until libsmdev_io_control_close is called
+ * Only intended for tests
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_control_replay_open(
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libsmdev_io_control_fixture_t *fixture = NULL;
+	static char *function                  = "libsmdev_io_control_replay_open";
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_io_control_fixture != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid fixture value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_io_control_fixture_initialize(
+	     &fixture,
+	     LIBSMDEV_IO_CONTROL_FIXTURE_MODE_REPLAY,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create fixture.",
+		 function );
+
+		goto on_error;
+	}
+	fixture->file_stream = file_stream_open(
+	                        filename,
+	                        FILE_STREAM_BINARY_OPEN_READ );
+
+	if( fixture->file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libsmdev_io_control_fixture_read_entries(
+	     fixture,
+	     fixture->file_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     fixture->file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file stream.",
+		 function );
+
+		fixture->file_stream = NULL;
+
+		goto on_error;
+	}
+	fixture->file_stream = NULL;
+
+	libsmdev_io_control_fixture = fixture;
+
+	return( 1 );
+
+on_error:
+	if( fixture != NULL )
+	{
+		libsmdev_io_control_fixture_free(
+		 &fixture,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the latency in micro seconds that is injected into every replayed IO control request
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_io_control_set_replay_latency(
+     uint32_t latency,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_control_set_replay_latency";
+
+	if( ( libsmdev_io_control_fixture == NULL )
+	 || ( libsmdev_io_control_fixture->mode != LIBSMDEV_IO_CONTROL_FIXTURE_MODE_REPLAY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing replay fixture.",
+		 function );
+
+		return( -1 );
+	}
+	libsmdev_io_control_fixture->latency = latency;
+
+	return( 1 );
+}
+
+/* Closes the IO control fixture file
+ * Returns 0 if successful or -1 on error
+ */
+int libsmdev_io_control_close(
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_io_control_close";
+
+	if( libsmdev_io_control_fixture_free(
+	     &libsmdev_io_control_fixture,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to free fixture.",
+		 function );
+
+		libsmdev_io_control_fixture = NULL;
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,227 @@
+/*
+ * Input/Output (IO) control functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_IO_CONTROL_H )
+#define _LIBSMDEV_IO_CONTROL_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcfile.h"
+#include "libsmdev_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The IO control fixture signature, the last character is the format version
+ */
+#define LIBSMDEV_IO_CONTROL_FIXTURE_SIGNATURE		"smdevio1"
+
+/* The environment variable that contains the filename of the IO control fixture to record to
+ */
+#define LIBSMDEV_IO_CONTROL_RECORD_ENVIRONMENT_VARIABLE	"LIBSMDEV_IO_CONTROL_RECORD"
+
+/* The size of an IO control fixture entry header
+ * The entry header consists of:
+ * request (4 bytes), result (4 bytes), key size (4 bytes) and data size (4 bytes)
+ */
+#define LIBSMDEV_IO_CONTROL_FIXTURE_ENTRY_HEADER_SIZE	16
+
+/* The maximum size of the key or data of an IO control fixture entry
+ */
+#define LIBSMDEV_IO_CONTROL_FIXTURE_MAXIMUM_DATA_SIZE	( 16 * 1024 * 1024 )
+
+/* The size of the SCSI generic (SG) IO status stored in an IO control fixture entry
+ * The status consists of:
+ * status (1 byte), masked status (1 byte), message status (1 byte),
+ * sense data size (1 byte), host status (2 bytes), driver status (2 bytes),
+ * residual size (4 bytes), duration (4 bytes) and information (4 bytes)
+ */
+#define LIBSMDEV_IO_CONTROL_SG_IO_STATUS_SIZE		20
+
+enum LIBSMDEV_IO_CONTROL_FIXTURE_MODES
+{
+	LIBSMDEV_IO_CONTROL_FIXTURE_MODE_RECORD		= 1,
+	LIBSMDEV_IO_CONTROL_FIXTURE_MODE_REPLAY		= 2
+};
+
+typedef struct libsmdev_io_control_entry libsmdev_io_control_entry_t;
+
+struct libsmdev_io_control_entry
+{
+	/* The request
+	 */
+	uint32_t request;
+
+	/* The result
+	 */
+	int32_t result;
+
+	/* The key
+	 */
+	uint8_t *key;
+
+	/* The key size
+	 */
+	size_t key_size;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct libsmdev_io_control_fixture libsmdev_io_control_fixture_t;
+
+struct libsmdev_io_control_fixture
+{
+	/* The mode
+	 */
+	int mode;
+
+	/* The record file stream
+	 */
+	FILE *file_stream;
+
+	/* The replay entries array
+	 */
+	libcdata_array_t *entries_array;
+
+	/* The index of the entry to start searching from
+	 */
+	int next_entry_index;
+
+	/* The replay latency in micro seconds
+	 */
+	uint32_t latency;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes requests of concurrent threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libsmdev_io_control_entry_initialize(
+     libsmdev_io_control_entry_t **entry,
+     libcerror_error_t **error );
+
+int libsmdev_io_control_entry_free(
+     libsmdev_io_control_entry_t **entry,
+     libcerror_error_t **error );
+
+int libsmdev_io_control_fixture_initialize(
+     libsmdev_io_control_fixture_t **fixture,
+     int mode,
+     libcerror_error_t **error );
+
+int libsmdev_io_control_fixture_free(
+     libsmdev_io_control_fixture_t **fixture,
+     libcerror_error_t **error );
+
+int libsmdev_io_control_fixture_read_entries(
+     libsmdev_io_control_fixture_t *fixture,
+     FILE *file_stream,
+     libcerror_error_t **error );
+
+int libsmdev_io_control_fixture_write_entry(
+     libsmdev_io_control_fixture_t *fixture,
+     uint32_t request,
+     int32_t result,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libsmdev_io_control_fixture_get_entry(
+     libsmdev_io_control_fixture_t *fixture,
+     uint32_t request,
+     const uint8_t *key,
+     size_t key_size,
+     libsmdev_io_control_entry_t **entry,
+     libcerror_error_t **error );
+
+int libsmdev_io_control_fixture_replay_entry(
+     libsmdev_io_control_fixture_t *fixture,
+     uint32_t request,
+     const uint8_t *key,
+     size_t key_size,
+     libsmdev_io_control_entry_t **entry,
+     libcerror_error_t **error );
+
+ssize_t libsmdev_io_control_read_buffer(
+         libsmdev_io_control_fixture_t *fixture,
+         libcfile_file_t *device_file,
+         uint32_t request,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+#if defined( HAVE_SCSI_SG_H )
+
+ssize_t libsmdev_io_control_read_sg_io(
+         libsmdev_io_control_fixture_t *fixture,
+         libcfile_file_t *device_file,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+#endif /* defined( HAVE_SCSI_SG_H ) */
+
+ssize_t libsmdev_io_control_read(
+         libcfile_file_t *device_file,
+         uint32_t request,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+int libsmdev_io_control_record_open(
+     const char *filename,
+     libcerror_error_t **error );
+
+int libsmdev_io_control_record_open_from_environment(
+     libcerror_error_t **error );
+
+int libsmdev_io_control_replay_open(
+     const char *filename,
+     libcerror_error_t **error );
+
+int libsmdev_io_control_set_replay_latency(
+     uint32_t latency,
+     libcerror_error_t **error );
+
+int libsmdev_io_control_close(
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_IO_CONTROL_H ) */
+
@@ -30,13 +30,14 @@
 
 #include "libsmdev_definitions.h"
 #include "libsmdev_handle.h"
-#include "libsmdev_libcdata.h"
+#include "libsmdev_io_control.h"
 #include "libsmdev_libcerror.h"
 #include "libsmdev_libcfile.h"
 #include "libsmdev_libcnotify.h"
 #include "libsmdev_optical_disc.h"
 #include "libsmdev_sector_range.h"
 #include "libsmdev_scsi.h"
+#include "libsmdev_table_of_contents.h"
 #include "libsmdev_track_value.h"
 
 #if defined( HAVE_LINUX_CDROM_H )
@@ -154,11 +155,23 @@ int libsmdev_optical_disc_get_table_of_contents_ioctl(
 
 		return( -1 );
 	}
-	read_count = libcfile_file_io_control_read(
+	if( memory_set(
+	     &toc_header,
+	     0,
+	     sizeof( struct cdrom_tochdr ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear TOC header.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libsmdev_io_control_read(
 	              device_file,
 	              CDROMREADTOCHDR,
-	              NULL,
-	              0,
 	              (uint8_t *) &toc_header,
 	              sizeof( struct cdrom_tochdr ),
 	              error );
@@ -221,11 +234,9 @@ int libsmdev_optical_disc_get_table_of_contents_ioctl(
 		toc_entry.cdte_track  = (uint8_t) entry_index;
 		toc_entry.cdte_format = CDROM_LBA;
 
-		read_count = libcfile_file_io_control_read(
+		read_count = libsmdev_io_control_read(
 		              device_file,
 		              CDROMREADTOCENTRY,
-		              NULL,
-		              0,
 		              (uint8_t *) &toc_entry,
 		              sizeof( struct cdrom_tocentry ),
 		              error );
@@ -440,11 +451,9 @@ int libsmdev_optical_disc_get_table_of_contents_ioctl(
 		toc_entry.cdte_track  = CDROM_LEADOUT;
 		toc_entry.cdte_format = CDROM_LBA;
 
-		read_count = libcfile_file_io_control_read(
+		read_count = libsmdev_io_control_read(
 			      device_file,
 			      CDROMREADTOCENTRY,
-			      NULL,
-			      0,
 			      (uint8_t *) &toc_entry,
 			      sizeof( struct cdrom_tocentry ),
 			      error );
@@ -586,30 +595,15 @@ int libsmdev_optical_disc_get_table_of_contents_ioctl(
 	}
 	if( result == 0 )
 	{
-		if( libcdata_array_empty(
-		     internal_handle->tracks_array,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_track_value_free,
+		if( libsmdev_table_of_contents_empty(
+		     internal_handle->table_of_contents,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to empty tracks array.",
-			 function );
-
-			goto on_error;
-		}
-		if( libcdata_array_empty(
-		     internal_handle->sessions_array,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to empty sessions array.",
+			 "%s: unable to empty table of contents.",
 			 function );
 
 			goto on_error;
@@ -618,20 +612,17 @@ int libsmdev_optical_disc_get_table_of_contents_ioctl(
 	return( result );
 
 on_error:
-	libcdata_array_empty(
-	 internal_handle->tracks_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_track_value_free,
-	 NULL );
-
-	libcdata_array_empty(
-	 internal_handle->sessions_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
+	libsmdev_table_of_contents_empty(
+	 internal_handle->table_of_contents,
 	 NULL );
 
 	return( -1 );
 }
 
 /* Retrieves the table of contents from the optical disk using the SCSI READ TOC command
+ * The raw TOC is read with a single command that uses the maximum allocation length,
+ * the track information is only requested for data tracks since the audio tracks are
+ * identified by the control field of their TOC entry
  * Returns 1 if successful, 0 if not or -1 on error
  */
 int libsmdev_optical_disc_get_table_of_contents_scsi(
@@ -639,36 +630,35 @@ int libsmdev_optical_disc_get_table_of_contents_scsi(
      libsmdev_internal_handle_t *internal_handle,
      libcerror_error_t **error )
 {
-	uint8_t track_info_data[ 64 ];
+	uint32_t lead_out_offsets[ LIBSMDEV_OPTICAL_DISC_MAXIMUM_NUMBER_OF_SESSIONS ];
+	uint32_t next_session_offsets[ LIBSMDEV_OPTICAL_DISC_MAXIMUM_NUMBER_OF_SESSIONS ];
+	uint32_t track_offsets[ LIBSMDEV_OPTICAL_DISC_MAXIMUM_NUMBER_OF_TRACKS ];
+	uint8_t session_flags[ LIBSMDEV_OPTICAL_DISC_MAXIMUM_NUMBER_OF_SESSIONS ];
+	uint8_t track_controls[ LIBSMDEV_OPTICAL_DISC_MAXIMUM_NUMBER_OF_TRACKS ];
+	uint8_t track_sessions[ LIBSMDEV_OPTICAL_DISC_MAXIMUM_NUMBER_OF_TRACKS ];
+	uint8_t track_types[ LIBSMDEV_OPTICAL_DISC_MAXIMUM_NUMBER_OF_TRACKS ];
+	uint8_t track_info_data[ LIBSMDEV_OPTICAL_DISC_TRACK_INFORMATION_DATA_SIZE ];
 
 	uint8_t *toc_data            = NULL;
-	uint8_t *toc_entries         = NULL;
+	uint8_t *toc_entry           = NULL;
 	static char *function        = "libsmdev_optical_disc_get_table_of_contents_scsi";
-	void *reallocation           = NULL;
 	size_t toc_data_offset       = 0;
 	size_t toc_data_size         = 0;
 	ssize_t read_count           = 0;
-	uint32_t lead_out_size       = 0;
-	uint32_t lead_out_offset     = 0;
-	uint32_t last_track_offset   = 0;
-	uint32_t track_offset        = 0;
-	uint32_t session_size        = 0;
+	uint32_t session_end_offset  = 0;
 	uint32_t session_offset      = 0;
-	uint32_t next_session_offset = 0;
-	uint8_t first_track_number   = 0;
-	uint8_t last_track_number    = 0;
-	uint8_t lead_out_index       = 0;
+	uint32_t track_end_offset    = 0;
+	uint32_t track_offset        = 0;
+	uint8_t number_of_lead_outs  = 0;
 	uint8_t number_of_sessions   = 0;
+	uint8_t number_of_tracks     = 0;
+	uint8_t point                = 0;
 	uint8_t session_index        = 0;
+	uint8_t session_number       = 0;
 	uint8_t track_index          = 0;
-	uint8_t track_number         = 0;
-	uint8_t track_type           = 0;
+	uint8_t track_information    = 1;
 	int result                   = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint16_t entry_index         = 0;
-#endif
-
 	if( device_file == NULL )
 	{
 		libcerror_error_set(
@@ -691,10 +681,51 @@ int libsmdev_optical_disc_get_table_of_contents_scsi(
 
 		return( -1 );
 	}
-	toc_data_size = 1024;
+	result = libcfile_file_is_open(
+	          device_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if device file is open.",
+		 function );
 
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid device file - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     session_flags,
+	     0,
+	     sizeof( uint8_t ) * LIBSMDEV_OPTICAL_DISC_MAXIMUM_NUMBER_OF_SESSIONS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear session flags.",
+		 function );
+
+		goto on_error;
+	}
+	/* The allocation length of READ TOC is 16-bit, by using the largest even value
+	 * the entire raw TOC is returned by the first command
+	 */
 	toc_data = (uint8_t *) memory_allocate(
-	                        sizeof( uint8_t ) * toc_data_size );
+	                        sizeof( uint8_t ) * LIBSMDEV_OPTICAL_DISC_RAW_TOC_DATA_SIZE );
 
 	if( toc_data == NULL )
 	{
@@ -710,7 +741,7 @@ int libsmdev_optical_disc_get_table_of_contents_scsi(
 	if( memory_set(
 	     toc_data,
 	     0,
-	     sizeof( uint8_t ) * toc_data_size ) == NULL )
+	     sizeof( uint8_t ) * LIBSMDEV_OPTICAL_DISC_RAW_TOC_DATA_SIZE ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -725,7 +756,7 @@ int libsmdev_optical_disc_get_table_of_contents_scsi(
 	              device_file,
 	              LIBSMDEV_SCSI_TOC_CDB_FORMAT_RAW_TOC,
 	              toc_data,
-	              toc_data_size,
+	              LIBSMDEV_OPTICAL_DISC_RAW_TOC_DATA_SIZE,
 	              error );
 
 	if( read_count == -1 )
@@ -751,63 +782,19 @@ int libsmdev_optical_disc_get_table_of_contents_scsi(
 		libcerror_error_free(
 		 error );
 
-		byte_stream_copy_to_uint16_big_endian(
-		 toc_data,
-		 toc_data_size );
-
-		if( toc_data_size > 1024 )
-		{
-			reallocation = memory_reallocate(
-					toc_data,
-					sizeof( uint8_t ) * toc_data_size );
-
-			if( reallocation == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to resize TOC data.",
-				 function );
-
-				goto on_error;
-			}
-			toc_data = (uint8_t *) reallocation;
-
-			read_count = libsmdev_scsi_read_toc(
-			              device_file,
-			              LIBSMDEV_SCSI_TOC_CDB_FORMAT_RAW_TOC,
-			              toc_data,
-			              toc_data_size,
-			              error );
-
-			if( read_count == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve TOC.",
-				 function );
+		memory_free(
+		 toc_data );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-				}
-#endif
-				libcerror_error_free(
-				 error );
-			}
-		}
+		return( 0 );
 	}
-	toc_data_size = (size_t) read_count;
+	/* The TOC data length does not include the size of the data length value
+	 */
+	toc_data_size = (size_t) read_count + 2;
 
+	if( toc_data_size > LIBSMDEV_OPTICAL_DISC_RAW_TOC_DATA_SIZE )
+	{
+		toc_data_size = LIBSMDEV_OPTICAL_DISC_RAW_TOC_DATA_SIZE;
+	}
 	if( toc_data_size > 4 )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -822,7 +809,7 @@ int libsmdev_optical_disc_get_table_of_contents_scsi(
 			 0 );
 		}
 #endif
-		number_of_sessions = (uint16_t) toc_data[ 3 ];
+		number_of_sessions = toc_data[ 3 ];
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -836,566 +823,521 @@ int libsmdev_optical_disc_get_table_of_contents_scsi(
 			 "\n" );
 		}
 #endif
-		toc_entries     = &( toc_data[ 4 ] );
-		toc_data_offset = 4;
+		if( ( number_of_sessions == 0 )
+		 || ( number_of_sessions > LIBSMDEV_OPTICAL_DISC_MAXIMUM_NUMBER_OF_SESSIONS ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of sessions value out of bounds.",
+			 function );
 
-		while( toc_data_offset < (size_t) toc_data_size )
+			goto on_error;
+		}
+		/* Collect the track, lead-out and next session offsets in a single pass
+		 */
+		for( toc_data_offset = 4;
+		     ( toc_data_offset + 11 ) <= toc_data_size;
+		     toc_data_offset += 11 )
 		{
+			toc_entry = &( toc_data[ toc_data_offset ] );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
 				libcnotify_printf(
-				 "%s: entry: %02" PRIu16 ":\n",
+				 "%s: entry: %02" PRIzu ":\n",
 				 function,
-				 entry_index );
+				 ( toc_data_offset - 4 ) / 11 );
 				libcnotify_print_data(
-				 toc_entries,
+				 toc_entry,
 				 11,
 				 0 );
 			}
 #endif
-			if( toc_entries[ 3 ] <= 0x63 )
-			{
-				libsmdev_optical_disc_copy_msf_to_lba(
-				 toc_entries[ 8 ],
-				 toc_entries[ 9 ],
-				 toc_entries[ 10 ],
-				 track_offset );
-			}
-			else if( toc_entries[ 3 ] == 0xa0 )
-			{
-				first_track_number = toc_entries[ 8 ];
-			}
-			else if( toc_entries[ 3 ] == 0xa1 )
-			{
-				last_track_number = toc_entries[ 8 ];
-			}
-			else if( toc_entries[ 3 ] == 0xa2 )
-			{
-				libsmdev_optical_disc_copy_msf_to_lba(
-				 toc_entries[ 8 ],
-				 toc_entries[ 9 ],
-				 toc_entries[ 10 ],
-				 lead_out_offset );
-			}
-			else if( toc_entries[ 3 ] == 0xb0 )
-			{
-				libsmdev_optical_disc_copy_absolute_msf_to_lba(
-				 toc_entries[ 4 ],
-				 toc_entries[ 5 ],
-				 toc_entries[ 6 ],
-				 next_session_offset );
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			session_number = toc_entry[ 0 ];
+			point          = toc_entry[ 3 ];
+
+			if( ( session_number == 0 )
+			 || ( session_number > number_of_sessions ) )
 			{
-				if( toc_entries[ 3 ] <= 0x63 )
-				{
-					libcnotify_printf(
-					 "%s: session: %02" PRIu16 " track: %02" PRIu8 "\t\t\t: %02" PRIu8 ":%02" PRIu8 ".%02" PRIu8 " (offset: %" PRIu32 ")\n",
-					 function,
-					 toc_entries[ 0 ],
-					 toc_entries[ 3 ],
-					 toc_entries[ 4 ],
-					 toc_entries[ 5 ],
-					 toc_entries[ 6 ],
-					 track_offset );
-				}
-				else if( toc_entries[ 3 ] == 0xa0 )
-				{
-					libcnotify_printf(
-					 "%s: session: %02" PRIu8 " first track number\t: %" PRIu8 "\n",
-					 function,
-					 toc_entries[ 0 ],
-					 first_track_number );
-				}
-				else if( toc_entries[ 3 ] == 0xa1 )
-				{
-					libcnotify_printf(
-					 "%s: session: %02" PRIu8 " last track number\t\t: %" PRIu8 "\n",
-					 function,
-					 toc_entries[ 0 ],
-					 last_track_number );
-				}
-				else if( toc_entries[ 3 ] == 0xa2 )
-				{
-					libcnotify_printf(
-					 "%s: session: %02" PRIu8 " lead out\t\t\t: %02" PRIu8 ":%02" PRIu8 ".%02" PRIu8 " (offset: %" PRIu32 ")\n",
-					 function,
-					 toc_entries[ 0 ],
-					 toc_entries[ 8 ],
-					 toc_entries[ 9 ],
-					 toc_entries[ 10 ],
-					 lead_out_offset );
-				}
-				else if( toc_entries[ 3 ] == 0xb0 )
-				{
-					libcnotify_printf(
-					 "%s: session: %02" PRIu16 " end\t\t\t: %02" PRIu8 ":%02" PRIu8 ".%02" PRIu8 " (offset: %" PRIu32 ")\n",
-					 function,
-					 toc_entries[ 0 ],
-					 toc_entries[ 4 ],
-					 toc_entries[ 5 ],
-					 toc_entries[ 6 ],
-					 next_session_offset );
-				}
-				libcnotify_printf(
-				 "\n" );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid session number value out of bounds.",
+				 function );
+
+				goto on_error;
 			}
-#endif
-			if( ( toc_entries[ 3 ] <= 0x63 )
-			 || ( toc_entries[ 3 ] == 0xb0 ) )
+			session_index = session_number - 1;
+
+			if( ( toc_entry[ 1 ] >> 4 ) == 5 )
 			{
-				if( track_number >= first_track_number )
+				if( point == 0xb0 )
 				{
-			 		if( toc_entries[ 3 ] == 0xb0 )
-					{
-						track_offset = lead_out_offset;
-					}
-					if( track_offset < last_track_offset )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid track offset value out of bounds.",
-						 function );
+					libsmdev_optical_disc_copy_absolute_msf_to_lba(
+					 toc_entry[ 4 ],
+					 toc_entry[ 5 ],
+					 toc_entry[ 6 ],
+					 next_session_offsets[ session_index ] );
 
-						goto on_error;
-					}
-					if( ( track_index + 1 ) != track_number )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid track number value out of bounds.",
-						 function );
-
-						goto on_error;
-					}
-			 		if( toc_entries[ 3 ] == 0xa2 )
-					{
-						if( track_number != last_track_number )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid track number value out of bounds.",
-							 function );
-
-							goto on_error;
-						}
-					}
-					if( memory_set(
-					     track_info_data,
-					     0,
-					     64 ) == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_MEMORY,
-						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-						 "%s: unable to clear track info data.",
-						 function );
-
-						goto on_error;
-					}
-					read_count = libsmdev_scsi_read_track_information(
-					              device_file,
-					              last_track_offset,
-					              track_info_data,
-					              64,
-					              error );
-
-					if( read_count == -1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve track info data: %d.",
-						 function,
-						 track_index );
+					session_flags[ session_index ] |= LIBSMDEV_OPTICAL_DISC_SESSION_FLAG_HAS_NEXT_SESSION;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							if( ( error != NULL )
-							 && ( *error != NULL ) )
-							{
-								libcnotify_print_error_backtrace(
-								 *error );
-							}
-						}
-#endif
-						libcerror_error_free(
-						 error );
-
-						break;
-					}
 #if defined( HAVE_DEBUG_OUTPUT )
 					if( libcnotify_verbose != 0 )
 					{
 						libcnotify_printf(
-						 "%s: track information data: %d:\n",
+						 "%s: session: %02" PRIu8 " end\t\t\t: %02" PRIu8 ":%02" PRIu8 ".%02" PRIu8 " (offset: %" PRIu32 ")\n\n",
 						 function,
-						 track_index );
-						libcnotify_print_data(
-						 track_info_data,
-						 (size_t) read_count,
-						 0 );
+						 session_number,
+						 toc_entry[ 4 ],
+						 toc_entry[ 5 ],
+						 toc_entry[ 6 ],
+						 next_session_offsets[ session_index ] );
 					}
 #endif
-					if( track_info_data[ 2 ] != toc_entries[ 0 ] )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid track information data - session number value out of bounds.",
-						 function );
-
-						goto on_error;
-					}
-					if( track_info_data[ 3 ] != track_number )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid track information data - track number value out of bounds.",
-						 function );
-
-						goto on_error;
-					}
-					track_type = LIBSMDEV_TRACK_TYPE_UNKNOWN;
-
-					if( ( track_info_data[ 5 ] & 0x04 ) != 0 )
-					{
-						if( ( track_info_data[ 5 ] & 0x08 ) == 0 )
-						{
-							if( ( track_info_data[ 6 ] & 0x0f ) == 1 )
-							{
-								track_type = LIBSMDEV_TRACK_TYPE_MODE1_2048;
-							}
-							else if( ( track_info_data[ 6 ] & 0x0f ) == 2 )
-							{
-								track_type = LIBSMDEV_TRACK_TYPE_MODE2_2048;
-							}
-						}
-					}
-					else
-					{
-						track_type = LIBSMDEV_TRACK_TYPE_AUDIO;
-					}
-					if( libsmdev_handle_append_track(
-					     internal_handle,
-					     last_track_offset,
-					     track_offset - last_track_offset,
-					     track_type,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to append track: %d.",
-						 function,
-						 track_index );
-
-						goto on_error;
-					}
-					track_index++;
-				}
-				last_track_offset = track_offset;
-
-			 	if( toc_entries[ 3 ] != 0xb0 )
-				{
-					track_number = toc_entries[ 3 ];
 				}
+				continue;
 			}
-			if( toc_entries[ 3 ] == 0xb0 )
+			if( ( toc_entry[ 1 ] >> 4 ) != 1 )
 			{
-				if( session_offset >= next_session_offset )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid session offset value out of bounds.",
-					 function );
-
-					goto on_error;
-				}
-				if( ( session_index + 1 ) != toc_entries[ 0 ] )
+				continue;
+			}
+			if( ( point >= 0x01 )
+			 && ( point <= 0x63 ) )
+			{
+				if( ( point != ( number_of_tracks + 1 ) )
+				 || ( number_of_tracks >= LIBSMDEV_OPTICAL_DISC_MAXIMUM_NUMBER_OF_TRACKS ) )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid session number value out of bounds.",
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid track number value out of bounds.",
 					 function );
 
 					goto on_error;
 				}
-				lead_out_size = 0;
+				libsmdev_optical_disc_copy_msf_to_lba(
+				 toc_entry[ 8 ],
+				 toc_entry[ 9 ],
+				 toc_entry[ 10 ],
+				 track_offset );
 
-				if( ( lead_out_offset >= session_offset )
-				 && ( lead_out_offset < next_session_offset ) )
+				if( number_of_tracks > 0 )
 				{
-					lead_out_size = next_session_offset - lead_out_offset;
-
-					if( libsmdev_handle_append_lead_out(
-					     internal_handle,
-					     lead_out_offset,
-					     lead_out_size,
-					     error ) != 1 )
+					if( ( track_offset < track_offsets[ number_of_tracks - 1 ] )
+					 || ( session_number < track_sessions[ number_of_tracks - 1 ] ) )
 					{
 						libcerror_error_set(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to append lead_out: %d.",
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid track: %" PRIu8 " offset value out of bounds.",
 						 function,
-						 lead_out_index );
+						 point );
 
 						goto on_error;
 					}
-					lead_out_index++;
 				}
-				session_size = next_session_offset - session_offset;
+				track_offsets[ number_of_tracks ]  = track_offset;
+				track_controls[ number_of_tracks ] = toc_entry[ 1 ] & 0x0f;
+				track_sessions[ number_of_tracks ] = session_number;
 
-				if( ( session_index + 1 ) == number_of_sessions )
-				{
-					session_size -= lead_out_size;
-				}
-				if( libsmdev_handle_append_session(
-				     internal_handle,
-				     session_offset,
-				     session_size,
-				     error ) != 1 )
+				number_of_tracks++;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append session: %d.",
+					libcnotify_printf(
+					 "%s: session: %02" PRIu8 " track: %02" PRIu8 "\t\t\t: %02" PRIu8 ":%02" PRIu8 ".%02" PRIu8 " (offset: %" PRIu32 ")\n\n",
 					 function,
-					 session_index );
-
-					goto on_error;
+					 session_number,
+					 point,
+					 toc_entry[ 8 ],
+					 toc_entry[ 9 ],
+					 toc_entry[ 10 ],
+					 track_offset );
 				}
-				session_offset = next_session_offset;
-
-				session_index++;
+#endif
 			}
-			toc_entries     += 11;
-			toc_data_offset += 11;
+			else if( point == 0xa2 )
+			{
+				libsmdev_optical_disc_copy_msf_to_lba(
+				 toc_entry[ 8 ],
+				 toc_entry[ 9 ],
+				 toc_entry[ 10 ],
+				 lead_out_offsets[ session_index ] );
+
+				session_flags[ session_index ] |= LIBSMDEV_OPTICAL_DISC_SESSION_FLAG_HAS_LEAD_OUT;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-			entry_index++;
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: session: %02" PRIu8 " lead out\t\t\t: %02" PRIu8 ":%02" PRIu8 ".%02" PRIu8 " (offset: %" PRIu32 ")\n\n",
+					 function,
+					 session_number,
+					 toc_entry[ 8 ],
+					 toc_entry[ 9 ],
+					 toc_entry[ 10 ],
+					 lead_out_offsets[ session_index ] );
+				}
 #endif
+			}
 		}
-		if( ( track_index + 1 ) == track_number )
+	}
+	memory_free(
+	 toc_data );
+
+	toc_data = NULL;
+
+	if( number_of_tracks == 0 )
+	{
+		return( 0 );
+	}
+	/* Validate the session boundaries before any track information is requested
+	 */
+	session_offset = 0;
+
+	for( session_index = 0;
+	     session_index < number_of_sessions;
+	     session_index++ )
+	{
+		if( ( session_flags[ session_index ] & LIBSMDEV_OPTICAL_DISC_SESSION_FLAG_HAS_LEAD_OUT ) == 0 )
 		{
-			if( track_offset < last_track_offset )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid track offset value out of bounds.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing session: %" PRIu8 " lead-out.",
+			 function,
+			 session_index + 1 );
 
-				goto on_error;
-			}
-			if( memory_set(
-			     track_info_data,
-			     0,
-			     64 ) == NULL )
+			goto on_error;
+		}
+		if( ( session_index + 1 ) < number_of_sessions )
+		{
+			if( ( session_flags[ session_index ] & LIBSMDEV_OPTICAL_DISC_SESSION_FLAG_HAS_NEXT_SESSION ) == 0 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to clear track info data.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing session: %" PRIu8 " next session offset.",
+				 function,
+				 session_index + 1 );
 
 				goto on_error;
 			}
-			read_count = libsmdev_scsi_read_track_information(
-			              device_file,
-			              last_track_offset,
-			              track_info_data,
-			              64,
-			              error );
-
-			if( read_count == -1 )
+		}
+		if( ( session_flags[ session_index ] & LIBSMDEV_OPTICAL_DISC_SESSION_FLAG_HAS_NEXT_SESSION ) != 0 )
+		{
+			if( ( lead_out_offsets[ session_index ] < session_offset )
+			 || ( lead_out_offsets[ session_index ] >= next_session_offsets[ session_index ] ) )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve track info data: %d.",
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid session: %" PRIu8 " offset value out of bounds.",
 				 function,
-				 track_index );
+				 session_index + 1 );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					if( ( error != NULL )
-					 && ( *error != NULL ) )
-					{
-						libcnotify_print_error_backtrace(
-						 *error );
-					}
-				}
-#endif
-				libcerror_error_free(
-				 error );
+				goto on_error;
 			}
-			else
-			{
+			number_of_lead_outs++;
+
+			session_offset = next_session_offsets[ session_index ];
+		}
+		else if( lead_out_offsets[ session_index ] < session_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid session: %" PRIu8 " lead-out offset value out of bounds.",
+			 function,
+			 session_index + 1 );
+
+			goto on_error;
+		}
+	}
+	for( track_index = 0;
+	     track_index < number_of_tracks;
+	     track_index++ )
+	{
+		session_index = track_sessions[ track_index ] - 1;
+
+		if( ( ( track_index + 1 ) < number_of_tracks )
+		 && ( track_sessions[ track_index + 1 ] == track_sessions[ track_index ] ) )
+		{
+			track_end_offset = track_offsets[ track_index + 1 ];
+		}
+		else
+		{
+			track_end_offset = lead_out_offsets[ session_index ];
+		}
+		if( track_end_offset < track_offsets[ track_index ] )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid track: %" PRIu8 " offset value out of bounds.",
+			 function,
+			 track_index + 1 );
+
+			goto on_error;
+		}
+	}
+	/* The track information is only needed to determine the mode of data tracks,
+	 * the same response buffer is used for every track. If the device does not
+	 * support READ TRACK INFORMATION the remaining data tracks are not queried.
+	 */
+	for( track_index = 0;
+	     track_index < number_of_tracks;
+	     track_index++ )
+	{
+		track_types[ track_index ] = LIBSMDEV_TRACK_TYPE_UNKNOWN;
+
+		if( ( track_controls[ track_index ] & 0x04 ) == 0 )
+		{
+			track_types[ track_index ] = LIBSMDEV_TRACK_TYPE_AUDIO;
+
+			continue;
+		}
+		if( track_information == 0 )
+		{
+			continue;
+		}
+		if( memory_set(
+		     track_info_data,
+		     0,
+		     LIBSMDEV_OPTICAL_DISC_TRACK_INFORMATION_DATA_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear track info data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libsmdev_scsi_read_track_information(
+		              device_file,
+		              track_offsets[ track_index ],
+		              track_info_data,
+		              LIBSMDEV_OPTICAL_DISC_TRACK_INFORMATION_DATA_SIZE,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve track info data: %" PRIu8 ".",
+			 function,
+			 track_index );
+
 #if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
 				{
-					libcnotify_printf(
-					 "%s: track information data: %d:\n",
-					 function,
-					 track_index );
-					libcnotify_print_data(
-					 track_info_data,
-					 (size_t) read_count,
-					 0 );
+					libcnotify_print_error_backtrace(
+					 *error );
 				}
+			}
 #endif
-				if( track_info_data[ 2 ] != toc_entries[ 0 ] )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid track information data - session number value out of bounds.",
-					 function );
+			libcerror_error_free(
+			 error );
 
-					goto on_error;
-				}
-				if( track_info_data[ 3 ] != toc_entries[ 3 ] )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid track information data - track number value out of bounds.",
-					 function );
+			track_information = 0;
 
-					goto on_error;
-				}
-				track_type = LIBSMDEV_TRACK_TYPE_UNKNOWN;
+			continue;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: track information data: %" PRIu8 ":\n",
+			 function,
+			 track_index );
+			libcnotify_print_data(
+			 track_info_data,
+			 LIBSMDEV_OPTICAL_DISC_TRACK_INFORMATION_DATA_SIZE,
+			 0 );
+		}
+#endif
+		/* The track information data contains the least significant byte of
+		 * the track number in byte 2 and of the session number in byte 3
+		 */
+		if( track_info_data[ 2 ] != ( track_index + 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid track information data - track number value out of bounds.",
+			 function );
 
-				if( ( track_info_data[ 5 ] & 0x04 ) != 0 )
-				{
-					if( ( track_info_data[ 5 ] & 0x08 ) == 0 )
-					{
-						if( ( track_info_data[ 6 ] & 0x0f ) == 1 )
-						{
-							track_type = LIBSMDEV_TRACK_TYPE_MODE1_2048;
-						}
-						else if( ( track_info_data[ 6 ] & 0x0f ) == 2 )
-						{
-							track_type = LIBSMDEV_TRACK_TYPE_MODE2_2048;
-						}
-					}
-				}
-				else
+			goto on_error;
+		}
+		if( track_info_data[ 3 ] != track_sessions[ track_index ] )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid track information data - session number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( track_info_data[ 5 ] & 0x04 ) != 0 )
+		{
+			if( ( track_info_data[ 5 ] & 0x08 ) == 0 )
+			{
+				if( ( track_info_data[ 6 ] & 0x0f ) == 1 )
 				{
-					track_type = LIBSMDEV_TRACK_TYPE_AUDIO;
+					track_types[ track_index ] = LIBSMDEV_TRACK_TYPE_MODE1_2048;
 				}
-				if( libsmdev_handle_append_track(
-				     internal_handle,
-				     last_track_offset,
-				     track_offset - last_track_offset,
-				     track_type,
-				     error ) != 1 )
+				else if( ( track_info_data[ 6 ] & 0x0f ) == 2 )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append last track: %d.",
-					 function,
-					 track_index );
-
-					goto on_error;
+					track_types[ track_index ] = LIBSMDEV_TRACK_TYPE_MODE2_2048;
 				}
 			}
-			if( session_index != number_of_sessions )
+		}
+		else
+		{
+			track_types[ track_index ] = LIBSMDEV_TRACK_TYPE_AUDIO;
+		}
+	}
+	/* Store the sessions, lead-outs and tracks in the contiguous table of contents entries
+	 */
+	if( libsmdev_table_of_contents_empty(
+	     internal_handle->table_of_contents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty table of contents.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_table_of_contents_reserve(
+	     internal_handle->table_of_contents,
+	     (int) number_of_sessions,
+	     (int) number_of_lead_outs,
+	     (int) number_of_tracks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve table of contents entries.",
+		 function );
+
+		goto on_error;
+	}
+	session_offset = 0;
+
+	for( session_index = 0;
+	     session_index < number_of_sessions;
+	     session_index++ )
+	{
+		if( ( session_flags[ session_index ] & LIBSMDEV_OPTICAL_DISC_SESSION_FLAG_HAS_NEXT_SESSION ) != 0 )
+		{
+			if( libsmdev_table_of_contents_append_lead_out(
+			     internal_handle->table_of_contents,
+			     (uint64_t) lead_out_offsets[ session_index ],
+			     (uint64_t) ( next_session_offsets[ session_index ] - lead_out_offsets[ session_index ] ),
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid session index value out of bounds.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append lead-out of session: %" PRIu8 ".",
+				 function,
+				 session_index );
 
 				goto on_error;
 			}
-			result = 1;
 		}
-	}
-	if( result == 0 )
-	{
-		if( libcdata_array_empty(
-		     internal_handle->tracks_array,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_track_value_free,
-		     error ) != 1 )
+		/* The last session ends at its lead-out, other sessions include their lead-out
+		 */
+		if( ( session_index + 1 ) == number_of_sessions )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to empty tracks array.",
-			 function );
-
-			goto on_error;
+			session_end_offset = lead_out_offsets[ session_index ];
+		}
+		else
+		{
+			session_end_offset = next_session_offsets[ session_index ];
 		}
-		if( libcdata_array_empty(
-		     internal_handle->lead_outs_array,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
+		if( libsmdev_table_of_contents_append_session(
+		     internal_handle->table_of_contents,
+		     (uint64_t) session_offset,
+		     (uint64_t) ( session_end_offset - session_offset ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to empty lead outs array.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append session: %" PRIu8 ".",
+			 function,
+			 session_index );
 
 			goto on_error;
 		}
-		if( libcdata_array_empty(
-		     internal_handle->sessions_array,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
+		if( ( session_flags[ session_index ] & LIBSMDEV_OPTICAL_DISC_SESSION_FLAG_HAS_NEXT_SESSION ) != 0 )
+		{
+			session_offset = next_session_offsets[ session_index ];
+		}
+	}
+	for( track_index = 0;
+	     track_index < number_of_tracks;
+	     track_index++ )
+	{
+		if( ( ( track_index + 1 ) < number_of_tracks )
+		 && ( track_sessions[ track_index + 1 ] == track_sessions[ track_index ] ) )
+		{
+			track_end_offset = track_offsets[ track_index + 1 ];
+		}
+		else
+		{
+			track_end_offset = lead_out_offsets[ track_sessions[ track_index ] - 1 ];
+		}
+		if( libsmdev_table_of_contents_append_track(
+		     internal_handle->table_of_contents,
+		     (uint64_t) track_offsets[ track_index ],
+		     (uint64_t) ( track_end_offset - track_offsets[ track_index ] ),
+		     track_types[ track_index ],
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to empty sessions array.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append track: %" PRIu8 ".",
+			 function,
+			 track_index );
 
 			goto on_error;
 		}
 	}
-	memory_free(
-	 toc_data );
-
-	toc_data = NULL;
-
-	return( result );
+	return( 1 );
 
 on_error:
 	if( toc_data != NULL )
@@ -1403,19 +1345,8 @@ on_error:
 		memory_free(
 		 toc_data );
 	}
-	libcdata_array_empty(
-	 internal_handle->tracks_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_track_value_free,
-	 NULL );
-
-	libcdata_array_empty(
-	 internal_handle->lead_outs_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
-	 NULL );
-
-	libcdata_array_empty(
-	 internal_handle->sessions_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_sector_range_free,
+	libsmdev_table_of_contents_empty(
+	 internal_handle->table_of_contents,
 	 NULL );
 
 	return( -1 );
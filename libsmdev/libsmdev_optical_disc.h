@@ -35,6 +35,24 @@ extern "C" {
 
 #if defined( HAVE_LINUX_CDROM_H )
 
+/* The size of the raw TOC data, the largest even READ TOC allocation length
+ */
+#define LIBSMDEV_OPTICAL_DISC_RAW_TOC_DATA_SIZE				65534
+
+/* The size of the track information data
+ */
+#define LIBSMDEV_OPTICAL_DISC_TRACK_INFORMATION_DATA_SIZE		64
+
+/* The maximum number of sessions and tracks of a compact disc
+ */
+#define LIBSMDEV_OPTICAL_DISC_MAXIMUM_NUMBER_OF_SESSIONS		99
+#define LIBSMDEV_OPTICAL_DISC_MAXIMUM_NUMBER_OF_TRACKS			99
+
+/* The session flags used while parsing the raw TOC
+ */
+#define LIBSMDEV_OPTICAL_DISC_SESSION_FLAG_HAS_LEAD_OUT			0x01
+#define LIBSMDEV_OPTICAL_DISC_SESSION_FLAG_HAS_NEXT_SESSION		0x02
+
 int libsmdev_optical_disc_get_table_of_contents(
      libcfile_file_t *device_file,
      libsmdev_internal_handle_t *internal_handle,
@@ -0,0 +1,1564 @@
+/*
+ * Optical read functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_LINUX_FS_H ) && !defined( WINAPI )
+/* Required for Linux platforms that use a sizeof( u64 )
+ * in linux/fs.h but have no typedef of it
+ */
+#if !defined( HAVE_U64 )
+typedef size_t u64;
+#endif
+
+#include <linux/fs.h>
+#endif
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_handle.h"
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcnotify.h"
+#include "libsmdev_optical_read.h"
+#include "libsmdev_read_speed.h"
+#include "libsmdev_scsi.h"
+
+/* Retrieves the size of a frame returned by an optical read
+ * Returns the frame size
+ */
+size_t libsmdev_optical_read_get_frame_size(
+        uint8_t read_flags )
+{
+	size_t frame_size = LIBSMDEV_OPTICAL_READ_FRAME_SIZE;
+
+	if( ( read_flags & LIBSMDEV_OPTICAL_READ_FLAG_SUB_CHANNEL ) != 0 )
+	{
+		frame_size += LIBSMDEV_OPTICAL_READ_SUB_CHANNEL_SIZE;
+	}
+	return( frame_size );
+}
+
+/* Retrieves the size of a frame as transferred by the device
+ * The C2 error pointers are only part of the transferred frame
+ * Returns the frame size
+ */
+size_t libsmdev_optical_read_get_transfer_frame_size(
+        uint8_t read_flags )
+{
+	size_t frame_size = 0;
+
+	frame_size = libsmdev_optical_read_get_frame_size(
+	              read_flags );
+
+	if( ( read_flags & LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS ) != 0 )
+	{
+		frame_size += LIBSMDEV_OPTICAL_READ_C2_ERROR_POINTERS_SIZE;
+	}
+	return( frame_size );
+}
+
+/* Retrieves the number of frames that are read with a single command
+ * The batch fills the maximum transfer size of the device but contains at least 1 frame
+ * Returns the number of frames
+ */
+uint32_t libsmdev_optical_read_get_batch_size(
+          size_t maximum_transfer_size,
+          size_t frame_size )
+{
+	size_t batch_size = 1;
+
+	if( frame_size > 0 )
+	{
+		batch_size = maximum_transfer_size / frame_size;
+	}
+	if( batch_size == 0 )
+	{
+		batch_size = 1;
+	}
+	/* The transfer length of the READ CD command is a 24-bit value
+	 */
+	else if( batch_size > 0x00ffffffUL )
+	{
+		batch_size = 0x00ffffffUL;
+	}
+	return( (uint32_t) batch_size );
+}
+
+/* Retrieves the maximum size of the data transferred by a single command
+ * The value is determined once, if the device does not report it a default of 64 KiB is used
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_optical_read_get_maximum_transfer_size(
+     libsmdev_internal_handle_t *internal_handle,
+     size_t *maximum_transfer_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libsmdev_optical_read_get_maximum_transfer_size";
+
+#if defined( BLKSECTGET )
+	unsigned short maximum_sectors = 0;
+	ssize_t read_count             = 0;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_transfer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum transfer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->maximum_transfer_size == 0 )
+	{
+		internal_handle->maximum_transfer_size = LIBSMDEV_OPTICAL_READ_DEFAULT_MAXIMUM_TRANSFER_SIZE;
+
+#if defined( BLKSECTGET )
+		/* The value is the maximum number of 512-byte sectors of a single request
+		 */
+		if( internal_handle->io_backend != NULL )
+		{
+			read_count = libsmdev_io_backend_io_control_read(
+			              internal_handle->io_backend,
+			              BLKSECTGET,
+			              (uint8_t *) &maximum_sectors,
+			              sizeof( unsigned short ),
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+				 "%s: unable to query device for: BLKSECTGET.",
+				 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					if( ( error != NULL )
+					 && ( *error != NULL ) )
+					{
+						libcnotify_print_error_backtrace(
+						 *error );
+					}
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+			else if( maximum_sectors > 0 )
+			{
+				internal_handle->maximum_transfer_size = (size_t) maximum_sectors * 512;
+			}
+		}
+#endif /* defined( BLKSECTGET ) */
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: maximum transfer size\t\t: %" PRIzd "\n",
+			 function,
+			 internal_handle->maximum_transfer_size );
+		}
+#endif
+	}
+	*maximum_transfer_size = internal_handle->maximum_transfer_size;
+
+	return( 1 );
+}
+
+/* Determines if C2 error pointers mark any byte of a frame as damaged
+ * Returns 1 if the frame is damaged or 0 if not
+ */
+int libsmdev_optical_read_has_c2_errors(
+     const uint8_t *c2_error_pointers,
+     size_t size )
+{
+	size_t byte_index = 0;
+
+	if( c2_error_pointers == NULL )
+	{
+		return( 0 );
+	}
+	for( byte_index = 0;
+	     byte_index < size;
+	     byte_index++ )
+	{
+		if( c2_error_pointers[ byte_index ] != 0 )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the number of bytes per sector used for the error ranges of optical sectors
+ * The error ranges refer to the same sectors as reads of the device, which default to 2048 bytes per sector
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_optical_read_get_error_bytes_per_sector(
+     libsmdev_internal_handle_t *internal_handle,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_optical_read_get_error_bytes_per_sector";
+	int result            = 0;
+
+	if( bytes_per_sector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsmdev_handle_get_bytes_per_sector(
+	          (libsmdev_handle_t *) internal_handle,
+	          bytes_per_sector,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( *bytes_per_sector == 0 ) )
+	{
+		*bytes_per_sector = 2048;
+	}
+	return( 1 );
+}
+
+/* Appends suspect sectors
+ * The sectors are added to the suspect sectors and to the errors
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_optical_read_append_suspect_sectors(
+     libsmdev_internal_handle_t *internal_handle,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function     = "libsmdev_optical_read_append_suspect_sectors";
+	uint32_t bytes_per_sector = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_optical_read_get_error_bytes_per_sector(
+	     internal_handle,
+	     &bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_insert_range(
+	     internal_handle->suspect_sectors_range_list,
+	     start_sector,
+	     number_of_sectors,
+	     NULL,
+	     NULL,
+	     NULL,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert suspect sectors in range list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_insert_range(
+	     internal_handle->errors_range_list,
+	     start_sector * bytes_per_sector,
+	     number_of_sectors * bytes_per_sector,
+	     NULL,
+	     NULL,
+	     NULL,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert error in range list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes sectors that were read successfully from the suspect sectors and the errors
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_optical_read_remove_suspect_sectors(
+     libsmdev_internal_handle_t *internal_handle,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function     = "libsmdev_optical_read_remove_suspect_sectors";
+	uint32_t bytes_per_sector = 0;
+	int number_of_elements    = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_get_number_of_elements(
+	     internal_handle->suspect_sectors_range_list,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements in suspect sectors range list.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_elements == 0 )
+	{
+		return( 1 );
+	}
+	if( libsmdev_optical_read_get_error_bytes_per_sector(
+	     internal_handle,
+	     &bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_remove_range(
+	     internal_handle->suspect_sectors_range_list,
+	     start_sector,
+	     number_of_sectors,
+	     NULL,
+	     NULL,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove suspect sectors from range list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_remove_range(
+	     internal_handle->errors_range_list,
+	     start_sector * bytes_per_sector,
+	     number_of_sectors * bytes_per_sector,
+	     NULL,
+	     NULL,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove error from range list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Applies the current read speed to the optical drive
+ * The speed is set with SET CD SPEED and, if the drive rejects that, with SET STREAMING
+ * If the drive rejects both the read speed is marked as not supported and is not applied again
+ * Returns 1 if successful, 0 if the drive does not support speed control or -1 on error
+ */
+int libsmdev_optical_read_apply_speed(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_SCSI_SG_H )
+	uint8_t sense[ LIBSMDEV_SCSI_SENSE_SIZE ];
+
+	uint32_t end_lba       = 0;
+	uint16_t transfer_rate = 0;
+	int result             = 0;
+#endif
+
+	static char *function = "libsmdev_optical_read_apply_speed";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->read_speed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing read speed.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->read_speed->unsupported != 0 )
+	{
+		return( 0 );
+	}
+	if( internal_handle->read_speed->speed_changed == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_SCSI_SG_H )
+	if( internal_handle->device_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing device file.",
+		 function );
+
+		return( -1 );
+	}
+	transfer_rate = libsmdev_read_speed_get_transfer_rate(
+	                 internal_handle->read_speed->speed );
+
+	result = libsmdev_scsi_set_cd_speed(
+	          internal_handle->device_file,
+	          transfer_rate,
+	          sense,
+	          LIBSMDEV_SCSI_SENSE_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to set CD speed.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* The performance descriptor covers the entire medium
+		 */
+		end_lba = UINT32_MAX;
+
+		if( ( internal_handle->bytes_per_sector != 0 )
+		 && ( ( internal_handle->media_size / internal_handle->bytes_per_sector ) > 0 )
+		 && ( ( internal_handle->media_size / internal_handle->bytes_per_sector ) <= (size64_t) UINT32_MAX ) )
+		{
+			end_lba = (uint32_t) ( internal_handle->media_size / internal_handle->bytes_per_sector ) - 1;
+		}
+		result = libsmdev_scsi_set_streaming(
+		          internal_handle->device_file,
+		          end_lba,
+		          ( transfer_rate == LIBSMDEV_READ_SPEED_MAXIMUM_TRANSFER_RATE ) ? UINT32_MAX : (uint32_t) transfer_rate,
+		          0,
+		          sense,
+		          LIBSMDEV_SCSI_SENSE_SIZE,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to set streaming.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: read speed: %" PRIu16 " kB/s %s\n",
+		 function,
+		 transfer_rate,
+		 ( result == 1 ) ? "applied" : "not supported" );
+	}
+#endif
+	internal_handle->read_speed->speed_changed = 0;
+
+	if( result == 0 )
+	{
+		internal_handle->read_speed->unsupported = 1;
+
+		return( 0 );
+	}
+	internal_handle->read_speed->drive_speed_set = 1;
+
+	return( 1 );
+#else
+	internal_handle->read_speed->unsupported = 1;
+
+	return( 0 );
+#endif /* defined( HAVE_SCSI_SG_H ) */
+}
+
+/* Restores the default speed of the optical drive if the read speed was applied
+ * The read speed is reset so it is applied again on the next optical read
+ * Returns 1 if successful, 0 if the default speed could not be restored or -1 on error
+ */
+int libsmdev_optical_read_restore_speed(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_SCSI_SG_H )
+	uint8_t sense[ LIBSMDEV_SCSI_SENSE_SIZE ];
+#endif
+
+	static char *function = "libsmdev_optical_read_restore_speed";
+	int result            = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->read_speed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid handle - missing read speed.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_SCSI_SG_H )
+	if( ( internal_handle->read_speed->drive_speed_set != 0 )
+	 && ( internal_handle->device_file != NULL ) )
+	{
+		result = libsmdev_scsi_set_streaming(
+		          internal_handle->device_file,
+		          UINT32_MAX,
+		          UINT32_MAX,
+		          LIBSMDEV_SCSI_PERFORMANCE_DESCRIPTOR_FLAG_RESTORE_DEFAULTS,
+		          sense,
+		          LIBSMDEV_SCSI_SENSE_SIZE,
+		          error );
+
+		/* Drives that do not support SET STREAMING are returned to their maximum speed
+		 */
+		if( result == 0 )
+		{
+			result = libsmdev_scsi_set_cd_speed(
+			          internal_handle->device_file,
+			          LIBSMDEV_SCSI_SET_CD_SPEED_MAXIMUM,
+			          sense,
+			          LIBSMDEV_SCSI_SENSE_SIZE,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to restore default speed.",
+			 function );
+		}
+	}
+#endif /* defined( HAVE_SCSI_SG_H ) */
+
+	if( internal_handle->read_speed->drive_speed_set != 0 )
+	{
+		internal_handle->read_speed->speed_changed = 1;
+	}
+	internal_handle->read_speed->drive_speed_set = 0;
+	internal_handle->read_speed->unsupported     = 0;
+
+	if( libsmdev_read_speed_reset(
+	     internal_handle->read_speed,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset read speed.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Reads raw frames from an optical disc
+ * The frames are read with READ CD commands in batches that fill the maximum transfer size of the device
+ * Every frame consists of 2352 bytes, followed by 96 bytes of raw P-W sub-channel data if
+ * LIBSMDEV_OPTICAL_READ_FLAG_SUB_CHANNEL is set
+ *
+ * If LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS is set the drive also returns C2 error pointers,
+ * which are used to detect damaged sectors without waiting for the drive to give up on them.
+ * Frames with C2 errors and batches the drive reports a medium error for are recorded as suspect
+ * sectors and errors, where the frames of the latter are filled with 0-byte values. Frames that are
+ * re-read without C2 errors are removed from the suspect sectors and errors. The suspect sectors are
+ * to be re-read later without LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS, which lets the drive apply
+ * its full error recovery and removes the sectors from the suspect sectors and errors when successful.
+ * If the drive reports a medium error for a batch in this re-read pass the sectors of the batch are
+ * read one by one and only the sectors that still cannot be read are filled with 0-byte values
+ * and kept as suspect sectors and errors
+ *
+ * The configured read speed is applied before reading and, with the adaptive read speed policy,
+ * adjusted after every batch based on the sectors that could not be read and the time the drive took
+ *
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_optical_read_sectors(
+         libsmdev_internal_handle_t *internal_handle,
+         uint64_t start_sector,
+         uint32_t number_of_sectors,
+         uint8_t track_type,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint8_t read_flags,
+         libcerror_error_t **error )
+{
+#if defined( HAVE_SCSI_SG_H )
+	uint8_t sense[ LIBSMDEV_SCSI_SENSE_SIZE ];
+
+	uint8_t *frame_data              = NULL;
+	uint8_t *transfer_buffer         = NULL;
+	size_t buffer_offset             = 0;
+	size_t maximum_transfer_size     = 0;
+	size_t transfer_frame_size       = 0;
+	size_t transfer_size             = 0;
+	uint32_t batch_size              = 0;
+	uint32_t duration                = 0;
+	uint32_t frame_index             = 0;
+	uint32_t number_of_error_sectors = 0;
+	uint32_t read_number             = 0;
+	uint32_t sector_duration         = 0;
+	uint8_t read_cd_flags            = 0;
+	uint8_t sector_type              = 0;
+	uint8_t sense_key                = 0;
+	uint8_t sub_channel              = 0;
+	int result                       = 0;
+#endif
+
+	static char *function = "libsmdev_optical_read_sectors";
+	size_t frame_size     = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_flags & ~( LIBSMDEV_OPTICAL_READ_FLAG_SUB_CHANNEL | LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported read flags: 0x%02" PRIx8 ".",
+		 function,
+		 read_flags );
+
+		return( -1 );
+	}
+	/* The LBA of the READ CD command is a 32-bit value
+	 */
+	if( ( start_sector > (uint64_t) UINT32_MAX )
+	 || ( number_of_sectors > ( (uint64_t) UINT32_MAX - start_sector + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	frame_size = libsmdev_optical_read_get_frame_size(
+	              read_flags );
+
+	if( (size_t) number_of_sectors > ( buffer_size / frame_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sectors == 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_SCSI_SG_H )
+	if( internal_handle->device_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported IO backend - optical reads require a device file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_optical_read_get_maximum_transfer_size(
+	     internal_handle,
+	     &maximum_transfer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum transfer size.",
+		 function );
+
+		return( -1 );
+	}
+	transfer_frame_size = libsmdev_optical_read_get_transfer_frame_size(
+	                       read_flags );
+
+	batch_size = libsmdev_optical_read_get_batch_size(
+	              maximum_transfer_size,
+	              transfer_frame_size );
+
+	/* Audio sectors are requested as CD-DA so the drive applies its audio error handling
+	 */
+	if( track_type == LIBSMDEV_TRACK_TYPE_AUDIO )
+	{
+		sector_type = LIBSMDEV_SCSI_READ_CD_SECTOR_TYPE_CDDA;
+	}
+	else
+	{
+		sector_type = LIBSMDEV_SCSI_READ_CD_SECTOR_TYPE_ANY;
+	}
+	read_cd_flags = LIBSMDEV_SCSI_READ_CD_FLAG_SYNC
+	              | LIBSMDEV_SCSI_READ_CD_FLAG_ALL_HEADERS
+	              | LIBSMDEV_SCSI_READ_CD_FLAG_USER_DATA
+	              | LIBSMDEV_SCSI_READ_CD_FLAG_EDC_ECC;
+
+	if( ( read_flags & LIBSMDEV_OPTICAL_READ_FLAG_SUB_CHANNEL ) != 0 )
+	{
+		sub_channel = LIBSMDEV_SCSI_READ_CD_SUB_CHANNEL_RAW;
+	}
+	/* The drive returns the C2 error pointers between the main channel and the sub-channel data
+	 * hence the frames are read into a separate buffer
+	 */
+	if( ( read_flags & LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS ) != 0 )
+	{
+		read_cd_flags |= LIBSMDEV_SCSI_READ_CD_FLAG_C2_ERROR_POINTERS;
+
+		if( batch_size > number_of_sectors )
+		{
+			batch_size = number_of_sectors;
+		}
+		transfer_buffer = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * (size_t) batch_size * transfer_frame_size );
+
+		if( transfer_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create transfer buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsmdev_optical_read_apply_speed(
+	     internal_handle,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to apply read speed.",
+		 function );
+
+		goto on_error;
+	}
+	while( number_of_sectors > 0 )
+	{
+		if( internal_handle->abort != 0 )
+		{
+			break;
+		}
+		read_number             = batch_size;
+		number_of_error_sectors = 0;
+
+		if( read_number > number_of_sectors )
+		{
+			read_number = number_of_sectors;
+		}
+		transfer_size = (size_t) read_number * transfer_frame_size;
+
+		result = libsmdev_scsi_read_cd(
+		          internal_handle->device_file,
+		          (uint32_t) start_sector,
+		          read_number,
+		          sector_type,
+		          read_cd_flags,
+		          sub_channel,
+		          ( transfer_buffer != NULL ) ? transfer_buffer : &( buffer[ buffer_offset ] ),
+		          transfer_size,
+		          sense,
+		          LIBSMDEV_SCSI_SENSE_SIZE,
+		          &duration,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read %" PRIu32 " sectors at LBA: %" PRIu64 ".",
+			 function,
+			 read_number,
+			 start_sector );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			sense_key = ( ( sense[ 0 ] & 0x7f ) >= 0x72 ) ? sense[ 1 ] & 0x0f : sense[ 2 ] & 0x0f;
+
+			if( sense_key != LIBSMDEV_SCSI_SENSE_KEY_MEDIUM_ERROR )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: device rejected READ CD of %" PRIu32 " sectors at LBA: %" PRIu64 " with sense key: 0x%02" PRIx8 ", additional sense code: 0x%02" PRIx8 ", qualifier: 0x%02" PRIx8 ".",
+				 function,
+				 read_number,
+				 start_sector,
+				 sense_key,
+				 ( ( sense[ 0 ] & 0x7f ) >= 0x72 ) ? sense[ 2 ] : sense[ 12 ],
+				 ( ( sense[ 0 ] & 0x7f ) >= 0x72 ) ? sense[ 3 ] : sense[ 13 ] );
+
+				goto on_error;
+			}
+			/* In the first pass a medium error defers the batch to the re-read pass
+			 */
+			if( transfer_buffer != NULL )
+			{
+				if( memory_set(
+				     &( buffer[ buffer_offset ] ),
+				     0,
+				     (size_t) read_number * frame_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear buffer.",
+					 function );
+
+					goto on_error;
+				}
+				if( libsmdev_optical_read_append_suspect_sectors(
+				     internal_handle,
+				     start_sector,
+				     (uint64_t) read_number,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append suspect sectors.",
+					 function );
+
+					goto on_error;
+				}
+				number_of_error_sectors = read_number;
+			}
+			else
+			{
+				/* In the re-read pass the sectors of the batch are read one by one
+				 * so that only the sectors the drive cannot read are recorded
+				 */
+				for( frame_index = 0;
+				     frame_index < read_number;
+				     frame_index++ )
+				{
+					if( read_number > 1 )
+					{
+						result = libsmdev_scsi_read_cd(
+						          internal_handle->device_file,
+						          (uint32_t) ( start_sector + frame_index ),
+						          1,
+						          sector_type,
+						          read_cd_flags,
+						          sub_channel,
+						          &( buffer[ buffer_offset + ( (size_t) frame_index * frame_size ) ] ),
+						          frame_size,
+						          sense,
+						          LIBSMDEV_SCSI_SENSE_SIZE,
+						          &sector_duration,
+						          error );
+
+						if( result == -1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_IO,
+							 LIBCERROR_IO_ERROR_READ_FAILED,
+							 "%s: unable to read sector at LBA: %" PRIu64 ".",
+							 function,
+							 start_sector + frame_index );
+
+							goto on_error;
+						}
+						duration += sector_duration;
+					}
+					if( result != 0 )
+					{
+						if( libsmdev_optical_read_remove_suspect_sectors(
+						     internal_handle,
+						     start_sector + frame_index,
+						     1,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+							 "%s: unable to remove suspect sector.",
+							 function );
+
+							goto on_error;
+						}
+						continue;
+					}
+					sense_key = ( ( sense[ 0 ] & 0x7f ) >= 0x72 ) ? sense[ 1 ] & 0x0f : sense[ 2 ] & 0x0f;
+
+					if( sense_key != LIBSMDEV_SCSI_SENSE_KEY_MEDIUM_ERROR )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: device rejected READ CD of sector at LBA: %" PRIu64 " with sense key: 0x%02" PRIx8 ", additional sense code: 0x%02" PRIx8 ", qualifier: 0x%02" PRIx8 ".",
+						 function,
+						 start_sector + frame_index,
+						 sense_key,
+						 ( ( sense[ 0 ] & 0x7f ) >= 0x72 ) ? sense[ 2 ] : sense[ 12 ],
+						 ( ( sense[ 0 ] & 0x7f ) >= 0x72 ) ? sense[ 3 ] : sense[ 13 ] );
+
+						goto on_error;
+					}
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: unable to read sector: %" PRIu64 "\n",
+						 function,
+						 start_sector + frame_index );
+					}
+#endif
+					if( memory_set(
+					     &( buffer[ buffer_offset + ( (size_t) frame_index * frame_size ) ] ),
+					     0,
+					     frame_size ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+						 "%s: unable to clear buffer.",
+						 function );
+
+						goto on_error;
+					}
+					if( libsmdev_optical_read_append_suspect_sectors(
+					     internal_handle,
+					     start_sector + frame_index,
+					     1,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append suspect sector.",
+						 function );
+
+						goto on_error;
+					}
+					number_of_error_sectors += 1;
+				}
+			}
+		}
+		else if( transfer_buffer != NULL )
+		{
+			for( frame_index = 0;
+			     frame_index < read_number;
+			     frame_index++ )
+			{
+				frame_data = &( transfer_buffer[ (size_t) frame_index * transfer_frame_size ] );
+
+				if( memory_copy(
+				     &( buffer[ buffer_offset + ( (size_t) frame_index * frame_size ) ] ),
+				     frame_data,
+				     LIBSMDEV_OPTICAL_READ_FRAME_SIZE ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy frame.",
+					 function );
+
+					goto on_error;
+				}
+				if( sub_channel != LIBSMDEV_SCSI_READ_CD_SUB_CHANNEL_NONE )
+				{
+					if( memory_copy(
+					     &( buffer[ buffer_offset + ( (size_t) frame_index * frame_size ) + LIBSMDEV_OPTICAL_READ_FRAME_SIZE ] ),
+					     &( frame_data[ LIBSMDEV_OPTICAL_READ_FRAME_SIZE + LIBSMDEV_OPTICAL_READ_C2_ERROR_POINTERS_SIZE ] ),
+					     LIBSMDEV_OPTICAL_READ_SUB_CHANNEL_SIZE ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+						 "%s: unable to copy sub-channel data.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				if( libsmdev_optical_read_has_c2_errors(
+				     &( frame_data[ LIBSMDEV_OPTICAL_READ_FRAME_SIZE ] ),
+				     LIBSMDEV_OPTICAL_READ_C2_ERROR_POINTERS_SIZE ) != 0 )
+				{
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: C2 errors in sector: %" PRIu64 "\n",
+						 function,
+						 start_sector + frame_index );
+					}
+#endif
+					if( libsmdev_optical_read_append_suspect_sectors(
+					     internal_handle,
+					     start_sector + frame_index,
+					     1,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append suspect sector.",
+						 function );
+
+						goto on_error;
+					}
+					number_of_error_sectors += 1;
+				}
+				/* A frame without C2 errors is removed in case an earlier read recorded it as suspect
+				 */
+				else if( libsmdev_optical_read_remove_suspect_sectors(
+				          internal_handle,
+				          start_sector + frame_index,
+				          1,
+				          error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+					 "%s: unable to remove suspect sector.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+		else
+		{
+			if( libsmdev_optical_read_remove_suspect_sectors(
+			     internal_handle,
+			     start_sector,
+			     (uint64_t) read_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove suspect sectors.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libsmdev_read_speed_update(
+		     internal_handle->read_speed,
+		     read_number,
+		     number_of_error_sectors,
+		     duration ) != 0 )
+		{
+			if( libsmdev_optical_read_apply_speed(
+			     internal_handle,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to apply read speed.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		start_sector      += read_number;
+		number_of_sectors -= read_number;
+		buffer_offset     += (size_t) read_number * frame_size;
+	}
+	if( transfer_buffer != NULL )
+	{
+		memory_free(
+		 transfer_buffer );
+	}
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	if( transfer_buffer != NULL )
+	{
+		memory_free(
+		 transfer_buffer );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: optical reads are not supported on this platform.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_SCSI_SG_H ) */
+}
+
+
+/* Reads sectors from a DVD or BD data disc with streaming READ (12) commands
+ * The streaming flag lets the drive favor a sustained transfer rate over its full error recovery
+ * The sectors are read in transfers of the streaming transfer size, which defaults to the maximum
+ * transfer size of the device, and every command is limited to the streaming timeout
+ *
+ * Transfers that fail with a check condition or time out are not retried. Their sectors are filled
+ * with 0-byte values and recorded as suspect sectors and errors, which are to be re-read later with
+ * regular reads. A successful streaming read removes its sectors from the suspect sectors and errors
+ *
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_optical_read_streaming_sectors(
+         libsmdev_internal_handle_t *internal_handle,
+         uint64_t start_sector,
+         uint32_t number_of_sectors,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+#if defined( HAVE_SCSI_SG_H )
+	uint8_t sense[ LIBSMDEV_SCSI_SENSE_SIZE ];
+
+	size_t buffer_offset = 0;
+	size_t read_size     = 0;
+	size_t transfer_size = 0;
+	uint32_t batch_size  = 0;
+	uint32_t read_number = 0;
+	uint8_t sense_key    = 0;
+	int result           = 0;
+#endif
+
+	static char *function     = "libsmdev_optical_read_streaming_sectors";
+	uint32_t bytes_per_sector = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The LBA of the READ (12) command is a 32-bit value
+	 */
+	if( ( start_sector > (uint64_t) UINT32_MAX )
+	 || ( number_of_sectors > ( (uint64_t) UINT32_MAX - start_sector + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_optical_read_get_error_bytes_per_sector(
+	     internal_handle,
+	     &bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_sectors > ( buffer_size / bytes_per_sector ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid buffer size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sectors == 0 )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_SCSI_SG_H )
+	if( internal_handle->device_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported IO backend - streaming reads require a device file.",
+		 function );
+
+		return( -1 );
+	}
+	transfer_size = internal_handle->streaming_transfer_size;
+
+	if( transfer_size == 0 )
+	{
+		if( libsmdev_optical_read_get_maximum_transfer_size(
+		     internal_handle,
+		     &transfer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve maximum transfer size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	batch_size = libsmdev_optical_read_get_batch_size(
+	              transfer_size,
+	              (size_t) bytes_per_sector );
+
+	while( number_of_sectors > 0 )
+	{
+		if( internal_handle->abort != 0 )
+		{
+			break;
+		}
+		read_number = batch_size;
+
+		if( read_number > number_of_sectors )
+		{
+			read_number = number_of_sectors;
+		}
+		read_size = (size_t) read_number * bytes_per_sector;
+
+		result = libsmdev_scsi_read_12(
+		          internal_handle->device_file,
+		          (uint32_t) start_sector,
+		          read_number,
+		          LIBSMDEV_SCSI_READ_12_STREAMING_FLAG_STREAMING,
+		          &( buffer[ buffer_offset ] ),
+		          read_size,
+		          sense,
+		          LIBSMDEV_SCSI_SENSE_SIZE,
+		          (unsigned int) internal_handle->streaming_timeout,
+		          NULL,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read %" PRIu32 " sectors at LBA: %" PRIu64 ".",
+			 function,
+			 read_number,
+			 start_sector );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			sense_key = ( ( sense[ 0 ] & 0x7f ) >= 0x72 ) ? sense[ 1 ] & 0x0f : sense[ 2 ] & 0x0f;
+
+			/* An illegal request indicates the sectors or the command are not valid for the medium
+			 */
+			if( sense_key == LIBSMDEV_SCSI_SENSE_KEY_ILLEGAL_REQUEST )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: device rejected READ (12) of %" PRIu32 " sectors at LBA: %" PRIu64 " with additional sense code: 0x%02" PRIx8 ", qualifier: 0x%02" PRIx8 ".",
+				 function,
+				 read_number,
+				 start_sector,
+				 ( ( sense[ 0 ] & 0x7f ) >= 0x72 ) ? sense[ 2 ] : sense[ 12 ],
+				 ( ( sense[ 0 ] & 0x7f ) >= 0x72 ) ? sense[ 3 ] : sense[ 13 ] );
+
+				return( -1 );
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read %" PRIu32 " sectors at LBA: %" PRIu64 " sense key: 0x%02" PRIx8 ".\n",
+				 function,
+				 read_number,
+				 start_sector,
+				 sense_key );
+			}
+#endif
+			if( memory_set(
+			     &( buffer[ buffer_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				return( -1 );
+			}
+			if( libsmdev_optical_read_append_suspect_sectors(
+			     internal_handle,
+			     start_sector,
+			     (uint64_t) read_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append suspect sectors.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( libsmdev_optical_read_remove_suspect_sectors(
+			     internal_handle,
+			     start_sector,
+			     (uint64_t) read_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove suspect sectors.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		start_sector      += read_number;
+		number_of_sectors -= read_number;
+		buffer_offset     += read_size;
+	}
+	return( (ssize_t) buffer_offset );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: streaming reads are not supported on this platform.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_SCSI_SG_H ) */
+}
+
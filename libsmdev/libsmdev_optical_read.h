@@ -0,0 +1,127 @@
+/*
+ * Optical read functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_OPTICAL_READ_H )
+#define _LIBSMDEV_OPTICAL_READ_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_handle.h"
+#include "libsmdev_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a raw optical frame
+ */
+#define LIBSMDEV_OPTICAL_READ_FRAME_SIZE			2352
+
+/* The size of the raw P-W sub-channel data of an optical frame
+ */
+#define LIBSMDEV_OPTICAL_READ_SUB_CHANNEL_SIZE			96
+
+/* The size of the C2 error pointers of an optical frame, 1 bit for every byte of the frame
+ */
+#define LIBSMDEV_OPTICAL_READ_C2_ERROR_POINTERS_SIZE		294
+
+/* The maximum transfer size used if the device does not report one
+ */
+#define LIBSMDEV_OPTICAL_READ_DEFAULT_MAXIMUM_TRANSFER_SIZE	65536
+
+/* The default timeout of a streaming read command in milli seconds
+ * A streaming read fails fast so damaged areas do not stall the read
+ */
+#define LIBSMDEV_OPTICAL_READ_DEFAULT_STREAMING_TIMEOUT		5000
+
+/* The maximum size of the data transferred by a single streaming read command
+ */
+#define LIBSMDEV_OPTICAL_READ_MAXIMUM_STREAMING_TRANSFER_SIZE	( 16 * 1024 * 1024 )
+
+size_t libsmdev_optical_read_get_frame_size(
+        uint8_t read_flags );
+
+size_t libsmdev_optical_read_get_transfer_frame_size(
+        uint8_t read_flags );
+
+uint32_t libsmdev_optical_read_get_batch_size(
+          size_t maximum_transfer_size,
+          size_t frame_size );
+
+int libsmdev_optical_read_get_maximum_transfer_size(
+     libsmdev_internal_handle_t *internal_handle,
+     size_t *maximum_transfer_size,
+     libcerror_error_t **error );
+
+int libsmdev_optical_read_has_c2_errors(
+     const uint8_t *c2_error_pointers,
+     size_t size );
+
+int libsmdev_optical_read_get_error_bytes_per_sector(
+     libsmdev_internal_handle_t *internal_handle,
+     uint32_t *bytes_per_sector,
+     libcerror_error_t **error );
+
+int libsmdev_optical_read_append_suspect_sectors(
+     libsmdev_internal_handle_t *internal_handle,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error );
+
+int libsmdev_optical_read_remove_suspect_sectors(
+     libsmdev_internal_handle_t *internal_handle,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error );
+
+int libsmdev_optical_read_apply_speed(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libsmdev_optical_read_restore_speed(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+ssize_t libsmdev_optical_read_sectors(
+         libsmdev_internal_handle_t *internal_handle,
+         uint64_t start_sector,
+         uint32_t number_of_sectors,
+         uint8_t track_type,
+         uint8_t *buffer,
+         size_t buffer_size,
+         uint8_t read_flags,
+         libcerror_error_t **error );
+
+ssize_t libsmdev_optical_read_streaming_sectors(
+         libsmdev_internal_handle_t *internal_handle,
+         uint64_t start_sector,
+         uint32_t number_of_sectors,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_OPTICAL_READ_H ) */
+
@@ -0,0 +1,1852 @@
+/*
+ * Parallel reader functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcnotify.h"
+#include "libsmdev_libcthreads.h"
+#include "libsmdev_parallel_reader.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a stripe
+ * Make sure the value stripe is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_parallel_reader_stripe_initialize(
+     libsmdev_parallel_reader_stripe_t **stripe,
+     size_t stripe_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_parallel_reader_stripe_initialize";
+
+	if( stripe == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stripe.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stripe != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stripe value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stripe_size == 0 )
+	 || ( stripe_size > (size_t) LIBSMDEV_PARALLEL_READER_MAXIMUM_STRIPE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stripe size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*stripe = memory_allocate_structure(
+	           libsmdev_parallel_reader_stripe_t );
+
+	if( *stripe == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stripe.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *stripe,
+	     0,
+	     sizeof( libsmdev_parallel_reader_stripe_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stripe.",
+		 function );
+
+		memory_free(
+		 *stripe );
+
+		*stripe = NULL;
+
+		return( -1 );
+	}
+	( *stripe )->data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * stripe_size );
+
+	if( ( *stripe )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stripe data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_initialize(
+	     &( ( *stripe )->errors_range_list ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create errors range list.",
+		 function );
+
+		goto on_error;
+	}
+	( *stripe )->state = LIBSMDEV_PARALLEL_READER_STRIPE_STATE_EMPTY;
+
+	return( 1 );
+
+on_error:
+	if( *stripe != NULL )
+	{
+		if( ( *stripe )->data != NULL )
+		{
+			memory_free(
+			 ( *stripe )->data );
+		}
+		memory_free(
+		 *stripe );
+
+		*stripe = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a stripe
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_parallel_reader_stripe_free(
+     libsmdev_parallel_reader_stripe_t **stripe,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_parallel_reader_stripe_free";
+	int result            = 1;
+
+	if( stripe == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stripe.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stripe != NULL )
+	{
+		if( libcdata_range_list_free(
+		     &( ( *stripe )->errors_range_list ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free errors range list.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *stripe )->data );
+
+		memory_free(
+		 *stripe );
+
+		*stripe = NULL;
+	}
+	return( result );
+}
+
+/* Creates a parallel reader
+ * Make sure the value parallel_reader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_parallel_reader_initialize(
+     libsmdev_parallel_reader_t **parallel_reader,
+     int number_of_workers,
+     size_t stripe_size,
+     size64_t media_size,
+     uint8_t number_of_error_retries,
+     size_t error_granularity,
+     uint8_t error_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_parallel_reader_initialize";
+	int stripe_index      = 0;
+	int worker_index      = 0;
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parallel_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parallel reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( number_of_workers > LIBSMDEV_PARALLEL_READER_MAXIMUM_NUMBER_OF_WORKERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stripe_size == 0 )
+	 || ( stripe_size > (size_t) LIBSMDEV_PARALLEL_READER_MAXIMUM_STRIPE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stripe size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( media_size == 0 )
+	 || ( media_size > (size64_t) INT64_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid media size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*parallel_reader = memory_allocate_structure(
+	                    libsmdev_parallel_reader_t );
+
+	if( *parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parallel reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *parallel_reader,
+	     0,
+	     sizeof( libsmdev_parallel_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parallel reader.",
+		 function );
+
+		memory_free(
+		 *parallel_reader );
+
+		*parallel_reader = NULL;
+
+		return( -1 );
+	}
+	( *parallel_reader )->number_of_workers       = number_of_workers;
+	( *parallel_reader )->number_of_stripes       = 2 * number_of_workers;
+	( *parallel_reader )->stripe_size             = stripe_size;
+	( *parallel_reader )->media_size              = media_size;
+	( *parallel_reader )->number_of_error_retries = number_of_error_retries;
+	( *parallel_reader )->error_granularity       = error_granularity;
+	( *parallel_reader )->error_flags             = error_flags;
+
+	( *parallel_reader )->workers = (libsmdev_parallel_reader_worker_t **) memory_allocate(
+	                                 sizeof( libsmdev_parallel_reader_worker_t * ) * number_of_workers );
+
+	if( ( *parallel_reader )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		( *parallel_reader )->workers[ worker_index ] = NULL;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		( *parallel_reader )->workers[ worker_index ] = memory_allocate_structure(
+		                                                 libsmdev_parallel_reader_worker_t );
+
+		if( ( *parallel_reader )->workers[ worker_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		( *parallel_reader )->workers[ worker_index ]->parallel_reader = *parallel_reader;
+		( *parallel_reader )->workers[ worker_index ]->io_backend      = NULL;
+		( *parallel_reader )->workers[ worker_index ]->thread          = NULL;
+	}
+	( *parallel_reader )->stripes = (libsmdev_parallel_reader_stripe_t **) memory_allocate(
+	                                 sizeof( libsmdev_parallel_reader_stripe_t * ) * ( *parallel_reader )->number_of_stripes );
+
+	if( ( *parallel_reader )->stripes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stripes.",
+		 function );
+
+		goto on_error;
+	}
+	for( stripe_index = 0;
+	     stripe_index < ( *parallel_reader )->number_of_stripes;
+	     stripe_index++ )
+	{
+		( *parallel_reader )->stripes[ stripe_index ] = NULL;
+	}
+	for( stripe_index = 0;
+	     stripe_index < ( *parallel_reader )->number_of_stripes;
+	     stripe_index++ )
+	{
+		if( libsmdev_parallel_reader_stripe_initialize(
+		     &( ( *parallel_reader )->stripes[ stripe_index ] ),
+		     stripe_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create stripe: %d.",
+			 function,
+			 stripe_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *parallel_reader )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *parallel_reader )->stripe_read_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stripe read condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *parallel_reader )->stripe_empty_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stripe empty condition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *parallel_reader != NULL )
+	{
+		libsmdev_parallel_reader_free(
+		 parallel_reader,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a parallel reader
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_parallel_reader_free(
+     libsmdev_parallel_reader_t **parallel_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_parallel_reader_free";
+	int result            = 1;
+	int stripe_index      = 0;
+	int worker_index      = 0;
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *parallel_reader != NULL )
+	{
+		if( ( *parallel_reader )->workers_started != 0 )
+		{
+			if( libsmdev_parallel_reader_close(
+			     *parallel_reader,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close parallel reader.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *parallel_reader )->stripe_empty_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *parallel_reader )->stripe_empty_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free stripe empty condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *parallel_reader )->stripe_read_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *parallel_reader )->stripe_read_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free stripe read condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *parallel_reader )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *parallel_reader )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *parallel_reader )->stripes != NULL )
+		{
+			for( stripe_index = 0;
+			     stripe_index < ( *parallel_reader )->number_of_stripes;
+			     stripe_index++ )
+			{
+				if( libsmdev_parallel_reader_stripe_free(
+				     &( ( *parallel_reader )->stripes[ stripe_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free stripe: %d.",
+					 function,
+					 stripe_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *parallel_reader )->stripes );
+		}
+		if( ( *parallel_reader )->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *parallel_reader )->number_of_workers;
+			     worker_index++ )
+			{
+				if( ( *parallel_reader )->workers[ worker_index ] != NULL )
+				{
+					memory_free(
+					 ( *parallel_reader )->workers[ worker_index ] );
+				}
+			}
+			memory_free(
+			 ( *parallel_reader )->workers );
+		}
+		memory_free(
+		 *parallel_reader );
+
+		*parallel_reader = NULL;
+	}
+	return( result );
+}
+
+/* Opens the parallel reader
+ * Every worker opens its own IO backend on the storage media device
+ * and the worker threads are started
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_parallel_reader_open(
+     libsmdev_parallel_reader_t *parallel_reader,
+     int io_backend_type,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libsmdev_parallel_reader_worker_t *worker = NULL;
+	static char *function                     = "libsmdev_parallel_reader_open";
+	int result                                = 0;
+	int worker_index                          = 0;
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( parallel_reader->workers_started != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parallel reader - workers already started.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	for( worker_index = 0;
+	     worker_index < parallel_reader->number_of_workers;
+	     worker_index++ )
+	{
+		worker = parallel_reader->workers[ worker_index ];
+
+		if( libsmdev_io_backend_initialize_by_type(
+		     &( worker->io_backend ),
+		     io_backend_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create IO backend of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libsmdev_io_backend_open_wide(
+		          worker->io_backend,
+		          filename,
+		          LIBSMDEV_ACCESS_FLAG_READ,
+		          error );
+#else
+		result = libsmdev_io_backend_open(
+		          worker->io_backend,
+		          filename,
+		          LIBSMDEV_ACCESS_FLAG_READ,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open IO backend of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	parallel_reader->next_stripe_index = 0;
+	parallel_reader->current_offset    = 0;
+	parallel_reader->abort             = 0;
+	parallel_reader->workers_started   = 1;
+
+	for( worker_index = 0;
+	     worker_index < parallel_reader->number_of_workers;
+	     worker_index++ )
+	{
+		worker = parallel_reader->workers[ worker_index ];
+
+		if( libcthreads_thread_create(
+		     &( worker->thread ),
+		     NULL,
+		     (int (*)(void *)) &libsmdev_parallel_reader_worker_callback,
+		     (void *) worker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libsmdev_parallel_reader_close(
+	 parallel_reader,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes the parallel reader
+ * The worker threads are stopped and their IO backends closed
+ * Returns 0 if successful or -1 on error
+ */
+int libsmdev_parallel_reader_close(
+     libsmdev_parallel_reader_t *parallel_reader,
+     libcerror_error_t **error )
+{
+	libsmdev_parallel_reader_worker_t *worker = NULL;
+	static char *function                     = "libsmdev_parallel_reader_close";
+	int result                                = 0;
+	int stripe_index                          = 0;
+	int worker_index                          = 0;
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_parallel_reader_signal_abort(
+	     parallel_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to signal workers to abort.",
+		 function );
+
+		result = -1;
+	}
+	for( worker_index = 0;
+	     worker_index < parallel_reader->number_of_workers;
+	     worker_index++ )
+	{
+		worker = parallel_reader->workers[ worker_index ];
+
+		if( worker->thread != NULL )
+		{
+			if( libcthreads_thread_join(
+			     &( worker->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+		if( worker->io_backend != NULL )
+		{
+			if( libsmdev_io_backend_close(
+			     worker->io_backend,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close IO backend of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+			if( libsmdev_io_backend_free(
+			     &( worker->io_backend ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free IO backend of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+	}
+	for( stripe_index = 0;
+	     stripe_index < parallel_reader->number_of_stripes;
+	     stripe_index++ )
+	{
+		parallel_reader->stripes[ stripe_index ]->state = LIBSMDEV_PARALLEL_READER_STRIPE_STATE_EMPTY;
+	}
+	parallel_reader->workers_started = 0;
+
+	return( result );
+}
+
+/* Signals the parallel reader to abort
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_parallel_reader_signal_abort(
+     libsmdev_parallel_reader_t *parallel_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_parallel_reader_signal_abort";
+	int result            = 1;
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     parallel_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	parallel_reader->abort = 1;
+
+	if( libcthreads_condition_broadcast(
+	     parallel_reader->stripe_empty_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast stripe empty condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_condition_broadcast(
+	     parallel_reader->stripe_read_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast stripe read condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     parallel_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Sets the alignment offset
+ * The alignment offset is the offset in bytes of the first physical sector boundary of the device
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_parallel_reader_set_alignment_offset(
+     libsmdev_parallel_reader_t *parallel_reader,
+     off64_t alignment_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_parallel_reader_set_alignment_offset";
+	size_t remainder      = 0;
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( parallel_reader->workers_started != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parallel reader - workers already started.",
+		 function );
+
+		return( -1 );
+	}
+	if( alignment_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid alignment offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	remainder = (size_t) ( (uint64_t) alignment_offset % parallel_reader->stripe_size );
+
+	if( remainder == 0 )
+	{
+		parallel_reader->alignment_padding = 0;
+	}
+	else
+	{
+		parallel_reader->alignment_padding = parallel_reader->stripe_size - remainder;
+	}
+	return( 1 );
+}
+
+/* Retrieves the offset of a stripe
+ * Returns the stripe offset
+ */
+off64_t libsmdev_parallel_reader_get_stripe_offset(
+         libsmdev_parallel_reader_t *parallel_reader,
+         uint64_t stripe_index )
+{
+	if( stripe_index == 0 )
+	{
+		return( 0 );
+	}
+	return( (off64_t) ( ( stripe_index * parallel_reader->stripe_size ) - parallel_reader->alignment_padding ) );
+}
+
+/* Retrieves the index of the stripe that contains an offset
+ * Returns the stripe index
+ */
+uint64_t libsmdev_parallel_reader_get_stripe_index(
+          libsmdev_parallel_reader_t *parallel_reader,
+          off64_t offset )
+{
+	return( ( (uint64_t) offset + parallel_reader->alignment_padding ) / parallel_reader->stripe_size );
+}
+
+/* Reads a stripe using the IO backend of a worker
+ * Read errors are retried and handled according to the error granularity and flags,
+ * the resulting error ranges are stored in the errors range list of the stripe
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_parallel_reader_read_stripe(
+     libsmdev_parallel_reader_t *parallel_reader,
+     libsmdev_parallel_reader_worker_t *worker,
+     libsmdev_parallel_reader_stripe_t *stripe,
+     libcerror_error_t **error )
+{
+	static char *function         = "libsmdev_parallel_reader_read_stripe";
+	size_t data_offset            = 0;
+	size_t error_granularity_size = 0;
+	size_t read_error_size        = 0;
+	ssize_t read_count            = 0;
+	off64_t error_block_end       = 0;
+	off64_t error_block_start     = 0;
+	off64_t stripe_offset         = 0;
+	uint32_t error_code           = 0;
+	int16_t number_of_read_errors = 0;
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( stripe == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stripe.",
+		 function );
+
+		return( -1 );
+	}
+	if( stripe->data_size > parallel_reader->stripe_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stripe - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	stripe_offset = libsmdev_parallel_reader_get_stripe_offset(
+	                 parallel_reader,
+	                 stripe->stripe_index );
+
+	if( parallel_reader->error_granularity > 0 )
+	{
+		error_granularity_size = parallel_reader->error_granularity;
+	}
+	else
+	{
+		error_granularity_size = parallel_reader->stripe_size;
+	}
+	while( data_offset < stripe->data_size )
+	{
+		if( parallel_reader->abort != 0 )
+		{
+			break;
+		}
+		read_count = libsmdev_io_backend_read_buffer_at_offset(
+		              worker->io_backend,
+		              &( stripe->data[ data_offset ] ),
+		              stripe->data_size - data_offset,
+		              stripe_offset + (off64_t) data_offset,
+		              &error_code,
+		              error );
+
+		if( read_count == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read stripe data at offset: %" PRIi64 " (0x%08" PRIx64 ") with error code: %" PRIu32 ".\n",
+				 function,
+				 stripe_offset + (off64_t) data_offset,
+				 stripe_offset + (off64_t) data_offset,
+				 error_code );
+			}
+#endif
+			switch( error_code )
+			{
+#if defined( WINAPI )
+				default:
+#else
+				/* Reading should not be retried for some POSIX error conditions
+				 */
+				case ESPIPE:
+				case EPERM:
+				case ENXIO:
+				case ENODEV:
+#endif
+					stripe->read_result = -1;
+					stripe->error_code  = error_code;
+
+					return( -1 );
+
+#if defined( WINAPI )
+				case ERROR_UNRECOGNIZED_MEDIA:
+#else
+				default:
+#endif
+					libcerror_error_free(
+					 error );
+
+					break;
+			}
+		}
+		else if( read_count > (ssize_t) ( stripe->data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid read count value exceeds read size.",
+			 function );
+
+			stripe->read_result = -1;
+
+			return( -1 );
+		}
+		else if( read_count > 0 )
+		{
+			/* A short read that made progress is continued without counting it as an error
+			 */
+			data_offset          += (size_t) read_count;
+			number_of_read_errors = 0;
+
+			continue;
+		}
+		number_of_read_errors++;
+
+		if( number_of_read_errors <= (int16_t) parallel_reader->number_of_error_retries )
+		{
+			continue;
+		}
+		/* The error granularity is aligned to the start of the media
+		 */
+		error_block_start = stripe_offset + (off64_t) data_offset;
+		error_block_start = ( error_block_start / (off64_t) error_granularity_size ) * (off64_t) error_granularity_size;
+		error_block_end   = error_block_start + (off64_t) error_granularity_size;
+
+		if( error_block_start < stripe_offset )
+		{
+			error_block_start = stripe_offset;
+		}
+		if( error_block_end > ( stripe_offset + (off64_t) stripe->data_size ) )
+		{
+			error_block_end = stripe_offset + (off64_t) stripe->data_size;
+		}
+		if( ( parallel_reader->error_flags & LIBSMDEV_ERROR_FLAG_ZERO_ON_ERROR ) == 0 )
+		{
+			error_block_start = stripe_offset + (off64_t) data_offset;
+		}
+		read_error_size = (size_t) ( error_block_end - error_block_start );
+
+		if( memory_set(
+		     &( stripe->data[ error_block_start - stripe_offset ] ),
+		     0,
+		     read_error_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to zero stripe data on error.",
+			 function );
+
+			stripe->read_result = -1;
+
+			return( -1 );
+		}
+#if defined( HAVE_VERBOSE_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: adding read error at offset: %" PRIi64 " (0x%08" PRIx64 "), number of bytes: %" PRIzd ".\n",
+			 function,
+			 error_block_start,
+			 error_block_start,
+			 read_error_size );
+		}
+#endif
+		if( libcdata_range_list_insert_range(
+		     stripe->errors_range_list,
+		     (uint64_t) error_block_start,
+		     (uint64_t) read_error_size,
+		     NULL,
+		     NULL,
+		     NULL,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert read error to range list.",
+			 function );
+
+			stripe->read_result = -1;
+
+			return( -1 );
+		}
+		data_offset           = (size_t) ( error_block_end - stripe_offset );
+		number_of_read_errors = 0;
+	}
+	stripe->read_result = 1;
+
+	return( 1 );
+}
+
+/* The worker thread callback
+ * Claims the next stripe that fits in the reorder buffer and reads it
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_parallel_reader_worker_callback(
+     libsmdev_parallel_reader_worker_t *worker )
+{
+	libcerror_error_t *error                    = NULL;
+	libsmdev_parallel_reader_stripe_t *stripe   = NULL;
+	libsmdev_parallel_reader_t *parallel_reader = NULL;
+	static char *function                       = "libsmdev_parallel_reader_worker_callback";
+	off64_t stripe_offset                       = 0;
+	uint64_t maximum_stripe_index               = 0;
+	uint64_t stripe_index                       = 0;
+	int generation                              = 0;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	parallel_reader = worker->parallel_reader;
+
+	if( libcthreads_mutex_grab(
+	     parallel_reader->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	while( parallel_reader->abort == 0 )
+	{
+		stripe_index         = parallel_reader->next_stripe_index;
+		maximum_stripe_index = libsmdev_parallel_reader_get_stripe_index(
+		                        parallel_reader,
+		                        parallel_reader->current_offset );
+
+		maximum_stripe_index += (uint64_t) parallel_reader->number_of_stripes;
+
+		stripe_offset = libsmdev_parallel_reader_get_stripe_offset(
+		                 parallel_reader,
+		                 stripe_index );
+
+		stripe = parallel_reader->stripes[ stripe_index % parallel_reader->number_of_stripes ];
+
+		if( ( (size64_t) stripe_offset >= parallel_reader->media_size )
+		 || ( stripe_index >= maximum_stripe_index )
+		 || ( stripe->state != LIBSMDEV_PARALLEL_READER_STRIPE_STATE_EMPTY ) )
+		{
+			if( libcthreads_condition_wait(
+			     parallel_reader->stripe_empty_condition,
+			     parallel_reader->mutex,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for stripe empty condition.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		generation = parallel_reader->generation;
+
+		stripe->stripe_index  = stripe_index;
+		stripe->generation    = generation;
+		stripe->state         = LIBSMDEV_PARALLEL_READER_STRIPE_STATE_READING;
+		stripe->data_size     = parallel_reader->stripe_size;
+		stripe->errors_merged = 0;
+		stripe->read_result   = 0;
+		stripe->error_code    = 0;
+
+		if( stripe_index == 0 )
+		{
+			stripe->data_size -= parallel_reader->alignment_padding;
+		}
+		if( ( (size64_t) stripe_offset + stripe->data_size ) > parallel_reader->media_size )
+		{
+			stripe->data_size = (size_t) ( parallel_reader->media_size - (size64_t) stripe_offset );
+		}
+		parallel_reader->next_stripe_index += 1;
+
+		if( libcthreads_mutex_release(
+		     parallel_reader->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_range_list_empty(
+		     stripe->errors_range_list,
+		     NULL,
+		     &error ) != 1 )
+		{
+			stripe->read_result = -1;
+		}
+		else if( libsmdev_parallel_reader_read_stripe(
+		          parallel_reader,
+		          worker,
+		          stripe,
+		          &error ) != 1 )
+		{
+			stripe->read_result = -1;
+		}
+		if( error != NULL )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+		}
+		if( libcthreads_mutex_grab(
+		     parallel_reader->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		/* The stripe is discarded if the parallel reader was repositioned while it was read
+		 */
+		if( generation != parallel_reader->generation )
+		{
+			stripe->state = LIBSMDEV_PARALLEL_READER_STRIPE_STATE_EMPTY;
+
+			if( libcthreads_condition_broadcast(
+			     parallel_reader->stripe_empty_condition,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast stripe empty condition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			stripe->state = LIBSMDEV_PARALLEL_READER_STRIPE_STATE_READ;
+
+			if( libcthreads_condition_broadcast(
+			     parallel_reader->stripe_read_condition,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast stripe read condition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libcthreads_mutex_release(
+	     parallel_reader->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Merges the read errors of a stripe into an errors range list
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_parallel_reader_merge_errors(
+     libsmdev_parallel_reader_stripe_t *stripe,
+     libcdata_range_list_t *errors_range_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_parallel_reader_merge_errors";
+	intptr_t *value       = NULL;
+	uint64_t range_offset = 0;
+	uint64_t range_size   = 0;
+	int number_of_ranges  = 0;
+	int range_index       = 0;
+
+	if( stripe == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stripe.",
+		 function );
+
+		return( -1 );
+	}
+	if( stripe->errors_merged != 0 )
+	{
+		return( 1 );
+	}
+	if( libcdata_range_list_get_number_of_elements(
+	     stripe->errors_range_list,
+	     &number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of stripe read errors.",
+		 function );
+
+		return( -1 );
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( libcdata_range_list_get_range_by_index(
+		     stripe->errors_range_list,
+		     range_index,
+		     &range_offset,
+		     &range_size,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stripe read error: %d.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( libcdata_range_list_insert_range(
+		     errors_range_list,
+		     range_offset,
+		     range_size,
+		     NULL,
+		     NULL,
+		     NULL,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert read error to range list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	stripe->errors_merged = 1;
+
+	return( 1 );
+}
+
+/* Reads a buffer from the parallel reader
+ * The data is handed back in strict offset order, reading at an offset other than
+ * the end of the previous read discards the stripes read ahead
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_parallel_reader_read_buffer(
+         libsmdev_parallel_reader_t *parallel_reader,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcdata_range_list_t *errors_range_list,
+         libcerror_error_t **error )
+{
+	libsmdev_parallel_reader_stripe_t *stripe = NULL;
+	static char *function                     = "libsmdev_parallel_reader_read_buffer";
+	off64_t stripe_offset                     = 0;
+	size_t buffer_offset                      = 0;
+	size_t read_size                          = 0;
+	size_t stripe_data_offset                 = 0;
+	uint64_t stripe_index                     = 0;
+	int stripe_slot_index                     = 0;
+
+	if( parallel_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parallel reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( parallel_reader->workers_started == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parallel reader - workers not started.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= parallel_reader->media_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( errors_range_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid errors range list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size64_t) offset + buffer_size ) > parallel_reader->media_size )
+	{
+		buffer_size = (size_t) ( parallel_reader->media_size - offset );
+	}
+	if( libcthreads_mutex_grab(
+	     parallel_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset != parallel_reader->current_offset )
+	{
+		/* Discard the stripes that were read ahead of the previous offset
+		 */
+		parallel_reader->generation += 1;
+
+		for( stripe_slot_index = 0;
+		     stripe_slot_index < parallel_reader->number_of_stripes;
+		     stripe_slot_index++ )
+		{
+			stripe = parallel_reader->stripes[ stripe_slot_index ];
+
+			if( stripe->state == LIBSMDEV_PARALLEL_READER_STRIPE_STATE_READ )
+			{
+				stripe->state = LIBSMDEV_PARALLEL_READER_STRIPE_STATE_EMPTY;
+			}
+		}
+		parallel_reader->next_stripe_index = libsmdev_parallel_reader_get_stripe_index(
+		                                      parallel_reader,
+		                                      offset );
+
+		parallel_reader->current_offset = offset;
+
+		if( libcthreads_condition_broadcast(
+		     parallel_reader->stripe_empty_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast stripe empty condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( buffer_offset < buffer_size )
+	{
+		stripe_index = libsmdev_parallel_reader_get_stripe_index(
+		                parallel_reader,
+		                parallel_reader->current_offset );
+
+		stripe = parallel_reader->stripes[ stripe_index % parallel_reader->number_of_stripes ];
+
+		while( ( parallel_reader->abort == 0 )
+		    && ( ( stripe->state != LIBSMDEV_PARALLEL_READER_STRIPE_STATE_READ )
+		      || ( stripe->generation != parallel_reader->generation )
+		      || ( stripe->stripe_index != stripe_index ) ) )
+		{
+			if( libcthreads_condition_wait(
+			     parallel_reader->stripe_read_condition,
+			     parallel_reader->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for stripe read condition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( parallel_reader->abort != 0 )
+		{
+			break;
+		}
+		if( libsmdev_parallel_reader_merge_errors(
+		     stripe,
+		     errors_range_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to merge read errors of stripe: %" PRIu64 ".",
+			 function,
+			 stripe_index );
+
+			goto on_error;
+		}
+		if( stripe->read_result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read stripe: %" PRIu64 " with error code: %" PRIu32 ".",
+			 function,
+			 stripe_index,
+			 stripe->error_code );
+
+			goto on_error;
+		}
+		stripe_offset = libsmdev_parallel_reader_get_stripe_offset(
+		                 parallel_reader,
+		                 stripe_index );
+
+		stripe_data_offset = (size_t) ( parallel_reader->current_offset - stripe_offset );
+
+		if( stripe_data_offset >= stripe->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid stripe data offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		read_size = stripe->data_size - stripe_data_offset;
+
+		if( read_size > ( buffer_size - buffer_offset ) )
+		{
+			read_size = buffer_size - buffer_offset;
+		}
+		/* Only the consumer changes the state of a stripe that was read
+		 * hence the data can be copied without holding the mutex
+		 */
+		if( libcthreads_mutex_release(
+		     parallel_reader->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( stripe->data[ stripe_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy stripe data.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcthreads_mutex_grab(
+		     parallel_reader->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		buffer_offset                   += read_size;
+		parallel_reader->current_offset += (off64_t) read_size;
+
+		if( ( stripe_data_offset + read_size ) >= stripe->data_size )
+		{
+			stripe->state = LIBSMDEV_PARALLEL_READER_STRIPE_STATE_EMPTY;
+
+			if( libcthreads_condition_broadcast(
+			     parallel_reader->stripe_empty_condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast stripe empty condition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libcthreads_mutex_release(
+	     parallel_reader->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	libcthreads_mutex_release(
+	 parallel_reader->mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
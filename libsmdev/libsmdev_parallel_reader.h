@@ -0,0 +1,284 @@
+/*
+ * Parallel reader functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_PARALLEL_READER_H )
+#define _LIBSMDEV_PARALLEL_READER_H
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default stripe size
+ */
+#define LIBSMDEV_PARALLEL_READER_DEFAULT_STRIPE_SIZE		1048576
+
+/* The maximum stripe size
+ */
+#define LIBSMDEV_PARALLEL_READER_MAXIMUM_STRIPE_SIZE		67108864
+
+/* The maximum number of workers
+ */
+#define LIBSMDEV_PARALLEL_READER_MAXIMUM_NUMBER_OF_WORKERS	64
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+enum LIBSMDEV_PARALLEL_READER_STRIPE_STATES
+{
+	/* The stripe buffer is not in use
+	 */
+	LIBSMDEV_PARALLEL_READER_STRIPE_STATE_EMPTY		= 0,
+
+	/* The stripe is being read by a worker
+	 */
+	LIBSMDEV_PARALLEL_READER_STRIPE_STATE_READING		= 1,
+
+	/* The stripe was read and its data can be handed to the caller
+	 */
+	LIBSMDEV_PARALLEL_READER_STRIPE_STATE_READ		= 2
+};
+
+typedef struct libsmdev_parallel_reader libsmdev_parallel_reader_t;
+
+typedef struct libsmdev_parallel_reader_stripe libsmdev_parallel_reader_stripe_t;
+
+struct libsmdev_parallel_reader_stripe
+{
+	/* The stripe index
+	 */
+	uint64_t stripe_index;
+
+	/* The generation of the parallel reader the stripe was read for
+	 */
+	int generation;
+
+	/* The state
+	 */
+	int state;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The read errors range list of the stripe
+	 */
+	libcdata_range_list_t *errors_range_list;
+
+	/* Value to indicate the read errors were merged
+	 */
+	uint8_t errors_merged;
+
+	/* The read result, -1 if the stripe could not be read
+	 */
+	int read_result;
+
+	/* The error code of the read that could not be recovered from
+	 */
+	uint32_t error_code;
+};
+
+typedef struct libsmdev_parallel_reader_worker libsmdev_parallel_reader_worker_t;
+
+struct libsmdev_parallel_reader_worker
+{
+	/* The parallel reader
+	 */
+	libsmdev_parallel_reader_t *parallel_reader;
+
+	/* The IO backend
+	 */
+	libsmdev_io_backend_t *io_backend;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+};
+
+struct libsmdev_parallel_reader
+{
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The workers
+	 */
+	libsmdev_parallel_reader_worker_t **workers;
+
+	/* The number of stripes
+	 * The stripes make up the reorder buffer
+	 */
+	int number_of_stripes;
+
+	/* The stripes
+	 */
+	libsmdev_parallel_reader_stripe_t **stripes;
+
+	/* The stripe size
+	 */
+	size_t stripe_size;
+
+	/* The alignment padding
+	 * The first stripe is shorter by the alignment padding so that the boundaries
+	 * of the other stripes are aligned with the physical sectors of the device
+	 */
+	size_t alignment_padding;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of read error retries
+	 */
+	uint8_t number_of_error_retries;
+
+	/* The error granularity
+	 */
+	size_t error_granularity;
+
+	/* The read error flags
+	 */
+	uint8_t error_flags;
+
+	/* The index of the next stripe to be read by a worker
+	 */
+	uint64_t next_stripe_index;
+
+	/* The offset of the next data to be handed to the caller
+	 */
+	off64_t current_offset;
+
+	/* The generation, which changes when the current offset is repositioned
+	 */
+	int generation;
+
+	/* Value to indicate the workers were started
+	 */
+	uint8_t workers_started;
+
+	/* Value to indicate if abort was signalled
+	 */
+	uint8_t abort;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a stripe was read
+	 */
+	libcthreads_condition_t *stripe_read_condition;
+
+	/* The condition that is signalled when a stripe becomes empty
+	 */
+	libcthreads_condition_t *stripe_empty_condition;
+};
+
+int libsmdev_parallel_reader_stripe_initialize(
+     libsmdev_parallel_reader_stripe_t **stripe,
+     size_t stripe_size,
+     libcerror_error_t **error );
+
+int libsmdev_parallel_reader_stripe_free(
+     libsmdev_parallel_reader_stripe_t **stripe,
+     libcerror_error_t **error );
+
+int libsmdev_parallel_reader_initialize(
+     libsmdev_parallel_reader_t **parallel_reader,
+     int number_of_workers,
+     size_t stripe_size,
+     size64_t media_size,
+     uint8_t number_of_error_retries,
+     size_t error_granularity,
+     uint8_t error_flags,
+     libcerror_error_t **error );
+
+int libsmdev_parallel_reader_free(
+     libsmdev_parallel_reader_t **parallel_reader,
+     libcerror_error_t **error );
+
+int libsmdev_parallel_reader_open(
+     libsmdev_parallel_reader_t *parallel_reader,
+     int io_backend_type,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int libsmdev_parallel_reader_close(
+     libsmdev_parallel_reader_t *parallel_reader,
+     libcerror_error_t **error );
+
+int libsmdev_parallel_reader_signal_abort(
+     libsmdev_parallel_reader_t *parallel_reader,
+     libcerror_error_t **error );
+
+int libsmdev_parallel_reader_set_alignment_offset(
+     libsmdev_parallel_reader_t *parallel_reader,
+     off64_t alignment_offset,
+     libcerror_error_t **error );
+
+off64_t libsmdev_parallel_reader_get_stripe_offset(
+         libsmdev_parallel_reader_t *parallel_reader,
+         uint64_t stripe_index );
+
+uint64_t libsmdev_parallel_reader_get_stripe_index(
+          libsmdev_parallel_reader_t *parallel_reader,
+          off64_t offset );
+
+int libsmdev_parallel_reader_read_stripe(
+     libsmdev_parallel_reader_t *parallel_reader,
+     libsmdev_parallel_reader_worker_t *worker,
+     libsmdev_parallel_reader_stripe_t *stripe,
+     libcerror_error_t **error );
+
+int libsmdev_parallel_reader_worker_callback(
+     libsmdev_parallel_reader_worker_t *worker );
+
+int libsmdev_parallel_reader_merge_errors(
+     libsmdev_parallel_reader_stripe_t *stripe,
+     libcdata_range_list_t *errors_range_list,
+     libcerror_error_t **error );
+
+ssize_t libsmdev_parallel_reader_read_buffer(
+         libsmdev_parallel_reader_t *parallel_reader,
+         off64_t offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcdata_range_list_t *errors_range_list,
+         libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_PARALLEL_READER_H ) */
+
@@ -0,0 +1,601 @@
+/*
+ * Partition table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_partition_table.h"
+#include "libsmdev_write_engine.h"
+
+/* Creates a partition table
+ * Make sure the value partition_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_partition_table_initialize(
+     libsmdev_partition_table_t **partition_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_partition_table_initialize";
+
+	if( partition_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid partition table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*partition_table = memory_allocate_structure(
+	                    libsmdev_partition_table_t );
+
+	if( *partition_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create partition table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *partition_table,
+	     0,
+	     sizeof( libsmdev_partition_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear partition table.",
+		 function );
+
+		goto on_error;
+	}
+	( *partition_table )->type = LIBSMDEV_PARTITION_TABLE_TYPE_NONE;
+
+	return( 1 );
+
+on_error:
+	if( *partition_table != NULL )
+	{
+		memory_free(
+		 *partition_table );
+
+		*partition_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a partition table
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_partition_table_free(
+     libsmdev_partition_table_t **partition_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_partition_table_free";
+
+	if( partition_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *partition_table != NULL )
+	{
+		memory_free(
+		 *partition_table );
+
+		*partition_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a partition
+ * Partitions beyond the maximum number of partitions are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_partition_table_append_partition(
+     libsmdev_partition_table_t *partition_table,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     size_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_partition_table_append_partition";
+
+	if( partition_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition table.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid bytes per sector value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( start_sector > ( (uint64_t) INT64_MAX / bytes_per_sector ) )
+	 || ( number_of_sectors > ( (uint64_t) INT64_MAX / bytes_per_sector ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition sectors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( partition_table->number_of_partitions < LIBSMDEV_PARTITION_TABLE_MAXIMUM_NUMBER_OF_PARTITIONS )
+	{
+		partition_table->partition_offsets[ partition_table->number_of_partitions ] = (off64_t) ( start_sector * bytes_per_sector );
+		partition_table->partition_sizes[ partition_table->number_of_partitions ]   = (size64_t) ( number_of_sectors * bytes_per_sector );
+
+		partition_table->number_of_partitions += 1;
+	}
+	return( 1 );
+}
+
+/* Reads a master boot record (MBR) partition table from the data of the first sector
+ * Only the primary partitions are read
+ * Returns 1 if successful, 0 if the data does not contain a MBR or -1 on error
+ */
+int libsmdev_partition_table_read_mbr(
+     libsmdev_partition_table_t *partition_table,
+     const uint8_t *data,
+     size_t data_size,
+     size_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	static char *function      = "libsmdev_partition_table_read_mbr";
+	size_t entry_offset        = 0;
+	uint32_t number_of_sectors = 0;
+	uint32_t start_sector      = 0;
+	int entry_index            = 0;
+	int number_of_entries      = 0;
+
+	if( partition_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition table.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < 512 )
+	{
+		return( 0 );
+	}
+	if( ( data[ 510 ] != 0x55 )
+	 || ( data[ 511 ] != 0xaa ) )
+	{
+		return( 0 );
+	}
+	/* The boot signature is also used by volume boot records,
+	 * which are distinguished by invalid boot indicators in the partition entries
+	 */
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		entry_offset = 446 + ( (size_t) entry_index * 16 );
+
+		if( ( data[ entry_offset ] != 0x00 )
+		 && ( data[ entry_offset ] != 0x80 ) )
+		{
+			return( 0 );
+		}
+		if( data[ entry_offset + 4 ] != 0 )
+		{
+			number_of_entries++;
+		}
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	partition_table->type                 = LIBSMDEV_PARTITION_TABLE_TYPE_MBR;
+	partition_table->number_of_partitions = 0;
+
+	for( entry_index = 0;
+	     entry_index < 4;
+	     entry_index++ )
+	{
+		entry_offset = 446 + ( (size_t) entry_index * 16 );
+
+		if( data[ entry_offset + 4 ] == 0 )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ entry_offset + 8 ] ),
+		 start_sector );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ entry_offset + 12 ] ),
+		 number_of_sectors );
+
+		if( libsmdev_partition_table_append_partition(
+		     partition_table,
+		     (uint64_t) start_sector,
+		     (uint64_t) number_of_sectors,
+		     bytes_per_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append partition: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads a GUID partition table (GPT) header from the data of the second sector
+ * The CRC-32 checksums are not validated
+ * Returns 1 if successful, 0 if the data does not contain a GPT header or -1 on error
+ */
+int libsmdev_partition_table_read_gpt_header(
+     libsmdev_partition_table_t *partition_table,
+     const uint8_t *data,
+     size_t data_size,
+     size_t bytes_per_sector,
+     off64_t *entries_offset,
+     uint32_t *number_of_entries,
+     uint32_t *entry_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libsmdev_partition_table_read_gpt_header";
+	uint64_t entries_start_sector = 0;
+	uint32_t header_size          = 0;
+
+	if( partition_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition table.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid bytes per sector value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < 92 )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     data,
+	     "EFI PART",
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 header_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 72 ] ),
+	 entries_start_sector );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 80 ] ),
+	 *number_of_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 84 ] ),
+	 *entry_size );
+
+	if( ( header_size < 92 )
+	 || ( entries_start_sector < 2 )
+	 || ( entries_start_sector > ( (uint64_t) INT64_MAX / bytes_per_sector ) )
+	 || ( *entry_size < 128 )
+	 || ( *entry_size > 4096 )
+	 || ( ( *entry_size % 8 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( *number_of_entries > LIBSMDEV_PARTITION_TABLE_MAXIMUM_NUMBER_OF_PARTITIONS )
+	{
+		*number_of_entries = LIBSMDEV_PARTITION_TABLE_MAXIMUM_NUMBER_OF_PARTITIONS;
+	}
+	*entries_offset = (off64_t) ( entries_start_sector * bytes_per_sector );
+
+	return( 1 );
+}
+
+/* Reads the GUID partition table (GPT) entries
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_partition_table_read_gpt_entries(
+     libsmdev_partition_table_t *partition_table,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t number_of_entries,
+     uint32_t entry_size,
+     size_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_partition_table_read_gpt_entries";
+	size_t data_offset    = 0;
+	uint64_t first_sector = 0;
+	uint64_t last_sector  = 0;
+	uint32_t entry_index  = 0;
+
+	if( partition_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition table.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_size < 48 )
+	 || ( number_of_entries > ( data_size / entry_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	partition_table->type                 = LIBSMDEV_PARTITION_TABLE_TYPE_GPT;
+	partition_table->number_of_partitions = 0;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		data_offset = (size_t) entry_index * entry_size;
+
+		/* An entry with an empty partition type identifier is unused
+		 */
+		if( libsmdev_write_engine_data_is_zero(
+		     &( data[ data_offset ] ),
+		     16 ) != 0 )
+		{
+			continue;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset + 32 ] ),
+		 first_sector );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset + 40 ] ),
+		 last_sector );
+
+		if( last_sector < first_sector )
+		{
+			continue;
+		}
+		if( libsmdev_partition_table_append_partition(
+		     partition_table,
+		     first_sector,
+		     last_sector - first_sector + 1,
+		     bytes_per_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append partition: %" PRIu32 ".",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific partition
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_partition_table_get_partition(
+     libsmdev_partition_table_t *partition_table,
+     int partition_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_partition_table_get_partition";
+
+	if( partition_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid partition table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( partition_index < 0 )
+	 || ( partition_index >= partition_table->number_of_partitions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = partition_table->partition_offsets[ partition_index ];
+	*size   = partition_table->partition_sizes[ partition_index ];
+
+	return( 1 );
+}
+
@@ -0,0 +1,113 @@
+/*
+ * Partition table functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_PARTITION_TABLE_H )
+#define _LIBSMDEV_PARTITION_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of partitions
+ * This is the number of entries of a GUID partition table that is created by most tools
+ */
+#define LIBSMDEV_PARTITION_TABLE_MAXIMUM_NUMBER_OF_PARTITIONS	128
+
+typedef struct libsmdev_partition_table libsmdev_partition_table_t;
+
+struct libsmdev_partition_table
+{
+	/* The partition table type
+	 */
+	uint8_t type;
+
+	/* The number of partitions
+	 */
+	int number_of_partitions;
+
+	/* The offsets of the partitions
+	 */
+	off64_t partition_offsets[ LIBSMDEV_PARTITION_TABLE_MAXIMUM_NUMBER_OF_PARTITIONS ];
+
+	/* The sizes of the partitions
+	 */
+	size64_t partition_sizes[ LIBSMDEV_PARTITION_TABLE_MAXIMUM_NUMBER_OF_PARTITIONS ];
+};
+
+int libsmdev_partition_table_initialize(
+     libsmdev_partition_table_t **partition_table,
+     libcerror_error_t **error );
+
+int libsmdev_partition_table_free(
+     libsmdev_partition_table_t **partition_table,
+     libcerror_error_t **error );
+
+int libsmdev_partition_table_append_partition(
+     libsmdev_partition_table_t *partition_table,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     size_t bytes_per_sector,
+     libcerror_error_t **error );
+
+int libsmdev_partition_table_read_mbr(
+     libsmdev_partition_table_t *partition_table,
+     const uint8_t *data,
+     size_t data_size,
+     size_t bytes_per_sector,
+     libcerror_error_t **error );
+
+int libsmdev_partition_table_read_gpt_header(
+     libsmdev_partition_table_t *partition_table,
+     const uint8_t *data,
+     size_t data_size,
+     size_t bytes_per_sector,
+     off64_t *entries_offset,
+     uint32_t *number_of_entries,
+     uint32_t *entry_size,
+     libcerror_error_t **error );
+
+int libsmdev_partition_table_read_gpt_entries(
+     libsmdev_partition_table_t *partition_table,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t number_of_entries,
+     uint32_t entry_size,
+     size_t bytes_per_sector,
+     libcerror_error_t **error );
+
+int libsmdev_partition_table_get_partition(
+     libsmdev_partition_table_t *partition_table,
+     int partition_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_PARTITION_TABLE_H ) */
+
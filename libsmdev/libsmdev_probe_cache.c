@@ -0,0 +1,1683 @@
+/*
+ * Probe cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libsmdev_device_information.h"
+#include "libsmdev_handle.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcnotify.h"
+#include "libsmdev_probe_cache.h"
+#include "libsmdev_sector_range.h"
+#include "libsmdev_sysfs.h"
+#include "libsmdev_track_value.h"
+
+/* Calculates the Adler-32 checksum of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_probe_cache_calculate_checksum(
+     uint32_t *checksum_value,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_probe_cache_calculate_checksum";
+	size_t data_offset    = 0;
+	uint32_t lower_word   = 0;
+	uint32_t upper_word   = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	lower_word = initial_value & 0xffff;
+	upper_word = ( initial_value >> 16 ) & 0xffff;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		lower_word = ( lower_word + data[ data_offset ] ) % 0xfff1;
+		upper_word = ( upper_word + lower_word ) % 0xfff1;
+	}
+	*checksum_value = ( upper_word << 16 ) | lower_word;
+
+	return( 1 );
+}
+
+/* Retrieves the probe cache key of the device
+ * The key consists of the world wide identifier or serial number and the media size
+ * as reported by sysfs. For removable media the disk sequence number is added,
+ * which changes on every media change, so that cached values of other media are not used
+ * Returns 1 if successful, 0 if no key is available or -1 on error
+ */
+int libsmdev_probe_cache_get_key(
+     libsmdev_internal_handle_t *internal_handle,
+     char *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LINUX_FS_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	char name[ 64 ];
+	char path[ LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE ];
+
+	libsmdev_device_information_t *device_information = NULL;
+	const uint8_t *identifier                         = NULL;
+	uint64_t disk_sequence_number                     = 0;
+	int print_count                                   = 0;
+	int result                                        = 0;
+#endif
+
+	static char *function                             = "libsmdev_probe_cache_get_key";
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_size < 2 )
+	 || ( key_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	key[ 0 ] = 0;
+
+#if defined( HAVE_LINUX_FS_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( internal_handle->filename == NULL )
+	{
+		return( 0 );
+	}
+	result = libsmdev_sysfs_get_block_device_name(
+	          internal_handle->filename,
+	          name,
+	          64,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve block device name.",
+			 function );
+		}
+		return( result );
+	}
+	if( libsmdev_device_information_initialize(
+	     &device_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create device information.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_device_information_set_name(
+	     device_information,
+	     name,
+	     narrow_string_length(
+	      name ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in device information.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_device_information_probe(
+	     device_information,
+	     LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_GEOMETRY | LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_PROPERTIES | LIBSMDEV_DEVICE_INFORMATION_PROBE_FLAG_IDENTITY,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to probe device information.",
+		 function );
+
+		goto on_error;
+	}
+	if( device_information->world_wide_identifier[ 0 ] != 0 )
+	{
+		identifier = device_information->world_wide_identifier;
+	}
+	else if( device_information->serial_number[ 0 ] != 0 )
+	{
+		identifier = device_information->serial_number;
+	}
+	result = 0;
+
+	if( ( identifier != NULL )
+	 && ( device_information->media_size != 0 ) )
+	{
+		result = 1;
+
+		if( device_information->removable != 0 )
+		{
+			narrow_string_snprintf(
+			 path,
+			 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+			 "%s/%s/diskseq",
+			 LIBSMDEV_SYSFS_BLOCK_PATH,
+			 device_information->name );
+
+			result = libsmdev_sysfs_read_integer(
+			          path,
+			          &disk_sequence_number,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read disk sequence number.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( result != 0 )
+	{
+		print_count = narrow_string_snprintf(
+		               key,
+		               key_size,
+		               "%s:%" PRIu64 ":%" PRIu64 "",
+		               (char *) identifier,
+		               device_information->media_size,
+		               disk_sequence_number );
+
+		if( ( print_count < 0 )
+		 || ( (size_t) print_count >= key_size ) )
+		{
+			key[ 0 ] = 0;
+
+			result = 0;
+		}
+	}
+	if( libsmdev_device_information_free(
+	     &device_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free device information.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( device_information != NULL )
+	{
+		libsmdev_device_information_free(
+		 &device_information,
+		 NULL );
+	}
+	key[ 0 ] = 0;
+
+	return( -1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Retrieves the path of the probe cache entry of a key
+ * The entry filename is the 64-bit FNV-1a hash of the key, the key itself
+ * is stored in the entry to detect hash collisions
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_probe_cache_get_entry_path(
+     const char *directory,
+     const char *key,
+     char *path,
+     size_t path_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_probe_cache_get_entry_path";
+	size_t key_index      = 0;
+	uint64_t hash_value   = 0xcbf29ce484222325UL;
+	int print_count       = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( key[ key_index ] != 0 )
+	{
+		hash_value ^= (uint8_t) key[ key_index ];
+		hash_value *= 0x00000100000001b3UL;
+
+		key_index++;
+	}
+	print_count = narrow_string_snprintf(
+	               path,
+	               path_size,
+	               "%s/%016" PRIx64 ".cache",
+	               directory,
+	               hash_value );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= path_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: path size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the probe cache entry of the device
+ * Returns 1 if successful, 0 if no valid entry was found or -1 on error
+ */
+int libsmdev_probe_cache_read(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	char key[ LIBSMDEV_PROBE_CACHE_MAXIMUM_KEY_SIZE ];
+	char path[ LIBSMDEV_PROBE_CACHE_MAXIMUM_PATH_SIZE ];
+
+	FILE *file_stream     = NULL;
+	uint8_t *data         = NULL;
+	static char *function = "libsmdev_probe_cache_read";
+	size_t read_count     = 0;
+	int result            = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->probe_cache_directory == NULL )
+	{
+		return( 0 );
+	}
+	result = libsmdev_probe_cache_get_key(
+	          internal_handle,
+	          key,
+	          LIBSMDEV_PROBE_CACHE_MAXIMUM_KEY_SIZE,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key.",
+			 function );
+		}
+		return( result );
+	}
+	if( libsmdev_probe_cache_get_entry_path(
+	     internal_handle->probe_cache_directory,
+	     key,
+	     path,
+	     LIBSMDEV_PROBE_CACHE_MAXIMUM_PATH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry path.",
+		 function );
+
+		goto on_error;
+	}
+	/* A missing entry is not considered an error
+	 */
+	file_stream = file_stream_open(
+	               path,
+	               FILE_STREAM_BINARY_OPEN_READ );
+
+	if( file_stream == NULL )
+	{
+		return( 0 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * LIBSMDEV_PROBE_CACHE_MAXIMUM_ENTRY_SIZE );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = file_stream_read(
+	              file_stream,
+	              data,
+	              LIBSMDEV_PROBE_CACHE_MAXIMUM_ENTRY_SIZE );
+
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file stream.",
+		 function );
+
+		file_stream = NULL;
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+	result = libsmdev_probe_cache_read_data(
+	          internal_handle,
+	          key,
+	          data,
+	          read_count,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read entry data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( result );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
+/* Reads the probe cache entry data
+ * Entries with a different signature, size, checksum or key are ignored
+ * Returns 1 if successful, 0 if the entry is not valid or -1 on error
+ */
+int libsmdev_probe_cache_read_data(
+     libsmdev_internal_handle_t *internal_handle,
+     const char *key,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libsmdev_probe_cache_entry_header_t *entry_header = NULL;
+	static char *function                             = "libsmdev_probe_cache_read_data";
+	size_t data_offset                                = 0;
+	size_t key_length                                 = 0;
+	uint64_t number_of_sectors                        = 0;
+	uint64_t start_sector                             = 0;
+	uint32_t calculated_checksum                      = 0;
+	uint32_t entry_size                               = 0;
+	uint32_t stored_checksum                          = 0;
+	uint16_t number_of_lead_outs                      = 0;
+	uint16_t number_of_sessions                       = 0;
+	uint16_t number_of_tracks                         = 0;
+	uint16_t value_index                              = 0;
+	int result                                        = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	key_length = narrow_string_length(
+	              key );
+
+	if( key_length >= LIBSMDEV_PROBE_CACHE_MAXIMUM_KEY_SIZE )
+	{
+		return( 0 );
+	}
+	if( data_size < sizeof( libsmdev_probe_cache_entry_header_t ) )
+	{
+		return( 0 );
+	}
+	entry_header = (libsmdev_probe_cache_entry_header_t *) data;
+
+	if( memory_compare(
+	     entry_header->signature,
+	     LIBSMDEV_PROBE_CACHE_SIGNATURE,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 entry_header->checksum,
+	 stored_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 entry_header->entry_size,
+	 entry_size );
+
+	if( (size_t) entry_size != data_size )
+	{
+		return( 0 );
+	}
+	if( libsmdev_probe_cache_calculate_checksum(
+	     &calculated_checksum,
+	     &( data[ 12 ] ),
+	     data_size - 12,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).\n",
+			 function,
+			 stored_checksum,
+			 calculated_checksum );
+		}
+#endif
+		return( 0 );
+	}
+	if( memory_compare(
+	     entry_header->key,
+	     key,
+	     key_length + 1 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 entry_header->number_of_sessions,
+	 number_of_sessions );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 entry_header->number_of_lead_outs,
+	 number_of_lead_outs );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 entry_header->number_of_tracks,
+	 number_of_tracks );
+
+	if( ( number_of_sessions > LIBSMDEV_PROBE_CACHE_MAXIMUM_NUMBER_OF_VALUES )
+	 || ( number_of_lead_outs > LIBSMDEV_PROBE_CACHE_MAXIMUM_NUMBER_OF_VALUES )
+	 || ( number_of_tracks > LIBSMDEV_PROBE_CACHE_MAXIMUM_NUMBER_OF_VALUES ) )
+	{
+		return( 0 );
+	}
+	if( data_size != ( sizeof( libsmdev_probe_cache_entry_header_t )
+	               + ( ( (size_t) number_of_sessions + number_of_lead_outs ) * LIBSMDEV_PROBE_CACHE_SECTOR_RANGE_SIZE )
+	               + ( (size_t) number_of_tracks * LIBSMDEV_PROBE_CACHE_TRACK_SIZE ) ) )
+	{
+		return( 0 );
+	}
+	if( ( ( entry_header->flags & LIBSMDEV_PROBE_CACHE_FLAG_MEDIA_INFORMATION ) != 0 )
+	 && ( internal_handle->media_information_set == 0 ) )
+	{
+		internal_handle->bus_type    = entry_header->bus_type;
+		internal_handle->device_type = entry_header->device_type;
+		internal_handle->removable   = entry_header->removable;
+
+		if( memory_copy(
+		     internal_handle->vendor,
+		     entry_header->vendor,
+		     64 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy vendor.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_handle->model,
+		     entry_header->model,
+		     64 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy model.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_handle->serial_number,
+		     entry_header->serial_number,
+		     64 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy serial number.",
+			 function );
+
+			goto on_error;
+		}
+		internal_handle->vendor[ 63 ]        = 0;
+		internal_handle->model[ 63 ]         = 0;
+		internal_handle->serial_number[ 63 ] = 0;
+
+		internal_handle->media_information_set = 1;
+
+		result = 1;
+	}
+	if( ( ( entry_header->flags & LIBSMDEV_PROBE_CACHE_FLAG_TABLE_OF_CONTENTS ) != 0 )
+	 && ( internal_handle->media_information_set != 0 )
+	 && ( internal_handle->table_of_contents_set == 0 ) )
+	{
+		data_offset = sizeof( libsmdev_probe_cache_entry_header_t );
+
+		for( value_index = 0;
+		     value_index < number_of_sessions;
+		     value_index++ )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 start_sector );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset + 8 ] ),
+			 number_of_sectors );
+
+			data_offset += LIBSMDEV_PROBE_CACHE_SECTOR_RANGE_SIZE;
+
+			if( libsmdev_handle_append_session(
+			     internal_handle,
+			     start_sector,
+			     number_of_sectors,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append session.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		for( value_index = 0;
+		     value_index < number_of_lead_outs;
+		     value_index++ )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 start_sector );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset + 8 ] ),
+			 number_of_sectors );
+
+			data_offset += LIBSMDEV_PROBE_CACHE_SECTOR_RANGE_SIZE;
+
+			if( libsmdev_handle_append_lead_out(
+			     internal_handle,
+			     start_sector,
+			     number_of_sectors,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append lead-out.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		for( value_index = 0;
+		     value_index < number_of_tracks;
+		     value_index++ )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 start_sector );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset + 8 ] ),
+			 number_of_sectors );
+
+			if( libsmdev_handle_append_track(
+			     internal_handle,
+			     start_sector,
+			     number_of_sectors,
+			     data[ data_offset + 16 ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append track.",
+				 function );
+
+				goto on_error;
+			}
+			data_offset += LIBSMDEV_PROBE_CACHE_TRACK_SIZE;
+		}
+		internal_handle->table_of_contents_set = 1;
+
+		result = 1;
+	}
+	return( result );
+
+on_error:
+	if( internal_handle->table_of_contents_set == 0 )
+	{
+		libsmdev_table_of_contents_empty(
+		 internal_handle->table_of_contents,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes contiguous sector ranges to probe cache entry data
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_probe_cache_write_sector_ranges(
+     libsmdev_sector_range_t *sector_ranges,
+     int number_of_sector_ranges,
+     uint8_t *data,
+     size_t *data_offset,
+     libcerror_error_t **error )
+{
+	static char *function      = "libsmdev_probe_cache_write_sector_ranges";
+	uint64_t number_of_sectors = 0;
+	uint64_t start_sector      = 0;
+	int sector_range_index     = 0;
+
+	if( ( sector_ranges == NULL )
+	 && ( number_of_sector_ranges > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	for( sector_range_index = 0;
+	     sector_range_index < number_of_sector_ranges;
+	     sector_range_index++ )
+	{
+		if( libsmdev_sector_range_get(
+		     &( sector_ranges[ sector_range_index ] ),
+		     &start_sector,
+		     &number_of_sectors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sector range: %d values.",
+			 function,
+			 sector_range_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ *data_offset ] ),
+		 start_sector );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ *data_offset + 8 ] ),
+		 number_of_sectors );
+
+		*data_offset += LIBSMDEV_PROBE_CACHE_SECTOR_RANGE_SIZE;
+	}
+	return( 1 );
+}
+
+/* Writes the probe cache entry data
+ * Returns 1 if successful, 0 if there are no values to cache or -1 on error
+ */
+int libsmdev_probe_cache_write_data(
+     libsmdev_internal_handle_t *internal_handle,
+     const char *key,
+     uint8_t *data,
+     size_t data_size,
+     size_t *entry_size,
+     libcerror_error_t **error )
+{
+	libsmdev_probe_cache_entry_header_t *entry_header = NULL;
+	static char *function                             = "libsmdev_probe_cache_write_data";
+	size_t data_offset                                = 0;
+	size_t key_length                                 = 0;
+	size_t required_data_size                         = 0;
+	uint64_t number_of_sectors                        = 0;
+	uint64_t start_sector                             = 0;
+	uint32_t checksum                                 = 0;
+	uint8_t track_type                                = 0;
+	uint8_t write_table_of_contents                   = 0;
+	int number_of_lead_outs                           = 0;
+	int number_of_sessions                            = 0;
+	int number_of_tracks                              = 0;
+	int track_index                                   = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry size.",
+		 function );
+
+		return( -1 );
+	}
+	key_length = narrow_string_length(
+	              key );
+
+	if( key_length >= LIBSMDEV_PROBE_CACHE_MAXIMUM_KEY_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->media_information_set == 0 )
+	{
+		return( 0 );
+	}
+	if( internal_handle->table_of_contents_set != 0 )
+	{
+		if( libsmdev_table_of_contents_get_number_of_sessions(
+		     internal_handle->table_of_contents,
+		     &number_of_sessions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sessions.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsmdev_table_of_contents_get_number_of_lead_outs(
+		     internal_handle->table_of_contents,
+		     &number_of_lead_outs,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of lead-outs.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsmdev_table_of_contents_get_number_of_tracks(
+		     internal_handle->table_of_contents,
+		     &number_of_tracks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of tracks.",
+			 function );
+
+			return( -1 );
+		}
+		/* A table of contents that does not fit is not cached
+		 */
+		if( ( number_of_sessions <= LIBSMDEV_PROBE_CACHE_MAXIMUM_NUMBER_OF_VALUES )
+		 && ( number_of_lead_outs <= LIBSMDEV_PROBE_CACHE_MAXIMUM_NUMBER_OF_VALUES )
+		 && ( number_of_tracks <= LIBSMDEV_PROBE_CACHE_MAXIMUM_NUMBER_OF_VALUES ) )
+		{
+			write_table_of_contents = 1;
+		}
+		else
+		{
+			number_of_sessions  = 0;
+			number_of_lead_outs = 0;
+			number_of_tracks    = 0;
+		}
+	}
+	required_data_size = sizeof( libsmdev_probe_cache_entry_header_t )
+	                   + ( ( (size_t) number_of_sessions + number_of_lead_outs ) * LIBSMDEV_PROBE_CACHE_SECTOR_RANGE_SIZE )
+	                   + ( (size_t) number_of_tracks * LIBSMDEV_PROBE_CACHE_TRACK_SIZE );
+
+	if( required_data_size > data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     required_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	entry_header = (libsmdev_probe_cache_entry_header_t *) data;
+
+	if( memory_copy(
+	     entry_header->signature,
+	     LIBSMDEV_PROBE_CACHE_SIGNATURE,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 entry_header->entry_size,
+	 (uint32_t) required_data_size );
+
+	if( memory_copy(
+	     entry_header->key,
+	     key,
+	     key_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key.",
+		 function );
+
+		return( -1 );
+	}
+	entry_header->flags       = LIBSMDEV_PROBE_CACHE_FLAG_MEDIA_INFORMATION;
+	entry_header->bus_type    = internal_handle->bus_type;
+	entry_header->device_type = internal_handle->device_type;
+	entry_header->removable   = internal_handle->removable;
+
+	if( memory_copy(
+	     entry_header->vendor,
+	     internal_handle->vendor,
+	     64 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy vendor.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     entry_header->model,
+	     internal_handle->model,
+	     64 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy model.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     entry_header->serial_number,
+	     internal_handle->serial_number,
+	     64 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy serial number.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_table_of_contents != 0 )
+	{
+		entry_header->flags |= LIBSMDEV_PROBE_CACHE_FLAG_TABLE_OF_CONTENTS;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 entry_header->number_of_sessions,
+		 (uint16_t) number_of_sessions );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 entry_header->number_of_lead_outs,
+		 (uint16_t) number_of_lead_outs );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 entry_header->number_of_tracks,
+		 (uint16_t) number_of_tracks );
+
+		data_offset = sizeof( libsmdev_probe_cache_entry_header_t );
+
+		if( libsmdev_probe_cache_write_sector_ranges(
+		     internal_handle->table_of_contents->sessions,
+		     number_of_sessions,
+		     data,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write sessions.",
+			 function );
+
+			return( -1 );
+		}
+		if( libsmdev_probe_cache_write_sector_ranges(
+		     internal_handle->table_of_contents->lead_outs,
+		     number_of_lead_outs,
+		     data,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write lead-outs.",
+			 function );
+
+			return( -1 );
+		}
+		for( track_index = 0;
+		     track_index < number_of_tracks;
+		     track_index++ )
+		{
+			if( libsmdev_track_value_get(
+			     &( internal_handle->table_of_contents->tracks[ track_index ] ),
+			     &start_sector,
+			     &number_of_sectors,
+			     &track_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve track value: %d values.",
+				 function,
+				 track_index );
+
+				return( -1 );
+			}
+			byte_stream_copy_from_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 start_sector );
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( data[ data_offset + 8 ] ),
+			 number_of_sectors );
+
+			data[ data_offset + 16 ] = track_type;
+
+			data_offset += LIBSMDEV_PROBE_CACHE_TRACK_SIZE;
+		}
+	}
+	if( libsmdev_probe_cache_calculate_checksum(
+	     &checksum,
+	     &( data[ 12 ] ),
+	     required_data_size - 12,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate checksum.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 entry_header->checksum,
+	 checksum );
+
+	*entry_size = required_data_size;
+
+	return( 1 );
+}
+
+/* Writes the probe cache entry of the device
+ * The entry is written to a uniquely named temporary file first and then renamed
+ * so that concurrent readers never see a partially written entry
+ * Returns 1 if successful, 0 if no entry was written or -1 on error
+ */
+int libsmdev_probe_cache_write(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	char key[ LIBSMDEV_PROBE_CACHE_MAXIMUM_KEY_SIZE ];
+	char path[ LIBSMDEV_PROBE_CACHE_MAXIMUM_PATH_SIZE ];
+	char temporary_path[ LIBSMDEV_PROBE_CACHE_MAXIMUM_PATH_SIZE + 16 ];
+
+	FILE *file_stream     = NULL;
+	uint8_t *data         = NULL;
+	static char *function = "libsmdev_probe_cache_write";
+	size_t entry_size     = 0;
+	size_t write_count    = 0;
+	int result            = 0;
+
+#if defined( HAVE_MKSTEMP ) && defined( HAVE_FDOPEN )
+	int file_descriptor   = -1;
+#endif
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_handle->probe_cache_directory == NULL )
+	 || ( internal_handle->media_information_set == 0 ) )
+	{
+		return( 0 );
+	}
+	result = libsmdev_probe_cache_get_key(
+	          internal_handle,
+	          key,
+	          LIBSMDEV_PROBE_CACHE_MAXIMUM_KEY_SIZE,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key.",
+			 function );
+		}
+		return( result );
+	}
+	if( libsmdev_probe_cache_get_entry_path(
+	     internal_handle->probe_cache_directory,
+	     key,
+	     path,
+	     LIBSMDEV_PROBE_CACHE_MAXIMUM_PATH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry path.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * LIBSMDEV_PROBE_CACHE_MAXIMUM_ENTRY_SIZE );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	result = libsmdev_probe_cache_write_data(
+	          internal_handle,
+	          key,
+	          data,
+	          LIBSMDEV_PROBE_CACHE_MAXIMUM_ENTRY_SIZE,
+	          &entry_size,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write entry data.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 data );
+
+		return( 0 );
+	}
+#if defined( HAVE_MKSTEMP ) && defined( HAVE_FDOPEN )
+	narrow_string_snprintf(
+	 temporary_path,
+	 LIBSMDEV_PROBE_CACHE_MAXIMUM_PATH_SIZE + 16,
+	 "%s.XXXXXX",
+	 path );
+
+	file_descriptor = mkstemp(
+	                   temporary_path );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create temporary file: %s.",
+		 function,
+		 temporary_path );
+
+		goto on_error;
+	}
+	file_stream = fdopen(
+	               file_descriptor,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		close(
+		 file_descriptor );
+
+		remove(
+		 temporary_path );
+	}
+#else
+	/* The handle address makes the name unique for concurrent writers
+	 * in the same process and the process identifier for other processes
+	 */
+#if defined( HAVE_GETPID )
+	narrow_string_snprintf(
+	 temporary_path,
+	 LIBSMDEV_PROBE_CACHE_MAXIMUM_PATH_SIZE + 16,
+	 "%s.%d.%lx",
+	 path,
+	 (int) getpid(),
+	 (unsigned long) (intptr_t) internal_handle );
+#else
+	narrow_string_snprintf(
+	 temporary_path,
+	 LIBSMDEV_PROBE_CACHE_MAXIMUM_PATH_SIZE + 16,
+	 "%s.%lx",
+	 path,
+	 (unsigned long) (intptr_t) internal_handle );
+#endif
+	file_stream = file_stream_open(
+	               temporary_path,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+#endif /* defined( HAVE_MKSTEMP ) && defined( HAVE_FDOPEN ) */
+
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file stream: %s.",
+		 function,
+		 temporary_path );
+
+		goto on_error;
+	}
+	write_count = file_stream_write(
+	               file_stream,
+	               data,
+	               entry_size );
+
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		write_count = 0;
+	}
+	file_stream = NULL;
+
+	if( write_count != entry_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write entry: %s.",
+		 function,
+		 temporary_path );
+
+		remove(
+		 temporary_path );
+
+		goto on_error;
+	}
+	if( rename(
+	     temporary_path,
+	     path ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to rename entry: %s.",
+		 function,
+		 temporary_path );
+
+		remove(
+		 temporary_path );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Removes the probe cache entry of the device
+ * Returns 1 if successful, 0 if no entry was found or -1 on error
+ */
+int libsmdev_probe_cache_remove(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error )
+{
+	char key[ LIBSMDEV_PROBE_CACHE_MAXIMUM_KEY_SIZE ];
+	char path[ LIBSMDEV_PROBE_CACHE_MAXIMUM_PATH_SIZE ];
+
+	static char *function = "libsmdev_probe_cache_remove";
+	int result            = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_handle->probe_cache_directory == NULL )
+	{
+		return( 0 );
+	}
+	result = libsmdev_probe_cache_get_key(
+	          internal_handle,
+	          key,
+	          LIBSMDEV_PROBE_CACHE_MAXIMUM_KEY_SIZE,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key.",
+			 function );
+		}
+		return( result );
+	}
+	if( libsmdev_probe_cache_get_entry_path(
+	     internal_handle->probe_cache_directory,
+	     key,
+	     path,
+	     LIBSMDEV_PROBE_CACHE_MAXIMUM_PATH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry path.",
+		 function );
+
+		return( -1 );
+	}
+	if( remove(
+	     path ) != 0 )
+	{
+		if( errno == ENOENT )
+		{
+			return( 0 );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+		 "%s: unable to remove entry: %s.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,212 @@
+/*
+ * Probe cache functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_PROBE_CACHE_H )
+#define _LIBSMDEV_PROBE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_handle.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_sector_range.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The probe cache entry signature, the last character is the format version
+ */
+#define LIBSMDEV_PROBE_CACHE_SIGNATURE			"smdevpc1"
+
+/* The maximum size of the probe cache key
+ */
+#define LIBSMDEV_PROBE_CACHE_MAXIMUM_KEY_SIZE		128
+
+/* The maximum size of a probe cache entry path
+ */
+#define LIBSMDEV_PROBE_CACHE_MAXIMUM_PATH_SIZE		1024
+
+/* The maximum number of sessions, lead-outs and tracks in a probe cache entry
+ */
+#define LIBSMDEV_PROBE_CACHE_MAXIMUM_NUMBER_OF_VALUES	256
+
+enum LIBSMDEV_PROBE_CACHE_FLAGS
+{
+	LIBSMDEV_PROBE_CACHE_FLAG_MEDIA_INFORMATION	= 0x01,
+	LIBSMDEV_PROBE_CACHE_FLAG_TABLE_OF_CONTENTS	= 0x02
+};
+
+typedef struct libsmdev_probe_cache_entry_header libsmdev_probe_cache_entry_header_t;
+
+struct libsmdev_probe_cache_entry_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The checksum of the data after the checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* The entry size
+	 * Consists of 4 bytes
+	 */
+	uint8_t entry_size[ 4 ];
+
+	/* The key
+	 * Consists of 128 bytes
+	 */
+	uint8_t key[ 128 ];
+
+	/* The flags
+	 * Consists of 1 byte
+	 */
+	uint8_t flags;
+
+	/* The bus type
+	 * Consists of 1 byte
+	 */
+	uint8_t bus_type;
+
+	/* The device type
+	 * Consists of 1 byte
+	 */
+	uint8_t device_type;
+
+	/* Value to indicate if the device is removable
+	 * Consists of 1 byte
+	 */
+	uint8_t removable;
+
+	/* The vendor string
+	 * Consists of 64 bytes
+	 */
+	uint8_t vendor[ 64 ];
+
+	/* The model string
+	 * Consists of 64 bytes
+	 */
+	uint8_t model[ 64 ];
+
+	/* The serial number string
+	 * Consists of 64 bytes
+	 */
+	uint8_t serial_number[ 64 ];
+
+	/* The number of sessions
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_sessions[ 2 ];
+
+	/* The number of lead-outs
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_lead_outs[ 2 ];
+
+	/* The number of tracks
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_tracks[ 2 ];
+
+	/* Padding
+	 * Consists of 2 bytes
+	 */
+	uint8_t padding[ 2 ];
+};
+
+/* The session and lead-out sector ranges are stored as:
+ * start sector (8 bytes) and number of sectors (8 bytes)
+ * The tracks are stored as:
+ * start sector (8 bytes), number of sectors (8 bytes) and type (1 byte)
+ */
+#define LIBSMDEV_PROBE_CACHE_SECTOR_RANGE_SIZE		16
+#define LIBSMDEV_PROBE_CACHE_TRACK_SIZE			17
+
+/* The maximum size of a probe cache entry
+ */
+#define LIBSMDEV_PROBE_CACHE_MAXIMUM_ENTRY_SIZE \
+	( sizeof( libsmdev_probe_cache_entry_header_t ) \
+	+ ( 2 * LIBSMDEV_PROBE_CACHE_MAXIMUM_NUMBER_OF_VALUES * LIBSMDEV_PROBE_CACHE_SECTOR_RANGE_SIZE ) \
+	+ ( LIBSMDEV_PROBE_CACHE_MAXIMUM_NUMBER_OF_VALUES * LIBSMDEV_PROBE_CACHE_TRACK_SIZE ) )
+
+int libsmdev_probe_cache_calculate_checksum(
+     uint32_t *checksum_value,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+int libsmdev_probe_cache_get_key(
+     libsmdev_internal_handle_t *internal_handle,
+     char *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+int libsmdev_probe_cache_get_entry_path(
+     const char *directory,
+     const char *key,
+     char *path,
+     size_t path_size,
+     libcerror_error_t **error );
+
+int libsmdev_probe_cache_read(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libsmdev_probe_cache_read_data(
+     libsmdev_internal_handle_t *internal_handle,
+     const char *key,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libsmdev_probe_cache_write_sector_ranges(
+     libsmdev_sector_range_t *sector_ranges,
+     int number_of_sector_ranges,
+     uint8_t *data,
+     size_t *data_offset,
+     libcerror_error_t **error );
+
+int libsmdev_probe_cache_write_data(
+     libsmdev_internal_handle_t *internal_handle,
+     const char *key,
+     uint8_t *data,
+     size_t data_size,
+     size_t *entry_size,
+     libcerror_error_t **error );
+
+int libsmdev_probe_cache_write(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+int libsmdev_probe_cache_remove(
+     libsmdev_internal_handle_t *internal_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_PROBE_CACHE_H ) */
+
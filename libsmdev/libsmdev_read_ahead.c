@@ -0,0 +1,554 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H ) && !defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_SYS_IOCTL_H )
+#include <sys/ioctl.h>
+#endif
+
+#if defined( HAVE_LINUX_FS_H ) && !defined( WINAPI )
+/* Required for Linux platforms that use a sizeof( u64 )
+ * in linux/fs.h but have no typedef of it
+ */
+#if !defined( HAVE_U64 )
+typedef size_t u64;
+#endif
+
+#include <linux/fs.h>
+#endif
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcnotify.h"
+#include "libsmdev_read_ahead.h"
+
+/* Creates a read-ahead
+ * Make sure the value read_ahead is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_read_ahead_initialize(
+     libsmdev_read_ahead_t **read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_read_ahead_initialize";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*read_ahead = memory_allocate_structure(
+	               libsmdev_read_ahead_t );
+
+	if( *read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_ahead,
+	     0,
+	     sizeof( libsmdev_read_ahead_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_ahead )->file_descriptor           = -1;
+	( *read_ahead )->configured_access_pattern = LIBSMDEV_ACCESS_PATTERN_AUTOMATIC;
+	( *read_ahead )->access_pattern            = LIBSMDEV_ACCESS_PATTERN_AUTOMATIC;
+
+	return( 1 );
+
+on_error:
+	if( *read_ahead != NULL )
+	{
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read-ahead
+ * The original read-ahead window of the device is restored if necessary
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_read_ahead_free(
+     libsmdev_read_ahead_t **read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_read_ahead_free";
+	int result            = 1;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		if( libsmdev_read_ahead_close(
+		     *read_ahead,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close read-ahead.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( result );
+}
+
+/* Opens the read-ahead control of a device
+ * The current read-ahead window of the device is retrieved so it can be restored on close
+ * Returns 1 if successful, 0 if the read-ahead of the device cannot be controlled or -1 on error
+ */
+int libsmdev_read_ahead_open(
+     libsmdev_read_ahead_t *read_ahead,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_read_ahead_open";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead->file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead - file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	read_ahead->access_pattern             = LIBSMDEV_ACCESS_PATTERN_AUTOMATIC;
+	read_ahead->next_offset                = 0;
+	read_ahead->number_of_sequential_reads = 0;
+	read_ahead->number_of_random_reads     = 0;
+	read_ahead->drop_behind_offset         = 0;
+
+#if !defined( WINAPI ) && ( ( defined( BLKRAGET ) && defined( BLKRASET ) ) || defined( HAVE_POSIX_FADVISE ) )
+	read_ahead->file_descriptor = open(
+	                               filename,
+	                               O_RDONLY );
+
+	if( read_ahead->file_descriptor == -1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to open device file for read-ahead control with error: %d.\n",
+			 function,
+			 errno );
+		}
+#endif
+		return( 0 );
+	}
+#if defined( BLKRAGET ) && defined( BLKRASET )
+	if( ioctl(
+	     read_ahead->file_descriptor,
+	     BLKRAGET,
+	     &( read_ahead->original_window ) ) == 0 )
+	{
+		read_ahead->original_window_set = 1;
+	}
+#endif
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Closes the read-ahead control of a device
+ * The original read-ahead window of the device is restored if it was changed
+ * Returns 0 if successful or -1 on error
+ */
+int libsmdev_read_ahead_close(
+     libsmdev_read_ahead_t *read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_read_ahead_close";
+	int result            = 0;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( WINAPI )
+	if( read_ahead->file_descriptor != -1 )
+	{
+#if defined( BLKRAGET ) && defined( BLKRASET )
+		if( read_ahead->window_changed != 0 )
+		{
+			if( ioctl(
+			     read_ahead->file_descriptor,
+			     BLKRASET,
+			     read_ahead->original_window ) != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+				 errno,
+				 "%s: unable to restore read-ahead window.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( close(
+		     read_ahead->file_descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close file descriptor.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	read_ahead->file_descriptor     = -1;
+	read_ahead->original_window     = 0;
+	read_ahead->original_window_set = 0;
+	read_ahead->window_changed      = 0;
+	read_ahead->access_pattern      = LIBSMDEV_ACCESS_PATTERN_AUTOMATIC;
+
+	return( result );
+}
+
+/* Updates the access pattern with a read of a specific size at a specific offset
+ * A read that directly follows the previous read, or only skips a small gap, is considered sequential
+ * The access pattern only changes after a number of consecutive sequential or random reads
+ * Returns 1 if the access pattern changed or 0 if not
+ */
+int libsmdev_read_ahead_update(
+     libsmdev_read_ahead_t *read_ahead,
+     off64_t offset,
+     size_t size )
+{
+	int access_pattern = 0;
+
+	if( read_ahead == NULL )
+	{
+		return( 0 );
+	}
+	access_pattern = read_ahead->access_pattern;
+
+	if( read_ahead->configured_access_pattern != LIBSMDEV_ACCESS_PATTERN_AUTOMATIC )
+	{
+		access_pattern = read_ahead->configured_access_pattern;
+	}
+	else
+	{
+		if( ( offset >= read_ahead->next_offset )
+		 && ( ( offset - read_ahead->next_offset ) <= (off64_t) LIBSMDEV_READ_AHEAD_MAXIMUM_GAP_SIZE ) )
+		{
+			if( read_ahead->number_of_sequential_reads < LIBSMDEV_READ_AHEAD_DETECTION_THRESHOLD )
+			{
+				read_ahead->number_of_sequential_reads += 1;
+			}
+			read_ahead->number_of_random_reads = 0;
+		}
+		else
+		{
+			if( read_ahead->number_of_random_reads < LIBSMDEV_READ_AHEAD_DETECTION_THRESHOLD )
+			{
+				read_ahead->number_of_random_reads += 1;
+			}
+			read_ahead->number_of_sequential_reads = 0;
+		}
+		if( read_ahead->number_of_sequential_reads >= LIBSMDEV_READ_AHEAD_DETECTION_THRESHOLD )
+		{
+			access_pattern = LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL;
+		}
+		else if( read_ahead->number_of_random_reads >= LIBSMDEV_READ_AHEAD_DETECTION_THRESHOLD )
+		{
+			access_pattern = LIBSMDEV_ACCESS_PATTERN_RANDOM;
+		}
+	}
+	read_ahead->next_offset = offset + (off64_t) size;
+
+	if( access_pattern == read_ahead->access_pattern )
+	{
+		return( 0 );
+	}
+	/* Only data consumed after the access pattern became sequential is dropped from the page cache
+	 */
+	read_ahead->access_pattern     = access_pattern;
+	read_ahead->drop_behind_offset = offset;
+
+	return( 1 );
+}
+
+/* Sets the read-ahead window of the device for a specific access pattern
+ * Sequential access uses a large window, random access disables read-ahead
+ * Changing the read-ahead window of a block device requires elevated privileges
+ * Returns 1 if successful, 0 if the read-ahead window could not be changed or -1 on error
+ */
+int libsmdev_read_ahead_set_window(
+     libsmdev_read_ahead_t *read_ahead,
+     int access_pattern,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_read_ahead_set_window";
+
+#if !defined( WINAPI ) && defined( BLKRAGET ) && defined( BLKRASET )
+	unsigned long window  = 0;
+#endif
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_pattern != LIBSMDEV_ACCESS_PATTERN_AUTOMATIC )
+	 && ( access_pattern != LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL )
+	 && ( access_pattern != LIBSMDEV_ACCESS_PATTERN_RANDOM ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access pattern.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( WINAPI ) && defined( BLKRAGET ) && defined( BLKRASET )
+	if( ( read_ahead->file_descriptor == -1 )
+	 || ( read_ahead->original_window_set == 0 ) )
+	{
+		return( 0 );
+	}
+	if( access_pattern == LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL )
+	{
+		window = LIBSMDEV_READ_AHEAD_SEQUENTIAL_WINDOW_SIZE / 512;
+
+		if( window < read_ahead->original_window )
+		{
+			window = read_ahead->original_window;
+		}
+	}
+	else if( access_pattern == LIBSMDEV_ACCESS_PATTERN_AUTOMATIC )
+	{
+		window = read_ahead->original_window;
+	}
+	if( ioctl(
+	     read_ahead->file_descriptor,
+	     BLKRASET,
+	     window ) != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to set read-ahead window with error: %d.\n",
+			 function,
+			 errno );
+		}
+#endif
+		return( 0 );
+	}
+	read_ahead->window_changed = (uint8_t) ( window != read_ahead->original_window );
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Drops the data that was consumed by sequential reads from the page cache
+ * The data is dropped in large batches up to the offset
+ * Returns 1 if successful, 0 if no data was dropped or -1 on error
+ */
+int libsmdev_read_ahead_drop_behind(
+     libsmdev_read_ahead_t *read_ahead,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_read_ahead_drop_behind";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_ahead->access_pattern != LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL )
+	{
+		return( 0 );
+	}
+	if( offset < read_ahead->drop_behind_offset )
+	{
+		read_ahead->drop_behind_offset = offset;
+
+		return( 0 );
+	}
+	if( ( offset - read_ahead->drop_behind_offset ) < (off64_t) LIBSMDEV_READ_AHEAD_DROP_BEHIND_SIZE )
+	{
+		return( 0 );
+	}
+#if !defined( WINAPI ) && defined( HAVE_POSIX_FADVISE ) && defined( POSIX_FADV_DONTNEED )
+	if( read_ahead->file_descriptor != -1 )
+	{
+		/* The page cache is shared by all file descriptors of the device
+		 */
+		if( posix_fadvise(
+		     read_ahead->file_descriptor,
+		     read_ahead->drop_behind_offset,
+		     offset - read_ahead->drop_behind_offset,
+		     POSIX_FADV_DONTNEED ) != 0 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to drop range at offset: %" PRIi64 " (0x%08" PRIx64 ") from page cache.\n",
+				 function,
+				 read_ahead->drop_behind_offset,
+				 read_ahead->drop_behind_offset );
+			}
+#endif
+		}
+	}
+#endif
+	read_ahead->drop_behind_offset = offset;
+
+	return( 1 );
+}
+
@@ -0,0 +1,134 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_READ_AHEAD_H )
+#define _LIBSMDEV_READ_AHEAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of consecutive reads that is needed to change the detected access pattern
+ */
+#define LIBSMDEV_READ_AHEAD_DETECTION_THRESHOLD		4
+
+/* The maximum size of a forward gap between reads that are still considered sequential
+ * This allows for sectors that are skipped after a read error
+ */
+#define LIBSMDEV_READ_AHEAD_MAXIMUM_GAP_SIZE		65536
+
+/* The size of the read-ahead window used for sequential access
+ */
+#define LIBSMDEV_READ_AHEAD_SEQUENTIAL_WINDOW_SIZE	8388608
+
+/* The size of the consumed data that is dropped from the page cache at once
+ */
+#define LIBSMDEV_READ_AHEAD_DROP_BEHIND_SIZE		33554432
+
+typedef struct libsmdev_read_ahead libsmdev_read_ahead_t;
+
+struct libsmdev_read_ahead
+{
+	/* The file descriptor used to control the read-ahead of the device
+	 * Contains -1 if not available
+	 */
+	int file_descriptor;
+
+	/* The original read-ahead window of the device in 512 byte sectors
+	 */
+	unsigned long original_window;
+
+	/* Value to indicate the original read-ahead window was retrieved
+	 */
+	uint8_t original_window_set;
+
+	/* Value to indicate the read-ahead window of the device was changed
+	 */
+	uint8_t window_changed;
+
+	/* The configured access pattern
+	 */
+	int configured_access_pattern;
+
+	/* The current access pattern
+	 */
+	int access_pattern;
+
+	/* The offset that directly follows the previous read
+	 */
+	off64_t next_offset;
+
+	/* The number of consecutive sequential reads
+	 */
+	int number_of_sequential_reads;
+
+	/* The number of consecutive random reads
+	 */
+	int number_of_random_reads;
+
+	/* The offset from which consumed data has not yet been dropped from the page cache
+	 */
+	off64_t drop_behind_offset;
+};
+
+int libsmdev_read_ahead_initialize(
+     libsmdev_read_ahead_t **read_ahead,
+     libcerror_error_t **error );
+
+int libsmdev_read_ahead_free(
+     libsmdev_read_ahead_t **read_ahead,
+     libcerror_error_t **error );
+
+int libsmdev_read_ahead_open(
+     libsmdev_read_ahead_t *read_ahead,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libsmdev_read_ahead_close(
+     libsmdev_read_ahead_t *read_ahead,
+     libcerror_error_t **error );
+
+int libsmdev_read_ahead_update(
+     libsmdev_read_ahead_t *read_ahead,
+     off64_t offset,
+     size_t size );
+
+int libsmdev_read_ahead_set_window(
+     libsmdev_read_ahead_t *read_ahead,
+     int access_pattern,
+     libcerror_error_t **error );
+
+int libsmdev_read_ahead_drop_behind(
+     libsmdev_read_ahead_t *read_ahead,
+     off64_t offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_READ_AHEAD_H ) */
+
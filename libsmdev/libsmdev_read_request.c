@@ -0,0 +1,173 @@
+/*
+ * Read request functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+#include "libsmdev_read_request.h"
+
+/* Creates a read request
+ * Make sure the value read_request is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_read_request_initialize(
+     libsmdev_read_request_t **read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_read_request_initialize";
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_request != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read request value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*read_request = memory_allocate_structure(
+	                 libsmdev_read_request_t );
+
+	if( *read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read request.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_request,
+	     0,
+	     sizeof( libsmdev_read_request_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read request.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *read_request != NULL )
+	{
+		memory_free(
+		 *read_request );
+
+		*read_request = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read request
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_read_request_free(
+     libsmdev_read_request_t **read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_read_request_free";
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_request != NULL )
+	{
+		memory_free(
+		 *read_request );
+
+		*read_request = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two read request references
+ * The requests are ordered by descending priority, then by offset and then by the order they were appended
+ * This function is intended to be used with qsort
+ * Returns -1 if the first request is ordered before, 0 if equal or 1 if after the second request
+ */
+int libsmdev_read_request_compare(
+     const void *first_read_request,
+     const void *second_read_request )
+{
+	libsmdev_read_request_t *first_request  = NULL;
+	libsmdev_read_request_t *second_request = NULL;
+
+	first_request  = *( (libsmdev_read_request_t **) first_read_request );
+	second_request = *( (libsmdev_read_request_t **) second_read_request );
+
+	if( first_request->priority > second_request->priority )
+	{
+		return( -1 );
+	}
+	else if( first_request->priority < second_request->priority )
+	{
+		return( 1 );
+	}
+	if( first_request->offset < second_request->offset )
+	{
+		return( -1 );
+	}
+	else if( first_request->offset > second_request->offset )
+	{
+		return( 1 );
+	}
+	if( first_request->request_index < second_request->request_index )
+	{
+		return( -1 );
+	}
+	else if( first_request->request_index > second_request->request_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,72 @@
+/*
+ * Read request functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_READ_REQUEST_H )
+#define _LIBSMDEV_READ_REQUEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsmdev_read_request libsmdev_read_request_t;
+
+struct libsmdev_read_request
+{
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The priority
+	 */
+	int priority;
+
+	/* The index of the request in the order the requests were appended
+	 */
+	int request_index;
+};
+
+int libsmdev_read_request_initialize(
+     libsmdev_read_request_t **read_request,
+     libcerror_error_t **error );
+
+int libsmdev_read_request_free(
+     libsmdev_read_request_t **read_request,
+     libcerror_error_t **error );
+
+int libsmdev_read_request_compare(
+     const void *first_read_request,
+     const void *second_read_request );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_READ_REQUEST_H ) */
+
@@ -0,0 +1,678 @@
+/*
+ * Read scheduler functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libsmdev_handle.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcnotify.h"
+#include "libsmdev_read_request.h"
+#include "libsmdev_read_scheduler.h"
+
+/* Retrieves the read requests sorted in dispatch order
+ * The read requests are ordered by descending priority and then by offset
+ * The read requests in the sorted array are not managed by the array
+ * Returns 1 if successful, 0 if there are no read requests or -1 on error
+ */
+int libsmdev_read_scheduler_get_sorted_requests(
+     libcdata_array_t *read_requests_array,
+     libsmdev_read_request_t ***sorted_requests,
+     int *number_of_requests,
+     libcerror_error_t **error )
+{
+	libsmdev_read_request_t **safe_sorted_requests = NULL;
+	static char *function                          = "libsmdev_read_scheduler_get_sorted_requests";
+	int request_index                              = 0;
+	int safe_number_of_requests                    = 0;
+
+	if( sorted_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sorted_requests != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sorted requests value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     read_requests_array,
+	     &safe_number_of_requests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of read requests.",
+		 function );
+
+		goto on_error;
+	}
+	if( safe_number_of_requests == 0 )
+	{
+		*number_of_requests = 0;
+
+		return( 0 );
+	}
+	if( ( safe_number_of_requests < 0 )
+	 || ( (size_t) safe_number_of_requests > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libsmdev_read_request_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of read requests value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_sorted_requests = (libsmdev_read_request_t **) memory_allocate(
+	                                                     sizeof( libsmdev_read_request_t * ) * safe_number_of_requests );
+
+	if( safe_sorted_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted requests.",
+		 function );
+
+		goto on_error;
+	}
+	for( request_index = 0;
+	     request_index < safe_number_of_requests;
+	     request_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     read_requests_array,
+		     request_index,
+		     (intptr_t **) &( safe_sorted_requests[ request_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve read request: %d.",
+			 function,
+			 request_index );
+
+			goto on_error;
+		}
+		if( safe_sorted_requests[ request_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing read request: %d.",
+			 function,
+			 request_index );
+
+			goto on_error;
+		}
+	}
+	/* The requests are sorted at once since inserting them in order
+	 * would take quadratic time for large numbers of requests
+	 */
+	qsort(
+	 safe_sorted_requests,
+	 (size_t) safe_number_of_requests,
+	 sizeof( libsmdev_read_request_t * ),
+	 &libsmdev_read_request_compare );
+
+	*sorted_requests    = safe_sorted_requests;
+	*number_of_requests = safe_number_of_requests;
+
+	return( 1 );
+
+on_error:
+	if( safe_sorted_requests != NULL )
+	{
+		memory_free(
+		 safe_sorted_requests );
+	}
+	return( -1 );
+}
+
+/* Determines the extent of coalesced read requests that starts with a specific request
+ * Subsequent requests of the same priority are coalesced when the gap between them
+ * is not larger than the maximum gap size and the extent does not exceed the maximum extent size
+ * A request that exceeds the maximum extent size is an extent by itself
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_read_scheduler_get_extent(
+     libsmdev_read_request_t **sorted_requests,
+     int number_of_requests,
+     int first_request_index,
+     size_t maximum_gap_size,
+     int *number_of_extent_requests,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error )
+{
+	libsmdev_read_request_t *first_request = NULL;
+	libsmdev_read_request_t *read_request  = NULL;
+	static char *function                  = "libsmdev_read_scheduler_get_extent";
+	off64_t extent_end_offset              = 0;
+	off64_t request_end_offset             = 0;
+	int request_index                      = 0;
+
+	if( sorted_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_request_index < 0 )
+	 || ( first_request_index >= number_of_requests ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first request index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extent_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extent requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent size.",
+		 function );
+
+		return( -1 );
+	}
+	first_request     = sorted_requests[ first_request_index ];
+	extent_end_offset = first_request->offset + (off64_t) first_request->size;
+
+	if( first_request->size <= (size64_t) LIBSMDEV_READ_SCHEDULER_MAXIMUM_EXTENT_SIZE )
+	{
+		for( request_index = first_request_index + 1;
+		     request_index < number_of_requests;
+		     request_index++ )
+		{
+			read_request = sorted_requests[ request_index ];
+
+			if( read_request->priority != first_request->priority )
+			{
+				break;
+			}
+			/* The requests are sorted by offset hence the request cannot start before the extent
+			 */
+			if( ( read_request->offset > extent_end_offset )
+			 && ( (size64_t) ( read_request->offset - extent_end_offset ) > (size64_t) maximum_gap_size ) )
+			{
+				break;
+			}
+			request_end_offset = read_request->offset + (off64_t) read_request->size;
+
+			if( request_end_offset > extent_end_offset )
+			{
+				if( (size64_t) ( request_end_offset - first_request->offset ) > (size64_t) LIBSMDEV_READ_SCHEDULER_MAXIMUM_EXTENT_SIZE )
+				{
+					break;
+				}
+				extent_end_offset = request_end_offset;
+			}
+		}
+	}
+	else
+	{
+		request_index = first_request_index + 1;
+	}
+	*number_of_extent_requests = request_index - first_request_index;
+	*extent_offset             = first_request->offset;
+	*extent_size               = (size64_t) ( extent_end_offset - first_request->offset );
+
+	return( 1 );
+}
+
+/* Reads an extent of coalesced read requests and passes the data of each request to the read callback
+ * An extent that exceeds the buffer size, which only consists of a single request, is passed in parts
+ * The data is read by the handle, hence read errors are handled as by libsmdev_handle_read_buffer
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libsmdev_read_scheduler_read_extent(
+     libsmdev_internal_handle_t *internal_handle,
+     libsmdev_read_request_t **extent_requests,
+     int number_of_extent_requests,
+     off64_t extent_offset,
+     size64_t extent_size,
+     uint8_t *buffer,
+     size_t buffer_size,
+     int (*read_callback)(
+            void *callback_data,
+            int request_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libsmdev_read_request_t *read_request = NULL;
+	static char *function                 = "libsmdev_read_scheduler_read_extent";
+	size_t read_size                      = 0;
+	ssize_t read_count                    = 0;
+	int request_index                     = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extent_requests <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of extent requests value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_size > (size64_t) buffer_size )
+	 && ( number_of_extent_requests != 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent size value exceeds buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read callback.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading extent of %d requests at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIu64 "\n",
+		 function,
+		 number_of_extent_requests,
+		 extent_offset,
+		 extent_offset,
+		 extent_size );
+	}
+#endif
+	while( extent_size > 0 )
+	{
+		if( internal_handle->abort != 0 )
+		{
+			return( 0 );
+		}
+		read_size = buffer_size;
+
+		if( (size64_t) read_size > extent_size )
+		{
+			read_size = (size_t) extent_size;
+		}
+		read_count = libsmdev_handle_read_buffer_at_offset(
+		              (libsmdev_handle_t *) internal_handle,
+		              buffer,
+		              read_size,
+		              extent_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 extent_offset,
+			 extent_offset );
+
+			return( -1 );
+		}
+		if( (size_t) read_count != read_size )
+		{
+			if( internal_handle->abort != 0 )
+			{
+				return( 0 );
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 extent_offset,
+			 extent_offset );
+
+			return( -1 );
+		}
+		if( number_of_extent_requests == 1 )
+		{
+			if( read_callback(
+			     callback_data,
+			     extent_requests[ 0 ]->request_index,
+			     extent_offset,
+			     buffer,
+			     read_size ) != 1 )
+			{
+				return( 0 );
+			}
+		}
+		else
+		{
+			for( request_index = 0;
+			     request_index < number_of_extent_requests;
+			     request_index++ )
+			{
+				read_request = extent_requests[ request_index ];
+
+				if( read_callback(
+				     callback_data,
+				     read_request->request_index,
+				     read_request->offset,
+				     &( buffer[ read_request->offset - extent_offset ] ),
+				     (size_t) read_request->size ) != 1 )
+				{
+					return( 0 );
+				}
+			}
+		}
+		extent_offset += (off64_t) read_size;
+		extent_size   -= (size64_t) read_size;
+	}
+	return( 1 );
+}
+
+/* Reads the read requests in dispatch order and passes the data of each request to the read callback
+ * The read requests are dispatched by descending priority and then by offset, where requests
+ * of the same priority are coalesced into extents to replace seeks by sequential reads
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libsmdev_read_scheduler_read_requests(
+     libsmdev_internal_handle_t *internal_handle,
+     libcdata_array_t *read_requests_array,
+     size_t maximum_gap_size,
+     int (*read_callback)(
+            void *callback_data,
+            int request_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libsmdev_read_request_t **sorted_requests = NULL;
+	uint8_t *buffer                           = NULL;
+	static char *function                     = "libsmdev_read_scheduler_read_requests";
+	size64_t extent_size                      = 0;
+	off64_t extent_offset                     = 0;
+	int number_of_extent_requests             = 0;
+	int number_of_requests                    = 0;
+	int request_index                         = 0;
+	int result                                = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read callback.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsmdev_read_scheduler_get_sorted_requests(
+	          read_requests_array,
+	          &sorted_requests,
+	          &number_of_requests,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sorted read requests.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * LIBSMDEV_READ_SCHEDULER_MAXIMUM_EXTENT_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	result = 1;
+
+	while( request_index < number_of_requests )
+	{
+		if( libsmdev_read_scheduler_get_extent(
+		     sorted_requests,
+		     number_of_requests,
+		     request_index,
+		     maximum_gap_size,
+		     &number_of_extent_requests,
+		     &extent_offset,
+		     &extent_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent of read request: %d.",
+			 function,
+			 request_index );
+
+			goto on_error;
+		}
+		result = libsmdev_read_scheduler_read_extent(
+		          internal_handle,
+		          &( sorted_requests[ request_index ] ),
+		          number_of_extent_requests,
+		          extent_offset,
+		          extent_size,
+		          buffer,
+		          LIBSMDEV_READ_SCHEDULER_MAXIMUM_EXTENT_SIZE,
+		          read_callback,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extent at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 extent_offset,
+			 extent_offset );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		request_index += number_of_extent_requests;
+	}
+	memory_free(
+	 buffer );
+
+	memory_free(
+	 sorted_requests );
+
+	return( result );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( sorted_requests != NULL )
+	{
+		memory_free(
+		 sorted_requests );
+	}
+	return( -1 );
+}
+
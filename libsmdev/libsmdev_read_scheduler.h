@@ -0,0 +1,98 @@
+/*
+ * Read scheduler functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_READ_SCHEDULER_H )
+#define _LIBSMDEV_READ_SCHEDULER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_handle.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_read_request.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of an extent of coalesced read requests
+ * This is also the size of the data buffer of the read scheduler
+ */
+#define LIBSMDEV_READ_SCHEDULER_MAXIMUM_EXTENT_SIZE		8388608
+
+/* The default maximum size of a gap between read requests that is read instead of seeked over
+ * A seek on a hard disk drive takes about as long as reading 1 MiB sequentially
+ */
+#define LIBSMDEV_READ_SCHEDULER_DEFAULT_MAXIMUM_GAP_SIZE	1048576
+
+int libsmdev_read_scheduler_get_sorted_requests(
+     libcdata_array_t *read_requests_array,
+     libsmdev_read_request_t ***sorted_requests,
+     int *number_of_requests,
+     libcerror_error_t **error );
+
+int libsmdev_read_scheduler_get_extent(
+     libsmdev_read_request_t **sorted_requests,
+     int number_of_requests,
+     int first_request_index,
+     size_t maximum_gap_size,
+     int *number_of_extent_requests,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     libcerror_error_t **error );
+
+int libsmdev_read_scheduler_read_extent(
+     libsmdev_internal_handle_t *internal_handle,
+     libsmdev_read_request_t **extent_requests,
+     int number_of_extent_requests,
+     off64_t extent_offset,
+     size64_t extent_size,
+     uint8_t *buffer,
+     size_t buffer_size,
+     int (*read_callback)(
+            void *callback_data,
+            int request_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libsmdev_read_scheduler_read_requests(
+     libsmdev_internal_handle_t *internal_handle,
+     libcdata_array_t *read_requests_array,
+     size_t maximum_gap_size,
+     int (*read_callback)(
+            void *callback_data,
+            int request_index,
+            off64_t offset,
+            const uint8_t *data,
+            size_t data_size ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_READ_SCHEDULER_H ) */
+
@@ -0,0 +1,335 @@
+/*
+ * Read speed functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_read_speed.h"
+
+/* Creates a read speed
+ * Make sure the value read_speed is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_read_speed_initialize(
+     libsmdev_read_speed_t **read_speed,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_read_speed_initialize";
+
+	if( read_speed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read speed.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_speed != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read speed value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*read_speed = memory_allocate_structure(
+	               libsmdev_read_speed_t );
+
+	if( *read_speed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read speed.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_speed,
+	     0,
+	     sizeof( libsmdev_read_speed_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read speed.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_speed )->policy = LIBSMDEV_READ_SPEED_POLICY_FIXED;
+
+	return( 1 );
+
+on_error:
+	if( *read_speed != NULL )
+	{
+		memory_free(
+		 *read_speed );
+
+		*read_speed = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read speed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_read_speed_free(
+     libsmdev_read_speed_t **read_speed,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_read_speed_free";
+
+	if( read_speed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read speed.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_speed != NULL )
+	{
+		memory_free(
+		 *read_speed );
+
+		*read_speed = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets the read speed to the maximum speed and clears the statistics of the current window
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_read_speed_reset(
+     libsmdev_read_speed_t *read_speed,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_read_speed_reset";
+
+	if( read_speed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read speed.",
+		 function );
+
+		return( -1 );
+	}
+	read_speed->speed                   = read_speed->maximum_speed;
+	read_speed->number_of_sectors       = 0;
+	read_speed->number_of_error_sectors = 0;
+	read_speed->number_of_slow_sectors  = 0;
+	read_speed->number_of_clean_windows = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the transfer rate in kB/s of a speed
+ * Returns the transfer rate, where LIBSMDEV_READ_SPEED_MAXIMUM_TRANSFER_RATE represents the maximum speed of the drive
+ */
+uint16_t libsmdev_read_speed_get_transfer_rate(
+          uint16_t speed )
+{
+	uint32_t transfer_rate = 0;
+
+	if( speed == 0 )
+	{
+		return( LIBSMDEV_READ_SPEED_MAXIMUM_TRANSFER_RATE );
+	}
+	transfer_rate = (uint32_t) speed * LIBSMDEV_READ_SPEED_UNIT_TRANSFER_RATE;
+
+	if( transfer_rate >= (uint32_t) LIBSMDEV_READ_SPEED_MAXIMUM_TRANSFER_RATE )
+	{
+		return( LIBSMDEV_READ_SPEED_MAXIMUM_TRANSFER_RATE );
+	}
+	return( (uint16_t) transfer_rate );
+}
+
+/* Sets the maximum speed
+ * The maximum speed is a multiple of the 1x speed, where 0 represents the maximum speed of the drive
+ * The current speed is reset to the maximum speed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_read_speed_set_maximum_speed(
+     libsmdev_read_speed_t *read_speed,
+     uint16_t maximum_speed,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_read_speed_set_maximum_speed";
+
+	if( read_speed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read speed.",
+		 function );
+
+		return( -1 );
+	}
+	read_speed->maximum_speed = maximum_speed;
+	read_speed->speed_changed = 1;
+
+	if( libsmdev_read_speed_reset(
+	     read_speed,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reset read speed.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Updates the read speed with the result of a read
+ * A read is considered slow if the drive took longer than LIBSMDEV_READ_SPEED_SLOW_SECTOR_DURATION
+ * milli seconds per sector, which indicates the drive had to retry
+ *
+ * With the adaptive policy the speed is halved as soon as a sector could not be read, or at the end
+ * of a window in which too many sectors were read slowly. After a number of consecutive clean windows
+ * the speed is doubled again until the maximum speed is reached
+ *
+ * Returns 1 if the speed changed or 0 if not
+ */
+int libsmdev_read_speed_update(
+     libsmdev_read_speed_t *read_speed,
+     uint32_t number_of_sectors,
+     uint32_t number_of_error_sectors,
+     uint32_t duration )
+{
+	uint16_t speed = 0;
+
+	if( read_speed == NULL )
+	{
+		return( 0 );
+	}
+	if( ( read_speed->policy != LIBSMDEV_READ_SPEED_POLICY_ADAPTIVE )
+	 || ( read_speed->unsupported != 0 ) )
+	{
+		return( 0 );
+	}
+	if( number_of_error_sectors > number_of_sectors )
+	{
+		number_of_error_sectors = number_of_sectors;
+	}
+	read_speed->number_of_sectors       += number_of_sectors;
+	read_speed->number_of_error_sectors += number_of_error_sectors;
+
+	if( (uint64_t) duration > ( (uint64_t) number_of_sectors * LIBSMDEV_READ_SPEED_SLOW_SECTOR_DURATION ) )
+	{
+		read_speed->number_of_slow_sectors += number_of_sectors - number_of_error_sectors;
+	}
+	if( ( read_speed->number_of_error_sectors == 0 )
+	 && ( read_speed->number_of_sectors < LIBSMDEV_READ_SPEED_WINDOW_SIZE ) )
+	{
+		return( 0 );
+	}
+	speed = read_speed->speed;
+
+	if( ( read_speed->number_of_error_sectors > 0 )
+	 || ( read_speed->number_of_slow_sectors > ( read_speed->number_of_sectors / LIBSMDEV_READ_SPEED_SLOW_SECTOR_DIVISOR ) ) )
+	{
+		read_speed->number_of_clean_windows = 0;
+
+		if( speed == 0 )
+		{
+			speed = LIBSMDEV_READ_SPEED_INITIAL_REDUCED_SPEED;
+		}
+		else if( speed > 1 )
+		{
+			speed /= 2;
+		}
+	}
+	else if( read_speed->number_of_slow_sectors == 0 )
+	{
+		read_speed->number_of_clean_windows += 1;
+
+		if( ( read_speed->number_of_clean_windows >= LIBSMDEV_READ_SPEED_RECOVERY_THRESHOLD )
+		 && ( speed != read_speed->maximum_speed ) )
+		{
+			read_speed->number_of_clean_windows = 0;
+
+			speed *= 2;
+
+			if( ( read_speed->maximum_speed == 0 )
+			 && ( speed > LIBSMDEV_READ_SPEED_INITIAL_REDUCED_SPEED ) )
+			{
+				speed = 0;
+			}
+			else if( ( read_speed->maximum_speed != 0 )
+			      && ( speed > read_speed->maximum_speed ) )
+			{
+				speed = read_speed->maximum_speed;
+			}
+		}
+	}
+	else
+	{
+		read_speed->number_of_clean_windows = 0;
+	}
+	/* The reduced speed never exceeds the maximum speed
+	 */
+	if( ( read_speed->maximum_speed != 0 )
+	 && ( ( speed == 0 )
+	  ||  ( speed > read_speed->maximum_speed ) ) )
+	{
+		speed = read_speed->maximum_speed;
+	}
+	read_speed->number_of_sectors       = 0;
+	read_speed->number_of_error_sectors = 0;
+	read_speed->number_of_slow_sectors  = 0;
+
+	if( speed == read_speed->speed )
+	{
+		return( 0 );
+	}
+	read_speed->speed         = speed;
+	read_speed->speed_changed = 1;
+
+	return( 1 );
+}
+
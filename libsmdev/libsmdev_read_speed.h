@@ -0,0 +1,142 @@
+/*
+ * Read speed functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBSMDEV_READ_SPEED_H )
+#define _LIBSMDEV_READ_SPEED_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The transfer rate of a 1x speed CD in kB/s
+ */
+#define LIBSMDEV_READ_SPEED_UNIT_TRANSFER_RATE		176
+
+/* The transfer rate in kB/s that represents the maximum speed of the drive
+ */
+#define LIBSMDEV_READ_SPEED_MAXIMUM_TRANSFER_RATE	0xffff
+
+/* The number of sectors over which the error and slow sector rates are determined
+ */
+#define LIBSMDEV_READ_SPEED_WINDOW_SIZE			2048
+
+/* The duration of reading a sector in milli seconds above which the sector is considered slow
+ * A 1x speed CD drive reads a sector in about 13 milli seconds, a drive that takes longer is retrying
+ */
+#define LIBSMDEV_READ_SPEED_SLOW_SECTOR_DURATION	20
+
+/* The divisor of the window size that determines the number of slow sectors that causes down-clocking
+ */
+#define LIBSMDEV_READ_SPEED_SLOW_SECTOR_DIVISOR		8
+
+/* The number of consecutive clean windows that is needed to increase the speed
+ */
+#define LIBSMDEV_READ_SPEED_RECOVERY_THRESHOLD		4
+
+/* The speed that is used when down-clocking from the maximum speed of the drive
+ */
+#define LIBSMDEV_READ_SPEED_INITIAL_REDUCED_SPEED	16
+
+typedef struct libsmdev_read_speed libsmdev_read_speed_t;
+
+struct libsmdev_read_speed
+{
+	/* The policy
+	 */
+	int policy;
+
+	/* The maximum speed as a multiple of the 1x speed
+	 * Contains 0 for the maximum speed of the drive
+	 */
+	uint16_t maximum_speed;
+
+	/* The current speed as a multiple of the 1x speed
+	 * Contains 0 for the maximum speed of the drive
+	 */
+	uint16_t speed;
+
+	/* Value to indicate the speed must be applied to the drive
+	 */
+	uint8_t speed_changed;
+
+	/* Value to indicate the speed of the drive was changed and has to be restored
+	 */
+	uint8_t drive_speed_set;
+
+	/* Value to indicate the drive does not support speed control
+	 */
+	uint8_t unsupported;
+
+	/* The number of sectors read in the current window
+	 */
+	uint32_t number_of_sectors;
+
+	/* The number of sectors that could not be read in the current window
+	 */
+	uint32_t number_of_error_sectors;
+
+	/* The number of sectors that were read slowly in the current window
+	 */
+	uint32_t number_of_slow_sectors;
+
+	/* The number of consecutive windows without errors or slow sectors
+	 */
+	int number_of_clean_windows;
+};
+
+int libsmdev_read_speed_initialize(
+     libsmdev_read_speed_t **read_speed,
+     libcerror_error_t **error );
+
+int libsmdev_read_speed_free(
+     libsmdev_read_speed_t **read_speed,
+     libcerror_error_t **error );
+
+int libsmdev_read_speed_reset(
+     libsmdev_read_speed_t *read_speed,
+     libcerror_error_t **error );
+
+uint16_t libsmdev_read_speed_get_transfer_rate(
+          uint16_t speed );
+
+int libsmdev_read_speed_set_maximum_speed(
+     libsmdev_read_speed_t *read_speed,
+     uint16_t maximum_speed,
+     libcerror_error_t **error );
+
+int libsmdev_read_speed_update(
+     libsmdev_read_speed_t *read_speed,
+     uint32_t number_of_sectors,
+     uint32_t number_of_error_sectors,
+     uint32_t duration );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_READ_SPEED_H ) */
+
@@ -0,0 +1,363 @@
+/*
+ * Sample region functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+#include "libsmdev_sample_region.h"
+
+/* Creates a sample region
+ * Make sure the value sample_region is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sample_region_initialize(
+     libsmdev_sample_region_t **sample_region,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sample_region_initialize";
+
+	if( sample_region == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sample region.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sample_region != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sample region value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*sample_region = memory_allocate_structure(
+	                  libsmdev_sample_region_t );
+
+	if( *sample_region == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sample region.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sample_region,
+	     0,
+	     sizeof( libsmdev_sample_region_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sample region.",
+		 function );
+
+		goto on_error;
+	}
+	( *sample_region )->offset = offset;
+	( *sample_region )->size   = size;
+
+	return( 1 );
+
+on_error:
+	if( *sample_region != NULL )
+	{
+		memory_free(
+		 *sample_region );
+
+		*sample_region = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a sample region
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sample_region_free(
+     libsmdev_sample_region_t **sample_region,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sample_region_free";
+
+	if( sample_region == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sample region.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sample_region != NULL )
+	{
+		memory_free(
+		 *sample_region );
+
+		*sample_region = NULL;
+	}
+	return( 1 );
+}
+
+/* Adds the statistics of another sample region to the sample region
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sample_region_merge(
+     libsmdev_sample_region_t *sample_region,
+     libsmdev_sample_region_t *other_sample_region,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sample_region_merge";
+	int byte_value        = 0;
+
+	if( sample_region == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sample region.",
+		 function );
+
+		return( -1 );
+	}
+	if( other_sample_region == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid other sample region.",
+		 function );
+
+		return( -1 );
+	}
+	sample_region->number_of_samples              += other_sample_region->number_of_samples;
+	sample_region->number_of_unreadable_samples   += other_sample_region->number_of_unreadable_samples;
+	sample_region->number_of_sectors              += other_sample_region->number_of_sectors;
+	sample_region->number_of_zero_sectors         += other_sample_region->number_of_zero_sectors;
+	sample_region->number_of_high_entropy_samples += other_sample_region->number_of_high_entropy_samples;
+
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		sample_region->byte_counts[ byte_value ] += other_sample_region->byte_counts[ byte_value ];
+	}
+	return( 1 );
+}
+
+/* Calculates the base 2 logarithm of a value
+ * The value is split in a power of 2 and a mantissa in the range [1, 2)
+ * of which the logarithm is approximated by its series expansion,
+ * which is accurate to within 1e-7 and does not require the math library
+ * Returns the base 2 logarithm or 0.0 if the value is 0
+ */
+double libsmdev_sample_region_log2(
+        uint64_t value )
+{
+	double mantissa = 0.0;
+	double square   = 0.0;
+	double term     = 0.0;
+	int exponent    = 0;
+
+	if( value == 0 )
+	{
+		return( 0.0 );
+	}
+	while( ( value >> exponent ) > 1 )
+	{
+		exponent++;
+	}
+	mantissa = (double) value / (double) ( (uint64_t) 1 << exponent );
+
+	/* log2( mantissa ) = 2 / ln( 2 ) * atanh( term ) with term in the range [0, 1/3)
+	 */
+	term   = ( mantissa - 1.0 ) / ( mantissa + 1.0 );
+	square = term * term;
+
+	term *= 1.0 + square * ( 1.0 / 3.0
+	            + square * ( 1.0 / 5.0
+	            + square * ( 1.0 / 7.0
+	            + square * ( 1.0 / 9.0
+	            + square * ( 1.0 / 11.0 ) ) ) ) );
+
+	return( (double) exponent + ( 2.0 * term / 0.69314718055994530942 ) );
+}
+
+/* Calculates the Shannon entropy of data from the occurrences of its byte values
+ * Returns the entropy in bits per byte, in the range [0.0, 8.0]
+ */
+double libsmdev_sample_region_calculate_entropy(
+        const uint64_t *byte_counts,
+        uint64_t number_of_bytes )
+{
+	double entropy = 0.0;
+	int byte_value = 0;
+
+	if( ( byte_counts == NULL )
+	 || ( number_of_bytes == 0 ) )
+	{
+		return( 0.0 );
+	}
+	/* entropy = log2( n ) - sum( count * log2( count ) ) / n
+	 */
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		if( byte_counts[ byte_value ] > 1 )
+		{
+			entropy += (double) byte_counts[ byte_value ] * libsmdev_sample_region_log2(
+			                                                 byte_counts[ byte_value ] );
+		}
+	}
+	entropy = libsmdev_sample_region_log2(
+	           number_of_bytes ) - ( entropy / (double) number_of_bytes );
+
+	/* Compensate for rounding of the approximation
+	 */
+	if( entropy < 0.0 )
+	{
+		entropy = 0.0;
+	}
+	else if( entropy > 8.0 )
+	{
+		entropy = 8.0;
+	}
+	return( entropy );
+}
+
+/* Retrieves the statistics of the sample region
+ * The zero fraction is the fraction of the sampled sectors that only contain zero bytes,
+ * the high entropy fraction is the fraction of samples that are likely encrypted or compressed
+ * and the entropy is calculated over all the sampled bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sample_region_get_statistics(
+     libsmdev_sample_region_t *sample_region,
+     double *zero_fraction,
+     double *high_entropy_fraction,
+     double *entropy,
+     libcerror_error_t **error )
+{
+	static char *function    = "libsmdev_sample_region_get_statistics";
+	uint64_t number_of_bytes = 0;
+	int byte_value           = 0;
+
+	if( sample_region == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sample region.",
+		 function );
+
+		return( -1 );
+	}
+	if( zero_fraction == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid zero fraction.",
+		 function );
+
+		return( -1 );
+	}
+	if( high_entropy_fraction == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid high entropy fraction.",
+		 function );
+
+		return( -1 );
+	}
+	if( entropy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy.",
+		 function );
+
+		return( -1 );
+	}
+	*zero_fraction         = 0.0;
+	*high_entropy_fraction = 0.0;
+
+	if( sample_region->number_of_sectors > 0 )
+	{
+		*zero_fraction = (double) sample_region->number_of_zero_sectors
+		               / (double) sample_region->number_of_sectors;
+	}
+	if( sample_region->number_of_samples > 0 )
+	{
+		*high_entropy_fraction = (double) sample_region->number_of_high_entropy_samples
+		                       / (double) sample_region->number_of_samples;
+	}
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		number_of_bytes += sample_region->byte_counts[ byte_value ];
+	}
+	*entropy = libsmdev_sample_region_calculate_entropy(
+	            sample_region->byte_counts,
+	            number_of_bytes );
+
+	return( 1 );
+}
+
@@ -0,0 +1,105 @@
+/*
+ * Sample region functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_SAMPLE_REGION_H )
+#define _LIBSMDEV_SAMPLE_REGION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libsmdev_sample_region libsmdev_sample_region_t;
+
+struct libsmdev_sample_region
+{
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The number of samples that were read
+	 */
+	uint64_t number_of_samples;
+
+	/* The number of samples that could not be read
+	 */
+	uint64_t number_of_unreadable_samples;
+
+	/* The number of sectors of the samples that were read
+	 */
+	uint64_t number_of_sectors;
+
+	/* The number of sectors that only contain zero bytes
+	 */
+	uint64_t number_of_zero_sectors;
+
+	/* The number of samples of which the data has a high entropy
+	 */
+	uint64_t number_of_high_entropy_samples;
+
+	/* The number of occurrences of every byte value
+	 */
+	uint64_t byte_counts[ 256 ];
+};
+
+int libsmdev_sample_region_initialize(
+     libsmdev_sample_region_t **sample_region,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libsmdev_sample_region_free(
+     libsmdev_sample_region_t **sample_region,
+     libcerror_error_t **error );
+
+int libsmdev_sample_region_merge(
+     libsmdev_sample_region_t *sample_region,
+     libsmdev_sample_region_t *other_sample_region,
+     libcerror_error_t **error );
+
+double libsmdev_sample_region_log2(
+        uint64_t value );
+
+double libsmdev_sample_region_calculate_entropy(
+        const uint64_t *byte_counts,
+        uint64_t number_of_bytes );
+
+int libsmdev_sample_region_get_statistics(
+     libsmdev_sample_region_t *sample_region,
+     double *zero_fraction,
+     double *high_entropy_fraction,
+     double *entropy,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_SAMPLE_REGION_H ) */
+
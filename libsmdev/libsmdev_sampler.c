@@ -0,0 +1,1444 @@
+/*
+ * Sampler functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcnotify.h"
+#include "libsmdev_libcthreads.h"
+#include "libsmdev_sample_region.h"
+#include "libsmdev_sampler.h"
+#include "libsmdev_write_engine.h"
+
+/* Creates a worker
+ * Make sure the value worker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sampler_worker_initialize(
+     libsmdev_sampler_worker_t **worker,
+     libsmdev_sampler_t *sampler,
+     libsmdev_io_backend_t *io_backend,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sampler_worker_initialize";
+	off64_t region_offset = 0;
+	size64_t region_size  = 0;
+	int region_index      = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *worker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid worker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sampler.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	*worker = memory_allocate_structure(
+	           libsmdev_sampler_worker_t );
+
+	if( *worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create worker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *worker,
+	     0,
+	     sizeof( libsmdev_sampler_worker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear worker.",
+		 function );
+
+		memory_free(
+		 *worker );
+
+		*worker = NULL;
+
+		return( -1 );
+	}
+	( *worker )->sampler    = sampler;
+	( *worker )->io_backend = io_backend;
+
+	( *worker )->data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * sampler->sample_size );
+
+	if( ( *worker )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *worker )->regions = (libsmdev_sample_region_t **) memory_allocate(
+	                                                      sizeof( libsmdev_sample_region_t * ) * sampler->number_of_regions );
+
+	if( ( *worker )->regions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create regions.",
+		 function );
+
+		goto on_error;
+	}
+	for( region_index = 0;
+	     region_index < sampler->number_of_regions;
+	     region_index++ )
+	{
+		( *worker )->regions[ region_index ] = NULL;
+	}
+	for( region_index = 0;
+	     region_index < sampler->number_of_regions;
+	     region_index++ )
+	{
+		region_offset = (off64_t) ( sampler->region_size * region_index );
+		region_size   = sampler->region_size;
+
+		if( region_size > ( sampler->media_size - (size64_t) region_offset ) )
+		{
+			region_size = sampler->media_size - (size64_t) region_offset;
+		}
+		if( libsmdev_sample_region_initialize(
+		     &( ( *worker )->regions[ region_index ] ),
+		     region_offset,
+		     region_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create region: %d.",
+			 function,
+			 region_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *worker != NULL )
+	{
+		libsmdev_sampler_worker_free(
+		 worker,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a worker
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sampler_worker_free(
+     libsmdev_sampler_worker_t **worker,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sampler_worker_free";
+	int region_index      = 0;
+	int result            = 1;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *worker != NULL )
+	{
+		if( ( *worker )->regions != NULL )
+		{
+			for( region_index = 0;
+			     region_index < ( *worker )->sampler->number_of_regions;
+			     region_index++ )
+			{
+				if( libsmdev_sample_region_free(
+				     &( ( *worker )->regions[ region_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free region: %d.",
+					 function,
+					 region_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *worker )->regions );
+		}
+		if( ( *worker )->data != NULL )
+		{
+			memory_free(
+			 ( *worker )->data );
+		}
+		memory_free(
+		 *worker );
+
+		*worker = NULL;
+	}
+	return( result );
+}
+
+/* Creates a sampler
+ * Make sure the value sampler is referencing, is set to NULL
+ * Every IO backend is used by a separate worker and must be opened for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sampler_initialize(
+     libsmdev_sampler_t **sampler,
+     int sampling_method,
+     size64_t media_size,
+     size_t bytes_per_sector,
+     size_t sample_size,
+     int number_of_samples,
+     int number_of_regions,
+     libsmdev_io_backend_t **io_backends,
+     int number_of_io_backends,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sampler_initialize";
+	int worker_index      = 0;
+
+	if( sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sampler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sampler != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sampler value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sampling_method != LIBSMDEV_SAMPLING_METHOD_RANDOM )
+	 && ( sampling_method != LIBSMDEV_SAMPLING_METHOD_STRATIFIED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sampling method.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( media_size == 0 )
+	 || ( media_size > (size64_t) INT64_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid media size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bytes_per_sector == 0 )
+	 || ( bytes_per_sector > (size_t) LIBSMDEV_SAMPLER_MAXIMUM_SAMPLE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sample_size < bytes_per_sector )
+	 || ( sample_size > (size_t) LIBSMDEV_SAMPLER_MAXIMUM_SAMPLE_SIZE )
+	 || ( ( sample_size % bytes_per_sector ) != 0 )
+	 || ( (size64_t) sample_size > media_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sample size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_samples <= 0 )
+	 || ( number_of_samples > LIBSMDEV_SAMPLER_MAXIMUM_NUMBER_OF_SAMPLES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of samples value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_regions <= 0 )
+	 || ( number_of_regions > LIBSMDEV_SAMPLER_MAXIMUM_NUMBER_OF_REGIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of regions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backends == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backends.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_io_backends <= 0 )
+	 || ( number_of_io_backends > LIBSMDEV_SAMPLER_MAXIMUM_NUMBER_OF_WORKERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of IO backends value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_io_backends != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: multiple workers require multi-threading support.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*sampler = memory_allocate_structure(
+	            libsmdev_sampler_t );
+
+	if( *sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sampler.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sampler,
+	     0,
+	     sizeof( libsmdev_sampler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sampler.",
+		 function );
+
+		memory_free(
+		 *sampler );
+
+		*sampler = NULL;
+
+		return( -1 );
+	}
+	( *sampler )->sampling_method   = sampling_method;
+	( *sampler )->media_size        = media_size;
+	( *sampler )->bytes_per_sector  = bytes_per_sector;
+	( *sampler )->sample_size       = sample_size;
+	( *sampler )->number_of_samples = number_of_samples;
+	( *sampler )->number_of_workers = number_of_io_backends;
+
+	/* The regions are sector aligned and the last region can be smaller
+	 */
+	( *sampler )->region_size = media_size / number_of_regions;
+
+	if( ( media_size % number_of_regions ) != 0 )
+	{
+		( *sampler )->region_size += 1;
+	}
+	if( ( ( *sampler )->region_size % bytes_per_sector ) != 0 )
+	{
+		( *sampler )->region_size += bytes_per_sector - ( ( *sampler )->region_size % bytes_per_sector );
+	}
+	( *sampler )->number_of_regions = (int) ( media_size / ( *sampler )->region_size );
+
+	if( ( media_size % ( *sampler )->region_size ) != 0 )
+	{
+		( *sampler )->number_of_regions += 1;
+	}
+	/* The entropy of a limited number of random bytes is on average lower than 8 bits per byte
+	 * by approximately 255 / ( 2 * number of bytes * ln( 2 ) ) bits per byte
+	 */
+	( *sampler )->high_entropy_threshold = LIBSMDEV_SAMPLER_HIGH_ENTROPY_THRESHOLD
+	                                     - ( 255.0 / ( 2.0 * (double) sample_size * 0.69314718055994530942 ) );
+
+	( *sampler )->sample_offsets = (off64_t *) memory_allocate(
+	                                            sizeof( off64_t ) * number_of_samples );
+
+	if( ( *sampler )->sample_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sample offsets.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_sampler_select_samples(
+	     *sampler,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to select samples.",
+		 function );
+
+		goto on_error;
+	}
+	( *sampler )->workers = (libsmdev_sampler_worker_t **) memory_allocate(
+	                         sizeof( libsmdev_sampler_worker_t * ) * number_of_io_backends );
+
+	if( ( *sampler )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_io_backends;
+	     worker_index++ )
+	{
+		( *sampler )->workers[ worker_index ] = NULL;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_io_backends;
+	     worker_index++ )
+	{
+		if( libsmdev_sampler_worker_initialize(
+		     &( ( *sampler )->workers[ worker_index ] ),
+		     *sampler,
+		     io_backends[ worker_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *sampler )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *sampler != NULL )
+	{
+		libsmdev_sampler_free(
+		 sampler,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a sampler
+ * The IO backends of the workers are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sampler_free(
+     libsmdev_sampler_t **sampler,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sampler_free";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sampler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sampler != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *sampler )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *sampler )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *sampler )->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *sampler )->number_of_workers;
+			     worker_index++ )
+			{
+				if( libsmdev_sampler_worker_free(
+				     &( ( *sampler )->workers[ worker_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *sampler )->workers );
+		}
+		if( ( *sampler )->sample_offsets != NULL )
+		{
+			memory_free(
+			 ( *sampler )->sample_offsets );
+		}
+		memory_free(
+		 *sampler );
+
+		*sampler = NULL;
+	}
+	return( result );
+}
+
+/* Signals the sampler to abort
+ * Samples that are being read are completed first
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sampler_signal_abort(
+     libsmdev_sampler_t *sampler,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sampler_signal_abort";
+
+	if( sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sampler.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     sampler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	sampler->abort = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     sampler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the next value of a xorshift64* pseudo random number generator
+ * The generator is used so that the same media is sampled at the same offsets every run
+ * Returns the pseudo random value
+ */
+uint64_t libsmdev_sampler_get_random_value(
+          uint64_t *random_state )
+{
+	uint64_t value = 0;
+
+	if( random_state == NULL )
+	{
+		return( 0 );
+	}
+	value = *random_state;
+
+	value ^= value >> 12;
+	value ^= value << 25;
+	value ^= value >> 27;
+
+	*random_state = value;
+
+	return( value * 0x2545f4914f6cdd1dUL );
+}
+
+/* Compares two sample offsets
+ * This function is intended to be used with qsort
+ * Returns -1 if the first offset is smaller, 0 if equal or 1 if larger than the second offset
+ */
+int libsmdev_sampler_compare_offsets(
+     const void *first_offset,
+     const void *second_offset )
+{
+	off64_t first_value  = *( (off64_t *) first_offset );
+	off64_t second_value = *( (off64_t *) second_offset );
+
+	if( first_value < second_value )
+	{
+		return( -1 );
+	}
+	else if( first_value > second_value )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Selects the offsets of the samples
+ * The samples are sector aligned and are either chosen at random over the whole media
+ * or at random within equally sized strata, one sample per stratum
+ * The offsets are sorted so that the media is read in ascending order
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sampler_select_samples(
+     libsmdev_sampler_t *sampler,
+     libcerror_error_t **error )
+{
+	static char *function        = "libsmdev_sampler_select_samples";
+	uint64_t number_of_positions = 0;
+	uint64_t position            = 0;
+	uint64_t random_state        = 0;
+	uint64_t stratum_end         = 0;
+	uint64_t stratum_start       = 0;
+	int sample_index             = 0;
+
+	if( sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sampler.",
+		 function );
+
+		return( -1 );
+	}
+	if( sampler->sample_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sampler - missing sample offsets.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_positions = ( ( sampler->media_size - sampler->sample_size ) / sampler->bytes_per_sector ) + 1;
+
+	/* Every stratum must contain at least one position
+	 */
+	if( ( sampler->sampling_method == LIBSMDEV_SAMPLING_METHOD_STRATIFIED )
+	 && ( (uint64_t) sampler->number_of_samples > number_of_positions ) )
+	{
+		sampler->number_of_samples = (int) number_of_positions;
+	}
+	random_state = sampler->media_size ^ 0x9e3779b97f4a7c15UL;
+
+	for( sample_index = 0;
+	     sample_index < sampler->number_of_samples;
+	     sample_index++ )
+	{
+		if( sampler->sampling_method == LIBSMDEV_SAMPLING_METHOD_RANDOM )
+		{
+			position = libsmdev_sampler_get_random_value(
+			            &random_state ) % number_of_positions;
+		}
+		else
+		{
+			/* The strata are calculated in a way that cannot overflow
+			 */
+			stratum_start = ( ( number_of_positions / sampler->number_of_samples ) * sample_index )
+			              + ( ( ( number_of_positions % sampler->number_of_samples ) * sample_index ) / sampler->number_of_samples );
+			stratum_end   = ( ( number_of_positions / sampler->number_of_samples ) * ( sample_index + 1 ) )
+			              + ( ( ( number_of_positions % sampler->number_of_samples ) * ( sample_index + 1 ) ) / sampler->number_of_samples );
+
+			position = stratum_start + ( libsmdev_sampler_get_random_value(
+			                              &random_state ) % ( stratum_end - stratum_start ) );
+		}
+		sampler->sample_offsets[ sample_index ] = (off64_t) ( position * sampler->bytes_per_sector );
+	}
+	if( sampler->sampling_method == LIBSMDEV_SAMPLING_METHOD_RANDOM )
+	{
+		qsort(
+		 sampler->sample_offsets,
+		 (size_t) sampler->number_of_samples,
+		 sizeof( off64_t ),
+		 &libsmdev_sampler_compare_offsets );
+	}
+	return( 1 );
+}
+
+/* Counts the occurrences of every byte value in the data
+ * The counts are added to the byte counts, which must contain 256 values
+ * The bytes are counted in 4 interleaved tables to break the dependency between
+ * successive increments of the same count, which otherwise limits the throughput
+ */
+void libsmdev_sampler_count_bytes(
+      const uint8_t *data,
+      size_t data_size,
+      uint64_t *byte_counts )
+{
+	uint32_t interleaved_byte_counts[ 4 ][ 256 ];
+
+	size_t data_offset = 0;
+	int byte_value     = 0;
+
+	if( ( data == NULL )
+	 || ( data_size > (size_t) UINT32_MAX )
+	 || ( byte_counts == NULL ) )
+	{
+		return;
+	}
+	memory_set(
+	 interleaved_byte_counts,
+	 0,
+	 sizeof( uint32_t ) * 4 * 256 );
+
+	while( ( data_size - data_offset ) >= 4 )
+	{
+		interleaved_byte_counts[ 0 ][ data[ data_offset ] ]     += 1;
+		interleaved_byte_counts[ 1 ][ data[ data_offset + 1 ] ] += 1;
+		interleaved_byte_counts[ 2 ][ data[ data_offset + 2 ] ] += 1;
+		interleaved_byte_counts[ 3 ][ data[ data_offset + 3 ] ] += 1;
+
+		data_offset += 4;
+	}
+	while( data_offset < data_size )
+	{
+		interleaved_byte_counts[ 0 ][ data[ data_offset ] ] += 1;
+
+		data_offset++;
+	}
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		byte_counts[ byte_value ] += (uint64_t) interleaved_byte_counts[ 0 ][ byte_value ]
+		                           + (uint64_t) interleaved_byte_counts[ 1 ][ byte_value ]
+		                           + (uint64_t) interleaved_byte_counts[ 2 ][ byte_value ]
+		                           + (uint64_t) interleaved_byte_counts[ 3 ][ byte_value ];
+	}
+}
+
+/* Reads a sample and adds its statistics to the region that contains the start of the sample
+ * A sample that cannot be read is counted as unreadable
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sampler_process_sample(
+     libsmdev_sampler_worker_t *worker,
+     off64_t sample_offset,
+     libcerror_error_t **error )
+{
+	libsmdev_sample_region_t *region = NULL;
+	libsmdev_sampler_t *sampler      = NULL;
+	static char *function            = "libsmdev_sampler_process_sample";
+	size_t run_offset                = 0;
+	size_t run_size                  = 0;
+	size_t sector_offset             = 0;
+	ssize_t read_count               = 0;
+	double entropy                   = 0.0;
+	uint64_t number_of_zero_sectors  = 0;
+	uint32_t error_code              = 0;
+	int byte_value                   = 0;
+	int region_index                 = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	sampler = worker->sampler;
+
+	if( ( sample_offset < 0 )
+	 || ( (size64_t) sample_offset >= sampler->media_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sample offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	region_index = (int) ( (size64_t) sample_offset / sampler->region_size );
+	region       = worker->regions[ region_index ];
+
+	read_count = libsmdev_io_backend_read_buffer_at_offset(
+	              worker->io_backend,
+	              worker->data,
+	              sampler->sample_size,
+	              sample_offset,
+	              &error_code,
+	              error );
+
+	if( read_count != (ssize_t) sampler->sample_size )
+	{
+		if( read_count != -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of device at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 sample_offset,
+			 sample_offset );
+
+			return( -1 );
+		}
+		if( libsmdev_write_engine_error_code_is_recoverable(
+		     error_code ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sample at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 sample_offset,
+			 sample_offset );
+
+			return( -1 );
+		}
+		libcerror_error_free(
+		 error );
+
+		region->number_of_unreadable_samples += 1;
+
+		return( 1 );
+	}
+	if( memory_set(
+	     worker->byte_counts,
+	     0,
+	     sizeof( uint64_t ) * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear byte counts.",
+		 function );
+
+		return( -1 );
+	}
+	/* Sectors that only contain zero bytes are counted without a histogram pass,
+	 * the other sectors are counted in runs
+	 */
+	for( sector_offset = 0;
+	     sector_offset < sampler->sample_size;
+	     sector_offset += sampler->bytes_per_sector )
+	{
+		if( libsmdev_write_engine_data_is_zero(
+		     &( worker->data[ sector_offset ] ),
+		     sampler->bytes_per_sector ) != 0 )
+		{
+			if( run_size > 0 )
+			{
+				libsmdev_sampler_count_bytes(
+				 &( worker->data[ run_offset ] ),
+				 run_size,
+				 worker->byte_counts );
+
+				run_size = 0;
+			}
+			worker->byte_counts[ 0 ] += sampler->bytes_per_sector;
+
+			number_of_zero_sectors++;
+		}
+		else
+		{
+			if( run_size == 0 )
+			{
+				run_offset = sector_offset;
+			}
+			run_size += sampler->bytes_per_sector;
+		}
+	}
+	if( run_size > 0 )
+	{
+		libsmdev_sampler_count_bytes(
+		 &( worker->data[ run_offset ] ),
+		 run_size,
+		 worker->byte_counts );
+	}
+	entropy = libsmdev_sample_region_calculate_entropy(
+	           worker->byte_counts,
+	           (uint64_t) sampler->sample_size );
+
+	if( entropy >= sampler->high_entropy_threshold )
+	{
+		region->number_of_high_entropy_samples += 1;
+	}
+	region->number_of_samples      += 1;
+	region->number_of_sectors      += sampler->sample_size / sampler->bytes_per_sector;
+	region->number_of_zero_sectors += number_of_zero_sectors;
+
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		region->byte_counts[ byte_value ] += worker->byte_counts[ byte_value ];
+	}
+	return( 1 );
+}
+
+/* Reads samples until all samples are read or the sampler is aborted
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sampler_process_samples(
+     libsmdev_sampler_worker_t *worker,
+     libcerror_error_t **error )
+{
+	libsmdev_sampler_t *sampler = NULL;
+	static char *function       = "libsmdev_sampler_process_samples";
+	int result                  = 0;
+	int sample_index            = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	sampler = worker->sampler;
+
+	do
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     sampler->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		sample_index = sampler->next_sample_index;
+
+		if( ( sampler->abort == 0 )
+		 && ( sampler->failed == 0 )
+		 && ( sample_index < sampler->number_of_samples ) )
+		{
+			sampler->next_sample_index += 1;
+
+			result = 1;
+		}
+		else
+		{
+			result = 0;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     sampler->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == 0 )
+		{
+			break;
+		}
+		if( libsmdev_sampler_process_sample(
+		     worker,
+		     sampler->sample_offsets[ sample_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process sample: %d.",
+			 function,
+			 sample_index );
+
+			goto on_error;
+		}
+	}
+	while( result == 1 );
+
+	return( 1 );
+
+on_error:
+	/* Signal the other workers to stop
+	 */
+	sampler->failed = 1;
+
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The worker thread callback
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sampler_worker_callback(
+     libsmdev_sampler_worker_t *worker )
+{
+	libcerror_error_t *error = NULL;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	if( libsmdev_sampler_process_samples(
+	     worker,
+	     &error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Reads the samples using all workers
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libsmdev_sampler_run(
+     libsmdev_sampler_t *sampler,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sampler_run";
+	int result            = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libsmdev_sampler_worker_t *worker = NULL;
+	int worker_index                  = 0;
+#endif
+
+	if( sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sampler.",
+		 function );
+
+		return( -1 );
+	}
+	sampler->next_sample_index = 0;
+	sampler->failed            = 0;
+
+	if( sampler->number_of_workers == 1 )
+	{
+		result = libsmdev_sampler_process_samples(
+		          sampler->workers[ 0 ],
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process samples.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	else
+	{
+		for( worker_index = 0;
+		     worker_index < sampler->number_of_workers;
+		     worker_index++ )
+		{
+			worker = sampler->workers[ worker_index ];
+
+			if( libcthreads_thread_create(
+			     &( worker->thread ),
+			     NULL,
+			     (int (*)(void *)) &libsmdev_sampler_worker_callback,
+			     (void *) worker,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread of worker: %d.",
+				 function,
+				 worker_index );
+
+				/* Stop the workers that were already started
+				 */
+				sampler->failed = 1;
+
+				result = -1;
+
+				break;
+			}
+		}
+		for( worker_index = 0;
+		     worker_index < sampler->number_of_workers;
+		     worker_index++ )
+		{
+			worker = sampler->workers[ worker_index ];
+
+			if( worker->thread != NULL )
+			{
+				if( libcthreads_thread_join(
+				     &( worker->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join thread of worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+		if( sampler->failed != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process samples.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( sampler->abort != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the statistics of the regions
+ * The statistics gathered by the workers are combined into a new sample region per region,
+ * which is appended to the regions array
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sampler_get_regions(
+     libsmdev_sampler_t *sampler,
+     libcdata_array_t *regions_array,
+     libcerror_error_t **error )
+{
+	libsmdev_sample_region_t *region = NULL;
+	static char *function            = "libsmdev_sampler_get_regions";
+	int entry_index                  = 0;
+	int region_index                 = 0;
+	int worker_index                 = 0;
+
+	if( sampler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sampler.",
+		 function );
+
+		return( -1 );
+	}
+	if( regions_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid regions array.",
+		 function );
+
+		return( -1 );
+	}
+	for( region_index = 0;
+	     region_index < sampler->number_of_regions;
+	     region_index++ )
+	{
+		if( libsmdev_sample_region_initialize(
+		     &region,
+		     sampler->workers[ 0 ]->regions[ region_index ]->offset,
+		     sampler->workers[ 0 ]->regions[ region_index ]->size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create region: %d.",
+			 function,
+			 region_index );
+
+			goto on_error;
+		}
+		for( worker_index = 0;
+		     worker_index < sampler->number_of_workers;
+		     worker_index++ )
+		{
+			if( libsmdev_sample_region_merge(
+			     region,
+			     sampler->workers[ worker_index ]->regions[ region_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to merge region: %d of worker: %d.",
+				 function,
+				 region_index,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+		if( libcdata_array_append_entry(
+		     regions_array,
+		     &entry_index,
+		     (intptr_t *) region,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append region: %d to array.",
+			 function,
+			 region_index );
+
+			goto on_error;
+		}
+		region = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( region != NULL )
+	{
+		libsmdev_sample_region_free(
+		 &region,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,234 @@
+/*
+ * Sampler functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_SAMPLER_H )
+#define _LIBSMDEV_SAMPLER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcthreads.h"
+#include "libsmdev_sample_region.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a sample
+ */
+#define LIBSMDEV_SAMPLER_MAXIMUM_SAMPLE_SIZE		1048576
+
+/* The maximum number of samples
+ */
+#define LIBSMDEV_SAMPLER_MAXIMUM_NUMBER_OF_SAMPLES	1048576
+
+/* The maximum number of regions
+ */
+#define LIBSMDEV_SAMPLER_MAXIMUM_NUMBER_OF_REGIONS	4096
+
+/* The maximum number of workers
+ */
+#define LIBSMDEV_SAMPLER_MAXIMUM_NUMBER_OF_WORKERS	64
+
+/* The entropy in bits per byte above which the data of a sample is considered
+ * to be encrypted or compressed
+ */
+#define LIBSMDEV_SAMPLER_HIGH_ENTROPY_THRESHOLD		7.9
+
+typedef struct libsmdev_sampler libsmdev_sampler_t;
+
+typedef struct libsmdev_sampler_worker libsmdev_sampler_worker_t;
+
+struct libsmdev_sampler_worker
+{
+	/* The sampler
+	 */
+	libsmdev_sampler_t *sampler;
+
+	/* The IO backend
+	 * The IO backend is not managed by the worker
+	 */
+	libsmdev_io_backend_t *io_backend;
+
+	/* The data buffer
+	 */
+	uint8_t *data;
+
+	/* The number of occurrences of every byte value in the current sample
+	 */
+	uint64_t byte_counts[ 256 ];
+
+	/* The statistics of the regions gathered by the worker
+	 */
+	libsmdev_sample_region_t **regions;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct libsmdev_sampler
+{
+	/* The sampling method
+	 */
+	int sampling_method;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of bytes per sector
+	 */
+	size_t bytes_per_sector;
+
+	/* The size of a sample
+	 */
+	size_t sample_size;
+
+	/* The number of samples
+	 */
+	int number_of_samples;
+
+	/* The offsets of the samples in ascending order
+	 */
+	off64_t *sample_offsets;
+
+	/* The number of regions
+	 */
+	int number_of_regions;
+
+	/* The size of a region
+	 */
+	size64_t region_size;
+
+	/* The minimum entropy of the data of a high entropy sample
+	 */
+	double high_entropy_threshold;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The workers
+	 */
+	libsmdev_sampler_worker_t **workers;
+
+	/* The index of the next sample to be read by a worker
+	 */
+	int next_sample_index;
+
+	/* Value to indicate if abort was signalled
+	 */
+	uint8_t abort;
+
+	/* Value to indicate a worker failed
+	 */
+	uint8_t failed;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libsmdev_sampler_worker_initialize(
+     libsmdev_sampler_worker_t **worker,
+     libsmdev_sampler_t *sampler,
+     libsmdev_io_backend_t *io_backend,
+     libcerror_error_t **error );
+
+int libsmdev_sampler_worker_free(
+     libsmdev_sampler_worker_t **worker,
+     libcerror_error_t **error );
+
+int libsmdev_sampler_initialize(
+     libsmdev_sampler_t **sampler,
+     int sampling_method,
+     size64_t media_size,
+     size_t bytes_per_sector,
+     size_t sample_size,
+     int number_of_samples,
+     int number_of_regions,
+     libsmdev_io_backend_t **io_backends,
+     int number_of_io_backends,
+     libcerror_error_t **error );
+
+int libsmdev_sampler_free(
+     libsmdev_sampler_t **sampler,
+     libcerror_error_t **error );
+
+int libsmdev_sampler_signal_abort(
+     libsmdev_sampler_t *sampler,
+     libcerror_error_t **error );
+
+uint64_t libsmdev_sampler_get_random_value(
+          uint64_t *random_state );
+
+int libsmdev_sampler_compare_offsets(
+     const void *first_offset,
+     const void *second_offset );
+
+int libsmdev_sampler_select_samples(
+     libsmdev_sampler_t *sampler,
+     libcerror_error_t **error );
+
+void libsmdev_sampler_count_bytes(
+      const uint8_t *data,
+      size_t data_size,
+      uint64_t *byte_counts );
+
+int libsmdev_sampler_process_sample(
+     libsmdev_sampler_worker_t *worker,
+     off64_t sample_offset,
+     libcerror_error_t **error );
+
+int libsmdev_sampler_process_samples(
+     libsmdev_sampler_worker_t *worker,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsmdev_sampler_worker_callback(
+     libsmdev_sampler_worker_t *worker );
+
+#endif
+
+int libsmdev_sampler_run(
+     libsmdev_sampler_t *sampler,
+     libcerror_error_t **error );
+
+int libsmdev_sampler_get_regions(
+     libsmdev_sampler_t *sampler,
+     libcdata_array_t *regions_array,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_SAMPLER_H ) */
+
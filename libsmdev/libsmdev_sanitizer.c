@@ -0,0 +1,1876 @@
+/*
+ * Sanitizer functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_LINUX_FS_H ) && !defined( WINAPI )
+/* Required for Linux platforms that use a sizeof( u64 )
+ * in linux/fs.h but have no typedef of it
+ */
+#if !defined( HAVE_U64 )
+typedef size_t u64;
+#endif
+
+#include <linux/fs.h>
+#endif
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcnotify.h"
+#include "libsmdev_libcthreads.h"
+#include "libsmdev_sanitizer.h"
+#include "libsmdev_write_engine.h"
+
+/* Creates a worker
+ * Make sure the value worker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_worker_initialize(
+     libsmdev_sanitizer_worker_t **worker,
+     libsmdev_sanitizer_t *sanitizer,
+     libsmdev_io_backend_t *io_backend,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sanitizer_worker_initialize";
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *worker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid worker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	*worker = memory_allocate_structure(
+	           libsmdev_sanitizer_worker_t );
+
+	if( *worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create worker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *worker,
+	     0,
+	     sizeof( libsmdev_sanitizer_worker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear worker.",
+		 function );
+
+		memory_free(
+		 *worker );
+
+		*worker = NULL;
+
+		return( -1 );
+	}
+	( *worker )->data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * LIBSMDEV_SANITIZER_STRIPE_SIZE );
+
+	if( ( *worker )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *worker )->sanitizer  = sanitizer;
+	( *worker )->io_backend = io_backend;
+
+	return( 1 );
+
+on_error:
+	if( *worker != NULL )
+	{
+		memory_free(
+		 *worker );
+
+		*worker = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a worker
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_worker_free(
+     libsmdev_sanitizer_worker_t **worker,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sanitizer_worker_free";
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *worker != NULL )
+	{
+		if( ( *worker )->data != NULL )
+		{
+			memory_free(
+			 ( *worker )->data );
+		}
+		memory_free(
+		 *worker );
+
+		*worker = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates a sanitizer
+ * Make sure the value sanitizer is referencing, is set to NULL
+ * Every IO backend is used by a separate worker and must be opened for reading and writing
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_initialize(
+     libsmdev_sanitizer_t **sanitizer,
+     int erase_method,
+     size64_t media_size,
+     size_t bytes_per_sector,
+     libsmdev_io_backend_t **io_backends,
+     int number_of_io_backends,
+     libcdata_range_list_t *errors_range_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sanitizer_initialize";
+	int worker_index      = 0;
+
+	if( sanitizer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitizer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sanitizer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sanitizer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( erase_method != LIBSMDEV_SANITIZE_METHOD_DISCARD )
+	 && ( erase_method != LIBSMDEV_SANITIZE_METHOD_ZERO_OUT )
+	 && ( erase_method != LIBSMDEV_SANITIZE_METHOD_OVERWRITE )
+	 && ( erase_method != LIBSMDEV_SANITIZE_METHOD_BLOCK_ERASE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported erase method.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( media_size == 0 )
+	 || ( media_size > (size64_t) INT64_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid media size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bytes_per_sector == 0 )
+	 || ( bytes_per_sector > (size_t) LIBSMDEV_SANITIZER_SAMPLE_SIZE )
+	 || ( ( LIBSMDEV_SANITIZER_SAMPLE_SIZE % bytes_per_sector ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backends == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backends.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_io_backends <= 0 )
+	 || ( number_of_io_backends > LIBSMDEV_SANITIZER_MAXIMUM_NUMBER_OF_WORKERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of IO backends value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_io_backends != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: multiple workers require multi-threading support.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( errors_range_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid errors range list.",
+		 function );
+
+		return( -1 );
+	}
+	*sanitizer = memory_allocate_structure(
+	              libsmdev_sanitizer_t );
+
+	if( *sanitizer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sanitizer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sanitizer,
+	     0,
+	     sizeof( libsmdev_sanitizer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sanitizer.",
+		 function );
+
+		memory_free(
+		 *sanitizer );
+
+		*sanitizer = NULL;
+
+		return( -1 );
+	}
+	( *sanitizer )->erase_method      = erase_method;
+	( *sanitizer )->media_size        = media_size;
+	( *sanitizer )->bytes_per_sector  = bytes_per_sector;
+	( *sanitizer )->number_of_samples = LIBSMDEV_SANITIZER_NUMBER_OF_SAMPLES;
+	( *sanitizer )->sample_size       = LIBSMDEV_SANITIZER_SAMPLE_SIZE;
+	( *sanitizer )->number_of_workers = number_of_io_backends;
+	( *sanitizer )->errors_range_list = errors_range_list;
+
+	( *sanitizer )->workers = (libsmdev_sanitizer_worker_t **) memory_allocate(
+	                           sizeof( libsmdev_sanitizer_worker_t * ) * number_of_io_backends );
+
+	if( ( *sanitizer )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_io_backends;
+	     worker_index++ )
+	{
+		( *sanitizer )->workers[ worker_index ] = NULL;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_io_backends;
+	     worker_index++ )
+	{
+		if( libsmdev_sanitizer_worker_initialize(
+		     &( ( *sanitizer )->workers[ worker_index ] ),
+		     *sanitizer,
+		     io_backends[ worker_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *sanitizer )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *sanitizer != NULL )
+	{
+		libsmdev_sanitizer_free(
+		 sanitizer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a sanitizer
+ * The IO backends of the workers are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_free(
+     libsmdev_sanitizer_t **sanitizer,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sanitizer_free";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( sanitizer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitizer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sanitizer != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *sanitizer )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *sanitizer )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *sanitizer )->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *sanitizer )->number_of_workers;
+			     worker_index++ )
+			{
+				if( libsmdev_sanitizer_worker_free(
+				     &( ( *sanitizer )->workers[ worker_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *sanitizer )->workers );
+		}
+		memory_free(
+		 *sanitizer );
+
+		*sanitizer = NULL;
+	}
+	return( result );
+}
+
+/* Sets the progress callback function
+ * The function is called after every stripe and serialized between the workers
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_set_progress_callback(
+     libsmdev_sanitizer_t *sanitizer,
+     int (*progress_callback)(
+            void *callback_data,
+            int stage,
+            size64_t processed_size,
+            size64_t total_size ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sanitizer_set_progress_callback";
+
+	if( sanitizer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitizer.",
+		 function );
+
+		return( -1 );
+	}
+	sanitizer->progress_callback = progress_callback;
+	sanitizer->callback_data     = callback_data;
+
+	return( 1 );
+}
+
+/* Signals the sanitizer to abort
+ * Stripes that are being processed are completed first
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_signal_abort(
+     libsmdev_sanitizer_t *sanitizer,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sanitizer_signal_abort";
+
+	if( sanitizer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitizer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     sanitizer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	sanitizer->abort = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     sanitizer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Determines if the data consists of a single repeated byte value
+ * Returns 1 if the data is uniform or 0 if not
+ */
+int libsmdev_sanitizer_data_is_uniform(
+     const uint8_t *data,
+     size_t data_size )
+{
+	if( ( data == NULL )
+	 || ( data_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( data[ 0 ] == 0 )
+	{
+		return( libsmdev_write_engine_data_is_zero(
+		         data,
+		         data_size ) );
+	}
+	/* The data is uniform if every byte equals the byte that precedes it
+	 */
+	if( memory_compare(
+	     data,
+	     &( data[ 1 ] ),
+	     data_size - 1 ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the range of a stripe of the current stage
+ * The samples of a sampled verification are spread evenly over the media
+ * with the first sample at the start and the last sample at the end of the media
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_get_stripe_range(
+     libsmdev_sanitizer_t *sanitizer,
+     uint64_t stripe_index,
+     off64_t *stripe_offset,
+     size64_t *stripe_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libsmdev_sanitizer_get_stripe_range";
+	uint64_t number_of_sectors = 0;
+	uint64_t sample_sector     = 0;
+	uint64_t sectors_span      = 0;
+
+	if( sanitizer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitizer.",
+		 function );
+
+		return( -1 );
+	}
+	if( stripe_index >= sanitizer->number_of_stripes )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stripe index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( stripe_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stripe offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( stripe_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stripe size.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitizer->sampled != 0 )
+	{
+		number_of_sectors = sanitizer->media_size / sanitizer->bytes_per_sector;
+		sectors_span      = number_of_sectors - ( sanitizer->sample_size / sanitizer->bytes_per_sector );
+
+		if( sanitizer->number_of_stripes > 1 )
+		{
+			sample_sector = ( sectors_span * stripe_index ) / ( sanitizer->number_of_stripes - 1 );
+		}
+		*stripe_offset = (off64_t) ( sample_sector * sanitizer->bytes_per_sector );
+		*stripe_size   = (size64_t) sanitizer->sample_size;
+	}
+	else
+	{
+		*stripe_offset = (off64_t) ( stripe_index * sanitizer->stripe_size );
+		*stripe_size   = sanitizer->stripe_size;
+
+		if( ( (size64_t) *stripe_offset + *stripe_size ) > sanitizer->media_size )
+		{
+			*stripe_size = sanitizer->media_size - (size64_t) *stripe_offset;
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a range to the read/write errors range list
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_append_error(
+     libsmdev_sanitizer_t *sanitizer,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sanitizer_append_error";
+	int result            = 1;
+
+	if( sanitizer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitizer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     sanitizer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_range_list_insert_range(
+	     sanitizer->errors_range_list,
+	     (uint64_t) offset,
+	     (uint64_t) size,
+	     NULL,
+	     NULL,
+	     NULL,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert error range in range list.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     sanitizer->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Writes data at a specific offset using an IO backend
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libsmdev_sanitizer_write_at_offset(
+         libsmdev_io_backend_t *io_backend,
+         const uint8_t *data,
+         size_t data_size,
+         off64_t offset,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sanitizer_write_at_offset";
+	size_t data_offset    = 0;
+	ssize_t write_count   = 0;
+
+	if( libsmdev_io_backend_seek_offset(
+	     io_backend,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		write_count = libsmdev_io_backend_write_buffer(
+		               io_backend,
+		               &( data[ data_offset ] ),
+		               data_size - data_offset,
+		               error_code,
+		               error );
+
+		if( write_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset + (off64_t) data_offset,
+			 offset + (off64_t) data_offset );
+
+			return( -1 );
+		}
+		else if( write_count == 0 )
+		{
+			*error_code = 0;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unexpected end of device at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset + (off64_t) data_offset,
+			 offset + (off64_t) data_offset );
+
+			return( -1 );
+		}
+		data_offset += (size_t) write_count;
+	}
+	return( (ssize_t) data_offset );
+}
+
+/* Erases a range using a discard or zero out request
+ * The range ioctls require 512 byte aligned ranges
+ * Returns 1 if successful, 0 if the request is not supported or -1 on error
+ */
+int libsmdev_sanitizer_erase_range_request(
+     libsmdev_sanitizer_worker_t *worker,
+     int erase_method,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sanitizer_erase_range_request";
+
+#if defined( BLKZEROOUT )
+	uint64_t range[ 2 ];
+
+	libcerror_error_t *request_error = NULL;
+	ssize_t read_count               = 0;
+	int request                      = 0;
+#endif
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( BLKZEROOUT )
+	if( ( ( offset % 512 ) != 0 )
+	 || ( ( size % 512 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	range[ 0 ] = (uint64_t) offset;
+	range[ 1 ] = (uint64_t) size;
+
+#if defined( BLKDISCARD )
+	if( erase_method == LIBSMDEV_SANITIZE_METHOD_DISCARD )
+	{
+		request = BLKDISCARD;
+	}
+	else
+#endif
+	if( erase_method == LIBSMDEV_SANITIZE_METHOD_ZERO_OUT )
+	{
+		request = BLKZEROOUT;
+	}
+	else
+	{
+		return( 0 );
+	}
+	read_count = libsmdev_io_backend_io_control_read(
+	              worker->io_backend,
+	              request,
+	              (uint8_t *) range,
+	              sizeof( uint64_t ) * 2,
+	              &request_error );
+
+	if( read_count == -1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 request_error );
+		}
+#endif
+		libcerror_error_free(
+		 &request_error );
+
+		return( 0 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif /* defined( BLKZEROOUT ) */
+}
+
+/* Erases a range by overwriting it with zero bytes
+ * Sectors that cannot be written are added to the read/write errors range list
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_overwrite_range(
+     libsmdev_sanitizer_worker_t *worker,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libsmdev_sanitizer_t *sanitizer = NULL;
+	static char *function           = "libsmdev_sanitizer_overwrite_range";
+	size64_t range_offset           = 0;
+	size_t sector_offset            = 0;
+	size_t write_size               = 0;
+	ssize_t write_count             = 0;
+	uint32_t error_code             = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	sanitizer = worker->sanitizer;
+
+	while( range_offset < size )
+	{
+		write_size = LIBSMDEV_SANITIZER_STRIPE_SIZE;
+
+		if( (size64_t) write_size > ( size - range_offset ) )
+		{
+			write_size = (size_t) ( size - range_offset );
+		}
+		/* The data buffer is shared with the verification
+		 */
+		if( memory_set(
+		     worker->data,
+		     0,
+		     write_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear data.",
+			 function );
+
+			return( -1 );
+		}
+		write_count = libsmdev_sanitizer_write_at_offset(
+		               worker->io_backend,
+		               worker->data,
+		               write_size,
+		               offset + (off64_t) range_offset,
+		               &error_code,
+		               error );
+
+		if( write_count == -1 )
+		{
+			if( libsmdev_write_engine_error_code_is_recoverable(
+			     error_code ) == 0 )
+			{
+				return( -1 );
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			/* Write the sectors individually to isolate the ones that cannot be written
+			 */
+			for( sector_offset = 0;
+			     sector_offset < write_size;
+			     sector_offset += sanitizer->bytes_per_sector )
+			{
+				write_count = libsmdev_sanitizer_write_at_offset(
+				               worker->io_backend,
+				               &( worker->data[ sector_offset ] ),
+				               sanitizer->bytes_per_sector,
+				               offset + (off64_t) ( range_offset + sector_offset ),
+				               &error_code,
+				               error );
+
+				if( write_count != -1 )
+				{
+					continue;
+				}
+				if( libsmdev_write_engine_error_code_is_recoverable(
+				     error_code ) == 0 )
+				{
+					return( -1 );
+				}
+				libcerror_error_free(
+				 error );
+
+				if( libsmdev_sanitizer_append_error(
+				     sanitizer,
+				     offset + (off64_t) ( range_offset + sector_offset ),
+				     (size64_t) sanitizer->bytes_per_sector,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append write error.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		range_offset += write_size;
+	}
+	return( 1 );
+}
+
+/* Erases a stripe
+ * If the device rejects a discard request the stripe is zeroed out instead
+ * and if it rejects a zero out request the stripe is overwritten instead,
+ * the erase method of the sanitizer is changed accordingly for the other stripes
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_erase_stripe(
+     libsmdev_sanitizer_worker_t *worker,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libsmdev_sanitizer_t *sanitizer = NULL;
+	static char *function           = "libsmdev_sanitizer_erase_stripe";
+	int erase_method                = 0;
+	int result                      = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	sanitizer    = worker->sanitizer;
+	erase_method = sanitizer->erase_method;
+
+	while( ( erase_method == LIBSMDEV_SANITIZE_METHOD_DISCARD )
+	    || ( erase_method == LIBSMDEV_SANITIZE_METHOD_ZERO_OUT ) )
+	{
+		result = libsmdev_sanitizer_erase_range_request(
+		          worker,
+		          erase_method,
+		          offset,
+		          size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to erase range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+		if( erase_method == LIBSMDEV_SANITIZE_METHOD_DISCARD )
+		{
+			erase_method = LIBSMDEV_SANITIZE_METHOD_ZERO_OUT;
+		}
+		else
+		{
+			erase_method = LIBSMDEV_SANITIZE_METHOD_OVERWRITE;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     sanitizer->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		/* Another worker could have fallen back further already
+		 */
+		if( sanitizer->erase_method < erase_method )
+		{
+			sanitizer->erase_method = erase_method;
+		}
+		erase_method = sanitizer->erase_method;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     sanitizer->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
+	if( libsmdev_sanitizer_overwrite_range(
+	     worker,
+	     offset,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to overwrite range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Verifies data that was read back per sector
+ * After a block erase a sector is expected to contain a single repeated byte value,
+ * otherwise it is expected to contain zero bytes
+ * Sectors that do not match are added to the read/write errors range list
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_verify_data(
+     libsmdev_sanitizer_worker_t *worker,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	libsmdev_sanitizer_t *sanitizer = NULL;
+	static char *function           = "libsmdev_sanitizer_verify_data";
+	size_t sector_offset            = 0;
+	size_t sector_size              = 0;
+	int result                      = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	sanitizer = worker->sanitizer;
+
+	/* Most data is expected to match hence check the data as a whole first
+	 */
+	if( sanitizer->erase_method != LIBSMDEV_SANITIZE_METHOD_BLOCK_ERASE )
+	{
+		if( libsmdev_write_engine_data_is_zero(
+		     data,
+		     data_size ) != 0 )
+		{
+			return( 1 );
+		}
+	}
+	for( sector_offset = 0;
+	     sector_offset < data_size;
+	     sector_offset += sector_size )
+	{
+		sector_size = sanitizer->bytes_per_sector;
+
+		if( sector_size > ( data_size - sector_offset ) )
+		{
+			sector_size = data_size - sector_offset;
+		}
+		if( sanitizer->erase_method == LIBSMDEV_SANITIZE_METHOD_BLOCK_ERASE )
+		{
+			result = libsmdev_sanitizer_data_is_uniform(
+			          &( data[ sector_offset ] ),
+			          sector_size );
+		}
+		else
+		{
+			result = libsmdev_write_engine_data_is_zero(
+			          &( data[ sector_offset ] ),
+			          sector_size );
+		}
+		if( result != 0 )
+		{
+			continue;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: sector at offset: %" PRIi64 " (0x%08" PRIx64 ") was not erased.\n",
+			 function,
+			 offset + (off64_t) sector_offset,
+			 offset + (off64_t) sector_offset );
+		}
+#endif
+		if( libsmdev_sanitizer_append_error(
+		     sanitizer,
+		     offset + (off64_t) sector_offset,
+		     (size64_t) sector_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append verification error.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Verifies a stripe by reading it back
+ * Sectors that cannot be read are added to the read/write errors range list
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_verify_stripe(
+     libsmdev_sanitizer_worker_t *worker,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libsmdev_sanitizer_t *sanitizer = NULL;
+	static char *function           = "libsmdev_sanitizer_verify_stripe";
+	size64_t stripe_offset          = 0;
+	size_t read_size                = 0;
+	size_t sector_offset            = 0;
+	ssize_t read_count              = 0;
+	uint32_t error_code             = 0;
+	int result                      = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	sanitizer = worker->sanitizer;
+
+	while( stripe_offset < size )
+	{
+		read_size = LIBSMDEV_SANITIZER_STRIPE_SIZE;
+
+		if( (size64_t) read_size > ( size - stripe_offset ) )
+		{
+			read_size = (size_t) ( size - stripe_offset );
+		}
+		read_count = libsmdev_io_backend_read_buffer_at_offset(
+		              worker->io_backend,
+		              worker->data,
+		              read_size,
+		              offset + (off64_t) stripe_offset,
+		              &error_code,
+		              error );
+
+		if( read_count == (ssize_t) read_size )
+		{
+			if( libsmdev_sanitizer_verify_data(
+			     worker,
+			     worker->data,
+			     read_size,
+			     offset + (off64_t) stripe_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to verify data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset + (off64_t) stripe_offset,
+				 offset + (off64_t) stripe_offset );
+
+				return( -1 );
+			}
+			stripe_offset += read_size;
+
+			continue;
+		}
+		if( read_count != -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of device at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset + (off64_t) stripe_offset,
+			 offset + (off64_t) stripe_offset );
+
+			return( -1 );
+		}
+		if( libsmdev_write_engine_error_code_is_recoverable(
+		     error_code ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset + (off64_t) stripe_offset,
+			 offset + (off64_t) stripe_offset );
+
+			return( -1 );
+		}
+		libcerror_error_free(
+		 error );
+
+		/* Read the sectors individually to isolate the ones that cannot be read
+		 */
+		for( sector_offset = 0;
+		     sector_offset < read_size;
+		     sector_offset += sanitizer->bytes_per_sector )
+		{
+			read_count = libsmdev_io_backend_read_buffer_at_offset(
+			              worker->io_backend,
+			              worker->data,
+			              sanitizer->bytes_per_sector,
+			              offset + (off64_t) ( stripe_offset + sector_offset ),
+			              &error_code,
+			              error );
+
+			if( read_count == (ssize_t) sanitizer->bytes_per_sector )
+			{
+				result = libsmdev_sanitizer_verify_data(
+				          worker,
+				          worker->data,
+				          sanitizer->bytes_per_sector,
+				          offset + (off64_t) ( stripe_offset + sector_offset ),
+				          error );
+			}
+			else if( ( read_count == -1 )
+			      && ( libsmdev_write_engine_error_code_is_recoverable(
+			            error_code ) != 0 ) )
+			{
+				libcerror_error_free(
+				 error );
+
+				result = libsmdev_sanitizer_append_error(
+				          sanitizer,
+				          offset + (off64_t) ( stripe_offset + sector_offset ),
+				          (size64_t) sanitizer->bytes_per_sector,
+				          error );
+			}
+			else
+			{
+				result = -1;
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to verify sector at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset + (off64_t) ( stripe_offset + sector_offset ),
+				 offset + (off64_t) ( stripe_offset + sector_offset ) );
+
+				return( -1 );
+			}
+		}
+		stripe_offset += read_size;
+	}
+	return( 1 );
+}
+
+/* Processes stripes of the current stage until no stripes remain
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_process_stripes(
+     libsmdev_sanitizer_worker_t *worker,
+     libcerror_error_t **error )
+{
+	libsmdev_sanitizer_t *sanitizer = NULL;
+	static char *function           = "libsmdev_sanitizer_process_stripes";
+	size64_t stripe_size            = 0;
+	off64_t stripe_offset           = 0;
+	uint64_t stripe_index           = 0;
+	int result                      = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	sanitizer = worker->sanitizer;
+
+	do
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     sanitizer->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		/* Update the progress of the previous stripe
+		 */
+		if( stripe_size > 0 )
+		{
+			sanitizer->processed_size += stripe_size;
+
+			if( sanitizer->progress_callback != NULL )
+			{
+				if( sanitizer->progress_callback(
+				     sanitizer->callback_data,
+				     sanitizer->stage,
+				     sanitizer->processed_size,
+				     sanitizer->total_size ) != 1 )
+				{
+					sanitizer->abort = 1;
+				}
+			}
+		}
+		stripe_index = sanitizer->next_stripe_index;
+
+		if( ( sanitizer->abort == 0 )
+		 && ( sanitizer->failed == 0 )
+		 && ( stripe_index < sanitizer->number_of_stripes ) )
+		{
+			sanitizer->next_stripe_index += 1;
+
+			result = 1;
+		}
+		else
+		{
+			result = 0;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     sanitizer->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == 0 )
+		{
+			break;
+		}
+		if( libsmdev_sanitizer_get_stripe_range(
+		     sanitizer,
+		     stripe_index,
+		     &stripe_offset,
+		     &stripe_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve range of stripe: %" PRIu64 ".",
+			 function,
+			 stripe_index );
+
+			goto on_error;
+		}
+		if( sanitizer->stage == LIBSMDEV_SANITIZE_STAGE_ERASE )
+		{
+			result = libsmdev_sanitizer_erase_stripe(
+			          worker,
+			          stripe_offset,
+			          stripe_size,
+			          error );
+		}
+		else
+		{
+			result = libsmdev_sanitizer_verify_stripe(
+			          worker,
+			          stripe_offset,
+			          stripe_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process stripe: %" PRIu64 ".",
+			 function,
+			 stripe_index );
+
+			goto on_error;
+		}
+	}
+	while( result == 1 );
+
+	return( 1 );
+
+on_error:
+	/* Signal the other workers to stop
+	 */
+	sanitizer->failed = 1;
+
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The worker thread callback
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_sanitizer_worker_callback(
+     libsmdev_sanitizer_worker_t *worker )
+{
+	libcerror_error_t *error = NULL;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	if( libsmdev_sanitizer_process_stripes(
+	     worker,
+	     &error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Runs a stage of the sanitizer using all workers
+ * The verification method is only used by the verify stage
+ * A sampled verification falls back to a full verification for media
+ * that is not substantially larger than the samples
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libsmdev_sanitizer_run(
+     libsmdev_sanitizer_t *sanitizer,
+     int stage,
+     int verification_method,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sanitizer_run";
+	int result            = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libsmdev_sanitizer_worker_t *worker = NULL;
+	int worker_index                    = 0;
+#endif
+
+	if( sanitizer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitizer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stage != LIBSMDEV_SANITIZE_STAGE_ERASE )
+	 && ( stage != LIBSMDEV_SANITIZE_STAGE_VERIFY ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported stage.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( verification_method != LIBSMDEV_SANITIZE_VERIFICATION_METHOD_NONE )
+	 && ( verification_method != LIBSMDEV_SANITIZE_VERIFICATION_METHOD_SAMPLED )
+	 && ( verification_method != LIBSMDEV_SANITIZE_VERIFICATION_METHOD_FULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported verification method.",
+		 function );
+
+		return( -1 );
+	}
+	if( stage == LIBSMDEV_SANITIZE_STAGE_ERASE )
+	{
+		if( sanitizer->erase_method == LIBSMDEV_SANITIZE_METHOD_BLOCK_ERASE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: block erase is performed by the device.",
+			 function );
+
+			return( -1 );
+		}
+		sanitizer->sampled     = 0;
+		sanitizer->stripe_size = LIBSMDEV_SANITIZER_ERASE_STRIPE_SIZE;
+		sanitizer->total_size  = sanitizer->media_size;
+	}
+	else if( verification_method == LIBSMDEV_SANITIZE_VERIFICATION_METHOD_NONE )
+	{
+		return( 1 );
+	}
+	else if( ( verification_method == LIBSMDEV_SANITIZE_VERIFICATION_METHOD_SAMPLED )
+	      && ( sanitizer->number_of_samples > 0 )
+	      && ( sanitizer->sample_size >= sanitizer->bytes_per_sector )
+	      && ( sanitizer->sample_size <= (size_t) LIBSMDEV_SANITIZER_STRIPE_SIZE )
+	      && ( ( sanitizer->sample_size % sanitizer->bytes_per_sector ) == 0 )
+	      && ( ( sanitizer->number_of_samples * sanitizer->sample_size ) < ( sanitizer->media_size / 2 ) ) )
+	{
+		sanitizer->sampled     = 1;
+		sanitizer->stripe_size = (size64_t) sanitizer->sample_size;
+		sanitizer->total_size  = sanitizer->number_of_samples * sanitizer->sample_size;
+	}
+	else
+	{
+		sanitizer->sampled     = 0;
+		sanitizer->stripe_size = LIBSMDEV_SANITIZER_STRIPE_SIZE;
+		sanitizer->total_size  = sanitizer->media_size;
+	}
+	if( sanitizer->sampled != 0 )
+	{
+		sanitizer->number_of_stripes = sanitizer->number_of_samples;
+	}
+	else
+	{
+		sanitizer->number_of_stripes = sanitizer->media_size / sanitizer->stripe_size;
+
+		if( ( sanitizer->media_size % sanitizer->stripe_size ) != 0 )
+		{
+			sanitizer->number_of_stripes += 1;
+		}
+	}
+	sanitizer->stage             = stage;
+	sanitizer->next_stripe_index = 0;
+	sanitizer->processed_size    = 0;
+	sanitizer->failed            = 0;
+
+	if( sanitizer->number_of_workers == 1 )
+	{
+		result = libsmdev_sanitizer_process_stripes(
+		          sanitizer->workers[ 0 ],
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process stripes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	else
+	{
+		for( worker_index = 0;
+		     worker_index < sanitizer->number_of_workers;
+		     worker_index++ )
+		{
+			worker = sanitizer->workers[ worker_index ];
+
+			if( libcthreads_thread_create(
+			     &( worker->thread ),
+			     NULL,
+			     (int (*)(void *)) &libsmdev_sanitizer_worker_callback,
+			     (void *) worker,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread of worker: %d.",
+				 function,
+				 worker_index );
+
+				/* Stop the workers that were already started
+				 */
+				sanitizer->failed = 1;
+
+				result = -1;
+
+				break;
+			}
+		}
+		for( worker_index = 0;
+		     worker_index < sanitizer->number_of_workers;
+		     worker_index++ )
+		{
+			worker = sanitizer->workers[ worker_index ];
+
+			if( worker->thread != NULL )
+			{
+				if( libcthreads_thread_join(
+				     &( worker->thread ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join thread of worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+		if( sanitizer->failed != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process stripes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( sanitizer->abort != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,294 @@
+/*
+ * Sanitizer functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_SANITIZER_H )
+#define _LIBSMDEV_SANITIZER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the data buffer of a worker
+ * This is also the size of a stripe when the full media is verified
+ */
+#define LIBSMDEV_SANITIZER_STRIPE_SIZE			4194304
+
+/* The size of a stripe when the media is erased
+ * Larger ranges reduce the number of discard and zero out requests
+ */
+#define LIBSMDEV_SANITIZER_ERASE_STRIPE_SIZE		67108864
+
+/* The default number of samples read back by a sampled verification
+ */
+#define LIBSMDEV_SANITIZER_NUMBER_OF_SAMPLES		1024
+
+/* The default size of a sample read back by a sampled verification
+ */
+#define LIBSMDEV_SANITIZER_SAMPLE_SIZE			65536
+
+/* The maximum number of workers
+ */
+#define LIBSMDEV_SANITIZER_MAXIMUM_NUMBER_OF_WORKERS	64
+
+typedef struct libsmdev_sanitizer libsmdev_sanitizer_t;
+
+typedef struct libsmdev_sanitizer_worker libsmdev_sanitizer_worker_t;
+
+struct libsmdev_sanitizer_worker
+{
+	/* The sanitizer
+	 */
+	libsmdev_sanitizer_t *sanitizer;
+
+	/* The IO backend
+	 * The IO backend is not managed by the worker
+	 */
+	libsmdev_io_backend_t *io_backend;
+
+	/* The data buffer
+	 */
+	uint8_t *data;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+};
+
+struct libsmdev_sanitizer
+{
+	/* The erase method
+	 * A discard or zero out method falls back to the next slower method
+	 * when the device rejects the request
+	 */
+	int erase_method;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of bytes per sector
+	 */
+	size_t bytes_per_sector;
+
+	/* The number of samples read back by a sampled verification
+	 */
+	uint64_t number_of_samples;
+
+	/* The size of a sample read back by a sampled verification
+	 */
+	size_t sample_size;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The workers
+	 */
+	libsmdev_sanitizer_worker_t **workers;
+
+	/* The read/write errors range list
+	 */
+	libcdata_range_list_t *errors_range_list;
+
+	/* The progress callback function
+	 * The sanitizer is aborted if the function does not return 1
+	 */
+	int (*progress_callback)(
+	       void *callback_data,
+	       int stage,
+	       size64_t processed_size,
+	       size64_t total_size );
+
+	/* The progress callback function data
+	 */
+	void *callback_data;
+
+	/* The current stage
+	 */
+	int stage;
+
+	/* Value to indicate only samples of the media are verified
+	 */
+	uint8_t sampled;
+
+	/* The stripe size of the current stage
+	 */
+	size64_t stripe_size;
+
+	/* The number of stripes of the current stage
+	 */
+	uint64_t number_of_stripes;
+
+	/* The index of the next stripe to be processed by a worker
+	 */
+	uint64_t next_stripe_index;
+
+	/* The size of the data processed in the current stage
+	 */
+	size64_t processed_size;
+
+	/* The total size of the data to be processed in the current stage
+	 */
+	size64_t total_size;
+
+	/* Value to indicate if abort was signalled
+	 */
+	uint8_t abort;
+
+	/* Value to indicate a worker failed
+	 */
+	uint8_t failed;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libsmdev_sanitizer_worker_initialize(
+     libsmdev_sanitizer_worker_t **worker,
+     libsmdev_sanitizer_t *sanitizer,
+     libsmdev_io_backend_t *io_backend,
+     libcerror_error_t **error );
+
+int libsmdev_sanitizer_worker_free(
+     libsmdev_sanitizer_worker_t **worker,
+     libcerror_error_t **error );
+
+int libsmdev_sanitizer_initialize(
+     libsmdev_sanitizer_t **sanitizer,
+     int erase_method,
+     size64_t media_size,
+     size_t bytes_per_sector,
+     libsmdev_io_backend_t **io_backends,
+     int number_of_io_backends,
+     libcdata_range_list_t *errors_range_list,
+     libcerror_error_t **error );
+
+int libsmdev_sanitizer_free(
+     libsmdev_sanitizer_t **sanitizer,
+     libcerror_error_t **error );
+
+int libsmdev_sanitizer_set_progress_callback(
+     libsmdev_sanitizer_t *sanitizer,
+     int (*progress_callback)(
+            void *callback_data,
+            int stage,
+            size64_t processed_size,
+            size64_t total_size ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libsmdev_sanitizer_signal_abort(
+     libsmdev_sanitizer_t *sanitizer,
+     libcerror_error_t **error );
+
+int libsmdev_sanitizer_data_is_uniform(
+     const uint8_t *data,
+     size_t data_size );
+
+int libsmdev_sanitizer_get_stripe_range(
+     libsmdev_sanitizer_t *sanitizer,
+     uint64_t stripe_index,
+     off64_t *stripe_offset,
+     size64_t *stripe_size,
+     libcerror_error_t **error );
+
+int libsmdev_sanitizer_append_error(
+     libsmdev_sanitizer_t *sanitizer,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+ssize_t libsmdev_sanitizer_write_at_offset(
+         libsmdev_io_backend_t *io_backend,
+         const uint8_t *data,
+         size_t data_size,
+         off64_t offset,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+int libsmdev_sanitizer_erase_range_request(
+     libsmdev_sanitizer_worker_t *worker,
+     int erase_method,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libsmdev_sanitizer_overwrite_range(
+     libsmdev_sanitizer_worker_t *worker,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libsmdev_sanitizer_erase_stripe(
+     libsmdev_sanitizer_worker_t *worker,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libsmdev_sanitizer_verify_data(
+     libsmdev_sanitizer_worker_t *worker,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libsmdev_sanitizer_verify_stripe(
+     libsmdev_sanitizer_worker_t *worker,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libsmdev_sanitizer_process_stripes(
+     libsmdev_sanitizer_worker_t *worker,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsmdev_sanitizer_worker_callback(
+     libsmdev_sanitizer_worker_t *worker );
+
+#endif
+
+int libsmdev_sanitizer_run(
+     libsmdev_sanitizer_t *sanitizer,
+     int stage,
+     int verification_method,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_SANITIZER_H ) */
+
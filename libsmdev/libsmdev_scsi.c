@@ -38,6 +38,7 @@
 #endif
 
 #include "libsmdev_definitions.h"
+#include "libsmdev_io_control.h"
 #include "libsmdev_libcerror.h"
 #include "libsmdev_libcnotify.h"
 #include "libsmdev_scsi.h"
@@ -46,6 +47,15 @@
  */
 #define LIBSMDEV_SCSI_CONTROL_COMMAND_TIMEOUT	1000
 
+/* Timeout in milli seconds: 30 seconds
+ * A drive can spend this long on spinning up and retrying marginal sectors
+ */
+#define LIBSMDEV_SCSI_DATA_COMMAND_TIMEOUT	30000
+
+/* The SG IO host status that indicates the command timed out (DID_TIME_OUT)
+ */
+#define LIBSMDEV_SCSI_HOST_STATUS_TIME_OUT	0x03
+
 #if defined( HAVE_SCSI_SG_H )
 
 /* Sends a SCSI command to the file descriptor
@@ -60,10 +70,71 @@ int libsmdev_scsi_command(
      uint8_t *sense,
      size_t sense_size,
      libcerror_error_t **error )
+{
+	static char *function = "libsmdev_scsi_command";
+	int result            = 0;
+
+	result = libsmdev_scsi_command_transfer(
+	          device_file,
+	          command,
+	          command_size,
+	          response,
+	          response_size,
+	          LIBSMDEV_SCSI_DATA_DIRECTION_FROM_DEVICE,
+	          sense,
+	          sense_size,
+	          LIBSMDEV_SCSI_CONTROL_COMMAND_TIMEOUT,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 "%s: unable to send SCSI command.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 "%s: device reported a check condition or the command timed out.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sends a SCSI command that transfers data in the specified direction to the file descriptor
+ * and retrieves the sense data if the command did not complete successfully
+ * The timeout is in milli seconds, data of NULL with a data size of 0 indicates the command does not transfer data
+ * If duration is not NULL it is set to the time in milli seconds the device took to complete the command
+ * A command that timed out is reported as a check condition with empty sense data
+ * Returns 1 if successful, 0 if the device reported a check condition or -1 on error
+ */
+int libsmdev_scsi_command_transfer(
+     libcfile_file_t *device_file,
+     uint8_t *command,
+     size_t command_size,
+     uint8_t *data,
+     size_t data_size,
+     uint8_t data_direction,
+     uint8_t *sense,
+     size_t sense_size,
+     unsigned int timeout,
+     uint32_t *duration,
+     libcerror_error_t **error )
 {
 	struct sg_io_hdr sg_io_header;
 
-	static char *function = "libsmdev_scsi_command";
+	static char *function = "libsmdev_scsi_command_transfer";
 	ssize_t read_count    = 0;
 
 	if( device_file == NULL )
@@ -99,24 +170,37 @@ int libsmdev_scsi_command(
 
 		return( -1 );
 	}
-	if( response == NULL )
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid response.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( response_size > (size_t) SSIZE_MAX )
+	if( data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid response size value exceeds maximum.",
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_direction != LIBSMDEV_SCSI_DATA_DIRECTION_FROM_DEVICE )
+	 && ( data_direction != LIBSMDEV_SCSI_DATA_DIRECTION_TO_DEVICE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported data direction.",
 		 function );
 
 		return( -1 );
@@ -157,21 +241,48 @@ int libsmdev_scsi_command(
 
 		return( -1 );
 	}
-	sg_io_header.interface_id    = 'S';
-	sg_io_header.cmdp            = command;
-	sg_io_header.cmd_len         = command_size;
-	sg_io_header.sbp             = sense;
-	sg_io_header.mx_sb_len       = sense_size;
-	sg_io_header.dxferp          = response;
-	sg_io_header.dxfer_len       = response_size;
-	sg_io_header.dxfer_direction = SG_DXFER_FROM_DEV;
-	sg_io_header.timeout         = LIBSMDEV_SCSI_CONTROL_COMMAND_TIMEOUT;
+	if( memory_set(
+	     sense,
+	     0,
+	     sense_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sense.",
+		 function );
+
+		return( -1 );
+	}
+	sg_io_header.interface_id = 'S';
+	sg_io_header.cmdp         = command;
+	sg_io_header.cmd_len      = command_size;
+	sg_io_header.sbp          = sense;
+	sg_io_header.mx_sb_len    = sense_size;
+	sg_io_header.timeout      = timeout;
+
+	if( data_size == 0 )
+	{
+		sg_io_header.dxfer_direction = SG_DXFER_NONE;
+	}
+	else
+	{
+		sg_io_header.dxferp    = data;
+		sg_io_header.dxfer_len = data_size;
 
-	read_count = libcfile_file_io_control_read(
+		if( data_direction == LIBSMDEV_SCSI_DATA_DIRECTION_TO_DEVICE )
+		{
+			sg_io_header.dxfer_direction = SG_DXFER_TO_DEV;
+		}
+		else
+		{
+			sg_io_header.dxfer_direction = SG_DXFER_FROM_DEV;
+		}
+	}
+	read_count = libsmdev_io_control_read(
 	              device_file,
 	              SG_IO,
-	              NULL,
-	              0,
 	              (uint8_t *) &sg_io_header,
 	              sizeof( struct sg_io_hdr ),
 	              error );
@@ -187,23 +298,60 @@ int libsmdev_scsi_command(
 
 		return( -1 );
 	}
-	/* Check if command returned an error
+	if( duration != NULL )
+	{
+		*duration = (uint32_t) sg_io_header.duration;
+	}
+	if( ( sg_io_header.info & SG_INFO_OK_MASK ) == SG_INFO_OK )
+	{
+		return( 1 );
+	}
+	/* A check condition (masked status 0x01) without transport errors provides sense data
 	 */
-	if( ( sg_io_header.info & SG_INFO_OK_MASK ) != SG_INFO_OK )
+	if( ( sg_io_header.masked_status == 0x01 )
+	 && ( sg_io_header.host_status == 0 )
+	 && ( sg_io_header.sb_len_wr > 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 "%s: error while querying device: scsi status: %X, host status: %X, driver status: %X.",
-		 function,
-		 sg_io_header.status,
-		 sg_io_header.host_status,
-		 sg_io_header.driver_status );
-
-		return( -1 );
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: sense:\n",
+			 function );
+			libcnotify_print_data(
+			 sense,
+			 (size_t) sg_io_header.sb_len_wr,
+			 0 );
+		}
+#endif
+		return( 0 );
 	}
-	return( 1 );
+	/* The sense data was cleared before the command was sent
+	 */
+	if( sg_io_header.host_status == LIBSMDEV_SCSI_HOST_STATUS_TIME_OUT )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: command timed out after: %u milli seconds.\n",
+			 function,
+			 sg_io_header.duration );
+		}
+#endif
+		return( 0 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+	 "%s: error while querying device: scsi status: %X, host status: %X, driver status: %X.",
+	 function,
+	 sg_io_header.status,
+	 sg_io_header.host_status,
+	 sg_io_header.driver_status );
+
+	return( -1 );
 }
 
 /* Sends a SCSI ioctl to the file descriptor
@@ -277,11 +425,9 @@ int libsmdev_scsi_ioctrl(
 
 		goto on_error;
 	}
-	read_count = libcfile_file_io_control_read(
+	read_count = libsmdev_io_control_read(
 	              device_file,
 	              SCSI_IOCTL_SEND_COMMAND,
-	              NULL,
-	              0,
 	              ioctrl_request,
 	              ioctrl_request_size,
 	              error );
@@ -383,6 +529,17 @@ ssize_t libsmdev_scsi_inquiry(
 		command.lun      |= 0x01;
 		command.reserved1 = code_page;
 	}
+	/* The allocation length of the 6-byte CDB is limited to 255 bytes
+	 * a device returns no data if it is 0
+	 */
+	if( response_size > 255 )
+	{
+		command.receive_size = 255;
+	}
+	else
+	{
+		command.receive_size = (uint8_t) response_size;
+	}
 	if( libsmdev_scsi_command(
 	     device_file,
 	     (uint8_t *) &command,
@@ -439,6 +596,136 @@ ssize_t libsmdev_scsi_inquiry(
 	return( response_count );
 }
 
+/* Sends a SCSI read capacity (16) command to the file descriptor
+ * Returns the number of bytes read if successful or -1 on error
+ */
+ssize_t libsmdev_scsi_read_capacity_16(
+         libcfile_file_t *device_file,
+         uint8_t *response,
+         size_t response_size,
+         libcerror_error_t **error )
+{
+	libsmdev_scsi_read_capacity_16_cdb_t command;
+
+	uint8_t sense[ LIBSMDEV_SCSI_SENSE_SIZE ];
+
+	static char *function = "libsmdev_scsi_read_capacity_16";
+
+	if( device_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device file.",
+		 function );
+
+		return( -1 );
+	}
+	if( response == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid response.",
+		 function );
+
+		return( -1 );
+	}
+	if( response_size < LIBSMDEV_SCSI_RESPONSE_SIZE_READ_CAPACITY_16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid response size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( response_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid response size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &command,
+	     0,
+	     sizeof( libsmdev_scsi_read_capacity_16_cdb_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear command.",
+		 function );
+
+		return( -1 );
+	}
+	/* The parameter data has a fixed size and does not contain its own size
+	 */
+	if( memory_set(
+	     response,
+	     0,
+	     LIBSMDEV_SCSI_RESPONSE_SIZE_READ_CAPACITY_16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear response.",
+		 function );
+
+		return( -1 );
+	}
+	command.operation_code = LIBSMDEV_SCSI_OPERATION_CODE_SERVICE_ACTION_IN_16;
+	command.service_action = LIBSMDEV_SCSI_SERVICE_ACTION_READ_CAPACITY_16;
+
+	byte_stream_copy_from_uint32_big_endian(
+	 command.receive_size,
+	 LIBSMDEV_SCSI_RESPONSE_SIZE_READ_CAPACITY_16 );
+
+	if( libsmdev_scsi_command(
+	     device_file,
+	     (uint8_t *) &command,
+	     sizeof( libsmdev_scsi_read_capacity_16_cdb_t ),
+	     response,
+	     LIBSMDEV_SCSI_RESPONSE_SIZE_READ_CAPACITY_16,
+	     sense,
+	     LIBSMDEV_SCSI_SENSE_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: SCSI READ CAPACITY (16) command failed.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: response:\n",
+		 function );
+		libcnotify_print_data(
+		 response,
+		 LIBSMDEV_SCSI_RESPONSE_SIZE_READ_CAPACITY_16,
+		 0 );
+	}
+#endif
+	return( (ssize_t) LIBSMDEV_SCSI_RESPONSE_SIZE_READ_CAPACITY_16 );
+}
+
 /* Sends a SCSI read table of contents (TOC) to the file descriptor
  * Returns the number of bytes read if successful or -1 on error
  */
@@ -801,23 +1088,29 @@ ssize_t libsmdev_scsi_read_track_information(
 	return( response_count );
 }
 
-/* Retrieves the SCSI identifier
- * Returns 1 if successful, 0 if not or -1 on error
+/* Sends a SCSI read CD command to the file descriptor
+ * The buffer must be large enough to contain the number of sectors in the format selected by the flags and sub-channel
+ * If duration is not NULL it is set to the time in milli seconds the drive took to read the sectors
+ * Returns 1 if successful, 0 if the device reported a check condition or -1 on error
  */
-int libsmdev_scsi_get_identifier(
+int libsmdev_scsi_read_cd(
      libcfile_file_t *device_file,
+     uint32_t lba,
+     uint32_t number_of_sectors,
+     uint8_t sector_type,
+     uint8_t flags,
+     uint8_t sub_channel,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint8_t *sense,
+     size_t sense_size,
+     uint32_t *duration,
      libcerror_error_t **error )
 {
-#if defined( SG_GET_SCSI_ID )
-	struct libsmdev_scsi_identifier
-	{
-		int four_in_one;
-		int host_unique_id;
-	} identifier;
-#endif
+	libsmdev_scsi_read_cd_cdb_t command;
 
-	static char *function = "libsmdev_scsi_get_identifier";
-	ssize_t read_count    = 0;
+	static char *function = "libsmdev_scsi_read_cd";
+	int result            = 0;
 
 	if( device_file == NULL )
 	{
@@ -830,26 +1123,999 @@ int libsmdev_scsi_get_identifier(
 
 		return( -1 );
 	}
-#if defined( SG_GET_SCSI_ID )
-	read_count = libcfile_file_io_control_read(
-	              device_file,
-	              SCSI_IOCTL_GET_IDLUN,
-	              NULL,
-	              0,
-	              (uint8_t *) &identifier,
-	              sizeof( struct libsmdev_scsi_identifier ),
-	              error );
+	if( ( number_of_sectors == 0 )
+	 || ( number_of_sectors > 0x00ffffffUL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sectors value out of bounds.",
+		 function );
 
-	if( read_count == -1 )
+		return( -1 );
+	}
+	if( sector_type > LIBSMDEV_SCSI_READ_CD_SECTOR_TYPE_MODE2_FORM2 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
-		 "%s: unable to query device for: SCSI_IOCTL_GET_IDLUN.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sector type: 0x%02" PRIx8 ".",
+		 function,
+		 sector_type );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &command,
+	     0,
+	     sizeof( libsmdev_scsi_read_cd_cdb_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear command.",
+		 function );
+
+		return( -1 );
+	}
+	command.operation_code = LIBSMDEV_SCSI_OPERATION_CODE_READ_CD;
+	command.sector_type    = (uint8_t) ( sector_type << 2 );
+	command.flags          = flags;
+	command.sub_channel    = sub_channel & 0x07;
+
+	byte_stream_copy_from_uint32_big_endian(
+	 command.lba,
+	 lba );
+
+	command.number_of_sectors[ 0 ] = (uint8_t) ( ( number_of_sectors >> 16 ) & 0xff );
+	command.number_of_sectors[ 1 ] = (uint8_t) ( ( number_of_sectors >> 8 ) & 0xff );
+	command.number_of_sectors[ 2 ] = (uint8_t) ( number_of_sectors & 0xff );
+
+	result = libsmdev_scsi_command_transfer(
+	          device_file,
+	          (uint8_t *) &command,
+	          sizeof( libsmdev_scsi_read_cd_cdb_t ),
+	          buffer,
+	          buffer_size,
+	          LIBSMDEV_SCSI_DATA_DIRECTION_FROM_DEVICE,
+	          sense,
+	          sense_size,
+	          LIBSMDEV_SCSI_DATA_COMMAND_TIMEOUT,
+	          duration,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: SCSI READ CD command failed.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sends a SCSI read (12) command to the file descriptor
+ * LIBSMDEV_SCSI_READ_12_STREAMING_FLAG_STREAMING requests the drive to favor a sustained transfer rate
+ * over its full error recovery, which is intended for reading large amounts of data from DVD and BD media
+ * The timeout is in milli seconds
+ * If duration is not NULL it is set to the time in milli seconds the drive took to read the blocks
+ * Returns 1 if successful, 0 if the device reported a check condition or -1 on error
+ */
+int libsmdev_scsi_read_12(
+     libcfile_file_t *device_file,
+     uint32_t lba,
+     uint32_t number_of_blocks,
+     uint8_t streaming_flags,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint8_t *sense,
+     size_t sense_size,
+     unsigned int timeout,
+     uint32_t *duration,
+     libcerror_error_t **error )
+{
+	libsmdev_scsi_read_12_cdb_t command;
+
+	static char *function = "libsmdev_scsi_read_12";
+	int result            = 0;
+
+	if( device_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device file.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( streaming_flags & ~( LIBSMDEV_SCSI_READ_12_STREAMING_FLAG_STREAMING ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported streaming flags: 0x%02" PRIx8 ".",
+		 function,
+		 streaming_flags );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &command,
+	     0,
+	     sizeof( libsmdev_scsi_read_12_cdb_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear command.",
+		 function );
+
+		return( -1 );
+	}
+	command.operation_code = LIBSMDEV_SCSI_OPERATION_CODE_READ_12;
+	command.streaming      = streaming_flags;
+
+	byte_stream_copy_from_uint32_big_endian(
+	 command.lba,
+	 lba );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 command.number_of_blocks,
+	 number_of_blocks );
+
+	result = libsmdev_scsi_command_transfer(
+	          device_file,
+	          (uint8_t *) &command,
+	          sizeof( libsmdev_scsi_read_12_cdb_t ),
+	          buffer,
+	          buffer_size,
+	          LIBSMDEV_SCSI_DATA_DIRECTION_FROM_DEVICE,
+	          sense,
+	          sense_size,
+	          timeout,
+	          duration,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: SCSI READ (12) command failed.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sends a SCSI set CD speed command to the file descriptor
+ * The read speed is in kB/s, where LIBSMDEV_SCSI_SET_CD_SPEED_MAXIMUM selects the maximum speed of the drive
+ * The drive rounds the read speed to a speed it supports
+ * Returns 1 if successful, 0 if the device reported a check condition or -1 on error
+ */
+int libsmdev_scsi_set_cd_speed(
+     libcfile_file_t *device_file,
+     uint16_t read_speed,
+     uint8_t *sense,
+     size_t sense_size,
+     libcerror_error_t **error )
+{
+	libsmdev_scsi_set_cd_speed_cdb_t command;
+
+	static char *function = "libsmdev_scsi_set_cd_speed";
+	int result            = 0;
+
+	if( device_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device file.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &command,
+	     0,
+	     sizeof( libsmdev_scsi_set_cd_speed_cdb_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear command.",
+		 function );
+
+		return( -1 );
+	}
+	command.operation_code = LIBSMDEV_SCSI_OPERATION_CODE_SET_CD_SPEED;
+
+	byte_stream_copy_from_uint16_big_endian(
+	 command.read_speed,
+	 read_speed );
+
+	/* Leave the write speed of the drive unchanged
+	 */
+	byte_stream_copy_from_uint16_big_endian(
+	 command.write_speed,
+	 LIBSMDEV_SCSI_SET_CD_SPEED_MAXIMUM );
+
+	result = libsmdev_scsi_command_transfer(
+	          device_file,
+	          (uint8_t *) &command,
+	          sizeof( libsmdev_scsi_set_cd_speed_cdb_t ),
+	          NULL,
+	          0,
+	          LIBSMDEV_SCSI_DATA_DIRECTION_FROM_DEVICE,
+	          sense,
+	          sense_size,
+	          LIBSMDEV_SCSI_CONTROL_COMMAND_TIMEOUT,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: SCSI SET CD SPEED command failed.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sends a SCSI set streaming command with a performance descriptor to the file descriptor
+ * The read speed is in kB/s and applies from LBA 0 up to and including the end LBA
+ * Returns 1 if successful, 0 if the device reported a check condition or -1 on error
+ */
+int libsmdev_scsi_set_streaming(
+     libcfile_file_t *device_file,
+     uint32_t end_lba,
+     uint32_t read_speed,
+     uint8_t flags,
+     uint8_t *sense,
+     size_t sense_size,
+     libcerror_error_t **error )
+{
+	libsmdev_scsi_performance_descriptor_t performance_descriptor;
+	libsmdev_scsi_set_streaming_cdb_t command;
+
+	static char *function = "libsmdev_scsi_set_streaming";
+	int result            = 0;
+
+	if( device_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device file.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &command,
+	     0,
+	     sizeof( libsmdev_scsi_set_streaming_cdb_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear command.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &performance_descriptor,
+	     0,
+	     sizeof( libsmdev_scsi_performance_descriptor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear performance descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	command.operation_code = LIBSMDEV_SCSI_OPERATION_CODE_SET_STREAMING;
+	command.type           = LIBSMDEV_SCSI_SET_STREAMING_TYPE_PERFORMANCE_DESCRIPTOR;
+
+	byte_stream_copy_from_uint16_big_endian(
+	 command.parameter_list_size,
+	 (uint16_t) sizeof( libsmdev_scsi_performance_descriptor_t ) );
+
+	performance_descriptor.flags = flags;
+
+	byte_stream_copy_from_uint32_big_endian(
+	 performance_descriptor.end_lba,
+	 end_lba );
+
+	/* The speed is expressed as the number of kB transferred in 1000 milli seconds
+	 */
+	byte_stream_copy_from_uint32_big_endian(
+	 performance_descriptor.read_size,
+	 read_speed );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 performance_descriptor.read_time,
+	 1000 );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 performance_descriptor.write_size,
+	 read_speed );
+
+	byte_stream_copy_from_uint32_big_endian(
+	 performance_descriptor.write_time,
+	 1000 );
+
+	result = libsmdev_scsi_command_transfer(
+	          device_file,
+	          (uint8_t *) &command,
+	          sizeof( libsmdev_scsi_set_streaming_cdb_t ),
+	          (uint8_t *) &performance_descriptor,
+	          sizeof( libsmdev_scsi_performance_descriptor_t ),
+	          LIBSMDEV_SCSI_DATA_DIRECTION_TO_DEVICE,
+	          sense,
+	          sense_size,
+	          LIBSMDEV_SCSI_CONTROL_COMMAND_TIMEOUT,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: SCSI SET STREAMING command failed.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Starts a sanitize operation
+ * The command returns immediately, the progress can be retrieved with libsmdev_scsi_get_sanitize_progress
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_scsi_sanitize(
+     libcfile_file_t *device_file,
+     uint8_t service_action,
+     libcerror_error_t **error )
+{
+	libsmdev_scsi_sanitize_cdb_t command;
+
+	uint8_t sense[ LIBSMDEV_SCSI_SENSE_SIZE ];
+
+	static char *function = "libsmdev_scsi_sanitize";
+	int result            = 0;
+
+	if( device_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( service_action & 0xe0 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported service action: 0x%02" PRIx8 ".",
+		 function,
+		 service_action );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &command,
+	     0,
+	     sizeof( libsmdev_scsi_sanitize_cdb_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear command.",
+		 function );
+
+		return( -1 );
+	}
+	command.operation_code = LIBSMDEV_SCSI_OPERATION_CODE_SANITIZE;
+	command.service_action = 0x80 | service_action;
+
+	result = libsmdev_scsi_command_transfer(
+	          device_file,
+	          (uint8_t *) &command,
+	          sizeof( libsmdev_scsi_sanitize_cdb_t ),
+	          NULL,
+	          0,
+	          LIBSMDEV_SCSI_DATA_DIRECTION_FROM_DEVICE,
+	          sense,
+	          LIBSMDEV_SCSI_SENSE_SIZE,
+	          LIBSMDEV_SCSI_CONTROL_COMMAND_TIMEOUT,
+	          NULL,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: device rejected SCSI SANITIZE command with sense key: 0x%02" PRIx8 ", additional sense code: 0x%02" PRIx8 ", qualifier: 0x%02" PRIx8 ".",
+			 function,
+			 ( ( sense[ 0 ] & 0x7f ) >= 0x72 ) ? sense[ 1 ] & 0x0f : sense[ 2 ] & 0x0f,
+			 ( ( sense[ 0 ] & 0x7f ) >= 0x72 ) ? sense[ 2 ] : sense[ 12 ],
+			 ( ( sense[ 0 ] & 0x7f ) >= 0x72 ) ? sense[ 3 ] : sense[ 13 ] );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: SCSI SANITIZE command failed.",
+			 function );
+		}
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the progress of a sanitize operation
+ * The progress is a value between 0 and LIBSMDEV_SCSI_SANITIZE_PROGRESS_MAXIMUM
+ * Returns 1 if a sanitize operation is in progress, 0 if not or -1 on error
+ */
+int libsmdev_scsi_get_sanitize_progress(
+     libcfile_file_t *device_file,
+     uint16_t *progress,
+     libcerror_error_t **error )
+{
+	libsmdev_scsi_request_sense_cdb_t command;
+
+	uint8_t response[ LIBSMDEV_SCSI_SENSE_SIZE ];
+	uint8_t sense[ LIBSMDEV_SCSI_SENSE_SIZE ];
+
+	static char *function                   = "libsmdev_scsi_get_sanitize_progress";
+	size_t descriptor_offset                = 0;
+	size_t sense_key_specific_offset        = 0;
+	size_t response_size                    = 0;
+	uint8_t additional_sense_code           = 0;
+	uint8_t additional_sense_code_qualifier = 0;
+	uint8_t sense_key                       = 0;
+
+	if( device_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device file.",
+		 function );
+
+		return( -1 );
+	}
+	if( progress == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid progress.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &command,
+	     0,
+	     sizeof( libsmdev_scsi_request_sense_cdb_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear command.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     response,
+	     0,
+	     LIBSMDEV_SCSI_SENSE_SIZE ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear response.",
+		 function );
+
+		return( -1 );
+	}
+	command.operation_code = LIBSMDEV_SCSI_OPERATION_CODE_REQUEST_SENSE;
+	command.receive_size   = LIBSMDEV_SCSI_SENSE_SIZE;
+
+	if( libsmdev_scsi_command_transfer(
+	     device_file,
+	     (uint8_t *) &command,
+	     sizeof( libsmdev_scsi_request_sense_cdb_t ),
+	     response,
+	     LIBSMDEV_SCSI_SENSE_SIZE,
+	     LIBSMDEV_SCSI_DATA_DIRECTION_FROM_DEVICE,
+	     sense,
+	     LIBSMDEV_SCSI_SENSE_SIZE,
+	     LIBSMDEV_SCSI_CONTROL_COMMAND_TIMEOUT,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: SCSI REQUEST SENSE command failed.",
+		 function );
+
+		return( -1 );
+	}
+	*progress = 0;
+
+	/* The sense data either is in fixed or descriptor format
+	 */
+	if( ( ( response[ 0 ] & 0x7f ) == 0x70 )
+	 || ( ( response[ 0 ] & 0x7f ) == 0x71 ) )
+	{
+		sense_key                       = response[ 2 ] & 0x0f;
+		additional_sense_code           = response[ 12 ];
+		additional_sense_code_qualifier = response[ 13 ];
+		response_size                   = (size_t) response[ 7 ] + 8;
+
+		if( response_size >= 18 )
+		{
+			sense_key_specific_offset = 15;
+		}
+	}
+	else if( ( ( response[ 0 ] & 0x7f ) == 0x72 )
+	      || ( ( response[ 0 ] & 0x7f ) == 0x73 ) )
+	{
+		sense_key                       = response[ 1 ] & 0x0f;
+		additional_sense_code           = response[ 2 ];
+		additional_sense_code_qualifier = response[ 3 ];
+		response_size                   = (size_t) response[ 7 ] + 8;
+
+		if( response_size > LIBSMDEV_SCSI_SENSE_SIZE )
+		{
+			response_size = LIBSMDEV_SCSI_SENSE_SIZE;
+		}
+		/* Find the sense key specific descriptor
+		 */
+		descriptor_offset = 8;
+
+		while( ( descriptor_offset + 2 ) <= response_size )
+		{
+			if( ( response[ descriptor_offset ] == 0x02 )
+			 && ( ( descriptor_offset + 7 ) <= response_size ) )
+			{
+				sense_key_specific_offset = descriptor_offset + 4;
+
+				break;
+			}
+			descriptor_offset += (size_t) response[ descriptor_offset + 1 ] + 2;
+		}
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sense data response code: 0x%02" PRIx8 ".",
+		 function,
+		 response[ 0 ] );
+
+		return( -1 );
+	}
+	/* Additional sense code 0x31 with qualifier 0x03 indicates the sanitize command failed
+	 */
+	if( ( additional_sense_code == 0x31 )
+	 && ( additional_sense_code_qualifier == 0x03 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: sanitize operation failed.",
+		 function );
+
+		return( -1 );
+	}
+	/* Sense key not ready with additional sense code 0x04 and qualifier 0x1b indicates a sanitize in progress
+	 */
+	if( ( sense_key != 0x02 )
+	 || ( additional_sense_code != 0x04 )
+	 || ( additional_sense_code_qualifier != 0x1b ) )
+	{
+		return( 0 );
+	}
+	/* The progress indication is only valid if the sense key specific valid (SKSV) bit is set
+	 */
+	if( ( sense_key_specific_offset != 0 )
+	 && ( ( response[ sense_key_specific_offset ] & 0x80 ) != 0 ) )
+	{
+		byte_stream_copy_to_uint16_big_endian(
+		 &( response[ sense_key_specific_offset + 1 ] ),
+		 *progress );
+	}
+	return( 1 );
+}
+
+/* Sends an ATA command that does not transfer data using the SCSI ATA pass-through (16) command
+ * The ATA status, count and LBA are retrieved from the ATA status return in the sense data
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_scsi_ata_pass_through_non_data(
+     libcfile_file_t *device_file,
+     uint8_t ata_command,
+     uint16_t features,
+     uint16_t count,
+     uint64_t lba,
+     uint8_t *status,
+     uint16_t *result_count,
+     uint64_t *result_lba,
+     libcerror_error_t **error )
+{
+	libsmdev_scsi_ata_pass_through_16_cdb_t command;
+
+	uint8_t sense[ LIBSMDEV_SCSI_SENSE_SIZE ];
+
+	static char *function    = "libsmdev_scsi_ata_pass_through_non_data";
+	size_t descriptor_offset = 0;
+	size_t sense_size        = 0;
+	int result               = 0;
+
+	if( device_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device file.",
+		 function );
+
+		return( -1 );
+	}
+	if( lba > (uint64_t) 0x0000ffffffffffffUL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid LBA value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( status == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid status.",
+		 function );
+
+		return( -1 );
+	}
+	if( result_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result count.",
+		 function );
+
+		return( -1 );
+	}
+	if( result_lba == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid result LBA.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &command,
+	     0,
+	     sizeof( libsmdev_scsi_ata_pass_through_16_cdb_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear command.",
+		 function );
+
+		return( -1 );
+	}
+	command.operation_code    = LIBSMDEV_SCSI_OPERATION_CODE_ATA_PASS_THROUGH_16;
+	command.protocol          = ( LIBSMDEV_SCSI_ATA_PROTOCOL_NON_DATA << 1 ) | 0x01;
+	command.flags             = 0x20;
+	command.lba_low           = (uint8_t) ( lba & 0xff );
+	command.lba_mid           = (uint8_t) ( ( lba >> 8 ) & 0xff );
+	command.lba_high          = (uint8_t) ( ( lba >> 16 ) & 0xff );
+	command.lba_low_extended  = (uint8_t) ( ( lba >> 24 ) & 0xff );
+	command.lba_mid_extended  = (uint8_t) ( ( lba >> 32 ) & 0xff );
+	command.lba_high_extended = (uint8_t) ( ( lba >> 40 ) & 0xff );
+	command.device            = 0x40;
+	command.command           = ata_command;
+
+	byte_stream_copy_from_uint16_big_endian(
+	 command.features,
+	 features );
+
+	byte_stream_copy_from_uint16_big_endian(
+	 command.count,
+	 count );
+
+	/* The check condition flag requests the ATA status return in the sense data
+	 */
+	result = libsmdev_scsi_command_transfer(
+	          device_file,
+	          (uint8_t *) &command,
+	          sizeof( libsmdev_scsi_ata_pass_through_16_cdb_t ),
+	          NULL,
+	          0,
+	          LIBSMDEV_SCSI_DATA_DIRECTION_FROM_DEVICE,
+	          sense,
+	          LIBSMDEV_SCSI_SENSE_SIZE,
+	          LIBSMDEV_SCSI_CONTROL_COMMAND_TIMEOUT,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: SCSI ATA PASS-THROUGH command failed.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing ATA status return.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sense[ 0 ] & 0x7f ) == 0x72 )
+	{
+		sense_size = (size_t) sense[ 7 ] + 8;
+
+		if( sense_size > LIBSMDEV_SCSI_SENSE_SIZE )
+		{
+			sense_size = LIBSMDEV_SCSI_SENSE_SIZE;
+		}
+		/* Find the ATA status return descriptor
+		 */
+		descriptor_offset = 8;
+
+		while( ( descriptor_offset + 2 ) <= sense_size )
+		{
+			if( ( sense[ descriptor_offset ] == 0x09 )
+			 && ( ( descriptor_offset + 14 ) <= sense_size ) )
+			{
+				break;
+			}
+			descriptor_offset += (size_t) sense[ descriptor_offset + 1 ] + 2;
+		}
+		if( ( descriptor_offset + 14 ) > sense_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing ATA status return descriptor.",
+			 function );
+
+			return( -1 );
+		}
+		*status       = sense[ descriptor_offset + 13 ];
+		*result_count = ( (uint16_t) sense[ descriptor_offset + 4 ] << 8 )
+		              | sense[ descriptor_offset + 5 ];
+		*result_lba   = ( (uint64_t) sense[ descriptor_offset + 10 ] << 40 )
+		              | ( (uint64_t) sense[ descriptor_offset + 8 ] << 32 )
+		              | ( (uint64_t) sense[ descriptor_offset + 6 ] << 24 )
+		              | ( (uint64_t) sense[ descriptor_offset + 11 ] << 16 )
+		              | ( (uint64_t) sense[ descriptor_offset + 9 ] << 8 )
+		              | sense[ descriptor_offset + 7 ];
+	}
+	/* In fixed format only the lower 8 bits of the count and the lower 24 bits of the LBA are available
+	 */
+	else if( ( sense[ 0 ] & 0x7f ) == 0x70 )
+	{
+		*status       = sense[ 4 ];
+		*result_count = sense[ 6 ];
+		*result_lba   = ( (uint64_t) sense[ 11 ] << 16 )
+		              | ( (uint64_t) sense[ 10 ] << 8 )
+		              | sense[ 9 ];
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported sense data response code: 0x%02" PRIx8 ".",
+		 function,
+		 sense[ 0 ] );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the SCSI identifier
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libsmdev_scsi_get_identifier(
+     libcfile_file_t *device_file,
+     libcerror_error_t **error )
+{
+#if defined( SG_GET_SCSI_ID )
+	struct libsmdev_scsi_identifier
+	{
+		int four_in_one;
+		int host_unique_id;
+	} identifier;
+#endif
+
+	static char *function = "libsmdev_scsi_get_identifier";
+	ssize_t read_count    = 0;
+
+	if( device_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( SG_GET_SCSI_ID )
+	if( memory_set(
+	     &identifier,
+	     0,
+	     sizeof( struct libsmdev_scsi_identifier ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear identifier.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libsmdev_io_control_read(
+	              device_file,
+	              SCSI_IOCTL_GET_IDLUN,
+	              (uint8_t *) &identifier,
+	              sizeof( struct libsmdev_scsi_identifier ),
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 "%s: unable to query device for: SCSI_IOCTL_GET_IDLUN.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
 			if( ( error != NULL )
@@ -932,13 +2198,25 @@ int libsmdev_scsi_get_bus_type(
 	*bus_type = LIBSMDEV_BUS_TYPE_UNKNOWN;
 
 #if defined( SCSI_IOCTL_PROBE_HOST )
+	if( memory_set(
+	     &sg_probe_host,
+	     0,
+	     128 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear probe host.",
+		 function );
+
+		return( -1 );
+	}
 	sg_probe_host.length = 127;
 
-	read_count = libcfile_file_io_control_read(
+	read_count = libsmdev_io_control_read(
 	              device_file,
 	              SCSI_IOCTL_PROBE_HOST,
-	              NULL,
-	              0,
 	              (uint8_t *) &sg_probe_host,
 	              128,
 	              error );
@@ -1015,6 +2293,13 @@ int libsmdev_scsi_get_bus_type(
 			{
 				*bus_type = LIBSMDEV_BUS_TYPE_ATA;
 			}
+			else if( narrow_string_compare(
+				  sg_probe_host.buffer,
+				  "ata_",
+				  4 ) == 0 )
+			{
+				*bus_type = LIBSMDEV_BUS_TYPE_ATA;
+			}
 			/* usb-storage
 			 */
 			else if( narrow_string_compare(
@@ -1051,6 +2336,27 @@ int libsmdev_scsi_get_bus_type(
 			}
 		}
 	}
+	if( *bus_type == 0 )
+	{
+		/* USB Attached SCSI (UAS)
+		 */
+		if( sg_probe_host_length == 3 )
+		{
+			if( narrow_string_compare(
+			     sg_probe_host.buffer,
+			     "uas",
+			     3 ) == 0 )
+			{
+				*bus_type = LIBSMDEV_BUS_TYPE_USB;
+			}
+		}
+	}
+	/* Any other host adapter, such as a SAS or parallel SCSI host adapter, is considered SCSI
+	 */
+	if( *bus_type == 0 )
+	{
+		*bus_type = LIBSMDEV_BUS_TYPE_SCSI;
+	}
 	return( 1 );
 #else
 	return( 0 );
@@ -1132,11 +2438,9 @@ int libsmdev_scsi_get_pci_bus_address(
 
 		return( -1 );
 	}
-	read_count = libcfile_file_io_control_read(
+	read_count = libsmdev_io_control_read(
 	              device_file,
 	              SCSI_IOCTL_GET_PCI,
-	              NULL,
-	              0,
 	              pci_bus_address,
 	              pci_bus_address_size,
 	              error );
@@ -36,12 +36,46 @@ extern "C" {
 
 enum LIBSMDEV_SCSI_OPERATION_CODES
 {
+	LIBSMDEV_SCSI_OPERATION_CODE_REQUEST_SENSE			= 0x03,
+
 	LIBSMDEV_SCSI_OPERATION_CODE_INQUIRY				= 0x12,
 
 	LIBSMDEV_SCSI_OPERATION_CODE_READ_TOC				= 0x43,
 
+	LIBSMDEV_SCSI_OPERATION_CODE_SANITIZE				= 0x48,
+
 	LIBSMDEV_SCSI_OPERATION_CODE_READ_DISK_INFORMATION		= 0x51,
 	LIBSMDEV_SCSI_OPERATION_CODE_READ_TRACK_INFORMATION		= 0x52,
+
+	LIBSMDEV_SCSI_OPERATION_CODE_ATA_PASS_THROUGH_16		= 0x85,
+
+	LIBSMDEV_SCSI_OPERATION_CODE_SERVICE_ACTION_IN_16		= 0x9e,
+
+	LIBSMDEV_SCSI_OPERATION_CODE_READ_12				= 0xa8,
+
+	LIBSMDEV_SCSI_OPERATION_CODE_SET_STREAMING			= 0xb6,
+	LIBSMDEV_SCSI_OPERATION_CODE_SET_CD_SPEED			= 0xbb,
+	LIBSMDEV_SCSI_OPERATION_CODE_READ_CD				= 0xbe,
+};
+
+/* The SCSI data transfer direction definitions
+ */
+enum LIBSMDEV_SCSI_DATA_DIRECTIONS
+{
+	LIBSMDEV_SCSI_DATA_DIRECTION_FROM_DEVICE			= 1,
+	LIBSMDEV_SCSI_DATA_DIRECTION_TO_DEVICE				= 2,
+};
+
+/* The SCSI sense key definitions
+ */
+enum LIBSMDEV_SCSI_SENSE_KEYS
+{
+	LIBSMDEV_SCSI_SENSE_KEY_NO_SENSE				= 0x00,
+	LIBSMDEV_SCSI_SENSE_KEY_RECOVERED_ERROR				= 0x01,
+	LIBSMDEV_SCSI_SENSE_KEY_NOT_READY				= 0x02,
+	LIBSMDEV_SCSI_SENSE_KEY_MEDIUM_ERROR				= 0x03,
+	LIBSMDEV_SCSI_SENSE_KEY_HARDWARE_ERROR				= 0x04,
+	LIBSMDEV_SCSI_SENSE_KEY_ILLEGAL_REQUEST				= 0x05,
 };
 
 /* SCSI device types:
@@ -102,6 +136,16 @@ struct libsmdev_scsi_inquiry_cdb
 	uint8_t control;
 };
 
+/* The SCSI vital product data (VPD) page codes
+ */
+enum LIBSMDEV_SCSI_VPD_PAGE_CODES
+{
+	LIBSMDEV_SCSI_VPD_PAGE_CODE_UNIT_SERIAL_NUMBER			= 0x80,
+
+	LIBSMDEV_SCSI_VPD_PAGE_CODE_BLOCK_LIMITS			= 0xb0,
+	LIBSMDEV_SCSI_VPD_PAGE_CODE_BLOCK_DEVICE_CHARACTERISTICS	= 0xb1,
+};
+
 /* The SCSI table of contents (TOC) command descriptor block (CDB)
  * format definitions
  */
@@ -232,6 +276,502 @@ struct libsmdev_scsi_read_track_information_cdb
 	uint8_t control;
 };
 
+/* The SCSI read CD command descriptor block (CDB)
+ * expected sector type definitions
+ */
+enum LIBSMDEV_SCSI_READ_CD_SECTOR_TYPES
+{
+	LIBSMDEV_SCSI_READ_CD_SECTOR_TYPE_ANY				= 0x00,
+	LIBSMDEV_SCSI_READ_CD_SECTOR_TYPE_CDDA				= 0x01,
+	LIBSMDEV_SCSI_READ_CD_SECTOR_TYPE_MODE1				= 0x02,
+	LIBSMDEV_SCSI_READ_CD_SECTOR_TYPE_MODE2_FORMLESS		= 0x03,
+	LIBSMDEV_SCSI_READ_CD_SECTOR_TYPE_MODE2_FORM1			= 0x04,
+	LIBSMDEV_SCSI_READ_CD_SECTOR_TYPE_MODE2_FORM2			= 0x05,
+};
+
+/* The SCSI read CD command descriptor block (CDB)
+ * main channel selection flag definitions
+ */
+enum LIBSMDEV_SCSI_READ_CD_FLAGS
+{
+	LIBSMDEV_SCSI_READ_CD_FLAG_C2_ERROR_POINTERS			= 0x02,
+	LIBSMDEV_SCSI_READ_CD_FLAG_EDC_ECC				= 0x08,
+	LIBSMDEV_SCSI_READ_CD_FLAG_USER_DATA				= 0x10,
+	LIBSMDEV_SCSI_READ_CD_FLAG_ALL_HEADERS				= 0x60,
+	LIBSMDEV_SCSI_READ_CD_FLAG_SYNC					= 0x80,
+};
+
+/* The SCSI read CD command descriptor block (CDB)
+ * sub-channel selection definitions
+ */
+enum LIBSMDEV_SCSI_READ_CD_SUB_CHANNELS
+{
+	LIBSMDEV_SCSI_READ_CD_SUB_CHANNEL_NONE				= 0x00,
+	LIBSMDEV_SCSI_READ_CD_SUB_CHANNEL_RAW				= 0x01,
+};
+
+/* The SCSI read CD command descriptor block (CDB)
+ */
+typedef struct libsmdev_scsi_read_cd_cdb libsmdev_scsi_read_cd_cdb_t;
+
+struct libsmdev_scsi_read_cd_cdb
+{
+	/* The operation code
+	 */
+	uint8_t operation_code;
+
+	/* The expected sector type and flag bits
+	 * Bits:
+	 * 0     reserved
+	 * 1     digital audio play (DAP) flag
+	 * 2 - 4 expected sector type
+	 * 5 - 7 reserved
+	 */
+	uint8_t sector_type;
+
+	/* The logical block address (LBA)
+	 * Contains a 32-bit big-endian value
+	 */
+	uint8_t lba[ 4 ];
+
+	/* The number of sectors to transfer (transfer length)
+	 * Contains a 24-bit big-endian value
+	 */
+	uint8_t number_of_sectors[ 3 ];
+
+	/* The main channel selection bits
+	 * Bits:
+	 * 0     reserved
+	 * 1 - 2 C2 error information
+	 * 3     EDC and ECC flag
+	 * 4     user data flag
+	 * 5 - 6 header codes
+	 * 7     sync flag
+	 */
+	uint8_t flags;
+
+	/* The sub-channel selection bits
+	 * Bits:
+	 * 0 - 2 sub-channel data selection
+	 * 3 - 7 reserved
+	 */
+	uint8_t sub_channel;
+
+	/* The control byte
+	 */
+	uint8_t control;
+};
+
+/* The SCSI read (12) command descriptor block (CDB)
+ * streaming definitions
+ */
+enum LIBSMDEV_SCSI_READ_12_STREAMING_FLAGS
+{
+	LIBSMDEV_SCSI_READ_12_STREAMING_FLAG_STREAMING			= 0x80,
+};
+
+/* The SCSI read (12) command descriptor block (CDB)
+ */
+typedef struct libsmdev_scsi_read_12_cdb libsmdev_scsi_read_12_cdb_t;
+
+struct libsmdev_scsi_read_12_cdb
+{
+	/* The operation code
+	 */
+	uint8_t operation_code;
+
+	/* The flags
+	 * Bits:
+	 * 0     reserved
+	 * 1     force unit access non-volatile cache (FUA_NV) flag
+	 * 2     reserved
+	 * 3     force unit access (FUA) flag
+	 * 4     disable page out (DPO) flag
+	 * 5 - 7 read protect
+	 */
+	uint8_t flags;
+
+	/* The LBA
+	 * Contains a 32-bit big-endian value
+	 */
+	uint8_t lba[ 4 ];
+
+	/* The number of blocks (transfer length)
+	 * Contains a 32-bit big-endian value
+	 */
+	uint8_t number_of_blocks[ 4 ];
+
+	/* The streaming and group number bits
+	 * Bits:
+	 * 0 - 4 group number
+	 * 5 - 6 reserved
+	 * 7     streaming flag
+	 */
+	uint8_t streaming;
+
+	/* The control byte
+	 */
+	uint8_t control;
+};
+
+/* The SCSI service action in (16) service actions
+ */
+enum LIBSMDEV_SCSI_SERVICE_ACTION_IN_16_SERVICE_ACTIONS
+{
+	LIBSMDEV_SCSI_SERVICE_ACTION_READ_CAPACITY_16			= 0x10,
+};
+
+/* The SCSI read capacity (16) command descriptor block (CDB)
+ */
+typedef struct libsmdev_scsi_read_capacity_16_cdb libsmdev_scsi_read_capacity_16_cdb_t;
+
+struct libsmdev_scsi_read_capacity_16_cdb
+{
+	/* The operation code
+	 */
+	uint8_t operation_code;
+
+	/* The service action and reserved bits
+	 * Bits:
+	 * 0 - 4 service action
+	 * 5 - 7 reserved
+	 */
+	uint8_t service_action;
+
+	/* The LBA (obsolete)
+	 * Contains a 64-bit big-endian value
+	 */
+	uint8_t lba[ 8 ];
+
+	/* The size of the receive buffer (allocation length)
+	 * Contains a 32-bit big-endian value
+	 */
+	uint8_t receive_size[ 4 ];
+
+	/* The partial medium indicator (PMI) and reserved bits
+	 */
+	uint8_t flags;
+
+	/* The control byte
+	 */
+	uint8_t control;
+};
+
+/* The value of the SCSI set CD speed command descriptor block (CDB)
+ * speed that selects the maximum speed of the drive
+ */
+#define LIBSMDEV_SCSI_SET_CD_SPEED_MAXIMUM	0xffff
+
+/* The SCSI set CD speed command descriptor block (CDB)
+ */
+typedef struct libsmdev_scsi_set_cd_speed_cdb libsmdev_scsi_set_cd_speed_cdb_t;
+
+struct libsmdev_scsi_set_cd_speed_cdb
+{
+	/* The operation code
+	 */
+	uint8_t operation_code;
+
+	/* The rotational control and reserved bits
+	 * Bits:
+	 * 0 - 1 rotational control
+	 * 2 - 7 reserved
+	 */
+	uint8_t rotational_control;
+
+	/* The read speed in kB/s
+	 * Contains a 16-bit big-endian value
+	 */
+	uint8_t read_speed[ 2 ];
+
+	/* The write speed in kB/s
+	 * Contains a 16-bit big-endian value
+	 */
+	uint8_t write_speed[ 2 ];
+
+	/* Reserved
+	 */
+	uint8_t reserved[ 5 ];
+
+	/* The control byte
+	 */
+	uint8_t control;
+};
+
+/* The SCSI set streaming command descriptor block (CDB)
+ * type definitions
+ */
+enum LIBSMDEV_SCSI_SET_STREAMING_TYPES
+{
+	LIBSMDEV_SCSI_SET_STREAMING_TYPE_PERFORMANCE_DESCRIPTOR		= 0x00,
+};
+
+/* The SCSI set streaming command descriptor block (CDB)
+ */
+typedef struct libsmdev_scsi_set_streaming_cdb libsmdev_scsi_set_streaming_cdb_t;
+
+struct libsmdev_scsi_set_streaming_cdb
+{
+	/* The operation code
+	 */
+	uint8_t operation_code;
+
+	/* Reserved
+	 */
+	uint8_t reserved[ 7 ];
+
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The size of the parameter list
+	 * Contains a 16-bit big-endian value
+	 */
+	uint8_t parameter_list_size[ 2 ];
+
+	/* The control byte
+	 */
+	uint8_t control;
+};
+
+/* The SCSI performance descriptor flags definitions
+ */
+enum LIBSMDEV_SCSI_PERFORMANCE_DESCRIPTOR_FLAGS
+{
+	LIBSMDEV_SCSI_PERFORMANCE_DESCRIPTOR_FLAG_RANDOM_ACCESS		= 0x01,
+	LIBSMDEV_SCSI_PERFORMANCE_DESCRIPTOR_FLAG_EXACT			= 0x02,
+	LIBSMDEV_SCSI_PERFORMANCE_DESCRIPTOR_FLAG_RESTORE_DEFAULTS	= 0x04,
+};
+
+/* The SCSI set streaming performance descriptor
+ */
+typedef struct libsmdev_scsi_performance_descriptor libsmdev_scsi_performance_descriptor_t;
+
+struct libsmdev_scsi_performance_descriptor
+{
+	/* The flags
+	 * Bits:
+	 * 0     random access (RA) flag
+	 * 1     exact flag
+	 * 2     restore drive defaults (RDD) flag
+	 * 3 - 4 write rotation control (WRC)
+	 * 5 - 7 reserved
+	 */
+	uint8_t flags;
+
+	/* Reserved
+	 */
+	uint8_t reserved[ 3 ];
+
+	/* The start LBA
+	 * Contains a 32-bit big-endian value
+	 */
+	uint8_t start_lba[ 4 ];
+
+	/* The end LBA
+	 * Contains a 32-bit big-endian value
+	 */
+	uint8_t end_lba[ 4 ];
+
+	/* The read size in kB
+	 * Contains a 32-bit big-endian value
+	 */
+	uint8_t read_size[ 4 ];
+
+	/* The read time in milli seconds
+	 * Contains a 32-bit big-endian value
+	 */
+	uint8_t read_time[ 4 ];
+
+	/* The write size in kB
+	 * Contains a 32-bit big-endian value
+	 */
+	uint8_t write_size[ 4 ];
+
+	/* The write time in milli seconds
+	 * Contains a 32-bit big-endian value
+	 */
+	uint8_t write_time[ 4 ];
+};
+
+/* The SCSI request sense command descriptor block (CDB)
+ */
+typedef struct libsmdev_scsi_request_sense_cdb libsmdev_scsi_request_sense_cdb_t;
+
+struct libsmdev_scsi_request_sense_cdb
+{
+	/* The operation code
+	 */
+	uint8_t operation_code;
+
+	/* The descriptor format and reserved bits
+	 * Bits:
+	 * 0     descriptor format
+	 * 1 - 7 reserved
+	 */
+	uint8_t descriptor_format;
+
+	/* Reserved
+	 */
+	uint8_t reserved[ 2 ];
+
+	/* The size of the receive buffer (allocation length)
+	 */
+	uint8_t receive_size;
+
+	/* The control byte
+	 */
+	uint8_t control;
+};
+
+/* The SCSI sanitize command descriptor block (CDB)
+ * service action definitions
+ */
+enum LIBSMDEV_SCSI_SANITIZE_SERVICE_ACTIONS
+{
+	LIBSMDEV_SCSI_SANITIZE_SERVICE_ACTION_OVERWRITE			= 0x01,
+	LIBSMDEV_SCSI_SANITIZE_SERVICE_ACTION_BLOCK_ERASE		= 0x02,
+	LIBSMDEV_SCSI_SANITIZE_SERVICE_ACTION_CRYPTOGRAPHIC_ERASE	= 0x03,
+	LIBSMDEV_SCSI_SANITIZE_SERVICE_ACTION_EXIT_FAILURE_MODE		= 0x1f,
+};
+
+/* The SCSI sanitize command descriptor block (CDB)
+ */
+typedef struct libsmdev_scsi_sanitize_cdb libsmdev_scsi_sanitize_cdb_t;
+
+struct libsmdev_scsi_sanitize_cdb
+{
+	/* The operation code
+	 */
+	uint8_t operation_code;
+
+	/* The service action and flag bits
+	 * Bits:
+	 * 0 - 4 service action
+	 * 5     allow unrestricted sanitize exit (AUSE) flag
+	 * 6     reserved
+	 * 7     immediate flag
+	 */
+	uint8_t service_action;
+
+	/* Reserved
+	 */
+	uint8_t reserved[ 5 ];
+
+	/* The size of the parameter list
+	 * Contains a 16-bit big-endian value
+	 */
+	uint8_t parameter_list_size[ 2 ];
+
+	/* The control byte
+	 */
+	uint8_t control;
+};
+
+/* The SCSI ATA pass-through protocol definitions
+ */
+enum LIBSMDEV_SCSI_ATA_PROTOCOLS
+{
+	LIBSMDEV_SCSI_ATA_PROTOCOL_NON_DATA				= 0x03,
+};
+
+/* The ATA command definitions used with the SCSI ATA pass-through command
+ */
+enum LIBSMDEV_SCSI_ATA_COMMANDS
+{
+	LIBSMDEV_SCSI_ATA_COMMAND_SANITIZE_DEVICE			= 0xb4,
+};
+
+/* The ATA sanitize device feature definitions
+ */
+enum LIBSMDEV_SCSI_ATA_SANITIZE_FEATURES
+{
+	LIBSMDEV_SCSI_ATA_SANITIZE_FEATURE_STATUS_EXT			= 0x0000,
+	LIBSMDEV_SCSI_ATA_SANITIZE_FEATURE_CRYPTO_SCRAMBLE_EXT		= 0x0011,
+	LIBSMDEV_SCSI_ATA_SANITIZE_FEATURE_BLOCK_ERASE_EXT		= 0x0012,
+	LIBSMDEV_SCSI_ATA_SANITIZE_FEATURE_OVERWRITE_EXT		= 0x0014,
+};
+
+/* The ATA sanitize device block erase signature: "BkEr"
+ */
+#define LIBSMDEV_SCSI_ATA_SANITIZE_BLOCK_ERASE_SIGNATURE	0x426b4572UL
+
+/* The SCSI ATA pass-through (16) command descriptor block (CDB)
+ */
+typedef struct libsmdev_scsi_ata_pass_through_16_cdb libsmdev_scsi_ata_pass_through_16_cdb_t;
+
+struct libsmdev_scsi_ata_pass_through_16_cdb
+{
+	/* The operation code
+	 */
+	uint8_t operation_code;
+
+	/* The protocol and extend bits
+	 * Bits:
+	 * 0     extend flag
+	 * 1 - 4 protocol
+	 * 5 - 7 multiple count
+	 */
+	uint8_t protocol;
+
+	/* The transfer and check condition bits
+	 * Bits:
+	 * 0 - 1 transfer length type
+	 * 2     transfer in blocks flag
+	 * 3     transfer direction
+	 * 4     transfer type
+	 * 5     check condition flag
+	 * 6 - 7 off-line
+	 */
+	uint8_t flags;
+
+	/* The features
+	 * Contains a 16-bit big-endian value
+	 */
+	uint8_t features[ 2 ];
+
+	/* The (sector) count
+	 * Contains a 16-bit big-endian value
+	 */
+	uint8_t count[ 2 ];
+
+	/* The LBA bits 24 - 31
+	 */
+	uint8_t lba_low_extended;
+
+	/* The LBA bits 0 - 7
+	 */
+	uint8_t lba_low;
+
+	/* The LBA bits 32 - 39
+	 */
+	uint8_t lba_mid_extended;
+
+	/* The LBA bits 8 - 15
+	 */
+	uint8_t lba_mid;
+
+	/* The LBA bits 40 - 47
+	 */
+	uint8_t lba_high_extended;
+
+	/* The LBA bits 16 - 23
+	 */
+	uint8_t lba_high;
+
+	/* The device
+	 */
+	uint8_t device;
+
+	/* The ATA command
+	 */
+	uint8_t command;
+
+	/* The control byte
+	 */
+	uint8_t control;
+};
+
 /* The SCSI ioctrl header
  */
 typedef struct libsmdev_scsi_ioctrl_header libsmdev_scsi_ioctrl_header_t;
@@ -250,8 +790,13 @@ struct libsmdev_scsi_ioctrl_header
 	 */
 };
 
-#define LIBSMDEV_SCSI_RESPONSE_SIZE_INQUIRY	96
-#define LIBSMDEV_SCSI_SENSE_SIZE		32
+#define LIBSMDEV_SCSI_RESPONSE_SIZE_INQUIRY		96
+#define LIBSMDEV_SCSI_RESPONSE_SIZE_READ_CAPACITY_16	32
+#define LIBSMDEV_SCSI_SENSE_SIZE			32
+
+/* The maximum value of the sanitize progress indication, which corresponds to 100%
+ */
+#define LIBSMDEV_SCSI_SANITIZE_PROGRESS_MAXIMUM	65536
 
 int libsmdev_scsi_command(
      libcfile_file_t *device_file,
@@ -263,6 +808,19 @@ int libsmdev_scsi_command(
      size_t sense_size,
      libcerror_error_t **error );
 
+int libsmdev_scsi_command_transfer(
+     libcfile_file_t *device_file,
+     uint8_t *command,
+     size_t command_size,
+     uint8_t *data,
+     size_t data_size,
+     uint8_t data_direction,
+     uint8_t *sense,
+     size_t sense_size,
+     unsigned int timeout,
+     uint32_t *duration,
+     libcerror_error_t **error );
+
 int libsmdev_scsi_ioctrl(
      libcfile_file_t *device_file,
      void *request_data,
@@ -277,6 +835,12 @@ ssize_t libsmdev_scsi_inquiry(
          size_t response_size,
          libcerror_error_t **error );
 
+ssize_t libsmdev_scsi_read_capacity_16(
+         libcfile_file_t *device_file,
+         uint8_t *response,
+         size_t response_size,
+         libcerror_error_t **error );
+
 ssize_t libsmdev_scsi_read_toc(
          libcfile_file_t *device_file,
          uint8_t format,
@@ -297,6 +861,70 @@ ssize_t libsmdev_scsi_read_track_information(
          size_t response_size,
          libcerror_error_t **error );
 
+int libsmdev_scsi_read_cd(
+     libcfile_file_t *device_file,
+     uint32_t lba,
+     uint32_t number_of_sectors,
+     uint8_t sector_type,
+     uint8_t flags,
+     uint8_t sub_channel,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint8_t *sense,
+     size_t sense_size,
+     uint32_t *duration,
+     libcerror_error_t **error );
+
+int libsmdev_scsi_read_12(
+     libcfile_file_t *device_file,
+     uint32_t lba,
+     uint32_t number_of_blocks,
+     uint8_t streaming_flags,
+     uint8_t *buffer,
+     size_t buffer_size,
+     uint8_t *sense,
+     size_t sense_size,
+     unsigned int timeout,
+     uint32_t *duration,
+     libcerror_error_t **error );
+
+int libsmdev_scsi_set_cd_speed(
+     libcfile_file_t *device_file,
+     uint16_t read_speed,
+     uint8_t *sense,
+     size_t sense_size,
+     libcerror_error_t **error );
+
+int libsmdev_scsi_set_streaming(
+     libcfile_file_t *device_file,
+     uint32_t end_lba,
+     uint32_t read_speed,
+     uint8_t flags,
+     uint8_t *sense,
+     size_t sense_size,
+     libcerror_error_t **error );
+
+int libsmdev_scsi_sanitize(
+     libcfile_file_t *device_file,
+     uint8_t service_action,
+     libcerror_error_t **error );
+
+int libsmdev_scsi_get_sanitize_progress(
+     libcfile_file_t *device_file,
+     uint16_t *progress,
+     libcerror_error_t **error );
+
+int libsmdev_scsi_ata_pass_through_non_data(
+     libcfile_file_t *device_file,
+     uint8_t ata_command,
+     uint16_t features,
+     uint16_t count,
+     uint64_t lba,
+     uint8_t *status,
+     uint16_t *result_count,
+     uint64_t *result_lba,
+     libcerror_error_t **error );
+
 int libsmdev_scsi_get_identifier(
      libcfile_file_t *device_file,
      libcerror_error_t **error );
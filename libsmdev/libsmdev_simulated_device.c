@@ -0,0 +1,1802 @@
+/*
+ * Simulated device functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_NANOSLEEP )
+#include <time.h>
+#endif
+
+#if defined( WINAPI )
+#include <winioctl.h>
+
+#elif defined( HAVE_CYGWIN_FS_H )
+#include <cygwin/fs.h>
+
+#elif defined( HAVE_LINUX_FS_H )
+/* Required for Linux platforms that use a sizeof( u64 )
+ * in linux/fs.h but have no typedef of it
+ */
+#if !defined( HAVE_U64 )
+typedef size_t u64;
+#endif
+
+#include <linux/fs.h>
+
+#else
+
+#if defined( HAVE_SYS_DISK_H )
+#include <sys/disk.h>
+#endif
+
+#if defined( HAVE_SYS_DISKLABEL_H )
+#include <sys/disklabel.h>
+#endif
+
+#endif /* defined( WINAPI ) */
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_simulated_device.h"
+
+/* Frees a simulated device range
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_simulated_device_range_free(
+     libsmdev_simulated_device_range_t **range,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_simulated_device_range_free";
+
+	if( range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range.",
+		 function );
+
+		return( -1 );
+	}
+	if( *range != NULL )
+	{
+		memory_free(
+		 *range );
+
+		*range = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates a simulated device
+ * Make sure the value simulated_device is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_simulated_device_initialize(
+     libsmdev_simulated_device_t **simulated_device,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_simulated_device_initialize";
+
+	if( simulated_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid simulated device.",
+		 function );
+
+		return( -1 );
+	}
+	if( *simulated_device != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid simulated device value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*simulated_device = memory_allocate_structure(
+	                     libsmdev_simulated_device_t );
+
+	if( *simulated_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create simulated device.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *simulated_device,
+	     0,
+	     sizeof( libsmdev_simulated_device_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear simulated device.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *simulated_device )->ranges_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create ranges array.",
+		 function );
+
+		goto on_error;
+	}
+	( *simulated_device )->bytes_per_sector = 512;
+	( *simulated_device )->removal_offset   = -1;
+	( *simulated_device )->random_state     = 0x2545f491UL;
+
+	return( 1 );
+
+on_error:
+	if( *simulated_device != NULL )
+	{
+		memory_free(
+		 *simulated_device );
+
+		*simulated_device = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a simulated device
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_simulated_device_free(
+     libsmdev_simulated_device_t **simulated_device,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_simulated_device_free";
+	int result            = 1;
+
+	if( simulated_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid simulated device.",
+		 function );
+
+		return( -1 );
+	}
+	if( *simulated_device != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *simulated_device )->ranges_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_simulated_device_range_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free ranges array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *simulated_device );
+
+		*simulated_device = NULL;
+	}
+	return( result );
+}
+
+/* Appends a range to the simulated device
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_simulated_device_append_range(
+     libsmdev_simulated_device_t *simulated_device,
+     int type,
+     off64_t start_offset,
+     size64_t size,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	libsmdev_simulated_device_range_t *range = NULL;
+	static char *function                    = "libsmdev_simulated_device_append_range";
+	int entry_index                          = 0;
+
+	if( simulated_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid simulated device.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( type < LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_BAD )
+	 || ( type > LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_SHORT_READ ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported range type: %d.",
+		 function,
+		 type );
+
+		return( -1 );
+	}
+	if( start_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid start offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size64_t) ( INT64_MAX - start_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( type == LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_PROBABILITY )
+	 && ( value > 100 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid probability value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( type == LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_SHORT_READ )
+	 && ( value == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid short read size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	range = memory_allocate_structure(
+	         libsmdev_simulated_device_range_t );
+
+	if( range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range.",
+		 function );
+
+		goto on_error;
+	}
+	range->type               = type;
+	range->start_offset       = start_offset;
+	range->end_offset         = start_offset + (off64_t) size;
+	range->value              = value;
+	range->number_of_attempts = 0;
+
+	if( libcdata_array_append_entry(
+	     simulated_device->ranges_array,
+	     &entry_index,
+	     (intptr_t *) range,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append range to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( range != NULL )
+	{
+		memory_free(
+		 range );
+	}
+	return( -1 );
+}
+
+/* Parses an integer value from a string
+ * The value is either in decimal or in hexadecimal prefixed by 0x
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_simulated_device_parse_integer(
+     const char *string,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_simulated_device_parse_integer";
+	uint64_t base         = 10;
+	uint64_t digit        = 0;
+	uint64_t safe_value   = 0;
+	size_t string_index   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string[ 0 ] == '0' )
+	 && ( ( string[ 1 ] == 'x' )
+	  ||  ( string[ 1 ] == 'X' ) ) )
+	{
+		base         = 16;
+		string_index = 2;
+	}
+	if( string[ string_index ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: missing digits.",
+		 function );
+
+		return( -1 );
+	}
+	while( string[ string_index ] != 0 )
+	{
+		if( ( string[ string_index ] >= '0' )
+		 && ( string[ string_index ] <= '9' ) )
+		{
+			digit = (uint64_t) ( string[ string_index ] - '0' );
+		}
+		else if( ( base == 16 )
+		      && ( string[ string_index ] >= 'a' )
+		      && ( string[ string_index ] <= 'f' ) )
+		{
+			digit = (uint64_t) ( string[ string_index ] - 'a' ) + 10;
+		}
+		else if( ( base == 16 )
+		      && ( string[ string_index ] >= 'A' )
+		      && ( string[ string_index ] <= 'F' ) )
+		{
+			digit = (uint64_t) ( string[ string_index ] - 'A' ) + 10;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unsupported character: 0x%02" PRIx8 " at index: %" PRIzd ".",
+			 function,
+			 (uint8_t) string[ string_index ],
+			 string_index );
+
+			return( -1 );
+		}
+		if( safe_value > ( ( UINT64_MAX - digit ) / base ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		safe_value *= base;
+		safe_value += digit;
+
+		string_index++;
+	}
+	*value = safe_value;
+
+	return( 1 );
+}
+
+/* Reads a simulated device scenario line
+ * The line is modified during parsing
+ *
+ * The following statements are supported, one per line, where # starts a comment:
+ *   size <media size>
+ *   bytes_per_sector <bytes per sector>
+ *   physical_bytes_per_sector <bytes per physical sector>
+ *   alignment_offset <offset of the first physical sector boundary>
+ *   seed <pseudo random number generator seed>
+ *   drift                   the offset is set to the position of the error on a failed read
+ *   real_time               latency is applied in real time instead of only simulated
+ *   remove <offset>         the device is removed when a read reaches the offset
+ *   bad <offset> <size>
+ *   retry <offset> <size> <number of attempts until a read succeeds>
+ *   probability <offset> <size> <percentage of read attempts that succeed>
+ *   latency <offset> <size> <micro seconds per read>
+ *   short_read <offset> <size> <maximum number of bytes returned per read>
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_simulated_device_read_scenario_line(
+     libsmdev_simulated_device_t *simulated_device,
+     char *line,
+     libcerror_error_t **error )
+{
+	char *value_strings[ LIBSMDEV_SIMULATED_DEVICE_MAXIMUM_NUMBER_OF_VALUES ];
+	uint64_t values[ LIBSMDEV_SIMULATED_DEVICE_MAXIMUM_NUMBER_OF_VALUES ];
+
+	char *keyword                 = NULL;
+	static char *function         = "libsmdev_simulated_device_read_scenario_line";
+	size_t keyword_length         = 0;
+	size_t line_index             = 0;
+	int expected_number_of_values = 0;
+	int number_of_values          = 0;
+	int range_type                = 0;
+	int value_index               = 0;
+
+	if( simulated_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid simulated device.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	/* Split the line into a keyword and values
+	 */
+	while( line[ line_index ] != 0 )
+	{
+		if( line[ line_index ] == '#' )
+		{
+			line[ line_index ] = 0;
+
+			break;
+		}
+		if( ( line[ line_index ] == ' ' )
+		 || ( line[ line_index ] == '\t' )
+		 || ( line[ line_index ] == '\r' )
+		 || ( line[ line_index ] == '\n' ) )
+		{
+			line[ line_index++ ] = 0;
+
+			continue;
+		}
+		if( ( line_index == 0 )
+		 || ( line[ line_index - 1 ] == 0 ) )
+		{
+			if( keyword == NULL )
+			{
+				keyword = &( line[ line_index ] );
+			}
+			else if( number_of_values < LIBSMDEV_SIMULATED_DEVICE_MAXIMUM_NUMBER_OF_VALUES )
+			{
+				value_strings[ number_of_values++ ] = &( line[ line_index ] );
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: too many values.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		line_index++;
+	}
+	if( keyword == NULL )
+	{
+		return( 1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libsmdev_simulated_device_parse_integer(
+		     value_strings[ value_index ],
+		     &( values[ value_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to parse value: %d of keyword: %s.",
+			 function,
+			 value_index,
+			 keyword );
+
+			return( -1 );
+		}
+		/* Offsets and sizes are stored as signed 64-bit values
+		 */
+		if( values[ value_index ] > (uint64_t) INT64_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value: %d of keyword: %s value out of bounds.",
+			 function,
+			 value_index,
+			 keyword );
+
+			return( -1 );
+		}
+	}
+	keyword_length = narrow_string_length(
+	                  keyword );
+
+	if( ( keyword_length == 4 )
+	 && ( narrow_string_compare(
+	       keyword,
+	       "size",
+	       4 ) == 0 ) )
+	{
+		expected_number_of_values = 1;
+
+		if( number_of_values == 1 )
+		{
+			simulated_device->media_size = (size64_t) values[ 0 ];
+		}
+	}
+	else if( ( keyword_length == 16 )
+	      && ( narrow_string_compare(
+	            keyword,
+	            "bytes_per_sector",
+	            16 ) == 0 ) )
+	{
+		expected_number_of_values = 1;
+
+		if( number_of_values == 1 )
+		{
+			if( ( values[ 0 ] == 0 )
+			 || ( values[ 0 ] > (uint64_t) UINT32_MAX ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid bytes per sector value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			simulated_device->bytes_per_sector = (uint32_t) values[ 0 ];
+		}
+	}
+	else if( ( keyword_length == 25 )
+	      && ( narrow_string_compare(
+	            keyword,
+	            "physical_bytes_per_sector",
+	            25 ) == 0 ) )
+	{
+		expected_number_of_values = 1;
+
+		if( number_of_values == 1 )
+		{
+			if( ( values[ 0 ] == 0 )
+			 || ( values[ 0 ] > (uint64_t) UINT32_MAX ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid physical bytes per sector value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			simulated_device->physical_bytes_per_sector = (uint32_t) values[ 0 ];
+		}
+	}
+	else if( ( keyword_length == 16 )
+	      && ( narrow_string_compare(
+	            keyword,
+	            "alignment_offset",
+	            16 ) == 0 ) )
+	{
+		expected_number_of_values = 1;
+
+		if( number_of_values == 1 )
+		{
+			if( values[ 0 ] > (uint64_t) INT32_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid alignment offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			simulated_device->alignment_offset = (uint32_t) values[ 0 ];
+		}
+	}
+	else if( ( keyword_length == 4 )
+	      && ( narrow_string_compare(
+	            keyword,
+	            "seed",
+	            4 ) == 0 ) )
+	{
+		expected_number_of_values = 1;
+
+		/* The xorshift state cannot be 0
+		 */
+		if( ( number_of_values == 1 )
+		 && ( (uint32_t) values[ 0 ] != 0 ) )
+		{
+			simulated_device->random_state = (uint32_t) values[ 0 ];
+		}
+	}
+	else if( ( keyword_length == 5 )
+	      && ( narrow_string_compare(
+	            keyword,
+	            "drift",
+	            5 ) == 0 ) )
+	{
+		simulated_device->offset_drift = 1;
+	}
+	else if( ( keyword_length == 9 )
+	      && ( narrow_string_compare(
+	            keyword,
+	            "real_time",
+	            9 ) == 0 ) )
+	{
+		simulated_device->real_time = 1;
+	}
+	else if( ( keyword_length == 6 )
+	      && ( narrow_string_compare(
+	            keyword,
+	            "remove",
+	            6 ) == 0 ) )
+	{
+		expected_number_of_values = 1;
+
+		if( number_of_values == 1 )
+		{
+			simulated_device->removal_offset = (off64_t) values[ 0 ];
+		}
+	}
+	else if( ( keyword_length == 3 )
+	      && ( narrow_string_compare(
+	            keyword,
+	            "bad",
+	            3 ) == 0 ) )
+	{
+		range_type                = LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_BAD;
+		expected_number_of_values = 2;
+	}
+	else if( ( keyword_length == 5 )
+	      && ( narrow_string_compare(
+	            keyword,
+	            "retry",
+	            5 ) == 0 ) )
+	{
+		range_type                = LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_RETRY;
+		expected_number_of_values = 3;
+	}
+	else if( ( keyword_length == 11 )
+	      && ( narrow_string_compare(
+	            keyword,
+	            "probability",
+	            11 ) == 0 ) )
+	{
+		range_type                = LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_PROBABILITY;
+		expected_number_of_values = 3;
+	}
+	else if( ( keyword_length == 7 )
+	      && ( narrow_string_compare(
+	            keyword,
+	            "latency",
+	            7 ) == 0 ) )
+	{
+		range_type                = LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_LATENCY;
+		expected_number_of_values = 3;
+	}
+	else if( ( keyword_length == 10 )
+	      && ( narrow_string_compare(
+	            keyword,
+	            "short_read",
+	            10 ) == 0 ) )
+	{
+		range_type                = LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_SHORT_READ;
+		expected_number_of_values = 3;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported keyword: %s.",
+		 function,
+		 keyword );
+
+		return( -1 );
+	}
+	if( number_of_values != expected_number_of_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values for keyword: %s.",
+		 function,
+		 keyword );
+
+		return( -1 );
+	}
+	if( range_type != 0 )
+	{
+		if( libsmdev_simulated_device_append_range(
+		     simulated_device,
+		     range_type,
+		     (off64_t) values[ 0 ],
+		     (size64_t) values[ 1 ],
+		     ( number_of_values == 3 ) ? values[ 2 ] : 0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append range of keyword: %s.",
+			 function,
+			 keyword );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads a simulated device scenario
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_simulated_device_read_scenario(
+     libsmdev_simulated_device_t *simulated_device,
+     FILE *file_stream,
+     libcerror_error_t **error )
+{
+	char line[ LIBSMDEV_SIMULATED_DEVICE_MAXIMUM_LINE_SIZE ];
+
+	static char *function = "libsmdev_simulated_device_read_scenario";
+	int line_number       = 0;
+
+	if( simulated_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid simulated device.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file stream.",
+		 function );
+
+		return( -1 );
+	}
+	while( file_stream_get_string(
+	        file_stream,
+	        line,
+	        LIBSMDEV_SIMULATED_DEVICE_MAXIMUM_LINE_SIZE ) != NULL )
+	{
+		line_number++;
+
+		if( libsmdev_simulated_device_read_scenario_line(
+		     simulated_device,
+		     line,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read line: %d.",
+			 function,
+			 line_number );
+
+			return( -1 );
+		}
+	}
+	if( simulated_device->media_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing media size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a simulated device
+ * The filename refers to the scenario file that describes the device
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_simulated_device_open(
+     libsmdev_simulated_device_t *simulated_device,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	FILE *file_stream     = NULL;
+	static char *function = "libsmdev_simulated_device_open";
+
+	if( simulated_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid simulated device.",
+		 function );
+
+		return( -1 );
+	}
+	if( simulated_device->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid simulated device - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBSMDEV_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access to simulated device currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_OPEN_READ );
+
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open scenario file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libsmdev_simulated_device_read_scenario(
+	     simulated_device,
+	     file_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read scenario file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close scenario file.",
+		 function );
+
+		file_stream = NULL;
+
+		goto on_error;
+	}
+	simulated_device->current_offset         = 0;
+	simulated_device->is_open                = 1;
+	simulated_device->is_removed             = 0;
+	simulated_device->number_of_reads        = 0;
+	simulated_device->number_of_failed_reads = 0;
+	simulated_device->elapsed_time           = 0;
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	libcdata_array_empty(
+	 simulated_device->ranges_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_simulated_device_range_free,
+	 NULL );
+
+	simulated_device->media_size = 0;
+
+	return( -1 );
+}
+
+/* Closes a simulated device
+ * Returns 0 if successful or -1 on error
+ */
+int libsmdev_simulated_device_close(
+     libsmdev_simulated_device_t *simulated_device,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_simulated_device_close";
+
+	if( simulated_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid simulated device.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     simulated_device->ranges_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_simulated_device_range_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty ranges array.",
+		 function );
+
+		return( -1 );
+	}
+	simulated_device->media_size     = 0;
+	simulated_device->current_offset = 0;
+	simulated_device->is_open        = 0;
+
+	return( 0 );
+}
+
+/* Attempts a read of a range that contains a read error condition
+ * Every read that overlaps with the range counts as an attempt
+ * Returns 1 if the read succeeds, 0 if the read fails or -1 on error
+ */
+int libsmdev_simulated_device_attempt_read(
+     libsmdev_simulated_device_t *simulated_device,
+     libsmdev_simulated_device_range_t *range,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_simulated_device_attempt_read";
+	uint32_t random_value = 0;
+
+	if( simulated_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid simulated device.",
+		 function );
+
+		return( -1 );
+	}
+	if( range == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range.",
+		 function );
+
+		return( -1 );
+	}
+	range->number_of_attempts += 1;
+
+	switch( range->type )
+	{
+		case LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_BAD:
+			return( 0 );
+
+		case LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_RETRY:
+			if( range->number_of_attempts >= range->value )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		case LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_PROBABILITY:
+			/* Use xorshift32 to have a reproducible sequence for a specific seed
+			 */
+			random_value = simulated_device->random_state;
+
+			random_value ^= random_value << 13;
+			random_value ^= random_value >> 17;
+			random_value ^= random_value << 5;
+
+			simulated_device->random_state = random_value;
+
+			if( (uint64_t) ( random_value % 100 ) < range->value )
+			{
+				return( 1 );
+			}
+			return( 0 );
+
+		default:
+			break;
+	}
+	return( 1 );
+}
+
+/* Reads a buffer from the simulated device
+ * The data of the simulated device consists of a repeating pattern based on the offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_simulated_device_read_buffer(
+         libsmdev_simulated_device_t *simulated_device,
+         uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+#if defined( HAVE_NANOSLEEP )
+	struct timespec delay;
+#endif
+
+	libsmdev_simulated_device_range_t *range = NULL;
+	static char *function                    = "libsmdev_simulated_device_read_buffer";
+	off64_t end_offset                       = 0;
+	off64_t error_offset                     = 0;
+	uint64_t latency                         = 0;
+	size_t buffer_index                      = 0;
+	size_t read_size                         = 0;
+	int entry_index                          = 0;
+	int number_of_entries                    = 0;
+	int result                               = 0;
+
+	if( simulated_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid simulated device.",
+		 function );
+
+		return( -1 );
+	}
+	if( simulated_device->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid simulated device - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	*error_code = 0;
+
+	if( ( simulated_device->is_removed == 0 )
+	 && ( simulated_device->removal_offset >= 0 )
+	 && ( ( simulated_device->current_offset + (off64_t) size ) > simulated_device->removal_offset ) )
+	{
+		simulated_device->is_removed = 1;
+	}
+	if( simulated_device->is_removed != 0 )
+	{
+#if defined( WINAPI )
+		*error_code = (uint32_t) ERROR_DEV_NOT_EXIST;
+#else
+		*error_code = (uint32_t) ENODEV;
+#endif
+		simulated_device->number_of_failed_reads += 1;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: simulated device was removed.",
+		 function );
+
+		return( -1 );
+	}
+	simulated_device->number_of_reads += 1;
+
+	if( simulated_device->current_offset >= (off64_t) simulated_device->media_size )
+	{
+		return( 0 );
+	}
+	read_size = size;
+
+	if( (size64_t) read_size > ( simulated_device->media_size - simulated_device->current_offset ) )
+	{
+		read_size = (size_t) ( simulated_device->media_size - simulated_device->current_offset );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     simulated_device->ranges_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+	/* Apply the latency and short read conditions of the ranges
+	 * that contain the start of the read first
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     simulated_device->ranges_array,
+		     entry_index,
+		     (intptr_t **) &range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve range: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( range == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing range: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( simulated_device->current_offset < range->start_offset )
+		 || ( simulated_device->current_offset >= range->end_offset ) )
+		{
+			continue;
+		}
+		if( range->type == LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_LATENCY )
+		{
+			latency += range->value;
+		}
+		else if( ( range->type == LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_SHORT_READ )
+		      && ( (uint64_t) read_size > range->value ) )
+		{
+			read_size = (size_t) range->value;
+		}
+	}
+	if( latency > 0 )
+	{
+		simulated_device->elapsed_time += latency;
+
+		if( simulated_device->real_time != 0 )
+		{
+#if defined( HAVE_NANOSLEEP )
+			delay.tv_sec  = (time_t) ( latency / 1000000 );
+			delay.tv_nsec = (long) ( latency % 1000000 ) * 1000;
+
+			while( nanosleep(
+			        &delay,
+			        &delay ) != 0 )
+			{
+				if( errno != EINTR )
+				{
+					break;
+				}
+			}
+#elif defined( WINAPI )
+			Sleep(
+			 (DWORD) ( latency / 1000 ) );
+#endif
+		}
+	}
+	/* Determine the lowest offset in the read at which a read error condition occurs
+	 */
+	end_offset   = simulated_device->current_offset + (off64_t) read_size;
+	error_offset = end_offset;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     simulated_device->ranges_array,
+		     entry_index,
+		     (intptr_t **) &range,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve range: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( range->type == LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_LATENCY )
+		 || ( range->type == LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_SHORT_READ ) )
+		{
+			continue;
+		}
+		if( ( range->end_offset <= simulated_device->current_offset )
+		 || ( range->start_offset >= end_offset ) )
+		{
+			continue;
+		}
+		result = libsmdev_simulated_device_attempt_read(
+		          simulated_device,
+		          range,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to attempt read of range: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( range->start_offset <= simulated_device->current_offset )
+			{
+				error_offset = simulated_device->current_offset;
+			}
+			else if( range->start_offset < error_offset )
+			{
+				error_offset = range->start_offset;
+			}
+		}
+	}
+	read_size = (size_t) ( error_offset - simulated_device->current_offset );
+
+	for( buffer_index = 0;
+	     buffer_index < read_size;
+	     buffer_index++ )
+	{
+		buffer[ buffer_index ] = (uint8_t) ( ( simulated_device->current_offset + (off64_t) buffer_index ) % 251 );
+	}
+	if( error_offset < end_offset )
+	{
+		simulated_device->number_of_failed_reads += 1;
+
+		/* Without offset drift a read that fails after the start of the read
+		 * returns the data before the error, like a POSIX read
+		 */
+		if( ( read_size > 0 )
+		 && ( simulated_device->offset_drift == 0 ) )
+		{
+			simulated_device->current_offset = error_offset;
+
+			return( (ssize_t) read_size );
+		}
+		/* With offset drift the offset is set to the position of the error,
+		 * like the read on Mac OS X
+		 */
+		if( simulated_device->offset_drift != 0 )
+		{
+			simulated_device->current_offset = error_offset;
+		}
+#if defined( WINAPI )
+		*error_code = (uint32_t) ERROR_UNRECOGNIZED_MEDIA;
+#else
+		*error_code = (uint32_t) EIO;
+#endif
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: simulated read error at offset: %" PRIi64 ".",
+		 function,
+		 error_offset );
+
+		return( -1 );
+	}
+	simulated_device->current_offset = end_offset;
+
+	return( (ssize_t) read_size );
+}
+
+/* Seeks a certain offset in the simulated device
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libsmdev_simulated_device_seek_offset(
+         libsmdev_simulated_device_t *simulated_device,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_simulated_device_seek_offset";
+
+	if( simulated_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid simulated device.",
+		 function );
+
+		return( -1 );
+	}
+	if( simulated_device->is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid simulated device - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += simulated_device->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) simulated_device->media_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	simulated_device->current_offset = offset;
+
+	return( offset );
+}
+
+/* Reads IO control data from the simulated device
+ * Only the bytes per sector requests are supported
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libsmdev_simulated_device_io_control_read(
+         libsmdev_simulated_device_t *simulated_device,
+         uint32_t request,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_simulated_device_io_control_read";
+
+#if defined( BLKPBSZGET )
+	uint32_t value_32bit  = 0;
+#endif
+
+	if( simulated_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid simulated device.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	switch( request )
+	{
+#if defined( BLKSSZGET )
+		case (uint32_t) BLKSSZGET:
+#endif
+#if defined( DIOCGSECTORSIZE )
+		case (uint32_t) DIOCGSECTORSIZE:
+#endif
+#if defined( DKIOCGETBLOCKSIZE )
+		case (uint32_t) DKIOCGETBLOCKSIZE:
+#endif
+#if defined( BLKSSZGET ) || defined( DIOCGSECTORSIZE ) || defined( DKIOCGETBLOCKSIZE )
+			if( data_size < sizeof( uint32_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     data,
+			     &( simulated_device->bytes_per_sector ),
+			     sizeof( uint32_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy bytes per sector.",
+				 function );
+
+				return( -1 );
+			}
+			return( (ssize_t) sizeof( uint32_t ) );
+#endif
+#if defined( BLKPBSZGET )
+		case (uint32_t) BLKPBSZGET:
+			if( data_size < sizeof( uint32_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( simulated_device->physical_bytes_per_sector != 0 )
+			{
+				value_32bit = simulated_device->physical_bytes_per_sector;
+			}
+			else
+			{
+				value_32bit = simulated_device->bytes_per_sector;
+			}
+			if( memory_copy(
+			     data,
+			     &value_32bit,
+			     sizeof( uint32_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy physical bytes per sector.",
+				 function );
+
+				return( -1 );
+			}
+			return( (ssize_t) sizeof( uint32_t ) );
+#endif
+#if defined( BLKALIGNOFF )
+		case (uint32_t) BLKALIGNOFF:
+			if( data_size < sizeof( uint32_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid data size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     data,
+			     &( simulated_device->alignment_offset ),
+			     sizeof( uint32_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy alignment offset.",
+				 function );
+
+				return( -1 );
+			}
+			return( (ssize_t) sizeof( uint32_t ) );
+#endif
+		default:
+			break;
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+	 "%s: unsupported IO control request: 0x%08" PRIx32 ".",
+	 function,
+	 request );
+
+	return( -1 );
+}
+
+/* Retrieves the size of the simulated device
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_simulated_device_get_size(
+     libsmdev_simulated_device_t *simulated_device,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_simulated_device_get_size";
+
+	if( simulated_device == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid simulated device.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = simulated_device->media_size;
+
+	return( 1 );
+}
+
+/* Creates a simulated device IO backend
+ * The simulated device is opened using the path of a scenario file
+ * Make sure the value io_backend is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_simulated_device_initialize_io_backend(
+     libsmdev_io_backend_t **io_backend,
+     libcerror_error_t **error )
+{
+	libsmdev_simulated_device_t *simulated_device = NULL;
+	static char *function                         = "libsmdev_simulated_device_initialize_io_backend";
+
+	if( libsmdev_io_backend_initialize(
+	     io_backend,
+	     LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO backend.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_simulated_device_initialize(
+	     &simulated_device,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create simulated device.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_backend )->io_handle       = (intptr_t *) simulated_device;
+	( *io_backend )->free_io_handle  = (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_simulated_device_free;
+	( *io_backend )->open            = (int (*)(intptr_t *, const char *, int, libcerror_error_t **)) &libsmdev_simulated_device_open;
+	( *io_backend )->close           = (int (*)(intptr_t *, libcerror_error_t **)) &libsmdev_simulated_device_close;
+	( *io_backend )->read            = (ssize_t (*)(intptr_t *, uint8_t *, size_t, uint32_t *, libcerror_error_t **)) &libsmdev_simulated_device_read_buffer;
+	( *io_backend )->seek_offset     = (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) &libsmdev_simulated_device_seek_offset;
+	( *io_backend )->io_control_read = (ssize_t (*)(intptr_t *, uint32_t, uint8_t *, size_t, libcerror_error_t **)) &libsmdev_simulated_device_io_control_read;
+	( *io_backend )->get_size        = (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) &libsmdev_simulated_device_get_size;
+
+	return( 1 );
+
+on_error:
+	if( *io_backend != NULL )
+	{
+		libsmdev_io_backend_free(
+		 io_backend,
+		 NULL );
+	}
+	return( -1 );
+}
@@ -0,0 +1,245 @@
+/*
+ * Simulated device functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_SIMULATED_DEVICE_H )
+#define _LIBSMDEV_SIMULATED_DEVICE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a line in a simulated device scenario file
+ */
+#define LIBSMDEV_SIMULATED_DEVICE_MAXIMUM_LINE_SIZE		256
+
+/* The maximum number of values of a line in a simulated device scenario file
+ */
+#define LIBSMDEV_SIMULATED_DEVICE_MAXIMUM_NUMBER_OF_VALUES	3
+
+enum LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPES
+{
+	/* Reads in the range always fail
+	 */
+	LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_BAD		= 1,
+
+	/* Reads in the range fail until the Nth attempt
+	 */
+	LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_RETRY		= 2,
+
+	/* Reads in the range succeed with a certain probability
+	 */
+	LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_PROBABILITY	= 3,
+
+	/* Reads in the range are delayed
+	 */
+	LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_LATENCY		= 4,
+
+	/* Reads that start in the range return less data than requested
+	 */
+	LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_SHORT_READ		= 5
+};
+
+typedef struct libsmdev_simulated_device_range libsmdev_simulated_device_range_t;
+
+struct libsmdev_simulated_device_range
+{
+	/* The type
+	 */
+	int type;
+
+	/* The start offset
+	 */
+	off64_t start_offset;
+
+	/* The end offset
+	 */
+	off64_t end_offset;
+
+	/* The value
+	 * Contains the number of attempts, success probability percentage,
+	 * latency in micro seconds or short read size, depending on the type
+	 */
+	uint64_t value;
+
+	/* The number of read attempts
+	 */
+	uint64_t number_of_attempts;
+};
+
+typedef struct libsmdev_simulated_device libsmdev_simulated_device_t;
+
+struct libsmdev_simulated_device
+{
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of bytes per sector
+	 */
+	uint32_t bytes_per_sector;
+
+	/* The number of bytes per physical sector
+	 * Contains 0 if the same as the number of bytes per sector
+	 */
+	uint32_t physical_bytes_per_sector;
+
+	/* The offset in bytes of the first physical sector boundary
+	 */
+	uint32_t alignment_offset;
+
+	/* The ranges array
+	 */
+	libcdata_array_t *ranges_array;
+
+	/* The offset at which the device is removed
+	 */
+	off64_t removal_offset;
+
+	/* Value to indicate the offset drifts on error
+	 */
+	uint8_t offset_drift;
+
+	/* Value to indicate latency is applied in real time
+	 */
+	uint8_t real_time;
+
+	/* The pseudo random number generator state
+	 */
+	uint32_t random_state;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate the device is open
+	 */
+	uint8_t is_open;
+
+	/* Value to indicate the device was removed
+	 */
+	uint8_t is_removed;
+
+	/* The number of reads
+	 */
+	uint64_t number_of_reads;
+
+	/* The number of failed reads
+	 */
+	uint64_t number_of_failed_reads;
+
+	/* The simulated elapsed time in micro seconds
+	 */
+	uint64_t elapsed_time;
+};
+
+int libsmdev_simulated_device_range_free(
+     libsmdev_simulated_device_range_t **range,
+     libcerror_error_t **error );
+
+int libsmdev_simulated_device_initialize(
+     libsmdev_simulated_device_t **simulated_device,
+     libcerror_error_t **error );
+
+int libsmdev_simulated_device_free(
+     libsmdev_simulated_device_t **simulated_device,
+     libcerror_error_t **error );
+
+int libsmdev_simulated_device_append_range(
+     libsmdev_simulated_device_t *simulated_device,
+     int type,
+     off64_t start_offset,
+     size64_t size,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int libsmdev_simulated_device_parse_integer(
+     const char *string,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int libsmdev_simulated_device_read_scenario_line(
+     libsmdev_simulated_device_t *simulated_device,
+     char *line,
+     libcerror_error_t **error );
+
+int libsmdev_simulated_device_read_scenario(
+     libsmdev_simulated_device_t *simulated_device,
+     FILE *file_stream,
+     libcerror_error_t **error );
+
+int libsmdev_simulated_device_open(
+     libsmdev_simulated_device_t *simulated_device,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libsmdev_simulated_device_close(
+     libsmdev_simulated_device_t *simulated_device,
+     libcerror_error_t **error );
+
+int libsmdev_simulated_device_attempt_read(
+     libsmdev_simulated_device_t *simulated_device,
+     libsmdev_simulated_device_range_t *range,
+     libcerror_error_t **error );
+
+ssize_t libsmdev_simulated_device_read_buffer(
+         libsmdev_simulated_device_t *simulated_device,
+         uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+off64_t libsmdev_simulated_device_seek_offset(
+         libsmdev_simulated_device_t *simulated_device,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+ssize_t libsmdev_simulated_device_io_control_read(
+         libsmdev_simulated_device_t *simulated_device,
+         uint32_t request,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+int libsmdev_simulated_device_get_size(
+     libsmdev_simulated_device_t *simulated_device,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libsmdev_simulated_device_initialize_io_backend(
+     libsmdev_io_backend_t **io_backend,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_SIMULATED_DEVICE_H ) */
+
@@ -0,0 +1,473 @@
+/*
+ * sysfs functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_LIMITS_H )
+#include <limits.h>
+#endif
+
+#include "libsmdev_libcerror.h"
+#include "libsmdev_sysfs.h"
+
+/* Reads the data of a sysfs attribute
+ * Returns 1 if successful, 0 if the attribute is not available or -1 on error
+ */
+int libsmdev_sysfs_read_data(
+     const char *path,
+     uint8_t *data,
+     size_t data_size,
+     size_t *read_count,
+     libcerror_error_t **error )
+{
+	FILE *file_stream     = NULL;
+	static char *function = "libsmdev_sysfs_read_data";
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read count.",
+		 function );
+
+		return( -1 );
+	}
+	/* A missing or unreadable attribute is not considered an error
+	 * since the available attributes differ per kernel version and driver
+	 */
+	file_stream = file_stream_open(
+	               path,
+	               FILE_STREAM_BINARY_OPEN_READ );
+
+	if( file_stream == NULL )
+	{
+		return( 0 );
+	}
+	*read_count = file_stream_read(
+	               file_stream,
+	               data,
+	               data_size );
+
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_count == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads a string sysfs attribute
+ * Leading and trailing white space is removed
+ * Returns 1 if successful, 0 if the attribute is not available or -1 on error
+ */
+int libsmdev_sysfs_read_string(
+     const char *path,
+     uint8_t *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sysfs_read_string";
+	size_t read_count     = 0;
+	size_t string_index   = 0;
+	size_t start_index    = 0;
+	int result            = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_size < 2 )
+	 || ( string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	string[ 0 ] = 0;
+
+	result = libsmdev_sysfs_read_data(
+	          path,
+	          string,
+	          string_size - 1,
+	          &read_count,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read attribute: %s.",
+			 function,
+			 path );
+		}
+		return( result );
+	}
+	while( ( read_count > 0 )
+	    && ( ( string[ read_count - 1 ] == (uint8_t) '\n' )
+	     ||  ( string[ read_count - 1 ] == (uint8_t) ' ' )
+	     ||  ( string[ read_count - 1 ] == 0 ) ) )
+	{
+		read_count--;
+	}
+	while( ( start_index < read_count )
+	    && ( string[ start_index ] == (uint8_t) ' ' ) )
+	{
+		start_index++;
+	}
+	for( string_index = 0;
+	     ( start_index + string_index ) < read_count;
+	     string_index++ )
+	{
+		string[ string_index ] = string[ start_index + string_index ];
+	}
+	string[ string_index ] = 0;
+
+	if( string_index == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads a decimal integer sysfs attribute
+ * Returns 1 if successful, 0 if the attribute is not available or -1 on error
+ */
+int libsmdev_sysfs_read_integer(
+     const char *path,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	uint8_t string[ 32 ];
+
+	static char *function = "libsmdev_sysfs_read_integer";
+	uint64_t safe_value   = 0;
+	size_t string_index   = 0;
+	int result            = 0;
+
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	result = libsmdev_sysfs_read_string(
+	          path,
+	          string,
+	          32,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (uint8_t) '0' )
+		 || ( string[ string_index ] > (uint8_t) '9' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in attribute: %s.",
+			 function,
+			 path );
+
+			return( -1 );
+		}
+		if( safe_value > ( ( (uint64_t) UINT64_MAX - 9 ) / 10 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: value in attribute: %s out of bounds.",
+			 function,
+			 path );
+
+			return( -1 );
+		}
+		safe_value *= 10;
+		safe_value += string[ string_index ] - (uint8_t) '0';
+	}
+	*value_64bit = safe_value;
+
+	return( 1 );
+}
+
+/* Reads the target of a sysfs symbolic link
+ * Returns 1 if successful, 0 if the link is not available or -1 on error
+ */
+int libsmdev_sysfs_read_link(
+     const char *path,
+     char *target,
+     size_t target_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_sysfs_read_link";
+
+#if defined( HAVE_READLINK )
+	ssize_t read_count    = 0;
+#endif
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( target == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( target_size < 2 )
+	 || ( target_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid target size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	target[ 0 ] = 0;
+
+#if defined( HAVE_READLINK )
+	read_count = readlink(
+	              path,
+	              target,
+	              target_size - 1 );
+
+	if( read_count <= 0 )
+	{
+		return( 0 );
+	}
+	target[ read_count ] = 0;
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Determines the sysfs block device name of a device filename
+ * E.g. /dev/sda is mapped to sda and /dev/cciss/c0d0 to cciss!c0d0
+ * Returns 1 if successful, 0 if not a device filename or -1 on error
+ */
+int libsmdev_sysfs_get_block_device_name(
+     const char *filename,
+     char *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_REALPATH ) && defined( PATH_MAX )
+	char resolved_path[ PATH_MAX ];
+#endif
+
+	static char *function   = "libsmdev_sysfs_get_block_device_name";
+	const char *device_name = NULL;
+	size_t name_index       = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size < 2 )
+	 || ( name_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	name[ 0 ] = 0;
+
+	device_name = filename;
+
+#if defined( HAVE_REALPATH ) && defined( PATH_MAX )
+	/* Resolve symbolic links such as /dev/disk/by-id/...
+	 */
+	if( realpath(
+	     filename,
+	     resolved_path ) != NULL )
+	{
+		device_name = resolved_path;
+	}
+#endif
+	if( narrow_string_compare(
+	     device_name,
+	     "/dev/",
+	     5 ) != 0 )
+	{
+		return( 0 );
+	}
+	device_name += 5;
+
+	while( device_name[ name_index ] != 0 )
+	{
+		if( name_index >= ( name_size - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: name too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( device_name[ name_index ] == '/' )
+		{
+			name[ name_index ] = '!';
+		}
+		else
+		{
+			name[ name_index ] = device_name[ name_index ];
+		}
+		name_index++;
+	}
+	name[ name_index ] = 0;
+
+	if( name_index == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
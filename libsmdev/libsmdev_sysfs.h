@@ -0,0 +1,77 @@
+/*
+ * sysfs functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_SYSFS_H )
+#define _LIBSMDEV_SYSFS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The sysfs directory that contains the block devices
+ */
+#define LIBSMDEV_SYSFS_BLOCK_PATH		"/sys/block"
+
+/* The maximum size of a sysfs path
+ */
+#define LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE	512
+
+int libsmdev_sysfs_read_data(
+     const char *path,
+     uint8_t *data,
+     size_t data_size,
+     size_t *read_count,
+     libcerror_error_t **error );
+
+int libsmdev_sysfs_read_string(
+     const char *path,
+     uint8_t *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int libsmdev_sysfs_read_integer(
+     const char *path,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int libsmdev_sysfs_read_link(
+     const char *path,
+     char *target,
+     size_t target_size,
+     libcerror_error_t **error );
+
+int libsmdev_sysfs_get_block_device_name(
+     const char *filename,
+     char *name,
+     size_t name_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_SYSFS_H ) */
+
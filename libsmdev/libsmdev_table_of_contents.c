@@ -0,0 +1,851 @@
+/*
+ * Table of contents functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+#include "libsmdev_sector_range.h"
+#include "libsmdev_table_of_contents.h"
+#include "libsmdev_track_value.h"
+
+/* Creates a table of contents
+ * Make sure the value table_of_contents is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_initialize(
+     libsmdev_table_of_contents_t **table_of_contents,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_table_of_contents_initialize";
+
+	if( table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table_of_contents != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid table of contents value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*table_of_contents = memory_allocate_structure(
+	                      libsmdev_table_of_contents_t );
+
+	if( *table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create table of contents.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *table_of_contents,
+	     0,
+	     sizeof( libsmdev_table_of_contents_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear table of contents.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *table_of_contents != NULL )
+	{
+		memory_free(
+		 *table_of_contents );
+
+		*table_of_contents = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a table of contents
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_free(
+     libsmdev_table_of_contents_t **table_of_contents,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_table_of_contents_free";
+
+	if( table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table_of_contents != NULL )
+	{
+		if( ( *table_of_contents )->tracks != NULL )
+		{
+			memory_free(
+			 ( *table_of_contents )->tracks );
+		}
+		if( ( *table_of_contents )->lead_outs != NULL )
+		{
+			memory_free(
+			 ( *table_of_contents )->lead_outs );
+		}
+		if( ( *table_of_contents )->sessions != NULL )
+		{
+			memory_free(
+			 ( *table_of_contents )->sessions );
+		}
+		memory_free(
+		 *table_of_contents );
+
+		*table_of_contents = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a table of contents
+ * The allocated entries are retained so they can be reused when the table of contents is determined again
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_empty(
+     libsmdev_table_of_contents_t *table_of_contents,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_table_of_contents_empty";
+
+	if( table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	table_of_contents->number_of_sessions  = 0;
+	table_of_contents->number_of_lead_outs = 0;
+	table_of_contents->number_of_tracks    = 0;
+
+	return( 1 );
+}
+
+/* Resizes contiguous entries so they can contain at least the number of entries
+ * The number of allocated entries is at least doubled, to limit the number of reallocations when appending
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_resize_entries(
+     void **entries,
+     int *number_of_allocated_entries,
+     int number_of_entries,
+     size_t entry_size,
+     libcerror_error_t **error )
+{
+	void *reallocation        = NULL;
+	static char *function     = "libsmdev_table_of_contents_resize_entries";
+	int new_number_of_entries = 0;
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocated_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of allocated entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid entry size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries <= *number_of_allocated_entries )
+	{
+		return( 1 );
+	}
+	new_number_of_entries = LIBSMDEV_TABLE_OF_CONTENTS_MINIMUM_NUMBER_OF_ENTRIES;
+
+	if( *number_of_allocated_entries > ( new_number_of_entries / 2 ) )
+	{
+		if( *number_of_allocated_entries > ( INT_MAX / 2 ) )
+		{
+			new_number_of_entries = INT_MAX;
+		}
+		else
+		{
+			new_number_of_entries = *number_of_allocated_entries * 2;
+		}
+	}
+	if( new_number_of_entries < number_of_entries )
+	{
+		new_number_of_entries = number_of_entries;
+	}
+	if( (size_t) new_number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / entry_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of entries value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                *entries,
+	                entry_size * (size_t) new_number_of_entries );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize entries.",
+		 function );
+
+		return( -1 );
+	}
+	*entries                     = reallocation;
+	*number_of_allocated_entries = new_number_of_entries;
+
+	return( 1 );
+}
+
+/* Reserves the entries of a table of contents
+ * This allows the number of entries to be allocated at once when it is known in advance
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_reserve(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int number_of_sessions,
+     int number_of_lead_outs,
+     int number_of_tracks,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_table_of_contents_reserve";
+
+	if( table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_table_of_contents_resize_entries(
+	     (void **) &( table_of_contents->sessions ),
+	     &( table_of_contents->number_of_allocated_sessions ),
+	     number_of_sessions,
+	     sizeof( libsmdev_sector_range_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize sessions.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_table_of_contents_resize_entries(
+	     (void **) &( table_of_contents->lead_outs ),
+	     &( table_of_contents->number_of_allocated_lead_outs ),
+	     number_of_lead_outs,
+	     sizeof( libsmdev_sector_range_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize lead-outs.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_table_of_contents_resize_entries(
+	     (void **) &( table_of_contents->tracks ),
+	     &( table_of_contents->number_of_allocated_tracks ),
+	     number_of_tracks,
+	     sizeof( libsmdev_track_value_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize tracks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a session
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_append_session(
+     libsmdev_table_of_contents_t *table_of_contents,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_table_of_contents_append_session";
+
+	if( table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_of_contents->number_of_sessions == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid table of contents - number of sessions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_table_of_contents_resize_entries(
+	     (void **) &( table_of_contents->sessions ),
+	     &( table_of_contents->number_of_allocated_sessions ),
+	     table_of_contents->number_of_sessions + 1,
+	     sizeof( libsmdev_sector_range_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize sessions.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_sector_range_set(
+	     &( table_of_contents->sessions[ table_of_contents->number_of_sessions ] ),
+	     start_sector,
+	     number_of_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set session sector range.",
+		 function );
+
+		return( -1 );
+	}
+	table_of_contents->number_of_sessions += 1;
+
+	return( 1 );
+}
+
+/* Appends a lead-out
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_append_lead_out(
+     libsmdev_table_of_contents_t *table_of_contents,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_table_of_contents_append_lead_out";
+
+	if( table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_of_contents->number_of_lead_outs == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid table of contents - number of lead-outs value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_table_of_contents_resize_entries(
+	     (void **) &( table_of_contents->lead_outs ),
+	     &( table_of_contents->number_of_allocated_lead_outs ),
+	     table_of_contents->number_of_lead_outs + 1,
+	     sizeof( libsmdev_sector_range_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize lead-outs.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_sector_range_set(
+	     &( table_of_contents->lead_outs[ table_of_contents->number_of_lead_outs ] ),
+	     start_sector,
+	     number_of_sectors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set lead-out sector range.",
+		 function );
+
+		return( -1 );
+	}
+	table_of_contents->number_of_lead_outs += 1;
+
+	return( 1 );
+}
+
+/* Appends a track
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_append_track(
+     libsmdev_table_of_contents_t *table_of_contents,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     uint8_t type,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_table_of_contents_append_track";
+
+	if( table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_of_contents->number_of_tracks == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid table of contents - number of tracks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_table_of_contents_resize_entries(
+	     (void **) &( table_of_contents->tracks ),
+	     &( table_of_contents->number_of_allocated_tracks ),
+	     table_of_contents->number_of_tracks + 1,
+	     sizeof( libsmdev_track_value_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize tracks.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &( table_of_contents->tracks[ table_of_contents->number_of_tracks ] ),
+	     0,
+	     sizeof( libsmdev_track_value_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear track value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_track_value_set(
+	     &( table_of_contents->tracks[ table_of_contents->number_of_tracks ] ),
+	     start_sector,
+	     number_of_sectors,
+	     type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set track value.",
+		 function );
+
+		return( -1 );
+	}
+	table_of_contents->number_of_tracks += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of sessions
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_get_number_of_sessions(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int *number_of_sessions,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_table_of_contents_get_number_of_sessions";
+
+	if( table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sessions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of sessions.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_sessions = table_of_contents->number_of_sessions;
+
+	return( 1 );
+}
+
+/* Retrieves a specific session
+ * The session references an entry of the table of contents and remains valid until the next append
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_get_session_by_index(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int session_index,
+     libsmdev_sector_range_t **session,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_table_of_contents_get_session_by_index";
+
+	if( table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( session_index < 0 )
+	 || ( session_index >= table_of_contents->number_of_sessions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid session index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( session == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid session.",
+		 function );
+
+		return( -1 );
+	}
+	*session = &( table_of_contents->sessions[ session_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the number of lead-outs
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_get_number_of_lead_outs(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int *number_of_lead_outs,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_table_of_contents_get_number_of_lead_outs";
+
+	if( table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_lead_outs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of lead-outs.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_lead_outs = table_of_contents->number_of_lead_outs;
+
+	return( 1 );
+}
+
+/* Retrieves a specific lead-out
+ * The lead-out references an entry of the table of contents and remains valid until the next append
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_get_lead_out_by_index(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int lead_out_index,
+     libsmdev_sector_range_t **lead_out,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_table_of_contents_get_lead_out_by_index";
+
+	if( table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( lead_out_index < 0 )
+	 || ( lead_out_index >= table_of_contents->number_of_lead_outs ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid lead-out index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( lead_out == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lead-out.",
+		 function );
+
+		return( -1 );
+	}
+	*lead_out = &( table_of_contents->lead_outs[ lead_out_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the number of tracks
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_get_number_of_tracks(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int *number_of_tracks,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_table_of_contents_get_number_of_tracks";
+
+	if( table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_tracks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of tracks.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_tracks = table_of_contents->number_of_tracks;
+
+	return( 1 );
+}
+
+/* Retrieves a specific track
+ * The track references an entry of the table of contents and remains valid until the next append
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_table_of_contents_get_track_by_index(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int track_index,
+     libsmdev_track_value_t **track,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_table_of_contents_get_track_by_index";
+
+	if( table_of_contents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table of contents.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( track_index < 0 )
+	 || ( track_index >= table_of_contents->number_of_tracks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid track index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( track == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid track.",
+		 function );
+
+		return( -1 );
+	}
+	*track = &( table_of_contents->tracks[ track_index ] );
+
+	return( 1 );
+}
+
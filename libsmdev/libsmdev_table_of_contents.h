@@ -0,0 +1,165 @@
+/*
+ * Table of contents functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBSMDEV_TABLE_OF_CONTENTS_H )
+#define _LIBSMDEV_TABLE_OF_CONTENTS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+#include "libsmdev_sector_range.h"
+#include "libsmdev_track_value.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The minimum number of entries allocated at once
+ */
+#define LIBSMDEV_TABLE_OF_CONTENTS_MINIMUM_NUMBER_OF_ENTRIES	8
+
+typedef struct libsmdev_table_of_contents libsmdev_table_of_contents_t;
+
+struct libsmdev_table_of_contents
+{
+	/* The sessions
+	 */
+	libsmdev_sector_range_t *sessions;
+
+	/* The number of sessions
+	 */
+	int number_of_sessions;
+
+	/* The number of allocated sessions
+	 */
+	int number_of_allocated_sessions;
+
+	/* The lead-outs
+	 */
+	libsmdev_sector_range_t *lead_outs;
+
+	/* The number of lead-outs
+	 */
+	int number_of_lead_outs;
+
+	/* The number of allocated lead-outs
+	 */
+	int number_of_allocated_lead_outs;
+
+	/* The tracks
+	 */
+	libsmdev_track_value_t *tracks;
+
+	/* The number of tracks
+	 */
+	int number_of_tracks;
+
+	/* The number of allocated tracks
+	 */
+	int number_of_allocated_tracks;
+};
+
+int libsmdev_table_of_contents_initialize(
+     libsmdev_table_of_contents_t **table_of_contents,
+     libcerror_error_t **error );
+
+int libsmdev_table_of_contents_free(
+     libsmdev_table_of_contents_t **table_of_contents,
+     libcerror_error_t **error );
+
+int libsmdev_table_of_contents_empty(
+     libsmdev_table_of_contents_t *table_of_contents,
+     libcerror_error_t **error );
+
+int libsmdev_table_of_contents_resize_entries(
+     void **entries,
+     int *number_of_allocated_entries,
+     int number_of_entries,
+     size_t entry_size,
+     libcerror_error_t **error );
+
+int libsmdev_table_of_contents_reserve(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int number_of_sessions,
+     int number_of_lead_outs,
+     int number_of_tracks,
+     libcerror_error_t **error );
+
+int libsmdev_table_of_contents_append_session(
+     libsmdev_table_of_contents_t *table_of_contents,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error );
+
+int libsmdev_table_of_contents_append_lead_out(
+     libsmdev_table_of_contents_t *table_of_contents,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     libcerror_error_t **error );
+
+int libsmdev_table_of_contents_append_track(
+     libsmdev_table_of_contents_t *table_of_contents,
+     uint64_t start_sector,
+     uint64_t number_of_sectors,
+     uint8_t type,
+     libcerror_error_t **error );
+
+int libsmdev_table_of_contents_get_number_of_sessions(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int *number_of_sessions,
+     libcerror_error_t **error );
+
+int libsmdev_table_of_contents_get_session_by_index(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int session_index,
+     libsmdev_sector_range_t **session,
+     libcerror_error_t **error );
+
+int libsmdev_table_of_contents_get_number_of_lead_outs(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int *number_of_lead_outs,
+     libcerror_error_t **error );
+
+int libsmdev_table_of_contents_get_lead_out_by_index(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int lead_out_index,
+     libsmdev_sector_range_t **lead_out,
+     libcerror_error_t **error );
+
+int libsmdev_table_of_contents_get_number_of_tracks(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int *number_of_tracks,
+     libcerror_error_t **error );
+
+int libsmdev_table_of_contents_get_track_by_index(
+     libsmdev_table_of_contents_t *table_of_contents,
+     int track_index,
+     libsmdev_track_value_t **track,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_TABLE_OF_CONTENTS_H ) */
+
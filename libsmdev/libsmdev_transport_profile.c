@@ -0,0 +1,354 @@
+/*
+ * Transport profile functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_optical_read.h"
+#include "libsmdev_parallel_reader.h"
+#include "libsmdev_transport_profile.h"
+
+/* The built-in transport profiles
+ * The last profile matches any bus and media type and contains the defaults of the handle
+ */
+static const libsmdev_transport_profile_t libsmdev_transport_profile_built_in[] = {
+	/* Removable USB media, such as thumb drives, are mostly attached using the Bulk-Only Transport
+	 * which handles a single command at a time and is slow to recover from errors
+	 */
+	{ LIBSMDEV_BUS_TYPE_USB, LIBSMDEV_MEDIA_TYPE_REMOVABLE, 65536, 1, 1, 65536, 30000, LIBSMDEV_CACHE_POLICY_WRITE_THROUGH },
+
+	{ LIBSMDEV_BUS_TYPE_USB, LIBSMDEV_TRANSPORT_PROFILE_TYPE_ANY, 262144, 2, 2, 4096, 30000, LIBSMDEV_CACHE_POLICY_WRITE_BACK },
+
+	{ LIBSMDEV_BUS_TYPE_FIREWIRE, LIBSMDEV_TRANSPORT_PROFILE_TYPE_ANY, 131072, 1, 2, 4096, 30000, LIBSMDEV_CACHE_POLICY_WRITE_THROUGH },
+
+	{ LIBSMDEV_BUS_TYPE_ATA, LIBSMDEV_TRANSPORT_PROFILE_TYPE_ANY, 1048576, 4, 2, 4096, 30000, LIBSMDEV_CACHE_POLICY_WRITE_BACK },
+
+	/* SCSI and SAS host adapters support deep tagged command queues
+	 */
+	{ LIBSMDEV_BUS_TYPE_SCSI, LIBSMDEV_TRANSPORT_PROFILE_TYPE_ANY, 1048576, 8, 2, 4096, 30000, LIBSMDEV_CACHE_POLICY_WRITE_BACK },
+
+	/* Optical drives read sequentially and a short deadline prevents the drive from stalling on damaged areas
+	 */
+	{ LIBSMDEV_TRANSPORT_PROFILE_TYPE_ANY, LIBSMDEV_MEDIA_TYPE_OPTICAL, 65536, 1, 3, 2048, LIBSMDEV_OPTICAL_READ_DEFAULT_STREAMING_TIMEOUT, LIBSMDEV_CACHE_POLICY_NONE },
+
+	{ LIBSMDEV_TRANSPORT_PROFILE_TYPE_ANY, LIBSMDEV_TRANSPORT_PROFILE_TYPE_ANY, LIBSMDEV_PARALLEL_READER_DEFAULT_STRIPE_SIZE, 1, 2, 0, LIBSMDEV_OPTICAL_READ_DEFAULT_STREAMING_TIMEOUT, LIBSMDEV_CACHE_POLICY_NONE }
+};
+
+/* Creates a transport profile
+ * Make sure the value transport_profile is referencing, is set to NULL
+ * The values of the transport profile are initialized with the built-in transport profile
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_transport_profile_initialize(
+     libsmdev_transport_profile_t **transport_profile,
+     uint8_t bus_type,
+     uint8_t media_type,
+     libcerror_error_t **error )
+{
+	const libsmdev_transport_profile_t *built_in_transport_profile = NULL;
+	static char *function                                          = "libsmdev_transport_profile_initialize";
+
+	if( transport_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transport profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( *transport_profile != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid transport profile value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_transport_profile_get_built_in(
+	     bus_type,
+	     media_type,
+	     &built_in_transport_profile,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve built-in transport profile.",
+		 function );
+
+		return( -1 );
+	}
+	*transport_profile = memory_allocate_structure(
+	                      libsmdev_transport_profile_t );
+
+	if( *transport_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create transport profile.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *transport_profile,
+	     built_in_transport_profile,
+	     sizeof( libsmdev_transport_profile_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy built-in transport profile.",
+		 function );
+
+		goto on_error;
+	}
+	( *transport_profile )->bus_type   = bus_type;
+	( *transport_profile )->media_type = media_type;
+
+	return( 1 );
+
+on_error:
+	if( *transport_profile != NULL )
+	{
+		memory_free(
+		 *transport_profile );
+
+		*transport_profile = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a transport profile
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_transport_profile_free(
+     libsmdev_transport_profile_t **transport_profile,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_transport_profile_free";
+
+	if( transport_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transport profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( *transport_profile != NULL )
+	{
+		memory_free(
+		 *transport_profile );
+
+		*transport_profile = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the values of a transport profile
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_transport_profile_set_values(
+     libsmdev_transport_profile_t *transport_profile,
+     size_t request_size,
+     int queue_depth,
+     uint8_t number_of_error_retries,
+     size_t error_granularity,
+     uint32_t deadline,
+     int cache_policy,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_transport_profile_set_values";
+
+	if( transport_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transport profile.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( request_size == 0 )
+	 || ( request_size > (size_t) LIBSMDEV_PARALLEL_READER_MAXIMUM_STRIPE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid request size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( queue_depth <= 0 )
+	 || ( queue_depth > LIBSMDEV_PARALLEL_READER_MAXIMUM_NUMBER_OF_WORKERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid queue depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_granularity > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid error granularity value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( deadline == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid deadline value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_policy != LIBSMDEV_CACHE_POLICY_NONE )
+	 && ( cache_policy != LIBSMDEV_CACHE_POLICY_WRITE_THROUGH )
+	 && ( cache_policy != LIBSMDEV_CACHE_POLICY_WRITE_BACK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache policy: %d.",
+		 function,
+		 cache_policy );
+
+		return( -1 );
+	}
+	transport_profile->request_size            = request_size;
+	transport_profile->queue_depth             = queue_depth;
+	transport_profile->number_of_error_retries = number_of_error_retries;
+	transport_profile->error_granularity       = error_granularity;
+	transport_profile->deadline                = deadline;
+	transport_profile->cache_policy            = cache_policy;
+
+	return( 1 );
+}
+
+/* Retrieves the built-in transport profile of a bus and media type
+ * A profile of the media type takes precedence over a profile of the bus type,
+ * since for example an optical drive behaves the same regardless of how it is attached
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_transport_profile_get_built_in(
+     uint8_t bus_type,
+     uint8_t media_type,
+     const libsmdev_transport_profile_t **transport_profile,
+     libcerror_error_t **error )
+{
+	static char *function  = "libsmdev_transport_profile_get_built_in";
+	int match_index        = 0;
+	int number_of_profiles = 0;
+	int profile_index      = 0;
+
+	if( transport_profile == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transport profile.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_profiles = (int) ( sizeof( libsmdev_transport_profile_built_in ) / sizeof( libsmdev_transport_profile_t ) );
+
+	/* The profiles are matched on: both types, the media type, the bus type
+	 * and finally the last profile which matches any type
+	 */
+	for( match_index = 0;
+	     match_index < 3;
+	     match_index++ )
+	{
+		for( profile_index = 0;
+		     profile_index < number_of_profiles;
+		     profile_index++ )
+		{
+			if( match_index == 0 )
+			{
+				if( ( libsmdev_transport_profile_built_in[ profile_index ].bus_type == bus_type )
+				 && ( libsmdev_transport_profile_built_in[ profile_index ].media_type == media_type ) )
+				{
+					break;
+				}
+			}
+			else if( match_index == 1 )
+			{
+				if( ( libsmdev_transport_profile_built_in[ profile_index ].bus_type == LIBSMDEV_TRANSPORT_PROFILE_TYPE_ANY )
+				 && ( libsmdev_transport_profile_built_in[ profile_index ].media_type == media_type ) )
+				{
+					break;
+				}
+			}
+			else if( ( libsmdev_transport_profile_built_in[ profile_index ].bus_type == bus_type )
+			      && ( libsmdev_transport_profile_built_in[ profile_index ].media_type == LIBSMDEV_TRANSPORT_PROFILE_TYPE_ANY ) )
+			{
+				break;
+			}
+		}
+		if( profile_index < number_of_profiles )
+		{
+			break;
+		}
+	}
+	if( profile_index >= number_of_profiles )
+	{
+		profile_index = number_of_profiles - 1;
+	}
+	*transport_profile = &( libsmdev_transport_profile_built_in[ profile_index ] );
+
+	return( 1 );
+}
+
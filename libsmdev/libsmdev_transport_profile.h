@@ -0,0 +1,120 @@
+/*
+ * Transport profile functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_TRANSPORT_PROFILE_H )
+#define _LIBSMDEV_TRANSPORT_PROFILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The bus or media type of a built-in transport profile that matches any bus or media type
+ */
+#define LIBSMDEV_TRANSPORT_PROFILE_TYPE_ANY		0xff
+
+/* The number of bytes written between flushes with the write-through cache policy
+ */
+#define LIBSMDEV_TRANSPORT_PROFILE_FLUSH_INTERVAL	( 64 * 1024 * 1024 )
+
+/* The values of the handle that are set by a transport profile
+ * A value that was set by the caller is not overridden by a transport profile
+ */
+#define LIBSMDEV_TRANSPORT_PROFILE_VALUE_REQUEST_SIZE		0x01
+#define LIBSMDEV_TRANSPORT_PROFILE_VALUE_QUEUE_DEPTH		0x02
+#define LIBSMDEV_TRANSPORT_PROFILE_VALUE_ERROR_RETRIES		0x04
+#define LIBSMDEV_TRANSPORT_PROFILE_VALUE_ERROR_GRANULARITY	0x08
+#define LIBSMDEV_TRANSPORT_PROFILE_VALUE_DEADLINE		0x10
+#define LIBSMDEV_TRANSPORT_PROFILE_VALUE_CACHE_POLICY		0x20
+
+typedef struct libsmdev_transport_profile libsmdev_transport_profile_t;
+
+struct libsmdev_transport_profile
+{
+	/* The bus type
+	 */
+	uint8_t bus_type;
+
+	/* The media type
+	 */
+	uint8_t media_type;
+
+	/* The size of a single read request
+	 */
+	size_t request_size;
+
+	/* The number of requests that are issued concurrently
+	 */
+	int queue_depth;
+
+	/* The number of read/write error retries
+	 */
+	uint8_t number_of_error_retries;
+
+	/* The read/write error granularity
+	 */
+	size_t error_granularity;
+
+	/* The maximum duration of a single device command in milli seconds
+	 */
+	uint32_t deadline;
+
+	/* The cache policy
+	 */
+	int cache_policy;
+};
+
+int libsmdev_transport_profile_initialize(
+     libsmdev_transport_profile_t **transport_profile,
+     uint8_t bus_type,
+     uint8_t media_type,
+     libcerror_error_t **error );
+
+int libsmdev_transport_profile_free(
+     libsmdev_transport_profile_t **transport_profile,
+     libcerror_error_t **error );
+
+int libsmdev_transport_profile_set_values(
+     libsmdev_transport_profile_t *transport_profile,
+     size_t request_size,
+     int queue_depth,
+     uint8_t number_of_error_retries,
+     size_t error_granularity,
+     uint32_t deadline,
+     int cache_policy,
+     libcerror_error_t **error );
+
+int libsmdev_transport_profile_get_built_in(
+     uint8_t bus_type,
+     uint8_t media_type,
+     const libsmdev_transport_profile_t **transport_profile,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_TRANSPORT_PROFILE_H ) */
+
@@ -34,9 +34,11 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libsmdev_device_list {}	libsmdev_device_list_t;
 typedef struct libsmdev_handle {}	libsmdev_handle_t;
 
 #else
+typedef intptr_t libsmdev_device_list_t;
 typedef intptr_t libsmdev_handle_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
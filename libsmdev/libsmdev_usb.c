@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
 /* Needed for _IOW amd _IOWR */
@@ -36,16 +37,591 @@
 #include <linux/usb/ch9.h>
 #endif
 
+#include "libsmdev_definitions.h"
+#include "libsmdev_io_control.h"
 #include "libsmdev_libcerror.h"
 #include "libsmdev_libcfile.h"
 #include "libsmdev_libcnotify.h"
 #include "libsmdev_scsi.h"
+#include "libsmdev_sysfs.h"
 #include "libsmdev_usb.h"
 
 /* Timeout in milli seconds: 1 second
  */
 #define LIBSMDEV_USB_CONTROL_COMMAND_TIMEOUT	1000
 
+/* Determines the link speed from the sysfs speed attribute
+ * E.g. 480 is USB 2.0 high speed and 5000 USB 3.0 SuperSpeed
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_usb_get_link_speed_from_string(
+     const uint8_t *string,
+     size_t string_length,
+     uint8_t *link_speed,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_usb_get_link_speed_from_string";
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( link_speed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid link speed.",
+		 function );
+
+		return( -1 );
+	}
+	*link_speed = LIBSMDEV_USB_LINK_SPEED_UNKNOWN;
+
+	/* The sysfs speed attribute contains the link speed in Mbit/s
+	 */
+	if( string_length == 2 )
+	{
+		if( memory_compare(
+		     string,
+		     "12",
+		     2 ) == 0 )
+		{
+			*link_speed = LIBSMDEV_USB_LINK_SPEED_FULL;
+		}
+	}
+	else if( string_length == 3 )
+	{
+		if( memory_compare(
+		     string,
+		     "1.5",
+		     3 ) == 0 )
+		{
+			*link_speed = LIBSMDEV_USB_LINK_SPEED_LOW;
+		}
+		else if( memory_compare(
+		          string,
+		          "480",
+		          3 ) == 0 )
+		{
+			*link_speed = LIBSMDEV_USB_LINK_SPEED_HIGH;
+		}
+	}
+	else if( string_length == 4 )
+	{
+		if( memory_compare(
+		     string,
+		     "5000",
+		     4 ) == 0 )
+		{
+			*link_speed = LIBSMDEV_USB_LINK_SPEED_SUPER;
+		}
+	}
+	else if( string_length == 5 )
+	{
+		if( memory_compare(
+		     string,
+		     "10000",
+		     5 ) == 0 )
+		{
+			*link_speed = LIBSMDEV_USB_LINK_SPEED_SUPER_PLUS;
+		}
+		else if( memory_compare(
+		          string,
+		          "20000",
+		          5 ) == 0 )
+		{
+			*link_speed = LIBSMDEV_USB_LINK_SPEED_SUPER_PLUS_2X2;
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the mass storage protocol from the sysfs path of the interface driver
+ * E.g. ../../../../../../bus/usb/drivers/uas
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_usb_get_protocol_from_driver_path(
+     const char *path,
+     size_t path_length,
+     uint8_t *protocol,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_usb_get_protocol_from_driver_path";
+	size_t name_index     = 0;
+	size_t name_length    = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( protocol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid protocol.",
+		 function );
+
+		return( -1 );
+	}
+	*protocol = LIBSMDEV_USB_PROTOCOL_UNKNOWN;
+
+	name_index = path_length;
+
+	while( ( name_index > 0 )
+	    && ( path[ name_index - 1 ] != '/' ) )
+	{
+		name_index--;
+	}
+	name_length = path_length - name_index;
+
+	if( ( name_length == 3 )
+	 && ( narrow_string_compare(
+	       &( path[ name_index ] ),
+	       "uas",
+	       3 ) == 0 ) )
+	{
+		*protocol = LIBSMDEV_USB_PROTOCOL_UAS;
+	}
+	else if( ( name_length == 11 )
+	      && ( narrow_string_compare(
+	            &( path[ name_index ] ),
+	            "usb-storage",
+	            11 ) == 0 ) )
+	{
+		*protocol = LIBSMDEV_USB_PROTOCOL_BULK_ONLY;
+	}
+	return( 1 );
+}
+
+/* Determines the length of the USB device and interface components of a sysfs device path
+ * E.g. for ../devices/pci0000:00/0000:00:14.0/usb2/2-1/2-1:1.0/host6/target6:0:0/6:0:0:0/block/sdb
+ * the device path is ../devices/pci0000:00/0000:00:14.0/usb2/2-1
+ * and the interface path ../devices/pci0000:00/0000:00:14.0/usb2/2-1/2-1:1.0
+ * Returns 1 if successful, 0 if the path does not contain an USB interface or -1 on error
+ */
+int libsmdev_usb_get_interface_path_length(
+     const char *path,
+     size_t path_length,
+     size_t *device_path_length,
+     size_t *interface_path_length,
+     libcerror_error_t **error )
+{
+	static char *function  = "libsmdev_usb_get_interface_path_length";
+	size_t component_end   = 0;
+	size_t component_index = 0;
+	size_t path_index      = 0;
+	uint8_t usb_bus_found  = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( device_path_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid device path length.",
+		 function );
+
+		return( -1 );
+	}
+	if( interface_path_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid interface path length.",
+		 function );
+
+		return( -1 );
+	}
+	/* The PCI components that precede the USB bus component also contain a colon
+	 * so the interface is only searched for after the USB bus component
+	 */
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		if( path[ path_index ] != '/' )
+		{
+			continue;
+		}
+		component_end = path_index + 1;
+
+		while( ( component_end < path_length )
+		    && ( path[ component_end ] != '/' ) )
+		{
+			component_end++;
+		}
+		if( usb_bus_found == 0 )
+		{
+			if( ( ( component_end - path_index ) > 4 )
+			 && ( narrow_string_compare(
+			       &( path[ path_index ] ),
+			       "/usb",
+			       4 ) == 0 )
+			 && ( path[ path_index + 4 ] >= '0' )
+			 && ( path[ path_index + 4 ] <= '9' ) )
+			{
+				usb_bus_found = 1;
+			}
+			continue;
+		}
+		for( component_index = path_index + 1;
+		     component_index < component_end;
+		     component_index++ )
+		{
+			if( path[ component_index ] == ':' )
+			{
+				*device_path_length    = path_index;
+				*interface_path_length = component_end;
+
+				return( 1 );
+			}
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the USB link information of a block device from sysfs
+ * The maximum transfer size is the largest request the USB bridge accepts
+ * Returns 1 if successful, 0 if the block device is not attached via USB or -1 on error
+ */
+int libsmdev_usb_get_link_information(
+     const char *name,
+     uint8_t *link_speed,
+     uint8_t *protocol,
+     size_t *maximum_transfer_size,
+     libcerror_error_t **error )
+{
+	char path[ LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE ];
+	char target[ LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE ];
+	uint8_t string[ 16 ];
+
+	static char *function        = "libsmdev_usb_get_link_information";
+	size_t device_path_length    = 0;
+	size_t interface_path_length = 0;
+	uint64_t value_64bit         = 0;
+	int result                   = 0;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( link_speed == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid link speed.",
+		 function );
+
+		return( -1 );
+	}
+	if( protocol == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid protocol.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_transfer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum transfer size.",
+		 function );
+
+		return( -1 );
+	}
+	*link_speed            = LIBSMDEV_USB_LINK_SPEED_UNKNOWN;
+	*protocol              = LIBSMDEV_USB_PROTOCOL_UNKNOWN;
+	*maximum_transfer_size = 0;
+
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "/sys/class/block/%s",
+	 name );
+
+	result = libsmdev_sysfs_read_link(
+	          path,
+	          target,
+	          LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read device link.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libsmdev_usb_get_interface_path_length(
+	          target,
+	          narrow_string_length(
+	           target ),
+	          &device_path_length,
+	          &interface_path_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine USB interface path.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* The link target is relative to the sysfs block class directory
+	 */
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "/sys/class/block/%.*s/speed",
+	 (int) device_path_length,
+	 target );
+
+	result = libsmdev_sysfs_read_string(
+	          path,
+	          string,
+	          16,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read link speed.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libsmdev_usb_get_link_speed_from_string(
+		     string,
+		     narrow_string_length(
+		      (char *) string ),
+		     link_speed,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine link speed.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "/sys/class/block/%.*s/driver",
+	 (int) interface_path_length,
+	 target );
+
+	/* The device link target is no longer needed so it is reused for the driver link target
+	 */
+	result = libsmdev_sysfs_read_link(
+	          path,
+	          target,
+	          LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read driver link.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libsmdev_usb_get_protocol_from_driver_path(
+		     target,
+		     narrow_string_length(
+		      target ),
+		     protocol,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine protocol.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The maximum hardware request size is limited by the USB bridge and the driver
+	 */
+	narrow_string_snprintf(
+	 path,
+	 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+	 "/sys/class/block/%s/queue/max_hw_sectors_kb",
+	 name );
+
+	result = libsmdev_sysfs_read_integer(
+	          path,
+	          &value_64bit,
+	          error );
+
+	/* The queue attributes of a partition are those of its parent device
+	 */
+	if( result == 0 )
+	{
+		narrow_string_snprintf(
+		 path,
+		 LIBSMDEV_SYSFS_MAXIMUM_PATH_SIZE,
+		 "/sys/class/block/%s/../queue/max_hw_sectors_kb",
+		 name );
+
+		result = libsmdev_sysfs_read_integer(
+		          path,
+		          &value_64bit,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read maximum transfer size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( value_64bit <= (uint64_t) ( SSIZE_MAX / 1024 ) ) )
+	{
+		*maximum_transfer_size = (size_t) value_64bit * 1024;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: link speed\t\t\t: %" PRIu8 "\n",
+		 function,
+		 *link_speed );
+
+		libcnotify_printf(
+		 "%s: protocol\t\t\t: %" PRIu8 "\n",
+		 function,
+		 *protocol );
+
+		libcnotify_printf(
+		 "%s: maximum transfer size\t: %" PRIzd "\n",
+		 function,
+		 *maximum_transfer_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
 #if defined( HAVE_LINUX_USB_CH9_H )
 
 #if defined( USBDEVFS_IOCTL )
@@ -69,11 +645,9 @@ int libsmdev_usb_ioctl(
 	ioctl_request.ioctl_code = request;
 	ioctl_request.data       = request_data;
 
-	read_count = libcfile_file_io_control_read(
+	read_count = libsmdev_io_control_read(
 	              device_file,
 	              USBDEVFS_IOCTL,
-	              NULL,
-	              0,
 	              (uint8_t *) &ioctl_request,
 	              sizeof( struct usbdevfs_ioctl ),
 	              error );
@@ -144,11 +718,9 @@ int libsmdev_usb_control_command(
 	control_request.timeout      = LIBSMDEV_USB_CONTROL_COMMAND_TIMEOUT;
 	control_request.data         = buffer;
 
-	read_count = libcfile_file_io_control_read(
+	read_count = libsmdev_io_control_read(
 	              device_file,
 	              USBDEVFS_CONTROL,
-	              NULL,
-	              0,
 	              (uint8_t *) &control_request,
 	              sizeof( struct usbdevfs_ctrltransfer ),
 	              error );
@@ -192,11 +764,9 @@ int libsmdev_usb_test(
 	static char *function = "libsmdev_usb_test";
 	ssize_t read_count    = 0;
 
-	read_count = libcfile_file_io_control_read(
+	read_count = libsmdev_io_control_read(
 	              device_file,
 	              USBDEVFS_CONNECTINFO,
-	              NULL,
-	              0,
 	              (uint8_t *) &connection_information,
 	              sizeof( struct usbdevfs_connectinfo ),
 	              error );
@@ -32,6 +32,40 @@
 extern "C" {
 #endif
 
+/* The request size used for UAS devices attached at SuperSpeed or faster
+ */
+#define LIBSMDEV_USB_UAS_REQUEST_SIZE		( 1024 * 1024 )
+
+/* The number of concurrent requests used for UAS devices attached at SuperSpeed or faster
+ */
+#define LIBSMDEV_USB_UAS_QUEUE_DEPTH		4
+
+int libsmdev_usb_get_link_speed_from_string(
+     const uint8_t *string,
+     size_t string_length,
+     uint8_t *link_speed,
+     libcerror_error_t **error );
+
+int libsmdev_usb_get_protocol_from_driver_path(
+     const char *path,
+     size_t path_length,
+     uint8_t *protocol,
+     libcerror_error_t **error );
+
+int libsmdev_usb_get_interface_path_length(
+     const char *path,
+     size_t path_length,
+     size_t *device_path_length,
+     size_t *interface_path_length,
+     libcerror_error_t **error );
+
+int libsmdev_usb_get_link_information(
+     const char *name,
+     uint8_t *link_speed,
+     uint8_t *protocol,
+     size_t *maximum_transfer_size,
+     libcerror_error_t **error );
+
 #if defined( HAVE_LINUX_USB_CH9_H )
 
 int libsmdev_usb_ioctl(
@@ -0,0 +1,1381 @@
+/*
+ * Verify functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+#include "libsmdev_copy.h"
+#include "libsmdev_definitions.h"
+#include "libsmdev_handle.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcnotify.h"
+#include "libsmdev_libcthreads.h"
+#include "libsmdev_verify.h"
+
+/* Determines the size of the chunk at a specific media offset
+ * Chunks end on a multiple of the verify buffer size, so that the device is read in aligned chunks
+ * Returns the chunk size
+ */
+size_t libsmdev_verify_get_chunk_size(
+        off64_t offset,
+        size64_t size )
+{
+	size_t chunk_size = LIBSMDEV_VERIFY_BUFFER_SIZE;
+
+	if( offset > 0 )
+	{
+		chunk_size -= (size_t) ( offset % LIBSMDEV_VERIFY_BUFFER_SIZE );
+	}
+	if( (size64_t) chunk_size > size )
+	{
+		chunk_size = (size_t) size;
+	}
+	return( chunk_size );
+}
+
+/* Reads a buffer from a file descriptor
+ * Reads that are interrupted or only partially complete are continued
+ * Returns the number of bytes read, which is less than size at the end of the file, or -1 on error
+ */
+ssize_t libsmdev_verify_read_buffer(
+         int file_descriptor,
+         uint8_t *buffer,
+         size_t size,
+         int *error_code,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_verify_read_buffer";
+	size_t buffer_offset  = 0;
+	ssize_t read_count    = 0;
+
+	if( file_descriptor < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < size )
+	{
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+		read_count = _read(
+		              file_descriptor,
+		              &( buffer[ buffer_offset ] ),
+		              (unsigned int) ( size - buffer_offset ) );
+#else
+		read_count = read(
+		              file_descriptor,
+		              &( buffer[ buffer_offset ] ),
+		              size - buffer_offset );
+#endif
+		if( read_count < 0 )
+		{
+			if( errno == EINTR )
+			{
+				continue;
+			}
+			*error_code = errno;
+
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 *error_code,
+			 "%s: unable to read from file descriptor.",
+			 function );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		buffer_offset += (size_t) read_count;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Compares data with reference data
+ * Returns the offset of the first byte that differs or data_size if the data is equal
+ */
+size_t libsmdev_verify_compare_data(
+        const uint8_t *data,
+        const uint8_t *reference_data,
+        size_t data_size )
+{
+#if defined( __SSE2__ )
+	__m128i equal_values1                = _mm_setzero_si128();
+	__m128i equal_values2                = _mm_setzero_si128();
+#else
+	const uint64_t *data_64bit           = NULL;
+	const uint64_t *reference_data_64bit = NULL;
+#endif
+	size_t data_offset                   = 0;
+
+	if( ( data == NULL )
+	 || ( reference_data == NULL ) )
+	{
+		return( 0 );
+	}
+#if defined( __SSE2__ )
+	/* Compare 64 bytes at a time, the loads do not need to be aligned
+	 */
+	while( ( data_size - data_offset ) >= 64 )
+	{
+		equal_values1 = _mm_and_si128(
+		                 _mm_cmpeq_epi8(
+		                  _mm_loadu_si128( (const __m128i *) &( data[ data_offset ] ) ),
+		                  _mm_loadu_si128( (const __m128i *) &( reference_data[ data_offset ] ) ) ),
+		                 _mm_cmpeq_epi8(
+		                  _mm_loadu_si128( (const __m128i *) &( data[ data_offset + 16 ] ) ),
+		                  _mm_loadu_si128( (const __m128i *) &( reference_data[ data_offset + 16 ] ) ) ) );
+
+		equal_values2 = _mm_and_si128(
+		                 _mm_cmpeq_epi8(
+		                  _mm_loadu_si128( (const __m128i *) &( data[ data_offset + 32 ] ) ),
+		                  _mm_loadu_si128( (const __m128i *) &( reference_data[ data_offset + 32 ] ) ) ),
+		                 _mm_cmpeq_epi8(
+		                  _mm_loadu_si128( (const __m128i *) &( data[ data_offset + 48 ] ) ),
+		                  _mm_loadu_si128( (const __m128i *) &( reference_data[ data_offset + 48 ] ) ) ) );
+
+		if( _mm_movemask_epi8(
+		     _mm_and_si128(
+		      equal_values1,
+		      equal_values2 ) ) != 0xffff )
+		{
+			break;
+		}
+		data_offset += 64;
+	}
+#else
+	/* Compare 4 64-bit values at a time if both buffers have the same alignment,
+	 * the combined comparison allows the compiler to vectorize the loop
+	 */
+	if( ( ( (intptr_t) data - (intptr_t) reference_data ) % sizeof( uint64_t ) ) == 0 )
+	{
+		while( ( data_offset < data_size )
+		    && ( ( (intptr_t) &( data[ data_offset ] ) % sizeof( uint64_t ) ) != 0 ) )
+		{
+			if( data[ data_offset ] != reference_data[ data_offset ] )
+			{
+				return( data_offset );
+			}
+			data_offset++;
+		}
+		data_64bit           = (const uint64_t *) &( data[ data_offset ] );
+		reference_data_64bit = (const uint64_t *) &( reference_data[ data_offset ] );
+
+		while( ( data_size - data_offset ) >= ( 4 * sizeof( uint64_t ) ) )
+		{
+			if( ( ( data_64bit[ 0 ] ^ reference_data_64bit[ 0 ] )
+			    | ( data_64bit[ 1 ] ^ reference_data_64bit[ 1 ] )
+			    | ( data_64bit[ 2 ] ^ reference_data_64bit[ 2 ] )
+			    | ( data_64bit[ 3 ] ^ reference_data_64bit[ 3 ] ) ) != 0 )
+			{
+				break;
+			}
+			data_64bit           += 4;
+			reference_data_64bit += 4;
+			data_offset          += 4 * sizeof( uint64_t );
+		}
+	}
+#endif /* defined( __SSE2__ ) */
+
+	/* Determine the first byte that differs
+	 */
+	while( data_offset < data_size )
+	{
+		if( data[ data_offset ] != reference_data[ data_offset ] )
+		{
+			break;
+		}
+		data_offset++;
+	}
+	return( data_offset );
+}
+
+/* Appends a mismatch to the mismatches range list
+ * The parts of the range that overlap with read errors are expected to mismatch and are not appended
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_verify_append_mismatch(
+     libsmdev_internal_handle_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_verify_append_mismatch";
+	intptr_t *value       = NULL;
+	uint64_t error_offset = 0;
+	uint64_t error_size   = 0;
+	uint64_t range_end    = 0;
+	uint64_t range_offset = 0;
+	int error_index       = 0;
+	int number_of_errors  = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_get_number_of_elements(
+	     internal_handle->errors_range_list,
+	     &number_of_errors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements in errors range list.",
+		 function );
+
+		return( -1 );
+	}
+	range_offset = (uint64_t) offset;
+	range_end    = range_offset + size;
+
+	/* The errors range list is sorted by offset
+	 */
+	for( error_index = 0;
+	     error_index < number_of_errors;
+	     error_index++ )
+	{
+		if( libcdata_range_list_get_range_by_index(
+		     internal_handle->errors_range_list,
+		     error_index,
+		     &error_offset,
+		     &error_size,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve error: %d from errors range list.",
+			 function,
+			 error_index );
+
+			return( -1 );
+		}
+		if( error_offset >= range_end )
+		{
+			break;
+		}
+		if( ( error_offset + error_size ) <= range_offset )
+		{
+			continue;
+		}
+		if( error_offset > range_offset )
+		{
+			if( libcdata_range_list_insert_range(
+			     internal_handle->mismatches_range_list,
+			     range_offset,
+			     error_offset - range_offset,
+			     NULL,
+			     NULL,
+			     NULL,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert mismatch in range list.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		range_offset = error_offset + error_size;
+
+		if( range_offset >= range_end )
+		{
+			return( 1 );
+		}
+	}
+	if( libcdata_range_list_insert_range(
+	     internal_handle->mismatches_range_list,
+	     range_offset,
+	     range_end - range_offset,
+	     NULL,
+	     NULL,
+	     NULL,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert mismatch in range list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compares a buffer read from the storage media with a reference buffer
+ * Mismatches are appended to the mismatches range list with sector granularity
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_verify_compare_buffers(
+     libsmdev_internal_handle_t *internal_handle,
+     const uint8_t *data,
+     const uint8_t *reference_data,
+     size_t data_size,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function   = "libsmdev_verify_compare_buffers";
+	size_t bytes_per_sector = 0;
+	size_t data_offset      = 0;
+	size_t mismatch_end     = 0;
+	size_t mismatch_start   = 0;
+	size_t search_offset    = 0;
+	size_t sector_end       = 0;
+	size_t sector_offset    = 0;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 || ( reference_data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	bytes_per_sector = (size_t) internal_handle->bytes_per_sector;
+
+	if( bytes_per_sector == 0 )
+	{
+		bytes_per_sector = 512;
+	}
+	while( data_offset < data_size )
+	{
+		search_offset = data_offset;
+
+		data_offset += libsmdev_verify_compare_data(
+		                &( data[ data_offset ] ),
+		                &( reference_data[ data_offset ] ),
+		                data_size - data_offset );
+
+		if( data_offset >= data_size )
+		{
+			break;
+		}
+		/* Extend the mismatch to the start of the sector, the data before the search offset is known to match
+		 */
+		sector_offset = (size_t) ( ( (size64_t) offset + data_offset ) % bytes_per_sector );
+
+		if( sector_offset > ( data_offset - search_offset ) )
+		{
+			mismatch_start = search_offset;
+		}
+		else
+		{
+			mismatch_start = data_offset - sector_offset;
+		}
+		/* Extend the mismatch with the following sectors until a sector matches
+		 */
+		mismatch_end = data_offset;
+
+		while( mismatch_end < data_size )
+		{
+			sector_end = mismatch_end + bytes_per_sector - (size_t) ( ( (size64_t) offset + mismatch_end ) % bytes_per_sector );
+
+			if( sector_end > data_size )
+			{
+				sector_end = data_size;
+			}
+			if( ( mismatch_end > data_offset )
+			 && ( libsmdev_verify_compare_data(
+			       &( data[ mismatch_end ] ),
+			       &( reference_data[ mismatch_end ] ),
+			       sector_end - mismatch_end ) == ( sector_end - mismatch_end ) ) )
+			{
+				break;
+			}
+			mismatch_end = sector_end;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
+			 function,
+			 offset + (off64_t) mismatch_start,
+			 offset + (off64_t) mismatch_start,
+			 mismatch_end - mismatch_start );
+		}
+#endif
+		if( libsmdev_verify_append_mismatch(
+		     internal_handle,
+		     offset + (off64_t) mismatch_start,
+		     (size64_t) ( mismatch_end - mismatch_start ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append mismatch.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset = mismatch_end;
+	}
+	return( 1 );
+}
+
+/* Verifies a range of the storage media against reference data read from a file descriptor
+ * The data is read by the handle, hence read errors are handled as by libsmdev_handle_read_buffer
+ * If the reference data ends before the range, the remainder of the range is considered a mismatch
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libsmdev_verify_range_buffered(
+     libsmdev_internal_handle_t *internal_handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libsmdev_copy_buffer_t *device_buffer    = NULL;
+	libsmdev_copy_buffer_t *reference_buffer = NULL;
+	static char *function                    = "libsmdev_verify_range_buffered";
+	size_t read_size                         = 0;
+	ssize_t read_count                       = 0;
+	ssize_t reference_read_count             = 0;
+	int error_code                           = 0;
+	int result                               = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_copy_buffer_initialize(
+	     &device_buffer,
+	     LIBSMDEV_VERIFY_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create device buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_copy_buffer_initialize(
+	     &reference_buffer,
+	     LIBSMDEV_VERIFY_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create reference buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_handle_seek_offset(
+	     (libsmdev_handle_t *) internal_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		goto on_error;
+	}
+	while( size > 0 )
+	{
+		if( internal_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		read_size = libsmdev_verify_get_chunk_size(
+		             offset,
+		             size );
+
+		reference_read_count = libsmdev_verify_read_buffer(
+		                        file_descriptor,
+		                        reference_buffer->data,
+		                        read_size,
+		                        &error_code,
+		                        error );
+
+		if( reference_read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read reference data of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+		if( reference_read_count == 0 )
+		{
+			break;
+		}
+		read_count = libsmdev_handle_read_buffer(
+		              (libsmdev_handle_t *) internal_handle,
+		              device_buffer->data,
+		              (size_t) reference_read_count,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+		if( read_count != reference_read_count )
+		{
+			if( internal_handle->abort != 0 )
+			{
+				result = 0;
+
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+		if( libsmdev_verify_compare_buffers(
+		     internal_handle,
+		     device_buffer->data,
+		     reference_buffer->data,
+		     (size_t) read_count,
+		     offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare buffer of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			goto on_error;
+		}
+		offset += (off64_t) read_count;
+		size   -= (size64_t) read_count;
+
+		if( (size_t) reference_read_count < read_size )
+		{
+			break;
+		}
+	}
+	if( ( result == 1 )
+	 && ( size > 0 ) )
+	{
+		if( libsmdev_verify_append_mismatch(
+		     internal_handle,
+		     offset,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append mismatch for missing reference data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsmdev_copy_buffer_free(
+	     &reference_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free reference buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_copy_buffer_free(
+	     &device_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free device buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( reference_buffer != NULL )
+	{
+		libsmdev_copy_buffer_free(
+		 &reference_buffer,
+		 NULL );
+	}
+	if( device_buffer != NULL )
+	{
+		libsmdev_copy_buffer_free(
+		 &device_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The reference reader thread callback
+ * Reads the reference data into the buffers until the range was read, the end of the
+ * reference data is reached or the reader is stopped, and then hands over a buffer without data
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_verify_reader_callback(
+     libsmdev_verify_reader_t *verify_reader )
+{
+	libcerror_error_t *error                 = NULL;
+	libsmdev_copy_buffer_t *reference_buffer = NULL;
+	static char *function                    = "libsmdev_verify_reader_callback";
+	size_t read_size                         = 0;
+	ssize_t read_count                       = 0;
+
+	if( verify_reader == NULL )
+	{
+		return( -1 );
+	}
+	do
+	{
+		reference_buffer = NULL;
+
+		if( libcthreads_queue_pop(
+		     verify_reader->empty_buffers_queue,
+		     (intptr_t **) &reference_buffer,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop buffer from empty buffers queue.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = 0;
+
+		if( ( verify_reader->size > 0 )
+		 && ( verify_reader->stop == 0 ) )
+		{
+			read_size = libsmdev_verify_get_chunk_size(
+			             verify_reader->offset,
+			             verify_reader->size );
+
+			read_count = libsmdev_verify_read_buffer(
+			              verify_reader->file_descriptor,
+			              reference_buffer->data,
+			              read_size,
+			              &( verify_reader->read_error_code ),
+			              &error );
+
+			if( read_count < 0 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_print_error_backtrace(
+					 error );
+				}
+#endif
+				libcerror_error_free(
+				 &error );
+
+				verify_reader->read_failed = 1;
+
+				read_count = 0;
+			}
+			else if( (size_t) read_count < read_size )
+			{
+				/* The end of the reference data was reached
+				 */
+				verify_reader->size = (size64_t) read_count;
+			}
+			verify_reader->offset += (off64_t) read_count;
+			verify_reader->size   -= (size64_t) read_count;
+		}
+		reference_buffer->data_size = (size_t) read_count;
+
+		if( libcthreads_queue_push(
+		     verify_reader->full_buffers_queue,
+		     (intptr_t *) reference_buffer,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push buffer onto full buffers queue.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( read_count > 0 );
+
+	return( 1 );
+
+on_error:
+	verify_reader->read_failed = 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Verifies a range of the storage media against reference data read from a file descriptor
+ * A reader thread reads the reference data into a ring of buffers while the calling thread
+ * reads the storage media and compares, so that both are read concurrently
+ * If the reference data ends before the range, the remainder of the range is considered a mismatch
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int libsmdev_verify_range_pipelined(
+     libsmdev_internal_handle_t *internal_handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libsmdev_verify_reader_t verify_reader;
+
+	libcthreads_thread_t *reader_thread      = NULL;
+	libsmdev_copy_buffer_t *device_buffer    = NULL;
+	libsmdev_copy_buffer_t *reference_buffer = NULL;
+	static char *function                    = "libsmdev_verify_range_pipelined";
+	ssize_t read_count                       = 0;
+	uint8_t reader_finished                  = 0;
+	int buffer_index                         = 0;
+	int result                               = 1;
+
+	if( internal_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &verify_reader,
+	     0,
+	     sizeof( libsmdev_verify_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear verify reader.",
+		 function );
+
+		return( -1 );
+	}
+	verify_reader.file_descriptor = file_descriptor;
+	verify_reader.offset          = offset;
+	verify_reader.size            = size;
+
+	if( libsmdev_copy_buffer_initialize(
+	     &device_buffer,
+	     LIBSMDEV_VERIFY_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create device buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( verify_reader.empty_buffers_queue ),
+	     LIBSMDEV_VERIFY_NUMBER_OF_BUFFERS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create empty buffers queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( verify_reader.full_buffers_queue ),
+	     LIBSMDEV_VERIFY_NUMBER_OF_BUFFERS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create full buffers queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( buffer_index = 0;
+	     buffer_index < LIBSMDEV_VERIFY_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( libsmdev_copy_buffer_initialize(
+		     &reference_buffer,
+		     LIBSMDEV_VERIFY_BUFFER_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create reference buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_push(
+		     verify_reader.empty_buffers_queue,
+		     (intptr_t *) reference_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push reference buffer: %d onto empty buffers queue.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+		reference_buffer = NULL;
+	}
+	if( libsmdev_handle_seek_offset(
+	     (libsmdev_handle_t *) internal_handle,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		goto on_error;
+	}
+	if( libcthreads_thread_create(
+	     &reader_thread,
+	     NULL,
+	     (int (*)(void *)) &libsmdev_verify_reader_callback,
+	     (void *) &verify_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create reader thread.",
+		 function );
+
+		goto on_error;
+	}
+	while( size > 0 )
+	{
+		if( internal_handle->abort != 0 )
+		{
+			result = 0;
+
+			break;
+		}
+		if( libcthreads_queue_pop(
+		     verify_reader.full_buffers_queue,
+		     (intptr_t **) &reference_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop buffer from full buffers queue.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( reference_buffer->data_size == 0 )
+		{
+			/* The reader has finished before the end of the range
+			 */
+			reader_finished = 1;
+
+			break;
+		}
+		read_count = libsmdev_handle_read_buffer(
+		              (libsmdev_handle_t *) internal_handle,
+		              device_buffer->data,
+		              reference_buffer->data_size,
+		              error );
+
+		if( read_count != (ssize_t) reference_buffer->data_size )
+		{
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset,
+				 offset );
+
+				result = -1;
+			}
+			else if( internal_handle->abort != 0 )
+			{
+				result = 0;
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unexpected end of data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset,
+				 offset );
+
+				result = -1;
+			}
+			break;
+		}
+		if( libsmdev_verify_compare_buffers(
+		     internal_handle,
+		     device_buffer->data,
+		     reference_buffer->data,
+		     (size_t) read_count,
+		     offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare buffer of offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			result = -1;
+
+			break;
+		}
+		if( libcthreads_queue_push(
+		     verify_reader.empty_buffers_queue,
+		     (intptr_t *) reference_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push buffer onto empty buffers queue.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		reference_buffer = NULL;
+
+		offset += (off64_t) read_count;
+		size   -= (size64_t) read_count;
+	}
+	/* Stop the reader and hand back the buffers until it signals it has finished
+	 */
+	verify_reader.stop = 1;
+
+	while( reader_finished == 0 )
+	{
+		if( reference_buffer != NULL )
+		{
+			if( libcthreads_queue_push(
+			     verify_reader.empty_buffers_queue,
+			     (intptr_t *) reference_buffer,
+			     ( result == -1 ) ? NULL : error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push buffer onto empty buffers queue.",
+				 function );
+
+				goto on_error;
+			}
+			reference_buffer = NULL;
+		}
+		if( libcthreads_queue_pop(
+		     verify_reader.full_buffers_queue,
+		     (intptr_t **) &reference_buffer,
+		     ( result == -1 ) ? NULL : error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop buffer from full buffers queue.",
+			 function );
+
+			goto on_error;
+		}
+		if( reference_buffer->data_size == 0 )
+		{
+			reader_finished = 1;
+		}
+	}
+	if( libcthreads_thread_join(
+	     &reader_thread,
+	     ( result == -1 ) ? NULL : error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join reader thread.",
+		 function );
+
+		goto on_error;
+	}
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( verify_reader.read_failed != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 verify_reader.read_error_code,
+		 "%s: unable to read reference data from file descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result == 1 )
+	 && ( size > 0 ) )
+	{
+		if( libsmdev_verify_append_mismatch(
+		     internal_handle,
+		     offset,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append mismatch for missing reference data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libsmdev_copy_buffer_free(
+	     &reference_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free reference buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_free(
+	     &( verify_reader.full_buffers_queue ),
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_copy_buffer_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free full buffers queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_free(
+	     &( verify_reader.empty_buffers_queue ),
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_copy_buffer_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free empty buffers queue.",
+		 function );
+
+		goto on_error;
+	}
+	if( libsmdev_copy_buffer_free(
+	     &device_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free device buffer.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( reader_thread != NULL )
+	{
+		verify_reader.stop = 1;
+
+		/* Make sure the reader is not blocked on the empty buffers queue
+		 */
+		if( reference_buffer != NULL )
+		{
+			if( libcthreads_queue_push(
+			     verify_reader.empty_buffers_queue,
+			     (intptr_t *) reference_buffer,
+			     NULL ) == 1 )
+			{
+				reference_buffer = NULL;
+			}
+		}
+		libcthreads_thread_join(
+		 &reader_thread,
+		 NULL );
+	}
+	if( reference_buffer != NULL )
+	{
+		libsmdev_copy_buffer_free(
+		 &reference_buffer,
+		 NULL );
+	}
+	if( verify_reader.full_buffers_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( verify_reader.full_buffers_queue ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_copy_buffer_free,
+		 NULL );
+	}
+	if( verify_reader.empty_buffers_queue != NULL )
+	{
+		libcthreads_queue_free(
+		 &( verify_reader.empty_buffers_queue ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_copy_buffer_free,
+		 NULL );
+	}
+	if( device_buffer != NULL )
+	{
+		libsmdev_copy_buffer_free(
+		 &device_buffer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,143 @@
+/*
+ * Verify functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_VERIFY_H )
+#define _LIBSMDEV_VERIFY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_copy.h"
+#include "libsmdev_handle.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a verify buffer
+ * Chunks are aligned to this size relative to the start of the media
+ */
+#define LIBSMDEV_VERIFY_BUFFER_SIZE		4194304
+
+/* The number of verify buffers in the ring between the reference reader and the comparer
+ */
+#define LIBSMDEV_VERIFY_NUMBER_OF_BUFFERS	4
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libsmdev_verify_reader libsmdev_verify_reader_t;
+
+struct libsmdev_verify_reader
+{
+	/* The reference file descriptor
+	 */
+	int file_descriptor;
+
+	/* The media offset of the next chunk
+	 */
+	off64_t offset;
+
+	/* The size of the data that remains to be read
+	 */
+	size64_t size;
+
+	/* The queue of buffers that can be filled by the reader
+	 */
+	libcthreads_queue_t *empty_buffers_queue;
+
+	/* The queue of buffers that are to be compared
+	 */
+	libcthreads_queue_t *full_buffers_queue;
+
+	/* Value to indicate the reader should stop
+	 */
+	uint8_t stop;
+
+	/* Value to indicate reading failed
+	 */
+	uint8_t read_failed;
+
+	/* The error code of the read that failed
+	 */
+	int read_error_code;
+};
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+size_t libsmdev_verify_get_chunk_size(
+        off64_t offset,
+        size64_t size );
+
+ssize_t libsmdev_verify_read_buffer(
+         int file_descriptor,
+         uint8_t *buffer,
+         size_t size,
+         int *error_code,
+         libcerror_error_t **error );
+
+size_t libsmdev_verify_compare_data(
+        const uint8_t *data,
+        const uint8_t *reference_data,
+        size_t data_size );
+
+int libsmdev_verify_append_mismatch(
+     libsmdev_internal_handle_t *internal_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libsmdev_verify_compare_buffers(
+     libsmdev_internal_handle_t *internal_handle,
+     const uint8_t *data,
+     const uint8_t *reference_data,
+     size_t data_size,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libsmdev_verify_range_buffered(
+     libsmdev_internal_handle_t *internal_handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsmdev_verify_reader_callback(
+     libsmdev_verify_reader_t *verify_reader );
+
+int libsmdev_verify_range_pipelined(
+     libsmdev_internal_handle_t *internal_handle,
+     int file_descriptor,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_VERIFY_H ) */
+
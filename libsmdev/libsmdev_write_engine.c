@@ -0,0 +1,2139 @@
+/*
+ * Write engine functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#include "libsmdev_definitions.h"
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcnotify.h"
+#include "libsmdev_libcthreads.h"
+#include "libsmdev_write_engine.h"
+
+/* Creates a write engine buffer
+ * Make sure the value buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_write_engine_buffer_initialize(
+     libsmdev_write_engine_buffer_t **buffer,
+     size_t allocated_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_write_engine_buffer_initialize";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocated_size == 0 )
+	 || ( allocated_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocated size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer = memory_allocate_structure(
+	           libsmdev_write_engine_buffer_t );
+
+	if( *buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *buffer,
+	     0,
+	     sizeof( libsmdev_write_engine_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer.",
+		 function );
+
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+
+		return( -1 );
+	}
+	( *buffer )->data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * allocated_size );
+
+	if( ( *buffer )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	( *buffer )->allocated_size = allocated_size;
+
+	return( 1 );
+
+on_error:
+	if( *buffer != NULL )
+	{
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a write engine buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_write_engine_buffer_free(
+     libsmdev_write_engine_buffer_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_write_engine_buffer_free";
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer != NULL )
+	{
+		memory_free(
+		 ( *buffer )->data );
+
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates a write engine
+ * More than 1 buffer writes the buffers using a writer thread, which requires multi-thread support
+ * Write errors are added to the errors range list
+ * Make sure the value write_engine is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_write_engine_initialize(
+     libsmdev_write_engine_t **write_engine,
+     libsmdev_io_backend_t *io_backend,
+     size_t bytes_per_sector,
+     size64_t media_size,
+     int number_of_buffers,
+     uint8_t number_of_error_retries,
+     size_t error_granularity,
+     libcdata_range_list_t *errors_range_list,
+     libcerror_error_t **error )
+{
+	libsmdev_write_engine_buffer_t *buffer = NULL;
+	static char *function                  = "libsmdev_write_engine_initialize";
+	size_t buffer_size                     = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int buffer_index                       = 0;
+#endif
+
+	if( write_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( *write_engine != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid write engine value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_backend == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO backend.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bytes_per_sector == 0 )
+	 || ( bytes_per_sector > (size_t) LIBSMDEV_WRITE_ENGINE_MAXIMUM_SECTOR_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buffers <= 0 )
+	 || ( number_of_buffers > LIBSMDEV_WRITE_ENGINE_MAXIMUM_NUMBER_OF_BUFFERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buffers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_buffers > 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of buffers: %d - multi-thread support not available.",
+		 function,
+		 number_of_buffers );
+
+		return( -1 );
+	}
+#endif
+	if( errors_range_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid errors range list.",
+		 function );
+
+		return( -1 );
+	}
+	*write_engine = memory_allocate_structure(
+	                 libsmdev_write_engine_t );
+
+	if( *write_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create write engine.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *write_engine,
+	     0,
+	     sizeof( libsmdev_write_engine_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear write engine.",
+		 function );
+
+		memory_free(
+		 *write_engine );
+
+		*write_engine = NULL;
+
+		return( -1 );
+	}
+	( *write_engine )->io_backend              = io_backend;
+	( *write_engine )->bytes_per_sector        = bytes_per_sector;
+	( *write_engine )->media_size              = media_size;
+	( *write_engine )->number_of_buffers       = number_of_buffers;
+	( *write_engine )->number_of_error_retries = number_of_error_retries;
+	( *write_engine )->error_granularity       = error_granularity;
+	( *write_engine )->errors_range_list       = errors_range_list;
+	( *write_engine )->flush_policy            = LIBSMDEV_WRITE_FLUSH_POLICY_NONE;
+
+	( *write_engine )->sector_data = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * bytes_per_sector );
+
+	if( ( *write_engine )->sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sector data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The buffer size is a multiple of the sector size so that a full buffer
+	 * that starts on a sector boundary also ends on one
+	 */
+	buffer_size = ( LIBSMDEV_WRITE_ENGINE_BUFFER_SIZE / bytes_per_sector ) * bytes_per_sector;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_buffers > 1 )
+	{
+		if( libcthreads_queue_initialize(
+		     &( ( *write_engine )->empty_buffers_queue ),
+		     number_of_buffers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create empty buffers queue.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_queue_initialize(
+		     &( ( *write_engine )->full_buffers_queue ),
+		     number_of_buffers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create full buffers queue.",
+			 function );
+
+			goto on_error;
+		}
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			if( libsmdev_write_engine_buffer_initialize(
+			     &buffer,
+			     buffer_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create buffer: %d.",
+				 function,
+				 buffer_index );
+
+				goto on_error;
+			}
+			if( libcthreads_queue_push(
+			     ( *write_engine )->empty_buffers_queue,
+			     (intptr_t *) buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push buffer: %d onto empty buffers queue.",
+				 function,
+				 buffer_index );
+
+				goto on_error;
+			}
+			buffer = NULL;
+		}
+		if( libcthreads_thread_create(
+		     &( ( *write_engine )->writer_thread ),
+		     NULL,
+		     (int (*)(void *)) &libsmdev_write_engine_writer_callback,
+		     (void *) *write_engine,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create writer thread.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		if( libsmdev_write_engine_buffer_initialize(
+		     &( ( *write_engine )->current_buffer ),
+		     buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		libsmdev_write_engine_buffer_free(
+		 &buffer,
+		 NULL );
+	}
+	if( *write_engine != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *write_engine )->full_buffers_queue != NULL )
+		{
+			libcthreads_queue_free(
+			 &( ( *write_engine )->full_buffers_queue ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *write_engine )->empty_buffers_queue != NULL )
+		{
+			libcthreads_queue_free(
+			 &( ( *write_engine )->empty_buffers_queue ),
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_write_engine_buffer_free,
+			 NULL );
+		}
+#endif
+		if( ( *write_engine )->sector_data != NULL )
+		{
+			memory_free(
+			 ( *write_engine )->sector_data );
+		}
+		memory_free(
+		 *write_engine );
+
+		*write_engine = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a write engine
+ * Data that was not submitted to the writer is discarded, use libsmdev_write_engine_drain to write it
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_write_engine_free(
+     libsmdev_write_engine_t **write_engine,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_write_engine_free";
+	int result            = 1;
+
+	if( write_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( *write_engine != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *write_engine )->writer_thread != NULL )
+		{
+			/* Signal the writer thread to stop by a buffer without data
+			 */
+			if( ( *write_engine )->current_buffer == NULL )
+			{
+				if( libcthreads_queue_pop(
+				     ( *write_engine )->empty_buffers_queue,
+				     (intptr_t **) &( ( *write_engine )->current_buffer ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to pop buffer from empty buffers queue.",
+					 function );
+
+					result = -1;
+				}
+			}
+			if( ( *write_engine )->current_buffer != NULL )
+			{
+				( *write_engine )->current_buffer->data_size = 0;
+
+				if( libcthreads_queue_push(
+				     ( *write_engine )->full_buffers_queue,
+				     (intptr_t *) ( *write_engine )->current_buffer,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push buffer onto full buffers queue.",
+					 function );
+
+					result = -1;
+				}
+				else
+				{
+					( *write_engine )->current_buffer = NULL;
+				}
+			}
+			if( libcthreads_thread_join(
+			     &( ( *write_engine )->writer_thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join writer thread.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *write_engine )->full_buffers_queue != NULL )
+		{
+			if( libcthreads_queue_free(
+			     &( ( *write_engine )->full_buffers_queue ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_write_engine_buffer_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free full buffers queue.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *write_engine )->empty_buffers_queue != NULL )
+		{
+			if( libcthreads_queue_free(
+			     &( ( *write_engine )->empty_buffers_queue ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libsmdev_write_engine_buffer_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free empty buffers queue.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		if( ( *write_engine )->current_buffer != NULL )
+		{
+			if( libsmdev_write_engine_buffer_free(
+			     &( ( *write_engine )->current_buffer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free current buffer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *write_engine )->sector_data );
+
+		memory_free(
+		 *write_engine );
+
+		*write_engine = NULL;
+	}
+	return( result );
+}
+
+/* Sets the flush policy
+ * The flush device function is called to flush the device cache, if NULL flushing only writes the buffered data
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_write_engine_set_flush_policy(
+     libsmdev_write_engine_t *write_engine,
+     int flush_policy,
+     size64_t flush_interval,
+     int (*flush_device)(
+            intptr_t *flush_context,
+            libcerror_error_t **error ),
+     intptr_t *flush_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_write_engine_set_flush_policy";
+
+	if( write_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flush_policy != LIBSMDEV_WRITE_FLUSH_POLICY_NONE )
+	 && ( flush_policy != LIBSMDEV_WRITE_FLUSH_POLICY_INTERVAL )
+	 && ( flush_policy != LIBSMDEV_WRITE_FLUSH_POLICY_END ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flush policy: %d.",
+		 function,
+		 flush_policy );
+
+		return( -1 );
+	}
+	if( ( flush_policy == LIBSMDEV_WRITE_FLUSH_POLICY_INTERVAL )
+	 && ( flush_interval == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid flush interval value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	write_engine->flush_policy   = flush_policy;
+	write_engine->flush_interval = flush_interval;
+	write_engine->flush_device   = flush_device;
+	write_engine->flush_context  = flush_context;
+
+	return( 1 );
+}
+
+/* Sets the write zeroes function
+ * The write zeroes function is used to write runs of zero blocks without transferring the data,
+ * if NULL zero blocks are written as data
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_write_engine_set_write_zeroes(
+     libsmdev_write_engine_t *write_engine,
+     int (*write_zeroes)(
+            intptr_t *write_zeroes_context,
+            off64_t offset,
+            size64_t size,
+            libcerror_error_t **error ),
+     intptr_t *write_zeroes_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_write_engine_set_write_zeroes";
+
+	if( write_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write engine.",
+		 function );
+
+		return( -1 );
+	}
+	write_engine->write_zeroes         = write_zeroes;
+	write_engine->write_zeroes_context = write_zeroes_context;
+
+	return( 1 );
+}
+
+/* Determines if a write that failed with a specific error code can be retried
+ * Returns 1 if the error is recoverable or 0 if not
+ */
+int libsmdev_write_engine_error_code_is_recoverable(
+     uint32_t error_code )
+{
+	switch( error_code )
+	{
+#if defined( WINAPI )
+		case ERROR_CRC:
+		case ERROR_IO_DEVICE:
+		case ERROR_SECTOR_NOT_FOUND:
+		case ERROR_WRITE_FAULT:
+			return( 1 );
+
+		default:
+			break;
+#else
+		/* Writing should not be retried for some POSIX error conditions
+		 */
+		case EACCES:
+		case EBADF:
+		case ENODEV:
+		case ENOSPC:
+		case ENXIO:
+		case EPERM:
+		case EROFS:
+		case ESPIPE:
+			break;
+
+		default:
+			return( 1 );
+#endif
+	}
+	return( 0 );
+}
+
+/* Writes data at a specific offset
+ * Writes that only partially complete are continued
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libsmdev_write_engine_write_at_offset(
+         libsmdev_write_engine_t *write_engine,
+         const uint8_t *data,
+         size_t data_size,
+         off64_t offset,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	static char *function = "libsmdev_write_engine_write_at_offset";
+	size_t data_offset    = 0;
+	ssize_t write_count   = 0;
+
+	if( write_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	*error_code = 0;
+
+	if( libsmdev_io_backend_seek_offset(
+	     write_engine->io_backend,
+	     offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		write_count = libsmdev_io_backend_write_buffer(
+		               write_engine->io_backend,
+		               &( data[ data_offset ] ),
+		               data_size - data_offset,
+		               error_code,
+		               error );
+
+		if( write_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset + (off64_t) data_offset,
+			 offset + (off64_t) data_offset );
+
+			return( -1 );
+		}
+		else if( write_count == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data at offset: %" PRIi64 " (0x%08" PRIx64 ") - no data written.",
+			 function,
+			 offset + (off64_t) data_offset,
+			 offset + (off64_t) data_offset );
+
+			return( -1 );
+		}
+		data_offset += (size_t) write_count;
+	}
+	return( (ssize_t) data_offset );
+}
+
+/* Writes a range of data
+ * A range that cannot be written is retried and then written in blocks of the error granularity,
+ * the blocks that cannot be written are added to the errors range list
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_write_engine_write_range(
+     libsmdev_write_engine_t *write_engine,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function        = "libsmdev_write_engine_write_range";
+	size_t block_size            = 0;
+	size_t data_offset           = 0;
+	size_t error_granularity     = 0;
+	ssize_t write_count          = 0;
+	off64_t block_offset         = 0;
+	uint32_t error_code          = 0;
+	int16_t number_of_attempts   = 0;
+	uint8_t write_in_blocks      = 0;
+
+	if( write_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write engine.",
+		 function );
+
+		return( -1 );
+	}
+	error_granularity = write_engine->error_granularity;
+
+	if( error_granularity < write_engine->bytes_per_sector )
+	{
+		error_granularity = write_engine->bytes_per_sector;
+	}
+	else
+	{
+		error_granularity = ( ( error_granularity + write_engine->bytes_per_sector - 1 ) / write_engine->bytes_per_sector ) * write_engine->bytes_per_sector;
+	}
+	/* The entire range is written first, the blocks only after it could not be written
+	 */
+	block_offset = offset;
+	block_size   = data_size;
+
+	while( data_offset < data_size )
+	{
+		for( number_of_attempts = 0;
+		     number_of_attempts <= (int16_t) write_engine->number_of_error_retries;
+		     number_of_attempts++ )
+		{
+			write_count = libsmdev_write_engine_write_at_offset(
+			               write_engine,
+			               &( data[ data_offset ] ),
+			               block_size,
+			               block_offset,
+			               &error_code,
+			               error );
+
+			if( write_count == (ssize_t) block_size )
+			{
+				break;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: write error: %" PRIi16 " at offset: %" PRIi64 " (0x%08" PRIx64 ") with error code: %" PRIu32 ".\n",
+				 function,
+				 number_of_attempts,
+				 block_offset,
+				 block_offset,
+				 error_code );
+
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			if( libsmdev_write_engine_error_code_is_recoverable(
+			     error_code ) == 0 )
+			{
+				write_engine->write_failed     = 1;
+				write_engine->write_error_code = error_code;
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write to device file.",
+				 function );
+
+				return( -1 );
+			}
+			libcerror_error_free(
+			 error );
+		}
+		if( write_count != (ssize_t) block_size )
+		{
+			if( write_in_blocks == 0 )
+			{
+				write_in_blocks = 1;
+			}
+			else
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: adding write error at offset: %" PRIi64 " (0x%08" PRIx64 "), number of bytes: %" PRIzd ".\n",
+					 function,
+					 block_offset,
+					 block_offset,
+					 block_size );
+				}
+#endif
+				if( libcdata_range_list_insert_range(
+				     write_engine->errors_range_list,
+				     (uint64_t) block_offset,
+				     (uint64_t) block_size,
+				     NULL,
+				     NULL,
+				     NULL,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to insert write error to range list.",
+					 function );
+
+					return( -1 );
+				}
+				data_offset += block_size;
+			}
+		}
+		else
+		{
+			data_offset += block_size;
+		}
+		if( write_in_blocks != 0 )
+		{
+			/* The blocks are aligned to the error granularity relative to the start of the media
+			 */
+			block_offset = offset + (off64_t) data_offset;
+			block_size   = error_granularity - (size_t) ( block_offset % (off64_t) error_granularity );
+
+			if( block_size > ( data_size - data_offset ) )
+			{
+				block_size = data_size - data_offset;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Determines if data only contains zero bytes
+ * Returns 1 if the data only contains zero bytes or 0 if not
+ */
+int libsmdev_write_engine_data_is_zero(
+     const uint8_t *data,
+     size_t data_size )
+{
+	const uint64_t *data_64bit = NULL;
+	size_t data_offset         = 0;
+
+	if( data == NULL )
+	{
+		return( 0 );
+	}
+	/* Check the bytes up to the first 64-bit aligned value
+	 */
+	while( ( data_offset < data_size )
+	    && ( ( (intptr_t) &( data[ data_offset ] ) % sizeof( uint64_t ) ) != 0 ) )
+	{
+		if( data[ data_offset ] != 0 )
+		{
+			return( 0 );
+		}
+		data_offset++;
+	}
+	/* Check 4 64-bit values at a time, the combined comparison allows the compiler to vectorize the loop
+	 */
+	data_64bit = (const uint64_t *) &( data[ data_offset ] );
+
+	while( ( data_size - data_offset ) >= ( 4 * sizeof( uint64_t ) ) )
+	{
+		if( ( data_64bit[ 0 ] | data_64bit[ 1 ] | data_64bit[ 2 ] | data_64bit[ 3 ] ) != 0 )
+		{
+			return( 0 );
+		}
+		data_64bit  += 4;
+		data_offset += 4 * sizeof( uint64_t );
+	}
+	while( data_offset < data_size )
+	{
+		if( data[ data_offset ] != 0 )
+		{
+			return( 0 );
+		}
+		data_offset++;
+	}
+	return( 1 );
+}
+
+/* Writes data of a sector aligned range
+ * Runs of blocks that only contain zero bytes are written using the write zeroes function if available,
+ * if the write zeroes function cannot write a run it is written as data
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_write_engine_write_data(
+     libsmdev_write_engine_t *write_engine,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function  = "libsmdev_write_engine_write_data";
+	size_t block_size      = 0;
+	size_t run_offset      = 0;
+	size_t run_size        = 0;
+	size_t zero_block_size = 0;
+	int block_is_zero      = 0;
+	int result             = 0;
+	int run_is_zero        = 0;
+
+	if( write_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	zero_block_size = LIBSMDEV_WRITE_ENGINE_ZERO_BLOCK_SIZE
+	                - ( LIBSMDEV_WRITE_ENGINE_ZERO_BLOCK_SIZE % write_engine->bytes_per_sector );
+
+	if( ( write_engine->write_zeroes == NULL )
+	 || ( data_size < zero_block_size ) )
+	{
+		return( libsmdev_write_engine_write_range(
+		         write_engine,
+		         data,
+		         data_size,
+		         offset,
+		         error ) );
+	}
+	while( run_offset < data_size )
+	{
+		/* Determine a run of blocks that either all contain only zero bytes or not,
+		 * a trailing block smaller than the zero block size is always written as data
+		 */
+		run_size = 0;
+
+		while( ( run_offset + run_size ) < data_size )
+		{
+			block_size = data_size - ( run_offset + run_size );
+
+			if( block_size > zero_block_size )
+			{
+				block_size = zero_block_size;
+			}
+			block_is_zero = 0;
+
+			if( block_size == zero_block_size )
+			{
+				block_is_zero = libsmdev_write_engine_data_is_zero(
+				                 &( data[ run_offset + run_size ] ),
+				                 block_size );
+			}
+			if( run_size == 0 )
+			{
+				run_is_zero = block_is_zero;
+			}
+			else if( block_is_zero != run_is_zero )
+			{
+				break;
+			}
+			run_size += block_size;
+		}
+		result = 0;
+
+		if( run_is_zero != 0 )
+		{
+			result = write_engine->write_zeroes(
+			          write_engine->write_zeroes_context,
+			          offset + (off64_t) run_offset,
+			          (size64_t) run_size,
+			          error );
+
+			if( result == -1 )
+			{
+				write_engine->write_failed = 1;
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write zeroes at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset + (off64_t) run_offset,
+				 offset + (off64_t) run_offset );
+
+				return( -1 );
+			}
+		}
+		if( result == 0 )
+		{
+			if( libsmdev_write_engine_write_range(
+			     write_engine,
+			     &( data[ run_offset ] ),
+			     run_size,
+			     offset + (off64_t) run_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 offset + (off64_t) run_offset,
+				 offset + (off64_t) run_offset );
+
+				return( -1 );
+			}
+		}
+		run_offset += run_size;
+	}
+	return( 1 );
+}
+
+/* Reads a partial sector of a buffer from the device
+ * The parts of the sector that were not written by the caller are copied into the buffer
+ * Returns 1 if successful, 0 if the sector could not be read or -1 on error
+ */
+int libsmdev_write_engine_read_partial_sector(
+     libsmdev_write_engine_t *write_engine,
+     libsmdev_write_engine_buffer_t *buffer,
+     size_t data_offset,
+     libcerror_error_t **error )
+{
+	static char *function      = "libsmdev_write_engine_read_partial_sector";
+	size_t copy_end_offset     = 0;
+	size_t copy_start_offset   = 0;
+	size_t sector_end_offset   = 0;
+	ssize_t read_count         = 0;
+	off64_t sector_offset      = 0;
+	uint32_t error_code        = 0;
+	int16_t number_of_attempts = 0;
+
+	if( write_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	sector_end_offset = data_offset + write_engine->bytes_per_sector;
+
+	if( sector_end_offset > ( buffer->data_size + buffer->tail_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sector_offset = buffer->offset + (off64_t) data_offset;
+
+	for( number_of_attempts = 0;
+	     number_of_attempts <= (int16_t) write_engine->number_of_error_retries;
+	     number_of_attempts++ )
+	{
+		read_count = libsmdev_io_backend_read_buffer_at_offset(
+		              write_engine->io_backend,
+		              write_engine->sector_data,
+		              write_engine->bytes_per_sector,
+		              sector_offset,
+		              &error_code,
+		              error );
+
+		if( read_count >= 0 )
+		{
+			break;
+		}
+		if( libsmdev_write_engine_error_code_is_recoverable(
+		     error_code ) == 0 )
+		{
+			write_engine->write_failed     = 1;
+			write_engine->write_error_code = error_code;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sector at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 sector_offset,
+			 sector_offset );
+
+			return( -1 );
+		}
+		libcerror_error_free(
+		 error );
+	}
+	if( read_count < 0 )
+	{
+		return( 0 );
+	}
+	/* Data beyond the end of the device or file reads as zero
+	 */
+	if( (size_t) read_count < write_engine->bytes_per_sector )
+	{
+		if( memory_set(
+		     &( write_engine->sector_data[ read_count ] ),
+		     0,
+		     write_engine->bytes_per_sector - (size_t) read_count ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear sector data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Copy the head of the buffer that is part of the sector
+	 */
+	if( data_offset < buffer->head_size )
+	{
+		copy_start_offset = data_offset;
+		copy_end_offset   = buffer->head_size;
+
+		if( copy_end_offset > sector_end_offset )
+		{
+			copy_end_offset = sector_end_offset;
+		}
+		if( memory_copy(
+		     &( buffer->data[ copy_start_offset ] ),
+		     &( write_engine->sector_data[ copy_start_offset - data_offset ] ),
+		     copy_end_offset - copy_start_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy head data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Copy the tail of the buffer that is part of the sector
+	 */
+	if( ( buffer->tail_size > 0 )
+	 && ( sector_end_offset > buffer->data_size ) )
+	{
+		copy_start_offset = buffer->data_size;
+
+		if( copy_start_offset < data_offset )
+		{
+			copy_start_offset = data_offset;
+		}
+		copy_end_offset = buffer->data_size + buffer->tail_size;
+
+		if( memory_copy(
+		     &( buffer->data[ copy_start_offset ] ),
+		     &( write_engine->sector_data[ copy_start_offset - data_offset ] ),
+		     copy_end_offset - copy_start_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy tail data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Writes out a buffer
+ * Partial sectors at the start and end of the buffer are completed by read-modify-write,
+ * a partial sector that cannot be read is not written and added to the errors range list
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_write_engine_write_out_buffer(
+     libsmdev_write_engine_t *write_engine,
+     libsmdev_write_engine_buffer_t *buffer,
+     libcerror_error_t **error )
+{
+	static char *function     = "libsmdev_write_engine_write_out_buffer";
+	size_t aligned_size       = 0;
+	size_t last_sector_offset = 0;
+	size_t write_offset       = 0;
+	size_t write_size         = 0;
+	int result                = 0;
+
+	if( write_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_size = buffer->data_size + buffer->tail_size;
+	write_size   = aligned_size;
+
+	if( buffer->head_size > 0 )
+	{
+		result = libsmdev_write_engine_read_partial_sector(
+		          write_engine,
+		          buffer,
+		          0,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read first sector.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( libcdata_range_list_insert_range(
+			     write_engine->errors_range_list,
+			     (uint64_t) buffer->offset,
+			     (uint64_t) write_engine->bytes_per_sector,
+			     NULL,
+			     NULL,
+			     NULL,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert write error to range list.",
+				 function );
+
+				return( -1 );
+			}
+			write_offset = write_engine->bytes_per_sector;
+			write_size  -= write_engine->bytes_per_sector;
+		}
+	}
+	last_sector_offset = aligned_size - write_engine->bytes_per_sector;
+
+	/* The last sector was already read if the buffer consists of a single sector with a head
+	 */
+	if( ( buffer->tail_size > 0 )
+	 && ( write_size > 0 )
+	 && ( ( last_sector_offset != 0 )
+	  ||  ( buffer->head_size == 0 ) ) )
+	{
+		result = libsmdev_write_engine_read_partial_sector(
+		          write_engine,
+		          buffer,
+		          last_sector_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read last sector.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( libcdata_range_list_insert_range(
+			     write_engine->errors_range_list,
+			     (uint64_t) ( buffer->offset + (off64_t) last_sector_offset ),
+			     (uint64_t) write_engine->bytes_per_sector,
+			     NULL,
+			     NULL,
+			     NULL,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert write error to range list.",
+				 function );
+
+				return( -1 );
+			}
+			write_size -= write_engine->bytes_per_sector;
+		}
+	}
+	if( write_size > 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: writing buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd ".\n",
+			 function,
+			 buffer->offset + (off64_t) write_offset,
+			 buffer->offset + (off64_t) write_offset,
+			 write_size );
+		}
+#endif
+		if( libsmdev_write_engine_write_data(
+		     write_engine,
+		     &( buffer->data[ write_offset ] ),
+		     write_size,
+		     buffer->offset + (off64_t) write_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 buffer->offset + (off64_t) write_offset,
+			 buffer->offset + (off64_t) write_offset );
+
+			return( -1 );
+		}
+		write_engine->unflushed_size += (size64_t) write_size;
+	}
+	if( ( write_engine->flush_policy == LIBSMDEV_WRITE_FLUSH_POLICY_INTERVAL )
+	 && ( write_engine->unflushed_size >= write_engine->flush_interval ) )
+	{
+		if( write_engine->flush_device != NULL )
+		{
+			if( write_engine->flush_device(
+			     write_engine->flush_context,
+			     error ) != 1 )
+			{
+				write_engine->write_failed = 1;
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush device.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		write_engine->unflushed_size = 0;
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The writer thread callback
+ * Writes the buffers filled by the caller until a buffer without data is received
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_write_engine_writer_callback(
+     libsmdev_write_engine_t *write_engine )
+{
+	libcerror_error_t *error               = NULL;
+	libsmdev_write_engine_buffer_t *buffer = NULL;
+	static char *function                  = "libsmdev_write_engine_writer_callback";
+	size_t data_size                       = 0;
+
+	if( write_engine == NULL )
+	{
+		return( -1 );
+	}
+	do
+	{
+		buffer = NULL;
+
+		if( libcthreads_queue_pop(
+		     write_engine->full_buffers_queue,
+		     (intptr_t **) &buffer,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to pop buffer from full buffers queue.",
+			 function );
+
+			goto on_error;
+		}
+		data_size = buffer->data_size;
+
+		/* Once writing failed the remaining buffers are only handed back to the caller
+		 */
+		if( ( data_size > 0 )
+		 && ( write_engine->write_failed == 0 ) )
+		{
+			if( libsmdev_write_engine_write_out_buffer(
+			     write_engine,
+			     buffer,
+			     &error ) != 1 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_print_error_backtrace(
+					 error );
+				}
+#endif
+				libcerror_error_free(
+				 &error );
+
+				write_engine->write_failed = 1;
+			}
+		}
+		buffer->head_size = 0;
+		buffer->data_size = 0;
+		buffer->tail_size = 0;
+
+		if( libcthreads_queue_push(
+		     write_engine->empty_buffers_queue,
+		     (intptr_t *) buffer,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push buffer onto empty buffers queue.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( data_size > 0 );
+
+	return( 1 );
+
+on_error:
+	write_engine->write_failed = 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Submits the current buffer to be written
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_write_engine_submit_buffer(
+     libsmdev_write_engine_t *write_engine,
+     libcerror_error_t **error )
+{
+	libsmdev_write_engine_buffer_t *buffer = NULL;
+	static char *function                  = "libsmdev_write_engine_submit_buffer";
+	size_t sector_remainder                = 0;
+	int result                             = 1;
+
+	if( write_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write engine.",
+		 function );
+
+		return( -1 );
+	}
+	buffer = write_engine->current_buffer;
+
+	if( ( buffer == NULL )
+	 || ( buffer->data_size == 0 ) )
+	{
+		return( 1 );
+	}
+	sector_remainder = buffer->data_size % write_engine->bytes_per_sector;
+
+	if( sector_remainder != 0 )
+	{
+		buffer->tail_size = write_engine->bytes_per_sector - sector_remainder;
+
+		/* A partial sector at the end of the media is written as is
+		 */
+		if( ( write_engine->media_size != 0 )
+		 && ( (size64_t) ( buffer->offset + (off64_t) buffer->data_size + (off64_t) buffer->tail_size ) > write_engine->media_size ) )
+		{
+			buffer->tail_size = 0;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( write_engine->writer_thread != NULL )
+	{
+		if( libcthreads_queue_push(
+		     write_engine->full_buffers_queue,
+		     (intptr_t *) buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push buffer onto full buffers queue.",
+			 function );
+
+			return( -1 );
+		}
+		write_engine->current_buffer = NULL;
+
+		return( 1 );
+	}
+#endif
+	if( write_engine->write_failed == 0 )
+	{
+		result = libsmdev_write_engine_write_out_buffer(
+		          write_engine,
+		          buffer,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write out buffer.",
+			 function );
+
+			write_engine->write_failed = 1;
+		}
+	}
+	buffer->head_size = 0;
+	buffer->data_size = 0;
+	buffer->tail_size = 0;
+
+	return( result );
+}
+
+/* Writes a buffer at a specific offset
+ * The data is copied into the write buffers, contiguous writes are coalesced
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libsmdev_write_engine_write_buffer(
+         libsmdev_write_engine_t *write_engine,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libsmdev_write_engine_buffer_t *current_buffer = NULL;
+	static char *function                          = "libsmdev_write_engine_write_buffer";
+	size_t buffer_offset                           = 0;
+	size_t copy_size                               = 0;
+	off64_t write_offset                           = 0;
+
+	if( write_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_engine->write_failed != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 write_engine->write_error_code,
+		 "%s: unable to write to device file.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < buffer_size )
+	{
+		write_offset   = offset + (off64_t) buffer_offset;
+		current_buffer = write_engine->current_buffer;
+
+		/* Data that is not contiguous with the current buffer is written to a new buffer
+		 */
+		if( ( current_buffer != NULL )
+		 && ( current_buffer->data_size > 0 )
+		 && ( ( current_buffer->offset + (off64_t) current_buffer->data_size ) != write_offset ) )
+		{
+			if( libsmdev_write_engine_submit_buffer(
+			     write_engine,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to submit buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( write_engine->current_buffer == NULL )
+		{
+			if( libcthreads_queue_pop(
+			     write_engine->empty_buffers_queue,
+			     (intptr_t **) &( write_engine->current_buffer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to pop buffer from empty buffers queue.",
+				 function );
+
+				return( -1 );
+			}
+		}
+#endif
+		current_buffer = write_engine->current_buffer;
+
+		if( current_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid write engine - missing current buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( current_buffer->data_size == 0 )
+		{
+			current_buffer->head_size = (size_t) ( write_offset % (off64_t) write_engine->bytes_per_sector );
+			current_buffer->offset    = write_offset - (off64_t) current_buffer->head_size;
+			current_buffer->data_size = current_buffer->head_size;
+		}
+		copy_size = current_buffer->allocated_size - current_buffer->data_size;
+
+		if( copy_size > ( buffer_size - buffer_offset ) )
+		{
+			copy_size = buffer_size - buffer_offset;
+		}
+		if( memory_copy(
+		     &( current_buffer->data[ current_buffer->data_size ] ),
+		     &( buffer[ buffer_offset ] ),
+		     copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		current_buffer->data_size += copy_size;
+		buffer_offset             += copy_size;
+
+		if( current_buffer->data_size == current_buffer->allocated_size )
+		{
+			if( libsmdev_write_engine_submit_buffer(
+			     write_engine,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to submit buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Writes all buffered data and waits for the writer to complete
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_write_engine_drain(
+     libsmdev_write_engine_t *write_engine,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libsmdev_write_engine_buffer_t *buffers[ LIBSMDEV_WRITE_ENGINE_MAXIMUM_NUMBER_OF_BUFFERS ];
+
+	int buffer_index                       = 0;
+	int number_of_buffers                  = 0;
+	int number_of_popped_buffers           = 0;
+	int result                             = 1;
+#endif
+	static char *function                  = "libsmdev_write_engine_drain";
+
+	if( write_engine == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_write_engine_submit_buffer(
+	     write_engine,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to submit buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( write_engine->writer_thread != NULL )
+	{
+		/* The writer is done when all the buffers not held by the caller are empty
+		 */
+		number_of_buffers = write_engine->number_of_buffers;
+
+		if( write_engine->current_buffer != NULL )
+		{
+			number_of_buffers--;
+		}
+		for( buffer_index = 0;
+		     buffer_index < number_of_buffers;
+		     buffer_index++ )
+		{
+			if( libcthreads_queue_pop(
+			     write_engine->empty_buffers_queue,
+			     (intptr_t **) &( buffers[ buffer_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to pop buffer from empty buffers queue.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			number_of_popped_buffers++;
+		}
+		for( buffer_index = 0;
+		     buffer_index < number_of_popped_buffers;
+		     buffer_index++ )
+		{
+			if( libcthreads_queue_push(
+			     write_engine->empty_buffers_queue,
+			     (intptr_t *) buffers[ buffer_index ],
+			     ( result == 1 ) ? error : NULL ) != 1 )
+			{
+				if( result == 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to push buffer onto empty buffers queue.",
+					 function );
+				}
+				libsmdev_write_engine_buffer_free(
+				 &( buffers[ buffer_index ] ),
+				 NULL );
+
+				result = -1;
+			}
+		}
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( write_engine->write_failed != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 write_engine->write_error_code,
+		 "%s: unable to write to device file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes all buffered data and flushes the device
+ * Returns 1 if successful or -1 on error
+ */
+int libsmdev_write_engine_flush(
+     libsmdev_write_engine_t *write_engine,
+     libcerror_error_t **error )
+{
+	static char *function = "libsmdev_write_engine_flush";
+
+	if( libsmdev_write_engine_drain(
+	     write_engine,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to drain write engine.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_engine->flush_device != NULL )
+	{
+		if( write_engine->flush_device(
+		     write_engine->flush_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush device.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	write_engine->unflushed_size = 0;
+
+	return( 1 );
+}
+
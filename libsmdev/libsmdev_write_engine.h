@@ -0,0 +1,295 @@
+/*
+ * Write engine functions
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBSMDEV_WRITE_ENGINE_H )
+#define _LIBSMDEV_WRITE_ENGINE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libsmdev_io_backend.h"
+#include "libsmdev_libcdata.h"
+#include "libsmdev_libcerror.h"
+#include "libsmdev_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a write buffer
+ */
+#define LIBSMDEV_WRITE_ENGINE_BUFFER_SIZE			1048576
+
+/* The maximum number of write buffers
+ */
+#define LIBSMDEV_WRITE_ENGINE_MAXIMUM_NUMBER_OF_BUFFERS		64
+
+/* The maximum sector size for which unaligned writes are coalesced
+ */
+#define LIBSMDEV_WRITE_ENGINE_MAXIMUM_SECTOR_SIZE		65536
+
+/* The size of the blocks that are checked for only containing zero bytes
+ */
+#define LIBSMDEV_WRITE_ENGINE_ZERO_BLOCK_SIZE			65536
+
+typedef struct libsmdev_write_engine_buffer libsmdev_write_engine_buffer_t;
+
+struct libsmdev_write_engine_buffer
+{
+	/* The sector aligned offset of the data
+	 */
+	off64_t offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The allocated data size
+	 */
+	size_t allocated_size;
+
+	/* The size of the data at the start of the first sector that was not written by the caller
+	 */
+	size_t head_size;
+
+	/* The size of the data including the head
+	 * A data size of 0 signals the writer that no more data follows
+	 */
+	size_t data_size;
+
+	/* The size of the data at the end of the last sector that was not written by the caller
+	 */
+	size_t tail_size;
+};
+
+typedef struct libsmdev_write_engine libsmdev_write_engine_t;
+
+struct libsmdev_write_engine
+{
+	/* The IO backend
+	 */
+	libsmdev_io_backend_t *io_backend;
+
+	/* The number of bytes per sector
+	 */
+	size_t bytes_per_sector;
+
+	/* The media size
+	 */
+	size64_t media_size;
+
+	/* The number of buffers
+	 */
+	int number_of_buffers;
+
+	/* The number of write error retries
+	 */
+	uint8_t number_of_error_retries;
+
+	/* The error granularity
+	 */
+	size_t error_granularity;
+
+	/* The read/write errors range list
+	 */
+	libcdata_range_list_t *errors_range_list;
+
+	/* The flush policy
+	 */
+	int flush_policy;
+
+	/* The flush interval
+	 */
+	size64_t flush_interval;
+
+	/* The size of the data written since the last flush
+	 */
+	size64_t unflushed_size;
+
+	/* The flush device function
+	 */
+	int (*flush_device)(
+	       intptr_t *flush_context,
+	       libcerror_error_t **error );
+
+	/* The flush device function context
+	 */
+	intptr_t *flush_context;
+
+	/* The write zeroes function
+	 */
+	int (*write_zeroes)(
+	       intptr_t *write_zeroes_context,
+	       off64_t offset,
+	       size64_t size,
+	       libcerror_error_t **error );
+
+	/* The write zeroes function context
+	 */
+	intptr_t *write_zeroes_context;
+
+	/* The buffer that is filled by the caller
+	 */
+	libsmdev_write_engine_buffer_t *current_buffer;
+
+	/* The sector data used to read-modify-write partial sectors
+	 */
+	uint8_t *sector_data;
+
+	/* Value to indicate writing failed and cannot be continued
+	 */
+	uint8_t write_failed;
+
+	/* The error code of the write that failed
+	 */
+	uint32_t write_error_code;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The writer thread
+	 */
+	libcthreads_thread_t *writer_thread;
+
+	/* The queue of buffers that can be filled by the caller
+	 */
+	libcthreads_queue_t *empty_buffers_queue;
+
+	/* The queue of buffers that are to be written by the writer thread
+	 */
+	libcthreads_queue_t *full_buffers_queue;
+#endif
+};
+
+int libsmdev_write_engine_buffer_initialize(
+     libsmdev_write_engine_buffer_t **buffer,
+     size_t allocated_size,
+     libcerror_error_t **error );
+
+int libsmdev_write_engine_buffer_free(
+     libsmdev_write_engine_buffer_t **buffer,
+     libcerror_error_t **error );
+
+int libsmdev_write_engine_initialize(
+     libsmdev_write_engine_t **write_engine,
+     libsmdev_io_backend_t *io_backend,
+     size_t bytes_per_sector,
+     size64_t media_size,
+     int number_of_buffers,
+     uint8_t number_of_error_retries,
+     size_t error_granularity,
+     libcdata_range_list_t *errors_range_list,
+     libcerror_error_t **error );
+
+int libsmdev_write_engine_free(
+     libsmdev_write_engine_t **write_engine,
+     libcerror_error_t **error );
+
+int libsmdev_write_engine_set_flush_policy(
+     libsmdev_write_engine_t *write_engine,
+     int flush_policy,
+     size64_t flush_interval,
+     int (*flush_device)(
+            intptr_t *flush_context,
+            libcerror_error_t **error ),
+     intptr_t *flush_context,
+     libcerror_error_t **error );
+
+int libsmdev_write_engine_set_write_zeroes(
+     libsmdev_write_engine_t *write_engine,
+     int (*write_zeroes)(
+            intptr_t *write_zeroes_context,
+            off64_t offset,
+            size64_t size,
+            libcerror_error_t **error ),
+     intptr_t *write_zeroes_context,
+     libcerror_error_t **error );
+
+int libsmdev_write_engine_error_code_is_recoverable(
+     uint32_t error_code );
+
+ssize_t libsmdev_write_engine_write_at_offset(
+         libsmdev_write_engine_t *write_engine,
+         const uint8_t *data,
+         size_t data_size,
+         off64_t offset,
+         uint32_t *error_code,
+         libcerror_error_t **error );
+
+int libsmdev_write_engine_write_range(
+     libsmdev_write_engine_t *write_engine,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libsmdev_write_engine_data_is_zero(
+     const uint8_t *data,
+     size_t data_size );
+
+int libsmdev_write_engine_write_data(
+     libsmdev_write_engine_t *write_engine,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libsmdev_write_engine_read_partial_sector(
+     libsmdev_write_engine_t *write_engine,
+     libsmdev_write_engine_buffer_t *buffer,
+     size_t data_offset,
+     libcerror_error_t **error );
+
+int libsmdev_write_engine_write_out_buffer(
+     libsmdev_write_engine_t *write_engine,
+     libsmdev_write_engine_buffer_t *buffer,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libsmdev_write_engine_writer_callback(
+     libsmdev_write_engine_t *write_engine );
+
+#endif
+
+int libsmdev_write_engine_submit_buffer(
+     libsmdev_write_engine_t *write_engine,
+     libcerror_error_t **error );
+
+ssize_t libsmdev_write_engine_write_buffer(
+         libsmdev_write_engine_t *write_engine,
+         const uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int libsmdev_write_engine_drain(
+     libsmdev_write_engine_t *write_engine,
+     libcerror_error_t **error );
+
+int libsmdev_write_engine_flush(
+     libsmdev_write_engine_t *write_engine,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBSMDEV_WRITE_ENGINE_H ) */
+
@@ -103,6 +103,53 @@ PyMethodDef pysmdev_handle_object_methods[] = {
 	  "\n"
 	  "Retrieves the current offset within the media data." },
 
+	/* Functions to sample the media data */
+
+	{ "sample",
+	  (PyCFunction) pysmdev_handle_sample,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "sample(number_of_samples, sample_size, number_of_regions, sampling_method=2) -> Boolean\n"
+	  "\n"
+	  "Samples the media data and determines per-region statistics.\n"
+	  "The sampling method is 1 for random or 2 for stratified positions.\n"
+	  "Returns False if sampling was aborted." },
+
+	{ "get_number_of_sample_regions",
+	  (PyCFunction) pysmdev_handle_get_number_of_sample_regions,
+	  METH_NOARGS,
+	  "get_number_of_sample_regions() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of sample regions." },
+
+	{ "get_sample_region",
+	  (PyCFunction) pysmdev_handle_get_sample_region,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_sample_region(region_index) -> Tuple\n"
+	  "\n"
+	  "Retrieves a specific sample region as a tuple of the offset, size, number of samples,\n"
+	  "number of unreadable samples, zero fraction, high entropy fraction and entropy." },
+
+	{ "get_partition_table_type",
+	  (PyCFunction) pysmdev_handle_get_partition_table_type,
+	  METH_NOARGS,
+	  "get_partition_table_type() -> Unicode string or None\n"
+	  "\n"
+	  "Retrieves the partition table type determined by sampling." },
+
+	{ "get_number_of_partitions",
+	  (PyCFunction) pysmdev_handle_get_number_of_partitions,
+	  METH_NOARGS,
+	  "get_number_of_partitions() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of partitions determined by sampling." },
+
+	{ "get_partition",
+	  (PyCFunction) pysmdev_handle_get_partition,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_partition(partition_index) -> Tuple\n"
+	  "\n"
+	  "Retrieves a specific partition as a tuple of the offset and size." },
+
 	/* Some Pythonesque aliases */
 
 	{ "read",
@@ -1298,3 +1345,385 @@ PyObject *pysmdev_handle_get_offset(
 	return( integer_object );
 }
 
+/* Samples the media data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysmdev_handle_sample(
+           pysmdev_handle_t *pysmdev_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pysmdev_handle_sample";
+	static char *keyword_list[] = { "number_of_samples", "sample_size", "number_of_regions", "sampling_method", NULL };
+	size_t sample_size          = 0;
+	int number_of_regions       = 0;
+	int number_of_samples       = 0;
+	int result                  = 0;
+	int sampling_method         = LIBSMDEV_SAMPLING_METHOD_STRATIFIED;
+
+	if( pysmdev_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid pysmdev handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "ini|i",
+	     keyword_list,
+	     &number_of_samples,
+	     &sample_size,
+	     &number_of_regions,
+	     &sampling_method ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libsmdev_handle_sample(
+	          pysmdev_handle->handle,
+	          sampling_method,
+	          number_of_samples,
+	          sample_size,
+	          number_of_regions,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pysmdev_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to sample media data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( PyBool_FromLong(
+	         (long) result ) );
+}
+
+/* Retrieves the number of sample regions
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysmdev_handle_get_number_of_sample_regions(
+           pysmdev_handle_t *pysmdev_handle,
+           PyObject *arguments PYSMDEV_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pysmdev_handle_get_number_of_sample_regions";
+	int number_of_regions    = 0;
+	int result               = 0;
+
+	PYSMDEV_UNREFERENCED_PARAMETER( arguments )
+
+	if( pysmdev_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libsmdev_handle_get_number_of_sample_regions(
+	          pysmdev_handle->handle,
+	          &number_of_regions,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pysmdev_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of sample regions.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( pysmdev_integer_signed_new_from_64bit(
+	         (int64_t) number_of_regions ) );
+}
+
+/* Retrieves a specific sample region
+ * Returns a Python object holding a tuple of the offset, size, number of samples, number of unreadable samples,
+ * zero fraction, high entropy fraction and entropy if successful or NULL on error
+ */
+PyObject *pysmdev_handle_get_sample_region(
+           pysmdev_handle_t *pysmdev_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error              = NULL;
+	static char *function                 = "pysmdev_handle_get_sample_region";
+	static char *keyword_list[]           = { "region_index", NULL };
+	off64_t region_offset                 = 0;
+	size64_t region_size                  = 0;
+	double entropy                        = 0.0;
+	double high_entropy_fraction          = 0.0;
+	double zero_fraction                  = 0.0;
+	uint64_t number_of_samples            = 0;
+	uint64_t number_of_unreadable_samples = 0;
+	int region_index                      = 0;
+	int result                            = 0;
+
+	if( pysmdev_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &region_index ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libsmdev_handle_get_sample_region(
+	          pysmdev_handle->handle,
+	          region_index,
+	          &region_offset,
+	          &region_size,
+	          &number_of_samples,
+	          &number_of_unreadable_samples,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = libsmdev_handle_get_sample_region_statistics(
+		          pysmdev_handle->handle,
+		          region_index,
+		          &zero_fraction,
+		          &high_entropy_fraction,
+		          &entropy,
+		          &error );
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pysmdev_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve sample region: %d.",
+		 function,
+		 region_index );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( Py_BuildValue(
+	         "LKKKddd",
+	         (long long) region_offset,
+	         (unsigned long long) region_size,
+	         (unsigned long long) number_of_samples,
+	         (unsigned long long) number_of_unreadable_samples,
+	         zero_fraction,
+	         high_entropy_fraction,
+	         entropy ) );
+}
+
+/* Retrieves the partition table type
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysmdev_handle_get_partition_table_type(
+           pysmdev_handle_t *pysmdev_handle,
+           PyObject *arguments PYSMDEV_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error     = NULL;
+	static char *function        = "pysmdev_handle_get_partition_table_type";
+	uint8_t partition_table_type = 0;
+	int result                   = 0;
+
+	PYSMDEV_UNREFERENCED_PARAMETER( arguments )
+
+	if( pysmdev_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libsmdev_handle_get_partition_table_type(
+	          pysmdev_handle->handle,
+	          &partition_table_type,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pysmdev_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve partition table type.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	switch( partition_table_type )
+	{
+		case LIBSMDEV_PARTITION_TABLE_TYPE_MBR:
+			return( PyUnicode_FromString(
+			         "mbr" ) );
+
+		case LIBSMDEV_PARTITION_TABLE_TYPE_GPT:
+			return( PyUnicode_FromString(
+			         "gpt" ) );
+
+		default:
+			break;
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Retrieves the number of partitions
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pysmdev_handle_get_number_of_partitions(
+           pysmdev_handle_t *pysmdev_handle,
+           PyObject *arguments PYSMDEV_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pysmdev_handle_get_number_of_partitions";
+	int number_of_partitions = 0;
+	int result               = 0;
+
+	PYSMDEV_UNREFERENCED_PARAMETER( arguments )
+
+	if( pysmdev_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libsmdev_handle_get_number_of_partitions(
+	          pysmdev_handle->handle,
+	          &number_of_partitions,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pysmdev_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( pysmdev_integer_signed_new_from_64bit(
+	         (int64_t) number_of_partitions ) );
+}
+
+/* Retrieves a specific partition
+ * Returns a Python object holding a tuple of the offset and size if successful or NULL on error
+ */
+PyObject *pysmdev_handle_get_partition(
+           pysmdev_handle_t *pysmdev_handle,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pysmdev_handle_get_partition";
+	static char *keyword_list[] = { "partition_index", NULL };
+	off64_t partition_offset    = 0;
+	size64_t partition_size     = 0;
+	int partition_index         = 0;
+	int result                  = 0;
+
+	if( pysmdev_handle == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid handle.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &partition_index ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libsmdev_handle_get_partition(
+	          pysmdev_handle->handle,
+	          partition_index,
+	          &partition_offset,
+	          &partition_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pysmdev_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve partition: %d.",
+		 function,
+		 partition_index );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	return( Py_BuildValue(
+	         "LK",
+	         (long long) partition_offset,
+	         (unsigned long long) partition_size ) );
+}
+
@@ -105,6 +105,33 @@ PyObject *pysmdev_handle_get_offset(
            pysmdev_handle_t *pysmdev_handle,
            PyObject *arguments );
 
+PyObject *pysmdev_handle_sample(
+           pysmdev_handle_t *pysmdev_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pysmdev_handle_get_number_of_sample_regions(
+           pysmdev_handle_t *pysmdev_handle,
+           PyObject *arguments );
+
+PyObject *pysmdev_handle_get_sample_region(
+           pysmdev_handle_t *pysmdev_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pysmdev_handle_get_partition_table_type(
+           pysmdev_handle_t *pysmdev_handle,
+           PyObject *arguments );
+
+PyObject *pysmdev_handle_get_number_of_partitions(
+           pysmdev_handle_t *pysmdev_handle,
+           PyObject *arguments );
+
+PyObject *pysmdev_handle_get_partition(
+           pysmdev_handle_t *pysmdev_handle,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -25,10 +25,26 @@
 #include <system_string.h>
 #include <types.h>
 
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
 #if defined( HAVE_SYS_UTSNAME_H )
 #include <sys/utsname.h>
 #endif
 
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "byte_size_string.h"
 #include "info_handle.h"
 #include "smdevtools_libcerror.h"
@@ -82,6 +98,38 @@ const char *info_handle_get_track_type(
 	return( "UNKNOWN" );
 }
 
+/* Retrieves the USB link speed
+ * Returns a string represenation of the USB link speed
+ */
+const char *info_handle_get_usb_link_speed(
+             uint8_t link_speed )
+{
+	switch( link_speed )
+	{
+		case LIBSMDEV_USB_LINK_SPEED_LOW:
+			return( "USB 1.0 low speed (1.5 Mbit/s)" );
+
+		case LIBSMDEV_USB_LINK_SPEED_FULL:
+			return( "USB 1.1 full speed (12 Mbit/s)" );
+
+		case LIBSMDEV_USB_LINK_SPEED_HIGH:
+			return( "USB 2.0 high speed (480 Mbit/s)" );
+
+		case LIBSMDEV_USB_LINK_SPEED_SUPER:
+			return( "USB 3.0 SuperSpeed (5 Gbit/s)" );
+
+		case LIBSMDEV_USB_LINK_SPEED_SUPER_PLUS:
+			return( "USB 3.1 SuperSpeed+ (10 Gbit/s)" );
+
+		case LIBSMDEV_USB_LINK_SPEED_SUPER_PLUS_2X2:
+			return( "USB 3.2 SuperSpeed+ 2x2 (20 Gbit/s)" );
+
+		default:
+			break;
+	}
+	return( "UNKNOWN" );
+}
+
 /* Creates an info handle
  * Make sure the value info_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -604,12 +652,19 @@ int info_handle_handle_fprint(
 	uint8_t media_information_value[ 64 ];
         system_character_t byte_size_string[ 16 ];
 
-	static char *function     = "info_handle_handle_fprint";
-	size64_t media_size       = 0;
-	uint32_t bytes_per_sector = 0;
-	uint8_t bus_type          = 0;
-	uint8_t media_type        = 0;
-	int result                = 0;
+	static char *function              = "info_handle_handle_fprint";
+	size64_t media_size                = 0;
+	size_t maximum_transfer_size       = 0;
+	uint64_t alignment_offset          = 0;
+	uint32_t bytes_per_sector          = 0;
+	uint32_t physical_bytes_per_sector = 0;
+	uint32_t transfer_length           = 0;
+	uint16_t rotation_rate             = 0;
+	uint8_t bus_type                   = 0;
+	uint8_t media_type                 = 0;
+	uint8_t usb_link_speed             = 0;
+	uint8_t usb_protocol               = 0;
+	int result                         = 0;
 
 	if( info_handle == NULL )
 	{
@@ -692,6 +747,109 @@ int info_handle_handle_fprint(
 	 info_handle->notify_stream,
 	 "\n" );
 
+	if( bus_type == LIBSMDEV_BUS_TYPE_USB )
+	{
+		result = libsmdev_handle_get_usb_link_speed(
+			  info_handle->input_handle,
+			  &usb_link_speed,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve USB link speed.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tUSB link speed\t\t: %s\n",
+			 info_handle_get_usb_link_speed(
+			  usb_link_speed ) );
+		}
+		result = libsmdev_handle_get_usb_protocol(
+			  info_handle->input_handle,
+			  &usb_protocol,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve USB protocol.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tUSB protocol\t\t: " );
+
+			switch( usb_protocol )
+			{
+				case LIBSMDEV_USB_PROTOCOL_BULK_ONLY:
+					fprintf(
+					 info_handle->notify_stream,
+					 "Bulk-Only Transport (BOT)" );
+					break;
+
+				case LIBSMDEV_USB_PROTOCOL_UAS:
+					fprintf(
+					 info_handle->notify_stream,
+					 "USB Attached SCSI (UAS)" );
+					break;
+
+				default:
+					fprintf(
+					 info_handle->notify_stream,
+					 "Unknown" );
+					break;
+			}
+			fprintf(
+			 info_handle->notify_stream,
+			 "\n" );
+		}
+		result = libsmdev_handle_get_usb_maximum_transfer_size(
+			  info_handle->input_handle,
+			  &maximum_transfer_size,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve USB maximum transfer size.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tmaximum transfer size\t: %" PRIzd " bytes\n",
+			 maximum_transfer_size );
+		}
+		if( ( usb_link_speed >= LIBSMDEV_USB_LINK_SPEED_LOW )
+		 && ( usb_link_speed <= LIBSMDEV_USB_LINK_SPEED_HIGH ) )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tWARNING: the device is attached at USB 2.0 speed or slower.\n" );
+		}
+	}
 	result = libsmdev_handle_get_utf8_information_value(
 		  info_handle->input_handle,
 		  (uint8_t *) "vendor",
@@ -902,6 +1060,132 @@ int info_handle_handle_fprint(
 		 "\tbytes per sector\t: %" PRIu32 "\n",
 		 bytes_per_sector );
 	}
+	result = libsmdev_handle_get_physical_bytes_per_sector(
+	          info_handle->input_handle,
+	          &physical_bytes_per_sector,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tphysical sector size\t: %" PRIu32 " bytes\n",
+		 physical_bytes_per_sector );
+
+		result = libsmdev_handle_get_alignment_offset(
+		          info_handle->input_handle,
+		          &alignment_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve alignment offset.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( result != 0 )
+		      && ( alignment_offset != 0 ) )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\talignment offset\t: %" PRIu64 " bytes\n",
+			 alignment_offset );
+		}
+	}
+	result = libsmdev_handle_get_maximum_transfer_length(
+	          info_handle->input_handle,
+	          &transfer_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum transfer length.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tmaximum transfer length\t: %" PRIu32 " sectors\n",
+		 transfer_length );
+	}
+	result = libsmdev_handle_get_optimal_transfer_length(
+	          info_handle->input_handle,
+	          &transfer_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve optimal transfer length.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\toptimal transfer length\t: %" PRIu32 " sectors\n",
+		 transfer_length );
+	}
+	result = libsmdev_handle_get_rotation_rate(
+	          info_handle->input_handle,
+	          &rotation_rate,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve rotation rate.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( rotation_rate == 1 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\trotation rate\t\t: Non-rotating\n" );
+		}
+		else
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\trotation rate\t\t: %" PRIu16 " RPM\n",
+			 rotation_rate );
+		}
+	}
 	fprintf(
 	 info_handle->notify_stream,
 	 "\n" );
@@ -935,3 +1219,506 @@ int info_handle_handle_fprint(
 	return( 1 );
 }
 
+/* Verifies the media data against a reference file and prints the mismatches
+ * The reference file is expected to contain a raw image of the media
+ * Returns 1 if the media data matches, 0 if not or -1 on error
+ */
+int info_handle_verify_fprint(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function    = "info_handle_verify_fprint";
+	size64_t media_size      = 0;
+	size64_t mismatch_size   = 0;
+	off64_t mismatch_offset  = 0;
+	int file_descriptor      = -1;
+	int mismatch_index       = 0;
+	int number_of_mismatches = 0;
+	int result               = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_handle_get_media_size(
+	     info_handle->input_handle,
+	     &media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_descriptor = _wopen(
+	                   filename,
+	                   _O_RDONLY | _O_BINARY );
+#else
+	file_descriptor = _open(
+	                   filename,
+	                   _O_RDONLY | _O_BINARY );
+#endif
+#else
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+#endif
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open reference file.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Verification:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\treference file\t\t: %" PRIs_SYSTEM "\n",
+	 filename );
+
+	result = libsmdev_handle_verify_with_file_descriptor(
+	          info_handle->input_handle,
+	          file_descriptor,
+	          0,
+	          media_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to verify media data.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tverification\t\t: aborted\n\n" );
+	}
+	else
+	{
+		if( libsmdev_handle_get_number_of_mismatches(
+		     info_handle->input_handle,
+		     &number_of_mismatches,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of mismatches.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tnumber of mismatches\t: %d\n",
+		 number_of_mismatches );
+
+		for( mismatch_index = 0;
+		     mismatch_index < number_of_mismatches;
+		     mismatch_index++ )
+		{
+			if( libsmdev_handle_get_mismatch(
+			     info_handle->input_handle,
+			     mismatch_index,
+			     &mismatch_offset,
+			     &mismatch_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve mismatch: %d.",
+				 function,
+				 mismatch_index );
+
+				goto on_error;
+			}
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tmismatch\t\t: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIu64 "\n",
+			 mismatch_offset,
+			 mismatch_offset,
+			 mismatch_size );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tverification\t\t: %s\n\n",
+		 ( number_of_mismatches == 0 ) ? "SUCCESS" : "FAILURE" );
+
+		if( number_of_mismatches != 0 )
+		{
+			result = 0;
+		}
+	}
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     file_descriptor ) != 0 )
+#else
+	if( close(
+	     file_descriptor ) != 0 )
+#endif
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close reference file.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	if( file_descriptor != -1 )
+	{
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+		_close(
+		 file_descriptor );
+#else
+		close(
+		 file_descriptor );
+#endif
+	}
+	return( -1 );
+}
+
+/* Samples the media data and prints the per-region statistics and the partition layout
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int info_handle_sample_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function                 = "info_handle_sample_fprint";
+	size64_t media_size                   = 0;
+	size64_t partition_size               = 0;
+	size64_t region_size                  = 0;
+	size_t sample_size                    = INFO_HANDLE_SAMPLE_SIZE;
+	off64_t partition_offset              = 0;
+	off64_t region_offset                 = 0;
+	double entropy                        = 0.0;
+	double high_entropy_fraction          = 0.0;
+	double zero_fraction                  = 0.0;
+	uint64_t number_of_samples            = 0;
+	uint64_t number_of_unreadable_samples = 0;
+	uint32_t bytes_per_sector             = 0;
+	uint8_t partition_table_type          = 0;
+	int number_of_partitions              = 0;
+	int number_of_regions                 = 0;
+	int partition_index                   = 0;
+	int region_index                      = 0;
+	int result                            = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_handle_get_media_size(
+	     info_handle->input_handle,
+	     &media_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve media size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_handle_get_bytes_per_sector(
+	     info_handle->input_handle,
+	     &bytes_per_sector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Sampling:\n" );
+
+	/* Small media are sampled a sector at a time
+	 */
+	if( ( bytes_per_sector != 0 )
+	 && ( ( media_size < (size64_t) sample_size )
+	  || ( ( sample_size % bytes_per_sector ) != 0 ) ) )
+	{
+		sample_size = (size_t) bytes_per_sector;
+	}
+	if( media_size < (size64_t) sample_size )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tsampling\t\t: media too small\n\n" );
+
+		return( 1 );
+	}
+	result = libsmdev_handle_sample(
+	          info_handle->input_handle,
+	          LIBSMDEV_SAMPLING_METHOD_STRATIFIED,
+	          INFO_HANDLE_SAMPLE_NUMBER_OF_SAMPLES,
+	          sample_size,
+	          INFO_HANDLE_SAMPLE_NUMBER_OF_REGIONS,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sample media data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tsampling\t\t: aborted\n\n" );
+
+		return( 0 );
+	}
+	if( libsmdev_handle_get_partition_table_type(
+	     info_handle->input_handle,
+	     &partition_table_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve partition table type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libsmdev_handle_get_number_of_partitions(
+	     info_handle->input_handle,
+	     &number_of_partitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of partitions.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tsample size\t\t: %" PRIzd " bytes\n",
+	 sample_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tpartition table\t\t: " );
+
+	switch( partition_table_type )
+	{
+		case LIBSMDEV_PARTITION_TABLE_TYPE_MBR:
+			fprintf(
+			 info_handle->notify_stream,
+			 "MBR\n" );
+			break;
+
+		case LIBSMDEV_PARTITION_TABLE_TYPE_GPT:
+			fprintf(
+			 info_handle->notify_stream,
+			 "GPT\n" );
+			break;
+
+		default:
+			fprintf(
+			 info_handle->notify_stream,
+			 "none\n" );
+			break;
+	}
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		if( libsmdev_handle_get_partition(
+		     info_handle->input_handle,
+		     partition_index,
+		     &partition_offset,
+		     &partition_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve partition: %d.",
+			 function,
+			 partition_index );
+
+			return( -1 );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tpartition: %d\t\t: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIu64 "\n",
+		 partition_index + 1,
+		 partition_offset,
+		 partition_offset,
+		 partition_size );
+	}
+	if( libsmdev_handle_get_number_of_sample_regions(
+	     info_handle->input_handle,
+	     &number_of_regions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sample regions.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	for( region_index = 0;
+	     region_index < number_of_regions;
+	     region_index++ )
+	{
+		if( libsmdev_handle_get_sample_region(
+		     info_handle->input_handle,
+		     region_index,
+		     &region_offset,
+		     &region_size,
+		     &number_of_samples,
+		     &number_of_unreadable_samples,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sample region: %d.",
+			 function,
+			 region_index );
+
+			return( -1 );
+		}
+		if( libsmdev_handle_get_sample_region_statistics(
+		     info_handle->input_handle,
+		     region_index,
+		     &zero_fraction,
+		     &high_entropy_fraction,
+		     &entropy,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sample region: %d statistics.",
+			 function,
+			 region_index );
+
+			return( -1 );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tregion: %d\t\t: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIu64 "\n",
+		 region_index + 1,
+		 region_offset,
+		 region_offset,
+		 region_size );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tsamples\t\t\t: %" PRIu64 " (unreadable: %" PRIu64 ")\n",
+		 number_of_samples,
+		 number_of_unreadable_samples );
+
+		if( number_of_samples > 0 )
+		{
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tzero sectors\t\t: %.1f%%\n",
+			 zero_fraction * 100.0 );
+
+			fprintf(
+			 info_handle->notify_stream,
+			 "\thigh entropy samples\t: %.1f%%\n",
+			 high_entropy_fraction * 100.0 );
+
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tentropy\t\t\t: %.3f bits per byte\n",
+			 entropy );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+	}
+	return( 1 );
+}
+
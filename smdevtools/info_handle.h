@@ -33,6 +33,12 @@
 extern "C" {
 #endif
 
+/* The sample settings used by info_handle_sample_fprint
+ */
+#define INFO_HANDLE_SAMPLE_NUMBER_OF_SAMPLES	4096
+#define INFO_HANDLE_SAMPLE_NUMBER_OF_REGIONS	16
+#define INFO_HANDLE_SAMPLE_SIZE			65536
+
 typedef struct info_handle info_handle_t;
 
 struct info_handle
@@ -56,6 +62,9 @@ const char *info_handle_get_data_file_type(
 const char *info_handle_get_track_type(
              uint8_t track_type );
 
+const char *info_handle_get_usb_link_speed(
+             uint8_t link_speed );
+
 int info_handle_initialize(
      info_handle_t **info_handle,
      libcerror_error_t **error );
@@ -89,6 +98,15 @@ int info_handle_handle_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_verify_fprint(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int info_handle_sample_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -68,12 +68,16 @@ void usage_fprint(
 	fprintf( stream, "Use smdevinfo to determine information about storage\n"
 	                 "media (SM) device(s)\n\n" );
 
-	fprintf( stream, "Usage: smdevinfo [ -hivV ] source\n\n" );
+	fprintf( stream, "Usage: smdevinfo [ -c reference ] [ -hisvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source device file\n\n" );
 
+	fprintf( stream, "\t-c:     verifies the media data against a reference file that\n"
+	                 "\t        contains a raw image of the media\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
 	fprintf( stream, "\t-i:     ignore data file(s)\n" );
+	fprintf( stream, "\t-s:     samples the media data and prints per-region statistics\n"
+	                 "\t        such as the fraction of zero sectors and the entropy\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
 	fprintf( stream, "\t-V:     print version\n" );
 }
@@ -128,12 +132,15 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
-	libcerror_error_t *error   = NULL;
-	system_character_t *source = NULL;
-	char *program              = "smdevinfo";
-	system_integer_t option    = 0;
-	uint8_t ignore_data_files  = 0;
-	int verbose                = 0;
+	libcerror_error_t *error      = NULL;
+	system_character_t *reference = NULL;
+	system_character_t *source    = NULL;
+	char *program                 = "smdevinfo";
+	system_integer_t option       = 0;
+	uint8_t ignore_data_files     = 0;
+	uint8_t sample_media          = 0;
+	int result                    = 1;
+	int verbose                   = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
 	_setmode( _fileno( stdout ), _O_BINARY );
@@ -173,7 +180,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = smdevtools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "ihvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "c:ihsvV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -189,6 +196,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'c':
+				reference = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
@@ -200,6 +212,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 's':
+				sample_media = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -287,6 +304,39 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( sample_media != 0 )
+	{
+		result = info_handle_sample_fprint(
+		          smdevinfo_info_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to sample media data.\n" );
+
+			goto on_error;
+		}
+	}
+	if( ( result == 1 )
+	 && ( reference != NULL ) )
+	{
+		result = info_handle_verify_fprint(
+		          smdevinfo_info_handle,
+		          reference,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to verify against reference file: %" PRIs_SYSTEM ".\n",
+			 reference );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close(
 	     smdevinfo_info_handle,
 	     &error ) != 0 )
@@ -328,6 +378,10 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
+	if( result != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
 	return( EXIT_SUCCESS );
 
 on_error:
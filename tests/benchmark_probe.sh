@@ -0,0 +1,31 @@
+#!/usr/bin/env bash
+# Optical disc probe benchmark script
+#
+# Probes the table of contents of a replayed 99 track disc and prints
+# the number of commands and the time per probe.
+#
+# Version: 20261018
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+TEST_EXECUTABLE="./smdev_test_io_control";
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	TEST_EXECUTABLE="./smdev_test_io_control.exe";
+fi
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	echo "Missing test executable: ${TEST_EXECUTABLE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+SMDEV_TEST_PROBE_BENCHMARK=1 ${TEST_EXECUTABLE};
+RESULT=$?;
+
+exit ${RESULT};
+
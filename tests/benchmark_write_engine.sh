@@ -0,0 +1,66 @@
+#!/usr/bin/env bash
+# Write engine benchmark script
+#
+# Writes to a loop device using direct writes, coalesced writes and write-behind
+# and prints the throughput of each. Requires root privileges and losetup.
+#
+# Version: 20261018
+
+EXIT_SUCCESS=0;
+EXIT_FAILURE=1;
+EXIT_IGNORE=77;
+
+BENCHMARK_SIZE="256M";
+
+TEST_EXECUTABLE="./smdev_test_write_engine";
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	TEST_EXECUTABLE="./smdev_test_write_engine.exe";
+fi
+
+if ! test -x "${TEST_EXECUTABLE}";
+then
+	echo "Missing test executable: ${TEST_EXECUTABLE}";
+
+	exit ${EXIT_FAILURE};
+fi
+
+if test `id -u` -ne 0;
+then
+	echo "Benchmark requires root privileges";
+
+	exit ${EXIT_IGNORE};
+fi
+
+if ! type losetup > /dev/null 2>&1;
+then
+	echo "Benchmark requires losetup";
+
+	exit ${EXIT_IGNORE};
+fi
+
+BACKING_FILE=`mktemp -t smdev_benchmark.XXXXXX`;
+
+truncate -s ${BENCHMARK_SIZE} ${BACKING_FILE};
+
+LOOP_DEVICE=`losetup --find --show ${BACKING_FILE}`;
+
+if test -z "${LOOP_DEVICE}";
+then
+	echo "Unable to attach loop device";
+
+	rm -f ${BACKING_FILE};
+
+	exit ${EXIT_FAILURE};
+fi
+
+SMDEV_TEST_WRITE_ENGINE_DEVICE="${LOOP_DEVICE}" ${TEST_EXECUTABLE};
+RESULT=$?;
+
+losetup --detach ${LOOP_DEVICE};
+
+rm -f ${BACKING_FILE};
+
+exit ${RESULT};
+
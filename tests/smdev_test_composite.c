@@ -0,0 +1,1673 @@
+/*
+ * Library composite functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_functions.h"
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_composite.h"
+#include "../libsmdev/libsmdev_handle.h"
+#include "../libsmdev/libsmdev_io_backend.h"
+#include "../libsmdev/libsmdev_simulated_device.h"
+
+#define SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS		3
+
+#define SMDEV_TEST_COMPOSITE_STRIPE_SIZE		0x10000
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+/* The paths of the scenario files of the simulated members
+ */
+char smdev_test_composite_scenario_paths[ SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS ][ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The scenarios of the simulated members of the striped composite
+ * The last member is larger than the others and the second member contains a bad range
+ */
+const char *smdev_test_composite_striped_scenarios[ SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS ] = {
+	"size 0x40000\n",
+	"size 0x40000\n"
+	"bad 0x11000 0x1000\n",
+	"size 0x48000\n" };
+
+/* The scenarios of the simulated members of the concatenated composite
+ */
+const char *smdev_test_composite_concatenated_scenarios[ SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS ] = {
+	"size 0x10000\n",
+	"size 0x28000\n",
+	"size 0x8000\n" };
+
+/* Writes the scenario files of the members
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_composite_write_scenarios(
+     const char **scenarios,
+     libcerror_error_t **error )
+{
+	int member_index = 0;
+
+	for( member_index = 0;
+	     member_index < SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS;
+	     member_index++ )
+	{
+		if( smdev_test_write_file(
+		     smdev_test_composite_scenario_paths[ member_index ],
+		     (const uint8_t *) scenarios[ member_index ],
+		     narrow_string_length(
+		      scenarios[ member_index ] ),
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Removes the scenario files of the members
+ */
+void smdev_test_composite_remove_scenarios(
+      void )
+{
+	int member_index = 0;
+
+	for( member_index = 0;
+	     member_index < SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS;
+	     member_index++ )
+	{
+		remove(
+		 smdev_test_composite_scenario_paths[ member_index ] );
+	}
+}
+
+/* Opens the handles of the simulated members
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_composite_open_member_handles(
+     libsmdev_handle_t **member_handles,
+     libcerror_error_t **error )
+{
+	int member_index = 0;
+
+	for( member_index = 0;
+	     member_index < SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS;
+	     member_index++ )
+	{
+		if( libsmdev_handle_initialize(
+		     &( member_handles[ member_index ] ),
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libsmdev_handle_set_io_backend_type(
+		     member_handles[ member_index ],
+		     LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libsmdev_handle_open(
+		     member_handles[ member_index ],
+		     smdev_test_composite_scenario_paths[ member_index ],
+		     LIBSMDEV_OPEN_READ,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Frees the handles of the simulated members
+ */
+void smdev_test_composite_free_member_handles(
+      libsmdev_handle_t **member_handles )
+{
+	int member_index = 0;
+
+	for( member_index = 0;
+	     member_index < SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS;
+	     member_index++ )
+	{
+		if( member_handles[ member_index ] != NULL )
+		{
+			libsmdev_handle_free(
+			 &( member_handles[ member_index ] ),
+			 NULL );
+		}
+	}
+}
+
+/* Tests the libsmdev_composite_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_composite_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libsmdev_composite_t *composite = NULL;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_composite_initialize(
+	          &composite,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "composite",
+	 composite );
+
+	result = libsmdev_composite_free(
+	          &composite,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "composite",
+	 composite );
+
+	/* Test error cases
+	 */
+	result = libsmdev_composite_initialize(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	composite = (libsmdev_composite_t *) 0x12345678UL;
+
+	result = libsmdev_composite_initialize(
+	          &composite,
+	          &error );
+
+	composite = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( composite != NULL )
+	{
+		libsmdev_composite_free(
+		 &composite,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_composite_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_composite_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmdev_composite_free(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_composite_open function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_composite_open(
+     void )
+{
+	libsmdev_io_backend_t *io_backends[ SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS ] = { NULL, NULL, NULL };
+
+	libcerror_error_t *error        = NULL;
+	libsmdev_composite_t *composite = NULL;
+	size64_t size                   = 0;
+	off64_t member_offset           = 0;
+	int member_index                = 0;
+	int result                      = 0;
+
+	result = smdev_test_composite_write_scenarios(
+	          smdev_test_composite_striped_scenarios,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( member_index = 0;
+	     member_index < SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS;
+	     member_index++ )
+	{
+		result = libsmdev_simulated_device_initialize_io_backend(
+		          &( io_backends[ member_index ] ),
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsmdev_io_backend_open(
+		          io_backends[ member_index ],
+		          smdev_test_composite_scenario_paths[ member_index ],
+		          LIBSMDEV_ACCESS_FLAG_READ,
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsmdev_composite_initialize(
+	          &composite,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open without members
+	 */
+	result = libsmdev_composite_open(
+	          composite,
+	          LIBSMDEV_COMPOSITE_LAYOUT_STRIPED,
+	          SMDEV_TEST_COMPOSITE_STRIPE_SIZE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( member_index = 0;
+	     member_index < SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS;
+	     member_index++ )
+	{
+		result = libsmdev_io_backend_get_size(
+		          io_backends[ member_index ],
+		          &size,
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsmdev_composite_append_member(
+		          composite,
+		          io_backends[ member_index ],
+		          size,
+		          512,
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libsmdev_composite_open(
+	          NULL,
+	          LIBSMDEV_COMPOSITE_LAYOUT_STRIPED,
+	          SMDEV_TEST_COMPOSITE_STRIPE_SIZE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_composite_open(
+	          composite,
+	          -1,
+	          SMDEV_TEST_COMPOSITE_STRIPE_SIZE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_composite_open(
+	          composite,
+	          LIBSMDEV_COMPOSITE_LAYOUT_STRIPED,
+	          1000,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_composite_open(
+	          composite,
+	          LIBSMDEV_COMPOSITE_LAYOUT_STRIPED,
+	          0x80000,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 * only the whole stripes of the smallest member are used
+	 */
+	result = libsmdev_composite_open(
+	          composite,
+	          LIBSMDEV_COMPOSITE_LAYOUT_STRIPED,
+	          SMDEV_TEST_COMPOSITE_STRIPE_SIZE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_composite_get_size(
+	          composite,
+	          &size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 0xc0000 );
+
+	result = libsmdev_composite_get_member_offset(
+	          composite,
+	          0x41000,
+	          &member_index,
+	          &member_offset,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "member_index",
+	 member_index,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "member_offset",
+	 (int64_t) member_offset,
+	 (int64_t) 0x11000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "logical_offset",
+	 (int64_t) libsmdev_composite_get_logical_offset(
+	            composite,
+	            member_index,
+	            member_offset ),
+	 (int64_t) 0x41000 );
+
+	result = libsmdev_composite_get_member_offset(
+	          composite,
+	          0xc0000,
+	          &member_index,
+	          &member_offset,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libsmdev_composite_open(
+	          composite,
+	          LIBSMDEV_COMPOSITE_LAYOUT_STRIPED,
+	          SMDEV_TEST_COMPOSITE_STRIPE_SIZE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_composite_close(
+	          composite,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "composite->number_of_members",
+	 composite->number_of_members,
+	 0 );
+
+	result = libsmdev_composite_free(
+	          &composite,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( member_index = 0;
+	     member_index < SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS;
+	     member_index++ )
+	{
+		libsmdev_io_backend_close(
+		 io_backends[ member_index ],
+		 NULL );
+
+		result = libsmdev_io_backend_free(
+		          &( io_backends[ member_index ] ),
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	smdev_test_composite_remove_scenarios();
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( composite != NULL )
+	{
+		libsmdev_composite_free(
+		 &composite,
+		 NULL );
+	}
+	for( member_index = 0;
+	     member_index < SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS;
+	     member_index++ )
+	{
+		if( io_backends[ member_index ] != NULL )
+		{
+			libsmdev_io_backend_free(
+			 &( io_backends[ member_index ] ),
+			 NULL );
+		}
+	}
+	smdev_test_composite_remove_scenarios();
+
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_open_composite function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_handle_open_composite(
+     void )
+{
+	libsmdev_handle_t *member_handles[ SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS ] = { NULL, NULL, NULL };
+
+	libcerror_error_t *error    = NULL;
+	libsmdev_handle_t *handle   = NULL;
+	libsmdev_handle_t *unopened = NULL;
+	int result                  = 0;
+
+	result = smdev_test_composite_write_scenarios(
+	          smdev_test_composite_striped_scenarios,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smdev_test_composite_open_member_handles(
+	          member_handles,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_open_composite(
+	          NULL,
+	          member_handles,
+	          SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS,
+	          LIBSMDEV_COMPOSITE_LAYOUT_STRIPED,
+	          SMDEV_TEST_COMPOSITE_STRIPE_SIZE,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_open_composite(
+	          handle,
+	          NULL,
+	          SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS,
+	          LIBSMDEV_COMPOSITE_LAYOUT_STRIPED,
+	          SMDEV_TEST_COMPOSITE_STRIPE_SIZE,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_open_composite(
+	          handle,
+	          member_handles,
+	          0,
+	          LIBSMDEV_COMPOSITE_LAYOUT_STRIPED,
+	          SMDEV_TEST_COMPOSITE_STRIPE_SIZE,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_open_composite(
+	          handle,
+	          member_handles,
+	          SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS,
+	          LIBSMDEV_COMPOSITE_LAYOUT_STRIPED,
+	          SMDEV_TEST_COMPOSITE_STRIPE_SIZE,
+	          LIBSMDEV_OPEN_READ_WRITE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open with a member handle that is not open
+	 */
+	result = libsmdev_handle_initialize(
+	          &unopened,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_open_composite(
+	          handle,
+	          &unopened,
+	          1,
+	          LIBSMDEV_COMPOSITE_LAYOUT_CONCATENATED,
+	          0,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open with the handle as its own member handle
+	 */
+	result = libsmdev_handle_open_composite(
+	          handle,
+	          &handle,
+	          1,
+	          LIBSMDEV_COMPOSITE_LAYOUT_CONCATENATED,
+	          0,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_handle_open_composite(
+	          handle,
+	          member_handles,
+	          SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS,
+	          LIBSMDEV_COMPOSITE_LAYOUT_STRIPED,
+	          SMDEV_TEST_COMPOSITE_STRIPE_SIZE,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open when already opened
+	 */
+	result = libsmdev_handle_open_composite(
+	          handle,
+	          member_handles,
+	          SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS,
+	          LIBSMDEV_COMPOSITE_LAYOUT_STRIPED,
+	          SMDEV_TEST_COMPOSITE_STRIPE_SIZE,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &unopened,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	smdev_test_composite_free_member_handles(
+	 member_handles );
+
+	smdev_test_composite_remove_scenarios();
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( unopened != NULL )
+	{
+		libsmdev_handle_free(
+		 &unopened,
+		 NULL );
+	}
+	smdev_test_composite_free_member_handles(
+	 member_handles );
+
+	smdev_test_composite_remove_scenarios();
+
+	return( 0 );
+}
+
+/* Tests reading a striped composite handle
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_handle_read_composite_striped(
+     void )
+{
+	uint8_t buffer[ 0x18000 ];
+
+	libsmdev_handle_t *member_handles[ SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS ] = { NULL, NULL, NULL };
+
+	libcerror_error_t *error     = NULL;
+	libsmdev_handle_t *handle    = NULL;
+	size64_t error_size          = 0;
+	size64_t media_size          = 0;
+	size_t buffer_index          = 0;
+	ssize_t read_count           = 0;
+	off64_t error_offset         = 0;
+	off64_t logical_offset       = 0;
+	off64_t member_offset        = 0;
+	off64_t offset               = 0;
+	uint8_t expected_byte        = 0;
+	int member_index             = 0;
+	int number_of_errors         = 0;
+	int number_of_mismatches     = 0;
+	int result                   = 0;
+
+	result = smdev_test_composite_write_scenarios(
+	          smdev_test_composite_striped_scenarios,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smdev_test_composite_open_member_handles(
+	          member_handles,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_number_of_error_retries(
+	          handle,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_error_granularity(
+	          handle,
+	          4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_open_composite(
+	          handle,
+	          member_handles,
+	          SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS,
+	          LIBSMDEV_COMPOSITE_LAYOUT_STRIPED,
+	          SMDEV_TEST_COMPOSITE_STRIPE_SIZE,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "media_size",
+	 (uint64_t) media_size,
+	 (uint64_t) 0xc0000 );
+
+	/* Test regular cases
+	 * the reads are not aligned with the stripes and span all members
+	 */
+	while( offset < (off64_t) media_size )
+	{
+		read_count = libsmdev_handle_read_buffer(
+		              handle,
+		              buffer,
+		              0x18000,
+		              &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 0x18000 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( buffer_index = 0;
+		     buffer_index < 0x18000;
+		     buffer_index++ )
+		{
+			logical_offset = offset + (off64_t) buffer_index;
+			member_offset  = ( ( logical_offset / SMDEV_TEST_COMPOSITE_STRIPE_SIZE ) / SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS ) * SMDEV_TEST_COMPOSITE_STRIPE_SIZE
+			               + ( logical_offset % SMDEV_TEST_COMPOSITE_STRIPE_SIZE );
+
+			expected_byte = (uint8_t) ( member_offset % 251 );
+
+			/* The bad range of the second member is zero-ed
+			 */
+			if( ( logical_offset >= 0x41000 )
+			 && ( logical_offset < 0x42000 ) )
+			{
+				expected_byte = 0;
+			}
+			if( buffer[ buffer_index ] != expected_byte )
+			{
+				number_of_mismatches++;
+			}
+		}
+		offset += read_count;
+	}
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_mismatches",
+	 number_of_mismatches,
+	 0 );
+
+	/* The bad range of the second member is reported at its offset in the composite
+	 */
+	result = libsmdev_handle_get_number_of_errors(
+	          handle,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 1 );
+
+	result = libsmdev_handle_get_error(
+	          handle,
+	          0,
+	          &error_offset,
+	          &error_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "error_offset",
+	 (int64_t) error_offset,
+	 (int64_t) 0x41000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "error_size",
+	 (uint64_t) error_size,
+	 (uint64_t) 0x1000 );
+
+	result = libsmdev_handle_get_composite_member_offset(
+	          handle,
+	          error_offset,
+	          &member_index,
+	          &member_offset,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "member_index",
+	 member_index,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "member_offset",
+	 (int64_t) member_offset,
+	 (int64_t) 0x11000 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_get_composite_member_offset(
+	          NULL,
+	          error_offset,
+	          &member_index,
+	          &member_offset,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_get_composite_member_offset(
+	          member_handles[ 0 ],
+	          error_offset,
+	          &member_index,
+	          &member_offset,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	smdev_test_composite_free_member_handles(
+	 member_handles );
+
+	smdev_test_composite_remove_scenarios();
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	smdev_test_composite_free_member_handles(
+	 member_handles );
+
+	smdev_test_composite_remove_scenarios();
+
+	return( 0 );
+}
+
+/* Tests reading a concatenated composite handle
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_handle_read_composite_concatenated(
+     void )
+{
+	uint8_t buffer[ 0x18000 ];
+
+	libsmdev_handle_t *member_handles[ SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS ] = { NULL, NULL, NULL };
+
+	libcerror_error_t *error     = NULL;
+	libsmdev_handle_t *handle    = NULL;
+	size64_t media_size          = 0;
+	size_t buffer_index          = 0;
+	ssize_t read_count           = 0;
+	off64_t logical_offset       = 0;
+	off64_t member_offset        = 0;
+	off64_t offset               = 0;
+	uint8_t expected_byte        = 0;
+	int member_index             = 0;
+	int number_of_errors         = 0;
+	int number_of_mismatches     = 0;
+	int result                   = 0;
+
+	result = smdev_test_composite_write_scenarios(
+	          smdev_test_composite_concatenated_scenarios,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smdev_test_composite_open_member_handles(
+	          member_handles,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_open_composite(
+	          handle,
+	          member_handles,
+	          SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS,
+	          LIBSMDEV_COMPOSITE_LAYOUT_CONCATENATED,
+	          0,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "media_size",
+	 (uint64_t) media_size,
+	 (uint64_t) 0x40000 );
+
+	/* Test regular cases
+	 * the reads span the boundaries of the members
+	 */
+	while( offset < (off64_t) media_size )
+	{
+		read_count = libsmdev_handle_read_buffer(
+		              handle,
+		              buffer,
+		              0x18000,
+		              &error );
+
+		SMDEV_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( buffer_index = 0;
+		     buffer_index < (size_t) read_count;
+		     buffer_index++ )
+		{
+			logical_offset = offset + (off64_t) buffer_index;
+
+			if( logical_offset < 0x10000 )
+			{
+				member_offset = logical_offset;
+			}
+			else if( logical_offset < 0x38000 )
+			{
+				member_offset = logical_offset - 0x10000;
+			}
+			else
+			{
+				member_offset = logical_offset - 0x38000;
+			}
+			expected_byte = (uint8_t) ( member_offset % 251 );
+
+			if( buffer[ buffer_index ] != expected_byte )
+			{
+				number_of_mismatches++;
+			}
+		}
+		offset += read_count;
+	}
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0x40000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_mismatches",
+	 number_of_mismatches,
+	 0 );
+
+	result = libsmdev_handle_get_number_of_errors(
+	          handle,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 0 );
+
+	result = libsmdev_handle_get_composite_member_offset(
+	          handle,
+	          0x3a000,
+	          &member_index,
+	          &member_offset,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "member_index",
+	 member_index,
+	 2 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "member_offset",
+	 (int64_t) member_offset,
+	 (int64_t) 0x2000 );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	smdev_test_composite_free_member_handles(
+	 member_handles );
+
+	smdev_test_composite_remove_scenarios();
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	smdev_test_composite_free_member_handles(
+	 member_handles );
+
+	smdev_test_composite_remove_scenarios();
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+	int member_index = 0;
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	for( member_index = 0;
+	     member_index < SMDEV_TEST_COMPOSITE_NUMBER_OF_MEMBERS;
+	     member_index++ )
+	{
+		if( smdev_test_get_temporary_path(
+		     "smdev_test_composite",
+		     smdev_test_composite_scenario_paths[ member_index ],
+		     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+		     NULL ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	SMDEV_TEST_RUN(
+	 "libsmdev_composite_initialize",
+	 smdev_test_composite_initialize );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_composite_free",
+	 smdev_test_composite_free );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_composite_open",
+	 smdev_test_composite_open );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_open_composite",
+	 smdev_test_handle_open_composite );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_read_composite_striped",
+	 smdev_test_handle_read_composite_striped );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_read_composite_concatenated",
+	 smdev_test_handle_read_composite_concatenated );
+
+	smdev_test_composite_remove_scenarios();
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	smdev_test_composite_remove_scenarios();
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,916 @@
+/*
+ * Library copy functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "smdev_test_functions.h"
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_copy.h"
+
+#define SMDEV_TEST_COPY_SOURCE_SIZE		( 3 * 1048576 + 1000 )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+/* The path of the scenario file
+ */
+char smdev_test_copy_scenario_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The path of the source file
+ */
+char smdev_test_copy_source_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The path of the output file
+ */
+char smdev_test_copy_output_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The scenario of the simulated device
+ */
+const char *smdev_test_copy_scenario = \
+	"size 0x280000\n"
+	"bad 0x20000 1024\n"
+	"bad 0x131000 512\n"
+	"short_read 0xc0000 0x10000 4096\n"
+	"bad 0x27c000 4096\n";
+
+/* The offset and size of the bad ranges in the scenario
+ */
+off64_t smdev_test_copy_bad_ranges[ 3 ][ 2 ] = {
+	{ 0x20000, 1024 },
+	{ 0x131000, 512 },
+	{ 0x27c000, 4096 } };
+
+/* Determines if an offset is contained in the bad ranges of the scenario
+ * Returns 1 if the offset is in a bad range or 0 if not
+ */
+int smdev_test_copy_offset_is_bad(
+     off64_t offset )
+{
+	int range_index = 0;
+
+	for( range_index = 0;
+	     range_index < 3;
+	     range_index++ )
+	{
+		if( ( offset >= smdev_test_copy_bad_ranges[ range_index ][ 0 ] )
+		 && ( offset < ( smdev_test_copy_bad_ranges[ range_index ][ 0 ] + smdev_test_copy_bad_ranges[ range_index ][ 1 ] ) ) )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Determines if a range is contained in the errors of the handle
+ * Returns 1 if the range was reported as an error, 0 if not or -1 on error
+ */
+int smdev_test_copy_range_has_error(
+     libsmdev_handle_t *handle,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error )
+{
+	off64_t error_offset = 0;
+	size64_t error_size  = 0;
+	int error_index      = 0;
+	int number_of_errors = 0;
+
+	if( libsmdev_handle_get_number_of_errors(
+	     handle,
+	     &number_of_errors,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( error_index = 0;
+	     error_index < number_of_errors;
+	     error_index++ )
+	{
+		if( libsmdev_handle_get_error(
+		     handle,
+		     error_index,
+		     &error_offset,
+		     &error_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( ( range_offset >= error_offset )
+		 && ( (off64_t) ( range_offset + range_size ) <= (off64_t) ( error_offset + error_size ) ) )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_copy_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_copy_buffer_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsmdev_copy_buffer_t *copy_buffer = NULL;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_copy_buffer_initialize(
+	          &copy_buffer,
+	          4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "copy_buffer",
+	 copy_buffer );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "copy_buffer->data_size",
+	 copy_buffer->data_size,
+	 (size_t) 4096 );
+
+	result = libsmdev_copy_buffer_free(
+	          &copy_buffer,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "copy_buffer",
+	 copy_buffer );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_copy_buffer_initialize(
+	          NULL,
+	          4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_copy_buffer_initialize(
+	          &copy_buffer,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "copy_buffer",
+	 copy_buffer );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( copy_buffer != NULL )
+	{
+		libsmdev_copy_buffer_free(
+		 &copy_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_copy_to_file_descriptor function on a simulated device
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_copy_to_file_descriptor_simulated(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+
+	libcerror_error_t *error  = NULL;
+	libsmdev_handle_t *handle = NULL;
+	size_t buffer_index       = 0;
+	ssize_t read_count        = 0;
+	off64_t offset            = 0;
+	int file_descriptor       = -1;
+	int number_of_mismatches  = 0;
+	int range_index           = 0;
+	int result                = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_copy_scenario_path,
+	          (const uint8_t *) smdev_test_copy_scenario,
+	          narrow_string_length(
+	           smdev_test_copy_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_set_error_granularity(
+	          handle,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_set_error_flags(
+	          handle,
+	          LIBSMDEV_ERROR_FLAG_ZERO_ON_ERROR,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_copy_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_descriptor = open(
+	                   smdev_test_copy_output_path,
+	                   O_RDWR | O_CREAT | O_TRUNC,
+	                   0644 );
+
+	SMDEV_TEST_ASSERT_NOT_EQUAL_INT(
+	 "file_descriptor",
+	 file_descriptor,
+	 -1 );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_handle_copy_to_file_descriptor(
+	          handle,
+	          file_descriptor,
+	          0,
+	          0x280000,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_offset(
+	          handle,
+	          &offset,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0x280000 );
+
+	/* The bad sectors must be zeroed and reported as errors and all other data must be copied
+	 */
+	offset = lseek(
+	          file_descriptor,
+	          0,
+	          SEEK_SET );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	while( offset < 0x280000 )
+	{
+		read_count = read(
+		              file_descriptor,
+		              buffer,
+		              4096 );
+
+		SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4096 );
+
+		for( buffer_index = 0;
+		     buffer_index < 4096;
+		     buffer_index++ )
+		{
+			if( smdev_test_copy_offset_is_bad(
+			     offset + (off64_t) buffer_index ) != 0 )
+			{
+				if( buffer[ buffer_index ] != 0 )
+				{
+					number_of_mismatches++;
+				}
+			}
+			else if( buffer[ buffer_index ] != (uint8_t) ( ( offset + (off64_t) buffer_index ) % 251 ) )
+			{
+				number_of_mismatches++;
+			}
+		}
+		offset += read_count;
+	}
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_mismatches",
+	 number_of_mismatches,
+	 0 );
+
+	for( range_index = 0;
+	     range_index < 3;
+	     range_index++ )
+	{
+		for( offset = smdev_test_copy_bad_ranges[ range_index ][ 0 ];
+		     offset < ( smdev_test_copy_bad_ranges[ range_index ][ 0 ] + smdev_test_copy_bad_ranges[ range_index ][ 1 ] );
+		     offset += 512 )
+		{
+			result = smdev_test_copy_range_has_error(
+			          handle,
+			          offset,
+			          512,
+			          &error );
+
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	/* Test an empty range
+	 */
+	result = libsmdev_handle_copy_to_file_descriptor(
+	          handle,
+	          file_descriptor,
+	          0x1000,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_copy_to_file_descriptor(
+	          NULL,
+	          file_descriptor,
+	          0,
+	          4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_copy_to_file_descriptor(
+	          handle,
+	          -1,
+	          0,
+	          4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_copy_to_file_descriptor(
+	          handle,
+	          file_descriptor,
+	          0x27f000,
+	          8192,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	close(
+	 file_descriptor );
+
+	file_descriptor = -1;
+
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_copy_output_path );
+	remove(
+	 smdev_test_copy_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_copy_output_path );
+	remove(
+	 smdev_test_copy_scenario_path );
+
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_copy_to_file_descriptor function on a regular file
+ * On Linux this copies the data in kernel
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_copy_to_file_descriptor_file(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+
+	libcerror_error_t *error  = NULL;
+	libsmdev_handle_t *handle = NULL;
+	uint8_t *source_data      = NULL;
+	size_t buffer_index       = 0;
+	size_t data_offset        = 0;
+	ssize_t read_count        = 0;
+	off64_t offset            = 0;
+	int file_descriptor       = -1;
+	int number_of_mismatches  = 0;
+	int result                = 0;
+
+	source_data = (uint8_t *) memory_allocate(
+	                           SMDEV_TEST_COPY_SOURCE_SIZE );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "source_data",
+	 source_data );
+
+	for( data_offset = 0;
+	     data_offset < SMDEV_TEST_COPY_SOURCE_SIZE;
+	     data_offset++ )
+	{
+		source_data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	result = smdev_test_write_file(
+	          smdev_test_copy_source_path,
+	          source_data,
+	          SMDEV_TEST_COPY_SOURCE_SIZE,
+	          &error );
+
+	memory_free(
+	 source_data );
+
+	source_data = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_copy_source_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_descriptor = open(
+	                   smdev_test_copy_output_path,
+	                   O_RDWR | O_CREAT | O_TRUNC,
+	                   0644 );
+
+	SMDEV_TEST_ASSERT_NOT_EQUAL_INT(
+	 "file_descriptor",
+	 file_descriptor,
+	 -1 );
+
+	/* Copy a range that does not start or end on a buffer boundary
+	 */
+	result = libsmdev_handle_copy_to_file_descriptor(
+	          handle,
+	          file_descriptor,
+	          4096,
+	          SMDEV_TEST_COPY_SOURCE_SIZE - 4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	offset = lseek(
+	          file_descriptor,
+	          0,
+	          SEEK_END );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) ( SMDEV_TEST_COPY_SOURCE_SIZE - 4096 ) );
+
+	offset = lseek(
+	          file_descriptor,
+	          0,
+	          SEEK_SET );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	do
+	{
+		read_count = read(
+		              file_descriptor,
+		              buffer,
+		              4096 );
+
+		SMDEV_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		for( buffer_index = 0;
+		     buffer_index < (size_t) read_count;
+		     buffer_index++ )
+		{
+			if( buffer[ buffer_index ] != (uint8_t) ( ( 4096 + offset + (off64_t) buffer_index ) % 251 ) )
+			{
+				number_of_mismatches++;
+			}
+		}
+		offset += read_count;
+	}
+	while( read_count > 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_mismatches",
+	 number_of_mismatches,
+	 0 );
+
+	/* Clean up
+	 */
+	close(
+	 file_descriptor );
+
+	file_descriptor = -1;
+
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_copy_output_path );
+	remove(
+	 smdev_test_copy_source_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( source_data != NULL )
+	{
+		memory_free(
+		 source_data );
+	}
+	remove(
+	 smdev_test_copy_output_path );
+	remove(
+	 smdev_test_copy_source_path );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_copy",
+	     smdev_test_copy_scenario_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_copy_source",
+	     smdev_test_copy_source_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_copy_output",
+	     smdev_test_copy_output_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	SMDEV_TEST_RUN(
+	 "libsmdev_copy_buffer_initialize",
+	 smdev_test_copy_buffer_initialize );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_copy_to_file_descriptor",
+	 smdev_test_copy_to_file_descriptor_simulated );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_copy_to_file_descriptor",
+	 smdev_test_copy_to_file_descriptor_file );
+
+	remove(
+	 smdev_test_copy_scenario_path );
+
+	remove(
+	 smdev_test_copy_source_path );
+
+	remove(
+	 smdev_test_copy_output_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	remove(
+	 smdev_test_copy_scenario_path );
+
+	remove(
+	 smdev_test_copy_source_path );
+
+	remove(
+	 smdev_test_copy_output_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,812 @@
+/*
+ * Library device_list type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_device_information.h"
+#include "../libsmdev/libsmdev_device_list.h"
+
+/* Tests the libsmdev_device_list_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_device_list_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libsmdev_device_list_t *device_list = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_SMDEV_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 2;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmdev_device_list_initialize(
+	          &device_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "device_list",
+	 device_list );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_device_list_free(
+	          &device_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "device_list",
+	 device_list );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_device_list_initialize(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	device_list = (libsmdev_device_list_t *) 0x12345678UL;
+
+	result = libsmdev_device_list_initialize(
+	          &device_list,
+	          &error );
+
+	device_list = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMDEV_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmdev_device_list_initialize with malloc failing
+		 */
+		smdev_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmdev_device_list_initialize(
+		          &device_list,
+		          &error );
+
+		if( smdev_test_malloc_attempts_before_fail != -1 )
+		{
+			smdev_test_malloc_attempts_before_fail = -1;
+
+			if( device_list != NULL )
+			{
+				libsmdev_device_list_free(
+				 &device_list,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMDEV_TEST_ASSERT_IS_NULL(
+			 "device_list",
+			 device_list );
+
+			SMDEV_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmdev_device_list_initialize with memset failing
+		 */
+		smdev_test_memset_attempts_before_fail = test_number;
+
+		result = libsmdev_device_list_initialize(
+		          &device_list,
+		          &error );
+
+		if( smdev_test_memset_attempts_before_fail != -1 )
+		{
+			smdev_test_memset_attempts_before_fail = -1;
+
+			if( device_list != NULL )
+			{
+				libsmdev_device_list_free(
+				 &device_list,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMDEV_TEST_ASSERT_IS_NULL(
+			 "device_list",
+			 device_list );
+
+			SMDEV_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMDEV_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( device_list != NULL )
+	{
+		libsmdev_device_list_free(
+		 &device_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_device_list_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_device_list_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmdev_device_list_free(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_device_list_scan and libsmdev_device_list_get_number_of_devices functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_device_list_scan(
+     void )
+{
+	uint8_t utf8_string[ 128 ];
+
+	libcerror_error_t *error            = NULL;
+	libsmdev_device_list_t *device_list = NULL;
+	size64_t media_size                 = 0;
+	uint8_t bus_type                    = 0;
+	uint8_t media_type                  = 0;
+	int number_of_devices               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_device_list_initialize(
+	          &device_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "device_list",
+	 device_list );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_device_list_scan(
+	          device_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_device_list_get_number_of_devices(
+	          device_list,
+	          &number_of_devices,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_devices > 0 )
+	{
+		result = libsmdev_device_list_get_utf8_device_path(
+		          device_list,
+		          0,
+		          utf8_string,
+		          128,
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsmdev_device_list_get_media_size(
+		          device_list,
+		          0,
+		          &media_size,
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsmdev_device_list_get_media_type(
+		          device_list,
+		          0,
+		          &media_type,
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsmdev_device_list_get_bus_type(
+		          device_list,
+		          0,
+		          &bus_type,
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libsmdev_device_list_get_utf8_information_value(
+		          device_list,
+		          0,
+		          (uint8_t *) "model",
+		          5,
+		          utf8_string,
+		          128,
+		          &error );
+
+		SMDEV_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libsmdev_device_list_scan(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_device_list_get_number_of_devices(
+	          NULL,
+	          &number_of_devices,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_device_list_get_media_size(
+	          device_list,
+	          -1,
+	          &media_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_device_list_free(
+	          &device_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "device_list",
+	 device_list );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( device_list != NULL )
+	{
+		libsmdev_device_list_free(
+		 &device_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+/* Tests the libsmdev_device_information_get_bus_type_from_path function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_device_information_get_bus_type_from_path(
+     void )
+{
+	const char *ata_path     = "../devices/pci0000:00/0000:00:17.0/ata1/host0/target0:0:0/0:0:0:0/block/sda";
+	const char *usb_path     = "../devices/pci0000:00/0000:00:14.0/usb2/2-1/2-1:1.0/host6/target6:0:0/6:0:0:0/block/sdb";
+	const char *virtual_path = "../devices/virtual/block/loop0";
+	libcerror_error_t *error = NULL;
+	uint8_t bus_type         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_device_information_get_bus_type_from_path(
+	          ata_path,
+	          narrow_string_length(
+	           ata_path ),
+	          &bus_type,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "bus_type",
+	 bus_type,
+	 LIBSMDEV_BUS_TYPE_ATA );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_device_information_get_bus_type_from_path(
+	          usb_path,
+	          narrow_string_length(
+	           usb_path ),
+	          &bus_type,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "bus_type",
+	 bus_type,
+	 LIBSMDEV_BUS_TYPE_USB );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_device_information_get_bus_type_from_path(
+	          virtual_path,
+	          narrow_string_length(
+	           virtual_path ),
+	          &bus_type,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "bus_type",
+	 bus_type,
+	 LIBSMDEV_BUS_TYPE_UNKNOWN );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_device_information_get_bus_type_from_path(
+	          NULL,
+	          0,
+	          &bus_type,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_device_information_get_bus_type_from_path(
+	          ata_path,
+	          narrow_string_length(
+	           ata_path ),
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_device_information_get_utf8_device_path function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_device_information_get_utf8_device_path(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error                          = NULL;
+	libsmdev_device_information_t *device_information = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_device_information_initialize(
+	          &device_information,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "device_information",
+	 device_information );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_device_information_set_name(
+	          device_information,
+	          "cciss!c0d0",
+	          10,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_device_information_get_utf8_device_path(
+	          device_information,
+	          utf8_string,
+	          32,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "/dev/cciss/c0d0",
+	          16 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_device_information_get_utf8_device_path(
+	          device_information,
+	          utf8_string,
+	          8,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_device_information_free(
+	          &device_information,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "device_information",
+	 device_information );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( device_information != NULL )
+	{
+		libsmdev_device_information_free(
+		 &device_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_device_list_initialize",
+	 smdev_test_device_list_initialize );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_device_list_free",
+	 smdev_test_device_list_free );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_device_list_scan",
+	 smdev_test_device_list_scan );
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_device_information_get_bus_type_from_path",
+	 smdev_test_device_information_get_bus_type_from_path );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_device_information_get_utf8_device_path",
+	 smdev_test_device_information_get_utf8_device_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1223 @@
+/*
+ * Library fallback source functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_functions.h"
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_fallback_source.h"
+#include "../libsmdev/libsmdev_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+/* The path of the scenario file
+ */
+char smdev_test_fallback_source_scenario_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The path of the mirror scenario file
+ */
+char smdev_test_fallback_source_mirror_scenario_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The path of the image file
+ */
+char smdev_test_fallback_source_image_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The scenario of the simulated device
+ */
+const char *smdev_test_fallback_source_scenario = \
+	"size 0x100000\n"
+	"bad 0x10000 0x2000\n"
+	"bad 0x40000 0x1000\n"
+	"bad 0x80000 0x1000\n";
+
+/* The scenario of the simulated mirror of the device
+ * The mirror cannot read the last 2 bad ranges of the device either
+ */
+const char *smdev_test_fallback_source_mirror_scenario = \
+	"size 0x100000\n"
+	"bad 0x40000 0x1000\n"
+	"bad 0x80000 0x1000\n";
+
+/* The size of the image of the device, which only contains the first 2 bad ranges
+ */
+#define SMDEV_TEST_FALLBACK_SOURCE_IMAGE_SIZE			0x60000
+
+/* Writes the image file with the same data as the simulated device
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_fallback_source_write_image(
+     const char *path,
+     size_t image_size,
+     libcerror_error_t **error )
+{
+	uint8_t *image_data   = NULL;
+	static char *function = "smdev_test_fallback_source_write_image";
+	size_t image_offset   = 0;
+	int result            = 0;
+
+	image_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * image_size );
+
+	if( image_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create image data.",
+		 function );
+
+		return( -1 );
+	}
+	for( image_offset = 0;
+	     image_offset < image_size;
+	     image_offset++ )
+	{
+		image_data[ image_offset ] = (uint8_t) ( image_offset % 251 );
+	}
+	result = smdev_test_write_file(
+	          path,
+	          image_data,
+	          image_size,
+	          error );
+
+	memory_free(
+	 image_data );
+
+	return( result );
+}
+
+/* Tests the libsmdev_fallback_source_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_fallback_source_initialize(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libsmdev_fallback_source_t *fallback_source = NULL;
+	int result                                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_fallback_source_initialize(
+	          &fallback_source,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "fallback_source",
+	 fallback_source );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "fallback_source->supplied_range_list",
+	 fallback_source->supplied_range_list );
+
+	result = libsmdev_fallback_source_free(
+	          &fallback_source,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "fallback_source",
+	 fallback_source );
+
+	/* Test error cases
+	 */
+	result = libsmdev_fallback_source_initialize(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	fallback_source = (libsmdev_fallback_source_t *) 0x12345678UL;
+
+	result = libsmdev_fallback_source_initialize(
+	          &fallback_source,
+	          &error );
+
+	fallback_source = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( fallback_source != NULL )
+	{
+		libsmdev_fallback_source_free(
+		 &fallback_source,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_fallback_source_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_fallback_source_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmdev_fallback_source_free(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_fallback_source_open function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_fallback_source_open(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libsmdev_fallback_source_t *fallback_source = NULL;
+	int result                                  = 0;
+
+	result = smdev_test_fallback_source_write_image(
+	          smdev_test_fallback_source_image_path,
+	          4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_fallback_source_initialize(
+	          &fallback_source,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_fallback_source_open(
+	          fallback_source,
+	          smdev_test_fallback_source_image_path,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "fallback_source->io_backend",
+	 fallback_source->io_backend );
+
+	/* Test error cases
+	 */
+	result = libsmdev_fallback_source_open(
+	          NULL,
+	          smdev_test_fallback_source_image_path,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_fallback_source_open(
+	          fallback_source,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libsmdev_fallback_source_open(
+	          fallback_source,
+	          smdev_test_fallback_source_image_path,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_fallback_source_free(
+	          &fallback_source,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_fallback_source_image_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( fallback_source != NULL )
+	{
+		libsmdev_fallback_source_free(
+		 &fallback_source,
+		 NULL );
+	}
+	remove(
+	 smdev_test_fallback_source_image_path );
+
+	return( 0 );
+}
+
+/* Opens a handle of a simulated device
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_fallback_source_open_handle(
+     libsmdev_handle_t *handle,
+     const char *scenario_path,
+     libcerror_error_t **error )
+{
+	if( libsmdev_handle_set_io_backend_type(
+	     handle,
+	     LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libsmdev_handle_set_number_of_error_retries(
+	     handle,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libsmdev_handle_set_error_granularity(
+	     handle,
+	     4096,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libsmdev_handle_open(
+	     handle,
+	     scenario_path,
+	     LIBSMDEV_OPEN_READ,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests reading a handle with fallback sources
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_handle_fallback_sources(
+     void )
+{
+	uint8_t buffer[ 65536 ];
+
+	libcerror_error_t *error         = NULL;
+	libsmdev_handle_t *handle        = NULL;
+	libsmdev_handle_t *mirror_handle = NULL;
+	size64_t range_size              = 0;
+	size_t buffer_index              = 0;
+	ssize_t read_count               = 0;
+	off64_t offset                   = 0;
+	off64_t range_offset             = 0;
+	uint8_t expected_byte            = 0;
+	int number_of_errors             = 0;
+	int number_of_mismatches         = 0;
+	int number_of_ranges             = 0;
+	int number_of_sources            = 0;
+	int result                       = 0;
+	int source_index                 = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_fallback_source_scenario_path,
+	          (uint8_t *) smdev_test_fallback_source_scenario,
+	          narrow_string_length(
+	           smdev_test_fallback_source_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smdev_test_write_file(
+	          smdev_test_fallback_source_mirror_scenario_path,
+	          (uint8_t *) smdev_test_fallback_source_mirror_scenario,
+	          narrow_string_length(
+	           smdev_test_fallback_source_mirror_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smdev_test_fallback_source_write_image(
+	          smdev_test_fallback_source_image_path,
+	          SMDEV_TEST_FALLBACK_SOURCE_IMAGE_SIZE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smdev_test_fallback_source_open_handle(
+	          handle,
+	          smdev_test_fallback_source_scenario_path,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &mirror_handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smdev_test_fallback_source_open_handle(
+	          mirror_handle,
+	          smdev_test_fallback_source_mirror_scenario_path,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_handle_append_fallback_handle(
+	          handle,
+	          mirror_handle,
+	          &source_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "source_index",
+	 source_index,
+	 0 );
+
+	result = libsmdev_handle_append_fallback_file(
+	          handle,
+	          smdev_test_fallback_source_image_path,
+	          &source_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "source_index",
+	 source_index,
+	 1 );
+
+	result = libsmdev_handle_get_number_of_fallback_sources(
+	          handle,
+	          &number_of_sources,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sources",
+	 number_of_sources,
+	 2 );
+
+	/* The data of the first bad range is read from the mirror, of the second from the image
+	 * and the third cannot be read from any source and is zero-ed
+	 */
+	while( offset < (off64_t) 0x100000 )
+	{
+		read_count = libsmdev_handle_read_buffer(
+		              handle,
+		              buffer,
+		              65536,
+		              &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 65536 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( buffer_index = 0;
+		     buffer_index < 65536;
+		     buffer_index++ )
+		{
+			expected_byte = (uint8_t) ( ( offset + (off64_t) buffer_index ) % 251 );
+
+			if( ( ( offset + (off64_t) buffer_index ) >= 0x80000 )
+			 && ( ( offset + (off64_t) buffer_index ) < 0x81000 ) )
+			{
+				expected_byte = 0;
+			}
+			if( buffer[ buffer_index ] != expected_byte )
+			{
+				number_of_mismatches++;
+			}
+		}
+		offset += read_count;
+	}
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_mismatches",
+	 number_of_mismatches,
+	 0 );
+
+	/* The errors of the device remain reported
+	 */
+	result = libsmdev_handle_get_number_of_errors(
+	          handle,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 3 );
+
+	result = libsmdev_handle_get_error_source(
+	          handle,
+	          0,
+	          &source_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "source_index",
+	 source_index,
+	 0 );
+
+	result = libsmdev_handle_get_error_source(
+	          handle,
+	          1,
+	          &source_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "source_index",
+	 source_index,
+	 1 );
+
+	result = libsmdev_handle_get_error_source(
+	          handle,
+	          2,
+	          &source_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_number_of_supplied_ranges(
+	          handle,
+	          0,
+	          &number_of_ranges,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 1 );
+
+	result = libsmdev_handle_get_supplied_range(
+	          handle,
+	          0,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 0x10000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 0x2000 );
+
+	result = libsmdev_handle_get_number_of_supplied_ranges(
+	          handle,
+	          1,
+	          &number_of_ranges,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 1 );
+
+	result = libsmdev_handle_get_supplied_range(
+	          handle,
+	          1,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "range_offset",
+	 (int64_t) range_offset,
+	 (int64_t) 0x40000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 (uint64_t) range_size,
+	 (uint64_t) 0x1000 );
+
+	/* The reads of the mirror are not affected by the reads of the handle
+	 */
+	read_count = libsmdev_handle_read_buffer(
+	          mirror_handle,
+	          buffer,
+	          4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "buffer[ 1 ]",
+	 (int) buffer[ 1 ],
+	 1 );
+
+	result = libsmdev_handle_get_number_of_errors(
+	          mirror_handle,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_append_fallback_handle(
+	          NULL,
+	          mirror_handle,
+	          &source_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_append_fallback_handle(
+	          handle,
+	          NULL,
+	          &source_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_append_fallback_handle(
+	          handle,
+	          handle,
+	          &source_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_append_fallback_handle(
+	          handle,
+	          mirror_handle,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_append_fallback_file(
+	          handle,
+	          NULL,
+	          &source_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_get_number_of_supplied_ranges(
+	          handle,
+	          2,
+	          &number_of_ranges,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_get_error_source(
+	          handle,
+	          3,
+	          &source_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_get_error_source(
+	          handle,
+	          0,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The supplied ranges are reset when the handle is closed
+	 */
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_number_of_supplied_ranges(
+	          handle,
+	          0,
+	          &number_of_ranges,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &mirror_handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_fallback_source_scenario_path );
+	remove(
+	 smdev_test_fallback_source_mirror_scenario_path );
+	remove(
+	 smdev_test_fallback_source_image_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( mirror_handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &mirror_handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_fallback_source_scenario_path );
+	remove(
+	 smdev_test_fallback_source_mirror_scenario_path );
+	remove(
+	 smdev_test_fallback_source_image_path );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_fallback_source",
+	     smdev_test_fallback_source_scenario_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_fallback_source_mirror",
+	     smdev_test_fallback_source_mirror_scenario_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_fallback_source_image",
+	     smdev_test_fallback_source_image_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	SMDEV_TEST_RUN(
+	 "libsmdev_fallback_source_initialize",
+	 smdev_test_fallback_source_initialize );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_fallback_source_free",
+	 smdev_test_fallback_source_free );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_fallback_source_open",
+	 smdev_test_fallback_source_open );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_fallback_sources",
+	 smdev_test_handle_fallback_sources );
+
+	remove(
+	 smdev_test_fallback_source_scenario_path );
+
+	remove(
+	 smdev_test_fallback_source_mirror_scenario_path );
+
+	remove(
+	 smdev_test_fallback_source_image_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	remove(
+	 smdev_test_fallback_source_scenario_path );
+
+	remove(
+	 smdev_test_fallback_source_mirror_scenario_path );
+
+	remove(
+	 smdev_test_fallback_source_image_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_FAILURE );
+}
+
@@ -30,6 +30,10 @@
 #include <stdlib.h>
 #endif
 
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
 #include "smdev_test_libcerror.h"
 #include "smdev_test_libclocale.h"
 #include "smdev_test_libuna.h"
@@ -434,3 +438,223 @@ int smdev_test_get_wide_source(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+/* Creates a uniquely named temporary file for test data
+ * The file is created in the directory in the TMPDIR environment variable, or "/tmp",
+ * using mkstemp. If mkstemp is not available the file is named after the prefix
+ * and created in the current, build, directory
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_get_temporary_path(
+     const char *prefix,
+     char *path,
+     size_t path_size,
+     libcerror_error_t **error )
+{
+	const char *directory = NULL;
+	static char *function = "smdev_test_get_temporary_path";
+	int print_count       = 0;
+
+#if defined( HAVE_MKSTEMP )
+	int file_descriptor   = -1;
+#else
+	FILE *file_stream     = NULL;
+#endif
+
+	if( prefix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MKSTEMP )
+	directory = getenv(
+	             "TMPDIR" );
+
+	if( ( directory == NULL )
+	 || ( directory[ 0 ] == 0 ) )
+	{
+		directory = "/tmp";
+	}
+	print_count = narrow_string_snprintf(
+	               path,
+	               path_size,
+	               "%s/%s.XXXXXX",
+	               directory,
+	               prefix );
+#else
+	directory = ".";
+
+	print_count = narrow_string_snprintf(
+	               path,
+	               path_size,
+	               "%s/%s.tmp",
+	               directory,
+	               prefix );
+#endif
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= path_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path size value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MKSTEMP )
+	file_descriptor = mkstemp(
+	                   path );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create temporary file: %s.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	close(
+	 file_descriptor );
+#else
+	file_stream = file_stream_open(
+	               path,
+	               FILE_STREAM_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to create temporary file: %s.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	file_stream_close(
+	 file_stream );
+#endif
+	return( 1 );
+}
+
+/* Writes data to a file, the file is overwritten if it exists
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_write_file(
+     const char *path,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	FILE *file_stream     = NULL;
+	static char *function = "smdev_test_write_file";
+	ssize_t write_count   = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	file_stream = file_stream_open(
+	               path,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		write_count = file_stream_write(
+		               file_stream,
+		               data,
+		               data_size );
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file: %s.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write file: %s.",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -27,6 +27,10 @@
 
 #include "smdev_test_libcerror.h"
 
+/* The maximum size of a temporary path
+ */
+#define SMDEV_TEST_MAXIMUM_PATH_SIZE	256
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
@@ -47,6 +51,18 @@ int smdev_test_get_wide_source(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+int smdev_test_get_temporary_path(
+     const char *prefix,
+     char *path,
+     size_t path_size,
+     libcerror_error_t **error );
+
+int smdev_test_write_file(
+     const char *path,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1306 @@
+/*
+ * Library geometry functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_LINUX_FS_H ) && !defined( WINAPI )
+/* Required for Linux platforms that use a sizeof( u64 )
+ * in linux/fs.h but have no typedef of it
+ */
+#if !defined( HAVE_U64 )
+typedef size_t u64;
+#endif
+
+#include <linux/fs.h>
+#endif
+
+#include "smdev_test_functions.h"
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_geometry.h"
+#include "../libsmdev/libsmdev_handle.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+/* The path of the scenario file
+ */
+char smdev_test_geometry_scenario_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* READ CAPACITY (16) parameter data of a 512-byte emulation (512e) device
+ * with 4096-byte physical sectors of which the first starts at sector 7
+ */
+uint8_t smdev_test_geometry_capacity_data1[ 32 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x74, 0x70, 0x6d, 0xaf, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Block limits vital product data (VPD) page with an optimal transfer length granularity of 8 sectors,
+ * a maximum transfer length of 65535 sectors and an optimal transfer length of 2048 sectors
+ */
+uint8_t smdev_test_geometry_block_limits_data1[ 64 ] = {
+	0x00, 0xb0, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Block device characteristics vital product data (VPD) page of a 7200 RPM medium
+ */
+uint8_t smdev_test_geometry_block_device_characteristics_data1[ 64 ] = {
+	0x00, 0xb1, 0x00, 0x3c, 0x1c, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The scenario of the simulated device
+ */
+const char *smdev_test_geometry_scenario = \
+	"size 0x100000\n"
+	"physical_bytes_per_sector 4096\n"
+	"alignment_offset 3584\n";
+
+/* Tests the libsmdev_geometry_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_geometry_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libsmdev_geometry_t *geometry  = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_geometry_initialize(
+	          &geometry,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "geometry",
+	 geometry );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "geometry->bytes_per_sector",
+	 geometry->bytes_per_sector,
+	 512 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "geometry->physical_bytes_per_sector",
+	 geometry->physical_bytes_per_sector,
+	 0 );
+
+	result = libsmdev_geometry_free(
+	          &geometry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "geometry",
+	 geometry );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_geometry_initialize(
+	          NULL,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_geometry_initialize(
+	          &geometry,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "geometry",
+	 geometry );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( geometry != NULL )
+	{
+		libsmdev_geometry_free(
+		 &geometry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_geometry_read_capacity_16_data function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_geometry_read_capacity_16_data(
+     void )
+{
+	uint8_t data[ 32 ];
+
+	libcerror_error_t *error      = NULL;
+	libsmdev_geometry_t *geometry = NULL;
+	uint64_t alignment_offset     = 0;
+	int result                    = 0;
+
+	result = libsmdev_geometry_initialize(
+	          &geometry,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_geometry_read_capacity_16_data(
+	          geometry,
+	          smdev_test_geometry_capacity_data1,
+	          32,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "geometry->number_of_sectors",
+	 geometry->number_of_sectors,
+	 (uint64_t) 0x74706db0UL );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "geometry->bytes_per_sector",
+	 geometry->bytes_per_sector,
+	 512 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "geometry->physical_bytes_per_sector",
+	 geometry->physical_bytes_per_sector,
+	 4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "geometry->lowest_aligned_sector",
+	 geometry->lowest_aligned_sector,
+	 7 );
+
+	result = libsmdev_geometry_get_alignment_offset(
+	          geometry,
+	          &alignment_offset,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "alignment_offset",
+	 alignment_offset,
+	 (uint64_t) 3584 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data that does not contain a valid capacity
+	 */
+	result = libsmdev_geometry_read_capacity_16_data(
+	          geometry,
+	          smdev_test_geometry_capacity_data1,
+	          8,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_set(
+	          data,
+	          0,
+	          32 ) != NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_geometry_read_capacity_16_data(
+	          geometry,
+	          data,
+	          32,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "geometry->physical_bytes_per_sector",
+	 geometry->physical_bytes_per_sector,
+	 4096 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_geometry_read_capacity_16_data(
+	          NULL,
+	          smdev_test_geometry_capacity_data1,
+	          32,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_geometry_read_capacity_16_data(
+	          geometry,
+	          NULL,
+	          32,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_geometry_free(
+	          &geometry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( geometry != NULL )
+	{
+		libsmdev_geometry_free(
+		 &geometry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_geometry_read_block_limits_data and
+ * libsmdev_geometry_read_block_device_characteristics_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_geometry_read_vital_product_data(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libsmdev_geometry_t *geometry = NULL;
+	int result                    = 0;
+
+	result = libsmdev_geometry_initialize(
+	          &geometry,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_geometry_read_block_limits_data(
+	          geometry,
+	          smdev_test_geometry_block_limits_data1,
+	          64,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "geometry->optimal_transfer_length_granularity",
+	 geometry->optimal_transfer_length_granularity,
+	 8 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "geometry->maximum_transfer_length",
+	 geometry->maximum_transfer_length,
+	 65535 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "geometry->optimal_transfer_length",
+	 geometry->optimal_transfer_length,
+	 2048 );
+
+	result = libsmdev_geometry_read_block_device_characteristics_data(
+	          geometry,
+	          smdev_test_geometry_block_device_characteristics_data1,
+	          64,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "geometry->rotation_rate",
+	 geometry->rotation_rate,
+	 7200 );
+
+	/* Test data of another page
+	 */
+	result = libsmdev_geometry_read_block_limits_data(
+	          geometry,
+	          smdev_test_geometry_block_device_characteristics_data1,
+	          64,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_geometry_read_block_device_characteristics_data(
+	          geometry,
+	          smdev_test_geometry_block_limits_data1,
+	          64,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_geometry_read_block_limits_data(
+	          NULL,
+	          smdev_test_geometry_block_limits_data1,
+	          64,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_geometry_read_block_device_characteristics_data(
+	          geometry,
+	          NULL,
+	          64,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_geometry_free(
+	          &geometry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( geometry != NULL )
+	{
+		libsmdev_geometry_free(
+		 &geometry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_geometry_set_alignment_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_geometry_set_alignment_offset(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libsmdev_geometry_t *geometry = NULL;
+	uint64_t alignment_offset     = 0;
+	int result                    = 0;
+
+	result = libsmdev_geometry_initialize(
+	          &geometry,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	geometry->physical_bytes_per_sector = 4096;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_geometry_set_alignment_offset(
+	          geometry,
+	          3584,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "geometry->lowest_aligned_sector",
+	 geometry->lowest_aligned_sector,
+	 7 );
+
+	result = libsmdev_geometry_get_alignment_offset(
+	          geometry,
+	          &alignment_offset,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "alignment_offset",
+	 alignment_offset,
+	 (uint64_t) 3584 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_geometry_set_alignment_offset(
+	          geometry,
+	          100,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_geometry_get_alignment_offset(
+	          geometry,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_geometry_free(
+	          &geometry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( geometry != NULL )
+	{
+		libsmdev_geometry_free(
+		 &geometry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_geometry_get_request_size function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_geometry_get_request_size(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libsmdev_geometry_t *geometry = NULL;
+	size_t request_size           = 0;
+	int result                    = 0;
+
+	result = libsmdev_geometry_initialize(
+	          &geometry,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the request size is a multiple of the physical sector size
+	 */
+	geometry->physical_bytes_per_sector = 4096;
+
+	result = libsmdev_geometry_get_request_size(
+	          geometry,
+	          1000000,
+	          &request_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "request_size",
+	 request_size,
+	 (size_t) 999424 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_geometry_get_request_size(
+	          geometry,
+	          1000,
+	          &request_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "request_size",
+	 request_size,
+	 (size_t) 4096 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the request size is a multiple of the optimal transfer length granularity
+	 */
+	geometry->optimal_transfer_length_granularity = 16;
+
+	result = libsmdev_geometry_get_request_size(
+	          geometry,
+	          1052672,
+	          &request_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "request_size",
+	 request_size,
+	 (size_t) 1048576 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the request size is limited to the optimal and maximum transfer length
+	 */
+	geometry->optimal_transfer_length = 1024;
+	geometry->maximum_transfer_length = 2048;
+
+	result = libsmdev_geometry_get_request_size(
+	          geometry,
+	          1048576,
+	          &request_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "request_size",
+	 request_size,
+	 (size_t) 524288 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	geometry->optimal_transfer_length = 0;
+	geometry->maximum_transfer_length = 240;
+
+	result = libsmdev_geometry_get_request_size(
+	          geometry,
+	          1048576,
+	          &request_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "request_size",
+	 request_size,
+	 (size_t) 122880 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_geometry_get_request_size(
+	          NULL,
+	          1048576,
+	          &request_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_geometry_get_request_size(
+	          geometry,
+	          0,
+	          &request_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_geometry_get_request_size(
+	          geometry,
+	          1048576,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_geometry_free(
+	          &geometry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( geometry != NULL )
+	{
+		libsmdev_geometry_free(
+		 &geometry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_get_physical_bytes_per_sector, libsmdev_handle_get_alignment_offset,
+ * libsmdev_handle_get_maximum_transfer_length, libsmdev_handle_get_optimal_transfer_length
+ * and libsmdev_handle_get_rotation_rate functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_handle_geometry(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libsmdev_handle_t *handle                   = NULL;
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	uint64_t alignment_offset                   = 0;
+	uint32_t physical_bytes_per_sector          = 0;
+	uint32_t transfer_length                    = 0;
+	uint16_t rotation_rate                      = 0;
+	int result                                  = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_geometry_scenario_path,
+	          (const uint8_t *) smdev_test_geometry_scenario,
+	          narrow_string_length(
+	           smdev_test_geometry_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_get_physical_bytes_per_sector(
+	          handle,
+	          &physical_bytes_per_sector,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_geometry_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_physical_bytes_per_sector(
+	          handle,
+	          &physical_bytes_per_sector,
+	          &error );
+
+#if defined( BLKPBSZGET )
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "physical_bytes_per_sector",
+	 physical_bytes_per_sector,
+	 4096 );
+#else
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+#endif
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_alignment_offset(
+	          handle,
+	          &alignment_offset,
+	          &error );
+
+#if defined( BLKPBSZGET ) && defined( BLKALIGNOFF )
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "alignment_offset",
+	 alignment_offset,
+	 (uint64_t) 3584 );
+#else
+	SMDEV_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+#endif
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The simulated device does not report transfer lengths or a rotation rate
+	 */
+	result = libsmdev_handle_get_maximum_transfer_length(
+	          handle,
+	          &transfer_length,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_optimal_transfer_length(
+	          handle,
+	          &transfer_length,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_rotation_rate(
+	          handle,
+	          &rotation_rate,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the read stripe size is limited to the maximum transfer length
+	 * and a multiple of the physical sector size
+	 */
+	internal_handle->geometry->maximum_transfer_length = 1001;
+
+	result = libsmdev_internal_handle_apply_transport_profile(
+	          internal_handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( BLKPBSZGET )
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_handle->read_stripe_size",
+	 internal_handle->read_stripe_size,
+	 (size_t) 512000 );
+#else
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_handle->read_stripe_size",
+	 internal_handle->read_stripe_size,
+	 (size_t) 512512 );
+#endif
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_get_rotation_rate(
+	          handle,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "internal_handle->geometry",
+	 internal_handle->geometry );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_geometry_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_geometry_scenario_path );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_geometry",
+	     smdev_test_geometry_scenario_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	SMDEV_TEST_RUN(
+	 "libsmdev_geometry_initialize",
+	 smdev_test_geometry_initialize );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_geometry_read_capacity_16_data",
+	 smdev_test_geometry_read_capacity_16_data );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_geometry_read_vital_product_data",
+	 smdev_test_geometry_read_vital_product_data );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_geometry_set_alignment_offset",
+	 smdev_test_geometry_set_alignment_offset );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_geometry_get_request_size",
+	 smdev_test_geometry_get_request_size );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_geometry",
+	 smdev_test_handle_geometry );
+
+	remove(
+	 smdev_test_geometry_scenario_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	remove(
+	 smdev_test_geometry_scenario_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_FAILURE );
+}
+
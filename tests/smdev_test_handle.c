@@ -38,6 +38,8 @@
 #include "smdev_test_macros.h"
 #include "smdev_test_memory.h"
 
+#include "../libsmdev/libsmdev_handle.h"
+
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
 #error Unsupported size of wchar_t
 #endif
@@ -421,6 +423,8 @@ int smdev_test_handle_open(
 
 	libcerror_error_t *error  = NULL;
 	libsmdev_handle_t *handle = NULL;
+	size64_t media_size       = 0;
+	off64_t offset            = 0;
 	int result                = 0;
 
 	/* Initialize test
@@ -494,6 +498,98 @@ int smdev_test_handle_open(
 	libcerror_error_free(
 	 &error );
 
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with deferred probing
+	 */
+	result = libsmdev_handle_open(
+	          handle,
+	          narrow_source,
+	          LIBSMDEV_OPEN_READ | LIBSMDEV_ACCESS_FLAG_DEFER_PROBING,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "device_probed",
+	 ( (libsmdev_internal_handle_t *) handle )->device_probed,
+	 0 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+	result = libsmdev_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first seek probes the device
+	 */
+	offset = libsmdev_handle_seek_offset(
+	          handle,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "device_probed",
+	 ( (libsmdev_internal_handle_t *) handle )->device_probed,
+	 1 );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Clean up
 	 */
 	result = libsmdev_handle_free(
@@ -1123,6 +1219,177 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+/* Tests the libsmdev_handle_get_io_backend_type and libsmdev_handle_set_io_backend_type functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_handle_set_io_backend_type(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libsmdev_handle_t *handle = NULL;
+	int io_backend_type       = 0;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_handle_get_io_backend_type(
+	          handle,
+	          &io_backend_type,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "io_backend_type",
+	 io_backend_type,
+	 LIBSMDEV_IO_BACKEND_TYPE_FILE );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_FILE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_get_io_backend_type(
+	          NULL,
+	          &io_backend_type,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_get_io_backend_type(
+	          handle,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          NULL,
+	          LIBSMDEV_IO_BACKEND_TYPE_FILE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_UNDEFINED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1179,6 +1446,10 @@ int main(
 	 "libsmdev_handle_free",
 	 smdev_test_handle_free );
 
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_set_io_backend_type",
+	 smdev_test_handle_set_io_backend_type );
+
 	if( source != NULL )
 	{
 		result = libcfile_file_initialize(
@@ -0,0 +1,1091 @@
+/*
+ * Library IO backend functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_handle.h"
+#include "../libsmdev/libsmdev_io_backend.h"
+
+#define SMDEV_TEST_IO_BACKEND_MEMORY_DEVICE_SIZE	4096
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+typedef struct smdev_test_io_backend_memory_device smdev_test_io_backend_memory_device_t;
+
+struct smdev_test_io_backend_memory_device
+{
+	/* The data
+	 */
+	uint8_t data[ SMDEV_TEST_IO_BACKEND_MEMORY_DEVICE_SIZE ];
+
+	/* The current offset
+	 */
+	off64_t offset;
+
+	/* Value to indicate the device is open
+	 */
+	int is_open;
+
+	/* The number of read calls
+	 */
+	int number_of_reads;
+};
+
+/* Opens the memory device
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_io_backend_memory_device_open(
+     smdev_test_io_backend_memory_device_t *memory_device,
+     const char *filename SMDEV_TEST_ATTRIBUTE_UNUSED,
+     int access_flags SMDEV_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error SMDEV_TEST_ATTRIBUTE_UNUSED )
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( filename )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( access_flags )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( memory_device == NULL )
+	{
+		return( -1 );
+	}
+	memory_device->offset  = 0;
+	memory_device->is_open = 1;
+
+	return( 1 );
+}
+
+/* Closes the memory device
+ * Returns 0 if successful or -1 on error
+ */
+int smdev_test_io_backend_memory_device_close(
+     smdev_test_io_backend_memory_device_t *memory_device,
+     libcerror_error_t **error SMDEV_TEST_ATTRIBUTE_UNUSED )
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( memory_device == NULL )
+	{
+		return( -1 );
+	}
+	memory_device->is_open = 0;
+
+	return( 0 );
+}
+
+/* Reads a buffer from the memory device
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t smdev_test_io_backend_memory_device_read(
+         smdev_test_io_backend_memory_device_t *memory_device,
+         uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error SMDEV_TEST_ATTRIBUTE_UNUSED )
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( memory_device == NULL )
+	 || ( buffer == NULL )
+	 || ( error_code == NULL ) )
+	{
+		return( -1 );
+	}
+	memory_device->number_of_reads += 1;
+
+	if( memory_device->offset >= (off64_t) SMDEV_TEST_IO_BACKEND_MEMORY_DEVICE_SIZE )
+	{
+		return( 0 );
+	}
+	if( size > (size_t) ( SMDEV_TEST_IO_BACKEND_MEMORY_DEVICE_SIZE - memory_device->offset ) )
+	{
+		size = (size_t) ( SMDEV_TEST_IO_BACKEND_MEMORY_DEVICE_SIZE - memory_device->offset );
+	}
+	if( memory_copy(
+	     buffer,
+	     &( memory_device->data[ memory_device->offset ] ),
+	     size ) == NULL )
+	{
+		return( -1 );
+	}
+	memory_device->offset += (off64_t) size;
+
+	return( (ssize_t) size );
+}
+
+/* Seeks a certain offset in the memory device
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t smdev_test_io_backend_memory_device_seek_offset(
+         smdev_test_io_backend_memory_device_t *memory_device,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error SMDEV_TEST_ATTRIBUTE_UNUSED )
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( memory_device == NULL )
+	{
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += memory_device->offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) SMDEV_TEST_IO_BACKEND_MEMORY_DEVICE_SIZE;
+	}
+	if( offset < 0 )
+	{
+		return( -1 );
+	}
+	memory_device->offset = offset;
+
+	return( offset );
+}
+
+/* Retrieves the size of the memory device
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_io_backend_memory_device_get_size(
+     smdev_test_io_backend_memory_device_t *memory_device,
+     size64_t *size,
+     libcerror_error_t **error SMDEV_TEST_ATTRIBUTE_UNUSED )
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( memory_device == NULL )
+	 || ( size == NULL ) )
+	{
+		return( -1 );
+	}
+	*size = (size64_t) SMDEV_TEST_IO_BACKEND_MEMORY_DEVICE_SIZE;
+
+	return( 1 );
+}
+
+/* Creates an IO backend for the memory device
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_io_backend_initialize_memory_device(
+     libsmdev_io_backend_t **io_backend,
+     smdev_test_io_backend_memory_device_t *memory_device,
+     libcerror_error_t **error )
+{
+	if( libsmdev_io_backend_initialize(
+	     io_backend,
+	     LIBSMDEV_IO_BACKEND_TYPE_UNDEFINED,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	( *io_backend )->io_handle   = (intptr_t *) memory_device;
+	( *io_backend )->open        = (int (*)(intptr_t *, const char *, int, libcerror_error_t **)) &smdev_test_io_backend_memory_device_open;
+	( *io_backend )->close       = (int (*)(intptr_t *, libcerror_error_t **)) &smdev_test_io_backend_memory_device_close;
+	( *io_backend )->read        = (ssize_t (*)(intptr_t *, uint8_t *, size_t, uint32_t *, libcerror_error_t **)) &smdev_test_io_backend_memory_device_read;
+	( *io_backend )->seek_offset = (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) &smdev_test_io_backend_memory_device_seek_offset;
+	( *io_backend )->get_size    = (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) &smdev_test_io_backend_memory_device_get_size;
+
+	return( 1 );
+}
+
+/* Tests the libsmdev_io_backend_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_io_backend_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libsmdev_io_backend_t *io_backend = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_SMDEV_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmdev_io_backend_initialize(
+	          &io_backend,
+	          LIBSMDEV_IO_BACKEND_TYPE_UNDEFINED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "io_backend",
+	 io_backend );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_backend_free(
+	          &io_backend,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "io_backend",
+	 io_backend );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_io_backend_initialize(
+	          NULL,
+	          LIBSMDEV_IO_BACKEND_TYPE_UNDEFINED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_backend = (libsmdev_io_backend_t *) 0x12345678UL;
+
+	result = libsmdev_io_backend_initialize(
+	          &io_backend,
+	          LIBSMDEV_IO_BACKEND_TYPE_UNDEFINED,
+	          &error );
+
+	io_backend = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMDEV_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmdev_io_backend_initialize with malloc failing
+		 */
+		smdev_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmdev_io_backend_initialize(
+		          &io_backend,
+		          LIBSMDEV_IO_BACKEND_TYPE_UNDEFINED,
+		          &error );
+
+		if( smdev_test_malloc_attempts_before_fail != -1 )
+		{
+			smdev_test_malloc_attempts_before_fail = -1;
+
+			if( io_backend != NULL )
+			{
+				libsmdev_io_backend_free(
+				 &io_backend,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMDEV_TEST_ASSERT_IS_NULL(
+			 "io_backend",
+			 io_backend );
+
+			SMDEV_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmdev_io_backend_initialize with memset failing
+		 */
+		smdev_test_memset_attempts_before_fail = test_number;
+
+		result = libsmdev_io_backend_initialize(
+		          &io_backend,
+		          LIBSMDEV_IO_BACKEND_TYPE_UNDEFINED,
+		          &error );
+
+		if( smdev_test_memset_attempts_before_fail != -1 )
+		{
+			smdev_test_memset_attempts_before_fail = -1;
+
+			if( io_backend != NULL )
+			{
+				libsmdev_io_backend_free(
+				 &io_backend,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMDEV_TEST_ASSERT_IS_NULL(
+			 "io_backend",
+			 io_backend );
+
+			SMDEV_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMDEV_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_backend != NULL )
+	{
+		libsmdev_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_io_backend_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_io_backend_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmdev_io_backend_free(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_io_backend_initialize_by_type function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_io_backend_initialize_by_type(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libcfile_file_t *device_file      = NULL;
+	libsmdev_io_backend_t *io_backend = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_io_backend_initialize_by_type(
+	          &io_backend,
+	          LIBSMDEV_IO_BACKEND_TYPE_FILE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "io_backend",
+	 io_backend );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "io_backend->type",
+	 io_backend->type,
+	 LIBSMDEV_IO_BACKEND_TYPE_FILE );
+
+	result = libsmdev_io_backend_get_device_file(
+	          io_backend,
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "device_file",
+	 device_file );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_backend_free(
+	          &io_backend,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_io_backend_initialize_by_type(
+	          &io_backend,
+	          LIBSMDEV_IO_BACKEND_TYPE_UNDEFINED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "io_backend",
+	 io_backend );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_backend != NULL )
+	{
+		libsmdev_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_io_backend_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_io_backend_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 512 ];
+
+	smdev_test_io_backend_memory_device_t memory_device;
+
+	libcerror_error_t *error          = NULL;
+	libcfile_file_t *device_file      = NULL;
+	libsmdev_io_backend_t *io_backend = NULL;
+	ssize_t read_count                = 0;
+	size_t data_index                 = 0;
+	uint32_t error_code               = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &memory_device,
+	          0,
+	          sizeof( smdev_test_io_backend_memory_device_t ) ) != NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( data_index = 0;
+	     data_index < SMDEV_TEST_IO_BACKEND_MEMORY_DEVICE_SIZE;
+	     data_index++ )
+	{
+		memory_device.data[ data_index ] = (uint8_t) ( data_index / 7 );
+	}
+	result = smdev_test_io_backend_initialize_memory_device(
+	          &io_backend,
+	          &memory_device,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libsmdev_io_backend_read_buffer_at_offset(
+	              io_backend,
+	              buffer,
+	              512,
+	              1024,
+	              &error_code,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( memory_device.data[ 1024 ] ),
+	          512 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a read at offset past the end of the device
+	 */
+	read_count = libsmdev_io_backend_read_buffer_at_offset(
+	              io_backend,
+	              buffer,
+	              512,
+	              SMDEV_TEST_IO_BACKEND_MEMORY_DEVICE_SIZE,
+	              &error_code,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an IO backend other than the file IO backend has no device file
+	 */
+	result = libsmdev_io_backend_get_device_file(
+	          io_backend,
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an unsupported function is reported as an error
+	 */
+	read_count = libsmdev_io_backend_write_buffer(
+	              io_backend,
+	              buffer,
+	              512,
+	              &error_code,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	read_count = libsmdev_io_backend_read_buffer_at_offset(
+	              NULL,
+	              buffer,
+	              512,
+	              0,
+	              &error_code,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libsmdev_io_backend_read_buffer_at_offset(
+	              io_backend,
+	              buffer,
+	              512,
+	              -1,
+	              &error_code,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_io_backend_free(
+	          &io_backend,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_backend != NULL )
+	{
+		libsmdev_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_internal_handle_open_io_backend function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_io_backend_handle_open(
+     void )
+{
+	uint8_t buffer[ 512 ];
+
+	smdev_test_io_backend_memory_device_t memory_device;
+
+	libcerror_error_t *error          = NULL;
+	libsmdev_handle_t *handle         = NULL;
+	libsmdev_io_backend_t *io_backend = NULL;
+	size64_t media_size               = 0;
+	ssize_t read_count                = 0;
+	size_t data_index                 = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = memory_set(
+	          &memory_device,
+	          0,
+	          sizeof( smdev_test_io_backend_memory_device_t ) ) != NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	for( data_index = 0;
+	     data_index < SMDEV_TEST_IO_BACKEND_MEMORY_DEVICE_SIZE;
+	     data_index++ )
+	{
+		memory_device.data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	result = smdev_test_io_backend_initialize_memory_device(
+	          &io_backend,
+	          &memory_device,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_backend_open(
+	          io_backend,
+	          "memory",
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_internal_handle_open_io_backend(
+	          (libsmdev_internal_handle_t *) handle,
+	          io_backend,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The handle now manages the IO backend
+	 */
+	io_backend = NULL;
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "device_file",
+	 ( (libsmdev_internal_handle_t *) handle )->device_file );
+
+	result = libsmdev_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "media_size",
+	 (uint64_t) media_size,
+	 (uint64_t) SMDEV_TEST_IO_BACKEND_MEMORY_DEVICE_SIZE );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libsmdev_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              512,
+	              2048,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( memory_device.data[ 2048 ] ),
+	          512 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The IO backend type cannot be changed while the handle is open
+	 */
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_FILE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "memory_device.is_open",
+	 memory_device.is_open,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_internal_handle_open_io_backend(
+	          NULL,
+	          io_backend,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_internal_handle_open_io_backend(
+	          (libsmdev_internal_handle_t *) handle,
+	          NULL,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( io_backend != NULL )
+	{
+		libsmdev_io_backend_free(
+		 &io_backend,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_io_backend_initialize",
+	 smdev_test_io_backend_initialize );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_io_backend_free",
+	 smdev_test_io_backend_free );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_io_backend_initialize_by_type",
+	 smdev_test_io_backend_initialize_by_type );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_io_backend_read_buffer_at_offset",
+	 smdev_test_io_backend_read_buffer_at_offset );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_internal_handle_open_io_backend",
+	 smdev_test_io_backend_handle_open );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2701 @@
+/*
+ * Library IO control functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_IOCTL_H )
+#include <sys/ioctl.h>
+#endif
+
+#if defined( HAVE_LINUX_CDROM_H )
+#include <linux/cdrom.h>
+#endif
+
+#if defined( HAVE_LINUX_FS_H )
+#include <linux/fs.h>
+#endif
+
+#if defined( HAVE_SCSI_SG_H )
+#include <scsi/sg.h>
+#include <time.h>
+#endif
+
+#include "smdev_test_functions.h"
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libcfile.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_handle.h"
+#include "../libsmdev/libsmdev_io_control.h"
+#include "../libsmdev/libsmdev_optical_disc.h"
+#include "../libsmdev/libsmdev_scsi.h"
+#include "../libsmdev/libsmdev_table_of_contents.h"
+
+#define SMDEV_TEST_IO_CONTROL_PROBE_BENCHMARK_ITERATIONS	10
+#define SMDEV_TEST_IO_CONTROL_PROBE_BENCHMARK_LATENCY		1000
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+/* The path of the IO control fixture file
+ */
+char smdev_test_io_control_fixture_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* Tests the libsmdev_io_control_entry_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_io_control_entry_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libsmdev_io_control_entry_t *entry = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_SMDEV_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmdev_io_control_entry_initialize(
+	          &entry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "entry",
+	 entry );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_entry_free(
+	          &entry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "entry",
+	 entry );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_io_control_entry_initialize(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	entry = (libsmdev_io_control_entry_t *) 0x12345678UL;
+
+	result = libsmdev_io_control_entry_initialize(
+	          &entry,
+	          &error );
+
+	entry = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMDEV_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmdev_io_control_entry_initialize with malloc failing
+		 */
+		smdev_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmdev_io_control_entry_initialize(
+		          &entry,
+		          &error );
+
+		if( smdev_test_malloc_attempts_before_fail != -1 )
+		{
+			smdev_test_malloc_attempts_before_fail = -1;
+
+			if( entry != NULL )
+			{
+				libsmdev_io_control_entry_free(
+				 &entry,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMDEV_TEST_ASSERT_IS_NULL(
+			 "entry",
+			 entry );
+
+			SMDEV_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmdev_io_control_entry_initialize with memset failing
+		 */
+		smdev_test_memset_attempts_before_fail = test_number;
+
+		result = libsmdev_io_control_entry_initialize(
+		          &entry,
+		          &error );
+
+		if( smdev_test_memset_attempts_before_fail != -1 )
+		{
+			smdev_test_memset_attempts_before_fail = -1;
+
+			if( entry != NULL )
+			{
+				libsmdev_io_control_entry_free(
+				 &entry,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMDEV_TEST_ASSERT_IS_NULL(
+			 "entry",
+			 entry );
+
+			SMDEV_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMDEV_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entry != NULL )
+	{
+		libsmdev_io_control_entry_free(
+		 &entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_io_control_entry_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_io_control_entry_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmdev_io_control_entry_free(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_io_control_fixture_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_io_control_fixture_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libsmdev_io_control_fixture_t *fixture = NULL;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_io_control_fixture_initialize(
+	          &fixture,
+	          LIBSMDEV_IO_CONTROL_FIXTURE_MODE_REPLAY,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "fixture",
+	 fixture );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_fixture_free(
+	          &fixture,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "fixture",
+	 fixture );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_io_control_fixture_initialize(
+	          NULL,
+	          LIBSMDEV_IO_CONTROL_FIXTURE_MODE_REPLAY,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	fixture = (libsmdev_io_control_fixture_t *) 0x12345678UL;
+
+	result = libsmdev_io_control_fixture_initialize(
+	          &fixture,
+	          LIBSMDEV_IO_CONTROL_FIXTURE_MODE_REPLAY,
+	          &error );
+
+	fixture = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_io_control_fixture_initialize(
+	          &fixture,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "fixture",
+	 fixture );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( fixture != NULL )
+	{
+		libsmdev_io_control_fixture_free(
+		 &fixture,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_io_control_fixture_write_entry, libsmdev_io_control_fixture_read_entries
+ * and libsmdev_io_control_fixture_get_entry functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_io_control_fixture_get_entry(
+     void )
+{
+	uint8_t data1[ 4 ]                     = { 0xaa, 0xaa, 0xaa, 0xaa };
+	uint8_t data2[ 4 ]                     = { 0xbb, 0xbb, 0xbb, 0xbb };
+	uint8_t key1[ 4 ]                      = { 1, 0, 0, 0 };
+	uint8_t key2[ 4 ]                      = { 2, 0, 0, 0 };
+	uint8_t key3[ 4 ]                      = { 3, 0, 0, 0 };
+
+	libcerror_error_t *error               = NULL;
+	libsmdev_io_control_entry_t *entry     = NULL;
+	libsmdev_io_control_fixture_t *fixture = NULL;
+	FILE *file_stream                      = NULL;
+	size_t write_count                     = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_io_control_fixture_initialize(
+	          &fixture,
+	          LIBSMDEV_IO_CONTROL_FIXTURE_MODE_RECORD,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "fixture",
+	 fixture );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fixture->file_stream = file_stream_open(
+	                        smdev_test_io_control_fixture_path,
+	                        FILE_STREAM_BINARY_OPEN_WRITE );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "fixture->file_stream",
+	 fixture->file_stream );
+
+	write_count = file_stream_write(
+	               fixture->file_stream,
+	               LIBSMDEV_IO_CONTROL_FIXTURE_SIGNATURE,
+	               8 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "write_count",
+	 write_count,
+	 (size_t) 8 );
+
+	/* Test write entry
+	 */
+	result = libsmdev_io_control_fixture_write_entry(
+	          fixture,
+	          0x1234,
+	          4,
+	          key1,
+	          4,
+	          data1,
+	          4,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_fixture_write_entry(
+	          fixture,
+	          0x1234,
+	          4,
+	          key1,
+	          4,
+	          data2,
+	          4,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_fixture_write_entry(
+	          fixture,
+	          0x1234,
+	          -1,
+	          key2,
+	          4,
+	          NULL,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_io_control_fixture_write_entry(
+	          NULL,
+	          0x1234,
+	          4,
+	          key1,
+	          4,
+	          data1,
+	          4,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_io_control_fixture_write_entry(
+	          fixture,
+	          0x1234,
+	          4,
+	          key1,
+	          4,
+	          NULL,
+	          4,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_io_control_fixture_free(
+	          &fixture,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read entries
+	 */
+	result = libsmdev_io_control_fixture_initialize(
+	          &fixture,
+	          LIBSMDEV_IO_CONTROL_FIXTURE_MODE_REPLAY,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_stream = file_stream_open(
+	               smdev_test_io_control_fixture_path,
+	               FILE_STREAM_BINARY_OPEN_READ );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	result = libsmdev_io_control_fixture_read_entries(
+	          fixture,
+	          file_stream,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_stream_close(
+	 file_stream );
+
+	file_stream = NULL;
+
+	/* Test get entry, repeated requests are returned in recorded order
+	 */
+	result = libsmdev_io_control_fixture_get_entry(
+	          fixture,
+	          0x1234,
+	          key1,
+	          4,
+	          &entry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "entry",
+	 entry );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "entry->result",
+	 (int) entry->result,
+	 4 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "entry->data_size",
+	 entry->data_size,
+	 (size_t) 4 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "entry->data[ 0 ]",
+	 entry->data[ 0 ],
+	 0xaa );
+
+	result = libsmdev_io_control_fixture_get_entry(
+	          fixture,
+	          0x1234,
+	          key1,
+	          4,
+	          &entry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "entry->data[ 0 ]",
+	 entry->data[ 0 ],
+	 0xbb );
+
+	result = libsmdev_io_control_fixture_get_entry(
+	          fixture,
+	          0x1234,
+	          key1,
+	          4,
+	          &entry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "entry->data[ 0 ]",
+	 entry->data[ 0 ],
+	 0xaa );
+
+	result = libsmdev_io_control_fixture_get_entry(
+	          fixture,
+	          0x1234,
+	          key2,
+	          4,
+	          &entry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "entry->result",
+	 (int) entry->result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "entry->data_size",
+	 entry->data_size,
+	 (size_t) 0 );
+
+	result = libsmdev_io_control_fixture_get_entry(
+	          fixture,
+	          0x1234,
+	          key3,
+	          4,
+	          &entry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_fixture_get_entry(
+	          fixture,
+	          0x5678,
+	          key1,
+	          4,
+	          &entry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_io_control_fixture_get_entry(
+	          NULL,
+	          0x1234,
+	          key1,
+	          4,
+	          &entry,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_io_control_fixture_get_entry(
+	          fixture,
+	          0x1234,
+	          key1,
+	          4,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_io_control_fixture_free(
+	          &fixture,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "fixture",
+	 fixture );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_io_control_fixture_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( fixture != NULL )
+	{
+		libsmdev_io_control_fixture_free(
+		 &fixture,
+		 NULL );
+	}
+	remove(
+	 smdev_test_io_control_fixture_path );
+
+	return( 0 );
+}
+
+#if defined( HAVE_LINUX_FS_H ) && defined( BLKGETSIZE64 )
+
+/* Retrieves the path of a file in the test data directory
+ * The directory is read from the SMDEV_TEST_DATA_DIRECTORY environment variable
+ * and defaults to "data"
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_io_control_get_data_path(
+     const char *filename,
+     char *path,
+     size_t path_size )
+{
+	const char *directory = NULL;
+	int print_count       = 0;
+
+	directory = getenv(
+	             "SMDEV_TEST_DATA_DIRECTORY" );
+
+	if( directory == NULL )
+	{
+		directory = "data";
+	}
+	print_count = narrow_string_snprintf(
+	               path,
+	               path_size,
+	               "%s/%s",
+	               directory,
+	               filename );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= path_size ) )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests replaying the IO control requests recorded from a loop block device
+ * The fixture was recorded with LIBSMDEV_IO_CONTROL_RECORD set while opening
+ * a 1 MiB loop device, which does not support SCSI generic (SG) IO
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_io_control_replay_block_device(
+     void )
+{
+	char fixture_path[ 256 ];
+
+#if defined( HAVE_SCSI_SG_H )
+	uint8_t response[ 0x60 ];
+#endif
+
+	libcerror_error_t *error     = NULL;
+	libcfile_file_t *device_file = NULL;
+	uint64_t media_size          = 0;
+	ssize_t read_count           = 0;
+	uint32_t value_32bit         = 0;
+	uint16_t value_16bit         = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = smdev_test_io_control_get_data_path(
+	          "loop_device.fixture",
+	          fixture_path,
+	          256 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_io_control_replay_open(
+	          fixture_path,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The device is not accessed during replay, hence the fixture itself
+	 * is used as device file
+	 */
+	result = libcfile_file_initialize(
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_open(
+	          device_file,
+	          fixture_path,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that recording is not started while replaying
+	 */
+	result = libsmdev_io_control_record_open_from_environment(
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test replay of the block device requests
+	 */
+	read_count = libsmdev_io_control_read(
+	              device_file,
+	              BLKGETSIZE64,
+	              (uint8_t *) &media_size,
+	              sizeof( uint64_t ),
+	              &error );
+
+	SMDEV_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "media_size",
+	 media_size,
+	 (uint64_t) 1048576 );
+
+	read_count = libsmdev_io_control_read(
+	              device_file,
+	              BLKSSZGET,
+	              (uint8_t *) &value_32bit,
+	              sizeof( uint32_t ),
+	              &error );
+
+	SMDEV_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 512 );
+
+#if defined( BLKPBSZGET )
+	value_32bit = 0;
+
+	read_count = libsmdev_io_control_read(
+	              device_file,
+	              BLKPBSZGET,
+	              (uint8_t *) &value_32bit,
+	              sizeof( uint32_t ),
+	              &error );
+
+	SMDEV_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "value_32bit",
+	 value_32bit,
+	 (uint32_t) 512 );
+
+#endif /* defined( BLKPBSZGET ) */
+
+	read_count = libsmdev_io_control_read(
+	              device_file,
+	              BLKSECTGET,
+	              (uint8_t *) &value_16bit,
+	              sizeof( uint16_t ),
+	              &error );
+
+	SMDEV_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "value_16bit",
+	 value_16bit,
+	 (uint16_t) 2560 );
+
+#if defined( HAVE_SCSI_SG_H )
+	/* Test replay of a SCSI command that failed on the device
+	 */
+	read_count = libsmdev_scsi_inquiry(
+	              device_file,
+	              0x01,
+	              0xb0,
+	              response,
+	              0x60,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#endif /* defined( HAVE_SCSI_SG_H ) */
+
+	/* Test replay of a request with request data that was not recorded
+	 */
+	value_32bit = 1;
+
+	read_count = libsmdev_io_control_read(
+	              device_file,
+	              BLKSSZGET,
+	              (uint8_t *) &value_32bit,
+	              sizeof( uint32_t ),
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_close(
+	          device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_free(
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_close(
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_io_control_record_open(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_io_control_replay_open(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_io_control_set_replay_latency(
+	          1000,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( device_file != NULL )
+	{
+		libcfile_file_free(
+		 &device_file,
+		 NULL );
+	}
+	libsmdev_io_control_close(
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LINUX_FS_H ) && defined( BLKGETSIZE64 ) */
+
+#if defined( HAVE_LINUX_CDROM_H )
+
+/* Tests replaying the table of contents of a single data track optical disc
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_io_control_replay_table_of_contents(
+     void )
+{
+	struct cdrom_tochdr toc_header;
+	struct cdrom_tochdr toc_header_key;
+	struct cdrom_tocentry toc_entry_key;
+	struct cdrom_tocentry toc_entry;
+
+	libcerror_error_t *error               = NULL;
+	libcfile_file_t *device_file           = NULL;
+	libsmdev_handle_t *handle              = NULL;
+	libsmdev_io_control_fixture_t *fixture = NULL;
+	uint64_t number_of_sectors             = 0;
+	uint64_t start_sector                  = 0;
+	size_t write_count                     = 0;
+	int number_of_sessions                 = 0;
+	int number_of_tracks                   = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_io_control_fixture_initialize(
+	          &fixture,
+	          LIBSMDEV_IO_CONTROL_FIXTURE_MODE_RECORD,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fixture->file_stream = file_stream_open(
+	                        smdev_test_io_control_fixture_path,
+	                        FILE_STREAM_BINARY_OPEN_WRITE );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "fixture->file_stream",
+	 fixture->file_stream );
+
+	write_count = file_stream_write(
+	               fixture->file_stream,
+	               LIBSMDEV_IO_CONTROL_FIXTURE_SIGNATURE,
+	               8 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "write_count",
+	 write_count,
+	 (size_t) 8 );
+
+	/* The TOC header with a single track
+	 */
+	memory_set(
+	 &toc_header,
+	 0,
+	 sizeof( struct cdrom_tochdr ) );
+
+	toc_header.cdth_trk0 = 1;
+	toc_header.cdth_trk1 = 1;
+
+	memory_set(
+	 &toc_header_key,
+	 0,
+	 sizeof( struct cdrom_tochdr ) );
+
+	result = libsmdev_io_control_fixture_write_entry(
+	          fixture,
+	          CDROMREADTOCHDR,
+	          0,
+	          (uint8_t *) &toc_header_key,
+	          sizeof( struct cdrom_tochdr ),
+	          (uint8_t *) &toc_header,
+	          sizeof( struct cdrom_tochdr ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The TOC entry of the data track
+	 */
+	memory_set(
+	 &toc_entry_key,
+	 0,
+	 sizeof( struct cdrom_tocentry ) );
+
+	toc_entry_key.cdte_track  = 1;
+	toc_entry_key.cdte_format = CDROM_LBA;
+
+	memory_copy(
+	 &toc_entry,
+	 &toc_entry_key,
+	 sizeof( struct cdrom_tocentry ) );
+
+	toc_entry.cdte_ctrl     = CDROM_DATA_TRACK;
+	toc_entry.cdte_addr.lba = 0;
+
+	result = libsmdev_io_control_fixture_write_entry(
+	          fixture,
+	          CDROMREADTOCENTRY,
+	          0,
+	          (uint8_t *) &toc_entry_key,
+	          sizeof( struct cdrom_tocentry ),
+	          (uint8_t *) &toc_entry,
+	          sizeof( struct cdrom_tocentry ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The TOC entry of the lead-out
+	 */
+	toc_entry_key.cdte_track = CDROM_LEADOUT;
+
+	memory_copy(
+	 &toc_entry,
+	 &toc_entry_key,
+	 sizeof( struct cdrom_tocentry ) );
+
+	toc_entry.cdte_ctrl     = CDROM_DATA_TRACK;
+	toc_entry.cdte_addr.lba = 1000;
+
+	result = libsmdev_io_control_fixture_write_entry(
+	          fixture,
+	          CDROMREADTOCENTRY,
+	          0,
+	          (uint8_t *) &toc_entry_key,
+	          sizeof( struct cdrom_tocentry ),
+	          (uint8_t *) &toc_entry,
+	          sizeof( struct cdrom_tocentry ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_fixture_free(
+	          &fixture,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_initialize(
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The fixture itself is used as the regular file the requests are replayed against
+	 */
+	result = libcfile_file_open(
+	          device_file,
+	          smdev_test_io_control_fixture_path,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_io_control_replay_open(
+	          smdev_test_io_control_fixture_path,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_optical_disc_get_table_of_contents_ioctl(
+	          device_file,
+	          (libsmdev_internal_handle_t *) handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_close(
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_number_of_sessions(
+	          handle,
+	          &number_of_sessions,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sessions",
+	 number_of_sessions,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_number_of_tracks(
+	          handle,
+	          &number_of_tracks,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_tracks",
+	 number_of_tracks,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_session(
+	          handle,
+	          0,
+	          &start_sector,
+	          &number_of_sectors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 1000 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_close(
+	          device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_free(
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_io_control_fixture_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libsmdev_io_control_close(
+	 NULL );
+
+	if( fixture != NULL )
+	{
+		libsmdev_io_control_fixture_free(
+		 &fixture,
+		 NULL );
+	}
+	if( device_file != NULL )
+	{
+		libcfile_file_free(
+		 &device_file,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_io_control_fixture_path );
+
+	return( 0 );
+}
+
+#if defined( HAVE_SCSI_SG_H )
+
+/* Writes a SCSI command and its response as a SG IO fixture entry
+ * The entry is replayed as a successful command without sense data
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_io_control_write_scsi_entry(
+     libsmdev_io_control_fixture_t *fixture,
+     const uint8_t *command,
+     size_t command_size,
+     const uint8_t *response,
+     size_t response_size,
+     libcerror_error_t **error )
+{
+	uint8_t key[ 9 + 16 ];
+
+	uint8_t *entry_data    = NULL;
+	size_t entry_data_size = 0;
+	int result             = 0;
+
+	if( ( command_size > 16 )
+	 || ( response_size > (size_t) UINT32_MAX ) )
+	{
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( key[ 0 ] ),
+	 (uint32_t) response_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( key[ 4 ] ),
+	 (uint32_t) SG_DXFER_FROM_DEV );
+
+	key[ 8 ] = LIBSMDEV_SCSI_SENSE_SIZE;
+
+	memory_copy(
+	 &( key[ 9 ] ),
+	 command,
+	 command_size );
+
+	entry_data_size = LIBSMDEV_IO_CONTROL_SG_IO_STATUS_SIZE + LIBSMDEV_SCSI_SENSE_SIZE + response_size;
+
+	entry_data = (uint8_t *) memory_allocate(
+	                          entry_data_size );
+
+	if( entry_data == NULL )
+	{
+		return( -1 );
+	}
+	memory_set(
+	 entry_data,
+	 0,
+	 entry_data_size );
+
+	memory_copy(
+	 &( entry_data[ LIBSMDEV_IO_CONTROL_SG_IO_STATUS_SIZE + LIBSMDEV_SCSI_SENSE_SIZE ] ),
+	 response,
+	 response_size );
+
+	result = libsmdev_io_control_fixture_write_entry(
+	          fixture,
+	          SG_IO,
+	          0,
+	          key,
+	          9 + command_size,
+	          entry_data,
+	          entry_data_size,
+	          error );
+
+	memory_free(
+	 entry_data );
+
+	return( result );
+}
+
+/* Copies a LBA to a raw TOC MSF address
+ */
+void smdev_test_io_control_copy_lba_to_msf(
+      uint8_t *msf,
+      uint32_t lba )
+{
+	msf[ 0 ] = (uint8_t) ( lba / ( CD_SECS * CD_FRAMES ) );
+	msf[ 1 ] = (uint8_t) ( ( lba / CD_FRAMES ) % CD_SECS );
+	msf[ 2 ] = (uint8_t) ( lba % CD_FRAMES );
+}
+
+/* Writes the SCSI responses of a multi-session optical disc to an IO control fixture
+ * Every track is 1000 sectors, odd tracks are mode 1 data tracks and even tracks are audio tracks
+ * The next session starts 11400 sectors after the lead-out of the previous session
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_io_control_write_raw_toc_fixture(
+     const char *path,
+     uint8_t number_of_sessions,
+     uint8_t number_of_tracks_per_session,
+     libcerror_error_t **error )
+{
+	libsmdev_scsi_read_toc_cdb_t toc_command;
+	libsmdev_scsi_read_track_information_cdb_t track_information_command;
+	uint8_t track_information[ LIBSMDEV_OPTICAL_DISC_TRACK_INFORMATION_DATA_SIZE ];
+
+	libsmdev_io_control_fixture_t *fixture = NULL;
+	uint8_t *toc_data                      = NULL;
+	size_t toc_data_offset                 = 0;
+	size_t write_count                     = 0;
+	uint32_t lead_out_offset               = 0;
+	uint32_t track_offset                  = 0;
+	uint8_t session_number                 = 0;
+	uint8_t track_number                   = 0;
+	uint8_t track_index                    = 0;
+	int result                             = -1;
+
+	toc_data = (uint8_t *) memory_allocate(
+	                        LIBSMDEV_OPTICAL_DISC_RAW_TOC_DATA_SIZE );
+
+	if( toc_data == NULL )
+	{
+		goto on_error;
+	}
+	memory_set(
+	 toc_data,
+	 0,
+	 LIBSMDEV_OPTICAL_DISC_RAW_TOC_DATA_SIZE );
+
+	if( libsmdev_io_control_fixture_initialize(
+	     &fixture,
+	     LIBSMDEV_IO_CONTROL_FIXTURE_MODE_RECORD,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	fixture->file_stream = file_stream_open(
+	                        path,
+	                        FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( fixture->file_stream == NULL )
+	{
+		goto on_error;
+	}
+	write_count = file_stream_write(
+	               fixture->file_stream,
+	               LIBSMDEV_IO_CONTROL_FIXTURE_SIGNATURE,
+	               8 );
+
+	if( write_count != 8 )
+	{
+		goto on_error;
+	}
+	toc_data[ 2 ]   = 1;
+	toc_data[ 3 ]   = number_of_sessions;
+	toc_data_offset = 4;
+
+	memory_set(
+	 &track_information_command,
+	 0,
+	 sizeof( libsmdev_scsi_read_track_information_cdb_t ) );
+
+	track_information_command.operation_code = LIBSMDEV_SCSI_OPERATION_CODE_READ_TRACK_INFORMATION;
+	track_information_command.address_type   = LIBSMDEV_SCSI_TRACK_INFORMATION_ADDRESS_TYPE_LBA;
+
+	byte_stream_copy_from_uint16_big_endian(
+	 track_information_command.receive_size,
+	 LIBSMDEV_OPTICAL_DISC_TRACK_INFORMATION_DATA_SIZE );
+
+	for( session_number = 1;
+	     session_number <= number_of_sessions;
+	     session_number++ )
+	{
+		lead_out_offset = track_offset + ( (uint32_t) number_of_tracks_per_session * 1000 );
+
+		/* The A0, A1 and A2 points contain the first and last track number and the lead-out
+		 */
+		toc_data[ toc_data_offset ]      = session_number;
+		toc_data[ toc_data_offset + 1 ]  = 0x14;
+		toc_data[ toc_data_offset + 3 ]  = 0xa0;
+		toc_data[ toc_data_offset + 8 ]  = track_number + 1;
+		toc_data[ toc_data_offset + 11 ] = session_number;
+		toc_data[ toc_data_offset + 12 ] = 0x14;
+		toc_data[ toc_data_offset + 14 ] = 0xa1;
+		toc_data[ toc_data_offset + 19 ] = track_number + number_of_tracks_per_session;
+		toc_data[ toc_data_offset + 22 ] = session_number;
+		toc_data[ toc_data_offset + 23 ] = 0x14;
+		toc_data[ toc_data_offset + 25 ] = 0xa2;
+
+		smdev_test_io_control_copy_lba_to_msf(
+		 &( toc_data[ toc_data_offset + 30 ] ),
+		 lead_out_offset + CD_MSF_OFFSET );
+
+		toc_data_offset += 33;
+
+		for( track_index = 0;
+		     track_index < number_of_tracks_per_session;
+		     track_index++ )
+		{
+			track_number++;
+
+			toc_data[ toc_data_offset ]     = session_number;
+			toc_data[ toc_data_offset + 1 ] = 0x10;
+			toc_data[ toc_data_offset + 3 ] = track_number;
+
+			if( ( track_number % 2 ) != 0 )
+			{
+				toc_data[ toc_data_offset + 1 ] |= 0x04;
+			}
+			smdev_test_io_control_copy_lba_to_msf(
+			 &( toc_data[ toc_data_offset + 8 ] ),
+			 track_offset + CD_MSF_OFFSET );
+
+			toc_data_offset += 11;
+
+			if( ( track_number % 2 ) != 0 )
+			{
+				memory_set(
+				 track_information,
+				 0,
+				 LIBSMDEV_OPTICAL_DISC_TRACK_INFORMATION_DATA_SIZE );
+
+				track_information[ 1 ] = 0x22;
+				track_information[ 2 ] = track_number;
+				track_information[ 3 ] = session_number;
+				track_information[ 5 ] = 0x04;
+				track_information[ 6 ] = 0x01;
+
+				byte_stream_copy_from_uint32_big_endian(
+				 track_information_command.offset,
+				 track_offset );
+
+				if( smdev_test_io_control_write_scsi_entry(
+				     fixture,
+				     (uint8_t *) &track_information_command,
+				     sizeof( libsmdev_scsi_read_track_information_cdb_t ),
+				     track_information,
+				     LIBSMDEV_OPTICAL_DISC_TRACK_INFORMATION_DATA_SIZE,
+				     error ) != 1 )
+				{
+					goto on_error;
+				}
+			}
+			track_offset += 1000;
+		}
+		/* The B0 point contains the start of the next session
+		 */
+		if( session_number < number_of_sessions )
+		{
+			track_offset = lead_out_offset + 11400;
+
+			toc_data[ toc_data_offset ]     = session_number;
+			toc_data[ toc_data_offset + 1 ] = 0x54;
+			toc_data[ toc_data_offset + 3 ] = 0xb0;
+
+			smdev_test_io_control_copy_lba_to_msf(
+			 &( toc_data[ toc_data_offset + 4 ] ),
+			 track_offset );
+
+			toc_data_offset += 11;
+		}
+	}
+	byte_stream_copy_from_uint16_big_endian(
+	 toc_data,
+	 (uint16_t) ( toc_data_offset - 2 ) );
+
+	memory_set(
+	 &toc_command,
+	 0,
+	 sizeof( libsmdev_scsi_read_toc_cdb_t ) );
+
+	toc_command.operation_code = LIBSMDEV_SCSI_OPERATION_CODE_READ_TOC;
+	toc_command.format         = LIBSMDEV_SCSI_TOC_CDB_FORMAT_RAW_TOC;
+
+	byte_stream_copy_from_uint16_big_endian(
+	 toc_command.receive_size,
+	 LIBSMDEV_OPTICAL_DISC_RAW_TOC_DATA_SIZE );
+
+	if( smdev_test_io_control_write_scsi_entry(
+	     fixture,
+	     (uint8_t *) &toc_command,
+	     sizeof( libsmdev_scsi_read_toc_cdb_t ),
+	     toc_data,
+	     LIBSMDEV_OPTICAL_DISC_RAW_TOC_DATA_SIZE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	result = 1;
+
+on_error:
+	if( fixture != NULL )
+	{
+		libsmdev_io_control_fixture_free(
+		 &fixture,
+		 NULL );
+	}
+	if( toc_data != NULL )
+	{
+		memory_free(
+		 toc_data );
+	}
+	return( result );
+}
+
+/* Retrieves a track of the table of contents and compares it with the expected values
+ * Returns 1 if the track matches or 0 if not
+ */
+int smdev_test_io_control_compare_track(
+     libsmdev_handle_t *handle,
+     int track_index,
+     uint64_t expected_start_sector,
+     uint64_t expected_number_of_sectors,
+     uint8_t expected_type )
+{
+	uint64_t number_of_sectors = 0;
+	uint64_t start_sector      = 0;
+	uint8_t type               = 0;
+
+	if( libsmdev_handle_get_track(
+	     handle,
+	     track_index,
+	     &start_sector,
+	     &number_of_sectors,
+	     &type,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( ( start_sector != expected_start_sector )
+	 || ( number_of_sectors != expected_number_of_sectors )
+	 || ( type != expected_type ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests replaying the raw table of contents of a multi-session optical disc
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_io_control_replay_raw_table_of_contents(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libcfile_file_t *device_file = NULL;
+	libsmdev_handle_t *handle    = NULL;
+	uint64_t number_of_sectors   = 0;
+	uint64_t start_sector        = 0;
+	int number_of_lead_outs      = 0;
+	int number_of_sessions       = 0;
+	int number_of_tracks         = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = smdev_test_io_control_write_raw_toc_fixture(
+	          smdev_test_io_control_fixture_path,
+	          2,
+	          3,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_initialize(
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_open(
+	          device_file,
+	          smdev_test_io_control_fixture_path,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_io_control_replay_open(
+	          smdev_test_io_control_fixture_path,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_optical_disc_get_table_of_contents_scsi(
+	          device_file,
+	          (libsmdev_internal_handle_t *) handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_close(
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_number_of_sessions(
+	          handle,
+	          &number_of_sessions,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sessions",
+	 number_of_sessions,
+	 2 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first session includes its lead-out and the lead-in of the second session
+	 */
+	result = libsmdev_handle_get_session(
+	          handle,
+	          0,
+	          &start_sector,
+	          &number_of_sectors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 14400 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_session(
+	          handle,
+	          1,
+	          &start_sector,
+	          &number_of_sectors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 14400 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 3000 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_table_of_contents_get_number_of_lead_outs(
+	          ( (libsmdev_internal_handle_t *) handle )->table_of_contents,
+	          &number_of_lead_outs,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_lead_outs",
+	 number_of_lead_outs,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_number_of_tracks(
+	          handle,
+	          &number_of_tracks,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_tracks",
+	 number_of_tracks,
+	 6 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The last track of a session ends at the lead-out of the session
+	 */
+	result = smdev_test_io_control_compare_track(
+	          handle,
+	          0,
+	          0,
+	          1000,
+	          LIBSMDEV_TRACK_TYPE_MODE1_2048 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = smdev_test_io_control_compare_track(
+	          handle,
+	          1,
+	          1000,
+	          1000,
+	          LIBSMDEV_TRACK_TYPE_AUDIO );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = smdev_test_io_control_compare_track(
+	          handle,
+	          2,
+	          2000,
+	          1000,
+	          LIBSMDEV_TRACK_TYPE_MODE1_2048 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = smdev_test_io_control_compare_track(
+	          handle,
+	          3,
+	          14400,
+	          1000,
+	          LIBSMDEV_TRACK_TYPE_AUDIO );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = smdev_test_io_control_compare_track(
+	          handle,
+	          5,
+	          16400,
+	          1000,
+	          LIBSMDEV_TRACK_TYPE_AUDIO );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libcfile_file_close(
+	          device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_free(
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_io_control_fixture_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libsmdev_io_control_close(
+	 NULL );
+
+	if( device_file != NULL )
+	{
+		libcfile_file_free(
+		 &device_file,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_io_control_fixture_path );
+
+	return( 0 );
+}
+
+/* Benchmarks probing the table of contents of a 99 track optical disc using replayed SCSI responses
+ * The benchmark only runs if the SMDEV_TEST_PROBE_BENCHMARK environment variable is set,
+ * use tests/benchmark_probe.sh to run the benchmark
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_io_control_benchmark_probe(
+     void )
+{
+	struct timespec end_time;
+	struct timespec start_time;
+
+	libcerror_error_t *error     = NULL;
+	libcfile_file_t *device_file = NULL;
+	libsmdev_handle_t *handle    = NULL;
+	uint64_t elapsed_time        = 0;
+	int number_of_tracks         = 0;
+	int probe_index              = 0;
+	int result                   = 0;
+
+	if( getenv(
+	     "SMDEV_TEST_PROBE_BENCHMARK" ) == NULL )
+	{
+		return( 1 );
+	}
+	result = smdev_test_io_control_write_raw_toc_fixture(
+	          smdev_test_io_control_fixture_path,
+	          1,
+	          99,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_initialize(
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_open(
+	          device_file,
+	          smdev_test_io_control_fixture_path,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_replay_open(
+	          smdev_test_io_control_fixture_path,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every replayed command takes 1 ms to model the command latency of a drive
+	 */
+	result = libsmdev_io_control_set_replay_latency(
+	          SMDEV_TEST_IO_CONTROL_PROBE_BENCHMARK_LATENCY,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &start_time );
+
+	for( probe_index = 0;
+	     probe_index < SMDEV_TEST_IO_CONTROL_PROBE_BENCHMARK_ITERATIONS;
+	     probe_index++ )
+	{
+		result = libsmdev_optical_disc_get_table_of_contents_scsi(
+		          device_file,
+		          (libsmdev_internal_handle_t *) handle,
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &end_time );
+
+	elapsed_time = ( (uint64_t) ( end_time.tv_sec - start_time.tv_sec ) * 1000000 )
+	             + ( (uint64_t) end_time.tv_nsec / 1000 ) - ( (uint64_t) start_time.tv_nsec / 1000 );
+
+	result = libsmdev_io_control_close(
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_number_of_tracks(
+	          handle,
+	          &number_of_tracks,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_tracks",
+	 number_of_tracks,
+	 99 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A probe issues 1 READ TOC and 1 READ TRACK INFORMATION for each of the 50 data tracks
+	 */
+	fprintf(
+	 stdout,
+	 "\n\ttracks: %d, commands per probe: %d, replay latency: %d us, probes: %d, time: %" PRIu64 " us, %" PRIu64 " us per probe\n",
+	 number_of_tracks,
+	 1 + ( ( number_of_tracks + 1 ) / 2 ),
+	 SMDEV_TEST_IO_CONTROL_PROBE_BENCHMARK_LATENCY,
+	 SMDEV_TEST_IO_CONTROL_PROBE_BENCHMARK_ITERATIONS,
+	 elapsed_time,
+	 elapsed_time / SMDEV_TEST_IO_CONTROL_PROBE_BENCHMARK_ITERATIONS );
+
+	/* Clean up
+	 */
+	result = libcfile_file_close(
+	          device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_free(
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_io_control_fixture_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libsmdev_io_control_close(
+	 NULL );
+
+	if( device_file != NULL )
+	{
+		libcfile_file_free(
+		 &device_file,
+		 NULL );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_io_control_fixture_path );
+
+	return( 0 );
+}
+
+#endif /* defined( HAVE_SCSI_SG_H ) */
+
+#endif /* defined( HAVE_LINUX_CDROM_H ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_io_control",
+	     smdev_test_io_control_fixture_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	SMDEV_TEST_RUN(
+	 "libsmdev_io_control_entry_initialize",
+	 smdev_test_io_control_entry_initialize );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_io_control_entry_free",
+	 smdev_test_io_control_entry_free );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_io_control_fixture_initialize",
+	 smdev_test_io_control_fixture_initialize );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_io_control_fixture_get_entry",
+	 smdev_test_io_control_fixture_get_entry );
+
+#if defined( HAVE_LINUX_FS_H ) && defined( BLKGETSIZE64 )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_io_control_replay_block_device",
+	 smdev_test_io_control_replay_block_device );
+
+#endif /* defined( HAVE_LINUX_FS_H ) && defined( BLKGETSIZE64 ) */
+
+#if defined( HAVE_LINUX_CDROM_H )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_io_control_replay_table_of_contents",
+	 smdev_test_io_control_replay_table_of_contents );
+
+#if defined( HAVE_SCSI_SG_H )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_io_control_replay_raw_table_of_contents",
+	 smdev_test_io_control_replay_raw_table_of_contents );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_io_control_benchmark_probe",
+	 smdev_test_io_control_benchmark_probe );
+
+#endif /* defined( HAVE_SCSI_SG_H ) */
+
+#endif /* defined( HAVE_LINUX_CDROM_H ) */
+
+	remove(
+	 smdev_test_io_control_fixture_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+	remove(
+	 smdev_test_io_control_fixture_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2242 @@
+/*
+ * Library optical read functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SCSI_SG_H )
+#include <scsi/sg.h>
+#endif
+
+#include "smdev_test_functions.h"
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libcfile.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_handle.h"
+#include "../libsmdev/libsmdev_io_control.h"
+#include "../libsmdev/libsmdev_optical_read.h"
+#include "../libsmdev/libsmdev_scsi.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+/* The path of the scenario file
+ */
+char smdev_test_optical_read_scenario_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The path of the IO control fixture file
+ */
+char smdev_test_optical_read_fixture_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The scenario of the simulated device
+ */
+const char *smdev_test_optical_read_scenario = \
+	"size 0x100000\n"
+	"bytes_per_sector 2048\n";
+
+/* Tests the libsmdev_optical_read_get_frame_size function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_optical_read_get_frame_size(
+     void )
+{
+	size_t frame_size = 0;
+
+	frame_size = libsmdev_optical_read_get_frame_size(
+	              0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "frame_size",
+	 frame_size,
+	 (size_t) 2352 );
+
+	frame_size = libsmdev_optical_read_get_frame_size(
+	              LIBSMDEV_OPTICAL_READ_FLAG_SUB_CHANNEL );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "frame_size",
+	 frame_size,
+	 (size_t) 2448 );
+
+	/* Test that the C2 error pointers are not part of the frame
+	 */
+	frame_size = libsmdev_optical_read_get_frame_size(
+	              LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "frame_size",
+	 frame_size,
+	 (size_t) 2352 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libsmdev_optical_read_get_transfer_frame_size function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_optical_read_get_transfer_frame_size(
+     void )
+{
+	size_t frame_size = 0;
+
+	frame_size = libsmdev_optical_read_get_transfer_frame_size(
+	              0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "frame_size",
+	 frame_size,
+	 (size_t) 2352 );
+
+	frame_size = libsmdev_optical_read_get_transfer_frame_size(
+	              LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "frame_size",
+	 frame_size,
+	 (size_t) 2646 );
+
+	frame_size = libsmdev_optical_read_get_transfer_frame_size(
+	              LIBSMDEV_OPTICAL_READ_FLAG_SUB_CHANNEL | LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "frame_size",
+	 frame_size,
+	 (size_t) 2742 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libsmdev_optical_read_get_batch_size function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_optical_read_get_batch_size(
+     void )
+{
+	uint32_t batch_size = 0;
+
+	/* Test that the batch fills the maximum transfer size
+	 */
+	batch_size = libsmdev_optical_read_get_batch_size(
+	              65536,
+	              2352 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "batch_size",
+	 batch_size,
+	 (uint32_t) 27 );
+
+	batch_size = libsmdev_optical_read_get_batch_size(
+	              1048576,
+	              2448 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "batch_size",
+	 batch_size,
+	 (uint32_t) 428 );
+
+	/* Test that a batch contains at least 1 frame
+	 */
+	batch_size = libsmdev_optical_read_get_batch_size(
+	              2048,
+	              2352 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "batch_size",
+	 batch_size,
+	 (uint32_t) 1 );
+
+	batch_size = libsmdev_optical_read_get_batch_size(
+	              65536,
+	              0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "batch_size",
+	 batch_size,
+	 (uint32_t) 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libsmdev_optical_read_has_c2_errors function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_optical_read_has_c2_errors(
+     void )
+{
+	uint8_t c2_error_pointers[ LIBSMDEV_OPTICAL_READ_C2_ERROR_POINTERS_SIZE ];
+
+	int result = 0;
+
+	memory_set(
+	 c2_error_pointers,
+	 0,
+	 LIBSMDEV_OPTICAL_READ_C2_ERROR_POINTERS_SIZE );
+
+	result = libsmdev_optical_read_has_c2_errors(
+	          c2_error_pointers,
+	          LIBSMDEV_OPTICAL_READ_C2_ERROR_POINTERS_SIZE );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a single damaged byte at the end of the frame is detected
+	 */
+	c2_error_pointers[ LIBSMDEV_OPTICAL_READ_C2_ERROR_POINTERS_SIZE - 1 ] = 0x01;
+
+	result = libsmdev_optical_read_has_c2_errors(
+	          c2_error_pointers,
+	          LIBSMDEV_OPTICAL_READ_C2_ERROR_POINTERS_SIZE );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_optical_read_has_c2_errors(
+	          NULL,
+	          LIBSMDEV_OPTICAL_READ_C2_ERROR_POINTERS_SIZE );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_read_optical_sectors and libsmdev_handle_read_track_sectors functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_handle_read_optical_sectors(
+     void )
+{
+	uint8_t buffer[ 2 * 2448 ];
+
+	libcerror_error_t *error     = NULL;
+	libsmdev_handle_t *handle    = NULL;
+	size64_t error_size          = 0;
+	size_t maximum_transfer_size = 0;
+	ssize_t read_count           = 0;
+	off64_t error_offset         = 0;
+	uint64_t number_of_sectors   = 0;
+	uint64_t start_sector        = 0;
+	int number_of_ranges         = 0;
+	int result                   = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_optical_read_scenario_path,
+	          (const uint8_t *) smdev_test_optical_read_scenario,
+	          narrow_string_length(
+	           smdev_test_optical_read_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the handle is not open
+	 */
+	read_count = libsmdev_handle_read_optical_sectors(
+	              handle,
+	              0,
+	              1,
+	              buffer,
+	              2 * 2448,
+	              0,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_optical_read_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the default maximum transfer size is used if the device does not report one
+	 */
+	result = libsmdev_optical_read_get_maximum_transfer_size(
+	          (libsmdev_internal_handle_t *) handle,
+	          &maximum_transfer_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_transfer_size",
+	 maximum_transfer_size,
+	 (size_t) LIBSMDEV_OPTICAL_READ_DEFAULT_MAXIMUM_TRANSFER_SIZE );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that reading no sectors succeeds
+	 */
+	read_count = libsmdev_handle_read_optical_sectors(
+	              handle,
+	              0,
+	              0,
+	              buffer,
+	              2 * 2448,
+	              0,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the IO backend cannot issue READ CD commands
+	 */
+	read_count = libsmdev_handle_read_optical_sectors(
+	              handle,
+	              0,
+	              2,
+	              buffer,
+	              2 * 2448,
+	              LIBSMDEV_OPTICAL_READ_FLAG_SUB_CHANNEL,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the buffer is too small for the frames
+	 */
+	read_count = libsmdev_handle_read_optical_sectors(
+	              handle,
+	              0,
+	              2,
+	              buffer,
+	              2 * 2352,
+	              LIBSMDEV_OPTICAL_READ_FLAG_SUB_CHANNEL,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the read flags are not supported
+	 */
+	read_count = libsmdev_handle_read_optical_sectors(
+	              handle,
+	              0,
+	              1,
+	              buffer,
+	              2 * 2448,
+	              0x80,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the sectors exceed the 32-bit LBA
+	 */
+	read_count = libsmdev_handle_read_optical_sectors(
+	              handle,
+	              (uint64_t) 0xffffffffUL,
+	              2,
+	              buffer,
+	              2 * 2448,
+	              0,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that suspect sectors are recorded as errors
+	 */
+	result = libsmdev_optical_read_append_suspect_sectors(
+	          (libsmdev_internal_handle_t *) handle,
+	          16,
+	          4,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_number_of_suspect_ranges(
+	          handle,
+	          &number_of_ranges,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 1 );
+
+	result = libsmdev_handle_get_suspect_range(
+	          handle,
+	          0,
+	          &start_sector,
+	          &number_of_sectors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 16 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 4 );
+
+	result = libsmdev_handle_get_error(
+	          handle,
+	          0,
+	          &error_offset,
+	          &error_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "error_offset",
+	 (int64_t) error_offset,
+	 (int64_t) 16 * 2048 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "error_size",
+	 (uint64_t) error_size,
+	 (uint64_t) 4 * 2048 );
+
+	/* Test that re-read sectors are removed from the suspect sectors and errors
+	 */
+	result = libsmdev_optical_read_remove_suspect_sectors(
+	          (libsmdev_internal_handle_t *) handle,
+	          16,
+	          4,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_number_of_suspect_ranges(
+	          handle,
+	          &number_of_ranges,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 0 );
+
+	result = libsmdev_handle_get_number_of_errors(
+	          handle,
+	          &number_of_ranges,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_ranges,
+	 0 );
+
+	/* Test error case where the track does not exist
+	 */
+	read_count = libsmdev_handle_read_track_sectors(
+	              handle,
+	              0,
+	              0,
+	              1,
+	              buffer,
+	              2 * 2448,
+	              0,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_optical_read_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_optical_read_scenario_path );
+
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_read_streaming_sectors function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_handle_read_streaming_sectors(
+     void )
+{
+	uint8_t buffer[ 2 * 2048 ];
+
+	libcerror_error_t *error       = NULL;
+	libsmdev_handle_t *handle      = NULL;
+	size_t streaming_transfer_size = 0;
+	ssize_t read_count             = 0;
+	uint32_t streaming_timeout     = 0;
+	int number_of_ranges           = 0;
+	int result                     = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_optical_read_scenario_path,
+	          (const uint8_t *) smdev_test_optical_read_scenario,
+	          narrow_string_length(
+	           smdev_test_optical_read_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the default streaming transfer size and timeout
+	 */
+	result = libsmdev_handle_get_streaming_transfer_size(
+	          handle,
+	          &streaming_transfer_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "streaming_transfer_size",
+	 streaming_transfer_size,
+	 (size_t) 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_streaming_timeout(
+	          handle,
+	          &streaming_timeout,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "streaming_timeout",
+	 streaming_timeout,
+	 (uint32_t) LIBSMDEV_OPTICAL_READ_DEFAULT_STREAMING_TIMEOUT );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test setting the streaming transfer size and timeout
+	 */
+	result = libsmdev_handle_set_streaming_transfer_size(
+	          handle,
+	          32 * 2048,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_streaming_transfer_size(
+	          handle,
+	          &streaming_transfer_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "streaming_transfer_size",
+	 streaming_transfer_size,
+	 (size_t) ( 32 * 2048 ) );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_streaming_timeout(
+	          handle,
+	          1500,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_streaming_timeout(
+	          handle,
+	          &streaming_timeout,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "streaming_timeout",
+	 streaming_timeout,
+	 (uint32_t) 1500 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_get_streaming_transfer_size(
+	          handle,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_set_streaming_transfer_size(
+	          handle,
+	          (size_t) LIBSMDEV_OPTICAL_READ_MAXIMUM_STREAMING_TRANSFER_SIZE + 1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_get_streaming_timeout(
+	          handle,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_set_streaming_timeout(
+	          handle,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the handle is not open
+	 */
+	read_count = libsmdev_handle_read_streaming_sectors(
+	              handle,
+	              0,
+	              1,
+	              buffer,
+	              2 * 2048,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_optical_read_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that reading no sectors succeeds
+	 */
+	read_count = libsmdev_handle_read_streaming_sectors(
+	              handle,
+	              0,
+	              0,
+	              buffer,
+	              2 * 2048,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the buffer is too small for the sectors
+	 */
+	read_count = libsmdev_handle_read_streaming_sectors(
+	              handle,
+	              0,
+	              2,
+	              buffer,
+	              2048,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the start sector exceeds the 32-bit LBA of READ (12)
+	 */
+	read_count = libsmdev_handle_read_streaming_sectors(
+	              handle,
+	              (uint64_t) UINT32_MAX + 1,
+	              1,
+	              buffer,
+	              2 * 2048,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the IO backend cannot issue READ (12) commands
+	 */
+	read_count = libsmdev_handle_read_streaming_sectors(
+	              handle,
+	              0,
+	              2,
+	              buffer,
+	              2 * 2048,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that a failed streaming read does not record suspect sectors
+	 */
+	result = libsmdev_handle_get_number_of_suspect_ranges(
+	          handle,
+	          &number_of_ranges,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_optical_read_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_optical_read_scenario_path );
+
+	return( 0 );
+}
+
+#if defined( HAVE_SCSI_SG_H )
+
+/* Writes a READ CD command and its response to an IO control fixture
+ * The command is replayed as a medium error if medium_error is set and
+ * as a successful read of frames filled with fill_byte otherwise
+ * If read_flags contains LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS the command requests
+ * C2 error pointers, which mark all bytes of the frames as damaged if c2_errors is set
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_optical_read_write_read_cd_entry(
+     libsmdev_io_control_fixture_t *fixture,
+     uint32_t lba,
+     uint32_t number_of_sectors,
+     uint8_t read_flags,
+     uint8_t medium_error,
+     uint8_t fill_byte,
+     uint8_t c2_errors,
+     libcerror_error_t **error )
+{
+	libsmdev_scsi_read_cd_cdb_t command;
+	uint8_t key[ 9 + sizeof( libsmdev_scsi_read_cd_cdb_t ) ];
+
+	uint8_t *entry_data        = NULL;
+	uint8_t *frame_data        = NULL;
+	uint8_t *sense             = NULL;
+	size_t entry_data_size     = 0;
+	size_t response_size       = 0;
+	size_t transfer_frame_size = 0;
+	uint32_t frame_index       = 0;
+	int result                 = 0;
+
+	memory_set(
+	 &command,
+	 0,
+	 sizeof( libsmdev_scsi_read_cd_cdb_t ) );
+
+	command.operation_code = LIBSMDEV_SCSI_OPERATION_CODE_READ_CD;
+	command.sector_type    = (uint8_t) ( LIBSMDEV_SCSI_READ_CD_SECTOR_TYPE_ANY << 2 );
+	command.flags          = LIBSMDEV_SCSI_READ_CD_FLAG_SYNC
+	                       | LIBSMDEV_SCSI_READ_CD_FLAG_ALL_HEADERS
+	                       | LIBSMDEV_SCSI_READ_CD_FLAG_USER_DATA
+	                       | LIBSMDEV_SCSI_READ_CD_FLAG_EDC_ECC;
+
+	if( ( read_flags & LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS ) != 0 )
+	{
+		command.flags |= LIBSMDEV_SCSI_READ_CD_FLAG_C2_ERROR_POINTERS;
+	}
+	byte_stream_copy_from_uint32_big_endian(
+	 command.lba,
+	 lba );
+
+	command.number_of_sectors[ 0 ] = (uint8_t) ( ( number_of_sectors >> 16 ) & 0xff );
+	command.number_of_sectors[ 1 ] = (uint8_t) ( ( number_of_sectors >> 8 ) & 0xff );
+	command.number_of_sectors[ 2 ] = (uint8_t) ( number_of_sectors & 0xff );
+
+	transfer_frame_size = libsmdev_optical_read_get_transfer_frame_size(
+	                       read_flags );
+
+	response_size = (size_t) number_of_sectors * transfer_frame_size;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( key[ 0 ] ),
+	 (uint32_t) response_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( key[ 4 ] ),
+	 (uint32_t) SG_DXFER_FROM_DEV );
+
+	key[ 8 ] = LIBSMDEV_SCSI_SENSE_SIZE;
+
+	memory_copy(
+	 &( key[ 9 ] ),
+	 &command,
+	 sizeof( libsmdev_scsi_read_cd_cdb_t ) );
+
+	entry_data_size = LIBSMDEV_IO_CONTROL_SG_IO_STATUS_SIZE + LIBSMDEV_SCSI_SENSE_SIZE + response_size;
+
+	entry_data = (uint8_t *) memory_allocate(
+	                          entry_data_size );
+
+	if( entry_data == NULL )
+	{
+		return( -1 );
+	}
+	memory_set(
+	 entry_data,
+	 0,
+	 entry_data_size );
+
+	if( medium_error != 0 )
+	{
+		/* A check condition with fixed format sense data of an unrecovered read error
+		 */
+		entry_data[ 0 ] = 0x02;
+		entry_data[ 1 ] = 0x01;
+		entry_data[ 3 ] = 18;
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( entry_data[ 16 ] ),
+		 (uint32_t) SG_INFO_CHECK );
+
+		sense = &( entry_data[ LIBSMDEV_IO_CONTROL_SG_IO_STATUS_SIZE ] );
+
+		sense[ 0 ]  = 0x70;
+		sense[ 2 ]  = LIBSMDEV_SCSI_SENSE_KEY_MEDIUM_ERROR;
+		sense[ 7 ]  = 10;
+		sense[ 12 ] = 0x11;
+	}
+	else
+	{
+		for( frame_index = 0;
+		     frame_index < number_of_sectors;
+		     frame_index++ )
+		{
+			frame_data = &( entry_data[ LIBSMDEV_IO_CONTROL_SG_IO_STATUS_SIZE + LIBSMDEV_SCSI_SENSE_SIZE + ( (size_t) frame_index * transfer_frame_size ) ] );
+
+			memory_set(
+			 frame_data,
+			 fill_byte,
+			 LIBSMDEV_OPTICAL_READ_FRAME_SIZE );
+
+			if( ( ( read_flags & LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS ) != 0 )
+			 && ( c2_errors != 0 ) )
+			{
+				memory_set(
+				 &( frame_data[ LIBSMDEV_OPTICAL_READ_FRAME_SIZE ] ),
+				 0xff,
+				 LIBSMDEV_OPTICAL_READ_C2_ERROR_POINTERS_SIZE );
+			}
+		}
+	}
+	result = libsmdev_io_control_fixture_write_entry(
+	          fixture,
+	          SG_IO,
+	          0,
+	          key,
+	          9 + sizeof( libsmdev_scsi_read_cd_cdb_t ),
+	          entry_data,
+	          entry_data_size,
+	          error );
+
+	memory_free(
+	 entry_data );
+
+	return( result );
+}
+
+/* Writes the READ CD responses of a re-read pass to an IO control fixture
+ * The drive reports a medium error for the batch of sectors 16 and 17, when read
+ * one by one sector 16 is read successfully and sector 17 still reports a medium error
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_optical_read_write_re_read_fixture(
+     const char *path,
+     libcerror_error_t **error )
+{
+	libsmdev_io_control_fixture_t *fixture = NULL;
+	int result                             = -1;
+
+	if( libsmdev_io_control_fixture_initialize(
+	     &fixture,
+	     LIBSMDEV_IO_CONTROL_FIXTURE_MODE_RECORD,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	fixture->file_stream = file_stream_open(
+	                        path,
+	                        FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( fixture->file_stream == NULL )
+	{
+		goto on_error;
+	}
+	if( file_stream_write(
+	     fixture->file_stream,
+	     LIBSMDEV_IO_CONTROL_FIXTURE_SIGNATURE,
+	     8 ) != 8 )
+	{
+		goto on_error;
+	}
+	if( smdev_test_optical_read_write_read_cd_entry(
+	     fixture,
+	     16,
+	     2,
+	     0,
+	     1,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( smdev_test_optical_read_write_read_cd_entry(
+	     fixture,
+	     16,
+	     1,
+	     0,
+	     0,
+	     0xaa,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( smdev_test_optical_read_write_read_cd_entry(
+	     fixture,
+	     17,
+	     1,
+	     0,
+	     1,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	result = 1;
+
+on_error:
+	if( fixture != NULL )
+	{
+		libsmdev_io_control_fixture_free(
+		 &fixture,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Writes the READ CD responses of a C2 error pointer re-read to an IO control fixture
+ * The first read of sector 20 returns C2 errors, the second read of the same sector is clean
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_optical_read_write_c2_re_read_fixture(
+     const char *path,
+     libcerror_error_t **error )
+{
+	libsmdev_io_control_fixture_t *fixture = NULL;
+	int result                             = -1;
+
+	if( libsmdev_io_control_fixture_initialize(
+	     &fixture,
+	     LIBSMDEV_IO_CONTROL_FIXTURE_MODE_RECORD,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	fixture->file_stream = file_stream_open(
+	                        path,
+	                        FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( fixture->file_stream == NULL )
+	{
+		goto on_error;
+	}
+	if( file_stream_write(
+	     fixture->file_stream,
+	     LIBSMDEV_IO_CONTROL_FIXTURE_SIGNATURE,
+	     8 ) != 8 )
+	{
+		goto on_error;
+	}
+	if( smdev_test_optical_read_write_read_cd_entry(
+	     fixture,
+	     20,
+	     1,
+	     LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS,
+	     0,
+	     0xbb,
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( smdev_test_optical_read_write_read_cd_entry(
+	     fixture,
+	     20,
+	     1,
+	     LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS,
+	     0,
+	     0xcc,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	result = 1;
+
+on_error:
+	if( fixture != NULL )
+	{
+		libsmdev_io_control_fixture_free(
+		 &fixture,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Tests the libsmdev_optical_read_sectors function re-reading a batch the drive reports a medium error for
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_optical_read_sectors_re_read(
+     void )
+{
+	uint8_t buffer[ 2 * 2352 ];
+
+	libcerror_error_t *error     = NULL;
+	libcfile_file_t *device_file = NULL;
+	libsmdev_handle_t *handle    = NULL;
+	size64_t error_size          = 0;
+	ssize_t read_count           = 0;
+	off64_t error_offset         = 0;
+	uint64_t number_of_sectors   = 0;
+	uint64_t start_sector        = 0;
+	size_t buffer_offset         = 0;
+	int number_of_ranges         = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = smdev_test_write_file(
+	          smdev_test_optical_read_scenario_path,
+	          (const uint8_t *) smdev_test_optical_read_scenario,
+	          narrow_string_length(
+	           smdev_test_optical_read_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smdev_test_optical_read_write_re_read_fixture(
+	          smdev_test_optical_read_fixture_path,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_optical_read_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The READ CD commands are replayed from the fixture, hence any file will do as device file
+	 */
+	result = libcfile_file_initialize(
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_open(
+	          device_file,
+	          smdev_test_optical_read_fixture_path,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The sectors were recorded as suspect sectors by the first pass
+	 */
+	result = libsmdev_optical_read_append_suspect_sectors(
+	          (libsmdev_internal_handle_t *) handle,
+	          16,
+	          2,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_replay_open(
+	          smdev_test_optical_read_fixture_path,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that only the sector that cannot be read is recorded
+	 */
+	( (libsmdev_internal_handle_t *) handle )->device_file = device_file;
+
+	memory_set(
+	 buffer,
+	 0xff,
+	 2 * 2352 );
+
+	read_count = libsmdev_optical_read_sectors(
+	              (libsmdev_internal_handle_t *) handle,
+	              16,
+	              2,
+	              LIBSMDEV_TRACK_TYPE_MODE1_2352,
+	              buffer,
+	              2 * 2352,
+	              0,
+	              &error );
+
+	( (libsmdev_internal_handle_t *) handle )->device_file = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) ( 2 * 2352 ) );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_close(
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_offset = 0;
+	     buffer_offset < 2352;
+	     buffer_offset++ )
+	{
+		if( buffer[ buffer_offset ] != 0xaa )
+		{
+			break;
+		}
+	}
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 2352 );
+
+	for( buffer_offset = 2352;
+	     buffer_offset < 2 * 2352;
+	     buffer_offset++ )
+	{
+		if( buffer[ buffer_offset ] != 0 )
+		{
+			break;
+		}
+	}
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) ( 2 * 2352 ) );
+
+	result = libsmdev_handle_get_number_of_suspect_ranges(
+	          handle,
+	          &number_of_ranges,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_suspect_range(
+	          handle,
+	          0,
+	          &start_sector,
+	          &number_of_sectors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 17 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_number_of_errors(
+	          handle,
+	          &number_of_ranges,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_error(
+	          handle,
+	          0,
+	          &error_offset,
+	          &error_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "error_offset",
+	 (int64_t) error_offset,
+	 (int64_t) 17 * 2048 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "error_size",
+	 (uint64_t) error_size,
+	 (uint64_t) 2048 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_free(
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_optical_read_fixture_path );
+
+	remove(
+	 smdev_test_optical_read_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libsmdev_io_control_close(
+	 NULL );
+
+	if( handle != NULL )
+	{
+		( (libsmdev_internal_handle_t *) handle )->device_file = NULL;
+
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( device_file != NULL )
+	{
+		libcfile_file_free(
+		 &device_file,
+		 NULL );
+	}
+	remove(
+	 smdev_test_optical_read_fixture_path );
+
+	remove(
+	 smdev_test_optical_read_scenario_path );
+
+	return( 0 );
+}
+
+/* Tests the libsmdev_optical_read_sectors function re-reading a sector with C2 errors
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_optical_read_sectors_c2_re_read(
+     void )
+{
+	uint8_t buffer[ 2352 ];
+
+	libcerror_error_t *error     = NULL;
+	libcfile_file_t *device_file = NULL;
+	libsmdev_handle_t *handle    = NULL;
+	size64_t error_size          = 0;
+	ssize_t read_count           = 0;
+	off64_t error_offset         = 0;
+	uint64_t number_of_sectors   = 0;
+	uint64_t start_sector        = 0;
+	size_t buffer_offset         = 0;
+	int number_of_ranges         = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = smdev_test_write_file(
+	          smdev_test_optical_read_scenario_path,
+	          (const uint8_t *) smdev_test_optical_read_scenario,
+	          narrow_string_length(
+	           smdev_test_optical_read_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smdev_test_optical_read_write_c2_re_read_fixture(
+	          smdev_test_optical_read_fixture_path,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_optical_read_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The READ CD commands are replayed from the fixture, hence any file will do as device file
+	 */
+	result = libcfile_file_initialize(
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcfile_file_open(
+	          device_file,
+	          smdev_test_optical_read_fixture_path,
+	          LIBCFILE_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_replay_open(
+	          smdev_test_optical_read_fixture_path,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the sector with C2 errors is recorded as suspect sector and error
+	 */
+	( (libsmdev_internal_handle_t *) handle )->device_file = device_file;
+
+	read_count = libsmdev_optical_read_sectors(
+	              (libsmdev_internal_handle_t *) handle,
+	              20,
+	              1,
+	              LIBSMDEV_TRACK_TYPE_MODE1_2352,
+	              buffer,
+	              2352,
+	              LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS,
+	              &error );
+
+	( (libsmdev_internal_handle_t *) handle )->device_file = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 2352 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_number_of_suspect_ranges(
+	          handle,
+	          &number_of_ranges,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_suspect_range(
+	          handle,
+	          0,
+	          &start_sector,
+	          &number_of_sectors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 20 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_error(
+	          handle,
+	          0,
+	          &error_offset,
+	          &error_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "error_offset",
+	 (int64_t) error_offset,
+	 (int64_t) 20 * 2048 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "error_size",
+	 (uint64_t) error_size,
+	 (uint64_t) 2048 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a clean re-read removes the sector from the suspect sectors and errors
+	 */
+	( (libsmdev_internal_handle_t *) handle )->device_file = device_file;
+
+	read_count = libsmdev_optical_read_sectors(
+	              (libsmdev_internal_handle_t *) handle,
+	              20,
+	              1,
+	              LIBSMDEV_TRACK_TYPE_MODE1_2352,
+	              buffer,
+	              2352,
+	              LIBSMDEV_OPTICAL_READ_FLAG_C2_ERROR_POINTERS,
+	              &error );
+
+	( (libsmdev_internal_handle_t *) handle )->device_file = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 2352 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_io_control_close(
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_offset = 0;
+	     buffer_offset < 2352;
+	     buffer_offset++ )
+	{
+		if( buffer[ buffer_offset ] != 0xcc )
+		{
+			break;
+		}
+	}
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_offset",
+	 buffer_offset,
+	 (size_t) 2352 );
+
+	result = libsmdev_handle_get_number_of_suspect_ranges(
+	          handle,
+	          &number_of_ranges,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_number_of_errors(
+	          handle,
+	          &number_of_ranges,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libcfile_file_free(
+	          &device_file,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_optical_read_fixture_path );
+
+	remove(
+	 smdev_test_optical_read_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libsmdev_io_control_close(
+	 NULL );
+
+	if( handle != NULL )
+	{
+		( (libsmdev_internal_handle_t *) handle )->device_file = NULL;
+
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( device_file != NULL )
+	{
+		libcfile_file_free(
+		 &device_file,
+		 NULL );
+	}
+	remove(
+	 smdev_test_optical_read_fixture_path );
+
+	remove(
+	 smdev_test_optical_read_scenario_path );
+
+	return( 0 );
+}
+
+#endif /* defined( HAVE_SCSI_SG_H ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_optical_read",
+	     smdev_test_optical_read_scenario_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_optical_read_fixture",
+	     smdev_test_optical_read_fixture_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	SMDEV_TEST_RUN(
+	 "libsmdev_optical_read_get_frame_size",
+	 smdev_test_optical_read_get_frame_size );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_optical_read_get_transfer_frame_size",
+	 smdev_test_optical_read_get_transfer_frame_size );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_optical_read_get_batch_size",
+	 smdev_test_optical_read_get_batch_size );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_optical_read_has_c2_errors",
+	 smdev_test_optical_read_has_c2_errors );
+
+	/* libsmdev_optical_read_append_suspect_sectors is tested in smdev_test_handle_read_optical_sectors */
+
+	/* libsmdev_optical_read_remove_suspect_sectors is tested in smdev_test_handle_read_optical_sectors */
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_read_optical_sectors",
+	 smdev_test_handle_read_optical_sectors );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_read_streaming_sectors",
+	 smdev_test_handle_read_streaming_sectors );
+
+#if defined( HAVE_SCSI_SG_H )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_optical_read_sectors re-read",
+	 smdev_test_optical_read_sectors_re_read );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_optical_read_sectors C2 re-read",
+	 smdev_test_optical_read_sectors_c2_re_read );
+
+#endif /* defined( HAVE_SCSI_SG_H ) */
+
+	remove(
+	 smdev_test_optical_read_scenario_path );
+
+	remove(
+	 smdev_test_optical_read_fixture_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	remove(
+	 smdev_test_optical_read_scenario_path );
+
+	remove(
+	 smdev_test_optical_read_fixture_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_FAILURE );
+}
+
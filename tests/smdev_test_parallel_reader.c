@@ -0,0 +1,1443 @@
+/*
+ * Library parallel reader functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_functions.h"
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_handle.h"
+#include "../libsmdev/libsmdev_parallel_reader.h"
+
+#define SMDEV_TEST_PARALLEL_READER_READ_SIZE		49152
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The path of the scenario file
+ */
+char smdev_test_parallel_reader_scenario_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The path of the mirror scenario file
+ */
+char smdev_test_parallel_reader_mirror_scenario_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The scenario of the simulated device
+ */
+const char *smdev_test_parallel_reader_scenario = \
+	"size 0x100000\n"
+	"latency 0 0x100000 100\n"
+	"bad 0x20000 1024\n"
+	"bad 0x31000 512\n"
+	"short_read 0xc0000 0x10000 4096\n"
+	"bad 0xfc000 4096\n";
+
+/* The scenario of the simulated device with 4096-byte physical sectors of which the first starts at offset 3584
+ */
+const char *smdev_test_parallel_reader_aligned_scenario = \
+	"size 0x100000\n"
+	"physical_bytes_per_sector 4096\n"
+	"alignment_offset 3584\n";
+
+/* The scenario of the simulated mirror of the device that cannot read the last bad range either
+ */
+const char *smdev_test_parallel_reader_mirror_scenario = \
+	"size 0x100000\n"
+	"bad 0xfc000 4096\n";
+
+/* The offset and size of the bad ranges in the scenario
+ */
+off64_t smdev_test_parallel_reader_bad_ranges[ 3 ][ 2 ] = {
+	{ 0x20000, 1024 },
+	{ 0x31000, 512 },
+	{ 0xfc000, 4096 } };
+
+/* Determines if a range is contained in the errors of the handle
+ * Returns 1 if the range was reported as an error, 0 if not or -1 on error
+ */
+int smdev_test_parallel_reader_range_has_error(
+     libsmdev_handle_t *handle,
+     off64_t range_offset,
+     size64_t range_size,
+     libcerror_error_t **error )
+{
+	off64_t error_offset = 0;
+	size64_t error_size  = 0;
+	int error_index      = 0;
+	int number_of_errors = 0;
+
+	if( libsmdev_handle_get_number_of_errors(
+	     handle,
+	     &number_of_errors,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( error_index = 0;
+	     error_index < number_of_errors;
+	     error_index++ )
+	{
+		if( libsmdev_handle_get_error(
+		     handle,
+		     error_index,
+		     &error_offset,
+		     &error_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( ( range_offset >= error_offset )
+		 && ( (off64_t) ( range_offset + range_size ) <= (off64_t) ( error_offset + error_size ) ) )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_parallel_reader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_parallel_reader_initialize(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libsmdev_parallel_reader_t *parallel_reader = NULL;
+	int result                                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_parallel_reader_initialize(
+	          &parallel_reader,
+	          4,
+	          65536,
+	          0x100000,
+	          2,
+	          512,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "parallel_reader",
+	 parallel_reader );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "parallel_reader->number_of_stripes",
+	 parallel_reader->number_of_stripes,
+	 8 );
+
+	result = libsmdev_parallel_reader_free(
+	          &parallel_reader,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "parallel_reader",
+	 parallel_reader );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_parallel_reader_initialize(
+	          NULL,
+	          4,
+	          65536,
+	          0x100000,
+	          2,
+	          512,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_parallel_reader_initialize(
+	          &parallel_reader,
+	          0,
+	          65536,
+	          0x100000,
+	          2,
+	          512,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "parallel_reader",
+	 parallel_reader );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_parallel_reader_initialize(
+	          &parallel_reader,
+	          4,
+	          0,
+	          0x100000,
+	          2,
+	          512,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "parallel_reader",
+	 parallel_reader );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_parallel_reader_initialize(
+	          &parallel_reader,
+	          4,
+	          65536,
+	          0,
+	          2,
+	          512,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "parallel_reader",
+	 parallel_reader );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parallel_reader != NULL )
+	{
+		libsmdev_parallel_reader_free(
+		 &parallel_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_read_buffer function using multiple read threads
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_parallel_reader_read_buffer(
+     void )
+{
+	uint8_t buffer[ SMDEV_TEST_PARALLEL_READER_READ_SIZE ];
+
+	libcerror_error_t *error  = NULL;
+	libsmdev_handle_t *handle = NULL;
+	size64_t media_size       = 0;
+	size_t buffer_index       = 0;
+	size_t read_size          = 0;
+	ssize_t read_count        = 0;
+	off64_t offset            = 0;
+	int number_of_mismatches  = 0;
+	int range_index           = 0;
+	int result                = 0;
+	int sector_has_error      = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_parallel_reader_scenario_path,
+	          (const uint8_t *) smdev_test_parallel_reader_scenario,
+	          narrow_string_length(
+	           smdev_test_parallel_reader_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_set_number_of_read_threads(
+	          handle,
+	          4,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_set_read_stripe_size(
+	          handle,
+	          65536,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_set_error_granularity(
+	          handle,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_parallel_reader_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The read threads cannot be changed while the handle is open
+	 */
+	result = libsmdev_handle_set_number_of_read_threads(
+	          handle,
+	          2,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "media_size",
+	 (uint64_t) media_size,
+	 (uint64_t) 0x100000UL );
+
+	/* Read the entire device with a read size that does not align with the stripes
+	 * and check that the data is returned in offset order
+	 */
+	while( offset < (off64_t) media_size )
+	{
+		read_size = SMDEV_TEST_PARALLEL_READER_READ_SIZE;
+
+		if( (size64_t) read_size > ( media_size - offset ) )
+		{
+			read_size = (size_t) ( media_size - offset );
+		}
+		read_count = libsmdev_handle_read_buffer(
+		              handle,
+		              buffer,
+		              read_size,
+		              &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( buffer_index = 0;
+		     buffer_index < read_size;
+		     buffer_index += 512 )
+		{
+			sector_has_error = smdev_test_parallel_reader_range_has_error(
+			                    handle,
+			                    offset + (off64_t) buffer_index,
+			                    512,
+			                    &error );
+
+			SMDEV_TEST_ASSERT_NOT_EQUAL_INT(
+			 "sector_has_error",
+			 sector_has_error,
+			 -1 );
+
+			if( ( sector_has_error == 0 )
+			 && ( buffer[ buffer_index ] != (uint8_t) ( ( offset + (off64_t) buffer_index ) % 251 ) ) )
+			{
+				number_of_mismatches++;
+			}
+		}
+		offset += read_count;
+	}
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_mismatches",
+	 number_of_mismatches,
+	 0 );
+
+	/* Every sector of the bad ranges must be reported as an error
+	 */
+	for( range_index = 0;
+	     range_index < 3;
+	     range_index++ )
+	{
+		for( offset = smdev_test_parallel_reader_bad_ranges[ range_index ][ 0 ];
+		     offset < ( smdev_test_parallel_reader_bad_ranges[ range_index ][ 0 ] + smdev_test_parallel_reader_bad_ranges[ range_index ][ 1 ] );
+		     offset += 512 )
+		{
+			result = smdev_test_parallel_reader_range_has_error(
+			          handle,
+			          offset,
+			          512,
+			          &error );
+
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+		}
+	}
+	/* Short reads are not errors
+	 */
+	result = smdev_test_parallel_reader_range_has_error(
+	          handle,
+	          0xc0000,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test reading at an offset that repositions the parallel reader
+	 */
+	read_count = libsmdev_handle_read_buffer_at_offset(
+	              handle,
+	              buffer,
+	              4096,
+	              0x54321,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_index = 0;
+	     buffer_index < 4096;
+	     buffer_index++ )
+	{
+		if( buffer[ buffer_index ] != (uint8_t) ( ( 0x54321 + buffer_index ) % 251 ) )
+		{
+			number_of_mismatches++;
+		}
+	}
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_mismatches",
+	 number_of_mismatches,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_parallel_reader_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_parallel_reader_scenario_path );
+
+	return( 0 );
+}
+
+/* Tests the libsmdev_parallel_reader_read_buffer function with a fallback source
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_parallel_reader_read_buffer_fallback(
+     void )
+{
+	uint8_t buffer[ SMDEV_TEST_PARALLEL_READER_READ_SIZE ];
+
+	libcerror_error_t *error         = NULL;
+	libsmdev_handle_t *handle        = NULL;
+	libsmdev_handle_t *mirror_handle = NULL;
+	size64_t error_size              = 0;
+	size_t buffer_index              = 0;
+	size_t read_size                 = 0;
+	ssize_t read_count               = 0;
+	off64_t error_offset             = 0;
+	off64_t offset                   = 0;
+	uint8_t expected_byte            = 0;
+	int error_index                  = 0;
+	int number_of_errors             = 0;
+	int number_of_mismatches         = 0;
+	int result                       = 0;
+	int source_index                 = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_parallel_reader_scenario_path,
+	          (const uint8_t *) smdev_test_parallel_reader_scenario,
+	          narrow_string_length(
+	           smdev_test_parallel_reader_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smdev_test_write_file(
+	          smdev_test_parallel_reader_mirror_scenario_path,
+	          (const uint8_t *) smdev_test_parallel_reader_mirror_scenario,
+	          narrow_string_length(
+	           smdev_test_parallel_reader_mirror_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_number_of_read_threads(
+	          handle,
+	          4,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_read_stripe_size(
+	          handle,
+	          65536,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_error_granularity(
+	          handle,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_parallel_reader_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &mirror_handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          mirror_handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_open(
+	          mirror_handle,
+	          smdev_test_parallel_reader_mirror_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_append_fallback_handle(
+	          handle,
+	          mirror_handle,
+	          &source_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read the entire device, only the last bad range cannot be read from the mirror
+	 */
+	while( offset < (off64_t) 0x100000 )
+	{
+		read_size = SMDEV_TEST_PARALLEL_READER_READ_SIZE;
+
+		if( (size64_t) read_size > (size64_t) ( 0x100000 - offset ) )
+		{
+			read_size = (size_t) ( 0x100000 - offset );
+		}
+		read_count = libsmdev_handle_read_buffer(
+		              handle,
+		              buffer,
+		              read_size,
+		              &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( buffer_index = 0;
+		     buffer_index < read_size;
+		     buffer_index++ )
+		{
+			expected_byte = (uint8_t) ( ( offset + (off64_t) buffer_index ) % 251 );
+
+			if( ( ( offset + (off64_t) buffer_index ) >= 0xfc000 )
+			 && ( ( offset + (off64_t) buffer_index ) < 0xfd000 ) )
+			{
+				expected_byte = 0;
+			}
+			if( buffer[ buffer_index ] != expected_byte )
+			{
+				number_of_mismatches++;
+			}
+		}
+		offset += read_count;
+	}
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_mismatches",
+	 number_of_mismatches,
+	 0 );
+
+	result = libsmdev_handle_get_number_of_errors(
+	          handle,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_NOT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 0 );
+
+	for( error_index = 0;
+	     error_index < number_of_errors;
+	     error_index++ )
+	{
+		result = libsmdev_handle_get_error(
+		          handle,
+		          error_index,
+		          &error_offset,
+		          &error_size,
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libsmdev_handle_get_error_source(
+		          handle,
+		          error_index,
+		          &source_index,
+		          &error );
+
+		if( error_offset >= 0xfc000 )
+		{
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		else
+		{
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "source_index",
+			 source_index,
+			 0 );
+		}
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &mirror_handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_parallel_reader_scenario_path );
+	remove(
+	 smdev_test_parallel_reader_mirror_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( mirror_handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &mirror_handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_parallel_reader_scenario_path );
+	remove(
+	 smdev_test_parallel_reader_mirror_scenario_path );
+
+	return( 0 );
+}
+
+/* Tests the libsmdev_parallel_reader_set_alignment_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_parallel_reader_set_alignment_offset(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libsmdev_parallel_reader_t *parallel_reader = NULL;
+	uint64_t stripe_index                       = 0;
+	off64_t stripe_offset                       = 0;
+	int result                                  = 0;
+
+	result = libsmdev_parallel_reader_initialize(
+	          &parallel_reader,
+	          4,
+	          65536,
+	          0x100000,
+	          2,
+	          512,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_parallel_reader_set_alignment_offset(
+	          parallel_reader,
+	          3584,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "parallel_reader->alignment_padding",
+	 parallel_reader->alignment_padding,
+	 (size_t) 61952 );
+
+	/* The first stripe ends at the alignment offset and the other stripes start at it
+	 */
+	stripe_index = libsmdev_parallel_reader_get_stripe_index(
+	                parallel_reader,
+	                3583 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "stripe_index",
+	 stripe_index,
+	 (uint64_t) 0 );
+
+	stripe_index = libsmdev_parallel_reader_get_stripe_index(
+	                parallel_reader,
+	                3584 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "stripe_index",
+	 stripe_index,
+	 (uint64_t) 1 );
+
+	stripe_offset = libsmdev_parallel_reader_get_stripe_offset(
+	                 parallel_reader,
+	                 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "stripe_offset",
+	 (int64_t) stripe_offset,
+	 (int64_t) 0 );
+
+	stripe_offset = libsmdev_parallel_reader_get_stripe_offset(
+	                 parallel_reader,
+	                 2 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "stripe_offset",
+	 (int64_t) stripe_offset,
+	 (int64_t) 69120 );
+
+	result = libsmdev_parallel_reader_set_alignment_offset(
+	          parallel_reader,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "parallel_reader->alignment_padding",
+	 parallel_reader->alignment_padding,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_parallel_reader_set_alignment_offset(
+	          NULL,
+	          3584,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_parallel_reader_set_alignment_offset(
+	          parallel_reader,
+	          -1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_parallel_reader_free(
+	          &parallel_reader,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( parallel_reader != NULL )
+	{
+		libsmdev_parallel_reader_free(
+		 &parallel_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_read_buffer function using multiple read threads
+ * on a device of which the physical sectors are not aligned with the start of the device
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_parallel_reader_read_buffer_aligned(
+     void )
+{
+	uint8_t buffer[ SMDEV_TEST_PARALLEL_READER_READ_SIZE ];
+
+	libcerror_error_t *error  = NULL;
+	libsmdev_handle_t *handle = NULL;
+	size_t buffer_index       = 0;
+	size_t read_size          = 0;
+	ssize_t read_count        = 0;
+	off64_t offset            = 0;
+	int number_of_mismatches  = 0;
+	int result                = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_parallel_reader_scenario_path,
+	          (const uint8_t *) smdev_test_parallel_reader_aligned_scenario,
+	          narrow_string_length(
+	           smdev_test_parallel_reader_aligned_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_set_number_of_read_threads(
+	          handle,
+	          4,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_set_read_stripe_size(
+	          handle,
+	          65536,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_parallel_reader_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read the entire device and check that the data is returned in offset order
+	 */
+	while( offset < 0x100000 )
+	{
+		read_size = SMDEV_TEST_PARALLEL_READER_READ_SIZE;
+
+		if( (off64_t) read_size > ( 0x100000 - offset ) )
+		{
+			read_size = (size_t) ( 0x100000 - offset );
+		}
+		read_count = libsmdev_handle_read_buffer(
+		              handle,
+		              buffer,
+		              read_size,
+		              &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( buffer_index = 0;
+		     buffer_index < read_size;
+		     buffer_index++ )
+		{
+			if( buffer[ buffer_index ] != (uint8_t) ( ( offset + (off64_t) buffer_index ) % 251 ) )
+			{
+				number_of_mismatches++;
+			}
+		}
+		offset += read_count;
+	}
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_mismatches",
+	 number_of_mismatches,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_parallel_reader_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_parallel_reader_scenario_path );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_parallel_reader",
+	     smdev_test_parallel_reader_scenario_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_parallel_reader_mirror",
+	     smdev_test_parallel_reader_mirror_scenario_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	SMDEV_TEST_RUN(
+	 "libsmdev_parallel_reader_initialize",
+	 smdev_test_parallel_reader_initialize );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_parallel_reader_set_alignment_offset",
+	 smdev_test_parallel_reader_set_alignment_offset );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_parallel_reader_read_buffer",
+	 smdev_test_parallel_reader_read_buffer );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_parallel_reader_read_buffer_fallback",
+	 smdev_test_parallel_reader_read_buffer_fallback );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_parallel_reader_read_buffer_aligned",
+	 smdev_test_parallel_reader_read_buffer_aligned );
+
+	remove(
+	 smdev_test_parallel_reader_scenario_path );
+
+	remove(
+	 smdev_test_parallel_reader_mirror_scenario_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	remove(
+	 smdev_test_parallel_reader_scenario_path );
+
+	remove(
+	 smdev_test_parallel_reader_mirror_scenario_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,740 @@
+/*
+ * Library probe cache functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_handle.h"
+#include "../libsmdev/libsmdev_probe_cache.h"
+
+/* The probe cache directory, the tests only construct paths and do not access it
+ */
+#define SMDEV_TEST_PROBE_CACHE_DIRECTORY	"probe_cache"
+
+/* Tests the libsmdev_handle_set_probe_cache_directory function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_handle_set_probe_cache_directory(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libsmdev_handle_t *handle = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_handle_set_probe_cache_directory(
+	          handle,
+	          SMDEV_TEST_PROBE_CACHE_DIRECTORY,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_probe_cache_directory(
+	          handle,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_set_probe_cache_directory(
+	          NULL,
+	          SMDEV_TEST_PROBE_CACHE_DIRECTORY,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_set_probe_cache_directory(
+	          handle,
+	          "",
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+/* Tests the libsmdev_probe_cache_calculate_checksum function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_probe_cache_calculate_checksum(
+     void )
+{
+	uint8_t data[ 9 ]        = { 'W', 'i', 'k', 'i', 'p', 'e', 'd', 'i', 'a' };
+	libcerror_error_t *error = NULL;
+	uint32_t checksum        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_probe_cache_calculate_checksum(
+	          &checksum,
+	          data,
+	          9,
+	          1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum",
+	 checksum,
+	 (uint32_t) 0x11e60398UL );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_probe_cache_calculate_checksum(
+	          NULL,
+	          data,
+	          9,
+	          1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_probe_cache_calculate_checksum(
+	          &checksum,
+	          NULL,
+	          9,
+	          1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_probe_cache_get_entry_path function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_probe_cache_get_entry_path(
+     void )
+{
+	char path[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_probe_cache_get_entry_path(
+	          SMDEV_TEST_PROBE_CACHE_DIRECTORY,
+	          "",
+	          path,
+	          64,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          SMDEV_TEST_PROBE_CACHE_DIRECTORY "/cbf29ce484222325.cache",
+	          sizeof( SMDEV_TEST_PROBE_CACHE_DIRECTORY "/cbf29ce484222325.cache" ) );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_probe_cache_get_entry_path(
+	          NULL,
+	          "",
+	          path,
+	          64,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_probe_cache_get_entry_path(
+	          SMDEV_TEST_PROBE_CACHE_DIRECTORY,
+	          "",
+	          path,
+	          8,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_probe_cache_write_data and libsmdev_probe_cache_read_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_probe_cache_write_and_read_data(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	libcerror_error_t *error                    = NULL;
+	libsmdev_handle_t *handle                   = NULL;
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	const char *key                             = "naa.5000c500a1b2c3d4:500107862016:0";
+	size_t entry_size                           = 0;
+	uint64_t number_of_sectors                  = 0;
+	uint64_t start_sector                       = 0;
+	int number_of_sessions                      = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "handle",
+	 handle );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	internal_handle->bus_type              = LIBSMDEV_BUS_TYPE_SCSI;
+	internal_handle->device_type           = 0x05;
+	internal_handle->media_information_set = 1;
+
+	result = narrow_string_snprintf(
+	          (char *) internal_handle->vendor,
+	          64,
+	          "%s",
+	          "Vendor" );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 6 );
+
+	result = libsmdev_handle_append_session(
+	          internal_handle,
+	          0,
+	          1024,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_handle->table_of_contents_set = 1;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_probe_cache_write_data(
+	          internal_handle,
+	          key,
+	          data,
+	          1024,
+	          &entry_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "entry_size",
+	 entry_size,
+	 (size_t) sizeof( libsmdev_probe_cache_entry_header_t ) + LIBSMDEV_PROBE_CACHE_SECTOR_RANGE_SIZE );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	/* Test if an entry with a different key is ignored
+	 */
+	result = libsmdev_probe_cache_read_data(
+	          internal_handle,
+	          "naa.5000c500a1b2c3d4:500107862016:1",
+	          data,
+	          entry_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a truncated entry is ignored
+	 */
+	result = libsmdev_probe_cache_read_data(
+	          internal_handle,
+	          key,
+	          data,
+	          entry_size - 1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a corrupted entry is ignored
+	 */
+	data[ entry_size - 1 ] ^= 0xff;
+
+	result = libsmdev_probe_cache_read_data(
+	          internal_handle,
+	          key,
+	          data,
+	          entry_size,
+	          &error );
+
+	data[ entry_size - 1 ] ^= 0xff;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_handle->media_information_set",
+	 internal_handle->media_information_set,
+	 0 );
+
+	/* Test if a valid entry is restored
+	 */
+	result = libsmdev_probe_cache_read_data(
+	          internal_handle,
+	          key,
+	          data,
+	          entry_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_handle->media_information_set",
+	 internal_handle->media_information_set,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_handle->table_of_contents_set",
+	 internal_handle->table_of_contents_set,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_handle->device_type",
+	 internal_handle->device_type,
+	 0x05 );
+
+	result = narrow_string_compare(
+	          (char *) internal_handle->vendor,
+	          "Vendor",
+	          7 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsmdev_handle_get_number_of_sessions(
+	          handle,
+	          &number_of_sessions,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sessions",
+	 number_of_sessions,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_session(
+	          handle,
+	          0,
+	          &start_sector,
+	          &number_of_sectors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 1024 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_probe_cache_write_data(
+	          internal_handle,
+	          key,
+	          data,
+	          16,
+	          &entry_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_probe_cache_read_data(
+	          NULL,
+	          key,
+	          data,
+	          entry_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "handle",
+	 handle );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_set_probe_cache_directory",
+	 smdev_test_handle_set_probe_cache_directory );
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_probe_cache_calculate_checksum",
+	 smdev_test_probe_cache_calculate_checksum );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_probe_cache_get_entry_path",
+	 smdev_test_probe_cache_get_entry_path );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_probe_cache_write_data",
+	 smdev_test_probe_cache_write_and_read_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
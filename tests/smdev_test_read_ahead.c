@@ -0,0 +1,855 @@
+/*
+ * Library read-ahead functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_functions.h"
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_handle.h"
+#include "../libsmdev/libsmdev_read_ahead.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+/* The path of the scenario file
+ */
+char smdev_test_read_ahead_scenario_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The scenario of the simulated device
+ */
+const char *smdev_test_read_ahead_scenario = \
+	"size 0x1000000\n";
+
+/* Tests the libsmdev_read_ahead_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_read_ahead_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libsmdev_read_ahead_t *read_ahead = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_read_ahead_initialize(
+	          &read_ahead,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->file_descriptor",
+	 read_ahead->file_descriptor,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->access_pattern",
+	 read_ahead->access_pattern,
+	 LIBSMDEV_ACCESS_PATTERN_AUTOMATIC );
+
+	result = libsmdev_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "read_ahead",
+	 read_ahead );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_read_ahead_initialize(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libsmdev_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_read_ahead_update function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_read_ahead_update(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libsmdev_read_ahead_t *read_ahead = NULL;
+	off64_t offset                    = 0;
+	int read_index                    = 0;
+	int result                        = 0;
+
+	result = libsmdev_read_ahead_initialize(
+	          &read_ahead,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that sequential access is detected after a number of consecutive reads
+	 */
+	for( read_index = 1;
+	     read_index < LIBSMDEV_READ_AHEAD_DETECTION_THRESHOLD;
+	     read_index++ )
+	{
+		result = libsmdev_read_ahead_update(
+		          read_ahead,
+		          offset,
+		          65536 );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		offset += 65536;
+	}
+	/* Test that a small gap is still considered sequential
+	 */
+	offset += 4096;
+
+	result = libsmdev_read_ahead_update(
+	          read_ahead,
+	          offset,
+	          65536 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->access_pattern",
+	 read_ahead->access_pattern,
+	 LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "read_ahead->drop_behind_offset",
+	 (int64_t) read_ahead->drop_behind_offset,
+	 (int64_t) offset );
+
+	/* Test that a single random read does not change the access pattern
+	 */
+	result = libsmdev_read_ahead_update(
+	          read_ahead,
+	          0x800000,
+	          4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->access_pattern",
+	 read_ahead->access_pattern,
+	 LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL );
+
+	/* Test that random access is detected after a number of consecutive reads
+	 */
+	offset = 0x400000;
+
+	for( read_index = 1;
+	     read_index < LIBSMDEV_READ_AHEAD_DETECTION_THRESHOLD;
+	     read_index++ )
+	{
+		result = libsmdev_read_ahead_update(
+		          read_ahead,
+		          offset,
+		          4096 );
+
+		offset -= 0x100000;
+	}
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->access_pattern",
+	 read_ahead->access_pattern,
+	 LIBSMDEV_ACCESS_PATTERN_RANDOM );
+
+	/* Test that a configured access pattern overrides detection
+	 */
+	read_ahead->configured_access_pattern = LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL;
+
+	result = libsmdev_read_ahead_update(
+	          read_ahead,
+	          0,
+	          4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "read_ahead->access_pattern",
+	 read_ahead->access_pattern,
+	 LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL );
+
+	result = libsmdev_read_ahead_update(
+	          read_ahead,
+	          0x800000,
+	          4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_read_ahead_update(
+	          NULL,
+	          0,
+	          4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsmdev_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libsmdev_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_read_ahead_drop_behind function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_read_ahead_drop_behind(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libsmdev_read_ahead_t *read_ahead = NULL;
+	int result                        = 0;
+
+	result = libsmdev_read_ahead_initialize(
+	          &read_ahead,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that nothing is dropped without sequential access
+	 */
+	result = libsmdev_read_ahead_drop_behind(
+	          read_ahead,
+	          (off64_t) LIBSMDEV_READ_AHEAD_DROP_BEHIND_SIZE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that consumed data is dropped in batches
+	 */
+	read_ahead->access_pattern     = LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL;
+	read_ahead->drop_behind_offset = 4096;
+
+	result = libsmdev_read_ahead_drop_behind(
+	          read_ahead,
+	          (off64_t) LIBSMDEV_READ_AHEAD_DROP_BEHIND_SIZE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "read_ahead->drop_behind_offset",
+	 (int64_t) read_ahead->drop_behind_offset,
+	 (int64_t) 4096 );
+
+	result = libsmdev_read_ahead_drop_behind(
+	          read_ahead,
+	          (off64_t) LIBSMDEV_READ_AHEAD_DROP_BEHIND_SIZE + 4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "read_ahead->drop_behind_offset",
+	 (int64_t) read_ahead->drop_behind_offset,
+	 (int64_t) LIBSMDEV_READ_AHEAD_DROP_BEHIND_SIZE + 4096 );
+
+	/* Test that reading backwards restarts the drop-behind range
+	 */
+	result = libsmdev_read_ahead_drop_behind(
+	          read_ahead,
+	          8192,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "read_ahead->drop_behind_offset",
+	 (int64_t) read_ahead->drop_behind_offset,
+	 (int64_t) 8192 );
+
+	/* Test that the read-ahead window is not changed without a device
+	 */
+	result = libsmdev_read_ahead_set_window(
+	          read_ahead,
+	          LIBSMDEV_ACCESS_PATTERN_RANDOM,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_read_ahead_drop_behind(
+	          read_ahead,
+	          -1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_read_ahead_set_window(
+	          read_ahead,
+	          -1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_read_ahead_free(
+	          &read_ahead,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_ahead != NULL )
+	{
+		libsmdev_read_ahead_free(
+		 &read_ahead,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_get_access_pattern and libsmdev_handle_set_access_pattern functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_handle_access_pattern(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+
+	libcerror_error_t *error  = NULL;
+	libsmdev_handle_t *handle = NULL;
+	ssize_t read_count        = 0;
+	off64_t offset            = 0;
+	int access_pattern        = 0;
+	int read_index            = 0;
+	int result                = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_read_ahead_scenario_path,
+	          (const uint8_t *) smdev_test_read_ahead_scenario,
+	          narrow_string_length(
+	           smdev_test_read_ahead_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_read_ahead_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_access_pattern(
+	          handle,
+	          &access_pattern,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "access_pattern",
+	 access_pattern,
+	 LIBSMDEV_ACCESS_PATTERN_AUTOMATIC );
+
+	/* Test that sequential reads are detected
+	 */
+	for( read_index = 0;
+	     read_index < LIBSMDEV_READ_AHEAD_DETECTION_THRESHOLD;
+	     read_index++ )
+	{
+		read_count = libsmdev_handle_read_buffer(
+		              handle,
+		              buffer,
+		              4096,
+		              &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4096 );
+	}
+	result = libsmdev_handle_get_access_pattern(
+	          handle,
+	          &access_pattern,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "access_pattern",
+	 access_pattern,
+	 LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL );
+
+	/* Test that random reads are detected
+	 */
+	offset = 0x800000;
+
+	for( read_index = 0;
+	     read_index < LIBSMDEV_READ_AHEAD_DETECTION_THRESHOLD;
+	     read_index++ )
+	{
+		read_count = libsmdev_handle_read_buffer_at_offset(
+		              handle,
+		              buffer,
+		              4096,
+		              offset,
+		              &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 4096 );
+
+		offset -= 0x100000;
+	}
+	result = libsmdev_handle_get_access_pattern(
+	          handle,
+	          &access_pattern,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "access_pattern",
+	 access_pattern,
+	 LIBSMDEV_ACCESS_PATTERN_RANDOM );
+
+	/* Test that a configured access pattern is applied directly
+	 */
+	result = libsmdev_handle_set_access_pattern(
+	          handle,
+	          LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_access_pattern(
+	          handle,
+	          &access_pattern,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "access_pattern",
+	 access_pattern,
+	 LIBSMDEV_ACCESS_PATTERN_SEQUENTIAL );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_set_access_pattern(
+	          handle,
+	          -1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_get_access_pattern(
+	          handle,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that the detected access pattern is reset on close
+	 */
+	result = libsmdev_handle_set_access_pattern(
+	          handle,
+	          LIBSMDEV_ACCESS_PATTERN_AUTOMATIC,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_access_pattern(
+	          handle,
+	          &access_pattern,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "access_pattern",
+	 access_pattern,
+	 LIBSMDEV_ACCESS_PATTERN_AUTOMATIC );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_read_ahead_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_read_ahead_scenario_path );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_read_ahead",
+	     smdev_test_read_ahead_scenario_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	SMDEV_TEST_RUN(
+	 "libsmdev_read_ahead_initialize",
+	 smdev_test_read_ahead_initialize );
+
+	/* libsmdev_read_ahead_free is tested in smdev_test_read_ahead_initialize */
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_read_ahead_update",
+	 smdev_test_read_ahead_update );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_read_ahead_drop_behind",
+	 smdev_test_read_ahead_drop_behind );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_access_pattern",
+	 smdev_test_handle_access_pattern );
+
+	remove(
+	 smdev_test_read_ahead_scenario_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	remove(
+	 smdev_test_read_ahead_scenario_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_FAILURE );
+}
+
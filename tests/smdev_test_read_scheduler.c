@@ -0,0 +1,960 @@
+/*
+ * Library read scheduler functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_functions.h"
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_handle.h"
+#include "../libsmdev/libsmdev_read_request.h"
+#include "../libsmdev/libsmdev_read_scheduler.h"
+#include "../libsmdev/libsmdev_simulated_device.h"
+
+#define SMDEV_TEST_READ_SCHEDULER_MAXIMUM_NUMBER_OF_CALLS	16
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+/* The path of the scenario file
+ */
+char smdev_test_read_scheduler_scenario_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The scenario of the simulated device
+ */
+const char *smdev_test_read_scheduler_scenario = \
+	"size 0x1000000\n";
+
+typedef struct smdev_test_read_scheduler_calls smdev_test_read_scheduler_calls_t;
+
+struct smdev_test_read_scheduler_calls
+{
+	/* The request indexes in the order the read callback was called
+	 */
+	int request_indexes[ SMDEV_TEST_READ_SCHEDULER_MAXIMUM_NUMBER_OF_CALLS ];
+
+	/* The offsets in the order the read callback was called
+	 */
+	off64_t offsets[ SMDEV_TEST_READ_SCHEDULER_MAXIMUM_NUMBER_OF_CALLS ];
+
+	/* The data sizes in the order the read callback was called
+	 */
+	size_t data_sizes[ SMDEV_TEST_READ_SCHEDULER_MAXIMUM_NUMBER_OF_CALLS ];
+
+	/* The number of calls
+	 */
+	int number_of_calls;
+
+	/* The number of calls after which reading is aborted, or 0 if not
+	 */
+	int abort_after_number_of_calls;
+
+	/* Value to indicate the data did not match the simulated device
+	 */
+	int invalid_data;
+};
+
+/* Records a call of the read callback and checks the data against the simulated device
+ * Returns 1 to continue reading or 0 to abort
+ */
+int smdev_test_read_scheduler_read_callback(
+     smdev_test_read_scheduler_calls_t *calls,
+     int request_index,
+     off64_t offset,
+     const uint8_t *data,
+     size_t data_size )
+{
+	size_t data_index = 0;
+
+	if( calls->number_of_calls >= SMDEV_TEST_READ_SCHEDULER_MAXIMUM_NUMBER_OF_CALLS )
+	{
+		return( 0 );
+	}
+	for( data_index = 0;
+	     data_index < data_size;
+	     data_index++ )
+	{
+		if( data[ data_index ] != (uint8_t) ( ( offset + data_index ) % 251 ) )
+		{
+			calls->invalid_data = 1;
+
+			break;
+		}
+	}
+	calls->request_indexes[ calls->number_of_calls ] = request_index;
+	calls->offsets[ calls->number_of_calls ]         = offset;
+	calls->data_sizes[ calls->number_of_calls ]      = data_size;
+
+	calls->number_of_calls += 1;
+
+	if( calls->number_of_calls == calls->abort_after_number_of_calls )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libsmdev_read_request_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_read_request_compare(
+     void )
+{
+	libsmdev_read_request_t read_requests[ 4 ] = {
+		{ 0x2000, 512, 0, 0 },
+		{ 0x1000, 512, 0, 1 },
+		{ 0x8000, 512, 1, 2 },
+		{ 0x1000, 512, 0, 3 } };
+
+	libsmdev_read_request_t *sorted_requests[ 4 ];
+
+	int request_index = 0;
+
+	for( request_index = 0;
+	     request_index < 4;
+	     request_index++ )
+	{
+		sorted_requests[ request_index ] = &( read_requests[ request_index ] );
+	}
+	qsort(
+	 sorted_requests,
+	 4,
+	 sizeof( libsmdev_read_request_t * ),
+	 &libsmdev_read_request_compare );
+
+	/* The request with the highest priority comes first, requests with the same offset remain in append order
+	 */
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "sorted_requests[ 0 ]->request_index",
+	 sorted_requests[ 0 ]->request_index,
+	 2 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "sorted_requests[ 1 ]->request_index",
+	 sorted_requests[ 1 ]->request_index,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "sorted_requests[ 2 ]->request_index",
+	 sorted_requests[ 2 ]->request_index,
+	 3 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "sorted_requests[ 3 ]->request_index",
+	 sorted_requests[ 3 ]->request_index,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libsmdev_read_scheduler_get_extent function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_read_scheduler_get_extent(
+     void )
+{
+	libsmdev_read_request_t read_requests[ 6 ] = {
+		{ 0x1000, 0x200, 0, 0 },
+		{ 0x1100, 0x400, 0, 1 },
+		{ 0x1800, 0x200, 0, 2 },
+		{ 0x200000, 0x100, 0, 3 },
+		{ 0x200100, 0x800000, 0, 4 },
+		{ 0x300000, 0x200, -1, 5 } };
+
+	libsmdev_read_request_t *sorted_requests[ 6 ];
+
+	libcerror_error_t *error      = NULL;
+	size64_t extent_size          = 0;
+	off64_t extent_offset         = 0;
+	int number_of_extent_requests = 0;
+	int request_index             = 0;
+	int result                    = 0;
+
+	for( request_index = 0;
+	     request_index < 6;
+	     request_index++ )
+	{
+		sorted_requests[ request_index ] = &( read_requests[ request_index ] );
+	}
+	/* Test regular cases
+	 * The gap of 0x300 bytes between the second and third request is filled
+	 */
+	result = libsmdev_read_scheduler_get_extent(
+	          sorted_requests,
+	          6,
+	          0,
+	          0x1000,
+	          &number_of_extent_requests,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extent_requests",
+	 number_of_extent_requests,
+	 3 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "extent_offset",
+	 (int64_t) extent_offset,
+	 (int64_t) 0x1000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_size",
+	 (uint64_t) extent_size,
+	 (uint64_t) 0xa00 );
+
+	/* Overlapping requests are coalesced without a gap
+	 */
+	result = libsmdev_read_scheduler_get_extent(
+	          sorted_requests,
+	          6,
+	          0,
+	          0,
+	          &number_of_extent_requests,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extent_requests",
+	 number_of_extent_requests,
+	 2 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_size",
+	 (uint64_t) extent_size,
+	 (uint64_t) 0x500 );
+
+	/* An adjacent request is not coalesced if the extent would exceed the maximum extent size
+	 */
+	result = libsmdev_read_scheduler_get_extent(
+	          sorted_requests,
+	          6,
+	          3,
+	          0,
+	          &number_of_extent_requests,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extent_requests",
+	 number_of_extent_requests,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_size",
+	 (uint64_t) extent_size,
+	 (uint64_t) 0x100 );
+
+	/* A request that exceeds the maximum extent size is an extent by itself
+	 * and requests of a different priority are not coalesced
+	 */
+	result = libsmdev_read_scheduler_get_extent(
+	          sorted_requests,
+	          6,
+	          4,
+	          0x1000000,
+	          &number_of_extent_requests,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extent_requests",
+	 number_of_extent_requests,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_size",
+	 (uint64_t) extent_size,
+	 (uint64_t) 0x800000 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_read_scheduler_get_extent(
+	          NULL,
+	          6,
+	          0,
+	          0,
+	          &number_of_extent_requests,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_read_scheduler_get_extent(
+	          sorted_requests,
+	          6,
+	          6,
+	          0,
+	          &number_of_extent_requests,
+	          &extent_offset,
+	          &extent_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_read_requests function on a simulated device
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_read_scheduler_read_requests(
+     void )
+{
+	smdev_test_read_scheduler_calls_t calls;
+
+	int expected_request_indexes[ 8 ] = { 3, 5, 1, 4, 2, 0, 6, 6 };
+
+	libcerror_error_t *error            = NULL;
+	libsmdev_handle_t *handle           = NULL;
+	libsmdev_simulated_device_t *device = NULL;
+	uint64_t number_of_reads            = 0;
+	size_t maximum_read_gap_size        = 0;
+	int call_index                      = 0;
+	int number_of_read_requests         = 0;
+	int request_index                   = 0;
+	int result                          = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_read_scheduler_scenario_path,
+	          (const uint8_t *) smdev_test_read_scheduler_scenario,
+	          narrow_string_length(
+	           smdev_test_read_scheduler_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_read_scheduler_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	device = (libsmdev_simulated_device_t *) ( (libsmdev_internal_handle_t *) handle )->io_backend->io_handle;
+
+	/* The requests are appended out of order
+	 */
+	result = libsmdev_handle_append_read_request(
+	          handle,
+	          0x300000,
+	          0x1000,
+	          0,
+	          &request_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "request_index",
+	 request_index,
+	 0 );
+
+	result = libsmdev_handle_append_read_request(
+	          handle,
+	          0x1000,
+	          0x200,
+	          0,
+	          &request_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_append_read_request(
+	          handle,
+	          0x1400,
+	          0x200,
+	          0,
+	          &request_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_append_read_request(
+	          handle,
+	          0x200000,
+	          0x800,
+	          1,
+	          &request_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_append_read_request(
+	          handle,
+	          0x1300,
+	          0x400,
+	          0,
+	          &request_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_append_read_request(
+	          handle,
+	          0x200400,
+	          0x100,
+	          1,
+	          &request_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* A request larger than the maximum extent size is passed in parts
+	 */
+	result = libsmdev_handle_append_read_request(
+	          handle,
+	          0x400000,
+	          0x900000,
+	          -1,
+	          &request_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "request_index",
+	 request_index,
+	 6 );
+
+	result = libsmdev_handle_get_number_of_read_requests(
+	          handle,
+	          &number_of_read_requests,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_read_requests",
+	 number_of_read_requests,
+	 7 );
+
+	result = libsmdev_handle_get_maximum_read_gap_size(
+	          handle,
+	          &maximum_read_gap_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_read_gap_size",
+	 maximum_read_gap_size,
+	 (size_t) LIBSMDEV_READ_SCHEDULER_DEFAULT_MAXIMUM_GAP_SIZE );
+
+	/* Test regular cases
+	 * The requests are passed by priority and then by offset
+	 */
+	memory_set(
+	 &calls,
+	 0,
+	 sizeof( smdev_test_read_scheduler_calls_t ) );
+
+	number_of_reads = device->number_of_reads;
+
+	result = libsmdev_handle_read_requests(
+	          handle,
+	          (int (*)(void *, int, off64_t, const uint8_t *, size_t)) &smdev_test_read_scheduler_read_callback,
+	          &calls,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "calls.number_of_calls",
+	 calls.number_of_calls,
+	 8 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "calls.invalid_data",
+	 calls.invalid_data,
+	 0 );
+
+	for( call_index = 0;
+	     call_index < 8;
+	     call_index++ )
+	{
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "calls.request_indexes",
+		 calls.request_indexes[ call_index ],
+		 expected_request_indexes[ call_index ] );
+	}
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "calls.offsets[ 7 ]",
+	 (int64_t) calls.offsets[ 7 ],
+	 (int64_t) 0xc00000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "calls.data_sizes[ 7 ]",
+	 calls.data_sizes[ 7 ],
+	 (size_t) 0x100000 );
+
+	/* The 7 requests are read in 5 extents of which the last one in 2 parts
+	 */
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_reads",
+	 (uint64_t) ( device->number_of_reads - number_of_reads ),
+	 (uint64_t) 5 );
+
+	/* Without gap filling only adjacent or overlapping requests are coalesced
+	 */
+	result = libsmdev_handle_set_maximum_read_gap_size(
+	          handle,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_set(
+	 &calls,
+	 0,
+	 sizeof( smdev_test_read_scheduler_calls_t ) );
+
+	number_of_reads = device->number_of_reads;
+
+	result = libsmdev_handle_read_requests(
+	          handle,
+	          (int (*)(void *, int, off64_t, const uint8_t *, size_t)) &smdev_test_read_scheduler_read_callback,
+	          &calls,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "calls.number_of_calls",
+	 calls.number_of_calls,
+	 8 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_reads",
+	 (uint64_t) ( device->number_of_reads - number_of_reads ),
+	 (uint64_t) 6 );
+
+	/* Reading is aborted when the read callback does not return 1
+	 */
+	memory_set(
+	 &calls,
+	 0,
+	 sizeof( smdev_test_read_scheduler_calls_t ) );
+
+	calls.abort_after_number_of_calls = 3;
+
+	result = libsmdev_handle_read_requests(
+	          handle,
+	          (int (*)(void *, int, off64_t, const uint8_t *, size_t)) &smdev_test_read_scheduler_read_callback,
+	          &calls,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "calls.number_of_calls",
+	 calls.number_of_calls,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_append_read_request(
+	          handle,
+	          -1,
+	          0x200,
+	          0,
+	          &request_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_append_read_request(
+	          handle,
+	          0,
+	          0,
+	          0,
+	          &request_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_set_maximum_read_gap_size(
+	          handle,
+	          (size_t) LIBSMDEV_READ_SCHEDULER_MAXIMUM_EXTENT_SIZE + 1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_read_requests(
+	          handle,
+	          NULL,
+	          &calls,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A request beyond the end of the media fails to read
+	 */
+	result = libsmdev_handle_append_read_request(
+	          handle,
+	          0xfff000,
+	          0x2000,
+	          2,
+	          &request_index,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_read_requests(
+	          handle,
+	          (int (*)(void *, int, off64_t, const uint8_t *, size_t)) &smdev_test_read_scheduler_read_callback,
+	          &calls,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_empty_read_requests(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_get_number_of_read_requests(
+	          handle,
+	          &number_of_read_requests,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_read_requests",
+	 number_of_read_requests,
+	 0 );
+
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_read_scheduler_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_read_scheduler_scenario_path );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_read_scheduler",
+	     smdev_test_read_scheduler_scenario_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	SMDEV_TEST_RUN(
+	 "libsmdev_read_request_compare",
+	 smdev_test_read_request_compare );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_read_scheduler_get_extent",
+	 smdev_test_read_scheduler_get_extent );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_read_requests",
+	 smdev_test_read_scheduler_read_requests );
+
+	remove(
+	 smdev_test_read_scheduler_scenario_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	remove(
+	 smdev_test_read_scheduler_scenario_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_FAILURE );
+}
+
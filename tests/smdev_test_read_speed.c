@@ -0,0 +1,683 @@
+/*
+ * Library read speed functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_handle.h"
+#include "../libsmdev/libsmdev_read_speed.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+/* Tests the libsmdev_read_speed_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_read_speed_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libsmdev_read_speed_t *read_speed = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_read_speed_initialize(
+	          &read_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "read_speed",
+	 read_speed );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "read_speed->policy",
+	 read_speed->policy,
+	 LIBSMDEV_READ_SPEED_POLICY_FIXED );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "read_speed->speed",
+	 read_speed->speed,
+	 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "read_speed->speed_changed",
+	 read_speed->speed_changed,
+	 0 );
+
+	result = libsmdev_read_speed_free(
+	          &read_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "read_speed",
+	 read_speed );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_read_speed_initialize(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_speed != NULL )
+	{
+		libsmdev_read_speed_free(
+		 &read_speed,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_read_speed_get_transfer_rate function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_read_speed_get_transfer_rate(
+     void )
+{
+	uint16_t transfer_rate = 0;
+
+	transfer_rate = libsmdev_read_speed_get_transfer_rate(
+	                 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "transfer_rate",
+	 transfer_rate,
+	 LIBSMDEV_READ_SPEED_MAXIMUM_TRANSFER_RATE );
+
+	transfer_rate = libsmdev_read_speed_get_transfer_rate(
+	                 8 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "transfer_rate",
+	 transfer_rate,
+	 8 * LIBSMDEV_READ_SPEED_UNIT_TRANSFER_RATE );
+
+	/* Test that a speed that exceeds the maximum transfer rate is capped
+	 */
+	transfer_rate = libsmdev_read_speed_get_transfer_rate(
+	                 1024 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "transfer_rate",
+	 transfer_rate,
+	 LIBSMDEV_READ_SPEED_MAXIMUM_TRANSFER_RATE );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libsmdev_read_speed_update function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_read_speed_update(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libsmdev_read_speed_t *read_speed = NULL;
+	int result                        = 0;
+	int window_index                  = 0;
+
+	result = libsmdev_read_speed_initialize(
+	          &read_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the fixed policy does not change the speed
+	 */
+	result = libsmdev_read_speed_update(
+	          read_speed,
+	          27,
+	          27,
+	          30000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "read_speed->speed",
+	 read_speed->speed,
+	 0 );
+
+	/* Test that an unreadable sector lowers the speed immediately
+	 */
+	read_speed->policy = LIBSMDEV_READ_SPEED_POLICY_ADAPTIVE;
+
+	result = libsmdev_read_speed_update(
+	          read_speed,
+	          27,
+	          1,
+	          100 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "read_speed->speed",
+	 read_speed->speed,
+	 LIBSMDEV_READ_SPEED_INITIAL_REDUCED_SPEED );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "read_speed->speed_changed",
+	 read_speed->speed_changed,
+	 1 );
+
+	result = libsmdev_read_speed_update(
+	          read_speed,
+	          27,
+	          27,
+	          30000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "read_speed->speed",
+	 read_speed->speed,
+	 LIBSMDEV_READ_SPEED_INITIAL_REDUCED_SPEED / 2 );
+
+	/* Test that a window with many slow sectors lowers the speed
+	 */
+	result = libsmdev_read_speed_update(
+	          read_speed,
+	          LIBSMDEV_READ_SPEED_WINDOW_SIZE / 2,
+	          0,
+	          100 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsmdev_read_speed_update(
+	          read_speed,
+	          LIBSMDEV_READ_SPEED_WINDOW_SIZE / 2,
+	          0,
+	          LIBSMDEV_READ_SPEED_WINDOW_SIZE * LIBSMDEV_READ_SPEED_SLOW_SECTOR_DURATION );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "read_speed->speed",
+	 read_speed->speed,
+	 LIBSMDEV_READ_SPEED_INITIAL_REDUCED_SPEED / 4 );
+
+	/* Test that the speed is raised after a number of clean windows
+	 */
+	for( window_index = 1;
+	     window_index < LIBSMDEV_READ_SPEED_RECOVERY_THRESHOLD;
+	     window_index++ )
+	{
+		result = libsmdev_read_speed_update(
+		          read_speed,
+		          LIBSMDEV_READ_SPEED_WINDOW_SIZE,
+		          0,
+		          1000 );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = libsmdev_read_speed_update(
+	          read_speed,
+	          LIBSMDEV_READ_SPEED_WINDOW_SIZE,
+	          0,
+	          1000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "read_speed->speed",
+	 read_speed->speed,
+	 LIBSMDEV_READ_SPEED_INITIAL_REDUCED_SPEED / 2 );
+
+	/* Test that the speed returns to the maximum speed of the drive
+	 */
+	for( window_index = 0;
+	     window_index < ( 2 * LIBSMDEV_READ_SPEED_RECOVERY_THRESHOLD );
+	     window_index++ )
+	{
+		result = libsmdev_read_speed_update(
+		          read_speed,
+		          LIBSMDEV_READ_SPEED_WINDOW_SIZE,
+		          0,
+		          1000 );
+	}
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "read_speed->speed",
+	 read_speed->speed,
+	 0 );
+
+	/* Test that the speed does not exceed a configured maximum speed
+	 */
+	result = libsmdev_read_speed_set_maximum_speed(
+	          read_speed,
+	          4,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "read_speed->speed",
+	 read_speed->speed,
+	 4 );
+
+	result = libsmdev_read_speed_update(
+	          read_speed,
+	          1,
+	          1,
+	          0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "read_speed->speed",
+	 read_speed->speed,
+	 2 );
+
+	for( window_index = 0;
+	     window_index < ( 2 * LIBSMDEV_READ_SPEED_RECOVERY_THRESHOLD );
+	     window_index++ )
+	{
+		result = libsmdev_read_speed_update(
+		          read_speed,
+		          LIBSMDEV_READ_SPEED_WINDOW_SIZE,
+		          0,
+		          1000 );
+	}
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "read_speed->speed",
+	 read_speed->speed,
+	 4 );
+
+	/* Test that the speed is not lowered below 1x
+	 */
+	read_speed->speed = 1;
+
+	result = libsmdev_read_speed_update(
+	          read_speed,
+	          1,
+	          1,
+	          0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "read_speed->speed",
+	 read_speed->speed,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_read_speed_update(
+	          NULL,
+	          1,
+	          1,
+	          0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libsmdev_read_speed_free(
+	          &read_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_speed != NULL )
+	{
+		libsmdev_read_speed_free(
+		 &read_speed,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_get_read_speed, libsmdev_handle_set_read_speed,
+ * libsmdev_handle_get_read_speed_policy and libsmdev_handle_set_read_speed_policy functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_handle_read_speed(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libsmdev_handle_t *handle = NULL;
+	uint16_t read_speed       = 0;
+	int read_speed_policy     = 0;
+	int result                = 0;
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_handle_set_read_speed(
+	          handle,
+	          8,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_read_speed(
+	          handle,
+	          &read_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT16(
+	 "read_speed",
+	 read_speed,
+	 8 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_read_speed_policy(
+	          handle,
+	          LIBSMDEV_READ_SPEED_POLICY_ADAPTIVE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_read_speed_policy(
+	          handle,
+	          &read_speed_policy,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "read_speed_policy",
+	 read_speed_policy,
+	 LIBSMDEV_READ_SPEED_POLICY_ADAPTIVE );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_get_read_speed(
+	          handle,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_set_read_speed_policy(
+	          handle,
+	          -1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_get_read_speed_policy(
+	          handle,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_read_speed_initialize",
+	 smdev_test_read_speed_initialize );
+
+	/* libsmdev_read_speed_free is tested in smdev_test_read_speed_initialize */
+
+	/* libsmdev_read_speed_reset is tested in smdev_test_read_speed_update */
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_read_speed_get_transfer_rate",
+	 smdev_test_read_speed_get_transfer_rate );
+
+	/* libsmdev_read_speed_set_maximum_speed is tested in smdev_test_read_speed_update */
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_read_speed_update",
+	 smdev_test_read_speed_update );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_read_speed",
+	 smdev_test_handle_read_speed );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1074 @@
+/*
+ * Library sampler functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_functions.h"
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_handle.h"
+#include "../libsmdev/libsmdev_partition_table.h"
+#include "../libsmdev/libsmdev_sample_region.h"
+#include "../libsmdev/libsmdev_sampler.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+/* The path of the scenario file
+ */
+char smdev_test_sampler_scenario_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The scenario of the simulated device
+ * The first region of the media cannot be read
+ */
+const char *smdev_test_sampler_scenario = \
+	"size 0x1000000\n"
+	"bad 0 0x400000\n";
+
+/* Tests the libsmdev_sample_region_log2 and libsmdev_sample_region_calculate_entropy functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sample_region_calculate_entropy(
+     void )
+{
+	uint64_t byte_counts[ 256 ];
+
+	double entropy = 0.0;
+	int byte_value = 0;
+	int result     = 0;
+
+	/* Test the logarithm of powers of 2 and other values
+	 */
+	result = (int) ( libsmdev_sample_region_log2(
+	                  1 ) * 1000000.0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = (int) ( libsmdev_sample_region_log2(
+	                  1024 ) * 1000000.0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 10000000 );
+
+	result = (int) ( libsmdev_sample_region_log2(
+	                  3 ) * 1000000.0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1584962 );
+
+	result = (int) ( libsmdev_sample_region_log2(
+	                  1000000 ) * 1000000.0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 19931568 );
+
+	/* Test data with a single byte value
+	 */
+	memory_set(
+	 byte_counts,
+	 0,
+	 sizeof( uint64_t ) * 256 );
+
+	byte_counts[ 0 ] = 4096;
+
+	entropy = libsmdev_sample_region_calculate_entropy(
+	           byte_counts,
+	           4096 );
+
+	result = (int) ( entropy * 1000.0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test data with two byte values that occur equally often
+	 */
+	byte_counts[ 0 ]    = 2048;
+	byte_counts[ 0xff ] = 2048;
+
+	entropy = libsmdev_sample_region_calculate_entropy(
+	           byte_counts,
+	           4096 );
+
+	result = (int) ( ( entropy * 1000.0 ) + 0.5 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1000 );
+
+	/* Test data with all byte values that occur equally often
+	 */
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		byte_counts[ byte_value ] = 16;
+	}
+	entropy = libsmdev_sample_region_calculate_entropy(
+	           byte_counts,
+	           4096 );
+
+	result = (int) ( ( entropy * 1000.0 ) + 0.5 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 8000 );
+
+	/* Test error cases
+	 */
+	entropy = libsmdev_sample_region_calculate_entropy(
+	           NULL,
+	           4096 );
+
+	result = (int) ( entropy * 1000.0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	entropy = libsmdev_sample_region_calculate_entropy(
+	           byte_counts,
+	           0 );
+
+	result = (int) ( entropy * 1000.0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libsmdev_sampler_count_bytes function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sampler_count_bytes(
+     void )
+{
+	uint8_t data[ 1027 ];
+	uint64_t byte_counts[ 256 ];
+
+	size_t data_index = 0;
+
+	for( data_index = 0;
+	     data_index < 1027;
+	     data_index++ )
+	{
+		data[ data_index ] = (uint8_t) ( data_index % 256 );
+	}
+	memory_set(
+	 byte_counts,
+	 0,
+	 sizeof( uint64_t ) * 256 );
+
+	byte_counts[ 0 ] = 10;
+
+	/* The data size is not a multiple of 4 and the counts are added
+	 */
+	libsmdev_sampler_count_bytes(
+	 data,
+	 1027,
+	 byte_counts );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "byte_counts[ 0 ]",
+	 byte_counts[ 0 ],
+	 (uint64_t) 15 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "byte_counts[ 2 ]",
+	 byte_counts[ 2 ],
+	 (uint64_t) 5 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "byte_counts[ 3 ]",
+	 byte_counts[ 3 ],
+	 (uint64_t) 4 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "byte_counts[ 255 ]",
+	 byte_counts[ 255 ],
+	 (uint64_t) 4 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libsmdev_partition_table_read_mbr, libsmdev_partition_table_read_gpt_header
+ * and libsmdev_partition_table_read_gpt_entries functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_partition_table_read(
+     void )
+{
+	uint8_t data[ 512 ];
+	uint8_t entries_data[ 4 * 128 ];
+
+	libcerror_error_t *error                    = NULL;
+	libsmdev_partition_table_t *partition_table = NULL;
+	off64_t entries_offset                      = 0;
+	off64_t partition_offset                    = 0;
+	size64_t partition_size                     = 0;
+	uint32_t entry_size                         = 0;
+	uint32_t number_of_entries                  = 0;
+	int result                                  = 0;
+
+	result = libsmdev_partition_table_initialize(
+	          &partition_table,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a MBR with 2 primary partitions
+	 */
+	memory_set(
+	 data,
+	 0,
+	 512 );
+
+	data[ 446 ]          = 0x80;
+	data[ 446 + 4 ]      = 0x07;
+	data[ 446 + 16 + 4 ] = 0x83;
+	data[ 510 ]          = 0x55;
+	data[ 511 ]          = 0xaa;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 446 + 8 ] ),
+	 2048 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 446 + 12 ] ),
+	 4096 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 446 + 16 + 8 ] ),
+	 6144 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 446 + 16 + 12 ] ),
+	 8192 );
+
+	result = libsmdev_partition_table_read_mbr(
+	          partition_table,
+	          data,
+	          512,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "partition_table->type",
+	 partition_table->type,
+	 LIBSMDEV_PARTITION_TABLE_TYPE_MBR );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "partition_table->number_of_partitions",
+	 partition_table->number_of_partitions,
+	 2 );
+
+	result = libsmdev_partition_table_get_partition(
+	          partition_table,
+	          1,
+	          &partition_offset,
+	          &partition_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "partition_offset",
+	 (int64_t) partition_offset,
+	 (int64_t) 6144 * 512 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "partition_size",
+	 (uint64_t) partition_size,
+	 (uint64_t) 8192 * 512 );
+
+	result = libsmdev_partition_table_get_partition(
+	          partition_table,
+	          2,
+	          &partition_offset,
+	          &partition_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a volume boot record, which has an invalid boot indicator
+	 */
+	data[ 446 + 16 ] = 0x33;
+
+	result = libsmdev_partition_table_read_mbr(
+	          partition_table,
+	          data,
+	          512,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a GPT header
+	 */
+	memory_set(
+	 data,
+	 0,
+	 512 );
+
+	memory_copy(
+	 data,
+	 "EFI PART",
+	 8 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 12 ] ),
+	 92 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 72 ] ),
+	 (uint64_t) 2 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 80 ] ),
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 84 ] ),
+	 128 );
+
+	result = libsmdev_partition_table_read_gpt_header(
+	          partition_table,
+	          data,
+	          512,
+	          4096,
+	          &entries_offset,
+	          &number_of_entries,
+	          &entry_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "entries_offset",
+	 (int64_t) entries_offset,
+	 (int64_t) 8192 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_entries",
+	 number_of_entries,
+	 4 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "entry_size",
+	 entry_size,
+	 128 );
+
+	/* Test GPT entries of which the second entry is unused
+	 */
+	memory_set(
+	 entries_data,
+	 0,
+	 4 * 128 );
+
+	entries_data[ 0 ]           = 0x28;
+	entries_data[ 2 * 128 + 3 ] = 0xa2;
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entries_data[ 32 ] ),
+	 (uint64_t) 256 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entries_data[ 40 ] ),
+	 (uint64_t) 511 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entries_data[ 2 * 128 + 32 ] ),
+	 (uint64_t) 512 );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( entries_data[ 2 * 128 + 40 ] ),
+	 (uint64_t) 1023 );
+
+	result = libsmdev_partition_table_read_gpt_entries(
+	          partition_table,
+	          entries_data,
+	          4 * 128,
+	          number_of_entries,
+	          entry_size,
+	          4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "partition_table->type",
+	 partition_table->type,
+	 LIBSMDEV_PARTITION_TABLE_TYPE_GPT );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "partition_table->number_of_partitions",
+	 partition_table->number_of_partitions,
+	 2 );
+
+	result = libsmdev_partition_table_get_partition(
+	          partition_table,
+	          1,
+	          &partition_offset,
+	          &partition_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "partition_offset",
+	 (int64_t) partition_offset,
+	 (int64_t) 512 * 4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "partition_size",
+	 (uint64_t) partition_size,
+	 (uint64_t) 512 * 4096 );
+
+	/* Test data without a GPT signature
+	 */
+	data[ 0 ] = 0;
+
+	result = libsmdev_partition_table_read_gpt_header(
+	          partition_table,
+	          data,
+	          512,
+	          4096,
+	          &entries_offset,
+	          &number_of_entries,
+	          &entry_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsmdev_partition_table_free(
+	          &partition_table,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( partition_table != NULL )
+	{
+		libsmdev_partition_table_free(
+		 &partition_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Samples the simulated device using a specific sampling method and number of threads
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sampler_sample(
+     int sampling_method,
+     int number_of_threads )
+{
+	libcerror_error_t *error              = NULL;
+	libsmdev_handle_t *handle             = NULL;
+	off64_t region_offset                 = 0;
+	size64_t region_size                  = 0;
+	double entropy                        = 0.0;
+	double high_entropy_fraction          = 0.0;
+	double zero_fraction                  = 0.0;
+	uint64_t number_of_samples            = 0;
+	uint64_t number_of_unreadable_samples = 0;
+	uint64_t total_number_of_samples      = 0;
+	uint8_t partition_table_type          = 0;
+	int number_of_partitions              = 0;
+	int number_of_regions                 = 0;
+	int region_index                      = 0;
+	int result                            = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_sampler_scenario_path,
+	          (const uint8_t *) smdev_test_sampler_scenario,
+	          narrow_string_length(
+	           smdev_test_sampler_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_set_number_of_read_threads(
+	          handle,
+	          number_of_threads,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_sampler_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_sample(
+	          handle,
+	          sampling_method,
+	          64,
+	          4096,
+	          4,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_number_of_sample_regions(
+	          handle,
+	          &number_of_regions,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_regions",
+	 number_of_regions,
+	 4 );
+
+	for( region_index = 0;
+	     region_index < number_of_regions;
+	     region_index++ )
+	{
+		result = libsmdev_handle_get_sample_region(
+		          handle,
+		          region_index,
+		          &region_offset,
+		          &region_size,
+		          &number_of_samples,
+		          &number_of_unreadable_samples,
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT64(
+		 "region_offset",
+		 (int64_t) region_offset,
+		 (int64_t) region_index * 0x400000 );
+
+		SMDEV_TEST_ASSERT_EQUAL_UINT64(
+		 "region_size",
+		 (uint64_t) region_size,
+		 (uint64_t) 0x400000 );
+
+		result = libsmdev_handle_get_sample_region_statistics(
+		          handle,
+		          region_index,
+		          &zero_fraction,
+		          &high_entropy_fraction,
+		          &entropy,
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		/* The first region cannot be read
+		 */
+		if( region_index == 0 )
+		{
+			SMDEV_TEST_ASSERT_EQUAL_UINT64(
+			 "number_of_samples",
+			 number_of_samples,
+			 (uint64_t) 0 );
+
+			SMDEV_TEST_ASSERT_NOT_EQUAL_INT(
+			 "number_of_unreadable_samples",
+			 (int) number_of_unreadable_samples,
+			 0 );
+
+			result = (int) ( entropy * 1000.0 );
+
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+		}
+		/* The data of the simulated device is a pattern of 251 byte values
+		 */
+		else
+		{
+			SMDEV_TEST_ASSERT_NOT_EQUAL_INT(
+			 "number_of_samples",
+			 (int) number_of_samples,
+			 0 );
+
+			SMDEV_TEST_ASSERT_EQUAL_UINT64(
+			 "number_of_unreadable_samples",
+			 number_of_unreadable_samples,
+			 (uint64_t) 0 );
+
+			result = (int) ( zero_fraction * 1000.0 );
+
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			result = (int) ( high_entropy_fraction * 1000.0 );
+
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1000 );
+
+			result = (int) ( entropy * 100.0 );
+
+			SMDEV_TEST_ASSERT_GREATER_THAN_INT(
+			 "result",
+			 result,
+			 790 );
+
+			SMDEV_TEST_ASSERT_LESS_THAN_INT(
+			 "result",
+			 result,
+			 801 );
+		}
+		total_number_of_samples += number_of_samples + number_of_unreadable_samples;
+	}
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "total_number_of_samples",
+	 total_number_of_samples,
+	 (uint64_t) 64 );
+
+	/* The partition table cannot be read
+	 */
+	result = libsmdev_handle_get_partition_table_type(
+	          handle,
+	          &partition_table_type,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "partition_table_type",
+	 partition_table_type,
+	 LIBSMDEV_PARTITION_TABLE_TYPE_NONE );
+
+	result = libsmdev_handle_get_number_of_partitions(
+	          handle,
+	          &number_of_partitions,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_partitions",
+	 number_of_partitions,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_get_sample_region(
+	          handle,
+	          number_of_regions,
+	          &region_offset,
+	          &region_size,
+	          &number_of_samples,
+	          &number_of_unreadable_samples,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_sample(
+	          handle,
+	          -1,
+	          64,
+	          4096,
+	          4,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The sample size must be a multiple of the bytes per sector
+	 */
+	result = libsmdev_handle_sample(
+	          handle,
+	          sampling_method,
+	          64,
+	          1000,
+	          4,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The regions of a failed sampling are not retained
+	 */
+	result = libsmdev_handle_get_number_of_sample_regions(
+	          handle,
+	          &number_of_regions,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_regions",
+	 number_of_regions,
+	 0 );
+
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_sampler_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_sampler_scenario_path );
+
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_sample function using stratified sampling
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sampler_sample_stratified(
+     void )
+{
+	return( smdev_test_sampler_sample(
+	         LIBSMDEV_SAMPLING_METHOD_STRATIFIED,
+	         1 ) );
+}
+
+/* Tests the libsmdev_handle_sample function using random sampling
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sampler_sample_random(
+     void )
+{
+	return( smdev_test_sampler_sample(
+	         LIBSMDEV_SAMPLING_METHOD_RANDOM,
+	         1 ) );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Tests the libsmdev_handle_sample function using multiple workers
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sampler_sample_parallel(
+     void )
+{
+	return( smdev_test_sampler_sample(
+	         LIBSMDEV_SAMPLING_METHOD_STRATIFIED,
+	         4 ) );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_sampler",
+	     smdev_test_sampler_scenario_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	SMDEV_TEST_RUN(
+	 "libsmdev_sample_region_calculate_entropy",
+	 smdev_test_sample_region_calculate_entropy );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_sampler_count_bytes",
+	 smdev_test_sampler_count_bytes );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_partition_table_read",
+	 smdev_test_partition_table_read );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_sample (stratified)",
+	 smdev_test_sampler_sample_stratified );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_sample (random)",
+	 smdev_test_sampler_sample_random );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_sample (parallel)",
+	 smdev_test_sampler_sample_parallel );
+#endif
+
+	remove(
+	 smdev_test_sampler_scenario_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	remove(
+	 smdev_test_sampler_scenario_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_FAILURE );
+}
+
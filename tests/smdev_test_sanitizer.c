@@ -0,0 +1,1683 @@
+/*
+ * Library sanitizer type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_io_backend.h"
+#include "../libsmdev/libsmdev_sanitizer.h"
+#include "../libsmdev/libsmdev_write_engine.h"
+
+/* The size of the memory device
+ */
+#define SMDEV_TEST_SANITIZER_DEVICE_SIZE		( 4 * 1048576 )
+
+/* The maximum number of IO backends on the memory device
+ */
+#define SMDEV_TEST_SANITIZER_MAXIMUM_NUMBER_OF_FILES	4
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+typedef struct smdev_test_sanitizer_device smdev_test_sanitizer_device_t;
+
+struct smdev_test_sanitizer_device
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* Value to indicate the device supports discard and zero out requests
+	 */
+	int erase_requests_supported;
+
+	/* The number of discard and zero out requests
+	 */
+	int number_of_erase_requests;
+
+	/* The offset of the range that cannot be read or written
+	 */
+	off64_t bad_offset;
+
+	/* The size of the range that cannot be read or written
+	 */
+	size_t bad_size;
+};
+
+typedef struct smdev_test_sanitizer_file smdev_test_sanitizer_file_t;
+
+struct smdev_test_sanitizer_file
+{
+	/* The memory device
+	 */
+	smdev_test_sanitizer_device_t *device;
+
+	/* The current offset
+	 */
+	off64_t offset;
+};
+
+/* Determines if an access overlaps with the bad range of the memory device
+ * Returns 1 if the access overlaps or 0 if not
+ */
+int smdev_test_sanitizer_file_is_bad(
+     smdev_test_sanitizer_file_t *file,
+     size_t size )
+{
+	smdev_test_sanitizer_device_t *device = file->device;
+
+	if( device->bad_size == 0 )
+	{
+		return( 0 );
+	}
+	if( ( file->offset < ( device->bad_offset + (off64_t) device->bad_size ) )
+	 && ( ( file->offset + (off64_t) size ) > device->bad_offset ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads from the memory device
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t smdev_test_sanitizer_file_read(
+         intptr_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	smdev_test_sanitizer_file_t *file = (smdev_test_sanitizer_file_t *) io_handle;
+
+	if( smdev_test_sanitizer_file_is_bad(
+	     file,
+	     size ) != 0 )
+	{
+		*error_code = (uint32_t) EIO;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "unable to read from bad range." );
+
+		return( -1 );
+	}
+	if( file->offset >= (off64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE )
+	{
+		return( 0 );
+	}
+	if( size > (size_t) ( SMDEV_TEST_SANITIZER_DEVICE_SIZE - file->offset ) )
+	{
+		size = (size_t) ( SMDEV_TEST_SANITIZER_DEVICE_SIZE - file->offset );
+	}
+	memory_copy(
+	 buffer,
+	 &( file->device->data[ file->offset ] ),
+	 size );
+
+	file->offset += (off64_t) size;
+
+	return( (ssize_t) size );
+}
+
+/* Writes to the memory device
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t smdev_test_sanitizer_file_write(
+         intptr_t *io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	smdev_test_sanitizer_file_t *file = (smdev_test_sanitizer_file_t *) io_handle;
+
+	if( smdev_test_sanitizer_file_is_bad(
+	     file,
+	     size ) != 0 )
+	{
+		*error_code = (uint32_t) EIO;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "unable to write to bad range." );
+
+		return( -1 );
+	}
+	if( ( file->offset + (off64_t) size ) > (off64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE )
+	{
+		*error_code = (uint32_t) ENOSPC;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "unable to write beyond end of device." );
+
+		return( -1 );
+	}
+	memory_copy(
+	 &( file->device->data[ file->offset ] ),
+	 buffer,
+	 size );
+
+	file->offset += (off64_t) size;
+
+	return( (ssize_t) size );
+}
+
+/* Seeks an offset in the memory device
+ * Returns the offset or -1 on error
+ */
+off64_t smdev_test_sanitizer_file_seek_offset(
+         intptr_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error SMDEV_TEST_ATTRIBUTE_UNUSED )
+{
+	smdev_test_sanitizer_file_t *file = (smdev_test_sanitizer_file_t *) io_handle;
+
+	SMDEV_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( whence == SEEK_CUR )
+	{
+		offset += file->offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE;
+	}
+	file->offset = offset;
+
+	return( offset );
+}
+
+/* Handles a discard or zero out request on the memory device
+ * The request data contains the offset and size of the range
+ * Returns 0 if successful or -1 on error
+ */
+ssize_t smdev_test_sanitizer_file_io_control_read(
+         intptr_t *io_handle,
+         uint32_t request SMDEV_TEST_ATTRIBUTE_UNUSED,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	smdev_test_sanitizer_file_t *file = (smdev_test_sanitizer_file_t *) io_handle;
+	uint64_t *range                   = (uint64_t *) data;
+
+	SMDEV_TEST_UNREFERENCED_PARAMETER( request )
+
+	if( ( file->device->erase_requests_supported == 0 )
+	 || ( data_size != ( sizeof( uint64_t ) * 2 ) )
+	 || ( ( range[ 0 ] + range[ 1 ] ) > (uint64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_IOCTL_FAILED,
+		 "unsupported request." );
+
+		return( -1 );
+	}
+	file->device->number_of_erase_requests++;
+
+	memory_set(
+	 &( file->device->data[ range[ 0 ] ] ),
+	 0,
+	 (size_t) range[ 1 ] );
+
+	return( 0 );
+}
+
+/* Creates a memory device and IO backends that access it
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_sanitizer_device_initialize(
+     smdev_test_sanitizer_device_t *device,
+     smdev_test_sanitizer_file_t *files,
+     libsmdev_io_backend_t **io_backends,
+     int number_of_io_backends,
+     libcerror_error_t **error )
+{
+	int file_index = 0;
+
+	if( memory_set(
+	     device,
+	     0,
+	     sizeof( smdev_test_sanitizer_device_t ) ) == NULL )
+	{
+		return( -1 );
+	}
+	device->data = (uint8_t *) memory_allocate(
+	                            SMDEV_TEST_SANITIZER_DEVICE_SIZE );
+
+	if( device->data == NULL )
+	{
+		return( -1 );
+	}
+	memory_set(
+	 device->data,
+	 0xaa,
+	 SMDEV_TEST_SANITIZER_DEVICE_SIZE );
+
+	for( file_index = 0;
+	     file_index < number_of_io_backends;
+	     file_index++ )
+	{
+		files[ file_index ].device = device;
+		files[ file_index ].offset = 0;
+
+		io_backends[ file_index ] = NULL;
+
+		if( libsmdev_io_backend_initialize(
+		     &( io_backends[ file_index ] ),
+		     LIBSMDEV_IO_BACKEND_TYPE_UNDEFINED,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		io_backends[ file_index ]->io_handle       = (intptr_t *) &( files[ file_index ] );
+		io_backends[ file_index ]->read            = &smdev_test_sanitizer_file_read;
+		io_backends[ file_index ]->write           = &smdev_test_sanitizer_file_write;
+		io_backends[ file_index ]->seek_offset     = &smdev_test_sanitizer_file_seek_offset;
+		io_backends[ file_index ]->io_control_read = &smdev_test_sanitizer_file_io_control_read;
+	}
+	return( 1 );
+}
+
+/* Frees a memory device and the IO backends that access it
+ */
+void smdev_test_sanitizer_device_free(
+      smdev_test_sanitizer_device_t *device,
+      libsmdev_io_backend_t **io_backends,
+      int number_of_io_backends )
+{
+	int file_index = 0;
+
+	for( file_index = 0;
+	     file_index < number_of_io_backends;
+	     file_index++ )
+	{
+		if( io_backends[ file_index ] != NULL )
+		{
+			libsmdev_io_backend_free(
+			 &( io_backends[ file_index ] ),
+			 NULL );
+		}
+	}
+	if( device->data != NULL )
+	{
+		memory_free(
+		 device->data );
+
+		device->data = NULL;
+	}
+}
+
+/* The number of times the progress callback was called
+ */
+int smdev_test_sanitizer_number_of_progress_calls = 0;
+
+/* The last processed size reported to the progress callback
+ */
+size64_t smdev_test_sanitizer_processed_size = 0;
+
+/* The last total size reported to the progress callback
+ */
+size64_t smdev_test_sanitizer_total_size = 0;
+
+/* The number of progress callback calls after which the sanitizer is aborted, 0 to never abort
+ */
+int smdev_test_sanitizer_abort_after = 0;
+
+/* Records the progress of the sanitizer
+ * Returns 1 to continue or 0 to abort
+ */
+int smdev_test_sanitizer_progress_callback(
+     void *callback_data SMDEV_TEST_ATTRIBUTE_UNUSED,
+     int stage SMDEV_TEST_ATTRIBUTE_UNUSED,
+     size64_t processed_size,
+     size64_t total_size )
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( callback_data )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( stage )
+
+	smdev_test_sanitizer_number_of_progress_calls++;
+
+	smdev_test_sanitizer_processed_size = processed_size;
+	smdev_test_sanitizer_total_size     = total_size;
+
+	if( ( smdev_test_sanitizer_abort_after > 0 )
+	 && ( smdev_test_sanitizer_number_of_progress_calls >= smdev_test_sanitizer_abort_after ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libsmdev_sanitizer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sanitizer_initialize(
+     void )
+{
+	smdev_test_sanitizer_device_t device;
+	smdev_test_sanitizer_file_t files[ 1 ];
+
+	libsmdev_io_backend_t *io_backends[ 1 ];
+
+	libcdata_range_list_t *errors_range_list = NULL;
+	libcerror_error_t *error                 = NULL;
+	libsmdev_sanitizer_t *sanitizer          = NULL;
+	int result                               = 0;
+
+	device.data      = NULL;
+	io_backends[ 0 ] = NULL;
+
+	result = smdev_test_sanitizer_device_initialize(
+	          &device,
+	          files,
+	          io_backends,
+	          1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_range_list_initialize(
+	          &errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_sanitizer_initialize(
+	          &sanitizer,
+	          LIBSMDEV_SANITIZE_METHOD_OVERWRITE,
+	          (size64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE,
+	          512,
+	          io_backends,
+	          1,
+	          errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitizer",
+	 sanitizer );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_sanitizer_free(
+	          &sanitizer,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "sanitizer",
+	 sanitizer );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_sanitizer_initialize(
+	          NULL,
+	          LIBSMDEV_SANITIZE_METHOD_OVERWRITE,
+	          (size64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE,
+	          512,
+	          io_backends,
+	          1,
+	          errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_sanitizer_initialize(
+	          &sanitizer,
+	          LIBSMDEV_SANITIZE_METHOD_AUTOMATIC,
+	          (size64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE,
+	          512,
+	          io_backends,
+	          1,
+	          errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_sanitizer_initialize(
+	          &sanitizer,
+	          LIBSMDEV_SANITIZE_METHOD_OVERWRITE,
+	          (size64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE,
+	          3,
+	          io_backends,
+	          1,
+	          errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_sanitizer_initialize(
+	          &sanitizer,
+	          LIBSMDEV_SANITIZE_METHOD_OVERWRITE,
+	          (size64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE,
+	          512,
+	          io_backends,
+	          0,
+	          errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	libcdata_range_list_free(
+	 &errors_range_list,
+	 NULL,
+	 NULL );
+
+	smdev_test_sanitizer_device_free(
+	 &device,
+	 io_backends,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sanitizer != NULL )
+	{
+		libsmdev_sanitizer_free(
+		 &sanitizer,
+		 NULL );
+	}
+	if( errors_range_list != NULL )
+	{
+		libcdata_range_list_free(
+		 &errors_range_list,
+		 NULL,
+		 NULL );
+	}
+	smdev_test_sanitizer_device_free(
+	 &device,
+	 io_backends,
+	 1 );
+
+	return( 0 );
+}
+
+/* Tests the libsmdev_sanitizer_data_is_uniform function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sanitizer_data_is_uniform(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	int result = 0;
+
+	memory_set(
+	 data,
+	 0xff,
+	 512 );
+
+	result = libsmdev_sanitizer_data_is_uniform(
+	          data,
+	          512 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data[ 511 ] = 0xfe;
+
+	result = libsmdev_sanitizer_data_is_uniform(
+	          data,
+	          512 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_set(
+	 data,
+	 0,
+	 512 );
+
+	result = libsmdev_sanitizer_data_is_uniform(
+	          data,
+	          512 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data[ 256 ] = 0x01;
+
+	result = libsmdev_sanitizer_data_is_uniform(
+	          data,
+	          512 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libsmdev_sanitizer_data_is_uniform(
+	          NULL,
+	          512 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests erasing and verifying the memory device
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sanitizer_erase(
+     int erase_method,
+     int erase_requests_supported,
+     int number_of_workers )
+{
+	smdev_test_sanitizer_device_t device;
+	smdev_test_sanitizer_file_t files[ SMDEV_TEST_SANITIZER_MAXIMUM_NUMBER_OF_FILES ];
+
+	libsmdev_io_backend_t *io_backends[ SMDEV_TEST_SANITIZER_MAXIMUM_NUMBER_OF_FILES ];
+
+	libcdata_range_list_t *errors_range_list = NULL;
+	libcerror_error_t *error                 = NULL;
+	libsmdev_sanitizer_t *sanitizer          = NULL;
+	int number_of_errors                     = 0;
+	int result                               = 0;
+
+	device.data = NULL;
+
+	result = smdev_test_sanitizer_device_initialize(
+	          &device,
+	          files,
+	          io_backends,
+	          number_of_workers,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	device.erase_requests_supported = erase_requests_supported;
+
+	result = libcdata_range_list_initialize(
+	          &errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_sanitizer_initialize(
+	          &sanitizer,
+	          erase_method,
+	          (size64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE,
+	          512,
+	          io_backends,
+	          number_of_workers,
+	          errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_sanitizer_set_progress_callback(
+	          sanitizer,
+	          &smdev_test_sanitizer_progress_callback,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	smdev_test_sanitizer_number_of_progress_calls = 0;
+	smdev_test_sanitizer_abort_after              = 0;
+
+	result = libsmdev_sanitizer_run(
+	          sanitizer,
+	          LIBSMDEV_SANITIZE_STAGE_ERASE,
+	          LIBSMDEV_SANITIZE_VERIFICATION_METHOD_FULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "smdev_test_sanitizer_processed_size",
+	 (uint64_t) smdev_test_sanitizer_processed_size,
+	 (uint64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE );
+
+	result = libsmdev_sanitizer_run(
+	          sanitizer,
+	          LIBSMDEV_SANITIZE_STAGE_VERIFY,
+	          LIBSMDEV_SANITIZE_VERIFICATION_METHOD_FULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "smdev_test_sanitizer_processed_size",
+	 (uint64_t) smdev_test_sanitizer_processed_size,
+	 (uint64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE );
+
+	result = libcdata_range_list_get_number_of_elements(
+	          errors_range_list,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 0 );
+
+	result = libsmdev_write_engine_data_is_zero(
+	          device.data,
+	          SMDEV_TEST_SANITIZER_DEVICE_SIZE );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* A rejected discard or zero out request falls back to overwriting
+	 */
+	if( erase_requests_supported == 0 )
+	{
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "sanitizer->erase_method",
+		 sanitizer->erase_method,
+		 LIBSMDEV_SANITIZE_METHOD_OVERWRITE );
+	}
+	/* Clean up
+	 */
+	result = libsmdev_sanitizer_free(
+	          &sanitizer,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcdata_range_list_free(
+	 &errors_range_list,
+	 NULL,
+	 NULL );
+
+	smdev_test_sanitizer_device_free(
+	 &device,
+	 io_backends,
+	 number_of_workers );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sanitizer != NULL )
+	{
+		libsmdev_sanitizer_free(
+		 &sanitizer,
+		 NULL );
+	}
+	if( errors_range_list != NULL )
+	{
+		libcdata_range_list_free(
+		 &errors_range_list,
+		 NULL,
+		 NULL );
+	}
+	smdev_test_sanitizer_device_free(
+	 &device,
+	 io_backends,
+	 number_of_workers );
+
+	return( 0 );
+}
+
+/* Tests erasing by overwriting
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sanitizer_erase_overwrite(
+     void )
+{
+	return( smdev_test_sanitizer_erase(
+	         LIBSMDEV_SANITIZE_METHOD_OVERWRITE,
+	         0,
+	         1 ) );
+}
+
+/* Tests erasing by zeroing out
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sanitizer_erase_zero_out(
+     void )
+{
+	return( smdev_test_sanitizer_erase(
+	         LIBSMDEV_SANITIZE_METHOD_ZERO_OUT,
+	         1,
+	         1 ) );
+}
+
+/* Tests erasing by discarding on a device that rejects discard requests
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sanitizer_erase_discard_unsupported(
+     void )
+{
+	return( smdev_test_sanitizer_erase(
+	         LIBSMDEV_SANITIZE_METHOD_DISCARD,
+	         0,
+	         1 ) );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Tests erasing by overwriting using multiple workers
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sanitizer_erase_overwrite_parallel(
+     void )
+{
+	return( smdev_test_sanitizer_erase(
+	         LIBSMDEV_SANITIZE_METHOD_OVERWRITE,
+	         0,
+	         SMDEV_TEST_SANITIZER_MAXIMUM_NUMBER_OF_FILES ) );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Verifies the memory device and retrieves the number of errors
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_sanitizer_verify_device(
+     libsmdev_sanitizer_t *sanitizer,
+     libcdata_range_list_t *errors_range_list,
+     int verification_method,
+     int *number_of_errors,
+     libcerror_error_t **error )
+{
+	if( libcdata_range_list_empty(
+	     errors_range_list,
+	     NULL,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libsmdev_sanitizer_run(
+	     sanitizer,
+	     LIBSMDEV_SANITIZE_STAGE_VERIFY,
+	     verification_method,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libcdata_range_list_get_number_of_elements(
+	     errors_range_list,
+	     number_of_errors,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the sampled and full verification
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sanitizer_verify(
+     void )
+{
+	smdev_test_sanitizer_device_t device;
+	smdev_test_sanitizer_file_t files[ 1 ];
+
+	libsmdev_io_backend_t *io_backends[ 1 ];
+
+	libcdata_range_list_t *errors_range_list = NULL;
+	libcerror_error_t *error                 = NULL;
+	libsmdev_sanitizer_t *sanitizer          = NULL;
+	uint64_t range_offset                    = 0;
+	uint64_t range_size                      = 0;
+	int number_of_errors                     = 0;
+	int result                               = 0;
+
+	device.data      = NULL;
+	io_backends[ 0 ] = NULL;
+
+	result = smdev_test_sanitizer_device_initialize(
+	          &device,
+	          files,
+	          io_backends,
+	          1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_range_list_initialize(
+	          &errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_sanitizer_initialize(
+	          &sanitizer,
+	          LIBSMDEV_SANITIZE_METHOD_OVERWRITE,
+	          (size64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE,
+	          512,
+	          io_backends,
+	          1,
+	          errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Use 4 samples of 64 KiB that start at the offsets: 0, 1376256, 2752512 and 4128768
+	 */
+	sanitizer->number_of_samples = 4;
+	sanitizer->sample_size       = 65536;
+
+	memory_set(
+	 device.data,
+	 0,
+	 SMDEV_TEST_SANITIZER_DEVICE_SIZE );
+
+	/* A sector that was not erased and is outside the samples
+	 */
+	device.data[ 524288 + 100 ] = 0x01;
+
+	result = smdev_test_sanitizer_verify_device(
+	          sanitizer,
+	          errors_range_list,
+	          LIBSMDEV_SANITIZE_VERIFICATION_METHOD_SAMPLED,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 0 );
+
+	result = smdev_test_sanitizer_verify_device(
+	          sanitizer,
+	          errors_range_list,
+	          LIBSMDEV_SANITIZE_VERIFICATION_METHOD_FULL,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 1 );
+
+	result = libcdata_range_list_get_range_by_index(
+	          errors_range_list,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "range_offset",
+	 range_offset,
+	 (uint64_t) 524288 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 range_size,
+	 (uint64_t) 512 );
+
+	/* A sector that was not erased in the last sample
+	 */
+	device.data[ 524288 + 100 ] = 0;
+
+	device.data[ SMDEV_TEST_SANITIZER_DEVICE_SIZE - 1 ] = 0x01;
+
+	result = smdev_test_sanitizer_verify_device(
+	          sanitizer,
+	          errors_range_list,
+	          LIBSMDEV_SANITIZE_VERIFICATION_METHOD_SAMPLED,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 1 );
+
+	/* Sectors that cannot be read
+	 */
+	device.data[ SMDEV_TEST_SANITIZER_DEVICE_SIZE - 1 ] = 0;
+
+	device.bad_offset = 1048576;
+	device.bad_size   = 1024;
+
+	result = smdev_test_sanitizer_verify_device(
+	          sanitizer,
+	          errors_range_list,
+	          LIBSMDEV_SANITIZE_VERIFICATION_METHOD_FULL,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 1 );
+
+	/* After a block erase every sector is expected to contain a single repeated byte value
+	 */
+	device.bad_size = 0;
+
+	sanitizer->erase_method = LIBSMDEV_SANITIZE_METHOD_BLOCK_ERASE;
+
+	memory_set(
+	 device.data,
+	 0xff,
+	 SMDEV_TEST_SANITIZER_DEVICE_SIZE );
+
+	result = smdev_test_sanitizer_verify_device(
+	          sanitizer,
+	          errors_range_list,
+	          LIBSMDEV_SANITIZE_VERIFICATION_METHOD_FULL,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libsmdev_sanitizer_free(
+	          &sanitizer,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcdata_range_list_free(
+	 &errors_range_list,
+	 NULL,
+	 NULL );
+
+	smdev_test_sanitizer_device_free(
+	 &device,
+	 io_backends,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sanitizer != NULL )
+	{
+		libsmdev_sanitizer_free(
+		 &sanitizer,
+		 NULL );
+	}
+	if( errors_range_list != NULL )
+	{
+		libcdata_range_list_free(
+		 &errors_range_list,
+		 NULL,
+		 NULL );
+	}
+	smdev_test_sanitizer_device_free(
+	 &device,
+	 io_backends,
+	 1 );
+
+	return( 0 );
+}
+
+/* Tests overwriting a device with sectors that cannot be written and aborting
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sanitizer_write_errors(
+     void )
+{
+	smdev_test_sanitizer_device_t device;
+	smdev_test_sanitizer_file_t files[ 1 ];
+
+	libsmdev_io_backend_t *io_backends[ 1 ];
+
+	libcdata_range_list_t *errors_range_list = NULL;
+	libcerror_error_t *error                 = NULL;
+	libsmdev_sanitizer_t *sanitizer          = NULL;
+	uint64_t range_offset                    = 0;
+	uint64_t range_size                      = 0;
+	int number_of_errors                     = 0;
+	int result                               = 0;
+
+	device.data      = NULL;
+	io_backends[ 0 ] = NULL;
+
+	result = smdev_test_sanitizer_device_initialize(
+	          &device,
+	          files,
+	          io_backends,
+	          1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	device.bad_offset = 2097152 + 512;
+	device.bad_size   = 512;
+
+	result = libcdata_range_list_initialize(
+	          &errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_sanitizer_initialize(
+	          &sanitizer,
+	          LIBSMDEV_SANITIZE_METHOD_OVERWRITE,
+	          (size64_t) SMDEV_TEST_SANITIZER_DEVICE_SIZE,
+	          512,
+	          io_backends,
+	          1,
+	          errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_sanitizer_run(
+	          sanitizer,
+	          LIBSMDEV_SANITIZE_STAGE_ERASE,
+	          LIBSMDEV_SANITIZE_VERIFICATION_METHOD_NONE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_range_list_get_number_of_elements(
+	          errors_range_list,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 1 );
+
+	result = libcdata_range_list_get_range_by_index(
+	          errors_range_list,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "range_offset",
+	 range_offset,
+	 (uint64_t) ( 2097152 + 512 ) );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 range_size,
+	 (uint64_t) 512 );
+
+	/* The sectors around the bad sector are erased
+	 */
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "device.data[ 2097152 ]",
+	 device.data[ 2097152 ],
+	 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "device.data[ 2097152 + 1024 ]",
+	 device.data[ 2097152 + 1024 ],
+	 0 );
+
+	/* Test abort by the progress callback
+	 */
+	result = libsmdev_sanitizer_set_progress_callback(
+	          sanitizer,
+	          &smdev_test_sanitizer_progress_callback,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	smdev_test_sanitizer_number_of_progress_calls = 0;
+	smdev_test_sanitizer_abort_after              = 1;
+
+	result = libsmdev_sanitizer_run(
+	          sanitizer,
+	          LIBSMDEV_SANITIZE_STAGE_VERIFY,
+	          LIBSMDEV_SANITIZE_VERIFICATION_METHOD_FULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "smdev_test_sanitizer_number_of_progress_calls",
+	 smdev_test_sanitizer_number_of_progress_calls,
+	 1 );
+
+	smdev_test_sanitizer_abort_after = 0;
+
+	/* Clean up
+	 */
+	result = libsmdev_sanitizer_free(
+	          &sanitizer,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcdata_range_list_free(
+	 &errors_range_list,
+	 NULL,
+	 NULL );
+
+	smdev_test_sanitizer_device_free(
+	 &device,
+	 io_backends,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	smdev_test_sanitizer_abort_after = 0;
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sanitizer != NULL )
+	{
+		libsmdev_sanitizer_free(
+		 &sanitizer,
+		 NULL );
+	}
+	if( errors_range_list != NULL )
+	{
+		libcdata_range_list_free(
+		 &errors_range_list,
+		 NULL,
+		 NULL );
+	}
+	smdev_test_sanitizer_device_free(
+	 &device,
+	 io_backends,
+	 1 );
+
+	return( 0 );
+}
+
+/* Sanitizes a device using a specific sanitize method
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_sanitizer_sanitize_device(
+     const char *filename,
+     int sanitize_method,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	struct timespec end_time;
+	struct timespec start_time;
+
+	libsmdev_handle_t *handle = NULL;
+	size64_t media_size       = 0;
+	uint64_t elapsed_time     = 0;
+	int number_of_errors      = 0;
+	int result                = -1;
+
+	if( libsmdev_handle_initialize(
+	     &handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsmdev_handle_set_number_of_read_threads(
+	     handle,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsmdev_handle_open(
+	     handle,
+	     filename,
+	     LIBSMDEV_OPEN_READ_WRITE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsmdev_handle_get_media_size(
+	     handle,
+	     &media_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &start_time );
+
+	if( libsmdev_handle_sanitize(
+	     handle,
+	     sanitize_method,
+	     LIBSMDEV_SANITIZE_VERIFICATION_METHOD_FULL,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &end_time );
+
+	if( libsmdev_handle_get_number_of_errors(
+	     handle,
+	     &number_of_errors,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( number_of_errors != 0 )
+	{
+		goto on_error;
+	}
+	elapsed_time = ( (uint64_t) ( end_time.tv_sec - start_time.tv_sec ) * 1000000 )
+	             + ( (uint64_t) end_time.tv_nsec / 1000 ) - ( (uint64_t) start_time.tv_nsec / 1000 );
+
+	if( elapsed_time == 0 )
+	{
+		elapsed_time = 1;
+	}
+	fprintf(
+	 stdout,
+	 "\n\tsanitize method: %d, threads: %d, sanitized and verified: %" PRIu64 " bytes, time: %" PRIu64 " us, %" PRIu64 " MiB/s",
+	 sanitize_method,
+	 number_of_threads,
+	 media_size,
+	 elapsed_time,
+	 ( media_size * 1000000 ) / ( elapsed_time * 1048576 ) );
+
+	result = 1;
+
+on_error:
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Sanitizes the device named by the SMDEV_TEST_SANITIZE_DEVICE environment variable
+ * The device is erased, use tests/benchmark_sanitizer.sh to run the test on a loop device
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_sanitizer_device(
+     void )
+{
+	int sanitize_methods[ 2 ] = { LIBSMDEV_SANITIZE_METHOD_AUTOMATIC, LIBSMDEV_SANITIZE_METHOD_OVERWRITE };
+
+	libcerror_error_t *error  = NULL;
+	const char *filename      = NULL;
+	int method_index          = 0;
+	int number_of_threads     = 0;
+	int result                = 0;
+
+	filename = getenv(
+	            "SMDEV_TEST_SANITIZE_DEVICE" );
+
+	if( filename == NULL )
+	{
+		return( 1 );
+	}
+	for( method_index = 0;
+	     method_index < 2;
+	     method_index++ )
+	{
+		for( number_of_threads = 1;
+		     number_of_threads <= 4;
+		     number_of_threads *= 4 )
+		{
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( number_of_threads > 1 )
+			{
+				break;
+			}
+#endif
+			result = smdev_test_sanitizer_sanitize_device(
+			          filename,
+			          sanitize_methods[ method_index ],
+			          number_of_threads,
+			          &error );
+
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SMDEV_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_sanitizer_initialize",
+	 smdev_test_sanitizer_initialize );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_sanitizer_data_is_uniform",
+	 smdev_test_sanitizer_data_is_uniform );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_sanitizer_run overwrite",
+	 smdev_test_sanitizer_erase_overwrite );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_sanitizer_run zero out",
+	 smdev_test_sanitizer_erase_zero_out );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_sanitizer_run discard unsupported",
+	 smdev_test_sanitizer_erase_discard_unsupported );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	SMDEV_TEST_RUN(
+	 "libsmdev_sanitizer_run overwrite parallel",
+	 smdev_test_sanitizer_erase_overwrite_parallel );
+#endif
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_sanitizer_run verify",
+	 smdev_test_sanitizer_verify );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_sanitizer_run write errors",
+	 smdev_test_sanitizer_write_errors );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_sanitize device",
+	 smdev_test_sanitizer_device );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
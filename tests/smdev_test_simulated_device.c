@@ -0,0 +1,1598 @@
+/*
+ * Library simulated device functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_functions.h"
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_handle.h"
+#include "../libsmdev/libsmdev_io_backend.h"
+#include "../libsmdev/libsmdev_simulated_device.h"
+
+#define SMDEV_TEST_SIMULATED_DEVICE_READ_SIZE		65536
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+/* The path of the scenario file
+ */
+char smdev_test_simulated_device_scenario_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+typedef struct smdev_test_simulated_device_scenario smdev_test_simulated_device_scenario_t;
+
+struct smdev_test_simulated_device_scenario
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The scenario file data
+	 */
+	const char *data;
+};
+
+/* The benchmark scenarios
+ * Every scenario has a base latency of 100 micro seconds per read
+ */
+smdev_test_simulated_device_scenario_t smdev_test_simulated_device_scenarios[] = {
+	{ "clean",
+	  "size 0x100000\n"
+	  "latency 0 0x100000 100\n" },
+	{ "bad sectors",
+	  "size 0x100000\n"
+	  "latency 0 0x100000 100\n"
+	  "bad 0x20000 1024\n"
+	  "bad 0x31000 512\n"
+	  "bad 0xfc000 4096\n" },
+	{ "bad sectors with offset drift",
+	  "size 0x100000\n"
+	  "drift\n"
+	  "latency 0 0x100000 100\n"
+	  "bad 0x20000 1024\n"
+	  "bad 0x31000 512\n"
+	  "bad 0xfc000 4096\n" },
+	{ "slow area",
+	  "size 0x100000\n"
+	  "latency 0 0x100000 100\n"
+	  "latency 0x60000 0x10000 20000\n"
+	  "bad 0x64000 512\n" },
+	{ "recoverable sectors",
+	  "size 0x100000\n"
+	  "latency 0 0x100000 100\n"
+	  "retry 0x40000 512 3\n"
+	  "retry 0x50000 512 8\n"
+	  "bad 0x70000 512\n" },
+	{ "weak sectors",
+	  "size 0x100000\n"
+	  "seed 0x12345678\n"
+	  "latency 0 0x100000 100\n"
+	  "probability 0x40000 0x1000 50\n"
+	  "probability 0x80000 0x1000 10\n" },
+	{ "short reads",
+	  "size 0x100000\n"
+	  "latency 0 0x100000 100\n"
+	  "short_read 0xc0000 0x10000 4096\n" },
+	{ "removal",
+	  "size 0x100000\n"
+	  "latency 0 0x100000 100\n"
+	  "bad 0x20000 512\n"
+	  "remove 0x90000\n" },
+	{ NULL, NULL }
+};
+
+/* Tests the libsmdev_simulated_device_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_simulated_device_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libsmdev_simulated_device_t *simulated_device = NULL;
+	int result                                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_simulated_device_initialize(
+	          &simulated_device,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "simulated_device",
+	 simulated_device );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "simulated_device->bytes_per_sector",
+	 simulated_device->bytes_per_sector,
+	 512 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "simulated_device->removal_offset",
+	 (int64_t) simulated_device->removal_offset,
+	 (int64_t) -1 );
+
+	result = libsmdev_simulated_device_free(
+	          &simulated_device,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "simulated_device",
+	 simulated_device );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_simulated_device_initialize(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	simulated_device = (libsmdev_simulated_device_t *) 0x12345678UL;
+
+	result = libsmdev_simulated_device_initialize(
+	          &simulated_device,
+	          &error );
+
+	simulated_device = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( simulated_device != NULL )
+	{
+		libsmdev_simulated_device_free(
+		 &simulated_device,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_simulated_device_parse_integer function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_simulated_device_parse_integer(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t value           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_simulated_device_parse_integer(
+	          "1024",
+	          &value,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 1024 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_simulated_device_parse_integer(
+	          "0x1fC00",
+	          &value,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0x1fc00UL );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_simulated_device_parse_integer(
+	          NULL,
+	          &value,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_simulated_device_parse_integer(
+	          "0x",
+	          &value,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_simulated_device_parse_integer(
+	          "12ab",
+	          &value,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_simulated_device_parse_integer(
+	          "0x10000000000000000",
+	          &value,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_simulated_device_read_scenario_line function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_simulated_device_read_scenario_line(
+     void )
+{
+	char line[ LIBSMDEV_SIMULATED_DEVICE_MAXIMUM_LINE_SIZE ];
+
+	libcerror_error_t *error                      = NULL;
+	libsmdev_simulated_device_range_t *range      = NULL;
+	libsmdev_simulated_device_t *simulated_device = NULL;
+	int number_of_entries                         = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_simulated_device_initialize(
+	          &simulated_device,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	narrow_string_copy(
+	 line,
+	 "size 0x100000 # 1 MiB\n",
+	 23 );
+
+	result = libsmdev_simulated_device_read_scenario_line(
+	          simulated_device,
+	          line,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "simulated_device->media_size",
+	 (uint64_t) simulated_device->media_size,
+	 (uint64_t) 0x100000UL );
+
+	narrow_string_copy(
+	 line,
+	 "\tretry  4096 512 3\r\n",
+	 21 );
+
+	result = libsmdev_simulated_device_read_scenario_line(
+	          simulated_device,
+	          line,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          simulated_device->ranges_array,
+	          &number_of_entries,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	result = libcdata_array_get_entry_by_index(
+	          simulated_device->ranges_array,
+	          0,
+	          (intptr_t **) &range,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "range",
+	 range );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "range->type",
+	 range->type,
+	 LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_RETRY );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "range->start_offset",
+	 (int64_t) range->start_offset,
+	 (int64_t) 4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "range->end_offset",
+	 (int64_t) range->end_offset,
+	 (int64_t) 4608 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "range->value",
+	 range->value,
+	 (uint64_t) 3 );
+
+	narrow_string_copy(
+	 line,
+	 "# comment only\n",
+	 16 );
+
+	result = libsmdev_simulated_device_read_scenario_line(
+	          simulated_device,
+	          line,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	narrow_string_copy(
+	 line,
+	 "unknown 1\n",
+	 11 );
+
+	result = libsmdev_simulated_device_read_scenario_line(
+	          simulated_device,
+	          line,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	narrow_string_copy(
+	 line,
+	 "bad 4096\n",
+	 10 );
+
+	result = libsmdev_simulated_device_read_scenario_line(
+	          simulated_device,
+	          line,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	narrow_string_copy(
+	 line,
+	 "probability 0 512 101\n",
+	 23 );
+
+	result = libsmdev_simulated_device_read_scenario_line(
+	          simulated_device,
+	          line,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_simulated_device_read_scenario_line(
+	          NULL,
+	          line,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_simulated_device_free(
+	          &simulated_device,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( simulated_device != NULL )
+	{
+		libsmdev_simulated_device_free(
+		 &simulated_device,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_simulated_device_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_simulated_device_read_buffer(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+
+	libcerror_error_t *error                      = NULL;
+	libsmdev_simulated_device_t *simulated_device = NULL;
+	off64_t offset                                = 0;
+	ssize_t read_count                            = 0;
+	uint32_t error_code                           = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_simulated_device_initialize(
+	          &simulated_device,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	simulated_device->media_size     = 65536;
+	simulated_device->removal_offset = 32768;
+	simulated_device->is_open        = 1;
+
+	result = libsmdev_simulated_device_append_range(
+	          simulated_device,
+	          LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_BAD,
+	          1024,
+	          512,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_simulated_device_append_range(
+	          simulated_device,
+	          LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_RETRY,
+	          8192,
+	          512,
+	          2,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of data before a bad range returns the data before the error
+	 */
+	read_count = libsmdev_simulated_device_read_buffer(
+	              simulated_device,
+	              buffer,
+	              4096,
+	              &error_code,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1024 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 300 ]",
+	 buffer[ 300 ],
+	 (uint8_t) ( 300 % 251 ) );
+
+	/* Test read of a bad range fails
+	 */
+	read_count = libsmdev_simulated_device_read_buffer(
+	              simulated_device,
+	              buffer,
+	              4096,
+	              &error_code,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+#if !defined( WINAPI )
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "error_code",
+	 error_code,
+	 (uint32_t) EIO );
+#endif
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test offset drift sets the offset to the position of the error
+	 */
+	simulated_device->offset_drift = 1;
+
+	offset = libsmdev_simulated_device_seek_offset(
+	          simulated_device,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	read_count = libsmdev_simulated_device_read_buffer(
+	              simulated_device,
+	              buffer,
+	              4096,
+	              &error_code,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	libcerror_error_free(
+	 &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "simulated_device->current_offset",
+	 (int64_t) simulated_device->current_offset,
+	 (int64_t) 1024 );
+
+	simulated_device->offset_drift = 0;
+
+	/* Test retry range succeeds on the second attempt
+	 */
+	offset = libsmdev_simulated_device_seek_offset(
+	          simulated_device,
+	          8192,
+	          SEEK_SET,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 8192 );
+
+	read_count = libsmdev_simulated_device_read_buffer(
+	              simulated_device,
+	              buffer,
+	              4096,
+	              &error_code,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libsmdev_simulated_device_read_buffer(
+	              simulated_device,
+	              buffer,
+	              4096,
+	              &error_code,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read beyond the removal offset fails
+	 */
+	offset = libsmdev_simulated_device_seek_offset(
+	          simulated_device,
+	          30720,
+	          SEEK_SET,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 30720 );
+
+	read_count = libsmdev_simulated_device_read_buffer(
+	              simulated_device,
+	              buffer,
+	              4096,
+	              &error_code,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+#if !defined( WINAPI )
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "error_code",
+	 error_code,
+	 (uint32_t) ENODEV );
+#endif
+
+	libcerror_error_free(
+	 &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "simulated_device->is_removed",
+	 simulated_device->is_removed,
+	 1 );
+
+	/* Test error cases
+	 */
+	read_count = libsmdev_simulated_device_read_buffer(
+	              NULL,
+	              buffer,
+	              4096,
+	              &error_code,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_simulated_device_free(
+	          &simulated_device,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( simulated_device != NULL )
+	{
+		libsmdev_simulated_device_free(
+		 &simulated_device,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests reading a handle with deferred probing
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_simulated_device_deferred_probing(
+     void )
+{
+	uint8_t buffer[ 0x4000 ];
+
+	libcerror_error_t *error                    = NULL;
+	libsmdev_handle_t *handle                   = NULL;
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	ssize_t read_count                          = 0;
+	off64_t offset                              = 0;
+	int result                                  = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_simulated_device_scenario_path,
+	          (const uint8_t *) "size 0x10000\n",
+	          narrow_string_length(
+	           "size 0x10000\n" ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_simulated_device_scenario_path,
+	          LIBSMDEV_OPEN_READ | LIBSMDEV_ACCESS_FLAG_DEFER_PROBING,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_handle->device_probed",
+	 internal_handle->device_probed,
+	 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_handle->media_size",
+	 (uint64_t) internal_handle->media_size,
+	 (uint64_t) 0 );
+
+	/* Test that the first seek probes the device
+	 */
+	offset = libsmdev_handle_seek_offset(
+	          handle,
+	          -0x1000,
+	          SEEK_END,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0xf000 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_handle->device_probed",
+	 internal_handle->device_probed,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_handle->media_size",
+	 (uint64_t) internal_handle->media_size,
+	 (uint64_t) 0x10000 );
+
+	/* Test that reads are clamped to the end of the media
+	 */
+	read_count = libsmdev_handle_read_buffer(
+	              handle,
+	              buffer,
+	              0x4000,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0x1000 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the first read probes the device
+	 */
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_simulated_device_scenario_path,
+	          LIBSMDEV_OPEN_READ | LIBSMDEV_ACCESS_FLAG_DEFER_PROBING,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_handle->device_probed",
+	 internal_handle->device_probed,
+	 0 );
+
+	read_count = libsmdev_handle_read_buffer(
+	              handle,
+	              buffer,
+	              0x4000,
+	              &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0x4000 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_handle->device_probed",
+	 internal_handle->device_probed,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "internal_handle->media_size",
+	 (uint64_t) internal_handle->media_size,
+	 (uint64_t) 0x10000 );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_simulated_device_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_simulated_device_scenario_path );
+
+	return( 0 );
+}
+
+/* Determines if a sector overlaps with a bad range of the simulated device
+ * Returns 1 if the sector is bad, 0 if not or -1 on error
+ */
+int smdev_test_simulated_device_sector_is_bad(
+     libsmdev_simulated_device_t *simulated_device,
+     off64_t sector_offset,
+     libcerror_error_t **error )
+{
+	libsmdev_simulated_device_range_t *range = NULL;
+	int entry_index                          = 0;
+	int number_of_entries                    = 0;
+
+	if( libcdata_array_get_number_of_entries(
+	     simulated_device->ranges_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     simulated_device->ranges_array,
+		     entry_index,
+		     (intptr_t **) &range,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( ( range->type == LIBSMDEV_SIMULATED_DEVICE_RANGE_TYPE_BAD )
+		 && ( sector_offset < range->end_offset )
+		 && ( ( sector_offset + simulated_device->bytes_per_sector ) > range->start_offset ) )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Determines if a sector overlaps with an error of the handle
+ * Returns 1 if the sector was reported as an error, 0 if not or -1 on error
+ */
+int smdev_test_simulated_device_sector_has_error(
+     libsmdev_handle_t *handle,
+     off64_t sector_offset,
+     size64_t sector_size,
+     libcerror_error_t **error )
+{
+	off64_t error_offset = 0;
+	size64_t error_size  = 0;
+	int error_index      = 0;
+	int number_of_errors = 0;
+
+	if( libsmdev_handle_get_number_of_errors(
+	     handle,
+	     &number_of_errors,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	for( error_index = 0;
+	     error_index < number_of_errors;
+	     error_index++ )
+	{
+		if( libsmdev_handle_get_error(
+		     handle,
+		     error_index,
+		     &error_offset,
+		     &error_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		if( ( sector_offset < (off64_t) ( error_offset + error_size ) )
+		 && ( (off64_t) ( sector_offset + sector_size ) > error_offset ) )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Runs a benchmark scenario
+ * Reads the entire simulated device using the handle and compares
+ * the errors of the handle with the bad ranges of the scenario
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_simulated_device_run_scenario(
+     smdev_test_simulated_device_scenario_t *scenario )
+{
+	uint8_t buffer[ SMDEV_TEST_SIMULATED_DEVICE_READ_SIZE ];
+
+	libcerror_error_t *error                      = NULL;
+	libsmdev_handle_t *handle                     = NULL;
+	libsmdev_internal_handle_t *internal_handle   = NULL;
+	libsmdev_simulated_device_t *simulated_device = NULL;
+	size64_t media_size                           = 0;
+	size64_t read_size                            = 0;
+	off64_t offset                                = 0;
+	ssize_t read_count                            = 0;
+	int number_of_detected_sectors                = 0;
+	int number_of_missed_sectors                  = 0;
+	int number_of_unrecovered_sectors             = 0;
+	int result                                    = 0;
+	int sector_has_error                          = 0;
+	int sector_is_bad                             = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_simulated_device_scenario_path,
+	          (const uint8_t *) scenario->data,
+	          narrow_string_length(
+	           scenario->data ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_set_number_of_error_retries(
+	          handle,
+	          2,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_set_error_granularity(
+	          handle,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_simulated_device_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_media_size(
+	          handle,
+	          &media_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "media_size",
+	 (uint64_t) media_size,
+	 (uint64_t) 0x100000UL );
+
+	internal_handle  = (libsmdev_internal_handle_t *) handle;
+	simulated_device = (libsmdev_simulated_device_t *) internal_handle->io_backend->io_handle;
+
+	/* Read the entire device, a removed device stops the read
+	 */
+	while( offset < (off64_t) media_size )
+	{
+		read_size = media_size - offset;
+
+		if( read_size > SMDEV_TEST_SIMULATED_DEVICE_READ_SIZE )
+		{
+			read_size = SMDEV_TEST_SIMULATED_DEVICE_READ_SIZE;
+		}
+		read_count = libsmdev_handle_read_buffer(
+		              handle,
+		              buffer,
+		              (size_t) read_size,
+		              &error );
+
+		if( read_count <= 0 )
+		{
+			break;
+		}
+		offset += read_count;
+	}
+	if( simulated_device->is_removed != 0 )
+	{
+		SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		SMDEV_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	else
+	{
+		SMDEV_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) media_size );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Determine the accuracy of the errors per sector in the part of the device that was read
+	 */
+	for( read_size = 0;
+	     read_size < (size64_t) offset;
+	     read_size += simulated_device->bytes_per_sector )
+	{
+		sector_is_bad = smdev_test_simulated_device_sector_is_bad(
+		                 simulated_device,
+		                 (off64_t) read_size,
+		                 &error );
+
+		SMDEV_TEST_ASSERT_NOT_EQUAL_INT(
+		 "sector_is_bad",
+		 sector_is_bad,
+		 -1 );
+
+		sector_has_error = smdev_test_simulated_device_sector_has_error(
+		                    handle,
+		                    (off64_t) read_size,
+		                    (size64_t) simulated_device->bytes_per_sector,
+		                    &error );
+
+		SMDEV_TEST_ASSERT_NOT_EQUAL_INT(
+		 "sector_has_error",
+		 sector_has_error,
+		 -1 );
+
+		if( sector_is_bad != 0 )
+		{
+			if( sector_has_error != 0 )
+			{
+				number_of_detected_sectors++;
+			}
+			else
+			{
+				number_of_missed_sectors++;
+			}
+		}
+		else if( sector_has_error != 0 )
+		{
+			number_of_unrecovered_sectors++;
+		}
+	}
+	fprintf(
+	 stdout,
+	 "\n\t%-30s: read: %" PRIi64 " bytes, time: %" PRIu64 " us, reads: %" PRIu64 " (%" PRIu64 " failed), bad sectors detected: %d, missed: %d, good sectors reported as error: %d",
+	 scenario->name,
+	 (int64_t) offset,
+	 simulated_device->elapsed_time,
+	 simulated_device->number_of_reads,
+	 simulated_device->number_of_failed_reads,
+	 number_of_detected_sectors,
+	 number_of_missed_sectors,
+	 number_of_unrecovered_sectors );
+
+	/* Every bad sector that was read must be reported as an error
+	 */
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_missed_sectors",
+	 number_of_missed_sectors,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remove(
+	 smdev_test_simulated_device_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	remove(
+	 smdev_test_simulated_device_scenario_path );
+
+	return( 0 );
+}
+
+/* Tests reading the simulated device using the handle for every benchmark scenario
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_simulated_device_benchmark(
+     void )
+{
+	int scenario_index = 0;
+	int result         = 0;
+
+	for( scenario_index = 0;
+	     smdev_test_simulated_device_scenarios[ scenario_index ].name != NULL;
+	     scenario_index++ )
+	{
+		result = smdev_test_simulated_device_run_scenario(
+		          &( smdev_test_simulated_device_scenarios[ scenario_index ] ) );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_simulated_device",
+	     smdev_test_simulated_device_scenario_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	SMDEV_TEST_RUN(
+	 "libsmdev_simulated_device_initialize",
+	 smdev_test_simulated_device_initialize );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_simulated_device_parse_integer",
+	 smdev_test_simulated_device_parse_integer );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_simulated_device_read_scenario_line",
+	 smdev_test_simulated_device_read_scenario_line );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_simulated_device_read_buffer",
+	 smdev_test_simulated_device_read_buffer );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle deferred probing",
+	 smdev_test_simulated_device_deferred_probing );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_simulated_device benchmark",
+	 smdev_test_simulated_device_benchmark );
+
+	remove(
+	 smdev_test_simulated_device_scenario_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+	remove(
+	 smdev_test_simulated_device_scenario_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,897 @@
+/*
+ * Library table_of_contents type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_sector_range.h"
+#include "../libsmdev/libsmdev_table_of_contents.h"
+#include "../libsmdev/libsmdev_track_value.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+/* Tests the libsmdev_table_of_contents_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_table_of_contents_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libsmdev_table_of_contents_t *table_of_contents = NULL;
+	int result                                      = 0;
+
+#if defined( HAVE_SMDEV_TEST_MEMORY )
+	int number_of_malloc_fail_tests                 = 1;
+	int number_of_memset_fail_tests                 = 1;
+	int test_number                                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libsmdev_table_of_contents_initialize(
+	          &table_of_contents,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "table_of_contents",
+	 table_of_contents );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_table_of_contents_free(
+	          &table_of_contents,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "table_of_contents",
+	 table_of_contents );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_table_of_contents_initialize(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	table_of_contents = (libsmdev_table_of_contents_t *) 0x12345678UL;
+
+	result = libsmdev_table_of_contents_initialize(
+	          &table_of_contents,
+	          &error );
+
+	table_of_contents = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_SMDEV_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmdev_table_of_contents_initialize with malloc failing
+		 */
+		smdev_test_malloc_attempts_before_fail = test_number;
+
+		result = libsmdev_table_of_contents_initialize(
+		          &table_of_contents,
+		          &error );
+
+		if( smdev_test_malloc_attempts_before_fail != -1 )
+		{
+			smdev_test_malloc_attempts_before_fail = -1;
+
+			if( table_of_contents != NULL )
+			{
+				libsmdev_table_of_contents_free(
+				 &table_of_contents,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMDEV_TEST_ASSERT_IS_NULL(
+			 "table_of_contents",
+			 table_of_contents );
+
+			SMDEV_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libsmdev_table_of_contents_initialize with memset failing
+		 */
+		smdev_test_memset_attempts_before_fail = test_number;
+
+		result = libsmdev_table_of_contents_initialize(
+		          &table_of_contents,
+		          &error );
+
+		if( smdev_test_memset_attempts_before_fail != -1 )
+		{
+			smdev_test_memset_attempts_before_fail = -1;
+
+			if( table_of_contents != NULL )
+			{
+				libsmdev_table_of_contents_free(
+				 &table_of_contents,
+				 NULL );
+			}
+		}
+		else
+		{
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			SMDEV_TEST_ASSERT_IS_NULL(
+			 "table_of_contents",
+			 table_of_contents );
+
+			SMDEV_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_SMDEV_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table_of_contents != NULL )
+	{
+		libsmdev_table_of_contents_free(
+		 &table_of_contents,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_table_of_contents_free function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_table_of_contents_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libsmdev_table_of_contents_free(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_table_of_contents_append_track and libsmdev_table_of_contents_get_track_by_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_table_of_contents_append_track(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libsmdev_table_of_contents_t *table_of_contents = NULL;
+	libsmdev_track_value_t *track_value             = NULL;
+	uint64_t number_of_sectors                      = 0;
+	uint64_t start_sector                           = 0;
+	uint8_t type                                    = 0;
+	int number_of_tracks                            = 0;
+	int result                                      = 0;
+	int track_index                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_table_of_contents_initialize(
+	          &table_of_contents,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "table_of_contents",
+	 table_of_contents );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Append more tracks than the minimum number of entries so the entries are resized
+	 */
+	for( track_index = 0;
+	     track_index < 99;
+	     track_index++ )
+	{
+		result = libsmdev_table_of_contents_append_track(
+		          table_of_contents,
+		          (uint64_t) track_index * 1000,
+		          1000,
+		          LIBSMDEV_TRACK_TYPE_AUDIO,
+		          &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		SMDEV_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libsmdev_table_of_contents_get_number_of_tracks(
+	          table_of_contents,
+	          &number_of_tracks,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_tracks",
+	 number_of_tracks,
+	 99 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_table_of_contents_get_track_by_index(
+	          table_of_contents,
+	          98,
+	          &track_value,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "track_value",
+	 track_value );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_track_value_get(
+	          track_value,
+	          &start_sector,
+	          &number_of_sectors,
+	          &type,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 98000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 1000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "type",
+	 type,
+	 LIBSMDEV_TRACK_TYPE_AUDIO );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_table_of_contents_append_track(
+	          NULL,
+	          0,
+	          1000,
+	          LIBSMDEV_TRACK_TYPE_AUDIO,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_table_of_contents_get_track_by_index(
+	          table_of_contents,
+	          99,
+	          &track_value,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_table_of_contents_get_track_by_index(
+	          table_of_contents,
+	          0,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_table_of_contents_free(
+	          &table_of_contents,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "table_of_contents",
+	 table_of_contents );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table_of_contents != NULL )
+	{
+		libsmdev_table_of_contents_free(
+		 &table_of_contents,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_table_of_contents_reserve and libsmdev_table_of_contents_empty functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_table_of_contents_reserve(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libsmdev_sector_range_t *sector_range           = NULL;
+	libsmdev_sector_range_t *sessions               = NULL;
+	libsmdev_table_of_contents_t *table_of_contents = NULL;
+	uint64_t number_of_sectors                      = 0;
+	uint64_t start_sector                           = 0;
+	int number_of_lead_outs                         = 0;
+	int number_of_sessions                          = 0;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_table_of_contents_initialize(
+	          &table_of_contents,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "table_of_contents",
+	 table_of_contents );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_table_of_contents_reserve(
+	          table_of_contents,
+	          2,
+	          1,
+	          16,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_GREATER_THAN_INT(
+	 "table_of_contents->number_of_allocated_tracks",
+	 table_of_contents->number_of_allocated_tracks,
+	 15 );
+
+	sessions = table_of_contents->sessions;
+
+	result = libsmdev_table_of_contents_append_session(
+	          table_of_contents,
+	          0,
+	          22500,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_table_of_contents_append_lead_out(
+	          table_of_contents,
+	          11100,
+	          11400,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_table_of_contents_append_session(
+	          table_of_contents,
+	          22500,
+	          10000,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The reserved entries are used without reallocation
+	 */
+	SMDEV_TEST_ASSERT_EQUAL_INTPTR(
+	 "table_of_contents->sessions",
+	 (intptr_t) table_of_contents->sessions,
+	 (intptr_t) sessions );
+
+	result = libsmdev_table_of_contents_get_number_of_sessions(
+	          table_of_contents,
+	          &number_of_sessions,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_sessions",
+	 number_of_sessions,
+	 2 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_table_of_contents_get_lead_out_by_index(
+	          table_of_contents,
+	          0,
+	          &sector_range,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_sector_range_get(
+	          sector_range,
+	          &start_sector,
+	          &number_of_sectors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 11100 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 11400 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_table_of_contents_get_session_by_index(
+	          table_of_contents,
+	          1,
+	          &sector_range,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_sector_range_get(
+	          sector_range,
+	          &start_sector,
+	          &number_of_sectors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "start_sector",
+	 start_sector,
+	 (uint64_t) 22500 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_sectors",
+	 number_of_sectors,
+	 (uint64_t) 10000 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Emptying retains the allocated entries
+	 */
+	result = libsmdev_table_of_contents_empty(
+	          table_of_contents,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INTPTR(
+	 "table_of_contents->sessions",
+	 (intptr_t) table_of_contents->sessions,
+	 (intptr_t) sessions );
+
+	result = libsmdev_table_of_contents_get_number_of_lead_outs(
+	          table_of_contents,
+	          &number_of_lead_outs,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_lead_outs",
+	 number_of_lead_outs,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_table_of_contents_get_session_by_index(
+	          table_of_contents,
+	          0,
+	          &sector_range,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_table_of_contents_reserve(
+	          NULL,
+	          2,
+	          1,
+	          16,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_table_of_contents_reserve(
+	          table_of_contents,
+	          -1,
+	          1,
+	          16,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_table_of_contents_empty(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_table_of_contents_free(
+	          &table_of_contents,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "table_of_contents",
+	 table_of_contents );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table_of_contents != NULL )
+	{
+		libsmdev_table_of_contents_free(
+		 &table_of_contents,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_table_of_contents_initialize",
+	 smdev_test_table_of_contents_initialize );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_table_of_contents_free",
+	 smdev_test_table_of_contents_free );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_table_of_contents_append_track",
+	 smdev_test_table_of_contents_append_track );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_table_of_contents_reserve",
+	 smdev_test_table_of_contents_reserve );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1061 @@
+/*
+ * Library transport profile functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_handle.h"
+#include "../libsmdev/libsmdev_parallel_reader.h"
+#include "../libsmdev/libsmdev_transport_profile.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+/* Tests the libsmdev_transport_profile_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_transport_profile_initialize(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libsmdev_transport_profile_t *transport_profile = NULL;
+	int result                                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_transport_profile_initialize(
+	          &transport_profile,
+	          LIBSMDEV_BUS_TYPE_SCSI,
+	          LIBSMDEV_MEDIA_TYPE_FIXED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "transport_profile",
+	 transport_profile );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "transport_profile->bus_type",
+	 transport_profile->bus_type,
+	 LIBSMDEV_BUS_TYPE_SCSI );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "transport_profile->media_type",
+	 transport_profile->media_type,
+	 LIBSMDEV_MEDIA_TYPE_FIXED );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "transport_profile->queue_depth",
+	 transport_profile->queue_depth,
+	 8 );
+
+	result = libsmdev_transport_profile_free(
+	          &transport_profile,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "transport_profile",
+	 transport_profile );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_transport_profile_initialize(
+	          NULL,
+	          LIBSMDEV_BUS_TYPE_SCSI,
+	          LIBSMDEV_MEDIA_TYPE_FIXED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_transport_profile_free(
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( transport_profile != NULL )
+	{
+		libsmdev_transport_profile_free(
+		 &transport_profile,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_transport_profile_set_values function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_transport_profile_set_values(
+     void )
+{
+	libcerror_error_t *error                        = NULL;
+	libsmdev_transport_profile_t *transport_profile = NULL;
+	int result                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_transport_profile_initialize(
+	          &transport_profile,
+	          LIBSMDEV_BUS_TYPE_USB,
+	          LIBSMDEV_MEDIA_TYPE_FIXED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_transport_profile_set_values(
+	          transport_profile,
+	          524288,
+	          4,
+	          3,
+	          512,
+	          10000,
+	          LIBSMDEV_CACHE_POLICY_WRITE_THROUGH,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "transport_profile->request_size",
+	 transport_profile->request_size,
+	 (size_t) 524288 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "transport_profile->queue_depth",
+	 transport_profile->queue_depth,
+	 4 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "transport_profile->number_of_error_retries",
+	 transport_profile->number_of_error_retries,
+	 3 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "transport_profile->error_granularity",
+	 transport_profile->error_granularity,
+	 (size_t) 512 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "transport_profile->deadline",
+	 transport_profile->deadline,
+	 10000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "transport_profile->cache_policy",
+	 transport_profile->cache_policy,
+	 LIBSMDEV_CACHE_POLICY_WRITE_THROUGH );
+
+	/* Test error cases
+	 */
+	result = libsmdev_transport_profile_set_values(
+	          NULL,
+	          524288,
+	          4,
+	          3,
+	          512,
+	          10000,
+	          LIBSMDEV_CACHE_POLICY_WRITE_THROUGH,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_transport_profile_set_values(
+	          transport_profile,
+	          0,
+	          4,
+	          3,
+	          512,
+	          10000,
+	          LIBSMDEV_CACHE_POLICY_WRITE_THROUGH,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_transport_profile_set_values(
+	          transport_profile,
+	          524288,
+	          LIBSMDEV_PARALLEL_READER_MAXIMUM_NUMBER_OF_WORKERS + 1,
+	          3,
+	          512,
+	          10000,
+	          LIBSMDEV_CACHE_POLICY_WRITE_THROUGH,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_transport_profile_set_values(
+	          transport_profile,
+	          524288,
+	          4,
+	          3,
+	          512,
+	          0,
+	          LIBSMDEV_CACHE_POLICY_WRITE_THROUGH,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_transport_profile_set_values(
+	          transport_profile,
+	          524288,
+	          4,
+	          3,
+	          512,
+	          10000,
+	          -1,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that the values are not changed by a failed call
+	 */
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "transport_profile->queue_depth",
+	 transport_profile->queue_depth,
+	 4 );
+
+	/* Clean up
+	 */
+	result = libsmdev_transport_profile_free(
+	          &transport_profile,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( transport_profile != NULL )
+	{
+		libsmdev_transport_profile_free(
+		 &transport_profile,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_transport_profile_get_built_in function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_transport_profile_get_built_in(
+     void )
+{
+	const libsmdev_transport_profile_t *transport_profile = NULL;
+	libcerror_error_t *error                              = NULL;
+	int result                                            = 0;
+
+	/* Test that a USB thumb drive gets the removable USB profile
+	 */
+	result = libsmdev_transport_profile_get_built_in(
+	          LIBSMDEV_BUS_TYPE_USB,
+	          LIBSMDEV_MEDIA_TYPE_REMOVABLE,
+	          &transport_profile,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "transport_profile",
+	 transport_profile );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "transport_profile->media_type",
+	 transport_profile->media_type,
+	 LIBSMDEV_MEDIA_TYPE_REMOVABLE );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "transport_profile->queue_depth",
+	 transport_profile->queue_depth,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "transport_profile->cache_policy",
+	 transport_profile->cache_policy,
+	 LIBSMDEV_CACHE_POLICY_WRITE_THROUGH );
+
+	/* Test that a fixed USB drive gets the USB profile
+	 */
+	result = libsmdev_transport_profile_get_built_in(
+	          LIBSMDEV_BUS_TYPE_USB,
+	          LIBSMDEV_MEDIA_TYPE_FIXED,
+	          &transport_profile,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "transport_profile->bus_type",
+	 transport_profile->bus_type,
+	 LIBSMDEV_BUS_TYPE_USB );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "transport_profile->media_type",
+	 transport_profile->media_type,
+	 LIBSMDEV_TRANSPORT_PROFILE_TYPE_ANY );
+
+	/* Test that a SAS disk gets the SCSI profile
+	 */
+	result = libsmdev_transport_profile_get_built_in(
+	          LIBSMDEV_BUS_TYPE_SCSI,
+	          LIBSMDEV_MEDIA_TYPE_FIXED,
+	          &transport_profile,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "transport_profile->bus_type",
+	 transport_profile->bus_type,
+	 LIBSMDEV_BUS_TYPE_SCSI );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "transport_profile->queue_depth",
+	 transport_profile->queue_depth,
+	 8 );
+
+	/* Test that the optical profile takes precedence over the bus profile
+	 */
+	result = libsmdev_transport_profile_get_built_in(
+	          LIBSMDEV_BUS_TYPE_USB,
+	          LIBSMDEV_MEDIA_TYPE_OPTICAL,
+	          &transport_profile,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "transport_profile->media_type",
+	 transport_profile->media_type,
+	 LIBSMDEV_MEDIA_TYPE_OPTICAL );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "transport_profile->error_granularity",
+	 transport_profile->error_granularity,
+	 (size_t) 2048 );
+
+	/* Test that an unknown bus type gets the defaults of the handle
+	 */
+	result = libsmdev_transport_profile_get_built_in(
+	          LIBSMDEV_BUS_TYPE_UNKNOWN,
+	          LIBSMDEV_MEDIA_TYPE_FIXED,
+	          &transport_profile,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "transport_profile->bus_type",
+	 transport_profile->bus_type,
+	 LIBSMDEV_TRANSPORT_PROFILE_TYPE_ANY );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "transport_profile->request_size",
+	 transport_profile->request_size,
+	 (size_t) LIBSMDEV_PARALLEL_READER_DEFAULT_STRIPE_SIZE );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "transport_profile->number_of_error_retries",
+	 transport_profile->number_of_error_retries,
+	 2 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "transport_profile->cache_policy",
+	 transport_profile->cache_policy,
+	 LIBSMDEV_CACHE_POLICY_NONE );
+
+	/* Test error cases
+	 */
+	result = libsmdev_transport_profile_get_built_in(
+	          LIBSMDEV_BUS_TYPE_USB,
+	          LIBSMDEV_MEDIA_TYPE_REMOVABLE,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_get_transport_profile, libsmdev_handle_set_transport_profile
+ * and libsmdev_internal_handle_apply_transport_profile functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_handle_transport_profile(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libsmdev_handle_t *handle                   = NULL;
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	size_t error_granularity                    = 0;
+	size_t request_size                         = 0;
+	uint32_t deadline                           = 0;
+	uint8_t number_of_error_retries             = 0;
+	int cache_policy                            = 0;
+	int queue_depth                             = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_handle_get_transport_profile(
+	          handle,
+	          LIBSMDEV_BUS_TYPE_USB,
+	          LIBSMDEV_MEDIA_TYPE_REMOVABLE,
+	          &request_size,
+	          &queue_depth,
+	          &number_of_error_retries,
+	          &error_granularity,
+	          &deadline,
+	          &cache_policy,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "request_size",
+	 request_size,
+	 (size_t) 65536 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "cache_policy",
+	 cache_policy,
+	 LIBSMDEV_CACHE_POLICY_WRITE_THROUGH );
+
+	/* Test that a value set by the caller is not overridden by the transport profile
+	 */
+	result = libsmdev_handle_set_number_of_error_retries(
+	          handle,
+	          5,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Mimic a probed removable USB device
+	 */
+	internal_handle->io_backend            = (libsmdev_io_backend_t *) handle;
+	internal_handle->bus_type              = LIBSMDEV_BUS_TYPE_USB;
+	internal_handle->removable             = 1;
+	internal_handle->media_information_set = 1;
+
+	result = libsmdev_geometry_initialize(
+	          &( internal_handle->geometry ),
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_internal_handle_apply_transport_profile(
+	          internal_handle,
+	          &error );
+
+	internal_handle->io_backend = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_handle->read_stripe_size",
+	 internal_handle->read_stripe_size,
+	 (size_t) 65536 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "internal_handle->number_of_read_threads",
+	 internal_handle->number_of_read_threads,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "internal_handle->number_of_error_retries",
+	 internal_handle->number_of_error_retries,
+	 5 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_handle->error_granularity",
+	 internal_handle->error_granularity,
+	 (size_t) 65536 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_handle->streaming_timeout",
+	 internal_handle->streaming_timeout,
+	 30000 );
+
+	/* Test that the cache policy is not applied without LIBSMDEV_ACCESS_FLAG_CONCURRENT_TRANSFERS
+	 */
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "internal_handle->number_of_write_buffers",
+	 internal_handle->number_of_write_buffers,
+	 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "internal_handle->write_flush_policy",
+	 internal_handle->write_flush_policy,
+	 LIBSMDEV_WRITE_FLUSH_POLICY_NONE );
+
+	/* Test that the cache policy is applied with LIBSMDEV_ACCESS_FLAG_CONCURRENT_TRANSFERS
+	 */
+	internal_handle->io_backend   = (libsmdev_io_backend_t *) handle;
+	internal_handle->access_flags = LIBSMDEV_OPEN_READ | LIBSMDEV_ACCESS_FLAG_CONCURRENT_TRANSFERS;
+
+	result = libsmdev_internal_handle_apply_transport_profile(
+	          internal_handle,
+	          &error );
+
+	internal_handle->io_backend = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "internal_handle->number_of_read_threads",
+	 internal_handle->number_of_read_threads,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "internal_handle->number_of_write_buffers",
+	 internal_handle->number_of_write_buffers,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "internal_handle->write_flush_policy",
+	 internal_handle->write_flush_policy,
+	 LIBSMDEV_WRITE_FLUSH_POLICY_INTERVAL );
+
+	/* Test that a transport profile set by the caller overrides the built-in one
+	 */
+	result = libsmdev_handle_set_transport_profile(
+	          handle,
+	          LIBSMDEV_BUS_TYPE_USB,
+	          LIBSMDEV_MEDIA_TYPE_REMOVABLE,
+	          131072,
+	          1,
+	          0,
+	          4096,
+	          5000,
+	          LIBSMDEV_CACHE_POLICY_NONE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_transport_profile(
+	          handle,
+	          LIBSMDEV_BUS_TYPE_USB,
+	          LIBSMDEV_MEDIA_TYPE_REMOVABLE,
+	          &request_size,
+	          &queue_depth,
+	          &number_of_error_retries,
+	          &error_granularity,
+	          &deadline,
+	          &cache_policy,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "request_size",
+	 request_size,
+	 (size_t) 131072 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT32(
+	 "deadline",
+	 deadline,
+	 5000 );
+
+	/* Test that setting the transport profile again replaces the values
+	 */
+	result = libsmdev_handle_set_transport_profile(
+	          handle,
+	          LIBSMDEV_BUS_TYPE_USB,
+	          LIBSMDEV_MEDIA_TYPE_REMOVABLE,
+	          262144,
+	          1,
+	          0,
+	          4096,
+	          5000,
+	          LIBSMDEV_CACHE_POLICY_NONE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_handle->io_backend = (libsmdev_io_backend_t *) handle;
+
+	result = libsmdev_internal_handle_apply_transport_profile(
+	          internal_handle,
+	          &error );
+
+	internal_handle->io_backend = NULL;
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_handle->read_stripe_size",
+	 internal_handle->read_stripe_size,
+	 (size_t) 262144 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "internal_handle->number_of_write_buffers",
+	 internal_handle->number_of_write_buffers,
+	 0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "internal_handle->write_flush_policy",
+	 internal_handle->write_flush_policy,
+	 LIBSMDEV_WRITE_FLUSH_POLICY_NONE );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_get_transport_profile(
+	          NULL,
+	          LIBSMDEV_BUS_TYPE_USB,
+	          LIBSMDEV_MEDIA_TYPE_REMOVABLE,
+	          &request_size,
+	          &queue_depth,
+	          &number_of_error_retries,
+	          &error_granularity,
+	          &deadline,
+	          &cache_policy,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_get_transport_profile(
+	          handle,
+	          LIBSMDEV_BUS_TYPE_USB,
+	          LIBSMDEV_MEDIA_TYPE_REMOVABLE,
+	          NULL,
+	          &queue_depth,
+	          &number_of_error_retries,
+	          &error_granularity,
+	          &deadline,
+	          &cache_policy,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_set_transport_profile(
+	          NULL,
+	          LIBSMDEV_BUS_TYPE_USB,
+	          LIBSMDEV_MEDIA_TYPE_REMOVABLE,
+	          131072,
+	          1,
+	          0,
+	          4096,
+	          5000,
+	          LIBSMDEV_CACHE_POLICY_NONE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_set_transport_profile(
+	          handle,
+	          LIBSMDEV_BUS_TYPE_ATA,
+	          LIBSMDEV_MEDIA_TYPE_FIXED,
+	          131072,
+	          0,
+	          0,
+	          4096,
+	          5000,
+	          LIBSMDEV_CACHE_POLICY_NONE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_handle != NULL )
+	{
+		internal_handle->io_backend = NULL;
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_transport_profile_initialize",
+	 smdev_test_transport_profile_initialize );
+
+	/* libsmdev_transport_profile_free is tested in smdev_test_transport_profile_initialize */
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_transport_profile_set_values",
+	 smdev_test_transport_profile_set_values );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_transport_profile_get_built_in",
+	 smdev_test_transport_profile_get_built_in );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_transport_profile",
+	 smdev_test_handle_transport_profile );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
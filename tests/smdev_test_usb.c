@@ -0,0 +1,981 @@
+/*
+ * Library USB functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_handle.h"
+#include "../libsmdev/libsmdev_usb.h"
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+/* Tests the libsmdev_usb_get_link_speed_from_string function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_usb_get_link_speed_from_string(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t link_speed       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_usb_get_link_speed_from_string(
+	          (uint8_t *) "480",
+	          3,
+	          &link_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "link_speed",
+	 link_speed,
+	 LIBSMDEV_USB_LINK_SPEED_HIGH );
+
+	result = libsmdev_usb_get_link_speed_from_string(
+	          (uint8_t *) "1.5",
+	          3,
+	          &link_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "link_speed",
+	 link_speed,
+	 LIBSMDEV_USB_LINK_SPEED_LOW );
+
+	result = libsmdev_usb_get_link_speed_from_string(
+	          (uint8_t *) "5000",
+	          4,
+	          &link_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "link_speed",
+	 link_speed,
+	 LIBSMDEV_USB_LINK_SPEED_SUPER );
+
+	result = libsmdev_usb_get_link_speed_from_string(
+	          (uint8_t *) "20000",
+	          5,
+	          &link_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "link_speed",
+	 link_speed,
+	 LIBSMDEV_USB_LINK_SPEED_SUPER_PLUS_2X2 );
+
+	/* Test an unsupported link speed
+	 */
+	result = libsmdev_usb_get_link_speed_from_string(
+	          (uint8_t *) "4800",
+	          4,
+	          &link_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "link_speed",
+	 link_speed,
+	 LIBSMDEV_USB_LINK_SPEED_UNKNOWN );
+
+	/* Test error cases
+	 */
+	result = libsmdev_usb_get_link_speed_from_string(
+	          NULL,
+	          3,
+	          &link_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_usb_get_link_speed_from_string(
+	          (uint8_t *) "480",
+	          (size_t) SSIZE_MAX + 1,
+	          &link_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_usb_get_link_speed_from_string(
+	          (uint8_t *) "480",
+	          3,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_usb_get_protocol_from_driver_path function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_usb_get_protocol_from_driver_path(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	const char *path         = NULL;
+	uint8_t protocol         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	path = "../../../../../../bus/usb/drivers/uas";
+
+	result = libsmdev_usb_get_protocol_from_driver_path(
+	          path,
+	          narrow_string_length(
+	           path ),
+	          &protocol,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "protocol",
+	 protocol,
+	 LIBSMDEV_USB_PROTOCOL_UAS );
+
+	path = "../../../../../../bus/usb/drivers/usb-storage";
+
+	result = libsmdev_usb_get_protocol_from_driver_path(
+	          path,
+	          narrow_string_length(
+	           path ),
+	          &protocol,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "protocol",
+	 protocol,
+	 LIBSMDEV_USB_PROTOCOL_BULK_ONLY );
+
+	/* Test that a driver name that only starts with uas is not matched
+	 */
+	path = "../../../../../../bus/usb/drivers/uasp";
+
+	result = libsmdev_usb_get_protocol_from_driver_path(
+	          path,
+	          narrow_string_length(
+	           path ),
+	          &protocol,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "protocol",
+	 protocol,
+	 LIBSMDEV_USB_PROTOCOL_UNKNOWN );
+
+	/* Test error cases
+	 */
+	result = libsmdev_usb_get_protocol_from_driver_path(
+	          NULL,
+	          3,
+	          &protocol,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_usb_get_protocol_from_driver_path(
+	          "uas",
+	          3,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_usb_get_interface_path_length function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_usb_get_interface_path_length(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	const char *path             = NULL;
+	size_t device_path_length    = 0;
+	size_t interface_path_length = 0;
+	int result                   = 0;
+
+	/* Test a disk attached via an USB hub
+	 */
+	path = "../../devices/pci0000:00/0000:00:14.0/usb2/2-1/2-1.3/2-1.3:1.0/host6/target6:0:0/6:0:0:0/block/sdb";
+
+	result = libsmdev_usb_get_interface_path_length(
+	          path,
+	          narrow_string_length(
+	           path ),
+	          &device_path_length,
+	          &interface_path_length,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "device_path_length",
+	 device_path_length,
+	 (size_t) 52 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "interface_path_length",
+	 interface_path_length,
+	 (size_t) 62 );
+
+	/* Test a disk not attached via USB
+	 */
+	path = "../../devices/pci0000:00/0000:00:17.0/ata1/host0/target0:0:0/0:0:0:0/block/sda";
+
+	result = libsmdev_usb_get_interface_path_length(
+	          path,
+	          narrow_string_length(
+	           path ),
+	          &device_path_length,
+	          &interface_path_length,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_usb_get_interface_path_length(
+	          NULL,
+	          0,
+	          &device_path_length,
+	          &interface_path_length,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_usb_get_interface_path_length(
+	          path,
+	          narrow_string_length(
+	           path ),
+	          NULL,
+	          &interface_path_length,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_usb_get_interface_path_length(
+	          path,
+	          narrow_string_length(
+	           path ),
+	          &device_path_length,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_usb_get_link_information function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_usb_get_link_information(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	size_t maximum_transfer_size = 0;
+	uint8_t link_speed           = 0;
+	uint8_t protocol             = 0;
+	int result                   = 0;
+
+	/* Test a block device that does not exist
+	 */
+	result = libsmdev_usb_get_link_information(
+	          "smdev_test_missing",
+	          &link_speed,
+	          &protocol,
+	          &maximum_transfer_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "link_speed",
+	 link_speed,
+	 LIBSMDEV_USB_LINK_SPEED_UNKNOWN );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_transfer_size",
+	 maximum_transfer_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_usb_get_link_information(
+	          NULL,
+	          &link_speed,
+	          &protocol,
+	          &maximum_transfer_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_usb_get_link_information(
+	          "sda",
+	          NULL,
+	          &protocol,
+	          &maximum_transfer_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_usb_get_link_information(
+	          "sda",
+	          &link_speed,
+	          NULL,
+	          &maximum_transfer_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_usb_get_link_information(
+	          "sda",
+	          &link_speed,
+	          &protocol,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_get_usb_link_speed, libsmdev_handle_get_usb_protocol
+ * and libsmdev_handle_get_usb_maximum_transfer_size functions
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_handle_usb_information(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libsmdev_handle_t *handle                   = NULL;
+	libsmdev_internal_handle_t *internal_handle = NULL;
+	size_t maximum_transfer_size                = 0;
+	uint8_t link_speed                          = 0;
+	uint8_t protocol                            = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_handle = (libsmdev_internal_handle_t *) handle;
+
+	/* Mimic a device attached via USB 2.0 using the Bulk-Only Transport
+	 */
+	internal_handle->io_backend                = (libsmdev_io_backend_t *) handle;
+	internal_handle->usb_link_speed            = LIBSMDEV_USB_LINK_SPEED_HIGH;
+	internal_handle->usb_protocol              = LIBSMDEV_USB_PROTOCOL_BULK_ONLY;
+	internal_handle->usb_maximum_transfer_size = 122880;
+	internal_handle->usb_attached              = 1;
+	internal_handle->usb_information_set       = 1;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_handle_get_usb_link_speed(
+	          handle,
+	          &link_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "link_speed",
+	 link_speed,
+	 LIBSMDEV_USB_LINK_SPEED_HIGH );
+
+	result = libsmdev_handle_get_usb_protocol(
+	          handle,
+	          &protocol,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "protocol",
+	 protocol,
+	 LIBSMDEV_USB_PROTOCOL_BULK_ONLY );
+
+	result = libsmdev_handle_get_usb_maximum_transfer_size(
+	          handle,
+	          &maximum_transfer_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_transfer_size",
+	 maximum_transfer_size,
+	 (size_t) 122880 );
+
+	/* Test that the Bulk-Only Transport and the bridge limit the requests
+	 */
+	internal_handle->bus_type              = LIBSMDEV_BUS_TYPE_USB;
+	internal_handle->bytes_per_sector      = 4096;
+	internal_handle->media_information_set = 1;
+
+	result = libsmdev_geometry_initialize(
+	          &( internal_handle->geometry ),
+	          4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_internal_handle_apply_transport_profile(
+	          internal_handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_handle->read_stripe_size",
+	 internal_handle->read_stripe_size,
+	 (size_t) 122880 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "internal_handle->number_of_read_threads",
+	 internal_handle->number_of_read_threads,
+	 1 );
+
+	/* Test that a device that is not attached via USB has no USB information
+	 */
+	internal_handle->usb_attached = 0;
+
+	result = libsmdev_handle_get_usb_link_speed(
+	          handle,
+	          &link_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_usb_protocol(
+	          handle,
+	          &protocol,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_get_usb_maximum_transfer_size(
+	          handle,
+	          &maximum_transfer_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_get_usb_link_speed(
+	          handle,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_get_usb_protocol(
+	          handle,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_get_usb_maximum_transfer_size(
+	          handle,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	internal_handle->io_backend = NULL;
+
+	result = libsmdev_handle_get_usb_link_speed(
+	          handle,
+	          &link_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_get_usb_link_speed(
+	          NULL,
+	          &link_speed,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( internal_handle != NULL )
+	{
+		internal_handle->io_backend = NULL;
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_usb_get_link_speed_from_string",
+	 smdev_test_usb_get_link_speed_from_string );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_usb_get_protocol_from_driver_path",
+	 smdev_test_usb_get_protocol_from_driver_path );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_usb_get_interface_path_length",
+	 smdev_test_usb_get_interface_path_length );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_usb_get_link_information",
+	 smdev_test_usb_get_link_information );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_usb_information",
+	 smdev_test_handle_usb_information );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
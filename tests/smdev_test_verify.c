@@ -0,0 +1,794 @@
+/*
+ * Library verify functions test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "smdev_test_functions.h"
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_verify.h"
+
+#define SMDEV_TEST_VERIFY_MEDIA_SIZE		0x280000
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+/* The path of the scenario file
+ */
+char smdev_test_verify_scenario_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The path of the reference file
+ */
+char smdev_test_verify_reference_path[ SMDEV_TEST_MAXIMUM_PATH_SIZE ];
+
+/* The scenario of the simulated device
+ */
+const char *smdev_test_verify_scenario = \
+	"size 0x280000\n"
+	"bad 0x20000 1024\n"
+	"bad 0x27c000 4096\n";
+
+/* Retrieves the number of mismatches and their combined size
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_verify_get_mismatches(
+     libsmdev_handle_t *handle,
+     int *number_of_mismatches,
+     size64_t *mismatches_size,
+     libcerror_error_t **error )
+{
+	off64_t mismatch_offset = 0;
+	size64_t mismatch_size  = 0;
+	int mismatch_index      = 0;
+
+	if( libsmdev_handle_get_number_of_mismatches(
+	     handle,
+	     number_of_mismatches,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	*mismatches_size = 0;
+
+	for( mismatch_index = 0;
+	     mismatch_index < *number_of_mismatches;
+	     mismatch_index++ )
+	{
+		if( libsmdev_handle_get_mismatch(
+		     handle,
+		     mismatch_index,
+		     &mismatch_offset,
+		     &mismatch_size,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+		*mismatches_size += mismatch_size;
+	}
+	return( 1 );
+}
+
+/* Tests the libsmdev_verify_compare_data function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_verify_compare_data(
+     void )
+{
+	uint8_t data[ 1024 + 8 ];
+	uint8_t reference_data[ 1024 + 8 ];
+
+	size_t data_index = 0;
+	size_t result     = 0;
+	int alignment     = 0;
+
+	for( data_index = 0;
+	     data_index < ( 1024 + 8 );
+	     data_index++ )
+	{
+		data[ data_index ]           = (uint8_t) ( data_index % 251 );
+		reference_data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	/* Test buffers with the same and with a different alignment
+	 */
+	for( alignment = 0;
+	     alignment < 8;
+	     alignment += 3 )
+	{
+		result = libsmdev_verify_compare_data(
+		          &( data[ alignment ] ),
+		          &( reference_data[ alignment ] ),
+		          1024 );
+
+		SMDEV_TEST_ASSERT_EQUAL_SIZE(
+		 "result",
+		 result,
+		 (size_t) 1024 );
+
+		for( data_index = 0;
+		     data_index < 1024;
+		     data_index += 97 )
+		{
+			reference_data[ alignment + data_index ] ^= 0x01;
+
+			result = libsmdev_verify_compare_data(
+			          &( data[ alignment ] ),
+			          &( reference_data[ alignment ] ),
+			          1024 );
+
+			reference_data[ alignment + data_index ] ^= 0x01;
+
+			SMDEV_TEST_ASSERT_EQUAL_SIZE(
+			 "result",
+			 result,
+			 data_index );
+		}
+	}
+	memory_copy(
+	 reference_data,
+	 &( data[ 3 ] ),
+	 1024 );
+
+	result = libsmdev_verify_compare_data(
+	          &( data[ 3 ] ),
+	          reference_data,
+	          1024 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "result",
+	 result,
+	 (size_t) 1024 );
+
+	reference_data[ 1023 ] ^= 0xff;
+
+	result = libsmdev_verify_compare_data(
+	          &( data[ 3 ] ),
+	          reference_data,
+	          1024 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "result",
+	 result,
+	 (size_t) 1023 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_verify_compare_data(
+	          NULL,
+	          reference_data,
+	          1024 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "result",
+	 result,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libsmdev_verify_get_chunk_size function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_verify_get_chunk_size(
+     void )
+{
+	size_t chunk_size = 0;
+
+	chunk_size = libsmdev_verify_get_chunk_size(
+	              0,
+	              (size64_t) 3 * LIBSMDEV_VERIFY_BUFFER_SIZE );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_size",
+	 chunk_size,
+	 (size_t) LIBSMDEV_VERIFY_BUFFER_SIZE );
+
+	chunk_size = libsmdev_verify_get_chunk_size(
+	              512,
+	              (size64_t) 3 * LIBSMDEV_VERIFY_BUFFER_SIZE );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_size",
+	 chunk_size,
+	 (size_t) ( LIBSMDEV_VERIFY_BUFFER_SIZE - 512 ) );
+
+	chunk_size = libsmdev_verify_get_chunk_size(
+	              (off64_t) LIBSMDEV_VERIFY_BUFFER_SIZE,
+	              4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "chunk_size",
+	 chunk_size,
+	 (size_t) 4096 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libsmdev_handle_verify_with_file_descriptor function on a simulated device
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_verify_with_file_descriptor(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libsmdev_handle_t *handle = NULL;
+	uint8_t *reference_data   = NULL;
+	size64_t mismatches_size  = 0;
+	size64_t mismatch_size    = 0;
+	off64_t mismatch_offset   = 0;
+	off64_t offset            = 0;
+	size_t data_index         = 0;
+	int file_descriptor       = -1;
+	int number_of_mismatches  = 0;
+	int result                = 0;
+
+	result = smdev_test_write_file(
+	          smdev_test_verify_scenario_path,
+	          (const uint8_t *) smdev_test_verify_scenario,
+	          narrow_string_length(
+	           smdev_test_verify_scenario ),
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The reference contains the data of the simulated device including the data of the bad sectors
+	 */
+	reference_data = (uint8_t *) memory_allocate(
+	                              SMDEV_TEST_VERIFY_MEDIA_SIZE );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "reference_data",
+	 reference_data );
+
+	for( data_index = 0;
+	     data_index < SMDEV_TEST_VERIFY_MEDIA_SIZE;
+	     data_index++ )
+	{
+		reference_data[ data_index ] = (uint8_t) ( data_index % 251 );
+	}
+	/* A single byte mismatch and a mismatch of multiple sectors
+	 */
+	reference_data[ 0x100000 + 10 ] ^= 0xff;
+
+	for( data_index = 0x1ff900;
+	     data_index < 0x200300;
+	     data_index++ )
+	{
+		reference_data[ data_index ] ^= 0xff;
+	}
+	result = smdev_test_write_file(
+	          smdev_test_verify_reference_path,
+	          reference_data,
+	          SMDEV_TEST_VERIFY_MEDIA_SIZE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_initialize(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_set_io_backend_type(
+	          handle,
+	          LIBSMDEV_IO_BACKEND_TYPE_SIMULATED,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_set_error_granularity(
+	          handle,
+	          512,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_set_error_flags(
+	          handle,
+	          LIBSMDEV_ERROR_FLAG_ZERO_ON_ERROR,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_open(
+	          handle,
+	          smdev_test_verify_scenario_path,
+	          LIBSMDEV_OPEN_READ,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_descriptor = open(
+	                   smdev_test_verify_reference_path,
+	                   O_RDONLY );
+
+	SMDEV_TEST_ASSERT_NOT_EQUAL_INT(
+	 "file_descriptor",
+	 file_descriptor,
+	 -1 );
+
+	/* Test regular cases
+	 * The bad sectors differ from the reference but are expected to
+	 */
+	result = libsmdev_handle_verify_with_file_descriptor(
+	          handle,
+	          file_descriptor,
+	          0,
+	          SMDEV_TEST_VERIFY_MEDIA_SIZE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smdev_test_verify_get_mismatches(
+	          handle,
+	          &number_of_mismatches,
+	          &mismatches_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_mismatches",
+	 number_of_mismatches,
+	 2 );
+
+	result = libsmdev_handle_get_mismatch(
+	          handle,
+	          0,
+	          &mismatch_offset,
+	          &mismatch_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "mismatch_offset",
+	 (int64_t) mismatch_offset,
+	 (int64_t) 0x100000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "mismatch_size",
+	 (uint64_t) mismatch_size,
+	 (uint64_t) 512 );
+
+	result = libsmdev_handle_get_mismatch(
+	          handle,
+	          1,
+	          &mismatch_offset,
+	          &mismatch_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "mismatch_offset",
+	 (int64_t) mismatch_offset,
+	 (int64_t) 0x1ff800 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "mismatch_size",
+	 (uint64_t) mismatch_size,
+	 (uint64_t) 0xc00 );
+
+	/* Test a range that does not start on a sector boundary
+	 */
+	offset = lseek(
+	          file_descriptor,
+	          0x1ffa10,
+	          SEEK_SET );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0x1ffa10 );
+
+	result = libsmdev_handle_verify_with_file_descriptor(
+	          handle,
+	          file_descriptor,
+	          0x1ffa10,
+	          0x1000,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_handle_get_number_of_mismatches(
+	          handle,
+	          &number_of_mismatches,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_mismatches",
+	 number_of_mismatches,
+	 1 );
+
+	result = libsmdev_handle_get_mismatch(
+	          handle,
+	          0,
+	          &mismatch_offset,
+	          &mismatch_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT64(
+	 "mismatch_offset",
+	 (int64_t) mismatch_offset,
+	 (int64_t) 0x1ffa10 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "mismatch_size",
+	 (uint64_t) mismatch_size,
+	 (uint64_t) ( 0x200400 - 0x1ffa10 ) );
+
+	/* Test a reference that ends before the range
+	 * The missing data is a mismatch except for the bad sectors
+	 */
+	close(
+	 file_descriptor );
+
+	result = smdev_test_write_file(
+	          smdev_test_verify_reference_path,
+	          reference_data,
+	          0x200000,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_descriptor = open(
+	                   smdev_test_verify_reference_path,
+	                   O_RDONLY );
+
+	SMDEV_TEST_ASSERT_NOT_EQUAL_INT(
+	 "file_descriptor",
+	 file_descriptor,
+	 -1 );
+
+	result = libsmdev_handle_verify_with_file_descriptor(
+	          handle,
+	          file_descriptor,
+	          0,
+	          SMDEV_TEST_VERIFY_MEDIA_SIZE,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = smdev_test_verify_get_mismatches(
+	          handle,
+	          &number_of_mismatches,
+	          &mismatches_size,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "mismatches_size",
+	 (uint64_t) mismatches_size,
+	 (uint64_t) ( 512 + 0x800 + 0x80000 - 4096 ) );
+
+	/* Test error cases
+	 */
+	result = libsmdev_handle_verify_with_file_descriptor(
+	          NULL,
+	          file_descriptor,
+	          0,
+	          4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_verify_with_file_descriptor(
+	          handle,
+	          -1,
+	          0,
+	          4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_handle_verify_with_file_descriptor(
+	          handle,
+	          file_descriptor,
+	          0x27f000,
+	          8192,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	close(
+	 file_descriptor );
+
+	file_descriptor = -1;
+
+	result = libsmdev_handle_close(
+	          handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libsmdev_handle_free(
+	          &handle,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 reference_data );
+
+	remove(
+	 smdev_test_verify_reference_path );
+	remove(
+	 smdev_test_verify_scenario_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	if( reference_data != NULL )
+	{
+		memory_free(
+		 reference_data );
+	}
+	remove(
+	 smdev_test_verify_reference_path );
+	remove(
+	 smdev_test_verify_scenario_path );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_verify",
+	     smdev_test_verify_scenario_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( smdev_test_get_temporary_path(
+	     "smdev_test_verify_reference",
+	     smdev_test_verify_reference_path,
+	     SMDEV_TEST_MAXIMUM_PATH_SIZE,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	SMDEV_TEST_RUN(
+	 "libsmdev_verify_compare_data",
+	 smdev_test_verify_compare_data );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_verify_get_chunk_size",
+	 smdev_test_verify_get_chunk_size );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_handle_verify_with_file_descriptor",
+	 smdev_test_verify_with_file_descriptor );
+
+	remove(
+	 smdev_test_verify_scenario_path );
+
+	remove(
+	 smdev_test_verify_reference_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	remove(
+	 smdev_test_verify_scenario_path );
+
+	remove(
+	 smdev_test_verify_reference_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_FAILURE );
+}
+
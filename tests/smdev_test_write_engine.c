@@ -0,0 +1,1761 @@
+/*
+ * Library write_engine type test program
+ *
+ * Copyright (C) 2010-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "smdev_test_libcerror.h"
+#include "smdev_test_libsmdev.h"
+#include "smdev_test_macros.h"
+#include "smdev_test_memory.h"
+#include "smdev_test_unused.h"
+
+#include "../libsmdev/libsmdev_io_backend.h"
+#include "../libsmdev/libsmdev_write_engine.h"
+
+/* The size of the memory device
+ */
+#define SMDEV_TEST_WRITE_ENGINE_DEVICE_SIZE		( 4 * 1048576 )
+
+/* The size of the data written by the benchmark
+ */
+#define SMDEV_TEST_WRITE_ENGINE_BENCHMARK_SIZE		( 64 * 1048576 )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+typedef struct smdev_test_write_engine_device smdev_test_write_engine_device_t;
+
+struct smdev_test_write_engine_device
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The current offset
+	 */
+	off64_t offset;
+
+	/* The offset of the range that cannot be read or written
+	 */
+	off64_t bad_offset;
+
+	/* The size of the range that cannot be read or written
+	 */
+	size_t bad_size;
+
+	/* The error code of an access of the bad range
+	 */
+	uint32_t bad_error_code;
+
+	/* The number of writes
+	 */
+	int number_of_writes;
+
+	/* The number of writes that were not sector aligned
+	 */
+	int number_of_unaligned_writes;
+};
+
+/* The number of times the device was flushed
+ */
+int smdev_test_write_engine_number_of_flushes = 0;
+
+/* Value to indicate the memory device supports writing zeroes
+ */
+int smdev_test_write_engine_write_zeroes_supported = 0;
+
+/* The number of times writing zeroes was requested
+ */
+int smdev_test_write_engine_number_of_write_zeroes = 0;
+
+/* The number of bytes zeroed by writing zeroes
+ */
+size64_t smdev_test_write_engine_zeroed_size = 0;
+
+/* Determines if an access overlaps with the bad range of the memory device
+ * Returns 1 if the access overlaps or 0 if not
+ */
+int smdev_test_write_engine_device_is_bad(
+     smdev_test_write_engine_device_t *device,
+     size_t size )
+{
+	if( device->bad_size == 0 )
+	{
+		return( 0 );
+	}
+	if( ( device->offset < ( device->bad_offset + (off64_t) device->bad_size ) )
+	 && ( ( device->offset + (off64_t) size ) > device->bad_offset ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads from the memory device
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t smdev_test_write_engine_device_read(
+         intptr_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	smdev_test_write_engine_device_t *device = (smdev_test_write_engine_device_t *) io_handle;
+
+	if( smdev_test_write_engine_device_is_bad(
+	     device,
+	     size ) != 0 )
+	{
+		*error_code = device->bad_error_code;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "unable to read from bad range." );
+
+		return( -1 );
+	}
+	if( device->offset >= (off64_t) SMDEV_TEST_WRITE_ENGINE_DEVICE_SIZE )
+	{
+		return( 0 );
+	}
+	if( size > (size_t) ( SMDEV_TEST_WRITE_ENGINE_DEVICE_SIZE - device->offset ) )
+	{
+		size = (size_t) ( SMDEV_TEST_WRITE_ENGINE_DEVICE_SIZE - device->offset );
+	}
+	memory_copy(
+	 buffer,
+	 &( device->data[ device->offset ] ),
+	 size );
+
+	device->offset += (off64_t) size;
+
+	return( (ssize_t) size );
+}
+
+/* Writes to the memory device
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t smdev_test_write_engine_device_write(
+         intptr_t *io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         uint32_t *error_code,
+         libcerror_error_t **error )
+{
+	smdev_test_write_engine_device_t *device = (smdev_test_write_engine_device_t *) io_handle;
+
+	device->number_of_writes++;
+
+	if( ( ( device->offset % 512 ) != 0 )
+	 || ( ( size % 512 ) != 0 ) )
+	{
+		device->number_of_unaligned_writes++;
+	}
+	if( smdev_test_write_engine_device_is_bad(
+	     device,
+	     size ) != 0 )
+	{
+		*error_code = device->bad_error_code;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "unable to write to bad range." );
+
+		return( -1 );
+	}
+	if( ( device->offset + (off64_t) size ) > (off64_t) SMDEV_TEST_WRITE_ENGINE_DEVICE_SIZE )
+	{
+		*error_code = (uint32_t) ENOSPC;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "unable to write beyond end of device." );
+
+		return( -1 );
+	}
+	memory_copy(
+	 &( device->data[ device->offset ] ),
+	 buffer,
+	 size );
+
+	device->offset += (off64_t) size;
+
+	return( (ssize_t) size );
+}
+
+/* Seeks an offset in the memory device
+ * Returns the offset or -1 on error
+ */
+off64_t smdev_test_write_engine_device_seek_offset(
+         intptr_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error SMDEV_TEST_ATTRIBUTE_UNUSED )
+{
+	smdev_test_write_engine_device_t *device = (smdev_test_write_engine_device_t *) io_handle;
+
+	SMDEV_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( whence == SEEK_CUR )
+	{
+		offset += device->offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) SMDEV_TEST_WRITE_ENGINE_DEVICE_SIZE;
+	}
+	device->offset = offset;
+
+	return( offset );
+}
+
+/* Flushes the memory device
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_write_engine_flush_device(
+     intptr_t *flush_context SMDEV_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error SMDEV_TEST_ATTRIBUTE_UNUSED )
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( flush_context )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( error )
+
+	smdev_test_write_engine_number_of_flushes++;
+
+	return( 1 );
+}
+
+/* Writes zeroes to the memory device without transferring the data
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int smdev_test_write_engine_write_zeroes(
+     intptr_t *write_zeroes_context,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error SMDEV_TEST_ATTRIBUTE_UNUSED )
+{
+	smdev_test_write_engine_device_t *device = (smdev_test_write_engine_device_t *) write_zeroes_context;
+
+	SMDEV_TEST_UNREFERENCED_PARAMETER( error )
+
+	smdev_test_write_engine_number_of_write_zeroes++;
+
+	if( smdev_test_write_engine_write_zeroes_supported == 0 )
+	{
+		return( 0 );
+	}
+	memory_set(
+	 &( device->data[ offset ] ),
+	 0,
+	 (size_t) size );
+
+	smdev_test_write_engine_zeroed_size += size;
+
+	return( 1 );
+}
+
+/* Creates a memory device and a corresponding IO backend
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_write_engine_device_initialize(
+     smdev_test_write_engine_device_t *device,
+     libsmdev_io_backend_t **io_backend,
+     libcerror_error_t **error )
+{
+	if( memory_set(
+	     device,
+	     0,
+	     sizeof( smdev_test_write_engine_device_t ) ) == NULL )
+	{
+		return( -1 );
+	}
+	device->data = (uint8_t *) memory_allocate(
+	                            SMDEV_TEST_WRITE_ENGINE_DEVICE_SIZE );
+
+	if( device->data == NULL )
+	{
+		return( -1 );
+	}
+	memory_set(
+	 device->data,
+	 0xaa,
+	 SMDEV_TEST_WRITE_ENGINE_DEVICE_SIZE );
+
+	if( libsmdev_io_backend_initialize(
+	     io_backend,
+	     LIBSMDEV_IO_BACKEND_TYPE_UNDEFINED,
+	     error ) != 1 )
+	{
+		memory_free(
+		 device->data );
+
+		device->data = NULL;
+
+		return( -1 );
+	}
+	( *io_backend )->io_handle   = (intptr_t *) device;
+	( *io_backend )->read        = &smdev_test_write_engine_device_read;
+	( *io_backend )->write       = &smdev_test_write_engine_device_write;
+	( *io_backend )->seek_offset = &smdev_test_write_engine_device_seek_offset;
+
+	return( 1 );
+}
+
+/* Frees a memory device and a corresponding IO backend
+ */
+void smdev_test_write_engine_device_free(
+      smdev_test_write_engine_device_t *device,
+      libsmdev_io_backend_t **io_backend )
+{
+	if( *io_backend != NULL )
+	{
+		libsmdev_io_backend_free(
+		 io_backend,
+		 NULL );
+	}
+	if( device->data != NULL )
+	{
+		memory_free(
+		 device->data );
+
+		device->data = NULL;
+	}
+}
+
+/* Tests the libsmdev_write_engine_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_write_engine_buffer_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libsmdev_write_engine_buffer_t *buffer = NULL;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libsmdev_write_engine_buffer_initialize(
+	          &buffer,
+	          4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer->allocated_size",
+	 buffer->allocated_size,
+	 (size_t) 4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer->data_size",
+	 buffer->data_size,
+	 (size_t) 0 );
+
+	result = libsmdev_write_engine_buffer_free(
+	          &buffer,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "buffer",
+	 buffer );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libsmdev_write_engine_buffer_initialize(
+	          NULL,
+	          4096,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libsmdev_write_engine_buffer_initialize(
+	          &buffer,
+	          0,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "buffer",
+	 buffer );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		libsmdev_write_engine_buffer_free(
+		 &buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests writing unaligned data using a specific number of buffers
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_write_engine_write_unaligned(
+     int number_of_buffers )
+{
+	uint8_t data[ 8192 ];
+
+	smdev_test_write_engine_device_t device;
+
+	libcdata_range_list_t *errors_range_list = NULL;
+	libcerror_error_t *error                 = NULL;
+	libsmdev_io_backend_t *io_backend        = NULL;
+	libsmdev_write_engine_t *write_engine    = NULL;
+	size_t data_offset                       = 0;
+	ssize_t write_count                      = 0;
+	int number_of_errors                     = 0;
+	int result                               = 0;
+
+	device.data = NULL;
+
+	for( data_offset = 0;
+	     data_offset < 8192;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	result = smdev_test_write_engine_device_initialize(
+	          &device,
+	          &io_backend,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_range_list_initialize(
+	          &errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_write_engine_initialize(
+	          &write_engine,
+	          io_backend,
+	          512,
+	          (size64_t) SMDEV_TEST_WRITE_ENGINE_DEVICE_SIZE,
+	          number_of_buffers,
+	          2,
+	          512,
+	          errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Contiguous unaligned writes are coalesced into a single buffer
+	 */
+	write_count = libsmdev_write_engine_write_buffer(
+	               write_engine,
+	               data,
+	               100,
+	               1000,
+	               &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 100 );
+
+	write_count = libsmdev_write_engine_write_buffer(
+	               write_engine,
+	               &( data[ 100 ] ),
+	               3000,
+	               1100,
+	               &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 3000 );
+
+	/* A non-contiguous write starts a new buffer
+	 */
+	write_count = libsmdev_write_engine_write_buffer(
+	               write_engine,
+	               &( data[ 3100 ] ),
+	               10,
+	               9000,
+	               &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 10 );
+
+	result = libsmdev_write_engine_drain(
+	          write_engine,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "device.number_of_writes",
+	 device.number_of_writes,
+	 2 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "device.number_of_unaligned_writes",
+	 device.number_of_unaligned_writes,
+	 0 );
+
+	result = memory_compare(
+	          &( device.data[ 1000 ] ),
+	          data,
+	          3100 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( device.data[ 9000 ] ),
+	          &( data[ 3100 ] ),
+	          10 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The data around the writes is preserved by the read-modify-write
+	 */
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "device.data[ 999 ]",
+	 device.data[ 999 ],
+	 (uint8_t) 0xaa );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "device.data[ 4100 ]",
+	 device.data[ 4100 ],
+	 (uint8_t) 0xaa );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "device.data[ 8999 ]",
+	 device.data[ 8999 ],
+	 (uint8_t) 0xaa );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "device.data[ 9010 ]",
+	 device.data[ 9010 ],
+	 (uint8_t) 0xaa );
+
+	result = libcdata_range_list_get_number_of_elements(
+	          errors_range_list,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libsmdev_write_engine_free(
+	          &write_engine,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "write_engine",
+	 write_engine );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libcdata_range_list_free(
+	 &errors_range_list,
+	 NULL,
+	 NULL );
+
+	smdev_test_write_engine_device_free(
+	 &device,
+	 &io_backend );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( write_engine != NULL )
+	{
+		libsmdev_write_engine_free(
+		 &write_engine,
+		 NULL );
+	}
+	if( errors_range_list != NULL )
+	{
+		libcdata_range_list_free(
+		 &errors_range_list,
+		 NULL,
+		 NULL );
+	}
+	smdev_test_write_engine_device_free(
+	 &device,
+	 &io_backend );
+
+	return( 0 );
+}
+
+/* Tests writing unaligned data using a single buffer
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_write_engine_write_unaligned_single_buffer(
+     void )
+{
+	return( smdev_test_write_engine_write_unaligned(
+	         1 ) );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Tests writing unaligned data using a writer thread
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_write_engine_write_unaligned_write_behind(
+     void )
+{
+	return( smdev_test_write_engine_write_unaligned(
+	         4 ) );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Tests that write errors are added to the errors range list
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_write_engine_write_errors(
+     void )
+{
+	uint8_t data[ 16384 ];
+
+	smdev_test_write_engine_device_t device;
+
+	libcdata_range_list_t *errors_range_list = NULL;
+	libcerror_error_t *error                 = NULL;
+	libsmdev_io_backend_t *io_backend        = NULL;
+	libsmdev_write_engine_t *write_engine    = NULL;
+	intptr_t *value                          = NULL;
+	uint64_t range_offset                    = 0;
+	uint64_t range_size                      = 0;
+	ssize_t write_count                      = 0;
+	int number_of_errors                     = 0;
+	int result                               = 0;
+
+	device.data = NULL;
+
+	memory_set(
+	 data,
+	 0x55,
+	 16384 );
+
+	result = smdev_test_write_engine_device_initialize(
+	          &device,
+	          &io_backend,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	device.bad_offset     = 0x4000;
+	device.bad_size       = 512;
+	device.bad_error_code = (uint32_t) EIO;
+
+	result = libcdata_range_list_initialize(
+	          &errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_write_engine_initialize(
+	          &write_engine,
+	          io_backend,
+	          512,
+	          (size64_t) SMDEV_TEST_WRITE_ENGINE_DEVICE_SIZE,
+	          1,
+	          1,
+	          512,
+	          errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* A recoverable write error is retried in blocks of the error granularity
+	 */
+	write_count = libsmdev_write_engine_write_buffer(
+	               write_engine,
+	               data,
+	               16384,
+	               0x2000,
+	               &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 16384 );
+
+	result = libsmdev_write_engine_drain(
+	          write_engine,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_range_list_get_number_of_elements(
+	          errors_range_list,
+	          &number_of_errors,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "number_of_errors",
+	 number_of_errors,
+	 1 );
+
+	result = libcdata_range_list_get_range_by_index(
+	          errors_range_list,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &value,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "range_offset",
+	 range_offset,
+	 (uint64_t) 0x4000 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 range_size,
+	 (uint64_t) 512 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "device.data[ 0x3fff ]",
+	 device.data[ 0x3fff ],
+	 (uint8_t) 0x55 );
+
+	SMDEV_TEST_ASSERT_EQUAL_UINT8(
+	 "device.data[ 0x4200 ]",
+	 device.data[ 0x4200 ],
+	 (uint8_t) 0x55 );
+
+	/* A non-recoverable write error fails the remaining writes
+	 */
+	device.bad_error_code = (uint32_t) EROFS;
+
+	write_count = libsmdev_write_engine_write_buffer(
+	               write_engine,
+	               data,
+	               1024,
+	               0x4000,
+	               &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) 1024 );
+
+	result = libsmdev_write_engine_drain(
+	          write_engine,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	write_count = libsmdev_write_engine_write_buffer(
+	               write_engine,
+	               data,
+	               512,
+	               0,
+	               &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) -1 );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libsmdev_write_engine_free(
+	          &write_engine,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcdata_range_list_free(
+	 &errors_range_list,
+	 NULL,
+	 NULL );
+
+	smdev_test_write_engine_device_free(
+	 &device,
+	 &io_backend );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( write_engine != NULL )
+	{
+		libsmdev_write_engine_free(
+		 &write_engine,
+		 NULL );
+	}
+	if( errors_range_list != NULL )
+	{
+		libcdata_range_list_free(
+		 &errors_range_list,
+		 NULL,
+		 NULL );
+	}
+	smdev_test_write_engine_device_free(
+	 &device,
+	 &io_backend );
+
+	return( 0 );
+}
+
+/* Tests the number of device flushes of a flush policy
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_write_engine_flush_policy(
+     int flush_policy,
+     int expected_number_of_flushes_after_drain )
+{
+	uint8_t data[ 65536 ];
+
+	smdev_test_write_engine_device_t device;
+
+	libcdata_range_list_t *errors_range_list = NULL;
+	libcerror_error_t *error                 = NULL;
+	libsmdev_io_backend_t *io_backend        = NULL;
+	libsmdev_write_engine_t *write_engine    = NULL;
+	off64_t offset                           = 0;
+	ssize_t write_count                      = 0;
+	int result                               = 0;
+
+	device.data = NULL;
+
+	memory_set(
+	 data,
+	 0x33,
+	 65536 );
+
+	smdev_test_write_engine_number_of_flushes = 0;
+
+	result = smdev_test_write_engine_device_initialize(
+	          &device,
+	          &io_backend,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_range_list_initialize(
+	          &errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_write_engine_initialize(
+	          &write_engine,
+	          io_backend,
+	          512,
+	          (size64_t) SMDEV_TEST_WRITE_ENGINE_DEVICE_SIZE,
+	          1,
+	          2,
+	          0,
+	          errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_write_engine_set_flush_policy(
+	          write_engine,
+	          flush_policy,
+	          1048576,
+	          &smdev_test_write_engine_flush_device,
+	          NULL,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( offset = 0;
+	     offset < (off64_t) ( 3 * 1048576 );
+	     offset += 65536 )
+	{
+		write_count = libsmdev_write_engine_write_buffer(
+		               write_engine,
+		               data,
+		               65536,
+		               offset,
+		               &error );
+
+		SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+		 "write_count",
+		 write_count,
+		 (ssize_t) 65536 );
+	}
+	result = libsmdev_write_engine_drain(
+	          write_engine,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "smdev_test_write_engine_number_of_flushes",
+	 smdev_test_write_engine_number_of_flushes,
+	 expected_number_of_flushes_after_drain );
+
+	result = libsmdev_write_engine_flush(
+	          write_engine,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "smdev_test_write_engine_number_of_flushes",
+	 smdev_test_write_engine_number_of_flushes,
+	 expected_number_of_flushes_after_drain + 1 );
+
+	/* Clean up
+	 */
+	result = libsmdev_write_engine_free(
+	          &write_engine,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcdata_range_list_free(
+	 &errors_range_list,
+	 NULL,
+	 NULL );
+
+	smdev_test_write_engine_device_free(
+	 &device,
+	 &io_backend );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( write_engine != NULL )
+	{
+		libsmdev_write_engine_free(
+		 &write_engine,
+		 NULL );
+	}
+	if( errors_range_list != NULL )
+	{
+		libcdata_range_list_free(
+		 &errors_range_list,
+		 NULL,
+		 NULL );
+	}
+	smdev_test_write_engine_device_free(
+	 &device,
+	 &io_backend );
+
+	return( 0 );
+}
+
+/* Tests the interval flush policy
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_write_engine_flush_policy_interval(
+     void )
+{
+	return( smdev_test_write_engine_flush_policy(
+	         LIBSMDEV_WRITE_FLUSH_POLICY_INTERVAL,
+	         3 ) );
+}
+
+/* Tests the end flush policy
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_write_engine_flush_policy_end(
+     void )
+{
+	return( smdev_test_write_engine_flush_policy(
+	         LIBSMDEV_WRITE_FLUSH_POLICY_END,
+	         0 ) );
+}
+
+/* Tests the libsmdev_write_engine_data_is_zero function
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_write_engine_data_is_zero(
+     void )
+{
+	uint8_t data[ 4096 + 1 ];
+
+	int result = 0;
+
+	memory_set(
+	 data,
+	 0,
+	 4096 + 1 );
+
+	/* Test regular cases
+	 */
+	result = libsmdev_write_engine_data_is_zero(
+	          &( data[ 1 ] ),
+	          4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_write_engine_data_is_zero(
+	          &( data[ 1 ] ),
+	          0 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	data[ 2048 ] = 0x01;
+
+	result = libsmdev_write_engine_data_is_zero(
+	          &( data[ 1 ] ),
+	          4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	data[ 2048 ] = 0;
+	data[ 4096 ] = 0x01;
+
+	result = libsmdev_write_engine_data_is_zero(
+	          &( data[ 1 ] ),
+	          4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libsmdev_write_engine_data_is_zero(
+	          NULL,
+	          4096 );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests writing runs of zero blocks
+ * The data consists of a data block, two zero blocks, a data block and a partial zero block
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_write_engine_write_zero_runs(
+     int write_zeroes_supported )
+{
+	smdev_test_write_engine_device_t device;
+
+	libcdata_range_list_t *errors_range_list = NULL;
+	libcerror_error_t *error                 = NULL;
+	libsmdev_io_backend_t *io_backend        = NULL;
+	libsmdev_write_engine_t *write_engine    = NULL;
+	uint8_t *data                            = NULL;
+	size_t data_size                         = ( 4 * 65536 ) + 4096;
+	ssize_t write_count                      = 0;
+	int expected_number_of_writes            = 0;
+	int result                               = 0;
+
+	device.data = NULL;
+
+	smdev_test_write_engine_write_zeroes_supported = write_zeroes_supported;
+	smdev_test_write_engine_number_of_write_zeroes = 0;
+	smdev_test_write_engine_zeroed_size            = 0;
+
+	data = (uint8_t *) memory_allocate(
+	                    data_size );
+
+	SMDEV_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	memory_set(
+	 data,
+	 0,
+	 data_size );
+
+	memory_set(
+	 data,
+	 0x33,
+	 65536 );
+
+	memory_set(
+	 &( data[ 3 * 65536 ] ),
+	 0x33,
+	 65536 );
+
+	result = smdev_test_write_engine_device_initialize(
+	          &device,
+	          &io_backend,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_range_list_initialize(
+	          &errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_write_engine_initialize(
+	          &write_engine,
+	          io_backend,
+	          512,
+	          (size64_t) SMDEV_TEST_WRITE_ENGINE_DEVICE_SIZE,
+	          1,
+	          2,
+	          0,
+	          errors_range_list,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libsmdev_write_engine_set_write_zeroes(
+	          write_engine,
+	          &smdev_test_write_engine_write_zeroes,
+	          (intptr_t *) &device,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	write_count = libsmdev_write_engine_write_buffer(
+	               write_engine,
+	               data,
+	               data_size,
+	               0,
+	               &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_SSIZE(
+	 "write_count",
+	 write_count,
+	 (ssize_t) data_size );
+
+	result = libsmdev_write_engine_drain(
+	          write_engine,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	SMDEV_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          device.data,
+	          data,
+	          data_size );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The partial zero block at the end is written as data
+	 */
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "smdev_test_write_engine_number_of_write_zeroes",
+	 smdev_test_write_engine_number_of_write_zeroes,
+	 1 );
+
+	if( write_zeroes_supported != 0 )
+	{
+		SMDEV_TEST_ASSERT_EQUAL_UINT64(
+		 "smdev_test_write_engine_zeroed_size",
+		 (uint64_t) smdev_test_write_engine_zeroed_size,
+		 (uint64_t) ( 2 * 65536 ) );
+
+		expected_number_of_writes = 2;
+	}
+	else
+	{
+		expected_number_of_writes = 3;
+	}
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "device.number_of_writes",
+	 device.number_of_writes,
+	 expected_number_of_writes );
+
+	/* Clean up
+	 */
+	result = libsmdev_write_engine_free(
+	          &write_engine,
+	          &error );
+
+	SMDEV_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	libcdata_range_list_free(
+	 &errors_range_list,
+	 NULL,
+	 NULL );
+
+	smdev_test_write_engine_device_free(
+	 &device,
+	 &io_backend );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( write_engine != NULL )
+	{
+		libsmdev_write_engine_free(
+		 &write_engine,
+		 NULL );
+	}
+	if( errors_range_list != NULL )
+	{
+		libcdata_range_list_free(
+		 &errors_range_list,
+		 NULL,
+		 NULL );
+	}
+	smdev_test_write_engine_device_free(
+	 &device,
+	 &io_backend );
+
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* Tests writing runs of zero blocks on a device that supports writing zeroes
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_write_engine_write_zero_runs_supported(
+     void )
+{
+	return( smdev_test_write_engine_write_zero_runs(
+	         1 ) );
+}
+
+/* Tests writing runs of zero blocks on a device that does not support writing zeroes
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_write_engine_write_zero_runs_unsupported(
+     void )
+{
+	return( smdev_test_write_engine_write_zero_runs(
+	         0 ) );
+}
+
+/* Writes the benchmark data to a device using a specific number of write buffers
+ * Returns 1 if successful or -1 on error
+ */
+int smdev_test_write_engine_benchmark_device(
+     const char *filename,
+     int number_of_write_buffers,
+     size_t write_size,
+     libcerror_error_t **error )
+{
+	struct timespec end_time;
+	struct timespec start_time;
+
+	libsmdev_handle_t *handle = NULL;
+	uint8_t *data             = NULL;
+	size64_t media_size       = 0;
+	size64_t write_total      = 0;
+	uint64_t elapsed_time     = 0;
+	ssize_t write_count       = 0;
+	int result                = -1;
+
+	data = (uint8_t *) memory_allocate(
+	                    write_size );
+
+	if( data == NULL )
+	{
+		return( -1 );
+	}
+	memory_set(
+	 data,
+	 0x5a,
+	 write_size );
+
+	if( libsmdev_handle_initialize(
+	     &handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsmdev_handle_set_number_of_write_buffers(
+	     handle,
+	     number_of_write_buffers,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsmdev_handle_set_write_flush_policy(
+	     handle,
+	     LIBSMDEV_WRITE_FLUSH_POLICY_END,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsmdev_handle_open(
+	     handle,
+	     filename,
+	     LIBSMDEV_OPEN_READ_WRITE,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libsmdev_handle_get_media_size(
+	     handle,
+	     &media_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( media_size > (size64_t) SMDEV_TEST_WRITE_ENGINE_BENCHMARK_SIZE )
+	{
+		media_size = (size64_t) SMDEV_TEST_WRITE_ENGINE_BENCHMARK_SIZE;
+	}
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &start_time );
+
+	while( ( write_total + write_size ) <= media_size )
+	{
+		write_count = libsmdev_handle_write_buffer(
+		               handle,
+		               data,
+		               write_size,
+		               error );
+
+		if( write_count != (ssize_t) write_size )
+		{
+			goto on_error;
+		}
+		write_total += write_size;
+	}
+	if( libsmdev_handle_flush(
+	     handle,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	clock_gettime(
+	 CLOCK_MONOTONIC,
+	 &end_time );
+
+	elapsed_time = ( (uint64_t) ( end_time.tv_sec - start_time.tv_sec ) * 1000000 )
+	             + ( (uint64_t) end_time.tv_nsec / 1000 ) - ( (uint64_t) start_time.tv_nsec / 1000 );
+
+	if( elapsed_time == 0 )
+	{
+		elapsed_time = 1;
+	}
+	fprintf(
+	 stdout,
+	 "\n\twrite buffers: %2d, write size: %6" PRIzd ", written: %" PRIu64 " bytes, time: %" PRIu64 " us, %" PRIu64 " MiB/s",
+	 number_of_write_buffers,
+	 write_size,
+	 write_total,
+	 elapsed_time,
+	 ( write_total * 1000000 ) / ( elapsed_time * 1048576 ) );
+
+	result = 1;
+
+on_error:
+	if( handle != NULL )
+	{
+		libsmdev_handle_free(
+		 &handle,
+		 NULL );
+	}
+	memory_free(
+	 data );
+
+	return( result );
+}
+
+/* Benchmarks writing to the device named by the SMDEV_TEST_WRITE_ENGINE_DEVICE environment variable
+ * The device is overwritten, use tests/benchmark_write_engine.sh to run the benchmark on a loop device
+ * Returns 1 if successful or 0 if not
+ */
+int smdev_test_write_engine_benchmark(
+     void )
+{
+	size_t write_sizes[ 3 ] = { 1000, 65536, 1048576 };
+
+	libcerror_error_t *error = NULL;
+	const char *filename     = NULL;
+	int number_of_buffers    = 0;
+	int result               = 0;
+	int write_size_index     = 0;
+
+	filename = getenv(
+	            "SMDEV_TEST_WRITE_ENGINE_DEVICE" );
+
+	if( filename == NULL )
+	{
+		return( 1 );
+	}
+	for( write_size_index = 0;
+	     write_size_index < 3;
+	     write_size_index++ )
+	{
+		for( number_of_buffers = 0;
+		     number_of_buffers <= 4;
+		     number_of_buffers++ )
+		{
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+			if( number_of_buffers > 1 )
+			{
+				break;
+			}
+#endif
+			if( ( number_of_buffers == 2 )
+			 || ( number_of_buffers == 3 ) )
+			{
+				continue;
+			}
+			result = smdev_test_write_engine_benchmark_device(
+			          filename,
+			          number_of_buffers,
+			          write_sizes[ write_size_index ],
+			          &error );
+
+			SMDEV_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			SMDEV_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	fprintf(
+	 stdout,
+	 "\n" );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc SMDEV_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] SMDEV_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argc )
+	SMDEV_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_write_engine_buffer_initialize",
+	 smdev_test_write_engine_buffer_initialize );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_write_engine_write_buffer unaligned",
+	 smdev_test_write_engine_write_unaligned_single_buffer );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	SMDEV_TEST_RUN(
+	 "libsmdev_write_engine_write_buffer write-behind",
+	 smdev_test_write_engine_write_unaligned_write_behind );
+#endif
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_write_engine_write_buffer errors",
+	 smdev_test_write_engine_write_errors );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_write_engine_flush interval",
+	 smdev_test_write_engine_flush_policy_interval );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_write_engine_flush end",
+	 smdev_test_write_engine_flush_policy_end );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_write_engine_data_is_zero",
+	 smdev_test_write_engine_data_is_zero );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_write_engine_write_data zero runs",
+	 smdev_test_write_engine_write_zero_runs_supported );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_write_engine_write_data zero runs unsupported",
+	 smdev_test_write_engine_write_zero_runs_unsupported );
+
+	SMDEV_TEST_RUN(
+	 "libsmdev_write_engine benchmark",
+	 smdev_test_write_engine_benchmark );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBSMDEV_DLL_IMPORT ) && defined( HAVE_UNISTD_H ) && !defined( WINAPI ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "ata error notify optical_disc scsi sector_range string support track_value"
+$LibraryTests = "ata composite copy device_list error fallback_source geometry io_backend io_control notify optical_disc optical_read parallel_reader probe_cache read_ahead read_scheduler read_speed sampler sanitizer scsi sector_range simulated_device string support table_of_contents track_value transport_profile usb verify write_engine"
 $LibraryTestsWithInput = "handle"
 $OptionSets = ""
 
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="ata error notify optical_disc scsi sector_range string support track_value";
+LIBRARY_TESTS="ata composite copy device_list error fallback_source geometry io_backend io_control notify optical_disc optical_read parallel_reader probe_cache read_ahead read_scheduler read_speed sampler sanitizer scsi sector_range simulated_device string support table_of_contents track_value transport_profile usb verify write_engine";
 LIBRARY_TESTS_WITH_INPUT="handle";
 OPTION_SETS=();
 